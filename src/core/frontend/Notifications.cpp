@@ -1,67 +1,145 @@
 #include "Notifications.hpp"
 
 #include "core/logger/LogHelper.hpp"
+#include "core/renderer/Renderer.hpp"
 #include "game/backend/FiberPool.hpp" // TODO: game import in core
 #include "util/Joaat.hpp"
 
-#include <mutex>
+#include <cstring>
 
 namespace YimMenu
 {
-
-	Notification Notifications::ShowImpl(std::string title, std::string message, NotificationType type, int duration, std::function<void()> context_function, std::string context_function_name)
+	// the same notification shown again is coalesced with the one on screen, so it is identified by its text
+	static std::uint32_t GetIdentifier(std::string_view title, std::string_view message)
 	{
-		if (title.empty() || message.empty())
-			return {};
-
-		auto message_id = Joaat(title + message);
-
-		auto exists = std::find_if(m_Notifications.begin(), m_Notifications.end(), [&](auto& notification) {
-			return notification.second.m_Identifier	== message_id;
-		});
-
-		if (exists != m_Notifications.end())
+		// joaat of title + message, without building the string
+		std::uint32_t hash = 0;
+		for (auto str : {title, message})
 		{
-			exists->second.m_CreatedOn = std::chrono::system_clock::now();
-			return {};
+			for (auto c : str)
+			{
+				hash += ToLower(c);
+				hash += (hash << 10);
+				hash ^= (hash >> 6);
+			}
 		}
+		hash += (hash << 3);
+		hash ^= (hash >> 11);
+		hash += (hash << 15);
+		return hash;
+	}
 
-		Notification notification{};
-		notification.m_Title      = title;
-		notification.m_Message    = message;
-		notification.m_Type       = type;
-		notification.m_CreatedOn = std::chrono::system_clock::now();
-		notification.m_Duration   = duration;
-		notification.m_Identifier = message_id;
+	// text that doesn't fit ends in "..." and is cut on a utf-8 character boundary
+	template<std::size_t N>
+	static void CopyTruncated(char (&dest)[N], std::string_view src)
+	{
+		constexpr std::string_view ellipsis = "...";
 
-		if (context_function)
+		if (src.size() < N)
 		{
-			notification.m_ContextFunc = context_function;
-			notification.m_ContextFuncName = context_function_name.empty() ? "Context Function" : context_function_name;
+			std::memcpy(dest, src.data(), src.size());
+			dest[src.size()] = '\0';
+			return;
 		}
 
-		std::lock_guard<std::mutex> lock(m_mutex);
-		auto result = m_Notifications.insert(std::make_pair(title + message, notification));
+		auto size = N - 1 - ellipsis.size();
+		while (size > 0 && (src[size] & 0xC0) == 0x80)
+			size--;
+		std::memcpy(dest, src.data(), size);
+		std::memcpy(dest + size, ellipsis.data(), ellipsis.size());
+		dest[size + ellipsis.size()] = '\0';
+	}
+
+	std::uint32_t Notifications::ShowImpl(std::string_view title, std::string_view message, NotificationType type, int duration, std::function<void()> context_function, std::string_view context_function_name)
+	{
+		if (title.empty() || message.empty())
+			return 0;
+
+		auto identifier = GetIdentifier(title, message);
+
+		// if the queue is full the notification is dropped, which is counted and reported by the render thread
+		m_Requests.Emplace([&](NotificationRequest& request) {
+			request.m_Action     = NotificationRequest::Action::SHOW;
+			request.m_Type       = type;
+			request.m_Duration   = duration;
+			request.m_Identifier = identifier;
+			CopyTruncated(request.m_Title, title);
+			CopyTruncated(request.m_Message, message);
+			CopyTruncated(request.m_ContextFuncName, context_function_name.empty() ? "Context Function" : context_function_name);
+			request.m_ContextFunc = std::move(context_function);
+		});
 
-		return notification;
+		return identifier;
 	}
 
-	bool Notifications::EraseImpl(Notification notification)
+	void Notifications::EraseImpl(std::uint32_t identifier)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		for (auto& [id, n] : m_Notifications)
-		{
-			if (n.m_Identifier == notification.m_Identifier)
+		m_Requests.Emplace([&](NotificationRequest& request) {
+			request.m_Action     = NotificationRequest::Action::ERASE;
+			request.m_Identifier = identifier;
+		});
+	}
+
+	void Notifications::ProcessRequests(std::chrono::steady_clock::time_point now)
+	{
+		auto show = [&](NotificationType type, std::string_view title, std::string_view message, int duration, std::uint32_t identifier, std::function<void()>&& context_function, std::string_view context_function_name) -> Notification& {
+			auto existing = std::find_if(m_Notifications.begin(), m_Notifications.end(), [&](const Notification& notification) {
+				return notification.m_Identifier == identifier;
+			});
+
+			if (existing != m_Notifications.end())
 			{
-				n.m_Erasing = true;
-				return true;
+				existing->m_CreatedOn = now;
+				existing->m_Count++;
+				existing->m_Erasing = false;
+				return *existing;
 			}
+
+			// no room left, the oldest card makes way
+			if (m_Notifications.size() >= MAX_CARDS)
+				m_Notifications.erase(m_Notifications.begin());
+
+			auto& notification        = m_Notifications.emplace_back();
+			notification.m_Type       = type;
+			notification.m_Title      = title;
+			notification.m_Message    = message;
+			notification.m_CreatedOn  = now;
+			notification.m_Duration   = duration;
+			notification.m_Identifier = identifier;
+
+			if (context_function)
+			{
+				notification.m_ContextFunc     = std::move(context_function);
+				notification.m_ContextFuncName = context_function_name;
+			}
+
+			return notification;
+		};
+
+		while (m_Requests.Consume([&](NotificationRequest& request) {
+			if (request.m_Action == NotificationRequest::Action::ERASE)
+			{
+				for (auto& notification : m_Notifications)
+					if (notification.m_Identifier == request.m_Identifier)
+						notification.m_Erasing = true;
+				return;
+			}
+
+			show(request.m_Type, request.m_Title, request.m_Message, request.m_Duration, request.m_Identifier, std::move(request.m_ContextFunc), request.m_ContextFuncName);
+			request.m_ContextFunc = nullptr;
+		}))
+		{
 		}
 
-		return false;
+		if (auto dropped = m_Requests.TakeDropped())
+		{
+			constexpr std::string_view title   = "Notifications";
+			constexpr std::string_view message = "Too many notifications at once, some were not shown";
+			show(NotificationType::Warning, title, message, 5000, GetIdentifier(title, message), nullptr, {}).m_Count += dropped - 1;
+		}
 	}
 
-	static void DrawNotification(Notification& notification, int position)
+	static void DrawNotification(Notification& notification, int position, std::chrono::steady_clock::time_point now)
 	{
 		float y_pos = position * 100;
 		float x_pos = 10;
@@ -70,10 +148,11 @@ namespace YimMenu
 		ImGui::SetNextWindowSize(cardSize, ImGuiCond_Always);
 		ImGui::SetNextWindowPos(ImVec2(x_pos + notification.m_AnimationOffset, y_pos + 10), ImGuiCond_Always);
 
-		std::string windowTitle = std::to_string(position);
-		ImGui::Begin(windowTitle.c_str(), nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoFocusOnAppearing);
+		char windowTitle[16];
+		*std::format_to_n(windowTitle, sizeof(windowTitle) - 1, "{}", position).out = '\0';
+		ImGui::Begin(windowTitle, nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoFocusOnAppearing);
 
-		auto timeElapsed = (float)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - notification.m_CreatedOn).count();
+		auto timeElapsed = (float)std::chrono::duration_cast<std::chrono::milliseconds>(now - notification.m_CreatedOn).count();
 
 		auto depletionProgress = 1.0f - (timeElapsed / (float)notification.m_Duration);
 
@@ -105,14 +184,17 @@ namespace YimMenu
 
 		ImGui::Separator();
 
-		ImGui::TextWrapped("%s", notification.m_Message.c_str());
+		if (notification.m_Count > 1)
+			ImGui::TextWrapped("%s (x%u)", notification.m_Message.c_str(), notification.m_Count);
+		else
+			ImGui::TextWrapped("%s", notification.m_Message.c_str());
 
 		if (notification.m_ContextFunc)
 		{
 			ImGui::Spacing();
 			if (ImGui::Selectable(notification.m_ContextFuncName.c_str()))
-				FiberPool::Push([notification] {
-					notification.m_ContextFunc();
+				FiberPool::Push([func = notification.m_ContextFunc] {
+					func();
 				});
 		}
 
@@ -121,42 +203,37 @@ namespace YimMenu
 
 	void Notifications::DrawImpl()
 	{
-		std::vector<std::string> keys_to_erase;
-		{
-			std::lock_guard<std::mutex> lock(m_mutex);
-			int position = 0;
+		auto now = std::chrono::steady_clock::now();
 
-			for (auto& [id, notification] : m_Notifications)
-			{
-				DrawNotification(notification, position);
-
-				if (!notification.m_Erasing)
-				{
-					if (notification.m_AnimationOffset < 0)
-						notification.m_AnimationOffset += m_CardAnimationSpeed;
-
-					//Need this to account for changes in card size (x dimension), custom increments might result in odd numbers
-					if (notification.m_AnimationOffset > 0)
-						notification.m_AnimationOffset = 0.f;
-				}
-				else
-				{
-					notification.m_AnimationOffset -= m_CardAnimationSpeed;
-					if (notification.m_AnimationOffset <= -m_CardSizeX)
-						keys_to_erase.push_back(id);
-				}
+		// while the renderer is over budget new requests wait for a refresh frame, the cards on screen keep animating
+		if (Renderer::IsRefreshFrame())
+			ProcessRequests(now);
 
+		int position = 0;
+		for (auto& notification : m_Notifications)
+		{
+			DrawNotification(notification, position, now);
 
-				if ((float)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - notification.m_CreatedOn).count() >= notification.m_Duration)
-					keys_to_erase.push_back(id);
+			if (!notification.m_Erasing)
+			{
+				if (notification.m_AnimationOffset < 0)
+					notification.m_AnimationOffset += m_CardAnimationSpeed;
 
-				position++;
+				//Need this to account for changes in card size (x dimension), custom increments might result in odd numbers
+				if (notification.m_AnimationOffset > 0)
+					notification.m_AnimationOffset = 0.f;
 			}
+			else
+			{
+				notification.m_AnimationOffset -= m_CardAnimationSpeed;
+			}
+
+			position++;
 		}
-		std::lock_guard<std::mutex> lock(m_mutex);
-		for (const auto& key : keys_to_erase)
-		{
-			m_Notifications.erase(key);
-		}
+
+		std::erase_if(m_Notifications, [now](const Notification& notification) {
+			return (notification.m_Erasing && notification.m_AnimationOffset <= -m_CardSizeX)
+			    || std::chrono::duration_cast<std::chrono::milliseconds>(now - notification.m_CreatedOn).count() >= notification.m_Duration;
+		});
 	}
 }
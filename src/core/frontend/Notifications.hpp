@@ -1,4 +1,5 @@
 #pragma once
+#include "core/misc/BoundedQueue.hpp"
 
 namespace YimMenu
 {
@@ -19,25 +20,50 @@ namespace YimMenu
 		NotificationType m_Type;
 		std::string m_Title;
 		std::string m_Message;
-		std::chrono::time_point<std::chrono::system_clock> m_CreatedOn;
+		std::chrono::steady_clock::time_point m_CreatedOn;
 		int m_Duration;
 		std::function<void()> m_ContextFunc;
 		std::string m_ContextFuncName;
 		float m_AnimationOffset = -m_CardSizeX;
 		bool m_Erasing = false;
 		std::uint32_t m_Identifier;
+		std::uint32_t m_Count = 1; // how many times it was shown while on screen
+	};
+
+	// what Show and Erase hand over to the render thread. the text is copied into fixed size buffers so posting one
+	// doesn't allocate for it, only a context function too big for std::function's small buffer does
+	struct NotificationRequest
+	{
+		enum class Action : std::uint8_t
+		{
+			SHOW,
+			ERASE
+		};
+
+		Action m_Action;
+		NotificationType m_Type;
+		int m_Duration;
+		std::uint32_t m_Identifier;
+		char m_Title[128];
+		char m_Message[1024];
+		char m_ContextFuncName[64];
+		std::function<void()> m_ContextFunc;
 	};
 
 	class Notifications
 	{
 	private:
-		std::unordered_map<std::string, Notification> m_Notifications = {};
-		std::mutex m_mutex;
+		static constexpr std::size_t MAX_CARDS = 10;
+
+		// written by any thread, drained by the render thread, which is the only one that touches the cards
+		BoundedQueue<NotificationRequest, 128> m_Requests;
+		std::vector<Notification> m_Notifications; // in the order they are drawn
 
 		// duration is in milliseconds
-		Notification ShowImpl(std::string title, std::string message, NotificationType type, int duration, std::function<void()> context_function, std::string context_function_name);
+		std::uint32_t ShowImpl(std::string_view title, std::string_view message, NotificationType type, int duration, std::function<void()> context_function, std::string_view context_function_name);
 		void DrawImpl();
-		bool EraseImpl(Notification notification);
+		void EraseImpl(std::uint32_t identifier);
+		void ProcessRequests(std::chrono::steady_clock::time_point now);
 
 		static Notifications& GetInstance()
 		{
@@ -46,9 +72,11 @@ namespace YimMenu
 		}
 
 	public:
-		static Notification Show(std::string title, std::string message, NotificationType type = NotificationType::Info, int duration = 5000, std::function<void()> context_function = nullptr, std::string context_function_name = "")
+		// can be called from any thread. a notification that is already on screen isn't added again, its timer is reset
+		// and its counter goes up instead. returns the identifier that Erase takes
+		static std::uint32_t Show(std::string_view title, std::string_view message, NotificationType type = NotificationType::Info, int duration = 5000, std::function<void()> context_function = nullptr, std::string_view context_function_name = "")
 		{
-			return GetInstance().ShowImpl(title, message, type, duration, context_function, context_function_name);
+			return GetInstance().ShowImpl(title, message, type, duration, std::move(context_function), context_function_name);
 		}
 
 		static void Draw()
@@ -56,10 +84,10 @@ namespace YimMenu
 			GetInstance().DrawImpl();
 		}
 
-		static bool Erase(Notification notification)
+		static void Erase(std::uint32_t identifier)
 		{
-			return GetInstance().EraseImpl(notification);
+			GetInstance().EraseImpl(identifier);
 		}
 	};
 
-}
\ No newline at end of file
+}
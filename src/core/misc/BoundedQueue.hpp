@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace YimMenu
+{
+	// Fixed capacity multi producer queue (Vyukov's bounded queue). Push never blocks or allocates and simply fails when
+	// the queue is full, which makes it safe to use from hooks that run during an attack
+	template<typename T, std::size_t Capacity>
+	class BoundedQueue
+	{
+		static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+		struct Slot
+		{
+			std::atomic<std::size_t> m_Sequence;
+			T m_Value;
+		};
+
+		alignas(64) std::array<Slot, Capacity> m_Slots;
+		alignas(64) std::atomic<std::size_t> m_Head{0};
+		alignas(64) std::atomic<std::size_t> m_Tail{0};
+		std::atomic<std::uint32_t> m_Dropped{0};
+
+	public:
+		BoundedQueue()
+		{
+			for (std::size_t i = 0; i < Capacity; i++)
+				m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		BoundedQueue(const BoundedQueue&)            = delete;
+		BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+		// fill is called with a reference to the reserved slot, so large records are written in place instead of copied
+		template<typename F>
+		bool Emplace(F&& fill)
+		{
+			auto pos = m_Tail.load(std::memory_order_relaxed);
+			Slot* slot;
+			while (true)
+			{
+				slot     = &m_Slots[pos & (Capacity - 1)];
+				auto seq = slot->m_Sequence.load(std::memory_order_acquire);
+				auto dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+				if (dif == 0)
+				{
+					if (m_Tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (dif < 0)
+				{
+					m_Dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				else
+				{
+					pos = m_Tail.load(std::memory_order_relaxed);
+				}
+			}
+
+			fill(slot->m_Value);
+			slot->m_Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool Push(const T& value)
+		{
+			return Emplace([&value](T& slot) {
+				slot = value;
+			});
+		}
+
+		// only one thread may consume at a time
+		template<typename F>
+		bool Consume(F&& callback)
+		{
+			auto pos  = m_Head.load(std::memory_order_relaxed);
+			auto slot = &m_Slots[pos & (Capacity - 1)];
+			auto seq  = slot->m_Sequence.load(std::memory_order_acquire);
+
+			if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0)
+				return false;
+
+			m_Head.store(pos + 1, std::memory_order_relaxed);
+			callback(slot->m_Value);
+			slot->m_Sequence.store(pos + Capacity, std::memory_order_release);
+			return true;
+		}
+
+		std::optional<T> Pop()
+		{
+			std::optional<T> result;
+			Consume([&result](T& value) {
+				result = std::move(value);
+			});
+			return result;
+		}
+
+		// number of pushes that failed since the last call
+		std::uint32_t TakeDropped()
+		{
+			return m_Dropped.exchange(0, std::memory_order_relaxed);
+		}
+	};
+}
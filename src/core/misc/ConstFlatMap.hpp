@@ -0,0 +1,74 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace YimMenu
+{
+	// Read-only map stored as one array sorted by key and built entirely at compile time, so it costs no heap and no
+	// startup work, and a lookup is a binary search over contiguous memory. The entries have to be written in ascending
+	// key order without duplicates, which is checked when the map is built. Sorting them in the compiler instead would
+	// run into the constant evaluation limits for tables of a few thousand entries
+	template<typename K, typename V, std::size_t N>
+	class ConstFlatMap
+	{
+	public:
+		using key_type       = K;
+		using mapped_type    = V;
+		using value_type     = std::pair<K, V>;
+		using const_iterator = typename std::array<value_type, N>::const_iterator;
+
+	private:
+		std::array<value_type, N> m_Entries{};
+
+	public:
+		consteval ConstFlatMap(const value_type (&entries)[N])
+		{
+			for (std::size_t i = 0; i < N; i++)
+			{
+				// not a constant expression, so an unsorted table fails to compile
+				if (i != 0 && !(entries[i - 1].first < entries[i].first))
+					throw "ConstFlatMap entries must be sorted by key and unique";
+
+				m_Entries[i] = entries[i];
+			}
+		}
+
+		constexpr const_iterator begin() const
+		{
+			return m_Entries.begin();
+		}
+
+		constexpr const_iterator end() const
+		{
+			return m_Entries.end();
+		}
+
+		constexpr std::size_t size() const
+		{
+			return N;
+		}
+
+		constexpr const_iterator find(const K& key) const
+		{
+			auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), key, [](const value_type& entry, const K& key) {
+				return entry.first < key;
+			});
+
+			return it != m_Entries.end() && !(key < it->first) ? it : m_Entries.end();
+		}
+
+		constexpr bool contains(const K& key) const
+		{
+			return find(key) != end();
+		}
+	};
+
+	// the size is deduced from the braced list: MakeConstFlatMap<joaat_t, const char*>({{"a"_J, "a"}, ...})
+	template<typename K, typename V, std::size_t N>
+	consteval ConstFlatMap<K, V, N> MakeConstFlatMap(const std::pair<K, V> (&entries)[N])
+	{
+		return ConstFlatMap<K, V, N>(entries);
+	}
+}
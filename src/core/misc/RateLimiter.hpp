@@ -1,42 +1,126 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 
 namespace YimMenu
 {
+	enum class RateLimitResult : std::uint8_t
+	{
+		ALLOWED,
+		EXCEEDED, // first rejection after a run of allowed attempts
+		LIMITED   // still being rejected
+	};
+
+	// Lock-free GCRA (generic cell rate algorithm) limiter. Behaves like a token bucket that holds numAllowedAttempts
+	// tokens and refills one every period / numAllowedAttempts, but only needs a single atomic timestamp per bucket
 	class RateLimiter
 	{
-		uint32_t m_AttemptsAllowedInTimePeriod;
-		std::chrono::milliseconds m_TimePeriod;
-		std::chrono::system_clock::time_point m_LastEventTime{};
-		uint32_t m_NumAttemptsAllowed = 0;
+	public:
+		// the state of a single bucket, kept separate so that registries can store many buckets that share one config
+		struct Cell
+		{
+			std::atomic<std::int64_t> m_TheoreticalArrival{0};
+			std::atomic<bool> m_Limited{false};
+
+			void Reset()
+			{
+				m_TheoreticalArrival.store(0, std::memory_order_relaxed);
+				m_Limited.store(false, std::memory_order_relaxed);
+			}
+		};
+
+		struct Config
+		{
+			std::int64_t m_EmissionInterval; // ns between two refilled tokens
+			std::int64_t m_Tolerance;        // ns the bucket may run ahead of now, i.e. the burst size
+
+			// unlimited
+			constexpr Config() :
+			    m_EmissionInterval(0),
+			    m_Tolerance(INT64_MAX)
+			{
+			}
+
+			constexpr Config(std::chrono::nanoseconds period, std::uint32_t numAllowedAttempts) :
+			    m_EmissionInterval(period.count() / std::max(numAllowedAttempts, 1u)),
+			    m_Tolerance(period.count() - m_EmissionInterval)
+			{
+			}
+
+			static constexpr Config Unlimited()
+			{
+				return Config();
+			}
+		};
+
+		// monotonic, so wall clock adjustments can't reset or freeze a bucket
+		static std::int64_t Now()
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		static RateLimitResult Process(Cell& cell, const Config& config, std::int64_t now)
+		{
+			if (config.m_Tolerance == INT64_MAX)
+				return RateLimitResult::ALLOWED;
+
+			auto arrival = cell.m_TheoreticalArrival.load(std::memory_order_relaxed);
+			while (true)
+			{
+				auto base = std::max(arrival, now);
+				if (base - now > config.m_Tolerance)
+				{
+					return cell.m_Limited.exchange(true, std::memory_order_relaxed) ? RateLimitResult::LIMITED : RateLimitResult::EXCEEDED;
+				}
+
+				if (cell.m_TheoreticalArrival.compare_exchange_weak(arrival, base + config.m_EmissionInterval, std::memory_order_relaxed))
+					break;
+			}
+
+			if (cell.m_Limited.load(std::memory_order_relaxed))
+				cell.m_Limited.store(false, std::memory_order_relaxed);
+
+			return RateLimitResult::ALLOWED;
+		}
+
+	private:
+		Config m_Config;
+		Cell m_Cell;
+		std::atomic<RateLimitResult> m_LastResult{RateLimitResult::ALLOWED};
 
 	public:
 		RateLimiter(std::chrono::milliseconds period, uint32_t numAllowedAttempts) :
-		    m_AttemptsAllowedInTimePeriod(numAllowedAttempts),
-		    m_TimePeriod(period)
+		    m_Config(period, numAllowedAttempts)
 		{
 		}
 
+		RateLimiter(const RateLimiter& other) :
+		    m_Config(other.m_Config)
+		{
+		}
+
+		RateLimiter& operator=(const RateLimiter& other)
+		{
+			m_Config = other.m_Config;
+			m_Cell.Reset();
+			m_LastResult.store(RateLimitResult::ALLOWED, std::memory_order_relaxed);
+			return *this;
+		}
+
 		// Returns true if the rate limit has been exceeded
 		bool Process()
 		{
-			if (std::chrono::system_clock::now() - m_LastEventTime < m_TimePeriod)
-			{
-				if (++m_NumAttemptsAllowed > m_AttemptsAllowedInTimePeriod)
-					return true;
-			}
-			else
-			{
-				m_LastEventTime      = std::chrono::system_clock::now();
-				m_NumAttemptsAllowed = 1;
-			}
-			return false;
+			auto result = Process(m_Cell, m_Config, Now());
+			m_LastResult.store(result, std::memory_order_relaxed);
+			return result != RateLimitResult::ALLOWED;
 		}
 
 		// Check if the rate limit was exceeded by the last process() call. Use this to prevent the player from being flooded with notifications
 		bool ExceededLastProcess()
 		{
-			return (m_NumAttemptsAllowed - 1) == m_AttemptsAllowedInTimePeriod;
+			return m_LastResult.load(std::memory_order_relaxed) == RateLimitResult::EXCEEDED;
 		}
 	};
-}
\ No newline at end of file
+}
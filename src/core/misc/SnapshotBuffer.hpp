@@ -0,0 +1,54 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace YimMenu
+{
+	// Hands complete snapshots from one producer thread to one consumer thread without either side waiting. The producer
+	// fills the back buffer and publishes it, the consumer picks up the newest published buffer when it starts a frame.
+	// A third buffer sits in between so the producer never writes to the buffer that is being read
+	template<typename T>
+	class SnapshotBuffer
+	{
+		static constexpr std::uint8_t INDEX_MASK = 0b011;
+		static constexpr std::uint8_t FRESH      = 0b100;
+
+		std::array<T, 3> m_Buffers{};
+		alignas(64) std::atomic<std::uint8_t> m_Shared{1};
+		alignas(64) std::uint8_t m_Back = 0; // owned by the producer
+		alignas(64) std::uint8_t m_Front = 2; // owned by the consumer
+
+	public:
+		SnapshotBuffer() = default;
+		SnapshotBuffer(const SnapshotBuffer&)            = delete;
+		SnapshotBuffer& operator=(const SnapshotBuffer&) = delete;
+
+		// producer only. the returned buffer still holds whatever was published two snapshots ago
+		T& GetBack()
+		{
+			return m_Buffers[m_Back];
+		}
+
+		// producer only
+		void Publish()
+		{
+			m_Back = m_Shared.exchange(m_Back | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+		}
+
+		// consumer only. the returned reference stays valid and unchanged until the next call
+		const T& GetFront()
+		{
+			if (m_Shared.load(std::memory_order_relaxed) & FRESH)
+				m_Front = m_Shared.exchange(m_Front, std::memory_order_acq_rel) & INDEX_MASK;
+
+			return m_Buffers[m_Front];
+		}
+
+		// consumer only. what GetFront returned last, without picking up a newer snapshot
+		const T& GetCurrent() const
+		{
+			return m_Buffers[m_Front];
+		}
+	};
+}
@@ -0,0 +1,215 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include <rage/vector.hpp>
+
+namespace YimMenu
+{
+	// Uniform grid over the xy plane, stored as a hash table of cells that is rebuilt from scratch in O(n). Items are
+	// referred to by their index in the span the grid was built from. The world is mostly flat, so height is only taken
+	// into account by the exact distance checks
+	class SpatialGrid
+	{
+		float m_CellSize;
+		float m_InvCellSize;
+
+		// sorted by bucket, so the items of a cell are contiguous
+		std::vector<rage::fvector3> m_Positions;
+		std::vector<std::uint64_t> m_Cells;
+		std::vector<std::uint32_t> m_Items;
+		std::vector<std::uint32_t> m_BucketStart; // m_BucketStart[b] .. m_BucketStart[b + 1] are the items of bucket b
+
+		// bounds of everything in the grid, used to cap searches that grow their radius
+		float m_MinX = 0, m_MinY = 0, m_MinZ = 0, m_MaxX = 0, m_MaxY = 0, m_MaxZ = 0;
+
+		std::int32_t ToCell(float coord) const
+		{
+			return static_cast<std::int32_t>(std::floor(coord * m_InvCellSize));
+		}
+
+		static std::uint64_t MakeCell(std::int32_t x, std::int32_t y)
+		{
+			return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+		}
+
+		std::size_t GetBucket(std::uint64_t cell) const
+		{
+			// 64 bit mix (splitmix64 finalizer), the low bits of the product pick the bucket
+			cell ^= cell >> 33;
+			cell *= 0xFF51AFD7ED558CCDull;
+			cell ^= cell >> 33;
+			return cell & (m_BucketStart.size() - 2);
+		}
+
+		static float DistanceSquared(const rage::fvector3& a, const rage::fvector3& b)
+		{
+			auto dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+			return dx * dx + dy * dy + dz * dz;
+		}
+
+		// calls visit(index in the sorted arrays) for every item in the cells overlapping the box, or for every item if
+		// the box covers more cells than there are items
+		template<typename F>
+		void VisitBox(float min_x, float min_y, float max_x, float max_y, F&& visit) const
+		{
+			if (m_Items.empty())
+				return;
+
+			auto x0 = ToCell(std::max(min_x, m_MinX)), x1 = ToCell(std::min(max_x, m_MaxX));
+			auto y0 = ToCell(std::max(min_y, m_MinY)), y1 = ToCell(std::min(max_y, m_MaxY));
+			if (x0 > x1 || y0 > y1)
+				return;
+
+			auto numCells = static_cast<std::uint64_t>(x1 - x0 + 1) * static_cast<std::uint64_t>(y1 - y0 + 1);
+			if (numCells >= m_Items.size())
+			{
+				for (std::uint32_t i = 0; i < m_Items.size(); i++)
+					visit(i);
+				return;
+			}
+
+			for (auto x = x0; x <= x1; x++)
+			{
+				for (auto y = y0; y <= y1; y++)
+				{
+					auto cell   = MakeCell(x, y);
+					auto bucket = GetBucket(cell);
+					for (auto i = m_BucketStart[bucket]; i < m_BucketStart[bucket + 1]; i++)
+					{
+						// buckets are shared by unrelated cells, which must not be reported twice
+						if (m_Cells[i] == cell)
+							visit(i);
+					}
+				}
+			}
+		}
+
+	public:
+		explicit SpatialGrid(float cell_size = 32.0f) :
+		    m_CellSize(cell_size),
+		    m_InvCellSize(1.0f / cell_size)
+		{
+		}
+
+		void Build(std::span<const rage::fvector3> positions)
+		{
+			auto count      = positions.size();
+			auto numBuckets = std::bit_ceil(std::max<std::size_t>(count, 16));
+
+			m_Positions.resize(count);
+			m_Cells.resize(count);
+			m_Items.resize(count);
+			m_BucketStart.assign(numBuckets + 1, 0);
+
+			if (count)
+			{
+				m_MinX = m_MaxX = positions[0].x;
+				m_MinY = m_MaxY = positions[0].y;
+				m_MinZ = m_MaxZ = positions[0].z;
+			}
+
+			// counting sort by bucket: count, prefix sum, then scatter
+			thread_local std::vector<std::uint32_t> buckets;
+			buckets.resize(count);
+			for (std::size_t i = 0; i < count; i++)
+			{
+				auto& pos  = positions[i];
+				m_MinX     = std::min(m_MinX, pos.x);
+				m_MinY     = std::min(m_MinY, pos.y);
+				m_MaxX     = std::max(m_MaxX, pos.x);
+				m_MaxY     = std::max(m_MaxY, pos.y);
+				m_MinZ     = std::min(m_MinZ, pos.z);
+				m_MaxZ     = std::max(m_MaxZ, pos.z);
+				buckets[i] = static_cast<std::uint32_t>(GetBucket(MakeCell(ToCell(pos.x), ToCell(pos.y))));
+				m_BucketStart[buckets[i] + 1]++;
+			}
+
+			for (std::size_t b = 0; b < numBuckets; b++)
+				m_BucketStart[b + 1] += m_BucketStart[b];
+
+			thread_local std::vector<std::uint32_t> next;
+			next.assign(m_BucketStart.begin(), m_BucketStart.end() - 1);
+			for (std::uint32_t i = 0; i < count; i++)
+			{
+				auto slot         = next[buckets[i]]++;
+				m_Positions[slot] = positions[i];
+				m_Cells[slot]     = MakeCell(ToCell(positions[i].x), ToCell(positions[i].y));
+				m_Items[slot]     = i;
+			}
+		}
+
+		std::size_t GetSize() const
+		{
+			return m_Items.size();
+		}
+
+		// calls callback(item, distance squared) for every item within radius of center
+		template<typename F>
+		void ForEachInRadius(const rage::fvector3& center, float radius, F&& callback) const
+		{
+			auto radiusSq = radius * radius;
+			VisitBox(center.x - radius, center.y - radius, center.x + radius, center.y + radius, [&](std::uint32_t i) {
+				if (auto distSq = DistanceSquared(m_Positions[i], center); distSq <= radiusSq)
+					callback(m_Items[i], distSq);
+			});
+		}
+
+		// calls callback(item, distance along the ray) for every item within radius of the segment from origin to
+		// origin + direction * length. direction must be normalized
+		template<typename F>
+		void ForEachNearRay(const rage::fvector3& origin, const rage::fvector3& direction, float length, float radius, F&& callback) const
+		{
+			auto end_x    = origin.x + direction.x * length;
+			auto end_y    = origin.y + direction.y * length;
+			auto radiusSq = radius * radius;
+
+			VisitBox(std::min(origin.x, end_x) - radius, std::min(origin.y, end_y) - radius, std::max(origin.x, end_x) + radius, std::max(origin.y, end_y) + radius, [&](std::uint32_t i) {
+				auto& pos = m_Positions[i];
+				auto t    = (pos.x - origin.x) * direction.x + (pos.y - origin.y) * direction.y + (pos.z - origin.z) * direction.z;
+				t         = std::clamp(t, 0.0f, length);
+
+				rage::fvector3 closest{origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t};
+				if (DistanceSquared(pos, closest) <= radiusSq)
+					callback(m_Items[i], t);
+			});
+		}
+
+		// the k items closest to center that pass filter(item), nearest first, as (distance squared, item) pairs
+		template<typename Filter>
+		void FindNearest(const rage::fvector3& center, std::size_t k, Filter&& filter, std::vector<std::pair<float, std::uint32_t>>& out) const
+		{
+			out.clear();
+			if (k == 0 || m_Items.empty())
+				return;
+
+			// once the radius reaches the farthest corner of the bounds every item has been seen
+			auto far_x     = std::max(std::abs(center.x - m_MinX), std::abs(center.x - m_MaxX));
+			auto far_y     = std::max(std::abs(center.y - m_MinY), std::abs(center.y - m_MaxY));
+			auto far_z     = std::max(std::abs(center.z - m_MinZ), std::abs(center.z - m_MaxZ));
+			auto maxRadius = std::sqrt(far_x * far_x + far_y * far_y + far_z * far_z);
+
+			// grow the search until it holds k items. everything within the radius has been found at that point, so the
+			// k closest of them are the k closest overall
+			for (auto radius = m_CellSize;; radius *= 2)
+			{
+				out.clear();
+				ForEachInRadius(center, radius, [&](std::uint32_t item, float distSq) {
+					if (filter(item))
+						out.emplace_back(distSq, item);
+				});
+
+				if (out.size() >= k || radius >= maxRadius)
+					break;
+			}
+
+			auto n = std::min(k, out.size());
+			std::partial_sort(out.begin(), out.begin() + n, out.end());
+			out.resize(n);
+		}
+	};
+}
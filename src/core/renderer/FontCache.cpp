@@ -0,0 +1,264 @@
+#include "FontCache.hpp"
+
+#include <cstring>
+#include <imgui_internal.h>
+
+namespace YimMenu
+{
+	static constexpr std::uint32_t MAGIC   = 0x43464D48; // HMFC
+	static constexpr std::uint32_t VERSION = 1;
+
+	struct CacheHeader
+	{
+		std::uint32_t m_Magic;
+		std::uint32_t m_Version;
+		std::uint64_t m_Key;
+		std::int32_t m_Width;
+		std::int32_t m_Height;
+		std::int32_t m_PackIdMouseCursor;
+		std::int32_t m_PackIdLines;
+		std::uint32_t m_RectCount;
+		std::uint32_t m_FontCount;
+	};
+
+	struct CacheRect
+	{
+		std::uint16_t m_Width, m_Height, m_X, m_Y;
+	};
+
+	struct CacheFont
+	{
+		float m_Ascent;
+		float m_Descent;
+		std::uint32_t m_GlyphCount;
+	};
+
+	struct CacheGlyph
+	{
+		std::uint32_t m_Codepoint;
+		float m_AdvanceX;
+		float m_X0, m_Y0, m_X1, m_Y1;
+		float m_U0, m_V0, m_U1, m_V1;
+	};
+
+	// reads the cache out of the buffer the file was loaded into, every read fails once the data runs out
+	class CacheReader
+	{
+		const std::uint8_t* m_Data;
+		std::size_t m_Size;
+		std::size_t m_Offset = 0;
+
+	public:
+		CacheReader(const std::vector<std::uint8_t>& data) :
+		    m_Data(data.data()),
+		    m_Size(data.size())
+		{
+		}
+
+		template<typename T>
+		bool Read(T& value)
+		{
+			return Read(&value, sizeof(T));
+		}
+
+		std::size_t GetRemaining() const
+		{
+			return m_Size - m_Offset;
+		}
+
+		bool Read(void* out, std::size_t size)
+		{
+			if (GetRemaining() < size)
+				return false;
+
+			std::memcpy(out, m_Data + m_Offset, size);
+			m_Offset += size;
+			return true;
+		}
+	};
+
+	// fnv-1a
+	static std::uint64_t HashBytes(std::uint64_t hash, const void* data, std::size_t size)
+	{
+		auto bytes = static_cast<const std::uint8_t*>(data);
+		for (std::size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001B3ULL;
+		}
+		return hash;
+	}
+
+	template<typename T>
+	static std::uint64_t HashValue(std::uint64_t hash, const T& value)
+	{
+		return HashBytes(hash, &value, sizeof(T));
+	}
+
+	std::uint64_t FontCache::GetKey(ImFontAtlas& atlas)
+	{
+		std::uint64_t hash = 0xCBF29CE484222325ULL;
+		hash = HashValue(hash, IMGUI_VERSION_NUM);
+		hash = HashValue(hash, atlas.Flags);
+		hash = HashValue(hash, atlas.TexDesiredWidth);
+		hash = HashValue(hash, atlas.TexGlyphPadding);
+		hash = HashValue(hash, atlas.Fonts.Size);
+
+		for (const auto& cfg : atlas.ConfigData)
+		{
+			hash = HashBytes(hash, cfg.FontData, cfg.FontDataSize);
+			hash = HashValue(hash, cfg.FontNo);
+			hash = HashValue(hash, cfg.SizePixels);
+			hash = HashValue(hash, cfg.OversampleH);
+			hash = HashValue(hash, cfg.OversampleV);
+			hash = HashValue(hash, cfg.PixelSnapH);
+			hash = HashValue(hash, cfg.GlyphExtraSpacing);
+			hash = HashValue(hash, cfg.GlyphOffset);
+			hash = HashValue(hash, cfg.GlyphMinAdvanceX);
+			hash = HashValue(hash, cfg.GlyphMaxAdvanceX);
+			hash = HashValue(hash, cfg.MergeMode);
+			hash = HashValue(hash, cfg.FontBuilderFlags);
+			hash = HashValue(hash, cfg.RasterizerMultiply);
+			hash = HashValue(hash, cfg.EllipsisChar);
+			hash = HashValue(hash, atlas.Fonts.index_from_ptr(atlas.Fonts.find(cfg.DstFont)));
+
+			auto ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas.GetGlyphRangesDefault();
+			for (; *ranges; ranges++)
+				hash = HashValue(hash, *ranges);
+		}
+
+		return hash;
+	}
+
+	bool FontCache::Load(ImFontAtlas& atlas, const std::filesystem::path& file, std::uint64_t key)
+	{
+		std::ifstream stream(file, std::ios_base::binary | std::ios_base::ate);
+		if (!stream)
+			return false;
+
+		// the whole file in one read
+		std::vector<std::uint8_t> data(static_cast<std::size_t>(stream.tellg()));
+		stream.seekg(0);
+		if (!stream.read(reinterpret_cast<char*>(data.data()), data.size()))
+			return false;
+
+		CacheReader reader(data);
+		CacheHeader header;
+		if (!reader.Read(header) || header.m_Magic != MAGIC || header.m_Version != VERSION || header.m_Key != key)
+			return false;
+
+		if (header.m_FontCount != static_cast<std::uint32_t>(atlas.Fonts.Size) || header.m_Width <= 0 || header.m_Height <= 0 || header.m_RectCount > reader.GetRemaining() / sizeof(CacheRect))
+			return false;
+
+		std::vector<CacheRect> rects(header.m_RectCount);
+		std::vector<CacheFont> fonts(header.m_FontCount);
+		std::vector<std::vector<CacheGlyph>> glyphs(header.m_FontCount);
+
+		if (!reader.Read(rects.data(), rects.size() * sizeof(CacheRect)))
+			return false;
+
+		for (std::uint32_t i = 0; i < header.m_FontCount; i++)
+		{
+			if (!reader.Read(fonts[i]) || fonts[i].m_GlyphCount > reader.GetRemaining() / sizeof(CacheGlyph))
+				return false;
+
+			glyphs[i].resize(fonts[i].m_GlyphCount);
+			if (!reader.Read(glyphs[i].data(), glyphs[i].size() * sizeof(CacheGlyph)))
+				return false;
+		}
+
+		auto pixelCount = static_cast<std::size_t>(header.m_Width) * header.m_Height;
+		if (pixelCount != reader.GetRemaining())
+			return false;
+
+		auto pixels = static_cast<unsigned char*>(IM_ALLOC(pixelCount));
+		reader.Read(pixels, pixelCount);
+
+		// everything checked out, this is what ImFontAtlas::Build would have left behind
+		atlas.ClearTexData();
+		atlas.TexPixelsAlpha8 = pixels;
+		atlas.TexWidth        = header.m_Width;
+		atlas.TexHeight       = header.m_Height;
+		atlas.TexUvScale      = ImVec2(1.0f / atlas.TexWidth, 1.0f / atlas.TexHeight);
+
+		atlas.CustomRects.resize(static_cast<int>(rects.size()));
+		for (std::size_t i = 0; i < rects.size(); i++)
+		{
+			auto& rect  = atlas.CustomRects[static_cast<int>(i)];
+			rect        = ImFontAtlasCustomRect();
+			rect.Width  = rects[i].m_Width;
+			rect.Height = rects[i].m_Height;
+			rect.X      = rects[i].m_X;
+			rect.Y      = rects[i].m_Y;
+		}
+		atlas.PackIdMouseCursor = header.m_PackIdMouseCursor;
+		atlas.PackIdLines       = header.m_PackIdLines;
+
+		for (auto& cfg : atlas.ConfigData)
+		{
+			auto& font = fonts[atlas.Fonts.index_from_ptr(atlas.Fonts.find(cfg.DstFont))];
+			ImFontAtlasBuildSetupFont(&atlas, cfg.DstFont, &cfg, font.m_Ascent, font.m_Descent);
+		}
+
+		for (int i = 0; i < atlas.Fonts.Size; i++)
+		{
+			// the cached glyphs already have the config applied
+			for (auto& glyph : glyphs[i])
+				atlas.Fonts[i]->AddGlyph(nullptr, static_cast<ImWchar>(glyph.m_Codepoint), glyph.m_X0, glyph.m_Y0, glyph.m_X1, glyph.m_Y1, glyph.m_U0, glyph.m_V0, glyph.m_U1, glyph.m_V1, glyph.m_AdvanceX);
+		}
+
+		// draws the cursors and lines into the texture again and builds the lookup tables
+		ImFontAtlasBuildFinish(&atlas);
+		return true;
+	}
+
+	void FontCache::Save(ImFontAtlas& atlas, const std::filesystem::path& file, std::uint64_t key)
+	{
+		unsigned char* pixels;
+		int width, height;
+		atlas.GetTexDataAsAlpha8(&pixels, &width, &height);
+		if (!pixels)
+			return;
+
+		// glyphs that point at custom rects are added again by ImFontAtlasBuildFinish, don't cache those
+		for (const auto& rect : atlas.CustomRects)
+			if (rect.Font)
+				return;
+
+		CacheHeader header{MAGIC, VERSION, key, width, height, atlas.PackIdMouseCursor, atlas.PackIdLines, static_cast<std::uint32_t>(atlas.CustomRects.Size), static_cast<std::uint32_t>(atlas.Fonts.Size)};
+
+		std::ofstream stream(file, std::ios_base::binary | std::ios_base::trunc);
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		for (const auto& rect : atlas.CustomRects)
+		{
+			CacheRect cached{rect.Width, rect.Height, rect.X, rect.Y};
+			stream.write(reinterpret_cast<const char*>(&cached), sizeof(cached));
+		}
+
+		for (auto font : atlas.Fonts)
+		{
+			CacheFont cached{font->Ascent, font->Descent, static_cast<std::uint32_t>(font->Glyphs.Size)};
+			stream.write(reinterpret_cast<const char*>(&cached), sizeof(cached));
+
+			for (const auto& glyph : font->Glyphs)
+			{
+				CacheGlyph cachedGlyph{glyph.Codepoint, glyph.AdvanceX, glyph.X0, glyph.Y0, glyph.X1, glyph.Y1, glyph.U0, glyph.V0, glyph.U1, glyph.V1};
+				stream.write(reinterpret_cast<const char*>(&cachedGlyph), sizeof(cachedGlyph));
+			}
+		}
+
+		stream.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(width) * height);
+	}
+
+	void FontCache::Build(ImFontAtlas& atlas, const std::filesystem::path& file)
+	{
+		auto key = GetKey(atlas);
+		if (Load(atlas, file, key))
+			return;
+
+		LOG(INFO) << "Font cache is missing or outdated, rasterizing the fonts";
+		atlas.Build();
+		Save(atlas, file, key);
+	}
+}
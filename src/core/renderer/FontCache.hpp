@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+
+struct ImFontAtlas;
+
+namespace YimMenu
+{
+	// Rasterizing the fonts is most of the work of building the atlas. The finished texture and the glyph tables are
+	// written to a file, and the next time the same fonts are added at the same sizes they're read back instead. The file
+	// is keyed by a hash of the font data, every font config and the ImGui version, anything else just rebuilds it
+	class FontCache
+	{
+	public:
+		// builds the atlas from its font configs, using and updating the cache file
+		static void Build(ImFontAtlas& atlas, const std::filesystem::path& file);
+
+	private:
+		static std::uint64_t GetKey(ImFontAtlas& atlas);
+		static bool Load(ImFontAtlas& atlas, const std::filesystem::path& file, std::uint64_t key);
+		static void Save(ImFontAtlas& atlas, const std::filesystem::path& file, std::uint64_t key);
+	};
+}
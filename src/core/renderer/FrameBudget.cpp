@@ -0,0 +1,72 @@
+#include "FrameBudget.hpp"
+
+#include <algorithm>
+
+namespace YimMenu
+{
+	void FrameTiming::Add(float microseconds, bool newWindow)
+	{
+		constexpr float smoothing = 1.f / 30.f;
+
+		m_Last    = microseconds;
+		m_Average = m_Average == 0.f ? microseconds : m_Average + (microseconds - m_Average) * smoothing;
+
+		if (newWindow)
+		{
+			m_Peak       = m_WindowPeak;
+			m_WindowPeak = 0.f;
+		}
+		m_WindowPeak = std::max(m_WindowPeak, microseconds);
+	}
+
+	void FrameBudget::SetBudget(std::chrono::microseconds budget, std::uint32_t targetFrameRate)
+	{
+		m_Budget   = budget;
+		m_Deadline = std::chrono::microseconds(targetFrameRate ? 1'000'000 / targetFrameRate : 0);
+	}
+
+	void FrameBudget::BeginFrame(Clock::time_point now)
+	{
+		m_NewWindow = now - m_WindowStart >= std::chrono::seconds(1);
+		if (m_NewWindow)
+			m_WindowStart = now;
+
+		// the first frame has nothing to measure against
+		if (m_FrameCount != 0)
+			m_Interval.Add(ToMicroseconds(now - m_FrameStart), m_NewWindow);
+
+		m_FrameStart = now;
+		m_FrameWait  = 0.f;
+		m_Refresh    = !m_Degraded || m_FrameCount % DEGRADED_REFRESH_INTERVAL == 0;
+		m_FrameCount++;
+	}
+
+	void FrameBudget::EndFrame(Clock::time_point now)
+	{
+		auto total = ToMicroseconds(now - m_FrameStart);
+		m_Total.Add(total, m_NewWindow);
+		m_Wait.Add(m_FrameWait, m_NewWindow);
+		m_Work.Add(std::max(total - m_FrameWait, 0.f), m_NewWindow);
+
+		auto budget   = static_cast<float>(m_Budget.count());
+		auto deadline = static_cast<float>(m_Deadline.count());
+		auto late     = deadline > 0.f && m_Interval.m_Average > deadline * LATE_FACTOR;
+
+		if (m_Work.m_Average > budget || late)
+		{
+			m_Degraded       = true;
+			m_FramesInBudget = 0;
+		}
+		else if (m_Degraded)
+		{
+			// the degraded frames are cheaper, so only go back once there's room for the full ones
+			if (m_Work.m_Average < budget * RECOVERY_FACTOR)
+				m_Degraded = ++m_FramesInBudget < RECOVERY_FRAMES;
+			else
+				m_FramesInBudget = 0;
+		}
+
+		if (m_Degraded)
+			m_DegradedCount++;
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+namespace YimMenu
+{
+	// cpu time of one piece of render work, in microseconds
+	struct FrameTiming
+	{
+		float m_Last       = 0.f;
+		float m_Average    = 0.f; // smoothed over roughly the last 30 frames
+		float m_Peak       = 0.f; // highest in the previous one second window
+		float m_WindowPeak = 0.f;
+
+		void Add(float microseconds, bool newWindow);
+	};
+
+	// Keeps the menu's share of the game's Present in check. Every frame is compared with a budget, and while the menu is
+	// over it, or the game's frames are late for the target frame rate if one is set, the work that registered as degradable only does its full update every few
+	// frames and draws what it computed last time in between
+	class FrameBudget
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr std::uint32_t DEGRADED_REFRESH_INTERVAL = 4;    // refresh every 4th frame while degraded
+		static constexpr std::uint32_t RECOVERY_FRAMES           = 60;   // frames in budget before going back to normal
+		static constexpr float LATE_FACTOR                       = 1.1f; // a frame this far past the deadline is late
+		static constexpr float RECOVERY_FACTOR                   = 0.8f; // share of the budget to be under to recover
+
+	private:
+		std::chrono::microseconds m_Budget{2000};
+		std::chrono::microseconds m_Deadline{0}; // zero when the game's frame rate isn't checked
+
+		Clock::time_point m_FrameStart{};
+		Clock::time_point m_WindowStart{};
+		bool m_NewWindow = false;
+		float m_FrameWait = 0.f;
+
+		std::uint64_t m_FrameCount     = 0;
+		std::uint64_t m_DegradedCount  = 0;
+		std::uint32_t m_FramesInBudget = 0;
+		bool m_Degraded                = false;
+		bool m_Refresh                 = true;
+
+		FrameTiming m_Interval; // from one Present to the next, the game's frame time
+		FrameTiming m_Work;     // callbacks and building the draw data, what the budget applies to
+		FrameTiming m_Wait;     // blocked on the gpu finishing an earlier frame
+		FrameTiming m_Total;    // everything the menu added to Present
+
+	public:
+		static float ToMicroseconds(Clock::duration duration)
+		{
+			return std::chrono::duration<float, std::micro>(duration).count();
+		}
+
+		void SetBudget(std::chrono::microseconds budget, std::uint32_t targetFrameRate);
+
+		void BeginFrame(Clock::time_point now);
+		void EndFrame(Clock::time_point now);
+
+		template<typename F>
+		void Measure(FrameTiming& timing, F&& f)
+		{
+			auto start = Clock::now();
+			f();
+			timing.Add(ToMicroseconds(Clock::now() - start), m_NewWindow);
+		}
+
+		// time spent waiting isn't work the menu can cut down, so it's kept out of the budget
+		template<typename F>
+		void MeasureWait(F&& f)
+		{
+			auto start = Clock::now();
+			f();
+			m_FrameWait += ToMicroseconds(Clock::now() - start);
+		}
+
+		// false on the frames degradable work should skip its update and draw what it has
+		bool IsRefreshFrame() const
+		{
+			return m_Refresh;
+		}
+
+		bool IsDegraded() const
+		{
+			return m_Degraded;
+		}
+
+		std::chrono::microseconds GetBudget() const
+		{
+			return m_Budget;
+		}
+
+		std::chrono::microseconds GetDeadline() const
+		{
+			return m_Deadline;
+		}
+
+		std::uint64_t GetFrameCount() const
+		{
+			return m_FrameCount;
+		}
+
+		std::uint64_t GetDegradedCount() const
+		{
+			return m_DegradedCount;
+		}
+
+		const FrameTiming& GetInterval() const
+		{
+			return m_Interval;
+		}
+
+		const FrameTiming& GetWork() const
+		{
+			return m_Work;
+		}
+
+		const FrameTiming& GetWait() const
+		{
+			return m_Wait;
+		}
+
+		const FrameTiming& GetTotal() const
+		{
+			return m_Total;
+		}
+	};
+}
@@ -1,6 +1,7 @@
 #define IMGUI_DEFINE_MATH_OPERATORS
 #include "Renderer.hpp"
 
+#include "core/commands/IntCommand.hpp"
 #include "core/memory/ModuleMgr.hpp"
 #include "core/memory/PatternScanner.hpp"
 #include "game/frontend/GUI.hpp"
@@ -12,6 +13,12 @@
 #include <imgui.h>
 
 
+namespace YimMenu::Features
+{
+	IntCommand _FrameBudget("framebudget", "Frame Budget", "Microseconds the menu may spend on a frame before degradable overlays update less often", 500, 10000, 2000);
+	IntCommand _TargetFrameRate("targetframerate", "Target Frame Rate", "Frames slower than this also make degradable overlays update less often. 0 only looks at the menu's own work", 0, 240, 0);
+}
+
 namespace YimMenu
 {
 	Renderer::Renderer()
@@ -596,6 +603,8 @@ namespace YimMenu
 			ImGui_ImplWin32_Init(*Pointers.Hwnd);
 		}
 
+		m_FrameBudget.BeginFrame(FrameBudget::Clock::now());
+
 		VkQueue GraphicQueue            = VK_NULL_HANDLE;
 		const bool QueueSupportsGraphic = DoesQueueSupportGraphic(queue, &GraphicQueue);
 
@@ -610,9 +619,14 @@ namespace YimMenu
 			ImGui_ImplVulkanH_Frame* fd            = &m_VkFrames[pPresentInfo->pImageIndices[i]];
 			ImGui_ImplVulkanH_FrameSemaphores* fsd = &m_VkFrameSemaphores[pPresentInfo->pImageIndices[i]];
 			{
-				if (const VkResult result = vkWaitForFences(m_VkDevice, 1, &fd->Fence, VK_TRUE, ~0ull); result != VK_SUCCESS)
+				VkResult waitResult;
+				m_FrameBudget.MeasureWait([&] {
+					waitResult = vkWaitForFences(m_VkDevice, 1, &fd->Fence, VK_TRUE, ~0ull);
+				});
+
+				if (waitResult != VK_SUCCESS)
 				{
-					LOG(WARNING) << "vkWaitForFences failed with result: [" << result << "]";
+					LOG(WARNING) << "vkWaitForFences failed with result: [" << waitResult << "]";
 					return;
 				}
 
@@ -682,8 +696,7 @@ namespace YimMenu
 			ImGui_ImplWin32_NewFrame();
 			ImGui::NewFrame();
 
-			for (const auto& callback : m_RendererCallBacks | std::views::values)
-				callback();
+			DrawCallBacks();
 
 			ImGui::Render();
 
@@ -754,6 +767,8 @@ namespace YimMenu
 				}
 			}
 		}
+
+		m_FrameBudget.EndFrame(FrameBudget::Clock::now());
 	}
 
 
@@ -802,9 +817,9 @@ namespace YimMenu
 		return false;
 	}
 
-	bool Renderer::AddRendererCallBackImpl(RendererCallBack&& callback, std::uint32_t priority)
+	bool Renderer::AddRendererCallBackImpl(RendererCallBack&& callback, std::uint32_t priority, std::string_view name, bool degradable)
 	{
-		return m_RendererCallBacks.insert({priority, callback}).second;
+		return m_RendererCallBacks.insert({priority, {std::move(callback), std::string(name), degradable}}).second;
 	}
 
 	void Renderer::AddWindowProcedureCallbackImpl(WindowProcedureCallback&& callback)
@@ -814,10 +829,19 @@ namespace YimMenu
 
 	void Renderer::DX12OnPresentImpl()
 	{
+		m_FrameBudget.BeginFrame(FrameBudget::Clock::now());
 		Renderer::DX12NewFrame();
-		for (const auto& callback : m_RendererCallBacks | std::views::values)
-			callback();
+		DrawCallBacks();
 		Renderer::DX12EndFrame();
+		m_FrameBudget.EndFrame(FrameBudget::Clock::now());
+	}
+
+	void Renderer::DrawCallBacks()
+	{
+		m_FrameBudget.SetBudget(std::chrono::microseconds(Features::_FrameBudget.GetState()), Features::_TargetFrameRate.GetState());
+
+		for (auto& callback : m_RendererCallBacks | std::views::values)
+			m_FrameBudget.Measure(callback.m_Timing, callback.m_Callback);
 	}
 
 	LRESULT Renderer::WndProcImpl(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam)
@@ -914,7 +938,9 @@ namespace YimMenu
 
 	void Renderer::DX12EndFrame()
 	{
-		WaitForNextFrame();
+		GetInstance().m_FrameBudget.MeasureWait([] {
+			WaitForNextFrame();
+		});
 
 		FrameContext& CurrentFrameContext{GetInstance().m_FrameContext[GetInstance().m_SwapChain->GetCurrentBackBufferIndex()]};
 		CurrentFrameContext.CommandAllocator->Reset();
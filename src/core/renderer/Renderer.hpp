@@ -1,4 +1,5 @@
 #pragma once
+#include "FrameBudget.hpp"
 #include "util/Joaat.hpp"
 
 #include <backends/imgui_impl_vulkan.h>
@@ -25,6 +26,14 @@ namespace YimMenu
 	using RendererCallBack        = std::function<void()>;
 	using WindowProcedureCallback = std::function<void(HWND, UINT, WPARAM, LPARAM)>;
 
+	struct RendererCallBackEntry
+	{
+		RendererCallBack m_Callback;
+		std::string m_Name;
+		bool m_Degradable;
+		FrameTiming m_Timing;
+	};
+
 	struct FrameContext
 	{
 		ID3D12CommandAllocator* CommandAllocator;
@@ -60,12 +69,32 @@ namespace YimMenu
 		 * 
 		 * @param callback Callback function
 		 * @param priority Low values will be drawn before higher values.
+		 * @param name Shown with the callback's timings in the debug menu.
+		 * @param degradable The callback can skip its update and draw what it has on the frames IsRefreshFrame returns false.
 		 * @return true Successfully added callback.
 		 * @return false Duplicate render priority was given.
 		 */
-		static bool AddRendererCallBack(RendererCallBack&& callback, std::uint32_t priority)
+		static bool AddRendererCallBack(RendererCallBack&& callback, std::uint32_t priority, std::string_view name = "", bool degradable = false)
+		{
+			return GetInstance().AddRendererCallBackImpl(std::move(callback), priority, name, degradable);
+		}
+
+		/**
+		 * @brief Whether degradable callbacks should do their full update this frame. Always true while the menu is within its frame budget.
+		 */
+		static bool IsRefreshFrame()
+		{
+			return GetInstance().m_FrameBudget.IsRefreshFrame();
+		}
+
+		static const FrameBudget& GetFrameBudget()
+		{
+			return GetInstance().m_FrameBudget;
+		}
+
+		static const std::map<joaat_t, RendererCallBackEntry>& GetRendererCallBacks()
 		{
-			return GetInstance().AddRendererCallBackImpl(std::move(callback), priority);
+			return GetInstance().m_RendererCallBacks;
 		}
 		/**
 		 * @brief Add a callback function to handle Windows WindowProcedure
@@ -160,11 +189,12 @@ namespace YimMenu
 
 		void VkCreateRenderTarget(VkDevice Device, VkSwapchainKHR Swapchain);
 
-		bool AddRendererCallBackImpl(RendererCallBack&& callback, std::uint32_t priority);
+		bool AddRendererCallBackImpl(RendererCallBack&& callback, std::uint32_t priority, std::string_view name, bool degradable);
 		void AddWindowProcedureCallbackImpl(WindowProcedureCallback&& callback);
 
 		void DX12OnPresentImpl();
 		void VkOnPresentImpl(VkQueue queue, const VkPresentInfoKHR* pPresentInfo);
+		void DrawCallBacks();
 
 		bool DoesQueueSupportGraphic(VkQueue queue, VkQueue* pGraphicQueue);
 
@@ -220,8 +250,9 @@ namespace YimMenu
 
 	private:
 		//Other
-		std::map<joaat_t, RendererCallBack> m_RendererCallBacks;
+		std::map<joaat_t, RendererCallBackEntry> m_RendererCallBacks;
 		std::vector<WindowProcedureCallback> m_WindowProcedureCallbacks;
+		FrameBudget m_FrameBudget;
 	};
 }
 
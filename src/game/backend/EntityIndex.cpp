@@ -0,0 +1,172 @@
+#include "EntityIndex.hpp"
+
+#include "game/backend/Players.hpp"
+#include "game/backend/Self.hpp"
+#include "game/rdr/Natives.hpp"
+#include "game/rdr/Pools.hpp"
+
+namespace YimMenu
+{
+	void EntityIndex::Build(Bucket& bucket)
+	{
+		bucket.m_Items.clear();
+		bucket.m_Positions.clear();
+
+		auto add = [&bucket](Entity entity, Type type) {
+			// also weeds out pointers that match known crash signatures
+			if (!entity.GetHandle())
+				return;
+
+			auto position = entity.GetPosition();
+			bucket.m_Items.push_back({entity, position, type});
+			bucket.m_Positions.push_back(position);
+		};
+
+		if (bucket.m_Types & (PED | PLAYER_PED))
+		{
+			// lets player peds be told apart without a native call for every ped in the pool
+			std::array<void*, 33> playerPeds{};
+			std::size_t numPlayerPeds = 0;
+			if (auto self = Self::GetPed().GetPointer<void*>())
+				playerPeds[numPlayerPeds++] = self;
+			for (auto& [id, player] : Players::GetPlayers())
+			{
+				if (numPlayerPeds == playerPeds.size() || !player.IsValid())
+					continue;
+
+				if (auto ped = player.GetPed().GetPointer<void*>())
+					playerPeds[numPlayerPeds++] = ped;
+			}
+
+			if (auto pool = GetPedPool())
+			{
+				for (Entity ped : PoolUtils<Entity>(pool))
+				{
+					auto isPlayer = std::find(playerPeds.begin(), playerPeds.begin() + numPlayerPeds, ped.GetPointer<void*>()) != playerPeds.begin() + numPlayerPeds;
+					add(ped, isPlayer ? PLAYER_PED : PED);
+				}
+			}
+		}
+		else if (bucket.m_Types & VEHICLE)
+		{
+			if (auto pool = GetVehiclePool())
+				for (Entity vehicle : PoolUtils<Entity>(pool))
+					add(vehicle, VEHICLE);
+		}
+		else if (auto pool = GetObjectPool())
+		{
+			for (Entity object : PoolUtils<Entity>(pool))
+				add(object, OBJECT);
+		}
+
+		bucket.m_Grid.Build(bucket.m_Positions);
+	}
+
+	void EntityIndex::EnsureBuilt(std::uint8_t types)
+	{
+		auto frame = MISC::GET_FRAME_COUNT();
+		for (auto& bucket : m_Buckets)
+		{
+			if (!(bucket.m_Types & types) || bucket.m_BuiltFrame == frame)
+				continue;
+
+			bucket.m_BuiltFrame = frame;
+			Build(bucket);
+		}
+	}
+
+	void EntityIndex::InvalidateImpl()
+	{
+		for (auto& bucket : m_Buckets)
+			bucket.m_BuiltFrame = -1;
+	}
+
+	void EntityIndex::GetAllImpl(std::uint8_t types, std::vector<Item>& out)
+	{
+		EnsureBuilt(types);
+
+		out.clear();
+		for (auto& bucket : m_Buckets)
+		{
+			if (!(bucket.m_Types & types))
+				continue;
+
+			for (auto& item : bucket.m_Items)
+				if (item.m_Type & types)
+					out.push_back(item);
+		}
+	}
+
+	void EntityIndex::QueryRadiusImpl(const rage::fvector3& center, float radius, std::uint8_t types, std::vector<Item>& out)
+	{
+		EnsureBuilt(types);
+
+		out.clear();
+		for (auto& bucket : m_Buckets)
+		{
+			if (!(bucket.m_Types & types))
+				continue;
+
+			bucket.m_Grid.ForEachInRadius(center, radius, [&](std::uint32_t idx, float) {
+				if (bucket.m_Items[idx].m_Type & types)
+					out.push_back(bucket.m_Items[idx]);
+			});
+		}
+	}
+
+	void EntityIndex::QueryNearestImpl(const rage::fvector3& center, std::size_t count, std::uint8_t types, std::vector<Item>& out)
+	{
+		EnsureBuilt(types);
+
+		// the closest of each pool, then the closest of those
+		thread_local std::vector<std::pair<float, std::uint32_t>> found;
+		thread_local std::vector<std::pair<float, const Item*>> nearest;
+		nearest.clear();
+		for (auto& bucket : m_Buckets)
+		{
+			if (!(bucket.m_Types & types))
+				continue;
+
+			bucket.m_Grid.FindNearest(center, count, [&](std::uint32_t idx) {
+				return (bucket.m_Items[idx].m_Type & types) != 0;
+			}, found);
+
+			for (auto& [distSq, idx] : found)
+				nearest.emplace_back(distSq, &bucket.m_Items[idx]);
+		}
+
+		auto n = std::min(count, nearest.size());
+		std::partial_sort(nearest.begin(), nearest.begin() + n, nearest.end(), [](auto& a, auto& b) {
+			return a.first < b.first;
+		});
+
+		out.clear();
+		for (std::size_t i = 0; i < n; i++)
+			out.push_back(*nearest[i].second);
+	}
+
+	void EntityIndex::QueryRayImpl(const rage::fvector3& origin, const rage::fvector3& direction, float length, float radius, std::uint8_t types, std::vector<Item>& out)
+	{
+		EnsureBuilt(types);
+
+		thread_local std::vector<std::pair<float, const Item*>> hits;
+		hits.clear();
+		for (auto& bucket : m_Buckets)
+		{
+			if (!(bucket.m_Types & types))
+				continue;
+
+			bucket.m_Grid.ForEachNearRay(origin, direction, length, radius, [&](std::uint32_t idx, float t) {
+				if (bucket.m_Items[idx].m_Type & types)
+					hits.emplace_back(t, &bucket.m_Items[idx]);
+			});
+		}
+		std::sort(hits.begin(), hits.end(), [](auto& a, auto& b) {
+			return a.first < b.first;
+		});
+
+		out.clear();
+		for (auto& [t, item] : hits)
+			out.push_back(*item);
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "core/misc/SpatialGrid.hpp"
+#include "game/rdr/Entity.hpp"
+
+namespace YimMenu
+{
+	// Spatial index of the ped, vehicle and object pools. Each pool is indexed at most once per game frame, on the
+	// first query of that frame that asks for its types, so every feature that looks for entities shares one pass over
+	// the pools it needs and pools nobody asked for aren't walked. Game thread only
+	class EntityIndex
+	{
+	public:
+		enum Type : std::uint8_t
+		{
+			PED        = 1 << 0, // peds that aren't players
+			PLAYER_PED = 1 << 1,
+			VEHICLE    = 1 << 2,
+			OBJECT     = 1 << 3,
+			ALL        = PED | PLAYER_PED | VEHICLE | OBJECT,
+		};
+
+		struct Item
+		{
+			Entity m_Entity;
+			rage::fvector3 m_Position;
+			Type m_Type;
+		};
+
+	private:
+		// the entities of one pool
+		struct Bucket
+		{
+			std::vector<Item> m_Items;
+			std::vector<rage::fvector3> m_Positions;
+			SpatialGrid m_Grid{};
+			int m_BuiltFrame = -1;
+			std::uint8_t m_Types; // the types this pool holds
+		};
+
+		std::array<Bucket, 3> m_Buckets{Bucket{.m_Types = PED | PLAYER_PED}, Bucket{.m_Types = VEHICLE}, Bucket{.m_Types = OBJECT}};
+
+		EntityIndex() = default;
+
+		void Build(Bucket& bucket);
+		void EnsureBuilt(std::uint8_t types);
+		void InvalidateImpl();
+		void GetAllImpl(std::uint8_t types, std::vector<Item>& out);
+		void QueryRadiusImpl(const rage::fvector3& center, float radius, std::uint8_t types, std::vector<Item>& out);
+		void QueryNearestImpl(const rage::fvector3& center, std::size_t count, std::uint8_t types, std::vector<Item>& out);
+		void QueryRayImpl(const rage::fvector3& origin, const rage::fvector3& direction, float length, float radius, std::uint8_t types, std::vector<Item>& out);
+
+		static EntityIndex& GetInstance()
+		{
+			static EntityIndex Instance;
+			return Instance;
+		}
+
+	public:
+		// the queries replace the contents of out, so a caller that keeps its vector around doesn't allocate
+
+		// every entity of the given types
+		static void GetAll(std::uint8_t types, std::vector<Item>& out)
+		{
+			GetInstance().GetAllImpl(types, out);
+		}
+
+		// entities within radius of center
+		static void QueryRadius(const rage::fvector3& center, float radius, std::uint8_t types, std::vector<Item>& out)
+		{
+			GetInstance().QueryRadiusImpl(center, radius, types, out);
+		}
+
+		// up to count entities closest to center, nearest first
+		static void QueryNearest(const rage::fvector3& center, std::size_t count, std::uint8_t types, std::vector<Item>& out)
+		{
+			GetInstance().QueryNearestImpl(center, count, types, out);
+		}
+
+		// entities within radius of the segment from origin to origin + direction * length, ordered along the ray.
+		// direction must be normalized
+		static void QueryRay(const rage::fvector3& origin, const rage::fvector3& direction, float length, float radius, std::uint8_t types, std::vector<Item>& out)
+		{
+			GetInstance().QueryRayImpl(origin, direction, length, radius, types, out);
+		}
+
+		// call after deleting or moving entities, the next query rebuilds the index instead of returning what was there
+		// earlier in the frame
+		static void Invalidate()
+		{
+			GetInstance().InvalidateImpl();
+		}
+	};
+}
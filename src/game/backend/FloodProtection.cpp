@@ -0,0 +1,44 @@
+#include "FloodProtection.hpp"
+
+namespace YimMenu
+{
+	FloodProtection::FloodProtection()
+	{
+		// generous enough that legitimate bursts (combat, speech) never get close
+		m_Configs[static_cast<std::size_t>(FloodDomain::NET_EVENT)].fill(RateLimiter::Config(1s, 100));
+		m_Configs[static_cast<std::size_t>(FloodDomain::SCRIPT_EVENT)].fill(RateLimiter::Config(1s, 30));
+
+		// most messages are part of the sync/session machinery, and are far too frequent to be worth limiting
+		m_Configs[static_cast<std::size_t>(FloodDomain::NET_MESSAGE)].fill(RateLimiter::Config::Unlimited());
+
+		SetLimitImpl(FloodDomain::NET_EVENT, static_cast<std::uint32_t>(NetEventType::EXPLOSION_EVENT), RateLimiter::Config(1s, 20));
+		SetLimitImpl(FloodDomain::NET_EVENT, static_cast<std::uint32_t>(NetEventType::FIRE_EVENT), RateLimiter::Config(1s, 20));
+		SetLimitImpl(FloodDomain::NET_EVENT, static_cast<std::uint32_t>(NetEventType::NETWORK_PTFX_EVENT), RateLimiter::Config(1s, 20));
+		SetLimitImpl(FloodDomain::NET_EVENT, static_cast<std::uint32_t>(NetEventType::SCRIPT_COMMAND_EVENT), RateLimiter::Config(1s, 10));
+		SetLimitImpl(FloodDomain::NET_EVENT, static_cast<std::uint32_t>(NetEventType::NETWORK_CLEAR_PED_TASKS_EVENT), RateLimiter::Config(1s, 10));
+
+		SetLimitImpl(FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(NetMessageType::TEXT_CHAT), RateLimiter::Config(5s, 10));
+		SetLimitImpl(FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(NetMessageType::RESET_POPULATION), RateLimiter::Config(5s, 2));
+		SetLimitImpl(FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(NetMessageType::NET_ICE_SESSION_OFFER), RateLimiter::Config(5s, 10));
+		SetLimitImpl(FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(NetMessageType::SCRIPT_HOST_REQUEST), RateLimiter::Config(1s, 20));
+		SetLimitImpl(FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(NetMessageType::SCRIPT_MIGRATE_HOST), RateLimiter::Config(1s, 20));
+	}
+
+	void FloodProtection::SetLimitImpl(FloodDomain domain, std::uint32_t type, const RateLimiter::Config& config)
+	{
+		if (domain >= FloodDomain::COUNT || type > OTHER_TYPES)
+			return;
+
+		m_Configs[static_cast<std::size_t>(domain)][type] = config;
+	}
+
+	void FloodProtection::ResetPlayerImpl(int player)
+	{
+		if (player < 0 || player >= static_cast<int>(MAX_PLAYERS))
+			return;
+
+		for (auto& domain : m_Shards[player].m_Cells)
+			for (auto& cell : domain)
+				cell.Reset();
+	}
+}
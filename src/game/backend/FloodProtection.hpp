@@ -0,0 +1,85 @@
+#pragma once
+#include "core/misc/RateLimiter.hpp"
+#include "game/rdr/Enums.hpp"
+
+namespace YimMenu
+{
+	enum class FloodDomain : std::uint8_t
+	{
+		NET_EVENT,
+		NET_MESSAGE,
+		SCRIPT_EVENT,
+		COUNT
+	};
+
+	// per (player, domain, type) rate limits that any hook can query without taking a lock
+	class FloodProtection
+	{
+	public:
+		static constexpr std::size_t MAX_PLAYERS   = 32;
+		static constexpr std::size_t MAX_TYPES     = 256;
+		static constexpr std::uint32_t OTHER_TYPES = MAX_TYPES; // every type above the table shares this cell and limit
+
+		static RateLimitResult Process(int player, NetEventType type)
+		{
+			return GetInstance().ProcessImpl(player, FloodDomain::NET_EVENT, static_cast<std::uint32_t>(type));
+		}
+
+		static RateLimitResult Process(int player, NetMessageType type)
+		{
+			return GetInstance().ProcessImpl(player, FloodDomain::NET_MESSAGE, static_cast<std::uint32_t>(type));
+		}
+
+		static RateLimitResult Process(int player, ScriptEvent type)
+		{
+			return GetInstance().ProcessImpl(player, FloodDomain::SCRIPT_EVENT, static_cast<std::uint32_t>(type));
+		}
+
+		// not thread safe with respect to concurrent Process calls on the same type, only meant to be called on init
+		static void SetLimit(FloodDomain domain, std::uint32_t type, std::chrono::milliseconds period, std::uint32_t numAllowedAttempts)
+		{
+			GetInstance().SetLimitImpl(domain, type, RateLimiter::Config(period, numAllowedAttempts));
+		}
+
+		static void SetUnlimited(FloodDomain domain, std::uint32_t type)
+		{
+			GetInstance().SetLimitImpl(domain, type, RateLimiter::Config::Unlimited());
+		}
+
+		static void ResetPlayer(int player)
+		{
+			GetInstance().ResetPlayerImpl(player);
+		}
+
+	private:
+		// one shard per player, aligned so that players being processed on different threads don't share cache lines
+		struct alignas(64) Shard
+		{
+			std::array<std::array<RateLimiter::Cell, MAX_TYPES + 1>, static_cast<std::size_t>(FloodDomain::COUNT)> m_Cells;
+		};
+
+		std::array<std::array<RateLimiter::Config, MAX_TYPES + 1>, static_cast<std::size_t>(FloodDomain::COUNT)> m_Configs;
+		std::array<Shard, MAX_PLAYERS> m_Shards;
+
+		FloodProtection();
+
+		RateLimitResult ProcessImpl(int player, FloodDomain domain, std::uint32_t type)
+		{
+			if (player < 0 || player >= static_cast<int>(MAX_PLAYERS))
+				return RateLimitResult::ALLOWED;
+
+			type     = std::min<std::uint32_t>(type, OTHER_TYPES);
+			auto idx = static_cast<std::size_t>(domain);
+			return RateLimiter::Process(m_Shards[player].m_Cells[idx][type], m_Configs[idx][type], RateLimiter::Now());
+		}
+
+		void SetLimitImpl(FloodDomain domain, std::uint32_t type, const RateLimiter::Config& config);
+		void ResetPlayerImpl(int player);
+
+		static FloodProtection& GetInstance()
+		{
+			static FloodProtection Instance;
+			return Instance;
+		}
+	};
+}
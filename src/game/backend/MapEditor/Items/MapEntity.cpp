@@ -36,15 +36,15 @@ namespace YimMenu
 	{
 		if (m_ObjectCreationPending)
 		{
-			STREAMING::REQUEST_MODEL(m_ModelHash, false);
-			if (STREAMING::HAS_MODEL_LOADED(m_ModelHash))
+			// the model may have been changed while it was loading
+			if (!m_ModelRequest.IsFor(m_ModelHash))
+				m_ModelRequest = ModelRequest(m_ModelHash);
+
+			if (m_ModelRequest.IsLoaded() && CreateGameObjectImpl())
 			{
-				// assume the code there would take care of unloading the entity model
-				if (CreateGameObjectImpl())
-				{
-					CreateBlip();
-					m_ObjectCreationPending = false;
-				}
+				CreateBlip();
+				m_ObjectCreationPending = false;
+				m_ModelRequest.Reset();
 			}
 		}
 
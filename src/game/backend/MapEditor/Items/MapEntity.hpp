@@ -1,4 +1,5 @@
 #pragma once
+#include "game/backend/Streaming.hpp"
 #include "game/rdr/Entity.hpp"
 
 namespace YimMenu
@@ -9,6 +10,8 @@ namespace YimMenu
 		void AddToGlobalStore();
 		void RemoveFromGlobalStore();
 
+		ModelRequest m_ModelRequest; // held until the entity exists, so a map full of one model loads it once
+
 		// blip funcs for creator view
 
 
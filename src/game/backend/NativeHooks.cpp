@@ -1,5 +1,6 @@
 #include "NativeHooks.hpp"
 
+#include "ScriptRegistry.hpp"
 #include "game/rdr/invoker/Invoker.hpp"
 
 #include <script/scrProgram.hpp>
@@ -16,14 +17,28 @@ namespace YimMenu
 		m_Hook->Enable();
 		m_OrigHandlers = new rage::scrNativeHandler[program->m_NativeCount];
 		memcpy(m_OrigHandlers, program->m_NativeEntrypoints, program->m_NativeCount * sizeof(rage::scrNativeHandler));
+
+		m_EntrypointIndices.reserve(program->m_NativeCount);
+		for (std::uint32_t i = 0; i < program->m_NativeCount; i++)
+			m_EntrypointIndices.emplace(m_OrigHandlers[i], i);
+	}
+
+	void NativeHooks::Program::Apply(rage::scrNativeHandler handler, rage::scrNativeHandler replacement)
+	{
+		auto it = m_EntrypointIndices.find(handler);
+		if (it == m_EntrypointIndices.end())
+			return; // the script doesn't use this native
+
+		// a native that's hooked already keeps its first replacement
+		auto& entrypoint = m_Program->m_NativeEntrypoints[it->second];
+		if (entrypoint == handler)
+			entrypoint = replacement;
 	}
 
-	void NativeHooks::Program::Apply(Hook hook)
+	void NativeHooks::Program::Apply(const HookTable& hooks)
 	{
-		auto old_native      = NativeInvoker::GetNativeHandler(hook.m_Index);
-		auto old_native_addr = m_Program->GetAddressOfNativeEntrypoint(old_native);
-		if (old_native_addr)
-			*old_native_addr = hook.m_Replacement;
+		for (auto& [handler, replacement] : hooks)
+			Apply(handler, replacement);
 	}
 
 	void NativeHooks::Program::Cleanup()
@@ -36,20 +51,21 @@ namespace YimMenu
 	void NativeHooks::Program::ScrProgram_Dtor(rage::scrProgram* _this, bool free_mem)
 	{
 		NativeHooks::UnregisterProgram(_this);
+		ScriptRegistry::UnregisterProgram(_this);
 		(**reinterpret_cast<decltype(&NativeHooks::Program::ScrProgram_Dtor)**>(_this))(_this, free_mem);
 	}
 
 	NativeHooks::NativeHooks() :
 	    m_RegisteredPrograms(),
+	    m_ProgramsByScript(),
 	    m_RegisteredHooks()
 	{
+		m_RegisteredHooks.emplace(ALL_SCRIPTS, HookTable());
 		for (int i = 0; i < 160; i++)
 		{
 			if (Pointers.ScriptPrograms[i] != nullptr)
-				RegisterProgram(Pointers.ScriptPrograms[i]);
-
+				RegisterProgramImpl(Pointers.ScriptPrograms[i]);
 		}
-		m_RegisteredHooks.emplace(ALL_SCRIPTS, std::vector<Hook>());
 	}
 
 	void NativeHooks::AddHookImpl(joaat_t script, NativeIndex index, rage::scrNativeHandler hook)
@@ -57,22 +73,19 @@ namespace YimMenu
 		if (!g_Running)
 			return;
 
-		if (auto it = m_RegisteredHooks.find(script); it != m_RegisteredHooks.end())
-		{
-			it->second.push_back(Hook(index, hook));
-		}
-		else
+		auto handler = NativeInvoker::GetNativeHandler(index);
+		if (!m_RegisteredHooks[script].try_emplace(handler, hook).second)
+			return; // hooked for this script already
+
+		if (script == ALL_SCRIPTS)
 		{
-			std::vector<Hook> hooks = {Hook(index, hook)};
-			m_RegisteredHooks.emplace(script, hooks);
+			for (auto& [_, program] : m_RegisteredPrograms)
+				program->Apply(handler, hook);
 		}
-
-		for (auto& [scp, program] : m_RegisteredPrograms)
+		else if (auto it = m_ProgramsByScript.find(script); it != m_ProgramsByScript.end())
 		{
-			if (scp->m_NameHash == script || script == ALL_SCRIPTS)
-			{
-				program->Apply(Hook(index, hook));
-			}
+			for (auto program : it->second)
+				program->Apply(handler, hook);
 		}
 	}
 
@@ -87,23 +100,14 @@ namespace YimMenu
 			return;
 		}
 
-		auto t = new Program(program);
-		m_RegisteredPrograms.emplace(program, std::move(t));
-
-		auto& pgrm = m_RegisteredPrograms[program];
+		auto& pgrm = m_RegisteredPrograms.emplace(program, std::make_unique<Program>(program)).first->second;
+		m_ProgramsByScript[program->m_NameHash].push_back(pgrm.get());
 
+		// the script's own hooks go first so they win over the ones for every script
 		if (auto it = m_RegisteredHooks.find(program->m_NameHash); it != m_RegisteredHooks.end())
-		{
-			for (auto& hook : it->second)
-			{
-				pgrm->Apply(hook);
-			}
-		}
+			pgrm->Apply(it->second);
 
-		for (auto& hook : m_RegisteredHooks.at(ALL_SCRIPTS))
-		{
-			pgrm->Apply(hook);
-		}
+		pgrm->Apply(m_RegisteredHooks.at(ALL_SCRIPTS));
 	}
 
 	void NativeHooks::UnregisterProgramImpl(rage::scrProgram* program)
@@ -111,6 +115,8 @@ namespace YimMenu
 		if (auto it = m_RegisteredPrograms.find(program); it != m_RegisteredPrograms.end())
 		{
 			it->second->Cleanup();
+			if (auto programs = m_ProgramsByScript.find(program->m_NameHash); programs != m_ProgramsByScript.end())
+				std::erase(programs->second, it->second.get());
 			m_RegisteredPrograms.erase(it);
 		}
 		else
@@ -14,27 +14,27 @@ namespace YimMenu
 {
 	class NativeHooks
 	{
-		struct Hook
-		{
-			NativeIndex m_Index;
-			rage::scrNativeHandler m_Replacement;
-		};
+		// native handler -> what the scripts call instead. a native keeps the first replacement added for it
+		using HookTable = std::unordered_map<rage::scrNativeHandler, rage::scrNativeHandler>;
 
 		class Program final
 		{
 			rage::scrProgram* m_Program = nullptr;
 			std::unique_ptr<VMTHook> m_Hook = nullptr;
 			rage::scrNativeHandler* m_OrigHandlers = nullptr;
+			std::unordered_map<rage::scrNativeHandler, std::uint32_t> m_EntrypointIndices; // built once, the table never changes
 
 		public:
 			Program(rage::scrProgram* program);
-			void Apply(Hook hook);
+			void Apply(rage::scrNativeHandler handler, rage::scrNativeHandler replacement);
+			void Apply(const HookTable& hooks);
 			void Cleanup();
 			static void ScrProgram_Dtor(rage::scrProgram* _this, bool free_mem);
 		};
 
 		std::unordered_map<rage::scrProgram*, std::unique_ptr<Program>> m_RegisteredPrograms;
-		std::unordered_map<joaat_t, std::vector<Hook>> m_RegisteredHooks;
+		std::unordered_map<joaat_t, std::vector<Program*>> m_ProgramsByScript;
+		std::unordered_map<joaat_t, HookTable> m_RegisteredHooks;
 
 	public:
 		static constexpr auto ALL_SCRIPTS = "ALL_SCRIPTS"_J;
@@ -0,0 +1,137 @@
+#include "NativeQueue.hpp"
+
+#include "ScriptMgr.hpp"
+#include "game/rdr/Scripts.hpp"
+#include "game/rdr/invoker/Invoker.hpp"
+
+namespace YimMenu
+{
+	std::uint64_t NativeQueue::PushImpl(NativeIndex index, joaat_t script, std::span<const std::uint64_t> args, bool fix_vectors, std::size_t result_size)
+	{
+		auto ticket = m_NextTicket.fetch_add(1, std::memory_order_relaxed);
+
+		auto pushed = m_Calls.Emplace([&](Call& call) {
+			call.m_Index      = index;
+			call.m_Script     = script;
+			call.m_ArgCount   = static_cast<std::uint8_t>(args.size());
+			call.m_FixVectors = fix_vectors;
+			call.m_ResultSize = static_cast<std::uint8_t>(result_size);
+			call.m_Ticket     = ticket;
+			std::copy(args.begin(), args.end(), call.m_Args);
+		});
+
+		if (!pushed)
+		{
+			m_Dropped.fetch_add(1, std::memory_order_relaxed);
+			return DROPPED;
+		}
+
+		m_Pushed.fetch_add(1, std::memory_order_relaxed);
+		return ticket;
+	}
+
+	NativeQueue::ResultState NativeQueue::ReadResult(std::uint64_t ticket, std::uint64_t* value)
+	{
+		auto& result = m_Results[ticket % CAPACITY];
+		auto done    = (ticket + 1) * 2;
+
+		if (result.m_Sequence.load(std::memory_order_acquire) != done)
+			return ResultState::PENDING;
+
+		auto ran = result.m_Ran.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < MAX_RESULT; i++)
+			value[i] = result.m_Value[i].load(std::memory_order_relaxed);
+
+		// the slot may have been reused while it was read
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (result.m_Sequence.load(std::memory_order_relaxed) != done)
+			return ResultState::PENDING;
+
+		return ran ? ResultState::DONE : ResultState::DROPPED;
+	}
+
+	void NativeQueue::WriteResult(const Call& call, const std::uint64_t* value, bool ran)
+	{
+		auto& result = m_Results[call.m_Ticket % CAPACITY];
+		result.m_Sequence.store((call.m_Ticket + 1) * 2 - 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		result.m_Ran.store(ran, std::memory_order_relaxed);
+		for (std::size_t i = 0; i < MAX_RESULT; i++)
+			result.m_Value[i].store(value[i], std::memory_order_relaxed);
+		result.m_Sequence.store((call.m_Ticket + 1) * 2, std::memory_order_release);
+	}
+
+	void NativeQueue::Execute(const Call& call)
+	{
+		std::uint64_t value[MAX_RESULT]{};
+		NativeInvoker::InvokeRaw(call.m_Index, {call.m_Args, call.m_ArgCount}, call.m_FixVectors, value, call.m_ResultSize);
+		WriteResult(call, value, true);
+
+		m_Executed.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void NativeQueue::RunBatch()
+	{
+		m_Batch.clear();
+		while (m_Calls.Consume([this](Call& call) {
+			m_Batch.push_back(call);
+		}))
+			;
+
+		if (m_Batch.empty())
+			return;
+
+		m_Batches.fetch_add(1, std::memory_order_relaxed);
+
+		// calls for the same script run in one scope, in the order they were queued
+		std::stable_sort(m_Batch.begin(), m_Batch.end(), [](const Call& a, const Call& b) {
+			return a.m_Script < b.m_Script;
+		});
+
+		for (auto begin = m_Batch.begin(); begin != m_Batch.end();)
+		{
+			auto script = begin->m_Script;
+			auto end    = std::find_if(begin, m_Batch.end(), [script](const Call& call) {
+				return call.m_Script != script;
+			});
+
+			auto run = [this, begin, end] {
+				for (auto it = begin; it != end; ++it)
+					Execute(*it);
+			};
+
+			// the menu's scripts already run as a game script
+			if (!script)
+				run();
+			else if (auto thread = Scripts::FindScriptThread(script))
+				Scripts::RunAsScript(thread, run);
+			else
+			{
+				LOG(VERBOSE) << "Dropped " << (end - begin) << " native calls for script " << HEX(script) << ", it isn't running";
+
+				const std::uint64_t none[MAX_RESULT]{};
+				for (auto it = begin; it != end; ++it)
+					WriteResult(*it, none, false);
+				m_Dropped.fetch_add(end - begin, std::memory_order_relaxed);
+			}
+
+			begin = end;
+		}
+	}
+
+	void NativeQueue::Update()
+	{
+		GetInstance().m_GameThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+		while (true)
+		{
+			GetInstance().RunBatch();
+			ScriptMgr::Yield();
+		}
+	}
+
+	NativeQueue::Stats NativeQueue::GetStats()
+	{
+		auto& queue = GetInstance();
+		return {queue.m_Pushed.load(std::memory_order_relaxed), queue.m_Executed.load(std::memory_order_relaxed), queue.m_Dropped.load(std::memory_order_relaxed), queue.m_Batches.load(std::memory_order_relaxed)};
+	}
+}
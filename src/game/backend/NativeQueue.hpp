@@ -0,0 +1,228 @@
+#pragma once
+#include "core/misc/BoundedQueue.hpp"
+#include "game/rdr/Natives.hpp"
+#include "util/Joaat.hpp"
+
+#include <cstring>
+#include <span>
+
+namespace YimMenu
+{
+	// Native calls from threads that can't call natives themselves. A call is queued as a native index and its arguments
+	// instead of a lambda, so pushing doesn't allocate, and the game thread runs everything queued since the last frame
+	// in one batch, grouped by the script it should run as. The result comes back through a NativeFuture
+	class NativeQueue
+	{
+	public:
+		static constexpr std::size_t MAX_ARGS   = 8;
+		static constexpr std::size_t MAX_RESULT = 3; // slots, enough for a vector
+		static constexpr std::size_t CAPACITY   = 1024;
+		static constexpr std::uint64_t DROPPED  = ~0ull;
+
+		struct Stats
+		{
+			std::uint64_t m_Pushed;
+			std::uint64_t m_Executed;
+			std::uint64_t m_Dropped;
+			std::uint64_t m_Batches;
+		};
+
+	private:
+		struct Call
+		{
+			NativeIndex m_Index;
+			joaat_t m_Script; // zero runs it as the script the menu runs as
+			std::uint8_t m_ArgCount;
+			bool m_FixVectors;
+			std::uint8_t m_ResultSize;
+			std::uint64_t m_Args[MAX_ARGS];
+			std::uint64_t m_Ticket; // picks the result slot
+		};
+
+		// results are kept in a ring, a slot is reused CAPACITY calls later. the sequence is even once the result of the
+		// ticket it belongs to is written, so a future can tell a finished call from one whose slot was reused
+		struct Result
+		{
+			std::atomic<std::uint64_t> m_Sequence{0};
+			std::atomic<bool> m_Ran{false}; // false if the call was dropped instead
+			std::array<std::atomic<std::uint64_t>, MAX_RESULT> m_Value{};
+		};
+
+		enum class ResultState
+		{
+			PENDING, // or its slot has been reused
+			DONE,
+			DROPPED,
+		};
+
+		BoundedQueue<Call, CAPACITY> m_Calls;
+		std::array<Result, CAPACITY> m_Results;
+		std::atomic<std::uint64_t> m_NextTicket{0};
+
+		std::atomic<std::uint64_t> m_Pushed{0};
+		std::atomic<std::uint64_t> m_Executed{0};
+		std::atomic<std::uint64_t> m_Dropped{0};
+		std::atomic<std::uint64_t> m_Batches{0};
+
+		std::vector<Call> m_Batch; // game thread only
+		std::atomic<std::thread::id> m_GameThread{};
+
+	public:
+		template<typename Ret>
+		class Future
+		{
+			using Value = std::conditional_t<std::is_void_v<Ret>, bool, Ret>; // calls without a result give true
+
+			std::uint64_t m_Ticket = DROPPED;
+
+		public:
+			Future() = default;
+			explicit Future(std::uint64_t ticket) :
+			    m_Ticket(ticket)
+			{
+			}
+
+			// false if the queue was full
+			bool IsValid() const
+			{
+				return m_Ticket != DROPPED;
+			}
+
+			// the result once the call has run. stays empty if it was dropped or if CAPACITY calls have run since
+			std::optional<Value> Get() const
+			{
+				std::uint64_t value[MAX_RESULT];
+				if (Read(value) != ResultState::DONE)
+					return std::nullopt;
+
+				return ToValue(value);
+			}
+
+			bool IsReady() const
+			{
+				return Get().has_value();
+			}
+
+			// the queue was full, or the script the call was for wasn't running
+			bool IsDropped() const
+			{
+				std::uint64_t value[MAX_RESULT];
+				return Read(value) == ResultState::DROPPED;
+			}
+
+			// blocks the calling thread. the game thread runs the calls, so it would only ever time out there
+			std::optional<Value> Wait(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) const
+			{
+				if (std::this_thread::get_id() == GetInstance().m_GameThread.load(std::memory_order_relaxed))
+				{
+					LOG(FATAL) << "NativeFuture::Wait called from the game thread";
+					return Get();
+				}
+
+				auto deadline = std::chrono::steady_clock::now() + timeout;
+				std::uint64_t value[MAX_RESULT];
+				while (std::chrono::steady_clock::now() < deadline)
+				{
+					switch (Read(value))
+					{
+					case ResultState::DONE: return ToValue(value);
+					case ResultState::DROPPED: return std::nullopt;
+					case ResultState::PENDING: break;
+					}
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+
+				return Get();
+			}
+
+		private:
+			ResultState Read(std::uint64_t* value) const
+			{
+				return IsValid() ? GetInstance().ReadResult(m_Ticket, value) : ResultState::DROPPED;
+			}
+
+			static Value ToValue(const std::uint64_t* value)
+			{
+				if constexpr (std::is_void_v<Ret>)
+				{
+					return true;
+				}
+				else
+				{
+					Ret result;
+					std::memcpy(&result, value, sizeof(Ret));
+					return result;
+				}
+			}
+		};
+
+		// queues a call to the native, with the argument and return types of its wrapper in Natives.hpp. arguments are
+		// converted and copied as a direct call would, so pointers to the caller's memory aren't allowed
+		template<NativeIndex index, typename... T>
+		static auto Push(T&&... args)
+		{
+			return PushAs<index>(0, std::forward<T>(args)...);
+		}
+
+		// same, but the batch runs it as the thread of the given script. calls for a script that isn't running are dropped
+		template<NativeIndex index, typename... T>
+		static auto PushAs(joaat_t script, T&&... args)
+		{
+			using Signature = NativeSignature<index>;
+			using Params    = typename Signature::Args;
+			static_assert(sizeof...(T) == std::tuple_size_v<Params>, "wrong number of arguments for this native");
+
+			return [&]<std::size_t... I>(std::index_sequence<I...>) {
+				return PushTyped<index, typename Signature::Ret, Signature::FIX_VECTORS, std::tuple_element_t<I, Params>...>(script, std::forward<T>(args)...);
+			}(std::index_sequence_for<T...>());
+		}
+
+		// runs the queued calls on the game thread, runs as a script
+		static void Update();
+
+		static Stats GetStats();
+
+	private:
+		static NativeQueue& GetInstance()
+		{
+			static NativeQueue Instance;
+			return Instance;
+		}
+
+		template<NativeIndex index, typename Ret, bool fix_vectors, typename... Params>
+		static Future<Ret> PushTyped(joaat_t script, Params... args)
+		{
+			static_assert(sizeof...(Params) <= MAX_ARGS, "too many arguments");
+			static_assert((!std::is_pointer_v<Params> && ...), "the call runs later, pointer arguments would dangle");
+			static_assert((std::is_trivially_copyable_v<Params> && ...) && ((sizeof(Params) <= sizeof(std::uint64_t)) && ...), "arguments must fit in a slot");
+
+			std::size_t result_size = 0;
+			if constexpr (!std::is_same_v<Ret, void>)
+			{
+				static_assert(std::is_trivially_copyable_v<Ret> && sizeof(Ret) <= MAX_RESULT * sizeof(std::uint64_t), "the result must fit in the result slots");
+				result_size = sizeof(Ret);
+			}
+
+			const std::uint64_t slots[] = {ToSlot(args)..., 0};
+			auto ticket = GetInstance().PushImpl(index, script, {slots, sizeof...(Params)}, fix_vectors, result_size);
+			return Future<Ret>(ticket);
+		}
+
+		template<typename T>
+		static std::uint64_t ToSlot(const T& arg)
+		{
+			std::uint64_t value = 0;
+			std::memcpy(&value, &arg, sizeof(T));
+			return value;
+		}
+
+		std::uint64_t PushImpl(NativeIndex index, joaat_t script, std::span<const std::uint64_t> args, bool fix_vectors, std::size_t result_size);
+		ResultState ReadResult(std::uint64_t ticket, std::uint64_t* value);
+		void WriteResult(const Call& call, const std::uint64_t* value, bool ran);
+		void Execute(const Call& call);
+		void RunBatch();
+	};
+
+	template<typename Ret>
+	using NativeFuture = NativeQueue::Future<Ret>;
+}
@@ -0,0 +1,91 @@
+#include "NetEventLog.hpp"
+
+#include <network/CNetGamePlayer.hpp>
+
+namespace YimMenu
+{
+	static const char* GetEventName(NetEventType type)
+	{
+		if (static_cast<std::size_t>(type) < g_NetEventsToString.size())
+			return g_NetEventsToString[static_cast<int>(type)];
+
+		return "UNKNOWN_EVENT";
+	}
+
+	static void LogScriptCommands(const char* sender, const ScriptCommandEventData& event)
+	{
+		std::string data;
+		int param = 0;
+		for (int i = 0; i < event.m_NumCommands; i++)
+		{
+			data.clear();
+			std::format_to(std::back_inserter(data), "0x{:X}(", event.m_Commands[i].m_Hash);
+			for (int j = 0; j < event.m_Commands[i].m_NumParams; j++, param++)
+			{
+				if (j)
+					data += ", ";
+
+				if (param < ScriptCommandEventData::MAX_PARAMS)
+					std::format_to(std::back_inserter(data), "{}", event.m_Params[param]);
+				else
+					data += "?";
+			}
+			data += ");";
+
+			LOG(WARNING) << sender << " tried to execute " << data;
+		}
+	}
+
+	void NetEventLog::PushImpl(CNetGamePlayer* sender, const NetEventData& data, const char* reason)
+	{
+		m_Entries.Emplace([&](Entry& entry) {
+			entry.m_Data   = data;
+			entry.m_Reason = reason;
+			strncpy(entry.m_Sender, sender ? sender->GetName() : "Unknown", sizeof(entry.m_Sender) - 1);
+			entry.m_Sender[sizeof(entry.m_Sender) - 1] = 0;
+		});
+	}
+
+	static void LogEntry(NetEventLog::Entry& entry)
+	{
+		if (!entry.m_Reason)
+		{
+			LOG(INFO) << "NETWORK_EVENT: " << GetEventName(entry.m_Data.m_Type) << " from " << entry.m_Sender;
+			return;
+		}
+
+		auto& data = entry.m_Data;
+		if (!data.m_Decoded)
+		{
+			LOG(WARNING) << entry.m_Reason << " from " << entry.m_Sender;
+			return;
+		}
+
+		switch (data.m_Type)
+		{
+		case NetEventType::SCRIPT_COMMAND_EVENT:
+			LogScriptCommands(entry.m_Sender, data.m_ScriptCommand);
+			LOG(WARNING) << entry.m_Reason << " from " << entry.m_Sender;
+			break;
+		case NetEventType::EXPLOSION_EVENT:
+			LOGF(WARNING, "{} from {} (type {}, owner {}, entity {})", entry.m_Reason, entry.m_Sender, data.m_Explosion.m_ExplosionTag, data.m_Explosion.m_OwnerNetId, data.m_Explosion.m_EntityNetId);
+			break;
+		case NetEventType::NETWORK_PTFX_EVENT:
+			LOGF(WARNING, "{} from {} (asset 0x{:X}, effect 0x{:X}, entity {})", entry.m_Reason, entry.m_Sender, data.m_Ptfx.m_AssetHash, data.m_Ptfx.m_EffectHash, data.m_Ptfx.m_EntityNetId);
+			break;
+		case NetEventType::GIVE_CONTROL_EVENT:
+			LOGF(WARNING, "{} from {} ({} objects)", entry.m_Reason, entry.m_Sender, data.m_GiveControl.m_NumObjects);
+			break;
+		default: LOG(WARNING) << entry.m_Reason << " from " << entry.m_Sender; break;
+		}
+	}
+
+	void NetEventLog::FlushImpl()
+	{
+		while (m_Entries.Consume(&LogEntry))
+			;
+
+		if (auto dropped = m_Entries.TakeDropped())
+			LOGF(NET_EVENT, WARNING, "Dropped {} network event log entries", dropped);
+	}
+}
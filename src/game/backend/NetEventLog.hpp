@@ -0,0 +1,49 @@
+#pragma once
+#include "core/misc/BoundedQueue.hpp"
+#include "game/rdr/NetEvents.hpp"
+
+class CNetGamePlayer;
+
+namespace YimMenu
+{
+	// Network event hooks only copy a compact record in here. Formatting and logging happens later on the menu's main
+	// thread, so floods of events can't turn the event handler into a string formatting bottleneck
+	class NetEventLog
+	{
+	public:
+		struct Entry
+		{
+			NetEventData m_Data;
+			char m_Sender[20];
+			const char* m_Reason; // static string, nullptr if the event was only received
+		};
+
+		static void Received(CNetGamePlayer* sender, const NetEventData& data)
+		{
+			GetInstance().PushImpl(sender, data, nullptr);
+		}
+
+		// reason must be a string literal
+		static void Blocked(CNetGamePlayer* sender, const NetEventData& data, const char* reason)
+		{
+			GetInstance().PushImpl(sender, data, reason);
+		}
+
+		static void Flush()
+		{
+			GetInstance().FlushImpl();
+		}
+
+	private:
+		BoundedQueue<Entry, 256> m_Entries;
+
+		void PushImpl(CNetGamePlayer* sender, const NetEventData& data, const char* reason);
+		void FlushImpl();
+
+		static NetEventLog& GetInstance()
+		{
+			static NetEventLog Instance;
+			return Instance;
+		}
+	};
+}
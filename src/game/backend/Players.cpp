@@ -1,5 +1,6 @@
 #include "Players.hpp"
 
+#include "FloodProtection.hpp"
 #include "game/features/Features.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "PlayerDatabase.hpp"
@@ -33,6 +34,7 @@ namespace YimMenu
 
 		m_Players[player->m_PlayerIndex]     = new_player;
 		m_PlayerDatas[player->m_PlayerIndex] = PlayerData();
+		FloodProtection::ResetPlayer(player->m_PlayerIndex);
 
 		if (auto p = g_PlayerDatabase->GetPlayer(new_player.GetRID()))
 		{
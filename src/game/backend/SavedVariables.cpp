@@ -2,6 +2,7 @@
 #include "core/filemgr/FileMgr.hpp"
 #include "game/backend/Self.hpp"
 #include "game/rdr/ScriptGlobal.hpp"
+#include "VariableWatch.hpp"
 #include <script/scrThread.hpp>
 
 namespace YimMenu
@@ -82,6 +83,7 @@ namespace YimMenu
 
 		m_SavedGlobals = vars["globals"];
 		m_SavedLocals = vars["locals"];
+		VariableWatch::SetVariables(m_SavedGlobals, m_SavedLocals);
 	}
 	
 	void SavedVariables::SaveImpl()
@@ -94,5 +96,7 @@ namespace YimMenu
 		std::ofstream offstream_file(file.Path(), std::ios::out | std::ios::trunc);
 		offstream_file << vars.dump(4);
 		offstream_file.close();
+
+		VariableWatch::SetVariables(m_SavedGlobals, m_SavedLocals);
 	}
 }
\ No newline at end of file
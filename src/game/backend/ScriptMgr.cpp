@@ -53,8 +53,26 @@ namespace YimMenu
 
 	void ScriptMgr::DestroyImpl()
 	{
+		// a started task can hold model requests, which have to be released on the game thread
+		if (std::exchange(m_CanTick, false))
+		{
+			m_DestroyTasks = true;
+			for (int i = 0; i < 100 && m_DestroyTasks; i++)
+				std::this_thread::sleep_for(10ms);
+
+			if (m_DestroyTasks)
+			{
+				LOG(WARNING) << "ScriptMgr: the game thread didn't destroy " << m_Tasks.size() << " tasks, leaking them";
+				std::ignore = new std::vector<ScriptTask>(std::move(m_Tasks));
+			}
+		}
+
 		std::lock_guard lock(m_Mutex);
 		m_Scripts.clear();
+
+		// these haven't started, so they hold nothing but their arguments
+		std::lock_guard tasks_lock(m_NewTasksMutex);
+		m_NewTasks.clear();
 	}
 
 	void ScriptMgr::TickImpl()
@@ -73,6 +91,14 @@ namespace YimMenu
 
 				for (const auto& script : m_Scripts)
 					script->Tick();
+
+				TickTasks();
+
+				if (m_DestroyTasks)
+				{
+					m_Tasks.clear();
+					m_DestroyTasks = false;
+				}
 			});
 		}
 	}
@@ -88,4 +114,25 @@ namespace YimMenu
 		std::lock_guard lock(m_Mutex);
 		m_Scripts.push_back(std::move(script));
 	}
+
+	void ScriptMgr::AddTaskImpl(ScriptTask task)
+	{
+		// tasks and scripts add tasks while the others are ticking, so they're picked up on the next tick
+		std::lock_guard lock(m_NewTasksMutex);
+		m_NewTasks.push_back(std::move(task));
+	}
+
+	void ScriptMgr::TickTasks()
+	{
+		{
+			std::lock_guard lock(m_NewTasksMutex);
+			std::move(m_NewTasks.begin(), m_NewTasks.end(), std::back_inserter(m_Tasks));
+			m_NewTasks.clear();
+		}
+
+		// every task is polled once and resumed if what it waits for is ready
+		std::erase_if(m_Tasks, [](ScriptTask& task) {
+			return !task.Tick();
+		});
+	}
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include "ScriptTask.hpp"
 
 namespace YimMenu
 {
@@ -60,6 +61,11 @@ namespace YimMenu
 			GetInstance().AddScriptImpl(std::move(script));
 		}
 
+		static void AddTask(ScriptTask task)
+		{
+			GetInstance().AddTaskImpl(std::move(task));
+		}
+
 		static bool CanTick()
 		{
 			return GetInstance().m_CanTick;
@@ -68,6 +74,10 @@ namespace YimMenu
 	private:
 		std::mutex m_Mutex;
 		std::vector<std::unique_ptr<Script>> m_Scripts;
+		std::vector<ScriptTask> m_Tasks; // only touched while ticking
+		std::mutex m_NewTasksMutex;
+		std::vector<ScriptTask> m_NewTasks;
+		std::atomic<bool> m_DestroyTasks = false; // set on unload, the game thread destroys the tasks and clears it
 		bool m_CanTick = false;
 
 		void InitImpl();
@@ -75,6 +85,8 @@ namespace YimMenu
 		void TickImpl();
 		void YieldImpl(std::optional<std::chrono::high_resolution_clock::duration> time = std::nullopt);
 		void AddScriptImpl(std::unique_ptr<Script> script);
+		void AddTaskImpl(ScriptTask task);
+		void TickTasks();
 
 		static ScriptMgr& GetInstance()
 		{
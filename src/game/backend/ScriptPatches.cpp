@@ -1,61 +1,79 @@
 #include "ScriptPatches.hpp"
+#include "ScriptPatterns.hpp"
 #include "game/pointers/Pointers.hpp"
 #include <script/scrProgram.hpp>
 
 namespace YimMenu
 {
-	static uint8_t* GetCodeLocation(ScriptPatches::Data* data, int idx)
+	static std::uint32_t s_NextDataId = 1;
+
+	ScriptPatches::Data::Data(rage::scrProgram* program) :
+	    m_Id(s_NextDataId++),
+	    m_OriginalTable(program->m_CodeBlocks),
+	    m_OriginalPages(program->m_CodeBlocks, program->m_CodeBlocks + program->GetNumCodePages()),
+	    m_Pages(m_OriginalPages),
+	    m_Copies(program->GetNumCodePages()),
+	    m_PageRefs(program->GetNumCodePages()),
+	    m_Size(program->GetFullCodeSize())
 	{
-		return &data->GetData()[idx >> 14][idx & 0x3FFF];
 	}
 
-	static std::optional<int32_t> GetCodeLocationByPattern(ScriptPatches::Data* data, const SimplePattern& pattern)
+	std::uint32_t ScriptPatches::Data::GetPageSize(std::uint32_t page) const
 	{
-		uint32_t code_size = data->GetSize();
-		for (uint32_t i = 0; i < (code_size - pattern.m_Bytes.size()); i++)
-		{
-			for (uint32_t j = 0; j < pattern.m_Bytes.size(); j++)
-			{
-				if (pattern.m_Bytes[j].has_value())
-				{
-					int loc = i + j;
-					if (pattern.m_Bytes[j] != *GetCodeLocation(data, loc))
-						goto incorrect;
-				}
-			}
+		return std::min(m_Size - (page << 14), 0x4000u);
+	}
 
-			return i;
-		incorrect:
-			continue;
-		}
+	bool ScriptPatches::Data::IsFor(rage::scrProgram* program)
+	{
+		// the code blocks are ours while the program is in the VM
+		if (program->m_CodeBlocks != m_OriginalTable && program->m_CodeBlocks != m_Pages.data())
+			return false;
 
-		return std::nullopt;
+		return program->GetFullCodeSize() == m_Size && (program->m_CodeBlocks == m_Pages.data() || std::equal(m_OriginalPages.begin(), m_OriginalPages.end(), program->m_CodeBlocks));
 	}
 
-	ScriptPatches::Data::Data(rage::scrProgram* program)
+	void ScriptPatches::Data::Read(std::uint32_t pc, std::uint8_t* out, std::uint32_t size)
 	{
-		auto pages = new uint8_t*[program->GetNumCodePages()];
+		for (auto i = 0u; i < size; i++)
+			out[i] = m_Pages[(pc + i) >> 14][(pc + i) & 0x3FFF];
+	}
+
+	void ScriptPatches::Data::Write(std::uint32_t pc, const std::uint8_t* bytes, std::uint32_t size)
+	{
+		if (size == 0)
+			return;
 
-		for (auto i = 0u; i < program->GetNumCodePages(); i++)
+		for (auto page = pc >> 14; page <= (pc + size - 1) >> 14; page++)
 		{
-			pages[i] = new uint8_t[program->GetCodePageSize(i)];
-			std::memcpy(pages[i], program->GetCodePage(i), program->GetCodePageSize(i));
+			if (m_PageRefs[page]++ == 0)
+			{
+				m_Copies[page] = std::make_unique<std::uint8_t[]>(GetPageSize(page));
+				std::memcpy(m_Copies[page].get(), m_OriginalPages[page], GetPageSize(page));
+				m_Pages[page] = m_Copies[page].get();
+			}
 		}
 
-		m_Data = pages;
-		m_Pages = program->GetNumCodePages();
-		m_Size  = program->GetFullCodeSize();
+		for (auto i = 0u; i < size; i++)
+			m_Pages[(pc + i) >> 14][(pc + i) & 0x3FFF] = bytes[i];
 	}
 
-	ScriptPatches::Data::~Data()
+	void ScriptPatches::Data::Release(std::uint32_t pc, const std::uint8_t* original, std::uint32_t size)
 	{
-		for (auto i = 0u; i < m_Pages; i++)
+		if (size == 0)
+			return;
+
+		// pages other patches still need keep their copy
+		for (auto i = 0u; i < size; i++)
+			m_Pages[(pc + i) >> 14][(pc + i) & 0x3FFF] = original[i];
+
+		for (auto page = pc >> 14; page <= (pc + size - 1) >> 14; page++)
 		{
-			delete[] m_Data[i];
+			if (m_PageRefs[page] && --m_PageRefs[page] == 0)
+			{
+				m_Pages[page] = m_OriginalPages[page];
+				m_Copies[page].reset();
+			}
 		}
-
-		delete[] m_Data;
-		m_Data = nullptr;
 	}
 
 	std::optional<int32_t> ScriptPatches::Patch::GetPC()
@@ -68,7 +86,17 @@ namespace YimMenu
 		if (!data)
 			return std::nullopt;
 
-		auto location = GetCodeLocationByPattern(data, m_Pattern);
+		// registering the program resolves it, unless this patch was added later. the game's bytecode is searched since
+		// our copy may have other patches applied already
+		auto location = ScriptPatterns::GetPC(m_PatternId);
+		if (!location.has_value())
+		{
+			if (auto program = Scripts::FindScriptProgram(m_Identifier.m_Hash))
+			{
+				ScriptPatterns::Resolve(program);
+				location = ScriptPatterns::GetPC(m_PatternId);
+			}
+		}
 
 		if (!location.has_value())
 		{
@@ -87,17 +115,24 @@ namespace YimMenu
 		auto pc = GetPC();
 		auto data = GetInstance().GetDataImpl(m_Identifier.m_Hash);
 
-		if (!pc || !data)
+		if (!pc || !data || m_AppliedTo == data->GetId())
+			return;
+
+		if (pc.value() < 0 || pc.value() + m_PatchedBytes.size() > data->GetSize())
+		{
+			LOG(WARNING) << "Patch for script " << HEX(m_Identifier.m_Hash) << " is out of bounds";
 			return;
+		}
 
 		if (m_OriginalBytes.size() == 0)
 		{
 			m_OriginalBytes.resize(m_PatchedBytes.size());
-			memcpy(m_OriginalBytes.data(), GetCodeLocation(data, pc.value()), m_PatchedBytes.size());
+			data->Read(pc.value(), m_OriginalBytes.data(), m_PatchedBytes.size());
 		}
 
 		LOG(INFO) << "Patch applied: " << pc.value() << ", " << m_PatchedBytes.size();
-		memcpy(GetCodeLocation(data, pc.value()), m_PatchedBytes.data(), m_PatchedBytes.size());
+		data->Write(pc.value(), m_PatchedBytes.data(), m_PatchedBytes.size());
+		m_AppliedTo = data->GetId();
 	}
 
 	void ScriptPatches::Patch::Restore()
@@ -108,18 +143,20 @@ namespace YimMenu
 		auto pc   = GetPC();
 		auto data = GetInstance().GetDataImpl(m_Identifier.m_Hash);
 
-		if (!pc || !data)
+		if (!pc || !data || m_AppliedTo != data->GetId())
 			return;
 
 		LOG(INFO) << "Patch restored";
-		memcpy(GetCodeLocation(data, pc.value()), m_OriginalBytes.data(), m_OriginalBytes.size());
+		data->Release(pc.value(), m_OriginalBytes.data(), m_OriginalBytes.size());
+		m_AppliedTo = 0;
 	}
 
 	ScriptPatches::Patch::Patch(joaat_t script, bool is_mp, SimplePattern pattern, int32_t offset, std::vector<uint8_t> patch) :
-	    m_Pattern(pattern),
+	    m_PatternId(ScriptPatterns::Add(script, std::move(pattern))),
 	    m_Offset(offset),
 	    m_PatchedBytes(patch),
 	    m_Enabled(false),
+	    m_AppliedTo(0),
 	    m_Pc(std::nullopt),
 	    m_OriginalBytes({}),
 	    m_Identifier(script, is_mp)
@@ -184,7 +221,12 @@ namespace YimMenu
 		UpdateScriptMPStatus();
 		if (auto it = m_Datas.find(program->m_NameHash); it != m_Datas.end())
 		{
-			return;
+			if (it->second->IsFor(program))
+				return;
+
+			// the program was loaded again, and the pages we share with it are gone
+			m_Datas.erase(it);
+			ClearProgramSlots();
 		}
 
 		// check if this program is in scope
@@ -203,9 +245,13 @@ namespace YimMenu
 		if (!in_scope)
 			return; // avoid polluting memory with unused program bytecode
 
+		// find every pattern of this script in one go, before any of them is applied
+		ScriptPatterns::Resolve(program);
 		m_Datas.emplace(program->m_NameHash, std::move(std::make_unique<Data>(program)));
+		ClearProgramSlots();
 
-		// refresh patches so they can enable themselves
+		// refresh patches so they can enable themselves. nothing is copied up front, each page is copied by the first patch
+		// written to it
 		for (auto& patch : m_Patches)
 		{
 			if (patch->InScope(program->m_NameHash))
@@ -229,7 +275,20 @@ namespace YimMenu
 			return;
 		}
 
-		auto data = GetDataImpl(program->m_NameHash);
+		auto& slot = m_ProgramSlots[(reinterpret_cast<std::uintptr_t>(program) >> 4) % m_ProgramSlots.size()];
+		if (slot.m_Program != program || slot.m_CodeBlocks != program->m_CodeBlocks)
+		{
+			auto data = GetDataImpl(program->m_NameHash);
+			if (data && !data->IsFor(program))
+			{
+				RegisterProgramImpl(program);
+				data = GetDataImpl(program->m_NameHash);
+			}
+
+			slot = {program, program->m_CodeBlocks, data};
+		}
+
+		auto data = slot.m_Data;
 
 		if (!data)
 		{
@@ -257,17 +316,25 @@ namespace YimMenu
 		return nullptr;
 	}
 
+	void ScriptPatches::ClearProgramSlots()
+	{
+		m_ProgramSlots.fill({});
+	}
+
 	void ScriptPatches::UpdateScriptMPStatus()
 	{
 		if (m_UsingMPScripts != Scripts::UsingMPScripts())
 		{
 			m_Datas.clear();
+			ClearProgramSlots();
 			m_UsingMPScripts = Scripts::UsingMPScripts();
 		}
 	}
 
 	ScriptPatches::ScriptPatches() :
-	    m_CurrentlyReplacedBytecode(nullptr)
+	    m_ProgramSlots{},
+	    m_CurrentlyReplacedBytecode(nullptr),
+	    m_UsingMPScripts(!Scripts::UsingMPScripts())
 	{
 		UpdateScriptMPStatus();
 	}
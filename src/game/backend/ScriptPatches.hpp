@@ -13,16 +13,24 @@ namespace YimMenu
 	class ScriptPatches
 	{
 	public:
+		// What the VM runs while a patched program executes. Pages start out as the game's own, and a page gets a copy of
+		// its own while a patch is applied to it, so only the pages that are actually patched take memory
 		class Data
 		{
-			std::uint8_t** m_Data;
-			std::uint32_t m_Pages;
+			std::uint32_t m_Id; // never reused, so a patch can tell whether it was applied to this one
+			std::uint8_t** m_OriginalTable;
+			std::vector<std::uint8_t*> m_OriginalPages;
+			std::vector<std::uint8_t*> m_Pages; // handed to the VM
+			std::vector<std::unique_ptr<std::uint8_t[]>> m_Copies;
+			std::vector<std::uint32_t> m_PageRefs; // patches applied to each copied page
 			std::uint32_t m_Size;
 
+			std::uint32_t GetPageSize(std::uint32_t page) const;
+
 		public:
 			inline std::uint8_t** GetData()
 			{
-				return m_Data;
+				return m_Pages.data();
 			}
 
 			inline std::uint32_t GetSize()
@@ -30,8 +38,21 @@ namespace YimMenu
 				return m_Size;
 			}
 
+			inline std::uint32_t GetId()
+			{
+				return m_Id;
+			}
+
+			// whether this was made from the bytecode the program has loaded right now
+			bool IsFor(rage::scrProgram* program);
+
+			void Read(std::uint32_t pc, std::uint8_t* out, std::uint32_t size);
+			// copies the pages in range if this is the first patch on them
+			void Write(std::uint32_t pc, const std::uint8_t* bytes, std::uint32_t size);
+			// writes the original bytes back and drops the copies no other patch needs anymore
+			void Release(std::uint32_t pc, const std::uint8_t* original, std::uint32_t size);
+
 			Data(rage::scrProgram* program);
-			~Data();
 		};
 
 		class Patch
@@ -39,9 +60,10 @@ namespace YimMenu
 			std::vector<uint8_t> m_OriginalBytes;
 			std::vector<uint8_t> m_PatchedBytes;
 			std::optional<int32_t> m_Pc;
-			SimplePattern m_Pattern;
+			std::uint32_t m_PatternId;
 			int32_t m_Offset;
 			bool m_Enabled;
+			std::uint32_t m_AppliedTo; // id of the data the patch is applied to, zero if none
 			ScriptIdentifier m_Identifier;
 
 			std::optional<int32_t> GetPC();
@@ -98,9 +120,20 @@ namespace YimMenu
 		void OnScriptVMLeaveImpl(rage::scrProgram* program);
 		Data* GetDataImpl(joaat_t script);
 		void UpdateScriptMPStatus();
+		void ClearProgramSlots();
+
+		// the data of the last programs that entered the VM, so entering doesn't need a lookup. no data means the
+		// program has nothing patched
+		struct ProgramSlot
+		{
+			rage::scrProgram* m_Program;
+			std::uint8_t** m_CodeBlocks;
+			Data* m_Data;
+		};
 
 		std::vector<std::shared_ptr<Patch>> m_Patches;
 		std::unordered_map<joaat_t, std::unique_ptr<Data>> m_Datas;
+		std::array<ProgramSlot, 64> m_ProgramSlots;
 		std::uint8_t** m_CurrentlyReplacedBytecode;
 		bool m_UsingMPScripts;
 	};
@@ -0,0 +1,142 @@
+#include "ScriptPatterns.hpp"
+
+#include "core/filemgr/FileMgr.hpp"
+#include "game/rdr/BytecodeSearch.hpp"
+
+#include <script/scrProgram.hpp>
+
+namespace YimMenu
+{
+	static std::uint64_t GetCacheKey(joaat_t script, std::uint64_t codeHash, std::uint64_t patternHash)
+	{
+		constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+
+		auto key = (script * multiplier) ^ codeHash;
+		key      = (key ^ (key >> 29)) * multiplier;
+		return key ^ patternHash;
+	}
+
+	std::uint32_t ScriptPatterns::AddImpl(joaat_t script, SimplePattern pattern)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto patternHash = BytecodeSearch::Hash(pattern);
+		m_Entries.push_back({script, std::move(pattern), patternHash, 0, std::nullopt});
+		return static_cast<std::uint32_t>(m_Entries.size() - 1);
+	}
+
+	void ScriptPatterns::ResolveImpl(rage::scrProgram* program)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto script = program->m_NameHash;
+		if (std::none_of(m_Entries.begin(), m_Entries.end(), [script](const Entry& entry) {
+			    return entry.m_Script == script;
+		    }))
+			return;
+
+		BytecodeView code(program->m_CodeBlocks, program->GetFullCodeSize());
+		auto codeHash = BytecodeSearch::Hash(code);
+		LoadCache();
+
+		std::vector<Entry*> missing;
+		for (auto& entry : m_Entries)
+		{
+			if (entry.m_Script != script || entry.m_CodeHash == codeHash)
+				continue;
+
+			if (auto it = m_Cache.find(GetCacheKey(script, codeHash, entry.m_PatternHash)); it != m_Cache.end())
+			{
+				entry.m_CodeHash = codeHash;
+				entry.m_Pc       = it->second.m_Pc >= 0 ? std::optional(it->second.m_Pc) : std::nullopt;
+			}
+			else
+			{
+				missing.push_back(&entry);
+			}
+		}
+
+		// results for older bytecode of this script will never be used again
+		if (std::erase_if(m_Cache, [script, codeHash](const auto& item) {
+			    return item.second.m_Script == script && item.second.m_CodeHash != codeHash;
+		    }))
+			m_CacheDirty = true;
+
+		if (missing.empty())
+			return;
+
+		std::vector<const SimplePattern*> patterns;
+		for (auto entry : missing)
+			patterns.push_back(&entry->m_Pattern);
+
+		std::vector<std::optional<std::int32_t>> results(missing.size());
+		BytecodeSearch::FindAll(code, patterns, results);
+
+		for (std::size_t i = 0; i < missing.size(); i++)
+		{
+			missing[i]->m_CodeHash = codeHash;
+			missing[i]->m_Pc       = results[i];
+			m_Cache[GetCacheKey(script, codeHash, missing[i]->m_PatternHash)] = {script, codeHash, results[i].value_or(-1)};
+		}
+
+		LOG(VERBOSE) << "Searched " << missing.size() << " patterns in script " << HEX(script);
+		m_CacheDirty = true;
+	}
+
+	std::optional<std::int32_t> ScriptPatterns::GetPCImpl(std::uint32_t id)
+	{
+		std::lock_guard lock(m_Mutex);
+		return m_Entries[id].m_Pc;
+	}
+
+	// bumped when the layout of a record changes, older files are ignored and rewritten
+	static constexpr std::uint32_t CACHE_VERSION = 2;
+
+	struct CacheRecord
+	{
+		std::uint64_t m_Key;
+		std::uint64_t m_CodeHash;
+		joaat_t m_Script;
+		std::int32_t m_Pc;
+	};
+
+	void ScriptPatterns::FlushImpl()
+	{
+		std::vector<CacheRecord> records;
+		{
+			std::lock_guard lock(m_Mutex);
+			if (!m_CacheDirty)
+				return;
+			m_CacheDirty = false;
+
+			records.reserve(m_Cache.size());
+			for (auto& [key, entry] : m_Cache)
+				records.push_back({key, entry.m_CodeHash, entry.m_Script, entry.m_Pc});
+		}
+
+		auto file = FileMgr::GetProjectFile("./script_pattern_cache.bin");
+		std::ofstream stream(file.Path(), std::ios_base::binary | std::ios_base::trunc);
+		stream.write(reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+		stream.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(CacheRecord));
+	}
+
+	void ScriptPatterns::LoadCache()
+	{
+		if (m_CacheLoaded)
+			return;
+		m_CacheLoaded = true;
+
+		auto file = FileMgr::GetProjectFile("./script_pattern_cache.bin");
+		if (!file.Exists())
+			return;
+
+		std::ifstream stream(file.Path(), std::ios_base::binary);
+		std::uint32_t version = 0;
+		if (!stream.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != CACHE_VERSION)
+			return;
+
+		CacheRecord record;
+		while (stream.read(reinterpret_cast<char*>(&record), sizeof(record)))
+			m_Cache.emplace(record.m_Key, CacheEntry{record.m_Script, record.m_CodeHash, record.m_Pc});
+	}
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include "core/memory/Pattern.hpp"
+#include "util/Joaat.hpp"
+
+namespace rage
+{
+	class scrProgram;
+}
+
+namespace YimMenu
+{
+	// Every bytecode pattern the menu looks for, shared by script patches and script functions. The first time one of a
+	// script's patterns is needed all of them are found in one search, and the results are saved keyed by the script and a
+	// hash of its bytecode, so the same scripts are never searched again, not even in the next session. Only the results for
+	// the bytecode a script was last seen with are kept, older ones are dropped when a game update changes it
+	class ScriptPatterns
+	{
+		struct Entry
+		{
+			joaat_t m_Script;
+			SimplePattern m_Pattern;
+			std::uint64_t m_PatternHash;
+			std::uint64_t m_CodeHash; // of the bytecode m_Pc belongs to, zero if it wasn't searched for yet
+			std::optional<std::int32_t> m_Pc;
+		};
+
+		struct CacheEntry
+		{
+			joaat_t m_Script;
+			std::uint64_t m_CodeHash;
+			std::int32_t m_Pc; // -1 if not found
+		};
+
+		std::mutex m_Mutex;
+		std::vector<Entry> m_Entries; // indexed by id
+		std::unordered_map<std::uint64_t, CacheEntry> m_Cache; // keyed by (script, bytecode, pattern)
+		bool m_CacheLoaded = false;
+		bool m_CacheDirty  = false;
+
+	public:
+		// returns the id the pc is looked up by
+		static std::uint32_t Add(joaat_t script, SimplePattern pattern)
+		{
+			return GetInstance().AddImpl(script, std::move(pattern));
+		}
+
+		// finds the patterns of the program's script, unless they were found in this bytecode already
+		static void Resolve(rage::scrProgram* program)
+		{
+			GetInstance().ResolveImpl(program);
+		}
+
+		// where the pattern was found the last time its script was resolved
+		static std::optional<std::int32_t> GetPC(std::uint32_t id)
+		{
+			return GetInstance().GetPCImpl(id);
+		}
+
+		// writes the cache if new patterns were searched for. called on the main thread, so the game thread never waits on
+		// the file
+		static void Flush()
+		{
+			GetInstance().FlushImpl();
+		}
+
+	private:
+		static ScriptPatterns& GetInstance()
+		{
+			static ScriptPatterns Instance;
+			return Instance;
+		}
+
+		std::uint32_t AddImpl(joaat_t script, SimplePattern pattern);
+		void ResolveImpl(rage::scrProgram* program);
+		std::optional<std::int32_t> GetPCImpl(std::uint32_t id);
+		void FlushImpl();
+
+		void LoadCache();
+	};
+}
@@ -0,0 +1,117 @@
+#include "ScriptProfiler.hpp"
+
+#include "core/commands/BoolCommand.hpp"
+
+namespace YimMenu::Features
+{
+	class ProfileScripts : public BoolCommand
+	{
+		using BoolCommand::BoolCommand;
+
+		virtual void OnEnable() override
+		{
+			ScriptProfiler::SetEnabled(true);
+		}
+
+		virtual void OnDisable() override
+		{
+			ScriptProfiler::SetEnabled(false);
+		}
+	};
+
+	static ProfileScripts _ProfileScripts{"profilescripts", "Profile Scripts", "Records how long every script spends in the script VM"};
+}
+
+namespace YimMenu
+{
+	static void StoreMax(std::atomic<std::uint64_t>& value, std::uint64_t candidate)
+	{
+		auto current = value.load(std::memory_order_relaxed);
+		while (candidate > current && !value.compare_exchange_weak(current, candidate, std::memory_order_relaxed))
+			;
+	}
+
+	void ScriptProfiler::Counters::Reset()
+	{
+		m_Runs.store(0, std::memory_order_relaxed);
+		m_Time.store(0, std::memory_order_relaxed);
+		m_PeakTime.store(0, std::memory_order_relaxed);
+		m_PatchTime.store(0, std::memory_order_relaxed);
+		m_Natives.store(0, std::memory_order_relaxed);
+	}
+
+	void ScriptProfiler::Run::Begin(Counters* counters, std::uint32_t pc)
+	{
+		m_Counters = counters;
+		m_Previous = m_Current;
+		m_Pc       = pc;
+		m_Current  = counters;
+		m_Start = m_VMStart = m_VMEnd = clock::now();
+	}
+
+	void ScriptProfiler::Run::End()
+	{
+		auto end   = clock::now();
+		auto vm    = std::chrono::duration_cast<std::chrono::nanoseconds>(m_VMEnd - m_VMStart).count();
+		auto total = std::chrono::duration_cast<std::chrono::nanoseconds>(end - m_Start).count();
+
+		// runs without a separate vm part are all work
+		if (m_VMEnd == m_VMStart)
+			vm = total;
+
+		m_Counters->m_Runs.fetch_add(1, std::memory_order_relaxed);
+		m_Counters->m_Time.fetch_add(vm, std::memory_order_relaxed);
+		m_Counters->m_PatchTime.fetch_add(total - vm, std::memory_order_relaxed);
+		StoreMax(m_Counters->m_PeakTime, vm);
+
+		auto& profiler = GetInstance();
+		if (auto script = profiler.m_PcScript.load(std::memory_order_relaxed); script && m_Counters->m_Script.load(std::memory_order_relaxed) == script)
+			profiler.m_PcBuckets[std::min<std::size_t>(m_Pc >> PC_BUCKET_SHIFT, MAX_PC_BUCKETS - 1)].fetch_add(vm, std::memory_order_relaxed);
+
+		m_Current = m_Previous;
+	}
+
+	ScriptProfiler::Counters& ScriptProfiler::GetCounters(joaat_t script)
+	{
+		// open addressing, slots are claimed once and never freed
+		auto index = (script * 0x9E3779B1u) >> 24;
+		for (std::size_t i = 0; i < MAX_SCRIPTS; i++)
+		{
+			auto& counters = m_Scripts[(index + i) & (MAX_SCRIPTS - 1)];
+			auto current   = counters.m_Script.load(std::memory_order_acquire);
+
+			if (current == script)
+				return counters;
+
+			if (current == 0 && counters.m_Script.compare_exchange_strong(current, script, std::memory_order_acq_rel))
+				return counters;
+
+			// someone else claimed it first, maybe for this script
+			if (current == script)
+				return counters;
+		}
+
+		m_Dropped.fetch_add(1, std::memory_order_relaxed);
+		return m_Overflow;
+	}
+
+	void ScriptProfiler::SetPcScript(joaat_t script)
+	{
+		auto& profiler = GetInstance();
+		profiler.m_PcScript.store(script, std::memory_order_relaxed);
+		for (auto& bucket : profiler.m_PcBuckets)
+			bucket.store(0, std::memory_order_relaxed);
+	}
+
+	void ScriptProfiler::Reset()
+	{
+		auto& profiler = GetInstance();
+		for (auto& counters : profiler.m_Scripts)
+			counters.Reset();
+		profiler.m_Menu.Reset();
+		profiler.m_Overflow.Reset();
+		profiler.m_Dropped.store(0, std::memory_order_relaxed);
+		for (auto& bucket : profiler.m_PcBuckets)
+			bucket.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include "util/Joaat.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace YimMenu
+{
+	// Where the script VM spends its time. Every run of a game script adds its time, the time our bytecode patches took to
+	// swap in and out and the natives the menu invoked from inside it (our native hooks) to the counters of its script,
+	// and the menu's own scripts are counted the same way. Everything is a relaxed atomic in a fixed table, so the hooks
+	// never wait or allocate, and a run costs one load when profiling is off
+	class ScriptProfiler
+	{
+	public:
+		static constexpr std::size_t MAX_SCRIPTS       = 256;
+		static constexpr std::uint32_t PC_BUCKET_SHIFT = 12; // 4 KB of bytecode per bucket
+		static constexpr std::size_t MAX_PC_BUCKETS    = 1024;
+
+		struct Counters
+		{
+			std::atomic<joaat_t> m_Script{0}; // zero while the slot is free
+			std::atomic<std::uint64_t> m_Runs{0};
+			std::atomic<std::uint64_t> m_Time{0}; // in the VM, ns
+			std::atomic<std::uint64_t> m_PeakTime{0};
+			std::atomic<std::uint64_t> m_PatchTime{0};
+			std::atomic<std::uint64_t> m_Natives{0};
+
+			void Reset();
+		};
+
+		// times one run, call BeginVM and EndVM around the part that's the game's own work
+		class Run
+		{
+			using clock = std::chrono::steady_clock;
+
+			Counters* m_Counters = nullptr;
+			Counters* m_Previous = nullptr;
+			std::uint32_t m_Pc   = 0;
+			clock::time_point m_Start, m_VMStart, m_VMEnd;
+
+		public:
+			Run(joaat_t script, std::uint32_t pc)
+			{
+				if (IsEnabled()) [[unlikely]]
+					Begin(&GetInstance().GetCounters(script), pc);
+			}
+
+			// the menu's own scripts
+			Run()
+			{
+				if (IsEnabled()) [[unlikely]]
+					Begin(&GetInstance().m_Menu, 0);
+			}
+
+			~Run()
+			{
+				if (m_Counters) [[unlikely]]
+					End();
+			}
+
+			Run(const Run&)            = delete;
+			Run& operator=(const Run&) = delete;
+
+			void BeginVM()
+			{
+				if (m_Counters) [[unlikely]]
+					m_VMStart = clock::now();
+			}
+
+			void EndVM()
+			{
+				if (m_Counters) [[unlikely]]
+					m_VMEnd = clock::now();
+			}
+
+		private:
+			void Begin(Counters* counters, std::uint32_t pc);
+			void End();
+		};
+
+	private:
+		std::atomic<bool> m_Enabled{false};
+		std::array<Counters, MAX_SCRIPTS> m_Scripts;
+		Counters m_Menu;
+		Counters m_Overflow; // scripts that didn't fit in the table
+		std::atomic<std::uint32_t> m_Dropped{0};
+
+		std::atomic<joaat_t> m_PcScript{0}; // the script whose time is also split by pc
+		std::array<std::atomic<std::uint64_t>, MAX_PC_BUCKETS> m_PcBuckets{};
+
+		static inline thread_local Counters* m_Current = nullptr; // the run natives are counted for
+
+	public:
+		static bool IsEnabled()
+		{
+			return GetInstance().m_Enabled.load(std::memory_order_relaxed);
+		}
+
+		static void SetEnabled(bool enabled)
+		{
+			GetInstance().m_Enabled.store(enabled, std::memory_order_relaxed);
+		}
+
+		// called by the invoker for every native the menu calls
+		static void CountNative()
+		{
+			if (IsEnabled()) [[unlikely]]
+				(m_Current ? m_Current : &GetInstance().m_Menu)->m_Natives.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		static const std::array<Counters, MAX_SCRIPTS>& GetScripts()
+		{
+			return GetInstance().m_Scripts;
+		}
+
+		static const Counters& GetMenu()
+		{
+			return GetInstance().m_Menu;
+		}
+
+		static std::uint32_t GetDropped()
+		{
+			return GetInstance().m_Dropped.load(std::memory_order_relaxed);
+		}
+
+		// zero is none
+		static void SetPcScript(joaat_t script);
+
+		static joaat_t GetPcScript()
+		{
+			return GetInstance().m_PcScript.load(std::memory_order_relaxed);
+		}
+
+		static const std::array<std::atomic<std::uint64_t>, MAX_PC_BUCKETS>& GetPcBuckets()
+		{
+			return GetInstance().m_PcBuckets;
+		}
+
+		static void Reset();
+
+	private:
+		static ScriptProfiler& GetInstance()
+		{
+			static ScriptProfiler Instance;
+			return Instance;
+		}
+
+		Counters& GetCounters(joaat_t script);
+	};
+}
@@ -0,0 +1,96 @@
+#include "ScriptRegistry.hpp"
+
+#include "game/pointers/Pointers.hpp"
+
+#include <script/scrProgram.hpp>
+#include <script/scrThread.hpp>
+
+namespace YimMenu
+{
+	static constexpr int PROGRAM_SLOTS = 160;
+
+	void ScriptRegistry::UpdateImpl()
+	{
+		std::lock_guard lock(m_Mutex);
+
+		// the entries stay, a thread that has died or been reused fails IsValid and is searched for again then
+		m_Generation++;
+	}
+
+	void ScriptRegistry::RegisterProgramImpl(rage::scrProgram* program)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		// the slot isn't known until the program is looked up
+		m_Programs[program->m_NameHash] = {program, -1, m_Generation};
+	}
+
+	void ScriptRegistry::UnregisterProgramImpl(rage::scrProgram* program)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		if (auto it = m_Programs.find(program->m_NameHash); it != m_Programs.end() && it->second.m_Program == program)
+			m_Programs.erase(it);
+	}
+
+	rage::scrThread* ScriptRegistry::GetThreadImpl(joaat_t script)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto& entry = m_Threads[script];
+		if (IsValid(entry, script))
+			return entry.m_Thread;
+
+		if (entry.m_Thread || entry.m_Generation != m_Generation)
+			entry = FindThread(script);
+
+		return entry.m_Thread;
+	}
+
+	rage::scrProgram* ScriptRegistry::GetProgramImpl(joaat_t script)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto& entry = m_Programs[script];
+		if (IsValid(entry, script))
+			return entry.m_Program;
+
+		if (entry.m_Program || entry.m_Generation != m_Generation)
+			entry = FindProgram(script);
+
+		return entry.m_Program;
+	}
+
+	bool ScriptRegistry::IsValid(const ThreadEntry& entry, joaat_t script)
+	{
+		// the game reuses thread objects, but never their ids
+		return entry.m_Thread && entry.m_Thread->m_Context.m_ThreadId == entry.m_ThreadId && entry.m_Thread->m_Context.m_ScriptHash == script;
+	}
+
+	bool ScriptRegistry::IsValid(const ProgramEntry& entry, joaat_t script)
+	{
+		return entry.m_Program && entry.m_Slot >= 0 && Pointers.ScriptPrograms[entry.m_Slot] == entry.m_Program && entry.m_Program->m_NameHash == script;
+	}
+
+	ScriptRegistry::ThreadEntry ScriptRegistry::FindThread(joaat_t script)
+	{
+		for (auto& thread : *Pointers.ScriptThreads)
+		{
+			if (thread && thread->m_Context.m_ThreadId && thread->m_Context.m_ScriptHash == script)
+				return {thread, thread->m_Context.m_ThreadId, m_Generation};
+		}
+
+		return {nullptr, 0, m_Generation};
+	}
+
+	ScriptRegistry::ProgramEntry ScriptRegistry::FindProgram(joaat_t script)
+	{
+		for (int i = 0; i < PROGRAM_SLOTS; i++)
+		{
+			if (Pointers.ScriptPrograms[i] && Pointers.ScriptPrograms[i]->m_NameHash == script)
+				return {Pointers.ScriptPrograms[i], i, m_Generation};
+		}
+
+		return {nullptr, -1, m_Generation};
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "util/Joaat.hpp"
+
+namespace rage
+{
+	class scrThread;
+	class scrProgram;
+}
+
+namespace YimMenu
+{
+	// Script threads and programs by script hash. A thread is searched for the first time it's asked for and kept until
+	// it dies, and programs are added and removed as the game loads and frees them. Every entry is checked before it's
+	// returned, threads by the id the game gives each new thread and programs by the slot they were found in, so a
+	// pointer the game has reused is never handed out and a thread that's gone is searched for again. A script that
+	// can't be found is only searched for again once the next frame has started
+	class ScriptRegistry
+	{
+		struct ThreadEntry
+		{
+			rage::scrThread* m_Thread;
+			std::uint32_t m_ThreadId;
+			std::uint32_t m_Generation; // frame the entry was made in, for the ones that weren't found
+		};
+
+		struct ProgramEntry
+		{
+			rage::scrProgram* m_Program;
+			int m_Slot;
+			std::uint32_t m_Generation;
+		};
+
+		std::mutex m_Mutex;
+		std::unordered_map<joaat_t, ThreadEntry> m_Threads;
+		std::unordered_map<joaat_t, ProgramEntry> m_Programs;
+		std::uint32_t m_Generation = 1;
+
+	public:
+		// starts a new frame, called before the scripts run
+		static void Update()
+		{
+			GetInstance().UpdateImpl();
+		}
+
+		static void RegisterProgram(rage::scrProgram* program)
+		{
+			GetInstance().RegisterProgramImpl(program);
+		}
+
+		static void UnregisterProgram(rage::scrProgram* program)
+		{
+			GetInstance().UnregisterProgramImpl(program);
+		}
+
+		static rage::scrThread* GetThread(joaat_t script)
+		{
+			return GetInstance().GetThreadImpl(script);
+		}
+
+		static rage::scrProgram* GetProgram(joaat_t script)
+		{
+			return GetInstance().GetProgramImpl(script);
+		}
+
+	private:
+		static ScriptRegistry& GetInstance()
+		{
+			static ScriptRegistry Instance;
+			return Instance;
+		}
+
+		void UpdateImpl();
+		void RegisterProgramImpl(rage::scrProgram* program);
+		void UnregisterProgramImpl(rage::scrProgram* program);
+		rage::scrThread* GetThreadImpl(joaat_t script);
+		rage::scrProgram* GetProgramImpl(joaat_t script);
+
+		bool IsValid(const ThreadEntry& entry, joaat_t script);
+		bool IsValid(const ProgramEntry& entry, joaat_t script);
+		ThreadEntry FindThread(joaat_t script);
+		ProgramEntry FindProgram(joaat_t script);
+	};
+}
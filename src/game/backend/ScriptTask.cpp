@@ -0,0 +1,92 @@
+#include "ScriptTask.hpp"
+
+#include "game/rdr/Natives.hpp"
+
+namespace YimMenu
+{
+	void ScriptTask::promise_type::unhandled_exception()
+	{
+		try
+		{
+			throw;
+		}
+		catch (const std::exception& e)
+		{
+			LOG(WARNING) << "Script task threw: " << e.what();
+		}
+		catch (...)
+		{
+			LOG(WARNING) << "Script task threw an unknown exception";
+		}
+	}
+
+	bool ScriptTask::Tick()
+	{
+		if (IsDone())
+			return false;
+
+		auto& promise = m_Handle.promise();
+		if (promise.m_Poll && !promise.m_Poll(promise.m_Awaitable))
+			return true;
+
+		promise.m_Poll      = nullptr;
+		promise.m_Awaitable = nullptr;
+		m_Handle.resume();
+		return !m_Handle.done();
+	}
+
+	bool ModelLoaded::await_ready()
+	{
+		m_Request = ModelRequest(m_Model);
+		if (!m_Request.IsValid())
+			return true;
+
+		m_Loaded = m_Request.IsLoaded();
+		return m_Loaded;
+	}
+
+	bool ModelLoaded::Poll()
+	{
+		m_Loaded = m_Request.IsLoaded();
+		return m_Loaded || --m_TicksLeft < 0;
+	}
+
+	bool GroundZ::Poll()
+	{
+		constexpr float max_ground_check = 1000.f;
+
+		float ground_z = m_Location.z;
+		auto found     = MISC::GET_GROUND_Z_FOR_3D_COORD(m_Location.x, m_Location.y, max_ground_check, &ground_z, FALSE);
+		Streaming::RequestCollision(m_Location);
+
+		if (m_Attempts++ % 10 == 0)
+			m_Location.z += 25.f;
+
+		if (found)
+		{
+			float water;
+			m_Z = WATER::GET_WATER_HEIGHT(m_Location.x, m_Location.y, m_Location.z, &water) ? water : ground_z + 1.f;
+			return true;
+		}
+
+		return m_Attempts >= MAX_ATTEMPTS;
+	}
+
+	bool ScriptLoaded::await_ready()
+	{
+		m_Loaded = SCRIPTS::HAS_SCRIPT_WITH_NAME_HASH_LOADED(m_Script);
+		if (!m_Loaded)
+			SCRIPTS::REQUEST_SCRIPT_WITH_NAME_HASH(m_Script);
+		return m_Loaded;
+	}
+
+	bool ScriptLoaded::Poll()
+	{
+		m_Loaded = SCRIPTS::HAS_SCRIPT_WITH_NAME_HASH_LOADED(m_Script);
+		if (m_Loaded || --m_TicksLeft < 0)
+			return true;
+
+		SCRIPTS::REQUEST_SCRIPT_WITH_NAME_HASH(m_Script);
+		return false;
+	}
+}
@@ -0,0 +1,251 @@
+#pragma once
+#include "Streaming.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <optional>
+#include <rage/vector.hpp>
+#include <utility>
+
+namespace YimMenu
+{
+	// A coroutine run by ScriptMgr on the game thread. Unlike a Script it has no fiber and stack of its own, only a
+	// coroutine frame, so hundreds of them can wait on models or timers at once. Once a tick ScriptMgr asks what every
+	// task waits for and resumes the ones that are ready
+	//
+	//	ScriptMgr::AddTask([](Hash model) -> ScriptTask {
+	//		if (!co_await ModelLoaded(model))
+	//			co_return;
+	//		...
+	//	}(model));
+	class ScriptTask
+	{
+	public:
+		struct promise_type
+		{
+			bool (*m_Poll)(void*) = nullptr; // what the task waits for, checked with m_Awaitable
+			void* m_Awaitable     = nullptr;
+
+			ScriptTask get_return_object()
+			{
+				return ScriptTask(std::coroutine_handle<promise_type>::from_promise(*this));
+			}
+
+			// tasks only start once ScriptMgr has them
+			std::suspend_always initial_suspend() noexcept
+			{
+				return {};
+			}
+
+			std::suspend_always final_suspend() noexcept
+			{
+				return {};
+			}
+
+			void return_void()
+			{
+			}
+
+			void unhandled_exception();
+		};
+
+	private:
+		std::coroutine_handle<promise_type> m_Handle;
+
+		explicit ScriptTask(std::coroutine_handle<promise_type> handle) :
+		    m_Handle(handle)
+		{
+		}
+
+	public:
+		ScriptTask(ScriptTask&& that) noexcept :
+		    m_Handle(std::exchange(that.m_Handle, nullptr))
+		{
+		}
+
+		ScriptTask& operator=(ScriptTask&& that) noexcept
+		{
+			if (this != &that)
+			{
+				if (m_Handle)
+					m_Handle.destroy();
+				m_Handle = std::exchange(that.m_Handle, nullptr);
+			}
+			return *this;
+		}
+
+		ScriptTask(const ScriptTask&)            = delete;
+		ScriptTask& operator=(const ScriptTask&) = delete;
+
+		~ScriptTask()
+		{
+			if (m_Handle)
+				m_Handle.destroy();
+		}
+
+		bool IsDone() const
+		{
+			return !m_Handle || m_Handle.done();
+		}
+
+		// resumes the task if what it waits for is ready. returns false once it has finished
+		bool Tick();
+	};
+
+	// everything a task can co_await. the derived type has await_ready, await_resume and a Poll that's called once a tick
+	// while the task is suspended
+	template<typename T>
+	struct ScriptAwaitable
+	{
+		void await_suspend(std::coroutine_handle<ScriptTask::promise_type> handle)
+		{
+			handle.promise().m_Awaitable = static_cast<T*>(this);
+			handle.promise().m_Poll      = [](void* awaitable) {
+				return static_cast<T*>(awaitable)->Poll();
+			};
+		}
+	};
+
+	// resumes on the next tick
+	struct NextFrame : ScriptAwaitable<NextFrame>
+	{
+		bool await_ready() const
+		{
+			return false;
+		}
+
+		bool Poll() const
+		{
+			return true;
+		}
+
+		void await_resume() const
+		{
+		}
+	};
+
+	struct Sleep : ScriptAwaitable<Sleep>
+	{
+		std::chrono::high_resolution_clock::time_point m_WakeTime;
+
+		explicit Sleep(std::chrono::high_resolution_clock::duration time) :
+		    m_WakeTime(std::chrono::high_resolution_clock::now() + time)
+		{
+		}
+
+		bool await_ready() const
+		{
+			return Poll();
+		}
+
+		bool Poll() const
+		{
+			return std::chrono::high_resolution_clock::now() >= m_WakeTime;
+		}
+
+		void await_resume() const
+		{
+		}
+	};
+
+	// resumes once the condition holds, it's checked once a tick
+	template<typename F>
+	struct Until : ScriptAwaitable<Until<F>>
+	{
+		F m_Condition;
+
+		explicit Until(F condition) :
+		    m_Condition(std::move(condition))
+		{
+		}
+
+		bool await_ready()
+		{
+			return Poll();
+		}
+
+		bool Poll()
+		{
+			return m_Condition();
+		}
+
+		void await_resume() const
+		{
+		}
+	};
+
+	// holds a request for the model until the await is over, so it stays cached a while after. gives false if it
+	// doesn't exist or didn't load in time
+	struct ModelLoaded : ScriptAwaitable<ModelLoaded>
+	{
+		std::uint32_t m_Model;
+		int m_TicksLeft;
+		bool m_Loaded = false;
+		ModelRequest m_Request;
+
+		explicit ModelLoaded(std::uint32_t model, int max_ticks = 30) :
+		    m_Model(model),
+		    m_TicksLeft(max_ticks)
+		{
+		}
+
+		bool await_ready();
+		bool Poll();
+
+		bool await_resume() const
+		{
+			return m_Loaded;
+		}
+	};
+
+	// looks for the ground below the coords every tick, requesting collision there and moving the probe up every 10
+	// ticks. gives the height to put an entity at, on the water if there is any, or nothing if no ground was found
+	struct GroundZ : ScriptAwaitable<GroundZ>
+	{
+		static constexpr int MAX_ATTEMPTS = 300;
+
+		rage::fvector3 m_Location;
+		int m_Attempts = 0;
+		std::optional<float> m_Z;
+
+		explicit GroundZ(const rage::fvector3& location) :
+		    m_Location(location)
+		{
+		}
+
+		bool await_ready()
+		{
+			return Poll();
+		}
+
+		bool Poll();
+
+		std::optional<float> await_resume() const
+		{
+			return m_Z;
+		}
+	};
+
+	// requests the script every tick until it has loaded. gives false if it didn't load in time
+	struct ScriptLoaded : ScriptAwaitable<ScriptLoaded>
+	{
+		std::uint32_t m_Script;
+		int m_TicksLeft;
+		bool m_Loaded = false;
+
+		explicit ScriptLoaded(std::uint32_t script, int max_ticks = 150) :
+		    m_Script(script),
+		    m_TicksLeft(max_ticks)
+		{
+		}
+
+		bool await_ready();
+		bool Poll();
+
+		bool await_resume() const
+		{
+			return m_Loaded;
+		}
+	};
+}
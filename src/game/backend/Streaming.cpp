@@ -0,0 +1,177 @@
+#include "Streaming.hpp"
+
+#include "game/backend/ScriptMgr.hpp"
+#include "game/rdr/Natives.hpp"
+
+#include <cmath>
+
+namespace YimMenu
+{
+	static constexpr float COLLISION_CELL_SIZE = 50.f;
+
+	void Streaming::Update()
+	{
+		while (true)
+		{
+			GetInstance().Tick();
+			ScriptMgr::Yield();
+		}
+	}
+
+	bool Streaming::AcquireImpl(joaat_t model)
+	{
+		auto it = m_Models.find(model);
+		if (it == m_Models.end())
+		{
+			if (!STREAMING::IS_MODEL_IN_CDIMAGE(model))
+				return false;
+
+			it = m_Models.emplace(model, Model{}).first;
+			m_Pending.push_back(model);
+		}
+		else
+		{
+			m_Shared++;
+		}
+
+		auto& entry = it->second;
+		if (entry.m_Refs++ == 0 && entry.m_Loaded)
+			m_Unused.erase(entry.m_Unused);
+
+		// ask right away if there's budget left, so models that are already resident are ready without waiting a frame
+		if (!entry.m_Requested && m_FrameRequests < REQUESTS_PER_FRAME)
+			Request(model, entry);
+
+		return true;
+	}
+
+	void Streaming::ReleaseImpl(joaat_t model)
+	{
+		auto it = m_Models.find(model);
+		if (it == m_Models.end() || it->second.m_Refs == 0)
+		{
+			LOG(WARNING) << "Streaming: released model " << HEX(model) << " that wasn't acquired";
+			return;
+		}
+
+		auto& entry = it->second;
+		if (--entry.m_Refs)
+			return;
+
+		// nobody wanted it before it loaded, no point in keeping it around
+		if (!IsLoadedImpl(model))
+		{
+			Unload(model);
+			return;
+		}
+
+		entry.m_ReleaseTime = std::chrono::steady_clock::now();
+		entry.m_Unused      = m_Unused.insert(m_Unused.end(), model);
+	}
+
+	bool Streaming::IsLoadedImpl(joaat_t model)
+	{
+		auto it = m_Models.find(model);
+		if (it == m_Models.end())
+			return false;
+
+		auto& entry = it->second;
+		if (!entry.m_Loaded && entry.m_Requested && STREAMING::HAS_MODEL_LOADED(model))
+		{
+			entry.m_Loaded = true;
+			std::erase(m_Pending, model);
+		}
+
+		return entry.m_Loaded;
+	}
+
+	void Streaming::RequestCollisionImpl(const rage::fvector3& coords)
+	{
+		auto x = static_cast<std::int32_t>(std::floor(coords.x / COLLISION_CELL_SIZE));
+		auto y = static_cast<std::int32_t>(std::floor(coords.y / COLLISION_CELL_SIZE));
+		auto [it, inserted] = m_Collisions.try_emplace((static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y), m_Frame);
+		if (!inserted && m_Frame - it->second < COLLISION_FRAMES)
+			return;
+
+		it->second = m_Frame;
+		STREAMING::REQUEST_COLLISION_AT_COORD(coords.x, coords.y, coords.z);
+	}
+
+	Streaming::Stats Streaming::GetStatsImpl() const
+	{
+		std::lock_guard lock(m_StatsMutex);
+		return m_Stats;
+	}
+
+	void Streaming::Request(joaat_t model, Model& entry)
+	{
+		STREAMING::REQUEST_MODEL(model, false);
+		entry.m_Requested   = true;
+		entry.m_LastRequest = m_Frame;
+		m_FrameRequests++;
+		m_Requests++;
+	}
+
+	void Streaming::Unload(joaat_t model)
+	{
+		if (m_Models[model].m_Requested)
+			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
+
+		std::erase(m_Pending, model);
+		m_Models.erase(model);
+		m_Released++;
+	}
+
+	void Streaming::Tick()
+	{
+		m_Frame++;
+		m_FrameRequests = 0;
+		std::erase_if(m_Collisions, [this](const auto& cell) {
+			return m_Frame - cell.second >= COLLISION_FRAMES;
+		});
+
+		// oldest first, so a bulk spawn is streamed in the order it was asked for
+		std::erase_if(m_Pending, [this](joaat_t model) {
+			auto& entry = m_Models[model];
+			if (entry.m_Requested && STREAMING::HAS_MODEL_LOADED(model))
+			{
+				entry.m_Loaded = true;
+				return true;
+			}
+
+			if (m_FrameRequests < REQUESTS_PER_FRAME && (!entry.m_Requested || m_Frame - entry.m_LastRequest >= REREQUEST_FRAMES))
+				Request(model, entry);
+			return false;
+		});
+
+		auto now = std::chrono::steady_clock::now();
+		while (!m_Unused.empty())
+		{
+			auto model = m_Unused.front();
+			if (m_Unused.size() <= MAX_CACHED && now - m_Models[model].m_ReleaseTime < CACHE_TIME)
+				break;
+
+			m_Unused.pop_front();
+			Unload(model);
+		}
+
+		std::lock_guard lock(m_StatsMutex);
+		m_Stats = {m_Models.size(), m_Pending.size(), m_Unused.size(), m_Requests, m_Shared, m_Released};
+	}
+
+	bool ModelRequest::Wait(int max_ticks) const
+	{
+		if (!IsValid())
+			return false;
+
+		for (int i = 0; !IsLoaded(); i++)
+		{
+			if (i > max_ticks)
+				return false;
+
+			ScriptMgr::Yield();
+		}
+
+		return true;
+	}
+}
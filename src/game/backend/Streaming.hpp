@@ -0,0 +1,175 @@
+#pragma once
+#include "util/Joaat.hpp"
+
+#include <list>
+#include <mutex>
+#include <rage/vector.hpp>
+#include <unordered_map>
+#include <utility>
+
+namespace YimMenu
+{
+	// Every model the menu streams in goes through here. Features that want the same model share one request, at most
+	// REQUESTS_PER_FRAME requests reach the game a frame so bulk spawns don't flood it, and a model nobody holds anymore
+	// stays loaded for a while in case it's spawned again before it's released, oldest first. Game thread only
+	class Streaming
+	{
+	public:
+		static constexpr std::size_t REQUESTS_PER_FRAME = 8;
+		static constexpr std::uint32_t REREQUEST_FRAMES = 10; // a model that's still loading is requested again after this
+		static constexpr std::uint32_t COLLISION_FRAMES = 60; // and collision for an area
+		static constexpr std::size_t MAX_CACHED         = 32;
+		static constexpr std::chrono::seconds CACHE_TIME{10};
+
+		struct Stats
+		{
+			std::size_t m_Models;
+			std::size_t m_Pending;
+			std::size_t m_Cached;
+			std::uint64_t m_Requests; // sent to the game
+			std::uint64_t m_Shared;   // served by a request that was already there
+			std::uint64_t m_Released;
+		};
+
+	private:
+		struct Model
+		{
+			std::uint32_t m_Refs        = 0;
+			bool m_Loaded               = false;
+			bool m_Requested            = false;
+			std::uint32_t m_LastRequest = 0; // frame
+			std::chrono::steady_clock::time_point m_ReleaseTime;
+			std::list<joaat_t>::iterator m_Unused; // valid while m_Refs is zero
+		};
+
+		std::unordered_map<joaat_t, Model> m_Models;
+		std::vector<joaat_t> m_Pending; // held and not loaded yet, in the order they were asked for
+		std::list<joaat_t> m_Unused;    // loaded and not held, least recently released first
+		std::unordered_map<std::uint64_t, std::uint32_t> m_Collisions; // cell to the frame collision was requested for it
+		std::uint32_t m_Frame       = 0;
+		std::size_t m_FrameRequests = 0;
+
+		std::uint64_t m_Requests = 0;
+		std::uint64_t m_Shared   = 0;
+		std::uint64_t m_Released = 0;
+
+		mutable std::mutex m_StatsMutex;
+		Stats m_Stats{}; // copied out once a frame for the ui
+
+	public:
+		// takes a reference to the model and queues it. false if the game doesn't know the model
+		static bool Acquire(joaat_t model)
+		{
+			return GetInstance().AcquireImpl(model);
+		}
+
+		// drops a reference taken by Acquire
+		static void Release(joaat_t model)
+		{
+			GetInstance().ReleaseImpl(model);
+		}
+
+		static bool IsLoaded(joaat_t model)
+		{
+			return GetInstance().IsLoadedImpl(model);
+		}
+
+		// requests collision around the coords. calls for the same area within COLLISION_FRAMES are merged
+		static void RequestCollision(const rage::fvector3& coords)
+		{
+			GetInstance().RequestCollisionImpl(coords);
+		}
+
+		// as of the last frame, safe to call from any thread
+		static Stats GetStats()
+		{
+			return GetInstance().GetStatsImpl();
+		}
+
+		// sends the queued requests and releases old models, runs as a script
+		static void Update();
+
+	private:
+		static Streaming& GetInstance()
+		{
+			static Streaming Instance;
+			return Instance;
+		}
+
+		bool AcquireImpl(joaat_t model);
+		void ReleaseImpl(joaat_t model);
+		bool IsLoadedImpl(joaat_t model);
+		void RequestCollisionImpl(const rage::fvector3& coords);
+		Stats GetStatsImpl() const;
+		void Request(joaat_t model, Model& entry);
+		void Unload(joaat_t model);
+		void Tick();
+	};
+
+	// A reference to a model that's released when it goes out of scope
+	//
+	//	ModelRequest request(model);
+	//	if (!request.Wait())
+	//		return;
+	//	... create the entity
+	class ModelRequest
+	{
+		joaat_t m_Model = 0;
+
+	public:
+		ModelRequest() = default;
+
+		explicit ModelRequest(joaat_t model) :
+		    m_Model(Streaming::Acquire(model) ? model : 0)
+		{
+		}
+
+		~ModelRequest()
+		{
+			Reset();
+		}
+
+		ModelRequest(ModelRequest&& that) noexcept :
+		    m_Model(std::exchange(that.m_Model, 0))
+		{
+		}
+
+		ModelRequest& operator=(ModelRequest&& that) noexcept
+		{
+			if (this != &that)
+			{
+				Reset();
+				m_Model = std::exchange(that.m_Model, 0);
+			}
+			return *this;
+		}
+
+		ModelRequest(const ModelRequest&)            = delete;
+		ModelRequest& operator=(const ModelRequest&) = delete;
+
+		// false if the game doesn't know the model
+		bool IsValid() const
+		{
+			return m_Model != 0;
+		}
+
+		bool IsLoaded() const
+		{
+			return IsValid() && Streaming::IsLoaded(m_Model);
+		}
+
+		bool IsFor(joaat_t model) const
+		{
+			return m_Model == model;
+		}
+
+		// yields until the model has loaded, fiber only. false if it didn't load in time
+		bool Wait(int max_ticks = 30) const;
+
+		void Reset()
+		{
+			if (m_Model)
+				Streaming::Release(std::exchange(m_Model, 0));
+		}
+	};
+}
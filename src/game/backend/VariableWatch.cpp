@@ -0,0 +1,202 @@
+#include "VariableWatch.hpp"
+
+#include "core/commands/BoolCommand.hpp"
+#include "core/commands/IntCommand.hpp"
+#include "game/backend/ScriptMgr.hpp"
+
+#include <bit>
+#include <script/scrThread.hpp>
+
+namespace YimMenu::Features
+{
+	BoolCommand _WatchVariables("watchvariables", "Watch Variables", "Samples every saved global and local and records when they change");
+	IntCommand _WatchRate("watchrate", "Watch Rate", "How many times per second the watched variables are sampled", 1, 144, 30);
+}
+
+namespace YimMenu
+{
+	void VariableWatch::Update()
+	{
+		while (true)
+		{
+			if (Features::_WatchVariables.GetState())
+				GetInstance().Sample();
+
+			ScriptMgr::Yield(std::chrono::milliseconds(1000 / std::max(Features::_WatchRate.GetState(), 1)));
+		}
+	}
+
+	std::string VariableWatch::Format(VariableType type, std::uint64_t value)
+	{
+		if (value == INVALID)
+			return "Invalid";
+
+		auto bits = static_cast<std::uint32_t>(value);
+		switch (type)
+		{
+		case VariableType::INT: return std::to_string(static_cast<std::int32_t>(bits));
+		case VariableType::FLOAT: return std::to_string(std::bit_cast<float>(bits));
+		case VariableType::BOOL: return bits ? "True" : "False";
+		}
+
+		return "";
+	}
+
+	void VariableWatch::SetVariablesImpl(const std::vector<SavedGlobal>& globals, const std::vector<SavedLocal>& locals)
+	{
+		m_Watches.clear();
+		for (auto& global : globals)
+			m_Watches.push_back({global.name, global.type, std::nullopt});
+		for (auto& local : locals)
+			m_Watches.push_back({local.name, local.type, local.script});
+
+		ClearHistoryImpl();
+
+		std::lock_guard lock(m_PendingMutex);
+		m_Pending.emplace(globals, locals);
+		m_PendingVersion++;
+	}
+
+	void VariableWatch::PollImpl()
+	{
+		m_Dropped += m_Changes.TakeDropped();
+
+		auto version = m_PendingVersion;
+		while (m_Changes.Consume([this, version](Change& change) {
+			// sampled before the list was replaced
+			if (change.m_Version != version || change.m_Watch >= m_Watches.size())
+				return;
+
+			auto& watch     = m_Watches[change.m_Watch];
+			watch.m_Value   = change.m_Value;
+			watch.m_Changed = change.m_Time;
+			watch.m_Changes++;
+
+			if (m_History.size() < HISTORY_SIZE)
+			{
+				m_History.push_back(change);
+			}
+			else
+			{
+				m_History[m_HistoryStart] = change;
+				m_HistoryStart            = (m_HistoryStart + 1) % HISTORY_SIZE;
+			}
+		}))
+			;
+	}
+
+	void VariableWatch::ClearHistoryImpl()
+	{
+		m_History.clear();
+		m_HistoryStart = 0;
+		m_Dropped      = 0;
+	}
+
+	// quoted when it contains anything that would split or end the field, with quotes doubled (RFC 4180)
+	static std::string CsvField(std::string_view text)
+	{
+		if (text.find_first_of(",\"\r\n") == std::string_view::npos)
+			return std::string(text);
+
+		std::string field = "\"";
+		for (auto c : text)
+		{
+			if (c == '"')
+				field += '"';
+			field += c;
+		}
+		field += '"';
+		return field;
+	}
+
+	bool VariableWatch::ExportImpl(const std::filesystem::path& path)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::trunc);
+		if (!file)
+			return false;
+
+		file << "time_ms,name,script,value\n";
+		if (m_History.empty())
+			return true;
+
+		auto start = GetHistory(0).m_Time;
+		for (std::size_t i = 0; i < m_History.size(); i++)
+		{
+			auto& change = GetHistory(i);
+			auto& watch  = m_Watches[change.m_Watch];
+
+			file << std::chrono::duration_cast<std::chrono::milliseconds>(change.m_Time - start).count() << ','
+			     << CsvField(watch.m_Name) << ',' << CsvField(watch.m_Script ? Scripts::GetScriptName(watch.m_Script->m_Hash) : "") << ','
+			     << CsvField(Format(watch.m_Type, change.m_Value)) << '\n';
+		}
+
+		return true;
+	}
+
+	void VariableWatch::Compile()
+	{
+		auto count = m_Globals.size() + m_Locals.size();
+		m_Addresses.resize(count);
+		m_Threads.resize(count);
+		m_ThreadIds.resize(count);
+
+		for (std::size_t i = 0; i < m_Globals.size(); i++)
+		{
+			m_Addresses[i] = static_cast<const std::uint32_t*>(m_Globals[i].Read());
+			m_Threads[i]   = nullptr;
+		}
+
+		auto is_mp   = Scripts::UsingMPScripts();
+		m_CompiledMp = is_mp;
+		for (std::size_t i = 0; i < m_Locals.size(); i++)
+		{
+			auto& local = m_Locals[i];
+			auto index  = m_Globals.size() + i;
+			auto thread = local.script.m_IsMp == is_mp ? Scripts::FindScriptThread(local.script.m_Hash) : nullptr;
+
+			m_Addresses[index] = static_cast<const std::uint32_t*>(local.Read(thread));
+			m_Threads[index]   = thread;
+			m_ThreadIds[index] = thread ? thread->m_Context.m_ThreadId : 0;
+		}
+
+		// offsets with a player id in them and scripts that weren't running are picked up on the next compile
+		m_NextCompile = std::chrono::steady_clock::now() + RECOMPILE_INTERVAL;
+	}
+
+	void VariableWatch::Sample()
+	{
+		{
+			std::lock_guard lock(m_PendingMutex);
+			if (m_Pending)
+			{
+				std::tie(m_Globals, m_Locals) = std::move(*m_Pending);
+				m_Pending.reset();
+				m_Version = m_PendingVersion;
+				m_Last.assign(m_Globals.size() + m_Locals.size(), INVALID);
+				m_NextCompile = {};
+			}
+		}
+
+		// switching between story mode and online replaces every script, which can't wait for the next compile
+		auto now = std::chrono::steady_clock::now();
+		if (now >= m_NextCompile || Scripts::UsingMPScripts() != m_CompiledMp)
+			Compile();
+
+		for (std::size_t i = 0; i < m_Addresses.size(); i++)
+		{
+			// a thread that was killed or replaced takes its stack with it
+			if (auto thread = m_Threads[i]; thread && (thread->m_Context.m_ThreadId != m_ThreadIds[i] || thread->m_Context.m_State == rage::eThreadState::killed))
+			{
+				m_Addresses[i] = nullptr;
+				m_Threads[i]   = nullptr;
+			}
+
+			auto value = m_Addresses[i] ? *m_Addresses[i] : INVALID;
+			if (value == m_Last[i])
+				continue;
+
+			m_Last[i] = value;
+			m_Changes.Push({m_Version, static_cast<std::uint32_t>(i), value, now});
+		}
+	}
+}
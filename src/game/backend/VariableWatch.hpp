@@ -0,0 +1,131 @@
+#pragma once
+#include "SavedVariables.hpp"
+#include "core/misc/BoundedQueue.hpp"
+
+namespace rage
+{
+	class scrThread;
+}
+
+namespace YimMenu
+{
+	// Samples the saved globals and locals on the game thread and tells the UI which of them changed. The variables are
+	// resolved to addresses once and then read in a single pass, so watching hundreds of them costs a load and a compare
+	// each per sample, and the UI only looks at its own copy of the values and the history of changes
+	class VariableWatch
+	{
+	public:
+		static constexpr std::uint64_t INVALID   = ~0ull; // the variable couldn't be read
+		static constexpr std::size_t HISTORY_SIZE = 8192;
+		static constexpr auto RECOMPILE_INTERVAL  = std::chrono::seconds(1);
+
+		struct Watch
+		{
+			std::string m_Name;
+			VariableType m_Type;
+			std::optional<ScriptIdentifier> m_Script; // globals don't have one
+			std::uint64_t m_Value = INVALID;
+			std::chrono::steady_clock::time_point m_Changed{};
+			std::uint32_t m_Changes = 0;
+		};
+
+		struct Change
+		{
+			std::uint32_t m_Version; // of the variable list the change was sampled with
+			std::uint32_t m_Watch;
+			std::uint64_t m_Value;
+			std::chrono::steady_clock::time_point m_Time;
+		};
+
+	private:
+		// owned by the game thread
+		std::vector<SavedGlobal> m_Globals;
+		std::vector<SavedLocal> m_Locals;
+		std::vector<const std::uint32_t*> m_Addresses; // globals first, then locals
+		std::vector<rage::scrThread*> m_Threads;
+		std::vector<std::uint32_t> m_ThreadIds;
+		std::vector<std::uint64_t> m_Last;
+		std::chrono::steady_clock::time_point m_NextCompile{};
+		bool m_CompiledMp = false;
+		std::uint32_t m_Version = 0;
+
+		// handed from the UI to the game thread
+		std::mutex m_PendingMutex;
+		std::optional<std::pair<std::vector<SavedGlobal>, std::vector<SavedLocal>>> m_Pending;
+		std::uint32_t m_PendingVersion = 0;
+
+		BoundedQueue<Change, 4096> m_Changes;
+
+		// owned by the UI
+		std::vector<Watch> m_Watches;
+		std::vector<Change> m_History; // ring of the last HISTORY_SIZE changes
+		std::size_t m_HistoryStart = 0;
+		std::uint32_t m_Dropped    = 0;
+
+	public:
+		// samples the variables on the game thread, runs as a script
+		static void Update();
+
+		// replaces the variables being watched
+		static void SetVariables(const std::vector<SavedGlobal>& globals, const std::vector<SavedLocal>& locals)
+		{
+			GetInstance().SetVariablesImpl(globals, locals);
+		}
+
+		// picks up the changes sampled since the last call, render thread only. runs every frame as a renderer callback
+		static void Poll()
+		{
+			GetInstance().PollImpl();
+		}
+
+		static const std::vector<Watch>& GetWatches()
+		{
+			return GetInstance().m_Watches;
+		}
+
+		static std::size_t GetHistorySize()
+		{
+			return GetInstance().m_History.size();
+		}
+
+		// oldest first
+		static const Change& GetHistory(std::size_t index)
+		{
+			auto& watch = GetInstance();
+			return watch.m_History[(watch.m_HistoryStart + index) % watch.m_History.size()];
+		}
+
+		static std::uint32_t GetDropped()
+		{
+			return GetInstance().m_Dropped;
+		}
+
+		static void ClearHistory()
+		{
+			GetInstance().ClearHistoryImpl();
+		}
+
+		// writes the history as csv
+		static bool Export(const std::filesystem::path& path)
+		{
+			return GetInstance().ExportImpl(path);
+		}
+
+		static std::string Format(VariableType type, std::uint64_t value);
+
+	private:
+		static VariableWatch& GetInstance()
+		{
+			static VariableWatch Instance;
+			return Instance;
+		}
+
+		void SetVariablesImpl(const std::vector<SavedGlobal>& globals, const std::vector<SavedLocal>& locals);
+		void PollImpl();
+		void ClearHistoryImpl();
+		bool ExportImpl(const std::filesystem::path& path);
+
+		void Compile();
+		void Sample();
+	};
+}
@@ -1,5 +1,6 @@
 #include "core/frontend/Notifications.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/Streaming.hpp"
 #include "game/commands/PlayerCommand.hpp"
 #include "game/rdr/Natives.hpp"
 #include "util/Rewards.hpp"
@@ -23,23 +24,17 @@ namespace YimMenu::Features
 			auto rewardModel = "mp001_s_mp_boxsm01x"_J;
 			float heading    = ENTITY::GET_ENTITY_HEADING(player.GetPed().GetHandle());
 
-			for (uint8_t i = 0; !STREAMING::HAS_MODEL_LOADED(chestModel) && i < 100; i++)
-			{
-				STREAMING::REQUEST_MODEL(chestModel, 1);
-				ScriptMgr::Yield();
-			}
-			if (!STREAMING::HAS_MODEL_LOADED(chestModel))
+			// both are requested before waiting on either, so they stream in together
+			ModelRequest chestRequest(chestModel);
+			ModelRequest rewardRequest(rewardModel);
+
+			if (!chestRequest.Wait(100))
 			{
 				Notifications::Show("Treasure Spawner", "Failed to load chest model", NotificationType::Error);
 				return;
 			}
 
-			for (uint8_t i = 0; !STREAMING::HAS_MODEL_LOADED(rewardModel) && i < 100; i++)
-			{
-				STREAMING::REQUEST_MODEL(rewardModel, 1);
-				ScriptMgr::Yield();
-			}
-			if (!STREAMING::HAS_MODEL_LOADED(rewardModel))
+			if (!rewardRequest.Wait(100))
 			{
 				std::string msg = std::format("Failed to load reward model", rewardModel);
 				Notifications::Show("Treasure Spawner", msg, NotificationType::Error);
@@ -68,9 +63,6 @@ namespace YimMenu::Features
 			}
 
 			ScriptMgr::Yield(50ms);
-
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(chestModel);
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(rewardModel);
 		}
 	};
 
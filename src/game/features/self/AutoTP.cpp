@@ -10,12 +10,13 @@ namespace YimMenu::Features
 
 		virtual void OnTick() override
 		{
-			if (MAP::IS_WAYPOINT_ACTIVE() && Self::GetPed())
+			// the ground can take seconds to load, waiting on it here would hold up every other looped command
+			if (MAP::IS_WAYPOINT_ACTIVE() && Self::GetPed() && !Teleport::IsTeleportPending(Self::GetPed().GetHandle()))
 			{
 				Vector3 coords = Teleport::GetWaypointCoords();
 				if (coords != Vector3{0, 0, 0})
 				{
-					Teleport::TeleportEntity(Self::GetPed().GetHandle(), rage::fvector3{coords.x, coords.y, coords.z}, true);
+					Teleport::TeleportEntityAsync(Self::GetPed().GetHandle(), rage::fvector3{coords.x, coords.y, coords.z});
 				}
 			}
 		}
@@ -1,6 +1,6 @@
 #include "core/commands/Command.hpp"
+#include "game/backend/EntityIndex.hpp"
 #include "game/backend/Self.hpp"
-#include "game/rdr/Pools.hpp"
 
 namespace YimMenu::Features
 {
@@ -11,14 +11,17 @@ namespace YimMenu::Features
 		virtual void OnCall() override
 		{
 			auto pos = Self::GetPed().GetPosition();
-			for (auto obj : Pools::GetObjects())
+			std::vector<EntityIndex::Item> objects;
+			EntityIndex::GetAll(EntityIndex::OBJECT, objects);
+			for (auto& item : objects)
 			{
-				if (obj)
+				if (auto obj = item.m_Entity)
 				{
 					obj.ForceControl();
 					obj.SetPosition(pos);
 				}
 			}
+			EntityIndex::Invalidate();
 		}
 	};
 
@@ -29,14 +32,17 @@ namespace YimMenu::Features
 		virtual void OnCall() override
 		{
 			auto pos = Self::GetPed().GetPosition();
-			for (auto ped : Pools::GetPeds())
+			std::vector<EntityIndex::Item> peds;
+			EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
-				if (!ped.IsPlayer())
-				{
-					ped.ForceControl();
-					ped.SetPosition(pos);
-				}
+				if (item.m_Entity.IsPlayer())
+					continue;
+
+				item.m_Entity.ForceControl();
+				item.m_Entity.SetPosition(pos);
 			}
+			EntityIndex::Invalidate();
 		}
 	};
 
@@ -47,11 +53,14 @@ namespace YimMenu::Features
 		virtual void OnCall() override
 		{
 			auto pos = Self::GetPed().GetPosition();
-			for (auto veh : Pools::GetVehicles())
+			std::vector<EntityIndex::Item> vehicles;
+			EntityIndex::GetAll(EntityIndex::VEHICLE, vehicles);
+			for (auto& item : vehicles)
 			{
-				veh.ForceControl();
-				veh.SetPosition(pos);
+				item.m_Entity.ForceControl();
+				item.m_Entity.SetPosition(pos);
 			}
+			EntityIndex::Invalidate();
 		}
 	};
 
@@ -1,5 +1,5 @@
 #include "core/commands/Command.hpp"
-#include "game/rdr/Pools.hpp"
+#include "game/backend/EntityIndex.hpp"
 #include "game/rdr/Entity.hpp"
 #include "game/rdr/Network.hpp"
 #include <network/netObject.hpp>
@@ -14,15 +14,18 @@ namespace YimMenu::Features
 
 		virtual void OnCall() override
 		{
-			for (auto obj : Pools::GetObjects())
+			std::vector<EntityIndex::Item> objects;
+			EntityIndex::GetAll(EntityIndex::OBJECT, objects);
+			for (auto& item : objects)
 			{
-				if (obj)
+				if (auto obj = item.m_Entity)
 				{
 					if (obj.HasControl())
 						obj.ForceSync();
 					obj.Delete();
 				}
 			}
+			EntityIndex::Invalidate();
 		}
 	};
 
@@ -33,8 +36,11 @@ namespace YimMenu::Features
 		virtual void OnCall() override
 		{
 			// pass 1: fast path (delete what we own or can immediately own)
-			for (auto ped : Pools::GetPeds())
+			std::vector<EntityIndex::Item> peds;
+			EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
+				auto ped = item.m_Entity;
 				if (!ped.IsPlayer())
 				{
 					ped.ForceControl();
@@ -45,14 +51,16 @@ namespace YimMenu::Features
 					}
 				}
 			}
+			EntityIndex::Invalidate();
 
 			// pass 2: yield a moment to let ownership changes propagate and stragglers sync
 			ScriptMgr::Yield(50ms);
 
 			// pass 3: handle stubborn networked peds by sending explicit remove to all tokens
-			for (auto ped : Pools::GetPeds())
+			EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
-				if (!ped.IsPlayer() && ped.IsNetworked())
+				if (auto ped = item.m_Entity; ped && !ped.IsPlayer() && ped.IsNetworked())
 				{
 					if (ped.HasControl())
 					{
@@ -77,6 +85,8 @@ namespace YimMenu::Features
 				}
 			}
 
+			EntityIndex::Invalidate();
+
 			// final small wait to flush removals
 			ScriptMgr::Yield(20ms);
 		}
@@ -88,9 +98,11 @@ namespace YimMenu::Features
 
 		virtual void OnCall() override
 		{
-			for (auto veh : Pools::GetVehicles())
+			std::vector<EntityIndex::Item> vehicles;
+			EntityIndex::GetAll(EntityIndex::VEHICLE, vehicles);
+			for (auto& item : vehicles)
 			{
-				if (veh)
+				if (auto veh = item.m_Entity)
 				{
 					veh.ForceControl();
 					if (veh.HasControl())
@@ -106,6 +118,7 @@ namespace YimMenu::Features
 					}
 				}
 			}
+			EntityIndex::Invalidate();
 			ScriptMgr::Yield(20ms);
 		}
 	};
@@ -1,5 +1,5 @@
 #include "core/commands/Command.hpp"
-#include "game/rdr/Pools.hpp"
+#include "game/backend/EntityIndex.hpp"
 
 namespace YimMenu::Features
 {
@@ -9,10 +9,13 @@ namespace YimMenu::Features
 
 		virtual void OnCall() override
 		{
-			for (auto ped : Pools::GetPeds())
+			// the index already leaves out player peds, a stale entry mustn't slip through either
+			std::vector<EntityIndex::Item> peds;
+			EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
-				if (!ped.IsPlayer())
-					ped.Kill();
+				if (!item.m_Entity.IsPlayer())
+					item.m_Entity.Kill();
 			}
 		}
 	};
@@ -1,5 +1,6 @@
 #include "core/commands/Command.hpp"
-#include "game/rdr/Pools.hpp"
+#include "game/backend/EntityIndex.hpp"
+#include "game/rdr/Ped.hpp"
 
 namespace YimMenu::Features
 {
@@ -9,8 +10,11 @@ namespace YimMenu::Features
 
 		virtual void OnCall() override
 		{
-			for (auto ped : Pools::GetPeds())
+			std::vector<EntityIndex::Item> peds;
+			EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
+				auto ped = item.m_Entity.As<Ped>();
 				if (!ped.IsPlayer() && ped.IsEnemy())
 					ped.Kill();
 			}
@@ -2,6 +2,7 @@
 
 #include "Menu.hpp"
 #include "core/logger/LogHelper.hpp"
+#include "core/renderer/Renderer.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "core/frontend/widgets/imgui_colors.h"
@@ -30,11 +31,22 @@ namespace YimMenu
 		}
 
 		m_Messages.push_back(notification);
+		m_Changed = true;
 	}
 
 	void ChatDisplay::DrawImpl()
 	{
-		std::lock_guard<std::mutex> lock(m_Mutex);
+		// new messages are picked up on refresh frames only, so an over budget renderer doesn't wait on the lock
+		if (Renderer::IsRefreshFrame())
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (m_Changed)
+			{
+				m_Shown   = m_Messages;
+				m_Changed = false;
+			}
+		}
+
 		int position = 0;
 
 		static const float y_pos = position * 100 + 200;
@@ -47,7 +59,7 @@ namespace YimMenu
 
 		ImGui::Begin("##chatwin", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoInputs);
 
-		for (auto& message : m_Messages)
+		for (auto& message : m_Shown)
 		{
 			ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(ImGui::Colors::Blue));
 			ImGui::TextWrapped("%s:", message.m_Sender.data());
@@ -63,6 +75,8 @@ namespace YimMenu
 
 	void ChatDisplay::ClearImpl()
 	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
 		m_Messages.clear();
+		m_Changed = true;
 	}
 }
\ No newline at end of file
@@ -18,6 +18,9 @@ namespace YimMenu
 	private:
 		std::vector<Message> m_Messages = {};
 		std::mutex m_Mutex;
+		bool m_Changed = false;
+
+		std::vector<Message> m_Shown = {}; // render thread only, copied from m_Messages on refresh frames
 
 		void ShowImpl(std::string sender, std::string message, ImColor color);
 		void DrawImpl();
@@ -3,11 +3,13 @@
 #include "ContextMenus.hpp"
 #include "core/commands/BoolCommand.hpp"
 #include "core/commands/Commands.hpp"
+#include "game/backend/EntityIndex.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/Players.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/Enums.hpp"
-#include "game/rdr/Pools.hpp"
+#include "game/rdr/Projection.hpp"
+#include "util/Math.hpp"
 
 namespace YimMenu::Features
 {
@@ -20,6 +22,9 @@ namespace YimMenu::Features
 
 namespace YimMenu
 {
+	static constexpr float PICK_DISTANCE = 300.0f;
+	static constexpr float PICK_RADIUS   = 10.0f;
+
 	inline double CumulativeDistanceToMiddleOfScreen(rage::fvector2 screenPos)
 	{
 		return std::abs(screenPos.x - 0.5) + std::abs(screenPos.y - 0.5);
@@ -27,54 +32,41 @@ namespace YimMenu
 
 	inline int GetEntityHandleClosestToMiddleOfScreen(bool includePlayers, bool includePeds, bool includeVehicles, bool includeObjects)
 	{
-		int closestHandle{};
-		float distance = 1;
-
-		auto updateClosestEntity = [&distance, &closestHandle](int handle) -> void {
-			auto worldCoords = ENTITY::GET_ENTITY_COORDS(handle, false, true);
-			rage::fvector2 screenPos{};
-			float worldCoords_[3] = {worldCoords.x, worldCoords.y, worldCoords.z};
-			Pointers.WorldToScreen(worldCoords_, &screenPos.x, &screenPos.y);
-			if (CumulativeDistanceToMiddleOfScreen(screenPos) < distance && handle != Self::GetPed().GetHandle())
-			{
-				closestHandle = handle;
-				distance      = CumulativeDistanceToMiddleOfScreen(screenPos);
-			}
-		};
-
+		std::uint8_t types = 0;
 		if (includePlayers && *Pointers.IsSessionStarted)
-		{
-			for (auto& [id, plyr] : YimMenu::Players::GetPlayers())
-			{
-				if (plyr.IsValid() || plyr.GetPed().GetPointer<void*>())
-					updateClosestEntity(PLAYER::GET_PLAYER_PED_SCRIPT_INDEX(id));
-			}
-		}
-
+			types |= EntityIndex::PLAYER_PED;
 		if (includePeds)
-		{
-			for (Ped ped : Pools::GetPeds())
-			{
-				if (ped.IsValid() || ped.GetPointer<void*>())
-					updateClosestEntity(ped.GetHandle());
-			}
-		}
-
+			types |= EntityIndex::PED;
 		if (includeVehicles)
-		{
-			for (Entity veh : Pools::GetVehicles())
-			{
-				if (veh.IsValid() || veh.GetPointer<void*>())
-					updateClosestEntity(veh.GetHandle());
-			}
-		}
-
+			types |= EntityIndex::VEHICLE;
 		if (includeObjects)
+			types |= EntityIndex::OBJECT;
+
+		auto projection = Projection::FromRenderedCamera();
+		if (!types || !projection.IsValid())
+			return 0;
+
+		int closestHandle{};
+		float distance  = 1;
+		auto selfHandle = Self::GetPed().GetHandle();
+
+		// only what's near the line of sight can end up close to the middle of the screen
+		auto camera    = CAM::GET_FINAL_RENDERED_CAM_COORD();
+		auto direction = Math::RotationToDirection(CAM::GET_FINAL_RENDERED_CAM_ROT(2));
+		static std::vector<EntityIndex::Item> candidates;
+		EntityIndex::QueryRay({camera.x, camera.y, camera.z}, {direction.x, direction.y, direction.z}, PICK_DISTANCE, PICK_RADIUS, types, candidates);
+		for (auto& item : candidates)
 		{
-			for (Entity obj : Pools::GetObjects())
+			ImVec2 pixels;
+			if (!(projection.Project(item.m_Position, pixels) & Projection::IN_FRONT))
+				continue;
+
+			rage::fvector2 screenPos{pixels.x / *Pointers.ScreenResX, pixels.y / *Pointers.ScreenResY};
+			auto handle = item.m_Entity.GetHandle();
+			if (CumulativeDistanceToMiddleOfScreen(screenPos) < distance && handle != selfHandle)
 			{
-				if (obj.IsValid() || obj.GetPointer<void*>())
-					updateClosestEntity(obj.GetHandle());
+				closestHandle = handle;
+				distance      = CumulativeDistanceToMiddleOfScreen(screenPos);
 			}
 		}
 
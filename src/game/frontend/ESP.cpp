@@ -3,10 +3,15 @@
 #include "common.hpp"
 #include "core/commands/BoolCommand.hpp"
 #include "core/commands/ColorCommand.hpp"
+#include "core/commands/IntCommand.hpp"
+#include "core/misc/SnapshotBuffer.hpp"
+#include "core/renderer/Renderer.hpp"
+#include "game/backend/EntityIndex.hpp"
 #include "game/backend/Players.hpp"
+#include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
 #include "game/pointers/Pointers.hpp"
-#include "game/rdr/Pools.hpp"
+#include "game/rdr/Projection.hpp"
 #include "game/rdr/Scripts.hpp"
 #include "util/Math.hpp"
 
@@ -14,6 +19,8 @@
 
 #include "game/rdr/invoker/Invoker.hpp"
 
+#include <span>
+
 namespace
 {
 	// Human
@@ -70,6 +77,58 @@ namespace
 	constexpr int horseRearRightFootBone  = 33646;
 	constexpr int horseRearRightToeBone0  = 41273;
 	constexpr int horseRearRightToeBone1  = 41274;
+
+	constexpr int humanBones[] = {headBone, neckBone, torsoBone, leftShoulderBone, leftElbowBone, leftHandBone, rightShoulderBone, rightElbowBone, rightHandBone, leftKneeBone, leftFootBone, rightKneeBone, rightFootBone};
+
+	// indices into humanBones
+	constexpr std::pair<int, int> humanLines[] = {
+	    {0, 1},
+	    {1, 3},
+	    {3, 4},
+	    {4, 5},
+	    {1, 6},
+	    {6, 7},
+	    {7, 8},
+	    {1, 2},
+	    {2, 9},
+	    {9, 10},
+	    {2, 11},
+	    {11, 12},
+	};
+
+	constexpr int horseBones[] = {horseHeadBone, horseNeckBone0, horseTorsoBone, horsePelvisBone, horseFrontLeftUpperArmBone, horseFrontLeftForearmBone, horseFrontLeftHandBone, horseFrontLeftFingerBone0, horseFrontLeftFingerBone1, horseFrontRightUpperArmBone, horseFrontRightForearmBone, horseFrontRightHandBone, horseFrontRightFingerBone0, horseFrontRightFingerBone1, horseRearLeftThighBone, horseRearLeftCalfBone, horseRearLeftFootBone, horseRearLeftToeBone0, horseRearLeftToeBone1, horseRearRightThighBone, horseRearRightCalfBone, horseRearRightFootBone, horseRearRightToeBone0, horseRearRightToeBone1};
+
+	// indices into horseBones
+	constexpr std::pair<int, int> horseLines[] = {
+	    // head, neck, torso and pelvis
+	    {0, 1},
+	    {1, 2},
+	    {2, 3},
+	    // front left leg
+	    {1, 4},
+	    {4, 5},
+	    {5, 6},
+	    {6, 7},
+	    {7, 8},
+	    // front right leg
+	    {1, 9},
+	    {9, 10},
+	    {10, 11},
+	    {11, 12},
+	    {12, 13},
+	    // rear left leg
+	    {3, 14},
+	    {14, 15},
+	    {15, 16},
+	    {16, 17},
+	    {17, 18},
+	    // rear right leg
+	    {3, 19},
+	    {19, 20},
+	    {20, 21},
+	    {21, 22},
+	    {22, 23},
+	};
 }
 
 namespace YimMenu::Features
@@ -102,6 +161,9 @@ namespace YimMenu::Features
 	ColorCommand _SkeletonColorPeds("skeletoncolorpeds", "Ped Skeleton Color", "Changes the color of the skeleton ESP for peds", ImVec4{});
 	ColorCommand _SkeletonColorHorse("skeletoncolorhorse", "Horse Skeleton Color", "Changes the color of the skeleton ESP for horses", ImVec4{});
 
+	IntCommand _ESPMaxDistancePeds("espmaxdistancepeds", "Max Ped Distance", "Peds further away than this aren't drawn, 0 draws all of them", 0, 5000, 0);
+
+	IntCommand _ESPUpdateRate("espupdaterate", "ESP Update Rate", "How many times per second the ESP gathers entity data, 144 gathers every frame", 5, 144, 144);
 }
 
 namespace YimMenu
@@ -120,152 +182,140 @@ namespace YimMenu
 	static ImVec4 Red              = ImVec4(0.69f, 0.29f, 0.29f, 1.f);
 	static ImVec4 Blue             = ImVec4(0.36f, 0.71f, 0.89f, 1.f);
 
-	static auto boneToScreen = [=](rage::fvector3 bone) -> ImVec2 {
-		float screen_x, screen_y;
-		float boneCoords[3] = {bone.x, bone.y, bone.z};
-
-		Pointers.WorldToScreen(boneCoords, &screen_x, &screen_y);
+	// Everything the renderer needs to draw one frame of ESP, laid out as one array per field. The vectors are cleared
+	// rather than freed between gathers, so once they have grown to the size of the lobby the snapshots never allocate
+	struct ESPSnapshot
+	{
+		enum Flags : std::uint8_t
+		{
+			PLAYER         = 1 << 0,
+			SELECTED       = 1 << 1,
+			SKELETON_HUMAN = 1 << 2,
+			SKELETON_HORSE = 1 << 3,
+		};
+
+		static constexpr std::uint32_t NO_TEXT = 0xFFFFFFFF;
+
+		std::vector<std::uint8_t> m_Flags;
+		std::vector<std::uint32_t> m_Models;
+		std::vector<rage::fvector3> m_HeadPositions;
+		std::vector<rage::fvector3> m_TorsoPositions;
+		std::vector<float> m_Distances;
+		std::vector<std::uint32_t> m_Labels;         // offsets into m_Text
+		std::vector<std::uint32_t> m_DistanceLabels; // offsets into m_Text
+		std::vector<std::uint32_t> m_FirstBones;     // offsets into m_BonePositions, in humanBones or horseBones order
+		std::vector<rage::fvector3> m_BonePositions;
+		std::string m_Text; // null terminated strings, formatted while gathering
+		Projection m_Projection; // the camera at the time of the gather
+
+		std::size_t GetCount() const
+		{
+			return m_Flags.size();
+		}
 
-		return ImVec2(screen_x * (*Pointers.ScreenResX), screen_y * (*Pointers.ScreenResY));
-	};
+		void Clear()
+		{
+			m_Flags.clear();
+			m_Models.clear();
+			m_HeadPositions.clear();
+			m_TorsoPositions.clear();
+			m_Distances.clear();
+			m_Labels.clear();
+			m_DistanceLabels.clear();
+			m_FirstBones.clear();
+			m_BonePositions.clear();
+			m_Text.clear();
+		}
 
-	void DrawSkeleton(Ped ped, ImDrawList* drawList, ImColor color)
-	{
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(headBone)), boneToScreen(ped.GetBonePosition(neckBone)), color, 1.5f);
+		template<typename... Args>
+		std::uint32_t AddText(std::format_string<Args...> fmt, Args&&... args)
+		{
+			auto offset = static_cast<std::uint32_t>(m_Text.size());
+			std::format_to(std::back_inserter(m_Text), fmt, std::forward<Args>(args)...);
+			m_Text.push_back('\0');
+			return offset;
+		}
 
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(neckBone)), boneToScreen(ped.GetBonePosition(leftShoulderBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(leftShoulderBone)), boneToScreen(ped.GetBonePosition(leftElbowBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(leftElbowBone)), boneToScreen(ped.GetBonePosition(leftHandBone)), color, 1.5f);
+		const char* GetText(std::uint32_t offset) const
+		{
+			return offset == NO_TEXT ? nullptr : m_Text.data() + offset;
+		}
+	};
 
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(neckBone)), boneToScreen(ped.GetBonePosition(rightShoulderBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(rightShoulderBone)), boneToScreen(ped.GetBonePosition(rightElbowBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(rightElbowBone)), boneToScreen(ped.GetBonePosition(rightHandBone)), color, 1.5f);
+	static SnapshotBuffer<ESPSnapshot> g_Snapshots;
 
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(neckBone)), boneToScreen(ped.GetBonePosition(torsoBone)), color, 1.5f);
+	// screen positions for one of the snapshot's position arrays, reused across frames
+	struct ProjectedPoints
+	{
+		std::vector<ImVec2> m_Positions;
+		std::vector<std::uint8_t> m_Flags;
 
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(torsoBone)), boneToScreen(ped.GetBonePosition(leftKneeBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(leftKneeBone)), boneToScreen(ped.GetBonePosition(leftFootBone)), color, 1.5f);
+		void Project(const Projection& projection, std::span<const rage::fvector3> points)
+		{
+			m_Positions.resize(points.size());
+			m_Flags.resize(points.size());
+			projection.ProjectPoints(points, m_Positions, m_Flags);
+		}
+	};
 
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(torsoBone)), boneToScreen(ped.GetBonePosition(rightKneeBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(ped.GetBonePosition(rightKneeBone)), boneToScreen(ped.GetBonePosition(rightFootBone)), color, 1.5f);
+	static void AddBones(ESPSnapshot& snapshot, Ped ped, std::span<const int> bones)
+	{
+		snapshot.m_FirstBones.back() = static_cast<std::uint32_t>(snapshot.m_BonePositions.size());
+		for (auto bone : bones)
+			snapshot.m_BonePositions.push_back(ped.GetBonePosition(bone));
 	}
 
-	void DrawHorseSkeleton(Ped horse, ImDrawList* drawList, ImColor color)
+	// adds the parts of an entity record that players and peds have in common and returns its distance
+	static float AddEntity(ESPSnapshot& snapshot, Ped ped, std::uint8_t flags, std::optional<rage::fvector3> self_pos)
 	{
-		// Head and neck
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseHeadBone)), boneToScreen(horse.GetBonePosition(horseNeckBone0)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseNeckBone0)), boneToScreen(horse.GetBonePosition(horseTorsoBone)), color, 1.5f);
-
-		// Torso and pelvis
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseTorsoBone)), boneToScreen(horse.GetBonePosition(horsePelvisBone)), color, 1.5f);
-
-		// Front left leg
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseNeckBone0)), boneToScreen(horse.GetBonePosition(horseFrontLeftUpperArmBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontLeftUpperArmBone)), boneToScreen(horse.GetBonePosition(horseFrontLeftForearmBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontLeftForearmBone)), boneToScreen(horse.GetBonePosition(horseFrontLeftHandBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontLeftHandBone)), boneToScreen(horse.GetBonePosition(horseFrontLeftFingerBone0)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontLeftFingerBone0)), boneToScreen(horse.GetBonePosition(horseFrontLeftFingerBone1)), color, 1.5f);
-
-		// Front right leg
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseNeckBone0)), boneToScreen(horse.GetBonePosition(horseFrontRightUpperArmBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontRightUpperArmBone)), boneToScreen(horse.GetBonePosition(horseFrontRightForearmBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontRightForearmBone)), boneToScreen(horse.GetBonePosition(horseFrontRightHandBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontRightHandBone)), boneToScreen(horse.GetBonePosition(horseFrontRightFingerBone0)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseFrontRightFingerBone0)), boneToScreen(horse.GetBonePosition(horseFrontRightFingerBone1)), color, 1.5f);
-
-		// Rear left leg
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horsePelvisBone)), boneToScreen(horse.GetBonePosition(horseRearLeftThighBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearLeftThighBone)), boneToScreen(horse.GetBonePosition(horseRearLeftCalfBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearLeftCalfBone)), boneToScreen(horse.GetBonePosition(horseRearLeftFootBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearLeftFootBone)), boneToScreen(horse.GetBonePosition(horseRearLeftToeBone0)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearLeftToeBone0)), boneToScreen(horse.GetBonePosition(horseRearLeftToeBone1)), color, 1.5f);
-
-		// Rear right leg
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horsePelvisBone)), boneToScreen(horse.GetBonePosition(horseRearRightThighBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearRightThighBone)), boneToScreen(horse.GetBonePosition(horseRearRightCalfBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearRightCalfBone)), boneToScreen(horse.GetBonePosition(horseRearRightFootBone)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearRightFootBone)), boneToScreen(horse.GetBonePosition(horseRearRightToeBone0)), color, 1.5f);
-		drawList->AddLine(boneToScreen(horse.GetBonePosition(horseRearRightToeBone0)), boneToScreen(horse.GetBonePosition(horseRearRightToeBone1)), color, 1.5f);
+		auto torso    = ped.GetBonePosition(torsoBone);
+		auto distance = self_pos ? self_pos->GetDistance(torso) : 0.0f;
+
+		snapshot.m_Flags.push_back(flags);
+		snapshot.m_Models.push_back(static_cast<std::uint32_t>(ped.GetModel()));
+		snapshot.m_HeadPositions.push_back(ped.GetBonePosition(headBone));
+		snapshot.m_TorsoPositions.push_back(torso);
+		snapshot.m_Distances.push_back(distance);
+		snapshot.m_Labels.push_back(ESPSnapshot::NO_TEXT);
+		snapshot.m_DistanceLabels.push_back(ESPSnapshot::NO_TEXT);
+		snapshot.m_FirstBones.push_back(0);
+		return distance;
 	}
-	
-	//TODO : Very bare bones currently, expand and possibly refactor
-	void ESP::DrawPlayer(Player& plyr, ImDrawList* drawList)
+
+	static void GatherPlayer(ESPSnapshot& snapshot, Player& plyr, std::optional<rage::fvector3> self_pos)
 	{
 		if (!plyr.IsValid() || !plyr.GetPed().IsValid() || plyr == Self::GetPlayer()
-		    || boneToScreen(plyr.GetPed().GetBonePosition(torsoBone)).x == 0
 		    || (plyr.GetPed().IsDead() && !Features::_ESPDrawDeadPlayers.GetState()))
 			return;
 
-		float distanceToPlayer   = Self::GetPed().GetPosition().GetDistance(plyr.GetPed().GetBonePosition(torsoBone));
-		int alphaBasedOnDistance = 255;
-		ImColor colorBasedOnDistance = Red;
+		auto ped           = plyr.GetPed();
+		std::uint8_t flags = ESPSnapshot::PLAYER;
+		if (plyr == Players::GetSelected())
+			flags |= ESPSnapshot::SELECTED;
 
-		if (distanceToPlayer < 100.f)
-			colorBasedOnDistance = Green, alphaBasedOnDistance = 255;
-		else if (distanceToPlayer > 100.f && distanceToPlayer < 300.f)
-			colorBasedOnDistance = Orange, alphaBasedOnDistance = 200;
-		else if (distanceToPlayer > 300.f)
-			colorBasedOnDistance = Red, alphaBasedOnDistance = 125;
-
-		const auto originalFontSize = ImGui::GetFont()->Scale;
-		auto* currentFont           = ImGui::GetFont();
-		currentFont->Scale *= 1.2;
-		ImGui::PushFont(ImGui::GetFont());
+		auto distance = AddEntity(snapshot, ped, flags, self_pos);
 
 		if (Features::_ESPName.GetState())
-		{
-			drawList->AddText(boneToScreen(plyr.GetPed().GetBonePosition(headBone)),
-			    plyr == Players::GetSelected() ? ImGui::ColorConvertFloat4ToU32(Blue) : ImGui::ColorConvertFloat4ToU32(Features::_NameColorPlayers.GetState()),
-			    plyr.GetName());
-		}
+			snapshot.m_Labels.back() = snapshot.AddText("{}", plyr.GetName());
 
 		if (Features::_ESPDistance.GetState())
-		{
-			std::string distanceStr = std::to_string((int)Self::GetPed().GetPosition().GetDistance(plyr.GetPed().GetBonePosition(torsoBone))) + "m";
-			drawList->AddText({boneToScreen(plyr.GetPed().GetBonePosition(headBone)).x,
-			                      boneToScreen(plyr.GetPed().GetBonePosition(headBone)).y + 20},
-			    colorBasedOnDistance,
-			    distanceStr.c_str());
-		}
-
-		currentFont->Scale = originalFontSize;
-		ImGui::PopFont();
+			snapshot.m_DistanceLabels.back() = snapshot.AddText("{}m", (int)distance);
 
 		//TODO Boxes, Distance colors, Friendlies, Tracers, Health bars
 
-		if (Features::_ESPSkeleton.GetState() && !plyr.GetPed().IsAnimal()) // yes, this is neccesary.
+		if (Features::_ESPSkeleton.GetState() && !ped.IsAnimal() && distance < 250.f) // yes, the animal check is neccesary.
 		{
-			if (distanceToPlayer < 250.f)
-			{
-				DrawSkeleton(plyr.GetPed(), drawList, ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorPlayers.GetState()));
-			}
+			snapshot.m_Flags.back() |= ESPSnapshot::SKELETON_HUMAN;
+			AddBones(snapshot, ped, humanBones);
 		}
 	}
 
-	void ESP::DrawPeds(Ped ped, ImDrawList* drawList)
+	static void GatherPed(ESPSnapshot& snapshot, Ped ped, std::optional<rage::fvector3> self_pos)
 	{
-		if (!ped.IsValid() || ped.IsPlayer() || ped == Self::GetPlayer().GetPed() || boneToScreen(ped.GetBonePosition(torsoBone)).x == 0 || (ped.IsDead() && !Features::_ESPDrawDeadPeds.GetState()))
+		if (!ped.IsValid() || (ped.IsDead() && !Features::_ESPDrawDeadPeds.GetState()))
 			return;
 
-		float distanceToPed = 0.0f;
-		
-		if (auto local = Self::GetPed())
-			distanceToPed = local.GetPosition().GetDistance(ped.GetBonePosition(torsoBone));
-		
-		int alphaBasedOnDistance     = 255;
-		ImColor colorBasedOnDistance = Red;
-
-		if (distanceToPed < 100.f)
-			colorBasedOnDistance = Green, alphaBasedOnDistance = 255;
-		else if (distanceToPed > 100.f && distanceToPed < 300.f)
-			colorBasedOnDistance = Orange, alphaBasedOnDistance = 200;
-		else if (distanceToPed > 300.f)
-			colorBasedOnDistance = Red, alphaBasedOnDistance = 125;
-
-		const auto originalFontSize = ImGui::GetFont()->Scale;
-		auto* currentFont           = ImGui::GetFont();
-		currentFont->Scale *= 1.2;
-		ImGui::PushFont(ImGui::GetFont());
+		auto distance = AddEntity(snapshot, ped, 0, self_pos);
 
 		std::string info = "";
 
@@ -280,7 +330,7 @@ namespace YimMenu
 		if (Features::_ESPNetworkInfoPeds.GetState() && ped.IsNetworked())
 		{
 			auto owner = Player(ped.GetOwner());
-			auto id = ped.GetNetworkObjectId();
+			auto id    = ped.GetNetworkObjectId();
 
 			info += std::format("{} {} ", id, owner.GetName());
 		}
@@ -297,64 +347,163 @@ namespace YimMenu
 		}
 
 		if (!info.empty())
-			drawList->AddText(boneToScreen(ped.GetBonePosition(headBone)),
-				ImGui::ColorConvertFloat4ToU32(Features::_HashColorPeds.GetState()),
-				info.c_str());
+			snapshot.m_Labels.back() = snapshot.AddText("{}", info);
 
 		if (Features::_ESPDistancePeds.GetState())
+			snapshot.m_DistanceLabels.back() = snapshot.AddText("{}m", (int)distance);
+
+		//TODO Boxes, Distance colors, Tracers, Health bars
+
+		if (distance >= 250.f)
+			return;
+
+		if (Features::_ESPSkeletonPeds.GetState() && !ped.IsAnimal())
+		{
+			snapshot.m_Flags.back() |= ESPSnapshot::SKELETON_HUMAN;
+			AddBones(snapshot, ped, humanBones);
+		}
+		else if (Features::_ESPSkeletonHorse.GetState() && PED::_IS_THIS_MODEL_A_HORSE(ped.GetModel()))
 		{
-			std::string distanceStr = std::to_string((int)distanceToPed) + "m";
-			drawList->AddText(
-			    {boneToScreen(ped.GetBonePosition(headBone)).x, boneToScreen(ped.GetBonePosition(headBone)).y + 20},
-			    colorBasedOnDistance,
-			    distanceStr.c_str());
+			snapshot.m_Flags.back() |= ESPSnapshot::SKELETON_HORSE;
+			AddBones(snapshot, ped, horseBones);
 		}
+	}
 
-		currentFont->Scale = originalFontSize;
-		ImGui::PopFont();
+	static void Gather(ESPSnapshot& snapshot)
+	{
+		snapshot.Clear();
 
-		//TODO Boxes, Distance colors, Tracers, Health bars	
+		if (CAM::IS_SCREEN_FADED_OUT())
+			return;
 
-		if (Features::_ESPSkeletonPeds.GetState() && !ped.IsAnimal())
+		snapshot.m_Projection = Projection::FromRenderedCamera();
+
+		std::optional<rage::fvector3> self_pos;
+		if (auto local = Self::GetPed())
+			self_pos = local.GetPosition();
+
+		if (Features::_ESPDrawPlayers.GetState())
 		{
-			if (distanceToPed < 250.f)
+			for (auto& [id, player] : Players::GetPlayers())
 			{
-				DrawSkeleton(ped, drawList, ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorPeds.GetState()));
+				GatherPlayer(snapshot, player, self_pos);
 			}
 		}
 
-		if (Features::_ESPSkeletonHorse.GetState() && PED::_IS_THIS_MODEL_A_HORSE(ped.GetModel()))
+		if (Features::_ESPDrawPeds.GetState())
 		{
-			if (distanceToPed < 250.f)
+			static std::vector<EntityIndex::Item> peds;
+			if (auto max_distance = Features::_ESPMaxDistancePeds.GetState(); self_pos && max_distance > 0)
+				EntityIndex::QueryRadius(*self_pos, static_cast<float>(max_distance), EntityIndex::PED, peds);
+			else
+				EntityIndex::GetAll(EntityIndex::PED, peds);
+			for (auto& item : peds)
 			{
-				DrawHorseSkeleton(ped, drawList, ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorHorse.GetState()));
+				GatherPed(snapshot, item.m_Entity.As<Ped>(), self_pos);
 			}
 		}
 	}
 
+	void ESP::Update()
+	{
+		while (true)
+		{
+			Gather(g_Snapshots.GetBack());
+			g_Snapshots.Publish();
+
+			if (auto rate = Features::_ESPUpdateRate.GetState(); rate < 144)
+				ScriptMgr::Yield(std::chrono::milliseconds(1000 / std::max(rate, 1)));
+			else
+				ScriptMgr::Yield();
+		}
+	}
+
+	static void DrawSkeleton(const ProjectedPoints& bones, std::uint32_t first_bone, ImDrawList* drawList, ImColor color, std::span<const std::pair<int, int>> lines)
+	{
+		auto positions = bones.m_Positions.data() + first_bone;
+		auto flags     = bones.m_Flags.data() + first_bone;
+
+		for (auto& [from, to] : lines)
+		{
+			if ((flags[from] & Projection::IN_FRONT) && (flags[to] & Projection::IN_FRONT))
+				drawList->AddLine(positions[from], positions[to], color, 1.5f);
+		}
+	}
+
 	void ESP::Draw()
 	{
-		if (!NativeInvoker::AreHandlersCached() || CAM::IS_SCREEN_FADED_OUT())
+		// while the renderer is over budget a new snapshot is only picked up on refresh frames, the last one is drawn as is
+		// in between. a snapshot is projected with the camera it was gathered with, so that's only done once per snapshot
+		const auto& snapshot = Renderer::IsRefreshFrame() ? g_Snapshots.GetFront() : g_Snapshots.GetCurrent();
+		static const ESPSnapshot* projected = nullptr;
+		if (snapshot.GetCount() == 0 || !snapshot.m_Projection.IsValid())
+		{
+			projected = nullptr;
 			return;
+		}
 
-		if (const auto drawList = ImGui::GetBackgroundDrawList())
+		const auto drawList = ImGui::GetBackgroundDrawList();
+		if (!drawList)
+			return;
+
+		static ProjectedPoints torsos, heads, bones;
+		if (&snapshot != projected)
 		{
-			if (Features::_ESPDrawPlayers.GetState())
-			{
-				for (auto& [id, player] : Players::GetPlayers())
-				{
-					DrawPlayer(player, drawList);
-				}
-			}
-			if (Features::_ESPDrawPeds.GetState() && GetPedPool())
+			torsos.Project(snapshot.m_Projection, snapshot.m_TorsoPositions);
+			heads.Project(snapshot.m_Projection, snapshot.m_HeadPositions);
+			bones.Project(snapshot.m_Projection, snapshot.m_BonePositions);
+			projected = &snapshot;
+		}
+
+		const auto originalFontSize = ImGui::GetFont()->Scale;
+		auto* currentFont           = ImGui::GetFont();
+		currentFont->Scale *= 1.2;
+		ImGui::PushFont(ImGui::GetFont());
+
+		const auto nameColorPlayers     = ImGui::ColorConvertFloat4ToU32(Features::_NameColorPlayers.GetState());
+		const auto hashColorPeds        = ImGui::ColorConvertFloat4ToU32(Features::_HashColorPeds.GetState());
+		const auto skeletonColorPlayers = ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorPlayers.GetState());
+		const auto skeletonColorPeds    = ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorPeds.GetState());
+		const auto skeletonColorHorse   = ImGui::ColorConvertFloat4ToU32(Features::_SkeletonColorHorse.GetState());
+
+		for (std::size_t i = 0; i < snapshot.GetCount(); i++)
+		{
+			if (!(torsos.m_Flags[i] & Projection::ON_SCREEN))
+				continue;
+
+			auto flags    = snapshot.m_Flags[i];
+			auto distance = snapshot.m_Distances[i];
+			auto isPlayer = (flags & ESPSnapshot::PLAYER) != 0;
+
+			ImColor colorBasedOnDistance = Red;
+			if (distance < 100.f)
+				colorBasedOnDistance = Green;
+			else if (distance > 100.f && distance < 300.f)
+				colorBasedOnDistance = Orange;
+
+			auto label         = snapshot.GetText(snapshot.m_Labels[i]);
+			auto distanceLabel = snapshot.GetText(snapshot.m_DistanceLabels[i]);
+			if (label || distanceLabel)
 			{
-				for (Ped ped : Pools::GetPeds())
+				auto head = heads.m_Positions[i];
+
+				if (label)
 				{
-					if (ped.IsValid() || ped.GetPointer<void*>())
-						DrawPeds(ped, drawList);
+					auto color = isPlayer ? ((flags & ESPSnapshot::SELECTED) ? ImGui::ColorConvertFloat4ToU32(Blue) : nameColorPlayers) : hashColorPeds;
+					drawList->AddText(head, color, label);
 				}
+
+				if (distanceLabel)
+					drawList->AddText({head.x, head.y + 20}, colorBasedOnDistance, distanceLabel);
 			}
+
+			if (flags & ESPSnapshot::SKELETON_HUMAN)
+				DrawSkeleton(bones, snapshot.m_FirstBones[i], drawList, isPlayer ? skeletonColorPlayers : skeletonColorPeds, humanLines);
+			else if (flags & ESPSnapshot::SKELETON_HORSE)
+				DrawSkeleton(bones, snapshot.m_FirstBones[i], drawList, skeletonColorHorse, horseLines);
 		}
-	}
 
+		currentFont->Scale = originalFontSize;
+		ImGui::PopFont();
+	}
 }
\ No newline at end of file
@@ -1,13 +1,14 @@
 #pragma once
-#include "game/rdr/Player.hpp"
 
 namespace YimMenu
 {
 	class ESP
 	{
 	public:
+		// gathers entity data on the game thread
+		static void Update();
+
+		// draws the latest snapshot, only projects and never touches game entities
 		static void Draw();
-		static void DrawPlayer(Player& plyr, ImDrawList* const draw_list);
-		static void DrawPeds(Ped plyr, ImDrawList* drawList);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+#include "util/SearchIndex.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace YimMenu
+{
+	// A fixed list of names that can be searched and drawn as a scrolling list. The names go into a SearchIndex when the
+	// list is assigned, and the matches come from a SearchQuery, so they're only recomputed when the search text changes.
+	// Drawing goes through ImGuiListClipper, so only the rows in view are submitted and a list of thousands of entries
+	// costs about as much as one that fits on screen
+	class FilteredList
+	{
+		std::vector<std::string> m_Names; // the index points into these
+		SearchIndex m_Index;
+		SearchQuery m_Query{m_Index};
+		std::string m_Search;
+
+	public:
+		FilteredList() = default;
+		FilteredList(const FilteredList&)            = delete;
+		FilteredList& operator=(const FilteredList&) = delete;
+
+		// case insensitive substring search that doesn't allocate, for the odd one-off check
+		static bool Contains(std::string_view text, std::string_view search)
+		{
+			if (search.size() > text.size())
+				return false;
+
+			for (std::size_t i = 0; i + search.size() <= text.size(); i++)
+			{
+				std::size_t j = 0;
+				while (j < search.size() && ToLower(text[i + j]) == ToLower(search[j]))
+					j++;
+				if (j == search.size())
+					return true;
+			}
+
+			return false;
+		}
+
+		// getName(item) must return something convertible to std::string_view
+		template<typename Container, typename GetName>
+		void Assign(const Container& items, GetName&& getName)
+		{
+			m_Names.clear();
+			m_Names.reserve(std::size(items));
+			for (const auto& item : items)
+				m_Names.emplace_back(getName(item));
+
+			m_Index = SearchIndex(std::vector<std::string_view>(m_Names.begin(), m_Names.end()));
+			m_Query.Reset();
+		}
+
+		std::size_t GetSize() const
+		{
+			return m_Names.size();
+		}
+
+		void SetSearch(std::string_view search)
+		{
+			m_Search = search;
+		}
+
+		const std::vector<std::uint32_t>& GetMatches()
+		{
+			return m_Query.Update(m_Search);
+		}
+
+		// calls drawItem(index) for every match that is in view. rows must all have the same height
+		template<typename F>
+		void Draw(F&& drawItem)
+		{
+			auto& matches = GetMatches();
+			DrawRows(matches.size(), [&](std::size_t row) {
+				drawItem(matches[row]);
+			});
+		}
+
+		// calls drawRow(row) for the rows of a list of count equally tall rows that are in view, and leaves the cursor
+		// below the last row
+		template<typename F>
+		static void DrawRows(std::size_t count, F&& drawRow)
+		{
+			ImGuiListClipper clipper;
+			clipper.Begin(static_cast<int>(count));
+			while (clipper.Step())
+				for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+					drawRow(static_cast<std::size_t>(row));
+		}
+	};
+}
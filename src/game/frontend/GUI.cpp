@@ -5,6 +5,7 @@
 #include "Overlay.hpp"
 #include "core/renderer/Renderer.hpp"
 #include "core/frontend/Notifications.hpp"
+#include "game/backend/VariableWatch.hpp"
 #include "game/frontend/ChatDisplay.hpp"
 
 namespace YimMenu
@@ -24,28 +25,35 @@ namespace YimMenu
 		    [&] {
 			    Notifications::Draw();
 		    },
-		    -2);
+		    -2, "Notifications", true);
 		Renderer::AddRendererCallBack(
 		    [&] {
 			    ESP::Draw();
 		    },
-		    -3);
+		    -3, "ESP", true);
 
 		Renderer::AddRendererCallBack(
 		    [&] {
 			    ContextMenu::DrawContextMenu();
 		    },
-		    -4);
+		    -4, "Context Menu");
 		Renderer::AddRendererCallBack(
 		    [&] {
 			    ChatDisplay::Draw();
 		    },
-		    -5);
+		    -5, "Chat", true);
 		Renderer::AddRendererCallBack(
 		    [&] {
 			    Overlay::Draw();
 		    },
-		    -6);
+		    -6, "Overlay", true);
+
+		// keeps the change history going while the watch page isn't open
+		Renderer::AddRendererCallBack(
+		    [&] {
+			    VariableWatch::Poll();
+		    },
+		    -7, "Variable Watch");
 	}
 
 	GUI::~GUI()
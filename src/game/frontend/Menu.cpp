@@ -1,7 +1,9 @@
 #include "Menu.hpp"
 
 #include "core/commands/Commands.hpp"
+#include "core/filemgr/FileMgr.hpp"
 #include "core/frontend/manager/UIManager.hpp"
+#include "core/renderer/FontCache.hpp"
 #include "core/renderer/Renderer.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/ScriptMgr.hpp"
@@ -69,7 +71,7 @@ namespace YimMenu
 			    ImGui::PopStyleColor();
 			    ImGui::PopFont();
 		    },
-		    -1);
+		    -1, "Menu");
 	}
 
 	void Menu::SetupStyle()
@@ -137,6 +139,7 @@ namespace YimMenu
 		Menu::Font::g_ChildTitleFont = IO.Fonts->AddFontFromMemoryTTF(const_cast<std::uint8_t*>(Fonts::MainFont), sizeof(Fonts::MainFont), Menu::Font::g_ChildTitleFontSize, &FontCfg);
 		Menu::Font::g_ChatFont = IO.Fonts->AddFontFromMemoryTTF(const_cast<std::uint8_t*>(Fonts::MainFont), sizeof(Fonts::MainFont), Menu::Font::g_ChatFontSize, &FontCfg);
 		Menu::Font::g_OverlayFont = IO.Fonts->AddFontFromMemoryTTF(const_cast<std::uint8_t*>(Fonts::MainFont), sizeof(Fonts::MainFont), Menu::Font::g_OverlayFontSize, &FontCfg);
+		FontCache::Build(*IO.Fonts, FileMgr::GetProjectFile("./font_cache.bin").Path());
 		UIManager::SetOptionsFont(Menu::Font::g_OptionsFont);
 	}
 }
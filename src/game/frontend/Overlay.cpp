@@ -2,6 +2,7 @@
 #include "Overlay.hpp"
 #include "Menu.hpp"
 #include "core/commands/BoolCommand.hpp"
+#include "core/renderer/Renderer.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/invoker/Invoker.hpp"
@@ -27,7 +28,14 @@ namespace YimMenu
 		ImGui::Begin("##overlay", nullptr, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoScrollWithMouse | ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoInputs);
 
 		if (Features::_OverlayShowFPS.GetState())
-			ImGui::Text("FPS: %d", (int)(1 / MISC::GET_SYSTEM_TIME_STEP()));
+		{
+			// only read again on the frames the renderer has time for
+			static int fps = 0;
+			if (Renderer::IsRefreshFrame() || fps == 0)
+				fps = (int)(1 / MISC::GET_SYSTEM_TIME_STEP());
+
+			ImGui::Text("FPS: %d", fps);
+		}
 
 		ImGui::PopFont();
 		ImGui::PopStyleColor();
@@ -2,10 +2,14 @@
 
 #include "Debug/Globals.hpp"
 #include "Debug/Locals.hpp"
+#include "Debug/Profiler.hpp"
+#include "Debug/RenderTimings.hpp"
 #include "Debug/Scripts.hpp"
+#include "Debug/Watch.hpp"
 #include "core/commands/BoolCommand.hpp"
 #include "core/filemgr/FileMgr.hpp"
 #include "game/backend/FiberPool.hpp"
+#include "game/backend/NativeQueue.hpp"
 #include "game/backend/NativeHooks.hpp"
 #include "game/frontend/items/Items.hpp"
 #include "game/rdr/Natives.hpp"
@@ -25,6 +29,9 @@ namespace YimMenu::Submenus
 		AddCategory(BuildGlobalsMenu());
 		AddCategory(BuildLocalsMenu());
 		AddCategory(BuildScriptsMenu());
+		AddCategory(BuildWatchMenu());
+		AddCategory(BuildProfilerMenu());
+		AddCategory(BuildRenderTimingsMenu());
 
 		auto debug = std::make_shared<Category>("Logging/Misc");
 
@@ -41,6 +48,8 @@ namespace YimMenu::Submenus
 		debug->AddItem(std::make_shared<BoolCommandItem>("logpresenceevents"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logpostmessage"_J));
 		debug->AddItem(std::make_shared<BoolCommandItem>("logservermessages"_J));
+		debug->AddItem(std::make_shared<StringCommandItem>("logservermessagefields"_J));
+		debug->AddItem(std::make_shared<BoolCommandItem>("captureservermessages"_J));
 		//debug->AddItem(std::make_shared<BoolCommandItem>("logscriptlaunches"_J));
 
 		debug->AddItem(std::make_shared<BoolCommandItem>("betterentitycheck"_J));
@@ -49,9 +58,7 @@ namespace YimMenu::Submenus
 		debug->AddItem(std::make_shared<ImGuiItem>([] {
 			if (ImGui::Button("Bail to Loading Screen"))
 			{
-				FiberPool::Push([] {
-					SCRIPTS::BAIL_TO_LANDING_PAGE(0);
-				});
+				NativeQueue::Push<NativeIndex::BAIL_TO_LANDING_PAGE>(0);
 			}
 
 			static char object_model[255]{};
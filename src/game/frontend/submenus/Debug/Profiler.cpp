@@ -0,0 +1,178 @@
+#include "Profiler.hpp"
+#include "game/backend/NativeQueue.hpp"
+#include "game/backend/ScriptProfiler.hpp"
+#include "game/backend/Streaming.hpp"
+#include "game/rdr/Scripts.hpp"
+
+namespace YimMenu::Submenus
+{
+	// what each script did over the last second, recomputed once a second from the running totals
+	struct ProfileRow
+	{
+		joaat_t m_Script;
+		const char* m_Name;
+		double m_TimePerSecond; // ms
+		double m_AverageRun;    // us
+		double m_PeakRun;       // us, since the last reset
+		double m_RunsPerSecond;
+		double m_PatchPerSecond; // us
+		double m_NativesPerSecond;
+	};
+
+	struct ProfileTotals
+	{
+		std::uint64_t m_Runs, m_Time, m_PatchTime, m_Natives;
+	};
+
+	static std::vector<ProfileRow> s_Rows;
+	static std::unordered_map<joaat_t, ProfileTotals> s_Totals; // menu scripts are under zero
+	static std::chrono::steady_clock::time_point s_LastRefresh;
+
+	static void AddRow(joaat_t script, const char* name, const ScriptProfiler::Counters& counters, double seconds)
+	{
+		ProfileTotals totals{counters.m_Runs.load(std::memory_order_relaxed), counters.m_Time.load(std::memory_order_relaxed), counters.m_PatchTime.load(std::memory_order_relaxed), counters.m_Natives.load(std::memory_order_relaxed)};
+		auto last   = s_Totals[script];
+		auto runs   = totals.m_Runs - std::min(last.m_Runs, totals.m_Runs); // a reset makes the totals go down
+		auto time   = totals.m_Time - std::min(last.m_Time, totals.m_Time);
+		auto patch  = totals.m_PatchTime - std::min(last.m_PatchTime, totals.m_PatchTime);
+		auto native = totals.m_Natives - std::min(last.m_Natives, totals.m_Natives);
+		s_Totals[script] = totals;
+
+		s_Rows.push_back({script,
+		    name,
+		    time / 1e6 / seconds,
+		    runs ? time / 1e3 / runs : 0.0,
+		    counters.m_PeakTime.load(std::memory_order_relaxed) / 1e3,
+		    runs / seconds,
+		    patch / 1e3 / seconds,
+		    native / seconds});
+	}
+
+	static void Refresh()
+	{
+		auto now     = std::chrono::steady_clock::now();
+		auto seconds = std::chrono::duration<double>(now - s_LastRefresh).count();
+		if (seconds < 1.0)
+			return;
+		s_LastRefresh = now;
+
+		s_Rows.clear();
+		for (auto& counters : ScriptProfiler::GetScripts())
+		{
+			if (auto script = counters.m_Script.load(std::memory_order_relaxed))
+				AddRow(script, Scripts::GetScriptName(script), counters, seconds);
+		}
+		AddRow(0, "(menu scripts)", ScriptProfiler::GetMenu(), seconds);
+
+		std::sort(s_Rows.begin(), s_Rows.end(), [](const ProfileRow& a, const ProfileRow& b) {
+			return a.m_TimePerSecond > b.m_TimePerSecond;
+		});
+	}
+
+	std::shared_ptr<Category> BuildProfilerMenu()
+	{
+		auto profiler = std::make_unique<Category>("Script Profiler");
+
+		auto settings = std::make_unique<Group>("Settings");
+		settings->AddItem(std::make_unique<BoolCommandItem>("profilescripts"_J));
+		settings->AddItem(std::make_unique<ImGuiItem>([] {
+			if (ImGui::Button("Reset"))
+				ScriptProfiler::Reset();
+
+			if (auto dropped = ScriptProfiler::GetDropped())
+			{
+				ImGui::SameLine();
+				ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "%u runs of scripts that didn't fit in the table", dropped);
+			}
+
+			auto queue = NativeQueue::GetStats();
+			ImGui::Text("Queued natives: %llu pushed, %llu run in %llu batches, %llu dropped", queue.m_Pushed, queue.m_Executed, queue.m_Batches, queue.m_Dropped);
+
+			auto streaming = Streaming::GetStats();
+			ImGui::Text("Streaming: %zu models (%zu loading, %zu unused), %llu requests, %llu shared, %llu released", streaming.m_Models, streaming.m_Pending, streaming.m_Cached, streaming.m_Requests, streaming.m_Shared, streaming.m_Released);
+		}));
+
+		auto scripts = std::make_unique<Group>("Hottest Scripts");
+		scripts->AddItem(std::make_unique<ImGuiItem>([] {
+			if (!ScriptProfiler::IsEnabled())
+			{
+				ImGui::TextDisabled("Profiling is off");
+				return;
+			}
+
+			Refresh();
+			ImGui::TextDisabled("Per second of game time. Patches is the time spent swapping in patched bytecode, natives are the ones the menu called, from its own scripts or from its native hooks");
+
+			if (!ImGui::BeginTable("##profile", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp, ImVec2(0, 350)))
+				return;
+
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("Script");
+			ImGui::TableSetupColumn("VM (ms)");
+			ImGui::TableSetupColumn("Avg run (us)");
+			ImGui::TableSetupColumn("Peak run (us)");
+			ImGui::TableSetupColumn("Runs");
+			ImGui::TableSetupColumn("Patches (us)");
+			ImGui::TableSetupColumn("Natives");
+			ImGui::TableHeadersRow();
+
+			auto pc_script = ScriptProfiler::GetPcScript();
+			for (auto& row : s_Rows)
+			{
+				ImGui::PushID(static_cast<int>(row.m_Script));
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				if (ImGui::Selectable(row.m_Name, row.m_Script && row.m_Script == pc_script, ImGuiSelectableFlags_SpanAllColumns) && row.m_Script)
+					ScriptProfiler::SetPcScript(row.m_Script == pc_script ? 0 : row.m_Script);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", row.m_TimePerSecond);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", row.m_AverageRun);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", row.m_PeakRun);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.0f", row.m_RunsPerSecond);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.1f", row.m_PatchPerSecond);
+				ImGui::TableNextColumn();
+				ImGui::Text("%.0f", row.m_NativesPerSecond);
+				ImGui::PopID();
+			}
+
+			ImGui::EndTable();
+		}));
+
+		auto buckets = std::make_unique<Group>("Bytecode");
+		buckets->AddItem(std::make_unique<ImGuiItem>([] {
+			auto script = ScriptProfiler::GetPcScript();
+			if (!script)
+			{
+				ImGui::TextDisabled("Select a script to split its time by where in the bytecode its runs resume");
+				return;
+			}
+
+			std::vector<std::pair<std::uint64_t, std::size_t>> hottest;
+			auto& pc_buckets = ScriptProfiler::GetPcBuckets();
+			for (std::size_t i = 0; i < pc_buckets.size(); i++)
+			{
+				if (auto time = pc_buckets[i].load(std::memory_order_relaxed))
+					hottest.emplace_back(time, i);
+			}
+
+			auto count = std::min<std::size_t>(hottest.size(), 10);
+			std::partial_sort(hottest.begin(), hottest.begin() + count, hottest.end(), std::greater<>());
+
+			ImGui::Text("%s, since it was selected", Scripts::GetScriptName(script));
+			for (std::size_t i = 0; i < count; i++)
+			{
+				auto start = hottest[i].second << ScriptProfiler::PC_BUCKET_SHIFT;
+				ImGui::Text("0x%06zX-0x%06zX  %.2f ms", start, start + (1 << ScriptProfiler::PC_BUCKET_SHIFT) - 1, hottest[i].first / 1e6);
+			}
+		}));
+
+		profiler->AddItem(std::move(settings));
+		profiler->AddItem(std::move(scripts));
+		profiler->AddItem(std::move(buckets));
+		return profiler;
+	}
+}
@@ -0,0 +1,73 @@
+#include "RenderTimings.hpp"
+#include "core/renderer/Renderer.hpp"
+
+namespace YimMenu::Submenus
+{
+	static void TimingRow(const char* name, const FrameTiming& timing, const char* note = "")
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(name);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.0f", timing.m_Last);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.0f", timing.m_Average);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.0f", timing.m_Peak);
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(note);
+	}
+
+	std::shared_ptr<Category> BuildRenderTimingsMenu()
+	{
+		auto renderer = std::make_unique<Category>("Renderer");
+
+		auto budget = std::make_unique<Group>("Frame Budget");
+		budget->AddItem(std::make_unique<IntCommandItem>("framebudget"_J));
+		budget->AddItem(std::make_unique<IntCommandItem>("targetframerate"_J));
+
+		auto timings = std::make_unique<Group>("Timings");
+		timings->AddItem(std::make_unique<ImGuiItem>([] {
+			const auto& frame = Renderer::GetFrameBudget();
+
+			if (frame.IsDegraded())
+				ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "Over budget, degradable callbacks refresh every %u frames", FrameBudget::DEGRADED_REFRESH_INTERVAL);
+			else
+				ImGui::Text("Within budget");
+
+			auto frames = frame.GetFrameCount();
+			ImGui::Text("Degraded %llu of %llu frames (%.1f%%)", frame.GetDegradedCount(), frames, frames ? 100.0 * frame.GetDegradedCount() / frames : 0.0);
+			if (frame.GetDeadline().count())
+				ImGui::Text("Game frame %.2f ms, deadline %.2f ms", frame.GetInterval().m_Average / 1000.f, frame.GetDeadline().count() / 1000.f);
+			else
+				ImGui::Text("Game frame %.2f ms", frame.GetInterval().m_Average / 1000.f);
+
+			if (!ImGui::BeginTable("##timings", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp))
+				return;
+
+			ImGui::TableSetupColumn("Work");
+			ImGui::TableSetupColumn("Last (us)");
+			ImGui::TableSetupColumn("Average (us)");
+			ImGui::TableSetupColumn("Peak (us)");
+			ImGui::TableSetupColumn("");
+			ImGui::TableHeadersRow();
+
+			for (const auto& [priority, callback] : Renderer::GetRendererCallBacks())
+			{
+				ImGui::PushID(static_cast<int>(priority));
+				TimingRow(callback.m_Name.empty() ? "(unnamed)" : callback.m_Name.c_str(), callback.m_Timing, callback.m_Degradable ? "degradable" : "");
+				ImGui::PopID();
+			}
+
+			TimingRow("Menu work", frame.GetWork(), "budgeted");
+			TimingRow("GPU wait", frame.GetWait());
+			TimingRow("Total", frame.GetTotal());
+
+			ImGui::EndTable();
+		}));
+
+		renderer->AddItem(std::move(budget));
+		renderer->AddItem(std::move(timings));
+		return renderer;
+	}
+}
@@ -126,15 +126,28 @@ namespace YimMenu::Submenus
 			ImGui::SetNextItemWidth(225.0f);
 			if (ImGui::BeginCombo("Name", s_SelectedNewScriptName))
 			{
-				auto& map = Scripts::UsingMPScripts() ? Data::g_MpScriptNames : Data::g_SpScriptNames;
-				for (auto& el : map)
+				// the tables are sorted by hash, list them alphabetically instead
+				auto sortByName = [](const auto& table) {
+					std::vector<const char*> names;
+					names.reserve(table.size());
+					for (auto& [hash, name] : table)
+						names.push_back(name);
+					std::sort(names.begin(), names.end(), [](const char* a, const char* b) {
+						return std::string_view(a) < std::string_view(b);
+					});
+					return names;
+				};
+				static const auto mpNames = sortByName(Data::g_MpScriptNames);
+				static const auto spNames = sortByName(Data::g_SpScriptNames);
+
+				for (auto name : Scripts::UsingMPScripts() ? mpNames : spNames)
 				{
-					if (ImGui::Selectable(el.second, el.second == s_SelectedNewScriptName))
+					if (ImGui::Selectable(name, name == s_SelectedNewScriptName))
 					{
-						s_SelectedNewScriptName = el.second;
+						s_SelectedNewScriptName = name;
 					}
 
-					if (el.second == s_SelectedNewScriptName)
+					if (name == s_SelectedNewScriptName)
 						ImGui::SetItemDefaultFocus();
 				}
 				ImGui::EndCombo();
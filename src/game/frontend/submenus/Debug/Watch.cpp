@@ -0,0 +1,135 @@
+#include "Watch.hpp"
+#include "core/filemgr/FileMgr.hpp"
+#include "core/frontend/Notifications.hpp"
+#include "game/backend/SavedVariables.hpp"
+#include "game/backend/VariableWatch.hpp"
+
+namespace YimMenu::Submenus
+{
+	static std::string FormatAge(std::chrono::steady_clock::time_point time)
+	{
+		if (time == std::chrono::steady_clock::time_point{})
+			return "Never";
+
+		auto age = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - time);
+		return std::format("{:.1f}s ago", age.count() / 1000.f);
+	}
+
+	std::shared_ptr<Category> BuildWatchMenu()
+	{
+		auto watch = std::make_unique<Category>("Watch");
+
+		static bool ensure_vars_loaded = ([] {
+			SavedVariables::Init();
+			return true;
+		})();
+
+		auto settings = std::make_unique<Group>("Settings");
+		settings->AddItem(std::make_unique<BoolCommandItem>("watchvariables"_J));
+		settings->AddItem(std::make_unique<IntCommandItem>("watchrate"_J));
+
+		auto variables = std::make_unique<Group>("Variables");
+		variables->AddItem(std::make_unique<ImGuiItem>([] {
+			auto& watches = VariableWatch::GetWatches();
+			if (watches.empty())
+			{
+				ImGui::TextDisabled("Save globals or locals to watch them");
+				return;
+			}
+
+			if (!ImGui::BeginTable("##watches", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0, 250)))
+				return;
+
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("Name");
+			ImGui::TableSetupColumn("Value");
+			ImGui::TableSetupColumn("Changed");
+			ImGui::TableSetupColumn("Changes");
+			ImGui::TableHeadersRow();
+
+			ImGuiListClipper clipper;
+			clipper.Begin(static_cast<int>(watches.size()));
+			while (clipper.Step())
+			{
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				{
+					auto& var = watches[i];
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					if (var.m_Script)
+						ImGui::Text("%s (%s)", var.m_Name.c_str(), Scripts::GetScriptName(var.m_Script->m_Hash));
+					else
+						ImGui::TextUnformatted(var.m_Name.c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(VariableWatch::Format(var.m_Type, var.m_Value).c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(FormatAge(var.m_Changed).c_str());
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", var.m_Changes);
+				}
+			}
+
+			ImGui::EndTable();
+		}));
+
+		auto history = std::make_unique<Group>("History");
+		history->AddItem(std::make_unique<ImGuiItem>([] {
+			auto& watches = VariableWatch::GetWatches();
+			auto size     = VariableWatch::GetHistorySize();
+
+			ImGui::Text("%zu of the last %zu changes", size, VariableWatch::HISTORY_SIZE);
+			if (auto dropped = VariableWatch::GetDropped())
+			{
+				ImGui::SameLine();
+				ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), "(%u missed while this wasn't open)", dropped);
+			}
+
+			if (ImGui::Button("Export"))
+			{
+				auto file = FileMgr::GetProjectFile("./variable_trace.csv");
+				if (VariableWatch::Export(file.Path()))
+					Notifications::Show("Watch", std::format("Exported {} changes to variable_trace.csv", size), NotificationType::Success);
+				else
+					Notifications::Show("Watch", "Failed to export the trace", NotificationType::Error);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Clear"))
+				VariableWatch::ClearHistory();
+
+			if (size == 0 || !ImGui::BeginTable("##history", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0, 250)))
+				return;
+
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("When");
+			ImGui::TableSetupColumn("Name");
+			ImGui::TableSetupColumn("Value");
+			ImGui::TableHeadersRow();
+
+			// newest first
+			ImGuiListClipper clipper;
+			clipper.Begin(static_cast<int>(size));
+			while (clipper.Step())
+			{
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				{
+					auto& change = VariableWatch::GetHistory(size - 1 - i);
+					auto& var    = watches[change.m_Watch];
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(FormatAge(change.m_Time).c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(var.m_Name.c_str());
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(VariableWatch::Format(var.m_Type, change.m_Value).c_str());
+				}
+			}
+
+			ImGui::EndTable();
+		}));
+
+		watch->AddItem(std::move(settings));
+		watch->AddItem(std::move(variables));
+		watch->AddItem(std::move(history));
+		return watch;
+	}
+}
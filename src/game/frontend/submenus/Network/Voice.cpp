@@ -37,10 +37,7 @@ namespace YimMenu::Submenus
 
 		player.GetGamerInfo()->m_GamerHandle2.Serialize(pkt);
 
-		for (auto& [_, player] : Players::GetPlayers())
-		{
-			pkt.Send(player, 13); // or 7?
-		}
+		pkt.SendToAll(13, true); // or 7?
 	}
 
 	void ShowVoiceFileSelectionMenu()
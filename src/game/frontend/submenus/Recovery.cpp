@@ -3,6 +3,7 @@
 #include "core/commands/BoolCommand.hpp"
 #include "core/commands/Commands.hpp"
 #include "game/backend/FiberPool.hpp"
+#include "game/backend/ScriptMgr.hpp"
 #include "game/frontend/items/Items.hpp"
 #include "game/rdr/ScriptFunction.hpp"
 #include "game/rdr/Scripts.hpp"
@@ -108,13 +109,13 @@ namespace YimMenu::Submenus
 
 				if (ImGui::Button("Give Selected"))
 				{
-					FiberPool::Push([] {
-						if (!Scripts::RequestScript("interactive_campfire"_J))
-							return;
+					ScriptMgr::AddTask([](joaat_t herb, int amount) -> ScriptTask {
+						if (!co_await ScriptLoaded("interactive_campfire"_J))
+							co_return;
 
 						for (int i = 0; i < amount; i++)
-							ScriptFunctions::GiveLootTableAward.StaticCall(selectedHerb, 0);
-					});
+							ScriptFunctions::GiveLootTableAward.StaticCall(herb, 0);
+					}(selectedHerb, amount));
 				}
 			}
 		}));
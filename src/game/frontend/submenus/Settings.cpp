@@ -63,6 +63,7 @@ namespace YimMenu::Submenus
 		// Peds
 		pedEsp->AddItem(std::make_shared<BoolCommandItem>("espdrawpeds"_J));
 		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<BoolCommandItem>("espdrawdeadpeds"_J)));
+		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<IntCommandItem>("espmaxdistancepeds"_J)));
 
 		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<BoolCommandItem>("espmodelspeds"_J, "Ped Hashes")));
 		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<ColorCommandItem>("hashcolorpeds"_J)));
@@ -79,6 +80,8 @@ namespace YimMenu::Submenus
 		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<BoolCommandItem>("espskeletonhorse"_J, "Horse Skeleton")));
 		pedEsp->AddItem(std::make_shared<ConditionalItem>("espdrawpeds"_J, std::make_shared<ColorCommandItem>("skeletoncolorhorse"_J)));
 
+		misc->AddItem(std::make_shared<IntCommandItem>("espupdaterate"_J));
+
 		overlay->AddItem(std::make_shared<BoolCommandItem>("overlay"_J));
 		overlay->AddItem(std::make_shared<ConditionalItem>("overlay"_J, std::make_shared<BoolCommandItem>("overlayfps"_J)));
 
@@ -97,6 +100,8 @@ namespace YimMenu::Submenus
 		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockptfx"_J));
 		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockclearpedtasks"_J));
 		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockscriptcommand"_J));
+		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockeventflood"_J));
+		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockmessageflood"_J));
 		networkEventGroup->AddItem(std::make_shared<BoolCommandItem>("userelaycxns"_J));
 
 		scriptEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockhonormanipulation"_J));
@@ -108,6 +113,7 @@ namespace YimMenu::Submenus
 		scriptEventGroup->AddItem(std::make_shared<BoolCommandItem>("blocktickerspam"_J));
 		scriptEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockstableevents"_J));
 		scriptEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockkickfrommissionlobby"_J));
+		scriptEventGroup->AddItem(std::make_shared<BoolCommandItem>("blockscripteventflood"_J));
 
 		gui->AddItem(playerEsp);
 		gui->AddItem(pedEsp);
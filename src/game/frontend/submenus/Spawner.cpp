@@ -9,6 +9,8 @@
 #include "game/backend/NativeHooks.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
+#include "game/backend/Streaming.hpp"
+#include "game/frontend/FilteredList.hpp"
 #include "game/frontend/items/Items.hpp"
 #include "game/frontend/Menu.hpp"
 #include "game/hooks/Hooks.hpp"
@@ -16,6 +18,7 @@
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/Pools.hpp"
 #include "game/rdr/data/PedModels.hpp"
+#include "game/rdr/data/SearchIndices.hpp"
 
 #include <algorithm>
 #include <game/rdr/Natives.hpp>
@@ -110,23 +113,16 @@ namespace YimMenu::Submenus
 	{
 		if (data->EventFlag == ImGuiInputTextFlags_CallbackCompletion)
 		{
-			std::string newText{};
-			std::string inputLower = data->Buf;
-			std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
-			for (const auto& [key, model] : Data::g_PedModels)
-			{
-				std::string modelLower = model;
-				std::transform(modelLower.begin(), modelLower.end(), modelLower.begin(), ::tolower);
-				if (modelLower.find(inputLower) != std::string::npos)
-				{
-					newText = model;
-				}
-			}
+			// tab completes to the last model that matches
+			auto& index = Data::GetPedModelIndex();
+			std::vector<std::uint32_t> matches;
+			index.Search(data->Buf, matches);
 
-			if (!newText.empty())
+			if (!matches.empty())
 			{
+				auto model = index.GetName(matches.back());
 				data->DeleteChars(0, data->BufTextLen);
-				data->InsertChars(0, newText.c_str());
+				data->InsertChars(0, model.data(), model.data() + model.size());
 			}
 
 			return 1;
@@ -361,15 +357,7 @@ namespace YimMenu::Submenus
 		// core search matching function
 		static bool MatchesSearch(const std::string& text, const std::string& searchTerm)
 		{
-			if (searchTerm.empty())
-				return true;
-
-			std::string textLower = text;
-			std::string searchLower = searchTerm;
-			std::transform(textLower.begin(), textLower.end(), textLower.begin(), ::tolower);
-			std::transform(searchLower.begin(), searchLower.end(), searchLower.begin(), ::tolower);
-
-			return textLower.find(searchLower) != std::string::npos;
+			return searchTerm.empty() || FilteredList::Contains(text, searchTerm);
 		}
 
 		// check if section name matches search
@@ -378,20 +366,22 @@ namespace YimMenu::Submenus
 			return MatchesSearch(sectionName, searchTerm);
 		}
 
-		// count matching items in a collection
+		// the cached names and matches of a collection, refreshed when the search text has changed
 		template<typename Container, typename GetNameFunc>
-		static int CountMatches(const Container& items, const std::string& searchTerm, GetNameFunc getName)
+		FilteredList& GetList(const Container& items, GetNameFunc getName)
 		{
-			if (searchTerm.empty())
-				return static_cast<int>(items.size());
+			auto& list = m_Lists[&items];
+			if (list.GetSize() != items.size())
+				list.Assign(items, getName);
+			list.SetSearch(searchBuffer);
+			return list;
+		}
 
-			int count = 0;
-			for (const auto& item : items)
-			{
-				if (MatchesSearch(getName(item), searchTerm))
-					count++;
-			}
-			return count;
+		// count matching items in a collection
+		template<typename Container, typename GetNameFunc>
+		int CountMatches(const Container& items, GetNameFunc getName)
+		{
+			return static_cast<int>(GetList(items, getName).GetMatches().size());
 		}
 
 		// render search bar with count display and optional gender selection for horses
@@ -442,12 +432,28 @@ namespace YimMenu::Submenus
 			ImGui::Spacing();
 		}
 
-		// check if item should be visible based on search criteria
-		template<typename Item, typename GetNameFunc>
-		bool ShouldShowItem(const Item& item, bool sectionMatches, GetNameFunc getName) const
+		// draw the items of a collection that match the search, or all of them if the whole section matches. only the rows
+		// that are in view are drawn, each one inside its own ID scope
+		template<typename Container, typename GetNameFunc, typename DrawFunc>
+		void RenderList(const Container& items, bool sectionMatches, GetNameFunc getName, DrawFunc drawItem)
 		{
-			return sectionMatches || MatchesSearch(getName(item), searchBuffer);
+			auto drawRow = [&](std::size_t index) {
+				ImGui::PushID(static_cast<int>(index));
+				drawItem(items[index]);
+				ImGui::PopID();
+			};
+
+			ImGui::PushID(&items);
+			if (sectionMatches)
+				FilteredList::DrawRows(items.size(), drawRow);
+			else
+				GetList(items, getName).Draw(drawRow);
+			ImGui::PopID();
 		}
+
+	private:
+		// keyed by the address of the collection
+		std::unordered_map<const void*, FilteredList> m_Lists;
 	};
 
 	// search instances for each navigation menu
@@ -455,6 +461,7 @@ namespace YimMenu::Submenus
 	static SearchHelper<void> g_HumanSearch;  // placeholder for future use
 	static SearchHelper<void> g_HorseSearch;  // placeholder for future use
 	static SearchHelper<void> g_FishSearch;   // placeholder for future use
+	static SearchHelper<void> g_UnifiedSearch; // the search all peds dropdown
 
 	// forward declaration
 	static void SetHorseGender(Ped horse, int gender);
@@ -462,14 +469,11 @@ namespace YimMenu::Submenus
 	// function to set player model (based on existing "Set Model" button logic)
 	static void SetPlayerModel(const std::string& model, int variation = 0, bool isHorse = false)
 	{
-		FiberPool::Push([model, variation, isHorse] {
+		ScriptMgr::AddTask([](std::string model, int variation, bool isHorse) -> ScriptTask {
 			auto modelHash = Joaat(model);
 
-			for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(modelHash); i++)
-			{
-				STREAMING::REQUEST_MODEL(modelHash, false);
-				ScriptMgr::Yield();
-			}
+			if (!co_await ModelLoaded(modelHash))
+				co_return;
 
 			PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), modelHash, false);
 			Self::Update();
@@ -494,12 +498,10 @@ namespace YimMenu::Submenus
 				auto weapon = GetDefaultWeaponForPed(model);
 				WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
 				WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-				ScriptMgr::Yield();
+				co_await NextFrame();
 				WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
 			}
-
-			STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(modelHash);
-		});
+		}(model, variation, isHorse));
 	}
 
 	// function to set horse gender using discovered community natives
@@ -2995,43 +2997,43 @@ namespace YimMenu::Submenus
 
 		// count visible humans in each section
 		int ambientFemaleVisible = ambientFemaleMatches ? static_cast<int>(g_AmbientFemale.size()) :
-		                          g_HumanSearch.CountMatches(g_AmbientFemale, g_HumanSearch.searchBuffer, getHumanName);
+		                          g_HumanSearch.CountMatches(g_AmbientFemale, getHumanName);
 		int ambientFemaleOrdinaryVisible = ambientFemaleOrdinaryMatches ? static_cast<int>(g_AmbientFemaleOrdinary.size()) :
-		                                  g_HumanSearch.CountMatches(g_AmbientFemaleOrdinary, g_HumanSearch.searchBuffer, getHumanName);
+		                                  g_HumanSearch.CountMatches(g_AmbientFemaleOrdinary, getHumanName);
 		int ambientMaleVisible = ambientMaleMatches ? static_cast<int>(g_AmbientMale.size()) :
-		                        g_HumanSearch.CountMatches(g_AmbientMale, g_HumanSearch.searchBuffer, getHumanName);
+		                        g_HumanSearch.CountMatches(g_AmbientMale, getHumanName);
 		int ambientMaleOrdinaryVisible = ambientMaleOrdinaryMatches ? static_cast<int>(g_AmbientMaleOrdinary.size()) :
-		                                g_HumanSearch.CountMatches(g_AmbientMaleOrdinary, g_HumanSearch.searchBuffer, getHumanName);
+		                                g_HumanSearch.CountMatches(g_AmbientMaleOrdinary, getHumanName);
 		int ambientMaleSuppressedVisible = ambientMaleSuppressedMatches ? static_cast<int>(g_AmbientMaleSuppressed.size()) :
-		                                  g_HumanSearch.CountMatches(g_AmbientMaleSuppressed, g_HumanSearch.searchBuffer, getHumanName);
+		                                  g_HumanSearch.CountMatches(g_AmbientMaleSuppressed, getHumanName);
 		int cutsceneVisible = cutsceneMatches ? static_cast<int>(g_Cutscene.size()) :
-		                     g_HumanSearch.CountMatches(g_Cutscene, g_HumanSearch.searchBuffer, getHumanName);
+		                     g_HumanSearch.CountMatches(g_Cutscene, getHumanName);
 		int multiplayerCutsceneVisible = multiplayerCutsceneMatches ? static_cast<int>(g_MultiplayerCutscene.size()) :
-		                                g_HumanSearch.CountMatches(g_MultiplayerCutscene, g_HumanSearch.searchBuffer, getHumanName);
+		                                g_HumanSearch.CountMatches(g_MultiplayerCutscene, getHumanName);
 		int gangVisible = gangMatches ? static_cast<int>(g_Gang.size()) :
-		                 g_HumanSearch.CountMatches(g_Gang, g_HumanSearch.searchBuffer, getHumanName);
+		                 g_HumanSearch.CountMatches(g_Gang, getHumanName);
 		int storyFinaleVisible = storyFinaleMatches ? static_cast<int>(g_StoryFinale.size()) :
-		                        g_HumanSearch.CountMatches(g_StoryFinale, g_HumanSearch.searchBuffer, getHumanName);
+		                        g_HumanSearch.CountMatches(g_StoryFinale, getHumanName);
 		int multiplayerBloodMoneyVisible = multiplayerBloodMoneyMatches ? static_cast<int>(g_MultiplayerBloodMoney.size()) :
-		                                  g_HumanSearch.CountMatches(g_MultiplayerBloodMoney, g_HumanSearch.searchBuffer, getHumanName);
+		                                  g_HumanSearch.CountMatches(g_MultiplayerBloodMoney, getHumanName);
 		int multiplayerBountyHuntersVisible = multiplayerBountyHuntersMatches ? static_cast<int>(g_MultiplayerBountyHunters.size()) :
-		                                     g_HumanSearch.CountMatches(g_MultiplayerBountyHunters, g_HumanSearch.searchBuffer, getHumanName);
+		                                     g_HumanSearch.CountMatches(g_MultiplayerBountyHunters, getHumanName);
 		int multiplayerNaturalistVisible = multiplayerNaturalistMatches ? static_cast<int>(g_MultiplayerNaturalist.size()) :
-		                                  g_HumanSearch.CountMatches(g_MultiplayerNaturalist, g_HumanSearch.searchBuffer, getHumanName);
+		                                  g_HumanSearch.CountMatches(g_MultiplayerNaturalist, getHumanName);
 		int multiplayerVisible = multiplayerMatches ? static_cast<int>(g_Multiplayer.size()) :
-		                        g_HumanSearch.CountMatches(g_Multiplayer, g_HumanSearch.searchBuffer, getHumanName);
+		                        g_HumanSearch.CountMatches(g_Multiplayer, getHumanName);
 		int storyVisible = storyMatches ? static_cast<int>(g_Story.size()) :
-		                  g_HumanSearch.CountMatches(g_Story, g_HumanSearch.searchBuffer, getHumanName);
+		                  g_HumanSearch.CountMatches(g_Story, getHumanName);
 		int randomEventVisible = randomEventMatches ? static_cast<int>(g_RandomEvent.size()) :
-		                        g_HumanSearch.CountMatches(g_RandomEvent, g_HumanSearch.searchBuffer, getHumanName);
+		                        g_HumanSearch.CountMatches(g_RandomEvent, getHumanName);
 		int scenarioVisible = scenarioMatches ? static_cast<int>(g_Scenario.size()) :
-		                     g_HumanSearch.CountMatches(g_Scenario, g_HumanSearch.searchBuffer, getHumanName);
+		                     g_HumanSearch.CountMatches(g_Scenario, getHumanName);
 		int storyScenarioFemaleVisible = storyScenarioFemaleMatches ? static_cast<int>(g_StoryScenarioFemale.size()) :
-		                                g_HumanSearch.CountMatches(g_StoryScenarioFemale, g_HumanSearch.searchBuffer, getHumanName);
+		                                g_HumanSearch.CountMatches(g_StoryScenarioFemale, getHumanName);
 		int storyScenarioMaleVisible = storyScenarioMaleMatches ? static_cast<int>(g_StoryScenarioMale.size()) :
-		                              g_HumanSearch.CountMatches(g_StoryScenarioMale, g_HumanSearch.searchBuffer, getHumanName);
+		                              g_HumanSearch.CountMatches(g_StoryScenarioMale, getHumanName);
 		int miscellaneousVisible = miscellaneousMatches ? static_cast<int>(g_Miscellaneous.size()) :
-		                          g_HumanSearch.CountMatches(g_Miscellaneous, g_HumanSearch.searchBuffer, getHumanName);
+		                          g_HumanSearch.CountMatches(g_Miscellaneous, getHumanName);
 
 		// determine section visibility
 		bool showAmbientFemale = ambientFemaleMatches || (ambientFemaleVisible > 0);
@@ -3085,27 +3087,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Ambient Female");
 
-			for (size_t i = 0; i < g_AmbientFemale.size(); ++i)
-			{
-				const auto& human = g_AmbientFemale[i];
-				if (g_HumanSearch.ShouldShowItem(human, ambientFemaleMatches, getHumanName))
+			g_HumanSearch.RenderList(g_AmbientFemale, ambientFemaleMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmbientFemale_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3115,27 +3109,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Ambient Female Ordinary");
 
-			for (size_t i = 0; i < g_AmbientFemaleOrdinary.size(); ++i)
-			{
-				const auto& human = g_AmbientFemaleOrdinary[i];
-				if (g_HumanSearch.ShouldShowItem(human, ambientFemaleOrdinaryMatches, getHumanName))
+			g_HumanSearch.RenderList(g_AmbientFemaleOrdinary, ambientFemaleOrdinaryMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmbientFemaleOrdinary_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3145,27 +3131,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Ambient Male");
 
-			for (size_t i = 0; i < g_AmbientMale.size(); ++i)
-			{
-				const auto& human = g_AmbientMale[i];
-				if (g_HumanSearch.ShouldShowItem(human, ambientMaleMatches, getHumanName))
+			g_HumanSearch.RenderList(g_AmbientMale, ambientMaleMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmbientMale_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3175,27 +3153,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Ambient Male Ordinary");
 
-			for (size_t i = 0; i < g_AmbientMaleOrdinary.size(); ++i)
-			{
-				const auto& human = g_AmbientMaleOrdinary[i];
-				if (g_HumanSearch.ShouldShowItem(human, ambientMaleOrdinaryMatches, getHumanName))
+			g_HumanSearch.RenderList(g_AmbientMaleOrdinary, ambientMaleOrdinaryMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmbientMaleOrdinary_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3205,27 +3175,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Ambient Male Suppressed");
 
-			for (size_t i = 0; i < g_AmbientMaleSuppressed.size(); ++i)
-			{
-				const auto& human = g_AmbientMaleSuppressed[i];
-				if (g_HumanSearch.ShouldShowItem(human, ambientMaleSuppressedMatches, getHumanName))
+			g_HumanSearch.RenderList(g_AmbientMaleSuppressed, ambientMaleSuppressedMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmbientMaleSuppressed_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3235,27 +3197,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Cutscene");
 
-			for (size_t i = 0; i < g_Cutscene.size(); ++i)
-			{
-				const auto& human = g_Cutscene[i];
-				if (g_HumanSearch.ShouldShowItem(human, cutsceneMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Cutscene, cutsceneMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Cutscene_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3265,27 +3219,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Multiplayer Cutscene");
 
-			for (size_t i = 0; i < g_MultiplayerCutscene.size(); ++i)
-			{
-				const auto& human = g_MultiplayerCutscene[i];
-				if (g_HumanSearch.ShouldShowItem(human, multiplayerCutsceneMatches, getHumanName))
+			g_HumanSearch.RenderList(g_MultiplayerCutscene, multiplayerCutsceneMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("MultiplayerCutscene_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3295,27 +3241,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Gang");
 
-			for (size_t i = 0; i < g_Gang.size(); ++i)
-			{
-				const auto& human = g_Gang[i];
-				if (g_HumanSearch.ShouldShowItem(human, gangMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Gang, gangMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Gang_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3325,27 +3263,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Story Finale");
 
-			for (size_t i = 0; i < g_StoryFinale.size(); ++i)
-			{
-				const auto& human = g_StoryFinale[i];
-				if (g_HumanSearch.ShouldShowItem(human, storyFinaleMatches, getHumanName))
+			g_HumanSearch.RenderList(g_StoryFinale, storyFinaleMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("StoryFinale_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3355,27 +3285,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Multiplayer Blood Money");
 
-			for (size_t i = 0; i < g_MultiplayerBloodMoney.size(); ++i)
-			{
-				const auto& human = g_MultiplayerBloodMoney[i];
-				if (g_HumanSearch.ShouldShowItem(human, multiplayerBloodMoneyMatches, getHumanName))
+			g_HumanSearch.RenderList(g_MultiplayerBloodMoney, multiplayerBloodMoneyMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("MultiplayerBloodMoney_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3385,27 +3307,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Multiplayer Bounty Hunters");
 
-			for (size_t i = 0; i < g_MultiplayerBountyHunters.size(); ++i)
-			{
-				const auto& human = g_MultiplayerBountyHunters[i];
-				if (g_HumanSearch.ShouldShowItem(human, multiplayerBountyHuntersMatches, getHumanName))
+			g_HumanSearch.RenderList(g_MultiplayerBountyHunters, multiplayerBountyHuntersMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("MultiplayerBountyHunters_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3415,27 +3329,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Multiplayer Naturalist");
 
-			for (size_t i = 0; i < g_MultiplayerNaturalist.size(); ++i)
-			{
-				const auto& human = g_MultiplayerNaturalist[i];
-				if (g_HumanSearch.ShouldShowItem(human, multiplayerNaturalistMatches, getHumanName))
+			g_HumanSearch.RenderList(g_MultiplayerNaturalist, multiplayerNaturalistMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("MultiplayerNaturalist_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3445,27 +3351,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Multiplayer");
 
-			for (size_t i = 0; i < g_Multiplayer.size(); ++i)
-			{
-				const auto& human = g_Multiplayer[i];
-				if (g_HumanSearch.ShouldShowItem(human, multiplayerMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Multiplayer, multiplayerMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Multiplayer_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3475,27 +3373,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Story");
 
-			for (size_t i = 0; i < g_Story.size(); ++i)
-			{
-				const auto& human = g_Story[i];
-				if (g_HumanSearch.ShouldShowItem(human, storyMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Story, storyMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Story_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3505,27 +3395,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Random Event");
 
-			for (size_t i = 0; i < g_RandomEvent.size(); ++i)
-			{
-				const auto& human = g_RandomEvent[i];
-				if (g_HumanSearch.ShouldShowItem(human, randomEventMatches, getHumanName))
+			g_HumanSearch.RenderList(g_RandomEvent, randomEventMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("RandomEvent_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3535,27 +3417,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Scenario");
 
-			for (size_t i = 0; i < g_Scenario.size(); ++i)
-			{
-				const auto& human = g_Scenario[i];
-				if (g_HumanSearch.ShouldShowItem(human, scenarioMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Scenario, scenarioMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Scenario_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3565,27 +3439,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Story Scenario Female");
 
-			for (size_t i = 0; i < g_StoryScenarioFemale.size(); ++i)
-			{
-				const auto& human = g_StoryScenarioFemale[i];
-				if (g_HumanSearch.ShouldShowItem(human, storyScenarioFemaleMatches, getHumanName))
+			g_HumanSearch.RenderList(g_StoryScenarioFemale, storyScenarioFemaleMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("StoryScenarioFemale_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3595,27 +3461,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Story Scenario Male");
 
-			for (size_t i = 0; i < g_StoryScenarioMale.size(); ++i)
-			{
-				const auto& human = g_StoryScenarioMale[i];
-				if (g_HumanSearch.ShouldShowItem(human, storyScenarioMaleMatches, getHumanName))
+			g_HumanSearch.RenderList(g_StoryScenarioMale, storyScenarioMaleMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("StoryScenarioMale_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3625,27 +3483,19 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Miscellaneous");
 
-			for (size_t i = 0; i < g_Miscellaneous.size(); ++i)
-			{
-				const auto& human = g_Miscellaneous[i];
-				if (g_HumanSearch.ShouldShowItem(human, miscellaneousMatches, getHumanName))
+			g_HumanSearch.RenderList(g_Miscellaneous, miscellaneousMatches, getHumanName, [&](const auto& human) {
+				if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Miscellaneous_" + human.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(human.model.c_str(), ImVec2(-1, 25)))
+					if (g_SetModelMode)
 					{
-						if (g_SetModelMode)
-						{
-							SetPlayerModel(human.model, g_Variation);
-						}
-						else
-						{
-							SpawnPed(human.model, g_Variation, g_Armed);
-						}
+						SetPlayerModel(human.model, g_Variation);
+					}
+					else
+					{
+						SpawnPed(human.model, g_Variation, g_Armed);
 					}
-					ImGui::PopID();
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -3989,57 +3839,57 @@ namespace YimMenu::Submenus
 
 		// count visible horses in each section
 		int americanPaintVisible = americanPaintMatches ? static_cast<int>(g_AmericanPaintHorses.size()) :
-		                          g_HorseSearch.CountMatches(g_AmericanPaintHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                          g_HorseSearch.CountMatches(g_AmericanPaintHorses, getHorseName);
 		int americanStandardbredVisible = americanStandardbredMatches ? static_cast<int>(g_AmericanStandardbredHorses.size()) :
-		                                 g_HorseSearch.CountMatches(g_AmericanStandardbredHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                                 g_HorseSearch.CountMatches(g_AmericanStandardbredHorses, getHorseName);
 		int andalusianVisible = andalusianMatches ? static_cast<int>(g_AndalusianHorses.size()) :
-		                       g_HorseSearch.CountMatches(g_AndalusianHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                       g_HorseSearch.CountMatches(g_AndalusianHorses, getHorseName);
 		int appaloosaVisible = appaloosaMatches ? static_cast<int>(g_AppaloosaHorses.size()) :
-		                      g_HorseSearch.CountMatches(g_AppaloosaHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                      g_HorseSearch.CountMatches(g_AppaloosaHorses, getHorseName);
 		int arabianVisible = arabianMatches ? static_cast<int>(g_ArabianHorses.size()) :
-		                    g_HorseSearch.CountMatches(g_ArabianHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                    g_HorseSearch.CountMatches(g_ArabianHorses, getHorseName);
 		int ardennesVisible = ardennesMatches ? static_cast<int>(g_ArdennesHorses.size()) :
-		                     g_HorseSearch.CountMatches(g_ArdennesHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                     g_HorseSearch.CountMatches(g_ArdennesHorses, getHorseName);
 		int belgianVisible = belgianMatches ? static_cast<int>(g_BelgianHorses.size()) :
-		                    g_HorseSearch.CountMatches(g_BelgianHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                    g_HorseSearch.CountMatches(g_BelgianHorses, getHorseName);
 		int bretonVisible = bretonMatches ? static_cast<int>(g_BretonHorses.size()) :
-		                   g_HorseSearch.CountMatches(g_BretonHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                   g_HorseSearch.CountMatches(g_BretonHorses, getHorseName);
 		int criolloVisible = criolloMatches ? static_cast<int>(g_CriolloHorses.size()) :
-		                    g_HorseSearch.CountMatches(g_CriolloHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                    g_HorseSearch.CountMatches(g_CriolloHorses, getHorseName);
 		int dutchWarmbloodVisible = dutchWarmbloodMatches ? static_cast<int>(g_DutchWarmbloodHorses.size()) :
-		                           g_HorseSearch.CountMatches(g_DutchWarmbloodHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                           g_HorseSearch.CountMatches(g_DutchWarmbloodHorses, getHorseName);
 		int gangVisible = gangMatches ? static_cast<int>(g_GangHorses.size()) :
-		                 g_HorseSearch.CountMatches(g_GangHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                 g_HorseSearch.CountMatches(g_GangHorses, getHorseName);
 		int gypsyCobVisible = gypsyCobMatches ? static_cast<int>(g_GypsyCobHorses.size()) :
-		                     g_HorseSearch.CountMatches(g_GypsyCobHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                     g_HorseSearch.CountMatches(g_GypsyCobHorses, getHorseName);
 		int hungarianHalfbredVisible = hungarianHalfbredMatches ? static_cast<int>(g_HungarianHalfbredHorses.size()) :
-		                              g_HorseSearch.CountMatches(g_HungarianHalfbredHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                              g_HorseSearch.CountMatches(g_HungarianHalfbredHorses, getHorseName);
 		int kentuckySaddlerVisible = kentuckySaddlerMatches ? static_cast<int>(g_KentuckySaddlerHorses.size()) :
-		                            g_HorseSearch.CountMatches(g_KentuckySaddlerHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                            g_HorseSearch.CountMatches(g_KentuckySaddlerHorses, getHorseName);
 		int klardruberVisible = klardruberMatches ? static_cast<int>(g_KlardruberHorses.size()) :
-		                       g_HorseSearch.CountMatches(g_KlardruberHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                       g_HorseSearch.CountMatches(g_KlardruberHorses, getHorseName);
 		int missouriFoxTrotterVisible = missouriFoxTrotterMatches ? static_cast<int>(g_MissouriFoxTrotterHorses.size()) :
-		                               g_HorseSearch.CountMatches(g_MissouriFoxTrotterHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                               g_HorseSearch.CountMatches(g_MissouriFoxTrotterHorses, getHorseName);
 		int morganVisible = morganMatches ? static_cast<int>(g_MorganHorses.size()) :
-		                   g_HorseSearch.CountMatches(g_MorganHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                   g_HorseSearch.CountMatches(g_MorganHorses, getHorseName);
 		int mustangVisible = mustangMatches ? static_cast<int>(g_MustangHorses.size()) :
-		                    g_HorseSearch.CountMatches(g_MustangHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                    g_HorseSearch.CountMatches(g_MustangHorses, getHorseName);
 		int nokotaVisible = nokotaMatches ? static_cast<int>(g_NokotaHorses.size()) :
-		                   g_HorseSearch.CountMatches(g_NokotaHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                   g_HorseSearch.CountMatches(g_NokotaHorses, getHorseName);
 		int norfolkRoadsterVisible = norfolkRoadsterMatches ? static_cast<int>(g_NorfolkRoadsterHorses.size()) :
-		                            g_HorseSearch.CountMatches(g_NorfolkRoadsterHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                            g_HorseSearch.CountMatches(g_NorfolkRoadsterHorses, getHorseName);
 		int shireVisible = shireMatches ? static_cast<int>(g_ShireHorses.size()) :
-		                  g_HorseSearch.CountMatches(g_ShireHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                  g_HorseSearch.CountMatches(g_ShireHorses, getHorseName);
 		int suffolkPunchVisible = suffolkPunchMatches ? static_cast<int>(g_SuffolkPunchHorses.size()) :
-		                         g_HorseSearch.CountMatches(g_SuffolkPunchHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                         g_HorseSearch.CountMatches(g_SuffolkPunchHorses, getHorseName);
 		int tennesseeWalkerVisible = tennesseeWalkerMatches ? static_cast<int>(g_TennesseeWalkerHorses.size()) :
-		                            g_HorseSearch.CountMatches(g_TennesseeWalkerHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                            g_HorseSearch.CountMatches(g_TennesseeWalkerHorses, getHorseName);
 		int thoroughbredVisible = thoroughbredMatches ? static_cast<int>(g_ThoroughbredHorses.size()) :
-		                         g_HorseSearch.CountMatches(g_ThoroughbredHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                         g_HorseSearch.CountMatches(g_ThoroughbredHorses, getHorseName);
 		int turkomanVisible = turkomanMatches ? static_cast<int>(g_TurkomanHorses.size()) :
-		                     g_HorseSearch.CountMatches(g_TurkomanHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                     g_HorseSearch.CountMatches(g_TurkomanHorses, getHorseName);
 		int miscellaneousVisible = miscellaneousMatches ? static_cast<int>(g_MiscellaneousHorses.size()) :
-		                          g_HorseSearch.CountMatches(g_MiscellaneousHorses, g_HorseSearch.searchBuffer, getHorseName);
+		                          g_HorseSearch.CountMatches(g_MiscellaneousHorses, getHorseName);
 
 		// determine section visibility
 		bool showAmericanPaint = americanPaintMatches || (americanPaintVisible > 0);
@@ -4082,20 +3932,12 @@ namespace YimMenu::Submenus
 		if (showAmericanPaint)
 		{
 			RenderCenteredSeparator("American Paint");
-			for (size_t i = 0; i < g_AmericanPaintHorses.size(); ++i)
-			{
-				const auto& horse = g_AmericanPaintHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, americanPaintMatches, getHorseName))
+			g_HorseSearch.RenderList(g_AmericanPaintHorses, americanPaintMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmericanPaint_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4103,20 +3945,12 @@ namespace YimMenu::Submenus
 		if (showAmericanStandardbred)
 		{
 			RenderCenteredSeparator("American Standardbred");
-			for (size_t i = 0; i < g_AmericanStandardbredHorses.size(); ++i)
-			{
-				const auto& horse = g_AmericanStandardbredHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, americanStandardbredMatches, getHorseName))
+			g_HorseSearch.RenderList(g_AmericanStandardbredHorses, americanStandardbredMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("AmericanStandardbred_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4124,20 +3958,12 @@ namespace YimMenu::Submenus
 		if (showAndalusian)
 		{
 			RenderCenteredSeparator("Andalusian");
-			for (size_t i = 0; i < g_AndalusianHorses.size(); ++i)
-			{
-				const auto& horse = g_AndalusianHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, andalusianMatches, getHorseName))
+			g_HorseSearch.RenderList(g_AndalusianHorses, andalusianMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Andalusian_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4145,20 +3971,12 @@ namespace YimMenu::Submenus
 		if (showAppaloosa)
 		{
 			RenderCenteredSeparator("Appaloosa");
-			for (size_t i = 0; i < g_AppaloosaHorses.size(); ++i)
-			{
-				const auto& horse = g_AppaloosaHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, appaloosaMatches, getHorseName))
+			g_HorseSearch.RenderList(g_AppaloosaHorses, appaloosaMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Appaloosa_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4166,20 +3984,12 @@ namespace YimMenu::Submenus
 		if (showArabian)
 		{
 			RenderCenteredSeparator("Arabian");
-			for (size_t i = 0; i < g_ArabianHorses.size(); ++i)
-			{
-				const auto& horse = g_ArabianHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, arabianMatches, getHorseName))
+			g_HorseSearch.RenderList(g_ArabianHorses, arabianMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Arabian_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4187,20 +3997,12 @@ namespace YimMenu::Submenus
 		if (showArdennes)
 		{
 			RenderCenteredSeparator("Ardennes");
-			for (size_t i = 0; i < g_ArdennesHorses.size(); ++i)
-			{
-				const auto& horse = g_ArdennesHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, ardennesMatches, getHorseName))
+			g_HorseSearch.RenderList(g_ArdennesHorses, ardennesMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Ardennes_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4208,20 +4010,12 @@ namespace YimMenu::Submenus
 		if (showBelgian)
 		{
 			RenderCenteredSeparator("Belgian");
-			for (size_t i = 0; i < g_BelgianHorses.size(); ++i)
-			{
-				const auto& horse = g_BelgianHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, belgianMatches, getHorseName))
+			g_HorseSearch.RenderList(g_BelgianHorses, belgianMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("Belgian_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4229,20 +4023,12 @@ namespace YimMenu::Submenus
 		if (showBreton)
 		{
 			RenderCenteredSeparator("Breton");
-			for (size_t i = 0; i < g_BretonHorses.size(); ++i)
-			{
-				const auto& horse = g_BretonHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, bretonMatches, getHorseName))
+			g_HorseSearch.RenderList(g_BretonHorses, bretonMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Breton_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4250,20 +4036,12 @@ namespace YimMenu::Submenus
 		if (showCriollo)
 		{
 			RenderCenteredSeparator("Criollo");
-			for (size_t i = 0; i < g_CriolloHorses.size(); ++i)
-			{
-				const auto& horse = g_CriolloHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, criolloMatches, getHorseName))
+			g_HorseSearch.RenderList(g_CriolloHorses, criolloMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Criollo_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4271,20 +4049,12 @@ namespace YimMenu::Submenus
 		if (showDutchWarmblood)
 		{
 			RenderCenteredSeparator("Dutch Warmblood");
-			for (size_t i = 0; i < g_DutchWarmbloodHorses.size(); ++i)
-			{
-				const auto& horse = g_DutchWarmbloodHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, dutchWarmbloodMatches, getHorseName))
+			g_HorseSearch.RenderList(g_DutchWarmbloodHorses, dutchWarmbloodMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("DutchWarmblood_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4292,20 +4062,12 @@ namespace YimMenu::Submenus
 		if (showGang)
 		{
 			RenderCenteredSeparator("Gang");
-			for (size_t i = 0; i < g_GangHorses.size(); ++i)
-			{
-				const auto& horse = g_GangHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, gangMatches, getHorseName))
+			g_HorseSearch.RenderList(g_GangHorses, gangMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Gang_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4313,20 +4075,12 @@ namespace YimMenu::Submenus
 		if (showGypsyCob)
 		{
 			RenderCenteredSeparator("Gypsy Cob");
-			for (size_t i = 0; i < g_GypsyCobHorses.size(); ++i)
-			{
-				const auto& horse = g_GypsyCobHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, gypsyCobMatches, getHorseName))
+			g_HorseSearch.RenderList(g_GypsyCobHorses, gypsyCobMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("GypsyCob_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4334,20 +4088,12 @@ namespace YimMenu::Submenus
 		if (showHungarianHalfbred)
 		{
 			RenderCenteredSeparator("Hungarian Halfbred");
-			for (size_t i = 0; i < g_HungarianHalfbredHorses.size(); ++i)
-			{
-				const auto& horse = g_HungarianHalfbredHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, hungarianHalfbredMatches, getHorseName))
+			g_HorseSearch.RenderList(g_HungarianHalfbredHorses, hungarianHalfbredMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("HungarianHalfbred_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4355,20 +4101,12 @@ namespace YimMenu::Submenus
 		if (showKentuckySaddler)
 		{
 			RenderCenteredSeparator("Kentucky Saddler");
-			for (size_t i = 0; i < g_KentuckySaddlerHorses.size(); ++i)
-			{
-				const auto& horse = g_KentuckySaddlerHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, kentuckySaddlerMatches, getHorseName))
+			g_HorseSearch.RenderList(g_KentuckySaddlerHorses, kentuckySaddlerMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("KentuckySaddler_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4376,20 +4114,12 @@ namespace YimMenu::Submenus
 		if (showKlardruber)
 		{
 			RenderCenteredSeparator("Klardruber");
-			for (size_t i = 0; i < g_KlardruberHorses.size(); ++i)
-			{
-				const auto& horse = g_KlardruberHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, klardruberMatches, getHorseName))
+			g_HorseSearch.RenderList(g_KlardruberHorses, klardruberMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Klardruber_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4397,20 +4127,12 @@ namespace YimMenu::Submenus
 		if (showMissouriFoxTrotter)
 		{
 			RenderCenteredSeparator("Missouri Fox Trotter");
-			for (size_t i = 0; i < g_MissouriFoxTrotterHorses.size(); ++i)
-			{
-				const auto& horse = g_MissouriFoxTrotterHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, missouriFoxTrotterMatches, getHorseName))
+			g_HorseSearch.RenderList(g_MissouriFoxTrotterHorses, missouriFoxTrotterMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("MissouriFoxTrotter_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4418,20 +4140,12 @@ namespace YimMenu::Submenus
 		if (showMorgan)
 		{
 			RenderCenteredSeparator("Morgan");
-			for (size_t i = 0; i < g_MorganHorses.size(); ++i)
-			{
-				const auto& horse = g_MorganHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, morganMatches, getHorseName))
+			g_HorseSearch.RenderList(g_MorganHorses, morganMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Morgan_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4439,20 +4153,12 @@ namespace YimMenu::Submenus
 		if (showMustang)
 		{
 			RenderCenteredSeparator("Mustang");
-			for (size_t i = 0; i < g_MustangHorses.size(); ++i)
-			{
-				const auto& horse = g_MustangHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, mustangMatches, getHorseName))
+			g_HorseSearch.RenderList(g_MustangHorses, mustangMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Mustang_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4460,20 +4166,12 @@ namespace YimMenu::Submenus
 		if (showNokota)
 		{
 			RenderCenteredSeparator("Nokota");
-			for (size_t i = 0; i < g_NokotaHorses.size(); ++i)
-			{
-				const auto& horse = g_NokotaHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, nokotaMatches, getHorseName))
+			g_HorseSearch.RenderList(g_NokotaHorses, nokotaMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Nokota_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4481,20 +4179,12 @@ namespace YimMenu::Submenus
 		if (showNorfolkRoadster)
 		{
 			RenderCenteredSeparator("Norfolk Roadster");
-			for (size_t i = 0; i < g_NorfolkRoadsterHorses.size(); ++i)
-			{
-				const auto& horse = g_NorfolkRoadsterHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, norfolkRoadsterMatches, getHorseName))
+			g_HorseSearch.RenderList(g_NorfolkRoadsterHorses, norfolkRoadsterMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("NorfolkRoadster_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4502,20 +4192,12 @@ namespace YimMenu::Submenus
 		if (showShire)
 		{
 			RenderCenteredSeparator("Shire");
-			for (size_t i = 0; i < g_ShireHorses.size(); ++i)
-			{
-				const auto& horse = g_ShireHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, shireMatches, getHorseName))
+			g_HorseSearch.RenderList(g_ShireHorses, shireMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Shire_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4523,20 +4205,12 @@ namespace YimMenu::Submenus
 		if (showSuffolkPunch)
 		{
 			RenderCenteredSeparator("Suffolk Punch");
-			for (size_t i = 0; i < g_SuffolkPunchHorses.size(); ++i)
-			{
-				const auto& horse = g_SuffolkPunchHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, suffolkPunchMatches, getHorseName))
+			g_HorseSearch.RenderList(g_SuffolkPunchHorses, suffolkPunchMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("SuffolkPunch_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4544,20 +4218,12 @@ namespace YimMenu::Submenus
 		if (showTennesseeWalker)
 		{
 			RenderCenteredSeparator("Tennessee Walker");
-			for (size_t i = 0; i < g_TennesseeWalkerHorses.size(); ++i)
-			{
-				const auto& horse = g_TennesseeWalkerHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, tennesseeWalkerMatches, getHorseName))
+			g_HorseSearch.RenderList(g_TennesseeWalkerHorses, tennesseeWalkerMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("TennesseeWalker_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4565,20 +4231,12 @@ namespace YimMenu::Submenus
 		if (showThoroughbred)
 		{
 			RenderCenteredSeparator("Thoroughbred");
-			for (size_t i = 0; i < g_ThoroughbredHorses.size(); ++i)
-			{
-				const auto& horse = g_ThoroughbredHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, thoroughbredMatches, getHorseName))
+			g_HorseSearch.RenderList(g_ThoroughbredHorses, thoroughbredMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Thoroughbred_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4586,20 +4244,12 @@ namespace YimMenu::Submenus
 		if (showTurkoman)
 		{
 			RenderCenteredSeparator("Turkoman");
-			for (size_t i = 0; i < g_TurkomanHorses.size(); ++i)
-			{
-				const auto& horse = g_TurkomanHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, turkomanMatches, getHorseName))
+			g_HorseSearch.RenderList(g_TurkomanHorses, turkomanMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Turkoman_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4607,20 +4257,12 @@ namespace YimMenu::Submenus
 		if (showMiscellaneous)
 		{
 			RenderCenteredSeparator("Miscellaneous");
-			for (size_t i = 0; i < g_MiscellaneousHorses.size(); ++i)
-			{
-				const auto& horse = g_MiscellaneousHorses[i];
-				if (g_HorseSearch.ShouldShowItem(horse, miscellaneousMatches, getHorseName))
+			g_HorseSearch.RenderList(g_MiscellaneousHorses, miscellaneousMatches, getHorseName, [&](const auto& horse) {
+				if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID(("Miscellaneous_" + horse.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(horse.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(horse.model, horse.variation, true);
-					}
-					ImGui::PopID();
+					SpawnAnimal(horse.model, horse.variation, true);
 				}
-			}
+			});
 			ImGui::Spacing();
 		}
 
@@ -4954,11 +4596,11 @@ namespace YimMenu::Submenus
 
 		// count visible animals in each section
 		int legendaryVisible = legendaryMatches ? static_cast<int>(g_LegendaryAnimals.size()) :
-		                      g_AnimalSearch.CountMatches(g_LegendaryAnimals, g_AnimalSearch.searchBuffer, getLegendaryName);
+		                      g_AnimalSearch.CountMatches(g_LegendaryAnimals, getLegendaryName);
 		int regularVisible = regularMatches ? static_cast<int>(g_RegularAnimals.size()) :
-		                    g_AnimalSearch.CountMatches(g_RegularAnimals, g_AnimalSearch.searchBuffer, getRegularName);
+		                    g_AnimalSearch.CountMatches(g_RegularAnimals, getRegularName);
 		int dogVisible = dogMatches ? static_cast<int>(g_Dogs.size()) :
-		                g_AnimalSearch.CountMatches(g_Dogs, g_AnimalSearch.searchBuffer, getDogName);
+		                g_AnimalSearch.CountMatches(g_Dogs, getDogName);
 
 		// determine section visibility
 		bool showLegendarySection = legendaryMatches || (legendaryVisible > 0);
@@ -4977,20 +4619,12 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Legendary Animals");
 
-			for (size_t i = 0; i < g_LegendaryAnimals.size(); ++i)
-			{
-				const auto& animal = g_LegendaryAnimals[i];
-				if (g_AnimalSearch.ShouldShowItem(animal, legendaryMatches, getLegendaryName))
+			g_AnimalSearch.RenderList(g_LegendaryAnimals, legendaryMatches, getLegendaryName, [&](const auto& animal) {
+				if (ImGui::Button(animal.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("LegendaryAnimals_" + animal.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(animal.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(animal.model, animal.variation);
-					}
-					ImGui::PopID();
+					SpawnAnimal(animal.model, animal.variation);
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -5000,20 +4634,12 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Regular Animals");
 
-			for (size_t i = 0; i < g_RegularAnimals.size(); ++i)
-			{
-				const auto& animal = g_RegularAnimals[i];
-				if (g_AnimalSearch.ShouldShowItem(animal, regularMatches, getRegularName))
+			g_AnimalSearch.RenderList(g_RegularAnimals, regularMatches, getRegularName, [&](const auto& animal) {
+				if (ImGui::Button(animal.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID with section prefix to prevent cross-section duplicates
-					ImGui::PushID(("RegularAnimals_" + animal.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(animal.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(animal.model, animal.variation);
-					}
-					ImGui::PopID();
+					SpawnAnimal(animal.model, animal.variation);
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -5023,20 +4649,12 @@ namespace YimMenu::Submenus
 		{
 			RenderCenteredSeparator("Dogs");
 
-			for (size_t i = 0; i < g_Dogs.size(); ++i)
-			{
-				const auto& dog = g_Dogs[i];
-				if (g_AnimalSearch.ShouldShowItem(dog, dogMatches, getDogName))
+			g_AnimalSearch.RenderList(g_Dogs, dogMatches, getDogName, [&](const auto& dog) {
+				if (ImGui::Button(dog.name.c_str(), ImVec2(-1, 25)))
 				{
-					// use unique ID based on model name and index to handle duplicate display names
-					ImGui::PushID((dog.model + "_" + std::to_string(i)).c_str());
-					if (ImGui::Button(dog.name.c_str(), ImVec2(-1, 25)))
-					{
-						SpawnAnimal(dog.model, dog.variation);
-					}
-					ImGui::PopID();
+					SpawnAnimal(dog.model, dog.variation);
 				}
-			}
+			});
 
 			ImGui::Spacing();
 		}
@@ -5112,26 +4730,18 @@ namespace YimMenu::Submenus
 		// count visible fishes based on search
 		int totalFishes = static_cast<int>(g_Fishes.size());
 		int visibleFishes = g_FishSearch.searchBuffer.empty() ? totalFishes :
-		                   g_FishSearch.CountMatches(g_Fishes, g_FishSearch.searchBuffer, getFishName);
+		                   g_FishSearch.CountMatches(g_Fishes, getFishName);
 
 		// render search bar with count
 		g_FishSearch.RenderSearchBar("Search Fishes", totalFishes, visibleFishes);
 
 		// render all fishes in a simple flat list
-		for (size_t i = 0; i < g_Fishes.size(); ++i)
-		{
-			const auto& fish = g_Fishes[i];
-			if (g_FishSearch.ShouldShowItem(fish, false, getFishName))
+		g_FishSearch.RenderList(g_Fishes, false, getFishName, [&](const auto& fish) {
+			if (ImGui::Button(fish.name.c_str(), ImVec2(-1, 25)))
 			{
-				// use unique ID based on model name and index to handle duplicate display names
-				ImGui::PushID((fish.model + "_" + std::to_string(i)).c_str());
-				if (ImGui::Button(fish.name.c_str(), ImVec2(-1, 25)))
-				{
-					SpawnAnimal(fish.model, fish.variation);
-				}
-				ImGui::PopID();
+				SpawnAnimal(fish.model, fish.variation);
 			}
-		}
+		});
 
 		// show helpful message when no matches found
 		if (visibleFishes == 0 && !g_FishSearch.searchBuffer.empty())
@@ -5230,9 +4840,6 @@ namespace YimMenu::Submenus
 		{
 			ImGui::BeginListBox("##unifiedsearch", ImVec2(400, 200));
 
-			std::string searchLower = g_PedModelBuffer;
-			std::transform(searchLower.begin(), searchLower.end(), searchLower.begin(), ::tolower);
-
 			// helper function for centered separator in dropdown
 			auto RenderCenteredSeparator = [](const char* text) {
 				ImGui::PushFont(Menu::Font::g_ChildTitleFont);
@@ -5262,280 +4869,93 @@ namespace YimMenu::Submenus
 				ImGui::Spacing();
 			};
 
-			bool hasResults = false;
+			g_UnifiedSearch.searchBuffer = g_PedModelBuffer;
 
-			// helper function to check if search matches section name
-			auto sectionMatches = [&](const char* sectionName) -> bool {
-				std::string sectionLower = sectionName;
-				std::transform(sectionLower.begin(), sectionLower.end(), sectionLower.begin(), ::tolower);
-				return sectionLower.find(searchLower) != std::string::npos;
-			};
+			// sections only show up when something in them matches, unless the section name itself does
+			auto renderSection = [&](const auto& items, const char* sectionName, bool sectionMatches, auto getName, auto getModel) {
+				if (!sectionMatches && g_UnifiedSearch.CountMatches(items, getName) == 0)
+					return;
 
-			// search legendary animals
-			bool legendaryHasResults = false;
-			bool legendarySection = sectionMatches("Legendary Animals") || sectionMatches("Legendary");
-
-			if (legendarySection)
-			{
-				RenderCenteredSeparator("Legendary Animals");
-				legendaryHasResults = true;
-				hasResults = true;
-				for (const auto& animal : g_LegendaryAnimals)
-				{
-					if (ImGui::Selectable(animal.name.c_str()))
+				RenderCenteredSeparator(sectionName);
+				g_UnifiedSearch.RenderList(items, sectionMatches, getName, [&](const auto& item) {
+					if (ImGui::Selectable(getName(item).c_str()))
 					{
-						g_PedModelBuffer = animal.model;
+						g_PedModelBuffer = getModel(item);
 					}
-				}
-			}
-			else
-			{
-				for (const auto& animal : g_LegendaryAnimals)
-				{
-					std::string nameLower = animal.name;
-					std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-					if (nameLower.find(searchLower) != std::string::npos)
-					{
-						if (!legendaryHasResults)
-						{
-							RenderCenteredSeparator("Legendary Animals");
-							legendaryHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(animal.name.c_str()))
-						{
-							g_PedModelBuffer = animal.model;
-						}
-					}
-				}
-			}
-
-			// search regular animals
-			bool regularHasResults = false;
-			bool regularSection = sectionMatches("Regular Animals") || sectionMatches("Animals");
-
-			if (regularSection)
-			{
-				RenderCenteredSeparator("Regular Animals");
-				regularHasResults = true;
-				hasResults = true;
-				for (const auto& animal : g_RegularAnimals)
-				{
-					if (ImGui::Selectable(animal.name.c_str()))
-					{
-						g_PedModelBuffer = animal.model;
-					}
-				}
-			}
-			else
-			{
-				for (const auto& animal : g_RegularAnimals)
-				{
-					std::string nameLower = animal.name;
-					std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-					if (nameLower.find(searchLower) != std::string::npos)
-					{
-						if (!regularHasResults)
-						{
-							RenderCenteredSeparator("Regular Animals");
-							regularHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(animal.name.c_str()))
-						{
-							g_PedModelBuffer = animal.model;
-						}
-					}
-				}
-			}
-
-			// search dogs
-			bool dogHasResults = false;
-			bool dogSection = sectionMatches("Dogs");
-
-			if (dogSection)
-			{
-				RenderCenteredSeparator("Dogs");
-				dogHasResults = true;
-				hasResults = true;
-				for (const auto& dog : g_Dogs)
-				{
-					if (ImGui::Selectable(dog.name.c_str()))
-					{
-						g_PedModelBuffer = dog.model;
-					}
-				}
-			}
-			else
-			{
-				for (const auto& dog : g_Dogs)
-				{
-					std::string nameLower = dog.name;
-					std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-					if (nameLower.find(searchLower) != std::string::npos)
-					{
-						if (!dogHasResults)
-						{
-							RenderCenteredSeparator("Dogs");
-							dogHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(dog.name.c_str()))
-						{
-							g_PedModelBuffer = dog.model;
-						}
-					}
-				}
-			}
-
-			// search horses - all breed sections
-			auto searchHorseSection = [&](const std::vector<Horse>& horses, const char* sectionName, bool& sectionHasResults) {
-				for (const auto& horse : horses)
-				{
-					std::string nameLower = horse.name;
-					std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-					if (nameLower.find(searchLower) != std::string::npos)
-					{
-						if (!sectionHasResults)
-						{
-							RenderCenteredSeparator(sectionName);
-							sectionHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(horse.name.c_str()))
-						{
-							g_PedModelBuffer = horse.model;
-						}
-					}
-				}
+				});
 			};
 
-			bool americanPaintHasResults = false, americanStandardbredHasResults = false, andalusianHasResults = false;
-			bool appaloosaHasResults = false, arabianHasResults = false, ardennesHasResults = false;
-			bool belgianHasResults = false, bretonHasResults = false, criolloHasResults = false;
-			bool dutchWarmbloodHasResults = false, gangHorseHasResults = false, gypsyCobHasResults = false;
-			bool hungarianHalfbredHasResults = false, kentuckySaddlerHasResults = false, klardruberHasResults = false;
-			bool missouriFoxTrotterHasResults = false, morganHasResults = false, mustangHasResults = false;
-			bool nokotaHasResults = false, norfolkRoadsterHasResults = false, shireHasResults = false;
-			bool suffolkPunchHasResults = false, tennesseeWalkerHasResults = false, thoroughbredHasResults = false;
-			bool turkomanHasResults = false, miscellaneousHorseHasResults = false;
-
-			searchHorseSection(g_AmericanPaintHorses, "American Paint", americanPaintHasResults);
-			searchHorseSection(g_AmericanStandardbredHorses, "American Standardbred", americanStandardbredHasResults);
-			searchHorseSection(g_AndalusianHorses, "Andalusian", andalusianHasResults);
-			searchHorseSection(g_AppaloosaHorses, "Appaloosa", appaloosaHasResults);
-			searchHorseSection(g_ArabianHorses, "Arabian", arabianHasResults);
-			searchHorseSection(g_ArdennesHorses, "Ardennes", ardennesHasResults);
-			searchHorseSection(g_BelgianHorses, "Belgian", belgianHasResults);
-			searchHorseSection(g_BretonHorses, "Breton", bretonHasResults);
-			searchHorseSection(g_CriolloHorses, "Criollo", criolloHasResults);
-			searchHorseSection(g_DutchWarmbloodHorses, "Dutch Warmblood", dutchWarmbloodHasResults);
-			searchHorseSection(g_GangHorses, "Gang", gangHorseHasResults);
-			searchHorseSection(g_GypsyCobHorses, "Gypsy Cob", gypsyCobHasResults);
-			searchHorseSection(g_HungarianHalfbredHorses, "Hungarian Halfbred", hungarianHalfbredHasResults);
-			searchHorseSection(g_KentuckySaddlerHorses, "Kentucky Saddler", kentuckySaddlerHasResults);
-			searchHorseSection(g_KlardruberHorses, "Klardruber", klardruberHasResults);
-			searchHorseSection(g_MissouriFoxTrotterHorses, "Missouri Fox Trotter", missouriFoxTrotterHasResults);
-			searchHorseSection(g_MorganHorses, "Morgan", morganHasResults);
-			searchHorseSection(g_MustangHorses, "Mustang", mustangHasResults);
-			searchHorseSection(g_NokotaHorses, "Nokota", nokotaHasResults);
-			searchHorseSection(g_NorfolkRoadsterHorses, "Norfolk Roadster", norfolkRoadsterHasResults);
-			searchHorseSection(g_ShireHorses, "Shire", shireHasResults);
-			searchHorseSection(g_SuffolkPunchHorses, "Suffolk Punch", suffolkPunchHasResults);
-			searchHorseSection(g_TennesseeWalkerHorses, "Tennessee Walker", tennesseeWalkerHasResults);
-			searchHorseSection(g_ThoroughbredHorses, "Thoroughbred", thoroughbredHasResults);
-			searchHorseSection(g_TurkomanHorses, "Turkoman", turkomanHasResults);
-			searchHorseSection(g_MiscellaneousHorses, "Miscellaneous", miscellaneousHorseHasResults);
-
-			// search humans - all category sections
-			auto searchHumanSection = [&](const std::vector<Human>& humans, const char* sectionName, bool& sectionHasResults) {
-				for (const auto& human : humans)
-				{
-					std::string modelLower = human.model;
-					std::transform(modelLower.begin(), modelLower.end(), modelLower.begin(), ::tolower);
-					if (modelLower.find(searchLower) != std::string::npos)
-					{
-						if (!sectionHasResults)
-						{
-							RenderCenteredSeparator(sectionName);
-							sectionHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(human.model.c_str()))
-						{
-							g_PedModelBuffer = human.model;
-						}
-					}
-				}
+			auto sectionMatches = [&](const char* sectionName) {
+				return g_UnifiedSearch.SectionMatches(sectionName, g_UnifiedSearch.searchBuffer);
 			};
 
-			bool ambientFemaleHasResults = false, ambientFemaleOrdinaryHasResults = false, ambientMaleHasResults = false;
-			bool ambientMaleOrdinaryHasResults = false, ambientMaleSuppressedHasResults = false, cutsceneHasResults = false;
-			bool multiplayerCutsceneHasResults = false, gangHumanHasResults = false, storyFinaleHasResults = false;
-			bool multiplayerBloodMoneyHasResults = false, multiplayerBountyHuntersHasResults = false, multiplayerNaturalistHasResults = false;
-			bool multiplayerHasResults = false, storyHasResults = false, randomEventHasResults = false;
-			bool scenarioHasResults = false, storyScenarioFemaleHasResults = false, storyScenarioMaleHasResults = false;
-			bool miscellaneousHumanHasResults = false;
-
-			searchHumanSection(g_AmbientFemale, "Ambient Female", ambientFemaleHasResults);
-			searchHumanSection(g_AmbientFemaleOrdinary, "Ambient Female Ordinary", ambientFemaleOrdinaryHasResults);
-			searchHumanSection(g_AmbientMale, "Ambient Male", ambientMaleHasResults);
-			searchHumanSection(g_AmbientMaleOrdinary, "Ambient Male Ordinary", ambientMaleOrdinaryHasResults);
-			searchHumanSection(g_AmbientMaleSuppressed, "Ambient Male Suppressed", ambientMaleSuppressedHasResults);
-			searchHumanSection(g_Cutscene, "Cutscene", cutsceneHasResults);
-			searchHumanSection(g_MultiplayerCutscene, "Multiplayer Cutscene", multiplayerCutsceneHasResults);
-			searchHumanSection(g_Gang, "Gang", gangHumanHasResults);
-			searchHumanSection(g_StoryFinale, "Story Finale", storyFinaleHasResults);
-			searchHumanSection(g_MultiplayerBloodMoney, "Multiplayer Blood Money", multiplayerBloodMoneyHasResults);
-			searchHumanSection(g_MultiplayerBountyHunters, "Multiplayer Bounty Hunters", multiplayerBountyHuntersHasResults);
-			searchHumanSection(g_MultiplayerNaturalist, "Multiplayer Naturalist", multiplayerNaturalistHasResults);
-			searchHumanSection(g_Multiplayer, "Multiplayer", multiplayerHasResults);
-			searchHumanSection(g_Story, "Story", storyHasResults);
-			searchHumanSection(g_RandomEvent, "Random Event", randomEventHasResults);
-			searchHumanSection(g_Scenario, "Scenario", scenarioHasResults);
-			searchHumanSection(g_StoryScenarioFemale, "Story Scenario Female", storyScenarioFemaleHasResults);
-			searchHumanSection(g_StoryScenarioMale, "Story Scenario Male", storyScenarioMaleHasResults);
-			searchHumanSection(g_Miscellaneous, "Miscellaneous", miscellaneousHumanHasResults);
-
-			// search fishes
-			bool fishHasResults = false;
-			bool fishSection = sectionMatches("Fishes") || sectionMatches("Fish");
-
-			if (fishSection)
+			auto getName  = [](const auto& item) -> const std::string& { return item.name; };
+			auto getModel = [](const auto& item) -> const std::string& { return item.model; };
+
+			renderSection(g_LegendaryAnimals, "Legendary Animals", sectionMatches("Legendary Animals") || sectionMatches("Legendary"), getName, getModel);
+			renderSection(g_RegularAnimals, "Regular Animals", sectionMatches("Regular Animals") || sectionMatches("Animals"), getName, getModel);
+			renderSection(g_Dogs, "Dogs", sectionMatches("Dogs"), getName, getModel);
+
+			// horses and humans are only searched by name
+			for (auto& [horses, sectionName] : std::initializer_list<std::pair<const std::vector<Horse>*, const char*>>{
+			         {&g_AmericanPaintHorses, "American Paint"},
+			         {&g_AmericanStandardbredHorses, "American Standardbred"},
+			         {&g_AndalusianHorses, "Andalusian"},
+			         {&g_AppaloosaHorses, "Appaloosa"},
+			         {&g_ArabianHorses, "Arabian"},
+			         {&g_ArdennesHorses, "Ardennes"},
+			         {&g_BelgianHorses, "Belgian"},
+			         {&g_BretonHorses, "Breton"},
+			         {&g_CriolloHorses, "Criollo"},
+			         {&g_DutchWarmbloodHorses, "Dutch Warmblood"},
+			         {&g_GangHorses, "Gang"},
+			         {&g_GypsyCobHorses, "Gypsy Cob"},
+			         {&g_HungarianHalfbredHorses, "Hungarian Halfbred"},
+			         {&g_KentuckySaddlerHorses, "Kentucky Saddler"},
+			         {&g_KlardruberHorses, "Klardruber"},
+			         {&g_MissouriFoxTrotterHorses, "Missouri Fox Trotter"},
+			         {&g_MorganHorses, "Morgan"},
+			         {&g_MustangHorses, "Mustang"},
+			         {&g_NokotaHorses, "Nokota"},
+			         {&g_NorfolkRoadsterHorses, "Norfolk Roadster"},
+			         {&g_ShireHorses, "Shire"},
+			         {&g_SuffolkPunchHorses, "Suffolk Punch"},
+			         {&g_TennesseeWalkerHorses, "Tennessee Walker"},
+			         {&g_ThoroughbredHorses, "Thoroughbred"},
+			         {&g_TurkomanHorses, "Turkoman"},
+			         {&g_MiscellaneousHorses, "Miscellaneous"},
+			     })
 			{
-				RenderCenteredSeparator("Fishes");
-				fishHasResults = true;
-				hasResults = true;
-				for (const auto& fish : g_Fishes)
-				{
-					if (ImGui::Selectable(fish.name.c_str()))
-					{
-						g_PedModelBuffer = fish.model;
-					}
-				}
+				renderSection(*horses, sectionName, false, getName, getModel);
 			}
-			else
+
+			for (auto& [humans, sectionName] : std::initializer_list<std::pair<const std::vector<Human>*, const char*>>{
+			         {&g_AmbientFemale, "Ambient Female"},
+			         {&g_AmbientFemaleOrdinary, "Ambient Female Ordinary"},
+			         {&g_AmbientMale, "Ambient Male"},
+			         {&g_AmbientMaleOrdinary, "Ambient Male Ordinary"},
+			         {&g_AmbientMaleSuppressed, "Ambient Male Suppressed"},
+			         {&g_Cutscene, "Cutscene"},
+			         {&g_MultiplayerCutscene, "Multiplayer Cutscene"},
+			         {&g_Gang, "Gang"},
+			         {&g_StoryFinale, "Story Finale"},
+			         {&g_MultiplayerBloodMoney, "Multiplayer Blood Money"},
+			         {&g_MultiplayerBountyHunters, "Multiplayer Bounty Hunters"},
+			         {&g_MultiplayerNaturalist, "Multiplayer Naturalist"},
+			         {&g_Multiplayer, "Multiplayer"},
+			         {&g_Story, "Story"},
+			         {&g_RandomEvent, "Random Event"},
+			         {&g_Scenario, "Scenario"},
+			         {&g_StoryScenarioFemale, "Story Scenario Female"},
+			         {&g_StoryScenarioMale, "Story Scenario Male"},
+			         {&g_Miscellaneous, "Miscellaneous"},
+			     })
 			{
-				for (const auto& fish : g_Fishes)
-				{
-					std::string nameLower = fish.name;
-					std::transform(nameLower.begin(), nameLower.end(), nameLower.begin(), ::tolower);
-					if (nameLower.find(searchLower) != std::string::npos)
-					{
-						if (!fishHasResults)
-						{
-							RenderCenteredSeparator("Fishes");
-							fishHasResults = true;
-							hasResults = true;
-						}
-						if (ImGui::Selectable(fish.name.c_str()))
-						{
-							g_PedModelBuffer = fish.model;
-						}
-					}
-				}
+				renderSection(*humans, sectionName, false, getModel, getModel);
 			}
 
+			renderSection(g_Fishes, "Fishes", sectionMatches("Fishes") || sectionMatches("Fish"), getName, getModel);
+
 			ImGui::EndListBox();
 		}
 
@@ -5550,38 +4970,33 @@ namespace YimMenu::Submenus
 		ImGui::SameLine();
 		if (ImGui::Button("Set Model"))
 		{
-			FiberPool::Push([] {
-				auto model = Joaat(g_PedModelBuffer);
+			ScriptMgr::AddTask([](std::string name, int variation, bool armed) -> ScriptTask {
+				auto model = Joaat(name);
 
-				for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(model); i++)
-				{
-					STREAMING::REQUEST_MODEL(model, false);
-					ScriptMgr::Yield();
-				}
+				if (!co_await ModelLoaded(model))
+					co_return;
 
 				PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), model, false);
 				Self::Update();
 
-				if (g_Variation > 0)
-					Self::GetPed().SetVariation(g_Variation);
+				if (variation > 0)
+					Self::GetPed().SetVariation(variation);
 				else
 					PED::_SET_RANDOM_OUTFIT_VARIATION(Self::GetPed().GetHandle(), true);
 
 				// track model and variation for automatic session fix
-				Hooks::Info::UpdateStoredPlayerModel(model, g_Variation);
+				Hooks::Info::UpdateStoredPlayerModel(model, variation);
 
 				// give weapon if armed is enabled and ped is not an animal
-				if (g_Armed && !Self::GetPed().IsAnimal())
+				if (armed && !Self::GetPed().IsAnimal())
 				{
-					auto weapon = GetDefaultWeaponForPed(g_PedModelBuffer);
+					auto weapon = GetDefaultWeaponForPed(name);
 					WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
 					WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-					ScriptMgr::Yield();
+					co_await NextFrame();
 					WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
 				}
-
-				STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
-			});
+			}(g_PedModelBuffer, g_Variation, g_Armed));
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("Story Gang"))
@@ -6,6 +6,7 @@
 #include "core/commands/HotkeySystem.hpp"
 #include "core/commands/LoopedCommand.hpp"
 #include "game/backend/FiberPool.hpp"
+#include "game/backend/NativeQueue.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
 #include "game/frontend/items/Items.hpp"
@@ -69,9 +70,7 @@ namespace YimMenu::Submenus
 			}
 			if (ImGui::Button("Restore"))
 			{
-				FiberPool::Push([] {
-					NETWORK::_NETWORK_CLEAR_CLOCK_OVERRIDE_OVERTIME(0);
-				});
+				NativeQueue::Push<NativeIndex::_NETWORK_CLEAR_CLOCK_OVERRIDE_OVERTIME>(0);
 			}
 		}));
 
@@ -97,9 +96,7 @@ namespace YimMenu::Submenus
 			}
 			if (ImGui::Button("Restore"))
 			{
-				FiberPool::Push([] {
-					MISC::CLEAR_OVERRIDE_WEATHER();
-				});
+				NativeQueue::Push<NativeIndex::CLEAR_OVERRIDE_WEATHER>();
 			}
 		}));
 
@@ -6,10 +6,13 @@
 #include "game/backend/NativeHooks.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
+#include "game/backend/Streaming.hpp"
+#include "game/frontend/FilteredList.hpp"
 #include "game/frontend/items/Items.hpp"
 #include "game/rdr/Enums.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/data/PedModels.hpp"
+#include "game/rdr/data/SearchIndices.hpp"
 
 
 namespace YimMenu::Submenus
@@ -54,23 +57,16 @@ namespace YimMenu::Submenus
 	{
 		if (data->EventFlag == ImGuiInputTextFlags_CallbackCompletion)
 		{
-			std::string newText{};
-			std::string inputLower = data->Buf;
-			std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
-			for (const auto& [key, model] : Data::g_PedModels)
-			{
-				std::string modelLower = model;
-				std::transform(modelLower.begin(), modelLower.end(), modelLower.begin(), ::tolower);
-				if (modelLower.find(inputLower) != std::string::npos)
-				{
-					newText = model;
-				}
-			}
+			// tab completes to the last model that matches
+			auto& index = Data::GetPedModelIndex();
+			std::vector<std::uint32_t> matches;
+			index.Search(data->Buf, matches);
 
-			if (!newText.empty())
+			if (!matches.empty())
 			{
+				auto model = index.GetName(matches.back());
 				data->DeleteChars(0, data->BufTextLen);
-				data->InsertChars(0, newText.c_str());
+				data->InsertChars(0, model.data(), model.data() + model.size());
 			}
 
 			return 1;
@@ -98,17 +94,15 @@ namespace YimMenu::Submenus
 		{
 			ImGui::BeginListBox("##pedmodels", ImVec2(250, 100));
 
-			std::string bufferLower = pedModelBuffer;
-			std::transform(bufferLower.begin(), bufferLower.end(), bufferLower.begin(), ::tolower);
-			for (const auto& [hash, model] : Data::g_PedModels)
-			{
-				std::string pedModelLower = model;
-				std::transform(pedModelLower.begin(), pedModelLower.end(), pedModelLower.begin(), ::tolower);
-				if (pedModelLower.find(bufferLower) != std::string::npos && ImGui::Selectable(model))
+			static SearchQuery query(Data::GetPedModelIndex());
+			auto& matches = query.Update(pedModelBuffer);
+			FilteredList::DrawRows(matches.size(), [&](std::size_t row) {
+				auto model = query.GetIndex().GetName(matches[row]);
+				if (ImGui::Selectable(model.data()))
 				{
 					pedModelBuffer = model;
 				}
-			}
+			});
 
 			ImGui::EndListBox();
 		}
@@ -258,14 +252,11 @@ namespace YimMenu::Submenus
 		ImGui::SameLine();
 		if (ImGui::Button("Set Model"))
 		{
-			FiberPool::Push([] {
-				auto model = Joaat(pedModelBuffer);
+			ScriptMgr::AddTask([](std::string name, int variation, bool armed) -> ScriptTask {
+				auto model = Joaat(name);
 
-				for (int i = 0; i < 30 && !STREAMING::HAS_MODEL_LOADED(model); i++)
-				{
-					STREAMING::REQUEST_MODEL(model, false);
-					ScriptMgr::Yield();
-				}
+				if (!co_await ModelLoaded(model))
+					co_return;
 
 				PLAYER::SET_PLAYER_MODEL(Self::GetPlayer().GetId(), model, false);
 				Self::Update();
@@ -278,15 +269,13 @@ namespace YimMenu::Submenus
 				// give weapon if armed is enabled and ped is not an animal
 				if (armed && !Self::GetPed().IsAnimal())
 				{
-					auto weapon = GetDefaultWeaponForPed(pedModelBuffer);
+					auto weapon = GetDefaultWeaponForPed(name);
 					WEAPON::GIVE_WEAPON_TO_PED(Self::GetPed().GetHandle(), Joaat(weapon), 100, true, false, 0, true, 0.5f, 1.0f, 0x2CD419DC, true, 0.0f, false);
 					WEAPON::SET_PED_INFINITE_AMMO(Self::GetPed().GetHandle(), true, Joaat(weapon));
-					ScriptMgr::Yield();
+					co_await NextFrame();
 					WEAPON::SET_CURRENT_PED_WEAPON(Self::GetPed().GetHandle(), "WEAPON_UNARMED"_J, true, 0, false, false);
 				}
-
-				STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
-			});
+			}(pedModelBuffer, variation, armed));
 		}
 		ImGui::SameLine();
 		if (ImGui::Button("Story Gang"))
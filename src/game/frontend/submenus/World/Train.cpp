@@ -2,6 +2,7 @@
 
 #include "game/backend/Self.hpp"
 #include "game/backend/FiberPool.hpp"
+#include "game/backend/Streaming.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/data/Trains.hpp"
 #include "util/Joaat.hpp"
@@ -55,16 +56,14 @@ namespace YimMenu::Submenus
 
 					auto numcars = VEHICLE::_GET_NUM_CARS_FROM_TRAIN_CONFIG(selectedTrain);
 
+					// cars of the same model share a request, and every car is queued before waiting on any of them
+					std::vector<ModelRequest> requests;
 					for (int i = 0; i <= numcars - 1; i++)
-					{
-						STREAMING::REQUEST_MODEL(VEHICLE::_GET_TRAIN_MODEL_FROM_TRAIN_CONFIG_BY_CAR_INDEX(selectedTrain, i), false);
+						requests.emplace_back(VEHICLE::_GET_TRAIN_MODEL_FROM_TRAIN_CONFIG_BY_CAR_INDEX(selectedTrain, i));
 
-						while (!STREAMING::HAS_MODEL_LOADED(VEHICLE::_GET_TRAIN_MODEL_FROM_TRAIN_CONFIG_BY_CAR_INDEX(selectedTrain, i)))
-						{
-							STREAMING::REQUEST_MODEL(VEHICLE::_GET_TRAIN_MODEL_FROM_TRAIN_CONFIG_BY_CAR_INDEX(selectedTrain, i), false);
+					for (auto& request : requests)
+						while (request.IsValid() && !request.IsLoaded())
 							ScriptMgr::Yield();
-						}
-					}
 
 
 					auto veh = VEHICLE::_CREATE_MISSION_TRAIN(selectedTrain, coords.x, coords.y, coords.z, 1, hasPax, true, hasConductor);
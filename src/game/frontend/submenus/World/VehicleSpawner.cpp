@@ -4,7 +4,9 @@
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/features/Features.hpp"
+#include "game/frontend/FilteredList.hpp"
 #include "game/frontend/items/Items.hpp"
+#include "game/rdr/data/SearchIndices.hpp"
 #include "game/rdr/data/VehicleModels.hpp"
 #include "game/backend/Self.hpp"
 #include "game/rdr/Vehicle.hpp"
@@ -12,38 +14,27 @@
 
 namespace YimMenu::Submenus
 {
-	static bool IsVehModelInList(std::string model)
+	static bool IsVehModelInList(const std::string& model)
 	{
-		for (const auto& vehModel : Data::g_VehicleModels)
-		{
-			if (vehModel.model == model)
-				return true;
-		}
-
-		return false;
+		auto& index = Data::GetVehicleModelIndex();
+		auto found  = index.Find(Joaat(model));
+		return found && index.GetName(*found) == model;
 	}
 
 	static int VehSpawnerInputCallback(ImGuiInputTextCallbackData* data)
 	{
 		if (data->EventFlag == ImGuiInputTextFlags_CallbackCompletion)
 		{
-			std::string newText{};
-			std::string inputLower = data->Buf;
-			std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
-			for (const auto& vehModel : Data::g_VehicleModels)
-			{
-				std::string modelLower = vehModel.model;
-				std::transform(modelLower.begin(), modelLower.end(), modelLower.begin(), ::tolower);
-				if (modelLower.find(inputLower) != std::string::npos)
-				{
-					newText = vehModel.model;
-				}
-			}
+			// tab completes to the last model that matches
+			auto& index = Data::GetVehicleModelIndex();
+			std::vector<std::uint32_t> matches;
+			index.Search(data->Buf, matches);
 
-			if (!newText.empty())
+			if (!matches.empty())
 			{
+				auto model = index.GetName(matches.back());
 				data->DeleteChars(0, data->BufTextLen);
-				data->InsertChars(0, newText.c_str());
+				data->InsertChars(0, model.data(), model.data() + model.size());
 			}
 
 			return 1;
@@ -63,17 +54,15 @@ namespace YimMenu::Submenus
 		{
 			ImGui::BeginListBox("##vehmodels", ImVec2(250, 100));
 
-			std::string bufferLower = vehModelBuffer;
-			std::transform(bufferLower.begin(), bufferLower.end(), bufferLower.begin(), ::tolower);
-			for (const auto& vehModel : Data::g_VehicleModels)
-			{
-				std::string vehModelLower = vehModel.model;
-				std::transform(vehModelLower.begin(), vehModelLower.end(), vehModelLower.begin(), ::tolower);
-				if (vehModelLower.find(bufferLower) != std::string::npos && ImGui::Selectable(vehModel.model.data()))
+			static SearchQuery query(Data::GetVehicleModelIndex());
+			auto& matches = query.Update(vehModelBuffer);
+			FilteredList::DrawRows(matches.size(), [&](std::size_t row) {
+				auto model = query.GetIndex().GetName(matches[row]);
+				if (ImGui::Selectable(model.data()))
 				{
-					vehModelBuffer = vehModel.model;
+					vehModelBuffer = model;
 				}
-			}
+			});
 
 			ImGui::EndListBox();
 		}
@@ -1,11 +1,14 @@
 #include "core/commands/BoolCommand.hpp"
 #include "core/hooking/DetourHook.hpp"
+#include "game/backend/FloodProtection.hpp"
+#include "game/backend/NetEventLog.hpp"
 #include "game/backend/PlayerData.hpp"
 #include "game/backend/Protections.hpp"
 #include "game/backend/Self.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/Enums.hpp"
+#include "game/rdr/NetEvents.hpp"
 
 #include <network/CNetGamePlayer.hpp>
 #include <network/netObject.hpp>
@@ -38,78 +41,49 @@ namespace YimMenu::Features
 	BoolCommand _BlockPtfx("blockptfx", "Block PTFX", "Blocks all particle effect events", true);
 	BoolCommand _BlockClearTasks("blockclearpedtasks", "Block Clear Tasks", "Blocks all clear ped tasks events", true);
 	BoolCommand _BlockScriptCommand("blockscriptcommand", "Block Remote Native Calls", "Blocks all remote native call events", true);
+	BoolCommand _BlockEventFlood("blockeventflood", "Block Event Floods", "Rate limits every network event type per player", true);
 }
 
 namespace YimMenu::Hooks
 {
 	static std::unordered_set<uint64_t> g_PtfxWarned;
-	static void LogScriptCommandEvent(Player sender, rage::datBitBuffer& buffer)
-	{
-		struct ScriptCommandEventData
-		{
-			bool Active;
-			int NumParams;
-			std::uint64_t Hash;
-			std::uint32_t ScriptHash;
-		} datas[7]{};
-
-		std::uint32_t parameters[255]{};
-
-		auto net_id      = buffer.Read<uint16_t>(13);
-		auto count       = buffer.Read<int>(3);
-		int total_params = 0;
-
-		for (int i = 0; i < count; i++)
-		{
-			datas[i].Hash       = buffer.Read<uint64_t>(64);
-			datas[i].NumParams  = buffer.Read<uint32_t>(5);
-			datas[i].ScriptHash = buffer.Read<uint32_t>(32);
-			total_params += datas[i].NumParams;
-		}
-
-		for (int i = 0; i < total_params; i++)
-		{
-			int size = 1;
-			bool one = buffer.Read<bool>(1);
-			if (!one)
-				size = buffer.Read<int>(7);
-			parameters[i] = buffer.Read<uint64_t>(size);
-		}
 
-		int global_param_access = 0;
-		for (int i = 0; i < count; i++)
+	void Protections::HandleNetGameEvent(rage::netEventMgr* eventMgr, CNetGamePlayer* sourcePlayer, CNetGamePlayer* targetPlayer, NetEventType type, int index, int handledBits, std::int16_t unk, rage::datBitBuffer* buffer)
+	{
+		if (sourcePlayer && Features::_BlockEventFlood.GetState())
 		{
-			std::ostringstream data;
-			data << HEX(datas[i].Hash) << "(";
-			for (int j = 0; j < datas[i].NumParams; j++)
+			if (auto result = FloodProtection::Process(sourcePlayer->m_PlayerIndex, type); result != RateLimitResult::ALLOWED)
 			{
-				data << std::to_string(parameters[global_param_access]);
-				global_param_access++;
-				if (j != datas[i].NumParams - 1)
-					data << ", ";
+				if (result == RateLimitResult::EXCEEDED)
+				{
+					LOGF(NET_EVENT, WARNING, "Blocked {} flood from {}", (int)type < g_NetEventsToString.size() ? g_NetEventsToString[(int)type] : "unknown event", sourcePlayer->GetName());
+				}
+				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
+				return;
 			}
-			data << ");";
-			LOG(WARNING) << sender.GetName() << " tried to execute " << data.str();
 		}
-	}
 
-	void Protections::HandleNetGameEvent(rage::netEventMgr* eventMgr, CNetGamePlayer* sourcePlayer, CNetGamePlayer* targetPlayer, NetEventType type, int index, int handledBits, std::int16_t unk, rage::datBitBuffer* buffer)
-	{
-		rage::datBitBuffer new_buffer = *buffer;
+		// floods are dropped before this, and the payload is only decoded if it's logged or a check below reads it
+		NetEventData data;
+		bool decoded = false;
+		auto decode  = [&]() -> const NetEventData& {
+			if (!std::exchange(decoded, true))
+				DecodeNetEvent(type, *buffer, data);
+			return data;
+		};
 
-		if (Features::_LogEvents.GetState() && (int)type < g_NetEventsToString.size())
+		if (Features::_LogEvents.GetState())
 		{
-			LOG(INFO) << "NETWORK_EVENT: " << g_NetEventsToString[(int)type] << " from " << sourcePlayer->GetName();
+			NetEventLog::Received(sourcePlayer, decode());
 		}
 
 		if (type == NetEventType::NETWORK_DESTROY_VEHICLE_LOCK_EVENT)
 		{
-			auto net_id = new_buffer.Read<uint16_t>(13);
-			if (auto object = Pointers.GetNetObjectById(net_id))
+			if (auto object = decode().m_Decoded ? Pointers.GetNetObjectById(data.m_DestroyVehicleLock.m_NetId) : nullptr)
 			{
 				if (!IsVehicleType((NetObjType)object->m_ObjectType))
 				{
-					LOG(WARNING) << "Blocked mismatched destroy vehicle lock event entity from " << sourcePlayer->GetName();
+					NetEventLog::Blocked(sourcePlayer, data, "Blocked mismatched destroy vehicle lock event entity");
 					Player(sourcePlayer).AddDetection(Detection::TRIED_CRASH_PLAYER);
 					Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 					return;
@@ -122,7 +96,7 @@ namespace YimMenu::Hooks
 			if (Features::_BlockExplosions.GetState()
 			    || (Player(sourcePlayer).IsValid() && Player(sourcePlayer).GetData().m_BlockExplosions))
 			{
-				LOG(WARNING) << "Blocked explosion from " << sourcePlayer->GetName();
+				NetEventLog::Blocked(sourcePlayer, decode(), "Blocked explosion");
 				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 				return;
 			}
@@ -136,7 +110,7 @@ namespace YimMenu::Hooks
 				auto rid = Player(sourcePlayer).GetRID();
 				if (g_PtfxWarned.insert(rid).second)
 				{
-					LOG(WARNING) << "Blocked particle effects from " << sourcePlayer->GetName();
+					NetEventLog::Blocked(sourcePlayer, decode(), "Blocked particle effects");
 				}
 				Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 				return;
@@ -145,8 +119,7 @@ namespace YimMenu::Hooks
 
 		if (type == NetEventType::SCRIPT_COMMAND_EVENT && sourcePlayer && Features::_BlockScriptCommand.GetState())
 		{
-			LogScriptCommandEvent(sourcePlayer, new_buffer);
-			LOG(WARNING) << "Blocked remote native call from " << sourcePlayer->GetName();
+			NetEventLog::Blocked(sourcePlayer, decode(), "Blocked remote native call");
 			Pointers.SendEventAck(eventMgr, nullptr, sourcePlayer, targetPlayer, index, handledBits);
 			Player(sourcePlayer).AddDetection(Detection::MODDER_EVENTS);
 			return;
@@ -2,6 +2,7 @@
 #include "core/frontend/Notifications.hpp"
 #include "core/hooking/DetourHook.hpp"
 #include "core/misc/RateLimiter.hpp"
+#include "game/backend/FloodProtection.hpp"
 #include "game/backend/Players.hpp"
 #include "game/backend/Protections.hpp"
 #include "game/backend/Self.hpp"
@@ -25,6 +26,7 @@ namespace YimMenu::Features
 	BoolCommand _BlockTickerSpam("blocktickerspam", "Block Ticker Spam", "Blocks all ticker message spam events", true);
 	BoolCommand _BlockStableEvents("blockstableevents", "Block Stable Events", "Blocks all stable events", true);
 	BoolCommand _BlockKickFromMissionLobby("blockkickfrommissionlobby", "Block Kick From Mission Lobby", "Blocks players from kicking you from mission lobbies", true);
+	BoolCommand _BlockScriptEventFlood("blockscripteventflood", "Block Script Event Floods", "Rate limits every script event type per player", true);
 }
 
 namespace YimMenu::Hooks
@@ -51,6 +53,19 @@ namespace YimMenu::Hooks
 		}
 
 		auto evnt_id = static_cast<ScriptEvent>((int)event->m_Data[0]);
+
+		if (Features::_BlockScriptEventFlood.GetState())
+		{
+			if (auto result = FloodProtection::Process(src->m_PlayerIndex, evnt_id); result != RateLimitResult::ALLOWED)
+			{
+				if (result == RateLimitResult::EXCEEDED)
+				{
+					LOGF(NET_EVENT, WARNING, "Blocked script event {} flood from {}", (int)evnt_id, src->GetName());
+				}
+				return true;
+			}
+		}
+
 		switch (evnt_id)
 		{
 		case ScriptEvent::SCRIPT_EVENT_PERSONA_HONOR:
@@ -2,12 +2,14 @@
 #include "core/frontend/Notifications.hpp"
 #include "core/hooking/DetourHook.hpp"
 #include "game/backend/FiberPool.hpp"
+#include "game/backend/FloodProtection.hpp"
 #include "game/backend/PlayerDatabase.hpp"
 #include "game/backend/Players.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/Self.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/pointers/Pointers.hpp"
+#include "game/rdr/BitStream.hpp"
 #include "game/rdr/Enums.hpp"
 #include "game/rdr/Packet.hpp"
 #include "game/rdr/Player.hpp"
@@ -30,6 +32,7 @@ namespace YimMenu::Features
 {
 	BoolCommand _LogPackets("logpackets", "Log Packets", "Log Packets");
 	BoolCommand _LockLobby("locklobby", "Lock Lobby", "Allows no one to enter your session");
+	BoolCommand _BlockMessageFlood("blockmessageflood", "Block Message Floods", "Rate limits chat, host and session messages per player", true);
 }
 
 namespace YimMenu::Hooks
@@ -47,23 +50,22 @@ namespace YimMenu::Hooks
 			return false; // drop the malformed frame safely
 		}
 	}
-	static bool GetMessageType(NetMessageType& type, rage::datBitBuffer& buffer)
+	static bool GetMessageType(NetMessageType& type, BitReader& reader)
 	{
-		if (buffer.Read<int>(14) != '2F')
+		auto [magic, extended] = reader.ReadFields<14, 1>();
+		if (magic != '2F' || reader.IsOverflowed())
 			return false;
-		bool extended = buffer.Read<bool>(1);
-		type          = buffer.Read<NetMessageType>(extended ? 16 : 8);
-		return true;
+		type = reader.Read<NetMessageType>(extended ? 16 : 8);
+		return !reader.IsOverflowed();
 	}
 
 	static void LogFrame(rage::netConnection::InFrame* frame)
 	{
 		// TODO: reverse new endpoint system for sender data
-		rage::datBitBuffer buffer(frame->m_Data, frame->m_Length);
-		buffer.m_FlagBits |= 1u;
+		BitReader reader(frame->m_Data, frame->m_Length);
 
 		NetMessageType msg_type;
-		GetMessageType(msg_type, buffer);
+		GetMessageType(msg_type, reader);
 
 		static constexpr const auto unloggables = std::to_array({NetMessageType::CLONE_SYNC, NetMessageType::PACKED_CLONE_SYNC_ACKS, NetMessageType::PACKED_EVENTS, NetMessageType::PACKED_RELIABLES, NetMessageType::PACKED_EVENT_RELIABLES_MSGS, NetMessageType::NET_ARRAY_MGR_UPDATE, NetMessageType::NET_ARRAY_MGR_UPDATE_ACK, NetMessageType::NET_ARRAY_MGR_SPLIT_UPDATE_ACK, NetMessageType::NET_TIME_SYNC, NetMessageType::SCRIPT_JOIN, NetMessageType::SCRIPT_JOIN_ACK, NetMessageType::SCRIPT_JOIN_HOST_ACK, NetMessageType::SCRIPT_HANDSHAKE, NetMessageType::SCRIPT_BOT_HANDSHAKE_ACK});
 		if (std::find(unloggables.begin(), unloggables.end(), msg_type) == unloggables.end())
@@ -112,6 +114,7 @@ namespace YimMenu::Hooks
 
 		rage::datBitBuffer buffer(frame->m_Data, frame->m_Length);
 		buffer.m_FlagBits |= 1u;
+		BitReader reader(buffer);
 
 		NetMessageType msg_type;
 
@@ -177,16 +180,32 @@ namespace YimMenu::Hooks
 			return CallOrig_SEH(orig, a1, ncm, frame);
 		}
 
-		if (!GetMessageType(msg_type, buffer))
+		if (!GetMessageType(msg_type, reader))
 		{
 			return CallOrig_SEH(orig, a1, ncm, frame);
 		}
+		reader.Sync(buffer);
 
 		if (Features::_LogPackets.GetState())
 		{
 			LogFrame(frame);
 		}
 
+		if (player && Features::_BlockMessageFlood.GetState())
+		{
+			if (auto p = Players::GetByMessageId(frame->m_MsgId))
+			{
+				if (auto result = FloodProtection::Process(p.GetId(), msg_type); result != RateLimitResult::ALLOWED)
+				{
+					if (result == RateLimitResult::EXCEEDED)
+					{
+						LOGF(NETWORK, WARNING, "Blocked message 0x{:X} flood from {}", (int)msg_type, p.GetName());
+					}
+					return true;
+				}
+			}
+		}
+
 		switch (msg_type)
 		{
 		case NetMessageType::TEXT_CHAT:
@@ -246,10 +265,7 @@ namespace YimMenu::Hooks
 
 				// this should ideally *never* happen, but let's check for the peer ID mismatch just in case
 
-				auto version = buffer.Read<uint8_t>(8);
-				auto v1 = buffer.Read<uint32_t>(32);
-				auto v2 = buffer.Read<uint32_t>(32);
-				auto peer_id = buffer.Read<uint64_t>(64);
+				auto [version, v1, v2, peer_id] = reader.ReadFields<8, 32, 32, 64>();
 
 				if (peer_id != player->m_GamerInfo.m_PeerId)
 				{
@@ -264,10 +280,7 @@ namespace YimMenu::Hooks
 			{
 				// now this is a... weirder case. if we let this go, then this peer could overwrite those who've already joined us
 
-				auto version = buffer.Read<uint8_t>(8);
-				auto v1      = buffer.Read<uint32_t>(32);
-				auto v2      = buffer.Read<uint32_t>(32);
-				auto peer_id = buffer.Read<uint64_t>(64);
+				auto [version, v1, v2, peer_id] = reader.ReadFields<8, 32, 32, 64>();
 
 				for (auto& [id, plyr] : Players::GetPlayers())
 				{
@@ -1,21 +1,92 @@
 #include "core/commands/BoolCommand.hpp"
+#include "core/commands/StringCommand.hpp"
+#include "core/filemgr/FileMgr.hpp"
 #include "core/hooking/DetourHook.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "util/Joaat.hpp"
 #include "util/StrToHex.hpp"
 #include "util/Protobufs.hpp"
 
+#include <charconv>
 #include <network/netServerMessages.hpp>
+#include <ranges>
+#include <sstream>
 
 
 namespace YimMenu::Features
 {
 	BoolCommand _UnlimitedItems{"unlimiteditems", "Unlimited Items", "Never run out of items in your inventory!"};
 	BoolCommand _LogServerMessages{"logservermessages", "Log Server Messages", "Log Server Messages"};
+	StringCommand _LogServerMessageFields{"logservermessagefields", "Logged Fields", "Field paths to log instead of whole messages, e.g. \"2.1 3\" logs field 1 of field 2 and field 3. Empty logs everything"};
+	BoolCommand _CaptureServerMessages{"captureservermessages", "Capture Server Messages", "Saves the raw protobuf messages to the server_messages folder, the protobuf tests can run on them"};
 }
 
 namespace YimMenu::Hooks
 {
+	// "2.1 3" -> {{2, 1}, {3}}
+	static std::vector<std::vector<int>> ParseFieldPaths(const std::string& text)
+	{
+		std::vector<std::vector<int>> paths;
+		std::istringstream stream(text);
+		std::string token;
+		while (stream >> token)
+		{
+			std::vector<int> path;
+			for (auto part : std::views::split(token, '.'))
+			{
+				int number = 0;
+				auto [end, ec] = std::from_chars(part.data(), part.data() + part.size(), number);
+				if (ec != std::errc() || end != part.data() + part.size() || number <= 0)
+				{
+					path.clear();
+					break;
+				}
+				path.push_back(number);
+			}
+
+			if (!path.empty())
+				paths.push_back(std::move(path));
+		}
+
+		return paths;
+	}
+
+	static std::string FormatFieldPath(const std::vector<int>& path)
+	{
+		std::string text;
+		for (auto number : path)
+			text += (text.empty() ? "" : ".") + std::to_string(number);
+		return text;
+	}
+
+	static void LogProtoBuffer(void* data, int size, void* def)
+	{
+		auto paths = ParseFieldPaths(Features::_LogServerMessageFields.GetString());
+		if (paths.empty())
+		{
+			PrintProtoBuffer(data, size, def);
+			return;
+		}
+
+		// only walks the submessages on each path instead of decoding the whole message
+		for (auto& path : paths)
+		{
+			if (auto field = FindProtoField(data, size, def, path))
+				PrintProtoField(*field);
+			else
+				LOG(VERBOSE) << "field " << FormatFieldPath(path) << " not found";
+		}
+	}
+
+	static void CaptureProtoBuffer(const char* name, const void* data, std::size_t size)
+	{
+		static std::atomic<std::uint32_t> count{0};
+
+		auto folder = FileMgr::GetProjectFolder("./server_messages/");
+		std::ofstream file(folder.Path() / std::format("{:05}_{}.bin", count++, name), std::ios::binary | std::ios::trunc);
+		file.write(static_cast<const char*>(data), size);
+	}
+
 	bool Protections::ReceiveServerMessage(void* a1, rage::netRpcReader* reader)
 	{
 		if (Features::_LogServerMessages.GetState())
@@ -33,9 +104,12 @@ namespace YimMenu::Hooks
 		if (Features::_LogServerMessages.GetState())
 		{
 			LOG(INFO) << __FUNCTION__ << ": " << message << ":";
-			PrintProtoBuffer(builder->GetData(), builder->GetSize(), def); // TODO this seems broken
+			LogProtoBuffer(builder->GetData(), builder->GetSize(), def); // TODO this seems broken
 		}
 
+		if (Features::_CaptureServerMessages.GetState())
+			CaptureProtoBuffer(message, builder->GetData(), builder->GetSize());
+
 		if (Joaat(message) == "UseItems"_J && Features::_UnlimitedItems.GetState())
 			return false;
 
@@ -49,12 +123,15 @@ namespace YimMenu::Hooks
 			if (!ctx->m_JsonReader)
 			{
 				LOG(INFO) << __FUNCTION__ " (proto) :: (at) RDR2.exe+0x" << std::hex << std::uppercase << ((__int64)_ReturnAddress() - (__int64)GetModuleHandleA(0));
-				PrintProtoBuffer(ctx->m_Data, ctx->m_Size, def);
+				LogProtoBuffer(ctx->m_Data, ctx->m_Size, def);
 			}
 			else
 				LOG(INFO) << __FUNCTION__ << " (json) :: " << reinterpret_cast<char*>(ctx->m_Data);
 		}
 
+		if (Features::_CaptureServerMessages.GetState() && !ctx->m_JsonReader)
+			CaptureProtoBuffer("received", ctx->m_Data, ctx->m_Size);
+
 		BaseHook::Get<DeserializeServerMessage, DetourHook<decltype(&DeserializeServerMessage)>>()->Original()(ctx, def, structure);
 	}
 }
\ No newline at end of file
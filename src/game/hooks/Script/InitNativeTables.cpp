@@ -1,6 +1,7 @@
 #include "core/hooking/DetourHook.hpp"
 #include "game/backend/NativeHooks.hpp"
 #include "game/backend/ScriptPatches.hpp"
+#include "game/backend/ScriptRegistry.hpp"
 #include "game/hooks/Hooks.hpp"
 
 namespace YimMenu::Hooks
@@ -10,6 +11,7 @@ namespace YimMenu::Hooks
 		bool ret = BaseHook::Get<Script::InitNativeTables, DetourHook<decltype(&InitNativeTables)>>()->Original()(program);
 		if (g_Running)
 		{
+			ScriptRegistry::RegisterProgram(program);
 			NativeHooks::RegisterProgram(program);
 			ScriptPatches::RegisterProgram(program);
 		}
@@ -1,13 +1,20 @@
 #include "core/hooking/DetourHook.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/ScriptProfiler.hpp"
+#include "game/backend/ScriptRegistry.hpp"
 
 namespace YimMenu::Hooks
 {
 	bool Script::RunScriptThreads(void* threads, int unk)
 	{
 		if (g_Running)
+		{
+			ScriptRegistry::Update();
+
+			ScriptProfiler::Run run;
 			ScriptMgr::Tick();
+		}
 		return BaseHook::Get<Script::RunScriptThreads, DetourHook<decltype(&RunScriptThreads)>>()->Original()(threads, unk);
 	}
 }
\ No newline at end of file
@@ -1,13 +1,20 @@
 #include "core/hooking/DetourHook.hpp"
 #include "game/hooks/Hooks.hpp"
 #include "game/backend/ScriptPatches.hpp"
+#include "game/backend/ScriptProfiler.hpp"
+
+#include <script/scrProgram.hpp>
+#include <script/scrThread.hpp>
 
 namespace YimMenu::Hooks
 {
 	int Script::ScriptVM(void* stack, void** globals, bool* globals_enabled, rage::scrProgram* program, rage::scrThreadContext* ctx)
 	{
+		ScriptProfiler::Run run(program->m_NameHash, ctx->m_ProgramCounter);
 		ScriptPatches::OnScriptVMEnter(program);
+		run.BeginVM();
 		int res = BaseHook::Get<Script::ScriptVM, DetourHook<decltype(&ScriptVM)>>()->Original()(stack, globals, globals_enabled, program, ctx);
+		run.EndVM();
 		ScriptPatches::OnScriptVMLeave(program);
 		return res;
 	}
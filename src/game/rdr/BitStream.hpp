@@ -0,0 +1,258 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <rage/datBitBuffer.hpp>
+
+// Word based readers and writers that are bit exact with datBitBuffer: fields are stored MSB first, and fields wider
+// than 32 bits are split into the low dword followed by the high bits. Batched reads and writes take their field widths
+// as template arguments so the whole batch is bounds checked once
+namespace YimMenu
+{
+	namespace BitStreamDetail
+	{
+		// loads up to 8 bytes starting at data as a big endian word, without reading past end
+		inline std::uint64_t LoadWord(const std::uint8_t* data, const std::uint8_t* end)
+		{
+			std::uint64_t word;
+			if (end - data >= 8)
+			{
+				std::memcpy(&word, data, sizeof(word));
+				return std::byteswap(word);
+			}
+
+			word = 0;
+			for (int i = 0; i < 8; i++)
+				word = (word << 8) | (data + i < end ? data[i] : 0);
+			return word;
+		}
+
+		template<int... Widths>
+		constexpr std::uint32_t SumWidths()
+		{
+			static_assert(((Widths >= 0 && Widths <= 64) && ...), "field widths must be between 0 and 64 bits");
+			return (0u + ... + static_cast<std::uint32_t>(Widths));
+		}
+	}
+
+	// Read-only view over the unread part of a datBitBuffer. Reading through the view never touches the buffer itself,
+	// so hooks can inspect the payload without copying the buffer or disturbing the game's read position
+	class BitReader
+	{
+		const std::uint8_t* m_Data;
+		const std::uint8_t* m_DataEnd;
+		std::uint32_t m_Position;
+		std::uint32_t m_End;
+		bool m_Overflowed = false;
+
+	public:
+		explicit BitReader(const rage::datBitBuffer& buffer) :
+		    m_Data(reinterpret_cast<const std::uint8_t*>(buffer.m_Data)),
+		    m_Position(buffer.m_BitOffset + buffer.m_BitsRead),
+		    m_End(buffer.m_BitOffset + ((buffer.m_FlagBits & 1) ? buffer.m_MaxBit : buffer.m_CurBit))
+		{
+			m_DataEnd = m_Data + (m_End + 7) / 8;
+		}
+
+		BitReader(const void* data, std::uint32_t size) :
+		    m_Data(reinterpret_cast<const std::uint8_t*>(data)),
+		    m_DataEnd(m_Data + size),
+		    m_Position(0),
+		    m_End(size * 8)
+		{
+		}
+
+		template<typename T>
+		T Read(int bits)
+		{
+			static_assert(sizeof(T) <= 8);
+
+			if (bits <= 0)
+				return T{};
+
+			if (bits > 64 || static_cast<std::uint32_t>(bits) > m_End - m_Position)
+			{
+				Overflow();
+				return T{};
+			}
+
+			return static_cast<T>(ReadUnchecked(bits));
+		}
+
+		// auto [magic, extended] = reader.ReadFields<14, 1>();
+		template<int... Widths>
+		std::array<std::uint64_t, sizeof...(Widths)> ReadFields()
+		{
+			constexpr auto total = BitStreamDetail::SumWidths<Widths...>();
+
+			if (total > m_End - m_Position)
+			{
+				Overflow();
+				return {};
+			}
+
+			// braced init guarantees left to right evaluation
+			return {ReadUnchecked(Widths)...};
+		}
+
+		void Skip(std::uint32_t bits)
+		{
+			if (bits > m_End - m_Position)
+			{
+				Overflow();
+				return;
+			}
+
+			m_Position += bits;
+		}
+
+		std::uint32_t GetRemaining() const
+		{
+			return m_End - m_Position;
+		}
+
+		// true if any read ran past the end of the buffer. such reads return 0
+		bool IsOverflowed() const
+		{
+			return m_Overflowed;
+		}
+
+		// moves the buffer's read position to where this view has read up to
+		void Sync(rage::datBitBuffer& buffer) const
+		{
+			buffer.m_BitsRead = m_Position - buffer.m_BitOffset;
+		}
+
+	private:
+		void Overflow()
+		{
+			m_Overflowed = true;
+			m_Position   = m_End;
+		}
+
+		std::uint32_t ReadBits32(int bits)
+		{
+			auto word = BitStreamDetail::LoadWord(m_Data + (m_Position >> 3), m_DataEnd);
+			auto value = static_cast<std::uint32_t>((word << (m_Position & 7)) >> (64 - bits));
+			m_Position += bits;
+			return value;
+		}
+
+		std::uint64_t ReadUnchecked(int bits)
+		{
+			if (bits == 0)
+				return 0;
+
+			if (bits <= 32)
+				return ReadBits32(bits);
+
+			std::uint64_t low = ReadBits32(32);
+			return low | (static_cast<std::uint64_t>(ReadBits32(bits - 32)) << 32);
+		}
+	};
+
+	// Writes straight into a datBitBuffer's storage and advances its write position, like datBitBuffer::Write
+	class BitWriter
+	{
+		rage::datBitBuffer& m_Buffer;
+		std::uint8_t* m_Data;
+		std::uint32_t m_Position;
+		std::uint32_t m_End;
+		bool m_Overflowed = false;
+
+	public:
+		explicit BitWriter(rage::datBitBuffer& buffer) :
+		    m_Buffer(buffer),
+		    m_Data(reinterpret_cast<std::uint8_t*>(buffer.m_Data)),
+		    m_Position(buffer.m_BitOffset + buffer.m_CurBit),
+		    m_End((buffer.m_FlagBits & 1) ? m_Position : buffer.m_BitOffset + buffer.m_MaxBit)
+		{
+		}
+
+		template<typename T>
+		bool Write(T value, int bits)
+		{
+			static_assert(sizeof(T) <= 8);
+
+			if (bits <= 0)
+				return true;
+
+			if (bits > 64 || static_cast<std::uint32_t>(bits) > m_End - m_Position)
+			{
+				m_Overflowed = true;
+				return false;
+			}
+
+			WriteUnchecked(static_cast<std::uint64_t>(value), bits);
+			Commit();
+			return true;
+		}
+
+		// writer.WriteFields<14, 1, 8>(0x3246, false, type);
+		template<int... Widths, typename... Ts>
+		bool WriteFields(Ts... values)
+		{
+			static_assert(sizeof...(Widths) == sizeof...(Ts), "every field needs a width");
+			constexpr auto total = BitStreamDetail::SumWidths<Widths...>();
+
+			if (total > m_End - m_Position)
+			{
+				m_Overflowed = true;
+				return false;
+			}
+
+			(WriteUnchecked(static_cast<std::uint64_t>(values), Widths), ...);
+			Commit();
+			return true;
+		}
+
+		bool IsOverflowed() const
+		{
+			return m_Overflowed;
+		}
+
+	private:
+		void WriteBits32(std::uint32_t value, int bits)
+		{
+			auto shift    = m_Position & 7;
+			auto data     = m_Data + (m_Position >> 3);
+			auto numBytes = (shift + bits + 7) / 8;
+
+			// only touch the bytes the field covers, preserving the surrounding bits like datBitBuffer does
+			std::uint64_t word = 0;
+			for (std::uint32_t i = 0; i < numBytes; i++)
+				word |= static_cast<std::uint64_t>(data[i]) << (56 - i * 8);
+
+			auto mask = (bits == 32 ? 0xFFFFFFFFull : ((1ull << bits) - 1)) << (64 - shift - bits);
+			word      = (word & ~mask) | ((static_cast<std::uint64_t>(value) << (64 - shift - bits)) & mask);
+
+			for (std::uint32_t i = 0; i < numBytes; i++)
+				data[i] = static_cast<std::uint8_t>(word >> (56 - i * 8));
+
+			m_Position += bits;
+		}
+
+		void WriteUnchecked(std::uint64_t value, int bits)
+		{
+			if (bits == 0)
+				return;
+
+			if (bits <= 32)
+			{
+				WriteBits32(static_cast<std::uint32_t>(value), bits);
+				return;
+			}
+
+			WriteBits32(static_cast<std::uint32_t>(value), 32);
+			WriteBits32(static_cast<std::uint32_t>(value >> 32), bits - 32);
+		}
+
+		void Commit()
+		{
+			m_Buffer.m_CurBit = m_Position - m_Buffer.m_BitOffset;
+			if (m_Buffer.m_HighestBitsRead < m_Buffer.m_CurBit)
+				m_Buffer.m_HighestBitsRead = m_Buffer.m_CurBit;
+		}
+	};
+}
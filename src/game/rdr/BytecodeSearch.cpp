@@ -0,0 +1,187 @@
+#include "BytecodeSearch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <immintrin.h>
+
+namespace YimMenu::BytecodeSearch
+{
+	struct Candidate
+	{
+		const SimplePattern* m_Pattern;
+		std::uint32_t m_Anchor; // index of the byte the scan looks for
+		std::optional<std::int32_t>* m_Result;
+	};
+
+	static bool MatchesAt(const BytecodeView& code, const SimplePattern& pattern, std::uint32_t start)
+	{
+		auto size = static_cast<std::uint32_t>(pattern.m_Bytes.size());
+		auto end  = start + size - 1;
+
+		// the common case doesn't cross into the next page and can compare memory directly
+		if ((start >> BytecodeView::PAGE_SHIFT) == (end >> BytecodeView::PAGE_SHIFT))
+		{
+			auto bytes = &code.GetPage(start >> BytecodeView::PAGE_SHIFT)[start & (BytecodeView::PAGE_SIZE - 1)];
+			for (std::uint32_t i = 0; i < size; i++)
+				if (pattern.m_Bytes[i] && *pattern.m_Bytes[i] != bytes[i])
+					return false;
+			return true;
+		}
+
+		for (std::uint32_t i = 0; i < size; i++)
+			if (pattern.m_Bytes[i] && *pattern.m_Bytes[i] != code[start + i])
+				return false;
+		return true;
+	}
+
+	static std::array<std::uint32_t, 256> CountBytes(const BytecodeView& code)
+	{
+		std::array<std::uint32_t, 256> counts{};
+		for (std::uint32_t page = 0; page < code.GetPageCount(); page++)
+			for (auto byte : code.GetPage(page))
+				counts[byte]++;
+		return counts;
+	}
+
+	void FindAll(const BytecodeView& code, std::span<const SimplePattern* const> patterns, std::span<std::optional<std::int32_t>> results)
+	{
+		for (auto& result : results)
+			result = std::nullopt;
+
+		if (patterns.empty() || code.GetSize() == 0)
+			return;
+
+		// rarer anchors mean fewer positions to check
+		auto counts = CountBytes(code);
+
+		std::array<std::vector<Candidate>, 256> buckets;
+		std::vector<std::uint8_t> anchors; // the distinct anchor bytes still being looked for
+		std::size_t remaining = 0;
+
+		for (std::size_t i = 0; i < patterns.size(); i++)
+		{
+			auto& bytes = patterns[i]->m_Bytes;
+			if (bytes.empty() || bytes.size() > code.GetSize())
+				continue;
+
+			std::optional<std::uint32_t> anchor;
+			for (std::uint32_t j = 0; j < bytes.size(); j++)
+				if (bytes[j] && (!anchor || counts[*bytes[j]] < counts[*bytes[*anchor]]))
+					anchor = j;
+
+			// nothing but wildcards matches right away
+			if (!anchor)
+			{
+				results[i] = 0;
+				continue;
+			}
+
+			auto byte = *bytes[*anchor];
+			if (buckets[byte].empty())
+				anchors.push_back(byte);
+			buckets[byte].push_back({patterns[i], *anchor, &results[i]});
+			remaining++;
+		}
+
+		// checks every pattern anchored on the byte at pc. false once everything has been found
+		auto check = [&](std::uint32_t pc) {
+			auto& bucket = buckets[code[pc]];
+			for (auto& candidate : bucket)
+			{
+				if (*candidate.m_Result || pc < candidate.m_Anchor)
+					continue;
+
+				auto start = pc - candidate.m_Anchor;
+				if (start + candidate.m_Pattern->m_Bytes.size() > code.GetSize() || !MatchesAt(code, *candidate.m_Pattern, start))
+					continue;
+
+				*candidate.m_Result = static_cast<std::int32_t>(start);
+				remaining--;
+			}
+
+			// stop looking for an anchor once all of its patterns were found
+			if (std::all_of(bucket.begin(), bucket.end(), [](const Candidate& candidate) {
+				    return candidate.m_Result->has_value();
+			    }))
+				std::erase(anchors, code[pc]);
+
+			return remaining != 0;
+		};
+
+		for (std::uint32_t page = 0; page < code.GetPageCount() && remaining; page++)
+		{
+			auto bytes = code.GetPage(page);
+			auto base  = page << BytecodeView::PAGE_SHIFT;
+			auto size  = static_cast<std::uint32_t>(bytes.size());
+
+			std::uint32_t i = 0;
+			for (; i + 16 <= size && remaining; i += 16)
+			{
+				auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes.data() + i));
+				auto hits  = _mm_setzero_si128();
+				for (auto anchor : anchors)
+					hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(static_cast<char>(anchor))));
+
+				for (auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(hits)); mask; mask &= mask - 1)
+				{
+					if (!check(base + i + std::countr_zero(mask)))
+						return;
+				}
+			}
+
+			for (; i < size; i++)
+				if (buckets[bytes[i]].size() && !check(base + i))
+					return;
+		}
+	}
+
+	std::optional<std::int32_t> Find(const BytecodeView& code, const SimplePattern& pattern)
+	{
+		const SimplePattern* patterns[] = {&pattern};
+		std::optional<std::int32_t> result;
+		FindAll(code, patterns, {&result, 1});
+		return result;
+	}
+
+	std::uint64_t Hash(const BytecodeView& code)
+	{
+		constexpr std::uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+
+		std::uint64_t hash = code.GetSize() * multiplier;
+		for (std::uint32_t page = 0; page < code.GetPageCount(); page++)
+		{
+			auto bytes = code.GetPage(page);
+
+			std::size_t i = 0;
+			for (; i + 8 <= bytes.size(); i += 8)
+			{
+				std::uint64_t word;
+				std::memcpy(&word, bytes.data() + i, sizeof(word));
+				hash = (hash ^ word) * multiplier;
+				hash ^= hash >> 32;
+			}
+
+			for (; i < bytes.size(); i++)
+			{
+				hash = (hash ^ bytes[i]) * multiplier;
+				hash ^= hash >> 32;
+			}
+		}
+
+		return hash;
+	}
+
+	std::uint64_t Hash(const SimplePattern& pattern)
+	{
+		// fnv-1a, with wildcards hashed as a value no byte can have
+		std::uint64_t hash = 0xCBF29CE484222325ULL;
+		for (auto& byte : pattern.m_Bytes)
+		{
+			hash ^= byte ? *byte : 0x100;
+			hash *= 0x100000001B3ULL;
+		}
+		return hash;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "core/memory/Pattern.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+
+namespace YimMenu
+{
+	// Script bytecode as the VM sees it, split into pages of PAGE_SIZE bytes with only the last one shorter
+	class BytecodeView
+	{
+	public:
+		static constexpr std::uint32_t PAGE_SHIFT = 14;
+		static constexpr std::uint32_t PAGE_SIZE  = 1 << PAGE_SHIFT;
+
+	private:
+		const std::uint8_t* const* m_Pages;
+		std::uint32_t m_Size;
+
+	public:
+		BytecodeView(const std::uint8_t* const* pages, std::uint32_t size) :
+		    m_Pages(pages),
+		    m_Size(size)
+		{
+		}
+
+		std::uint32_t GetSize() const
+		{
+			return m_Size;
+		}
+
+		std::uint32_t GetPageCount() const
+		{
+			return (m_Size + PAGE_SIZE - 1) >> PAGE_SHIFT;
+		}
+
+		std::span<const std::uint8_t> GetPage(std::uint32_t page) const
+		{
+			auto start = page << PAGE_SHIFT;
+			return {m_Pages[page], std::min(m_Size - start, PAGE_SIZE)};
+		}
+
+		std::uint8_t operator[](std::uint32_t pc) const
+		{
+			return m_Pages[pc >> PAGE_SHIFT][pc & (PAGE_SIZE - 1)];
+		}
+	};
+
+	namespace BytecodeSearch
+	{
+		// finds the first match of every pattern in one walk over the code. each pattern is anchored on its rarest fixed byte,
+		// and only the positions where one of the anchors shows up are compared
+		void FindAll(const BytecodeView& code, std::span<const SimplePattern* const> patterns, std::span<std::optional<std::int32_t>> results);
+
+		std::optional<std::int32_t> Find(const BytecodeView& code, const SimplePattern& pattern);
+
+		// identifies the bytecode a pc was found in
+		std::uint64_t Hash(const BytecodeView& code);
+
+		std::uint64_t Hash(const SimplePattern& pattern);
+	}
+}
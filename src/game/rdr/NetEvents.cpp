@@ -0,0 +1,100 @@
+#include "NetEvents.hpp"
+
+namespace YimMenu
+{
+	using NetEventDecoder = bool (*)(BitReader& reader, NetEventData& data);
+
+	static bool DecodeScriptCommand(BitReader& reader, NetEventData& data)
+	{
+		auto& event         = data.m_ScriptCommand;
+		event.m_NetId       = reader.Read<std::uint16_t>(13);
+		event.m_NumCommands = reader.Read<std::uint8_t>(3);
+		event.m_NumParams   = 0;
+
+		for (int i = 0; i < event.m_NumCommands; i++)
+		{
+			event.m_Commands[i].m_Hash       = reader.Read<std::uint64_t>(64);
+			event.m_Commands[i].m_NumParams  = reader.Read<std::uint8_t>(5);
+			event.m_Commands[i].m_ScriptHash = reader.Read<std::uint32_t>(32);
+			event.m_NumParams += event.m_Commands[i].m_NumParams;
+		}
+
+		for (int i = 0; i < event.m_NumParams && !reader.IsOverflowed(); i++)
+		{
+			int size = 1;
+			if (!reader.Read<bool>(1))
+				size = reader.Read<int>(7);
+
+			// sizes above 64 bits are only ever sent by malicious clients
+			auto value = reader.Read<std::uint64_t>(std::min(size, 64));
+			if (size > 64)
+				reader.Skip(size - 64);
+
+			if (i < ScriptCommandEventData::MAX_PARAMS)
+				event.m_Params[i] = static_cast<std::uint32_t>(value);
+		}
+
+		return !reader.IsOverflowed();
+	}
+
+	static bool DecodeDestroyVehicleLock(BitReader& reader, NetEventData& data)
+	{
+		data.m_DestroyVehicleLock.m_NetId = reader.Read<std::uint16_t>(13);
+		return !reader.IsOverflowed();
+	}
+
+	static bool DecodeExplosion(BitReader& reader, NetEventData& data)
+	{
+		auto& event          = data.m_Explosion;
+		event.m_OwnerNetId   = reader.Read<std::uint16_t>(13);
+		event.m_EntityNetId  = reader.Read<std::uint16_t>(13);
+		event.m_ExplosionTag = reader.Read<std::int8_t>(8);
+		return !reader.IsOverflowed();
+	}
+
+	static bool DecodePtfx(BitReader& reader, NetEventData& data)
+	{
+		auto& event         = data.m_Ptfx;
+		event.m_AssetHash   = reader.Read<std::uint32_t>(32);
+		event.m_EffectHash  = reader.Read<std::uint32_t>(32);
+		event.m_EntityNetId = reader.Read<std::uint16_t>(13);
+		return !reader.IsOverflowed();
+	}
+
+	static bool DecodeGiveControl(BitReader& reader, NetEventData& data)
+	{
+		auto& event        = data.m_GiveControl;
+		event.m_NumObjects = reader.Read<std::uint8_t>(3);
+
+		for (int i = 0; i < event.m_NumObjects; i++)
+		{
+			event.m_Objects[i].m_NetId      = reader.Read<std::uint16_t>(13);
+			event.m_Objects[i].m_ObjectType = reader.Read<std::uint8_t>(5);
+		}
+
+		return !reader.IsOverflowed();
+	}
+
+	static constexpr auto g_NetEventDecoders = [] {
+		std::array<NetEventDecoder, g_NetEventsToString.size()> decoders{};
+		decoders[static_cast<int>(NetEventType::SCRIPT_COMMAND_EVENT)]               = &DecodeScriptCommand;
+		decoders[static_cast<int>(NetEventType::NETWORK_DESTROY_VEHICLE_LOCK_EVENT)] = &DecodeDestroyVehicleLock;
+		decoders[static_cast<int>(NetEventType::EXPLOSION_EVENT)]                    = &DecodeExplosion;
+		decoders[static_cast<int>(NetEventType::NETWORK_PTFX_EVENT)]                 = &DecodePtfx;
+		decoders[static_cast<int>(NetEventType::GIVE_CONTROL_EVENT)]                 = &DecodeGiveControl;
+		return decoders;
+	}();
+
+	bool DecodeNetEvent(NetEventType type, const rage::datBitBuffer& buffer, NetEventData& data)
+	{
+		data.m_Type    = type;
+		data.m_Decoded = false;
+
+		if (static_cast<std::size_t>(type) >= g_NetEventDecoders.size() || !g_NetEventDecoders[static_cast<int>(type)])
+			return false;
+
+		BitReader reader(buffer);
+		data.m_Decoded = g_NetEventDecoders[static_cast<int>(type)](reader, data);
+		return data.m_Decoded;
+	}
+}
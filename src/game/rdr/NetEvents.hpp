@@ -0,0 +1,77 @@
+#pragma once
+#include "BitStream.hpp"
+#include "Enums.hpp"
+
+namespace YimMenu
+{
+	struct ScriptCommandEventData
+	{
+		static constexpr int MAX_COMMANDS = 7;  // 3 bit count
+		static constexpr int MAX_PARAMS   = 64; // the wire format allows 7 * 31, we only keep what we log
+
+		struct Command
+		{
+			std::uint64_t m_Hash;
+			std::uint32_t m_ScriptHash;
+			std::uint8_t m_NumParams;
+		};
+
+		std::uint16_t m_NetId;
+		std::uint8_t m_NumCommands;
+		std::uint16_t m_NumParams; // total on the wire, may be more than what fit in m_Params
+		std::array<Command, MAX_COMMANDS> m_Commands;
+		std::array<std::uint32_t, MAX_PARAMS> m_Params;
+	};
+
+	struct DestroyVehicleLockEventData
+	{
+		std::uint16_t m_NetId;
+	};
+
+	// only the leading fields, the rest of the payload isn't read
+	struct ExplosionEventData
+	{
+		std::uint16_t m_OwnerNetId;
+		std::uint16_t m_EntityNetId;
+		std::int8_t m_ExplosionTag;
+	};
+
+	struct PtfxEventData
+	{
+		std::uint32_t m_AssetHash;
+		std::uint32_t m_EffectHash;
+		std::uint16_t m_EntityNetId;
+	};
+
+	struct GiveControlEventData
+	{
+		static constexpr int MAX_OBJECTS = 7; // 3 bit count
+
+		struct Object
+		{
+			std::uint16_t m_NetId;
+			std::uint8_t m_ObjectType;
+		};
+
+		std::uint8_t m_NumObjects;
+		std::array<Object, MAX_OBJECTS> m_Objects;
+	};
+
+	// compact, trivially copyable decoded form of the events we care about
+	struct NetEventData
+	{
+		NetEventType m_Type;
+		bool m_Decoded; // false if there is no decoder for the type, or the payload was malformed
+		union
+		{
+			ScriptCommandEventData m_ScriptCommand;
+			DestroyVehicleLockEventData m_DestroyVehicleLock;
+			ExplosionEventData m_Explosion;
+			PtfxEventData m_Ptfx;
+			GiveControlEventData m_GiveControl;
+		};
+	};
+
+	// decodes the event payload without consuming it from the buffer
+	extern bool DecodeNetEvent(NetEventType type, const rage::datBitBuffer& buffer, NetEventData& data);
+}
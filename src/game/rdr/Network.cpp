@@ -63,13 +63,7 @@ namespace YimMenu::Network
 		}
 		else
 		{
-			for (auto& [_, player] : Players::GetPlayers())
-			{
-				if (player != Self::GetPlayer())
-				{
-					pack.Send(player, 7);
-				}
-			}
+			pack.SendToAll(7, false);
 		}
 
 		if (delete_locally)
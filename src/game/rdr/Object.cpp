@@ -1,6 +1,7 @@
 #include "Object.hpp"
 #include "Natives.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/Streaming.hpp"
 
 namespace YimMenu
 {
@@ -15,18 +16,13 @@ namespace YimMenu
 			return nullptr;
 		}
 
-		for (int i = 0; !STREAMING::HAS_MODEL_LOADED(model); i++)
+		ModelRequest request(model);
+		if (!request.Wait())
 		{
-			STREAMING::REQUEST_MODEL(model, false);
-			ScriptMgr::Yield();
-
-			if (i > 30)
-			{
 #ifdef ENTITY_DEBUG
-				LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
+			LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
 #endif
-				return nullptr;
-			}
+			return nullptr;
 		}
 
 		auto obj = Object(OBJECT::CREATE_OBJECT(model, coords.x, coords.y, coords.z, true, false, true, false, true));
@@ -39,8 +35,6 @@ namespace YimMenu
 			return nullptr;
 		}
 
-		STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
-
 		return obj;
 	}
 }
\ No newline at end of file
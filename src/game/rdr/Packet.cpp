@@ -1,6 +1,9 @@
 #include "Packet.hpp"
+#include "game/backend/Players.hpp"
+#include "game/backend/Self.hpp"
 #include "game/pointers/Pointers.hpp"
 
+#include <cstring>
 #include <network/CNetGamePlayer.hpp>
 #include <network/CNetworkPlayerMgr.hpp>
 #include <network/netPlayerMgrBase.hpp>
@@ -8,12 +11,71 @@
 
 namespace YimMenu
 {
+	// packets are short lived, so a handful of recycled buffers covers every packet alive at the same time
+	class PacketPool
+	{
+		static constexpr int NUM_BUFFERS = 32;
+
+		alignas(64) std::array<std::array<char, Packet::MAX_SIZE>, NUM_BUFFERS> m_Buffers;
+		std::atomic<std::uint32_t> m_FreeMask{0xFFFFFFFF};
+
+	public:
+		char* Acquire()
+		{
+			auto mask = m_FreeMask.load(std::memory_order_relaxed);
+			while (mask)
+			{
+				auto idx = std::countr_zero(mask);
+				if (m_FreeMask.compare_exchange_weak(mask, mask & ~(1u << idx), std::memory_order_acquire))
+					return m_Buffers[idx].data();
+			}
+
+			return nullptr;
+		}
+
+		// returns false if the buffer didn't come from the pool
+		bool Release(char* buffer)
+		{
+			auto offset = reinterpret_cast<std::uintptr_t>(buffer) - reinterpret_cast<std::uintptr_t>(m_Buffers.data());
+			if (offset >= sizeof(m_Buffers))
+				return false;
+
+			m_FreeMask.fetch_or(1u << (offset / Packet::MAX_SIZE), std::memory_order_release);
+			return true;
+		}
+
+		static PacketPool& Get()
+		{
+			static PacketPool Instance;
+			return Instance;
+		}
+	};
+
+	// cleared like a fresh buffer, since writes into the bit buffer only touch the bits they write and anything left from
+	// the previous packet would end up in this one
+	static char* AcquireBuffer()
+	{
+		auto buffer = PacketPool::Get().Acquire();
+		if (!buffer)
+			buffer = new char[Packet::MAX_SIZE];
+
+		std::memset(buffer, 0, Packet::MAX_SIZE);
+		return buffer;
+	}
+
 	Packet::Packet() :
-	    m_Buffer(m_Data, sizeof(m_Data))
+	    m_Data(AcquireBuffer()),
+	    m_Buffer(m_Data, MAX_SIZE)
 	{
 	}
 
-	void Packet::Send(uint32_t msg_id, int connection_id, bool reliable, bool immediate, bool out_of_frame)
+	Packet::~Packet()
+	{
+		if (!PacketPool::Get().Release(m_Data))
+			delete[] m_Data;
+	}
+
+	void Packet::SendImpl(std::span<const uint32_t> msg_ids, int connection_id, bool reliable, bool immediate, bool out_of_frame)
 	{
 		int flags = 0;
 		if (reliable && !out_of_frame)
@@ -21,14 +83,50 @@ namespace YimMenu
 		if (immediate)
 			flags |= 0x1000000;
 
-		if (out_of_frame)
-			Pointers.SendPacket(Pointers.NetworkPlayerMgr->m_NetConnectionManager, Pointers.GetPeerAddressByMessageId(Pointers.NetworkPlayerMgr->m_NetConnectionManager, msg_id), connection_id, m_Data, (m_Buffer.m_CurBit + 7) >> 3, flags); // technically also queues the packet, but whatever
-		else
-			Pointers.QueuePacket(Pointers.NetworkPlayerMgr->m_NetConnectionManager, msg_id, connection_id, m_Data, (m_Buffer.m_CurBit + 7) >> 3, flags, nullptr);
+		auto mgr  = Pointers.NetworkPlayerMgr->m_NetConnectionManager;
+		auto size = static_cast<int>((m_Buffer.m_CurBit + 7) >> 3);
+
+		for (auto msg_id : msg_ids)
+		{
+			if (out_of_frame)
+				Pointers.SendPacket(mgr, Pointers.GetPeerAddressByMessageId(mgr, msg_id), connection_id, m_Data, size, flags); // technically also queues the packet, but whatever
+			else
+				Pointers.QueuePacket(mgr, msg_id, connection_id, m_Data, size, flags, nullptr);
+		}
+	}
+
+	void Packet::Send(uint32_t msg_id, int connection_id, bool reliable, bool immediate, bool out_of_frame)
+	{
+		SendImpl({&msg_id, 1}, connection_id, reliable, immediate, out_of_frame);
 	}
 
 	void Packet::Send(Player player, int connection_id, bool reliable, bool immediate, bool out_of_frame)
 	{
 		Send(player.GetMessageId(), connection_id, reliable, immediate, out_of_frame);
 	}
-}
\ No newline at end of file
+
+	void Packet::Send(std::span<const uint32_t> msg_ids, int connection_id, bool reliable, bool immediate, bool out_of_frame)
+	{
+		SendImpl(msg_ids, connection_id, reliable, immediate, out_of_frame);
+	}
+
+	void Packet::SendToAll(int connection_id, bool include_self, bool reliable, bool immediate, bool out_of_frame)
+	{
+		std::array<uint32_t, 32> msg_ids;
+		std::size_t count = 0;
+
+		auto self = Self::GetPlayer();
+		for (auto& [_, player] : Players::GetPlayers())
+		{
+			if (count == msg_ids.size())
+				break;
+
+			if (!player.IsValid() || (!include_self && player == self))
+				continue;
+
+			msg_ids[count++] = player.GetMessageId();
+		}
+
+		SendImpl({msg_ids.data(), count}, connection_id, reliable, immediate, out_of_frame);
+	}
+}
@@ -1,21 +1,39 @@
 #pragma once
+#include "game/rdr/BitStream.hpp"
 #include "game/rdr/Enums.hpp"
 #include "game/rdr/Player.hpp"
 #include <rage/datBitBuffer.hpp>
+#include <span>
 
 
 namespace YimMenu
 {
 	class Packet
 	{
-		char m_Data[0x400]{};
+	public:
+		static constexpr std::size_t MAX_SIZE = 0x400;
+
+	private:
+		// taken from a shared pool and not cleared, the bit buffer never reads bits it hasn't written
+		char* m_Data;
 		rage::datBitBuffer m_Buffer;
+
+		void SendImpl(std::span<const uint32_t> msg_ids, int connection_id, bool reliable, bool immediate, bool out_of_frame);
+
 	public:
 
 		Packet();
+		~Packet();
+		Packet(const Packet&)            = delete;
+		Packet& operator=(const Packet&) = delete;
+
 		void Send(uint32_t msg_id, int connection_id, bool reliable = true, bool immediate = false, bool out_of_frame = false);
 		void Send(Player player, int connection_id, bool reliable = true, bool immediate = false, bool out_of_frame = false);
 
+		// the message is serialized once and queued for every connection in a single pass
+		void Send(std::span<const uint32_t> msg_ids, int connection_id, bool reliable = true, bool immediate = false, bool out_of_frame = false);
+		void SendToAll(int connection_id, bool include_self, bool reliable = true, bool immediate = false, bool out_of_frame = false);
+
 		inline operator rage::datBitBuffer&()
 		{
 			return m_Buffer;
@@ -28,18 +46,12 @@ namespace YimMenu
 
 		inline void WriteMessageHeader(NetMessageType message)
 		{
-			GetBuffer().Write<int>(0x3246, 14);
+			BitWriter writer(GetBuffer());
 			if ((int)message > 0xFF)
-			{
-				GetBuffer().Write<bool>(true, 1);
-				GetBuffer().Write<NetMessageType>(message, 16);
-			}
+				writer.WriteFields<14, 1, 16>(0x3246, true, message);
 			else
-			{
-				GetBuffer().Write<bool>(false, 1);
-				GetBuffer().Write<NetMessageType>(message, 8);
-			}
+				writer.WriteFields<14, 1, 8>(0x3246, false, message);
 		}
 	};
 
-}
\ No newline at end of file
+}
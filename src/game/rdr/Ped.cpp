@@ -2,6 +2,7 @@
 
 #include "Natives.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/Streaming.hpp"
 #include "game/backend/SafeNatives.hpp"
 
 
@@ -18,18 +19,13 @@ namespace YimMenu
 			return nullptr;
 		}
 
-		for (int i = 0; !STREAMING::HAS_MODEL_LOADED(model); i++)
+		ModelRequest request(model);
+		if (!request.Wait())
 		{
-			STREAMING::REQUEST_MODEL(model, false);
-			ScriptMgr::Yield();
-
-			if (i > 30)
-			{
 #ifdef ENTITY_DEBUG
-				LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
+			LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
 #endif
-				return nullptr;
-			}
+			return nullptr;
 		}
 
 		auto ped = Ped(PED::CREATE_PED(model, coords.x, coords.y, coords.z, heading, true, 0, 0, 0));
@@ -46,7 +42,6 @@ namespace YimMenu
 		ped.SetVelocity({});
 		PED::_SET_RANDOM_OUTFIT_VARIATION(ped.GetHandle(), true);
 		ENTITY::PLACE_ENTITY_ON_GROUND_PROPERLY(ped.GetHandle(), true);
-		STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
 
 		return ped;
 	}
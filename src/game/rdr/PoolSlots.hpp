@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <emmintrin.h>
+
+namespace YimMenu
+{
+	// a slot is free when the high bit of its flag byte is set (see fwBasePool::IsValid)
+	inline bool IsPoolSlotValid(const uint8_t* flags, uint32_t index)
+	{
+		return !(flags[index] & 0x80);
+	}
+
+	inline bool IsPoolGroupFree(const uint8_t* flags, uint32_t index)
+	{
+		return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(flags + index))) == 0xFFFF;
+	}
+
+	// Returns the first occupied slot after index, or size if there is none. A free slot that starts a group of 16 has
+	// the whole group checked at once, so runs of free slots like the unused tail of a pool are skipped a group at a
+	// time, while occupied slots cost no more than before. Every slot is checked when it's reached rather than ahead of
+	// time, since the loop body can free slots after the one it's on
+	inline uint32_t NextPoolSlot(const uint8_t* flags, uint32_t size, uint32_t index)
+	{
+		while (++index < size)
+		{
+			if (IsPoolSlotValid(flags, index))
+				return index;
+
+			if ((index & 15) == 0 && index + 16 <= size && IsPoolGroupFree(flags, index))
+			{
+				do
+					index += 16;
+				while (index + 16 <= size && IsPoolGroupFree(flags, index));
+
+				index--;
+			}
+		}
+
+		return size;
+	}
+}
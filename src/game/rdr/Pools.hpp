@@ -1,6 +1,7 @@
 #pragma once
 #include "Entity.hpp"
 #include "Ped.hpp"
+#include "PoolSlots.hpp"
 
 #include <rage/fwBasePool.hpp>
 
@@ -28,15 +29,7 @@ namespace YimMenu
 
 		PoolIterator& operator++()
 		{
-			for (m_Index++; m_Index < m_Pool->m_Size; m_Index++)
-			{
-				if (m_Pool->IsValid(m_Index))
-				{
-					return *this;
-				}
-			}
-
-			m_Index = m_Pool->m_Size;
+			m_Index = NextPoolSlot(reinterpret_cast<const uint8_t*>(m_Pool->m_Flags), m_Pool->m_Size, m_Index);
 			return *this;
 		}
 
@@ -0,0 +1,175 @@
+#include "Projection.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+
+namespace YimMenu
+{
+	static_assert(sizeof(ImVec2) == sizeof(float) * 2, "ProjectPoints stores screen positions as float pairs");
+
+	// anything closer to the camera than this can't be projected in a meaningful way
+	static constexpr float NEAR_PLANE = 0.01f;
+
+	static float DegToRad(float deg)
+	{
+		return static_cast<float>((3.14159265359 / 180) * deg);
+	}
+
+	Projection Projection::FromCamera(const rage::fvector3& position, const rage::fvector3& rotation, float fov, float width, float height)
+	{
+		Projection projection;
+		if (width <= 0.0f || height <= 0.0f)
+			return projection;
+
+		float sp = std::sin(DegToRad(rotation.x)), cp = std::cos(DegToRad(rotation.x));
+		float sr = std::sin(DegToRad(rotation.y)), cr = std::cos(DegToRad(rotation.y));
+		float sy = std::sin(DegToRad(rotation.z)), cy = std::cos(DegToRad(rotation.z));
+
+		// camera axes in world space for a yaw (z), pitch (x) and roll (y) rotation
+		float forward[3] = {-sy * cp, cy * cp, sp};
+		float right[3]   = {cr * cy - sp * sr * sy, cr * sy + sp * sr * cy, -cp * sr};
+		float up[3]      = {sr * cy + sp * cr * sy, sr * sy - sp * cr * cy, cp * cr};
+
+		// the game's field of view is vertical
+		auto tanHalfFov = std::tan(DegToRad(fov) * 0.5f);
+		auto scaleX     = 0.5f * width / (tanHalfFov * (width / height));
+		auto scaleY     = 0.5f * height / tanHalfFov;
+		float eye[3]    = {position.x, position.y, position.z};
+
+		// screen x = (right * scaleX + forward * width / 2) . (p - eye) / forward . (p - eye), same for y with up flipped
+		for (int i = 0; i < 3; i++)
+		{
+			projection.m_RowX[i] = right[i] * scaleX + forward[i] * 0.5f * width;
+			projection.m_RowY[i] = -up[i] * scaleY + forward[i] * 0.5f * height;
+			projection.m_RowW[i] = forward[i];
+		}
+
+		for (auto row : {projection.m_RowX, projection.m_RowY, projection.m_RowW})
+			row[3] = -(row[0] * eye[0] + row[1] * eye[1] + row[2] * eye[2]);
+
+		projection.m_Width  = width;
+		projection.m_Height = height;
+		return projection;
+	}
+
+	std::uint8_t Projection::Project(const rage::fvector3& point, ImVec2& out) const
+	{
+		// same order of operations as the batched version, so both agree on points right at the near plane
+		auto x = m_RowX[0] * point.x + m_RowX[3] + m_RowX[1] * point.y + m_RowX[2] * point.z;
+		auto y = m_RowY[0] * point.x + m_RowY[3] + m_RowY[1] * point.y + m_RowY[2] * point.z;
+		auto w = m_RowW[0] * point.x + m_RowW[3] + m_RowW[1] * point.y + m_RowW[2] * point.z;
+
+		if (!(w > NEAR_PLANE))
+		{
+			out = ImVec2(0.0f, 0.0f);
+			return 0;
+		}
+
+		out = ImVec2(x / w, y / w);
+
+		std::uint8_t flags = IN_FRONT;
+		if (out.x >= 0.0f && out.x <= m_Width && out.y >= 0.0f && out.y <= m_Height)
+			flags |= ON_SCREEN;
+		return flags;
+	}
+
+	namespace
+	{
+		// one lane per point, the same math as Projection::Project
+		struct SseLanes
+		{
+			static constexpr std::size_t WIDTH = 4;
+
+			static __m128 Dot(const float* row, __m128 x, __m128 y, __m128 z)
+			{
+				auto r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(row[0]), x), _mm_set1_ps(row[3]));
+				r      = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[1]), y));
+				return _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(row[2]), z));
+			}
+
+			static void Project(const float* rx, const float* ry, const float* rw, float width, float height, const rage::fvector3* points, ImVec2* out, std::uint8_t* flags)
+			{
+				auto p = points;
+				auto x = _mm_setr_ps(p[0].x, p[1].x, p[2].x, p[3].x);
+				auto y = _mm_setr_ps(p[0].y, p[1].y, p[2].y, p[3].y);
+				auto z = _mm_setr_ps(p[0].z, p[1].z, p[2].z, p[3].z);
+
+				auto w       = Dot(rw, x, y, z);
+				auto inFront = _mm_cmpgt_ps(w, _mm_set1_ps(NEAR_PLANE));
+				auto sx      = _mm_and_ps(_mm_div_ps(Dot(rx, x, y, z), w), inFront);
+				auto sy      = _mm_and_ps(_mm_div_ps(Dot(ry, x, y, z), w), inFront);
+
+				auto zero     = _mm_setzero_ps();
+				auto onScreen = _mm_and_ps(inFront, _mm_and_ps(_mm_cmpge_ps(sx, zero), _mm_cmple_ps(sx, _mm_set1_ps(width))));
+				onScreen      = _mm_and_ps(onScreen, _mm_and_ps(_mm_cmpge_ps(sy, zero), _mm_cmple_ps(sy, _mm_set1_ps(height))));
+
+				_mm_storeu_ps(reinterpret_cast<float*>(out), _mm_unpacklo_ps(sx, sy));
+				_mm_storeu_ps(reinterpret_cast<float*>(out + 2), _mm_unpackhi_ps(sx, sy));
+
+				auto frontMask  = _mm_movemask_ps(inFront);
+				auto screenMask = _mm_movemask_ps(onScreen);
+				for (int i = 0; i < 4; i++)
+					flags[i] = static_cast<std::uint8_t>(((frontMask >> i) & 1) * Projection::IN_FRONT | ((screenMask >> i) & 1) * Projection::ON_SCREEN);
+			}
+		};
+
+#ifdef __AVX__
+		struct AvxLanes
+		{
+			static constexpr std::size_t WIDTH = 8;
+
+			static __m256 Dot(const float* row, __m256 x, __m256 y, __m256 z)
+			{
+				auto r = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(row[0]), x), _mm256_set1_ps(row[3]));
+				r      = _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(row[1]), y));
+				return _mm256_add_ps(r, _mm256_mul_ps(_mm256_set1_ps(row[2]), z));
+			}
+
+			static void Project(const float* rx, const float* ry, const float* rw, float width, float height, const rage::fvector3* points, ImVec2* out, std::uint8_t* flags)
+			{
+				auto p = points;
+				auto x = _mm256_setr_ps(p[0].x, p[1].x, p[2].x, p[3].x, p[4].x, p[5].x, p[6].x, p[7].x);
+				auto y = _mm256_setr_ps(p[0].y, p[1].y, p[2].y, p[3].y, p[4].y, p[5].y, p[6].y, p[7].y);
+				auto z = _mm256_setr_ps(p[0].z, p[1].z, p[2].z, p[3].z, p[4].z, p[5].z, p[6].z, p[7].z);
+
+				auto w       = Dot(rw, x, y, z);
+				auto inFront = _mm256_cmp_ps(w, _mm256_set1_ps(NEAR_PLANE), _CMP_GT_OQ);
+				auto sx      = _mm256_and_ps(_mm256_div_ps(Dot(rx, x, y, z), w), inFront);
+				auto sy      = _mm256_and_ps(_mm256_div_ps(Dot(ry, x, y, z), w), inFront);
+
+				auto zero     = _mm256_setzero_ps();
+				auto onScreen = _mm256_and_ps(inFront, _mm256_and_ps(_mm256_cmp_ps(sx, zero, _CMP_GE_OQ), _mm256_cmp_ps(sx, _mm256_set1_ps(width), _CMP_LE_OQ)));
+				onScreen      = _mm256_and_ps(onScreen, _mm256_and_ps(_mm256_cmp_ps(sy, zero, _CMP_GE_OQ), _mm256_cmp_ps(sy, _mm256_set1_ps(height), _CMP_LE_OQ)));
+
+				// unpack works within 128 bit lanes, so this yields points 0 1 4 5 and 2 3 6 7
+				auto lo = _mm256_unpacklo_ps(sx, sy);
+				auto hi = _mm256_unpackhi_ps(sx, sy);
+				_mm256_storeu_ps(reinterpret_cast<float*>(out), _mm256_permute2f128_ps(lo, hi, 0x20));
+				_mm256_storeu_ps(reinterpret_cast<float*>(out + 4), _mm256_permute2f128_ps(lo, hi, 0x31));
+
+				auto frontMask  = _mm256_movemask_ps(inFront);
+				auto screenMask = _mm256_movemask_ps(onScreen);
+				for (int i = 0; i < 8; i++)
+					flags[i] = static_cast<std::uint8_t>(((frontMask >> i) & 1) * Projection::IN_FRONT | ((screenMask >> i) & 1) * Projection::ON_SCREEN);
+			}
+		};
+
+		using WideLanes = AvxLanes;
+#else
+		using WideLanes = SseLanes;
+#endif
+	}
+
+	void Projection::ProjectPoints(std::span<const rage::fvector3> points, std::span<ImVec2> out, std::span<std::uint8_t> flags) const
+	{
+		auto count = std::min({points.size(), out.size(), flags.size()});
+
+		std::size_t i = 0;
+		for (; i + WideLanes::WIDTH <= count; i += WideLanes::WIDTH)
+			WideLanes::Project(m_RowX, m_RowY, m_RowW, m_Width, m_Height, &points[i], &out[i], &flags[i]);
+
+		for (; i < count; i++)
+			flags[i] = Project(points[i], out[i]);
+	}
+}
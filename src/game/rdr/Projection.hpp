@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <rage/vector.hpp>
+#include <span>
+
+namespace YimMenu
+{
+	// World to screen projection for a single camera. Create it from the game thread once per frame, after that it is
+	// plain math and can be used from any thread. Only FromRenderedCamera touches the game, it lives in RenderedCamera.cpp
+	// so the math builds on its own
+	class Projection
+	{
+		// rows of the view-projection matrix, already scaled to pixels. for a point p, the screen position is
+		// (dot(x, p), dot(y, p)) / dot(w, p) where p has an implicit w of 1
+		alignas(16) float m_RowX[4]{};
+		alignas(16) float m_RowY[4]{};
+		alignas(16) float m_RowW[4]{};
+		float m_Width  = 0.0f;
+		float m_Height = 0.0f;
+
+	public:
+		enum Flags : std::uint8_t
+		{
+			IN_FRONT  = 1 << 0, // in front of the near plane, the screen position is meaningful
+			ON_SCREEN = 1 << 1, // inside the view frustum
+		};
+
+		// builds the projection of the camera the game rendered last. game thread only
+		static Projection FromRenderedCamera();
+
+		// rotation is in degrees like the game's camera rotation, fov is vertical
+		static Projection FromCamera(const rage::fvector3& position, const rage::fvector3& rotation, float fov, float width, float height);
+
+		bool IsValid() const
+		{
+			return m_Width > 0.0f;
+		}
+
+		std::uint8_t Project(const rage::fvector3& point, ImVec2& out) const;
+
+		// projects every point in one pass, four or eight at a time. flags receives a combination of Flags per point,
+		// points that aren't IN_FRONT are written as (0, 0)
+		void ProjectPoints(std::span<const rage::fvector3> points, std::span<ImVec2> out, std::span<std::uint8_t> flags) const;
+	};
+}
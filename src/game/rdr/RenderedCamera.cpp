@@ -0,0 +1,21 @@
+#include "Projection.hpp"
+
+#include "Natives.hpp"
+#include "game/pointers/Pointers.hpp"
+
+namespace YimMenu
+{
+	Projection Projection::FromRenderedCamera()
+	{
+		auto width  = static_cast<float>(*Pointers.ScreenResX);
+		auto height = static_cast<float>(*Pointers.ScreenResY);
+		if (width <= 0.0f || height <= 0.0f)
+			return {};
+
+		auto position = CAM::GET_FINAL_RENDERED_CAM_COORD();
+		auto rotation = CAM::GET_FINAL_RENDERED_CAM_ROT(2);
+		auto fov      = CAM::GET_FINAL_RENDERED_CAM_FOV();
+
+		return FromCamera({position.x, position.y, position.z}, {rotation.x, rotation.y, rotation.z}, fov, width, height);
+	}
+}
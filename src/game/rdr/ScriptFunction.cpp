@@ -1,5 +1,6 @@
 #include "ScriptFunction.hpp"
 #include "Scripts.hpp"
+#include "game/backend/ScriptPatterns.hpp"
 #include "game/pointers/Pointers.hpp"
 #include <script/scrProgram.hpp>
 #include <script/scrThread.hpp>
@@ -7,29 +8,48 @@
 
 namespace YimMenu
 {
-	// TODO: code duplication
-	static std::optional<int32_t> GetCodeLocationByPattern(rage::scrProgram* program, const SimplePattern& pattern)
+	static constexpr std::uint32_t SCRATCH_STACK_SIZE = 25000;
+
+	// static calls run on a copy of the current script thread with a stack of its own. the thread is copied again for
+	// every call, since which script is running and its state change from one call to the next, but the stack is set
+	// up the first time a script's functions are called and reused after that
+	struct ScratchThread
 	{
-		uint32_t code_size = program->GetFullCodeSize();
-		for (uint32_t i = 0; i < (code_size - pattern.m_Bytes.size()); i++)
+		alignas(rage::scrThread) std::uint8_t m_Thread[sizeof(rage::scrThread)];
+		std::unique_ptr<std::uint64_t[]> m_Stack;
+		bool m_InUse = false;
+
+		rage::scrThread* Get()
 		{
-			for (uint32_t j = 0; j < pattern.m_Bytes.size(); j++)
-			{
-				if (pattern.m_Bytes[j].has_value())
-				{
-					int loc = i + j;
-					if (pattern.m_Bytes[j] != *program->GetCodeAddress(loc))
-						goto incorrect;
-				}
-			}
+			return reinterpret_cast<rage::scrThread*>(m_Thread);
+		}
 
-			return i;
-		incorrect:
-			continue;
+		// false if no script thread is running to copy from
+		bool Init()
+		{
+			auto current = *Pointers.CurrentScriptThread;
+			if (!current)
+				return false;
+
+			if (!m_Stack)
+				m_Stack = std::make_unique<std::uint64_t[]>(SCRATCH_STACK_SIZE);
+
+			std::memcpy(m_Thread, current, sizeof(rage::scrThread));
+			Get()->m_Stack                  = m_Stack.get();
+			Get()->m_Context.m_StackSize    = SCRATCH_STACK_SIZE;
+			Get()->m_Context.m_StackPointer = 1;
+			return true;
 		}
+	};
 
-		return std::nullopt;
-	}
+	static std::unordered_map<joaat_t, ScratchThread> s_ScratchThreads;
+
+	// the VM only reads these, so they can be shared by every call
+	static const auto s_GlobalsInitialized = [] {
+		std::array<bool, 50> initialized;
+		initialized.fill(true);
+		return initialized;
+	}();
 
 	std::optional<std::int32_t> ScriptFunction::GetPC()
 	{
@@ -40,7 +60,8 @@ namespace YimMenu
 		
 		if (program)
 		{
-			m_Pc = GetCodeLocationByPattern(program, m_Pattern);
+			ScriptPatterns::Resolve(program);
+			m_Pc = ScriptPatterns::GetPC(m_PatternId);
 
 			if (!m_Pc.has_value())
 			{
@@ -57,14 +78,12 @@ namespace YimMenu
 
 	ScriptFunction::ScriptFunction(joaat_t hash, SimplePattern pattern) :
 	    m_Hash(hash),
-	    m_Pattern(pattern)
+	    m_PatternId(ScriptPatterns::Add(hash, std::move(pattern)))
 	{
 	}
 
-	void ScriptFunction::RunScript(rage::scrThread* thread, rage::scrProgram* program, const std::vector<uint64_t>& args, void* returnValue, uint32_t returnSize)
+	void ScriptFunction::RunScript(rage::scrThread* thread, rage::scrProgram* program, std::span<const std::uint64_t> args, void* returnValue, uint32_t returnSize)
 	{
-		const auto globals_initialized = std::vector<std::uint8_t>(50, true); // std::vector<bool> does weird stuff so we aren't using that
-
 		auto old_thread         = *Pointers.CurrentScriptThread;
 		auto old_thread_running = rage::tlsContext::Get()->m_RunningScript;
 		auto stack              = reinterpret_cast<uint64_t*>(thread->m_Stack);
@@ -80,7 +99,7 @@ namespace YimMenu
 
 		Pointers.ScriptVM(stack,
 		    Pointers.ScriptGlobals,
-		    reinterpret_cast<bool*>(const_cast<uint8_t*>(globals_initialized.data())),
+		    const_cast<bool*>(s_GlobalsInitialized.data()),
 		    program,
 		    &context);
 
@@ -91,7 +110,7 @@ namespace YimMenu
 			memcpy(returnValue, stack + top, returnSize);
 	}
 
-	void ScriptFunction::StaticCallImpl(const std::vector<uint64_t>& args, void* returnValue, uint32_t returnSize)
+	void ScriptFunction::StaticCallImpl(std::span<const std::uint64_t> args, void* returnValue, uint32_t returnSize)
 	{
 		auto pc = GetPC();
 		auto program = Scripts::FindScriptProgram(m_Hash);
@@ -99,21 +118,24 @@ namespace YimMenu
 		if (!pc || !program)
 			return;
 
-		rage::scrThread* thread = (rage::scrThread*)new uint8_t[sizeof(rage::scrThread)];
-		memcpy(thread, *Pointers.CurrentScriptThread, sizeof(rage::scrThread));
+		// a call made from inside another one gets a thread of its own
+		ScratchThread nested;
+		auto& pooled  = s_ScratchThreads[m_Hash];
+		auto& scratch = pooled.m_InUse ? nested : pooled;
+		if (!scratch.Init())
+		{
+			LOG(WARNING) << "Static script call made outside of a script thread";
+			return;
+		}
 
-		void* stack                      = new uint64_t[25000];
-		thread->m_Stack                  = stack;
-		thread->m_Context.m_StackSize    = 25000;
-		thread->m_Context.m_StackPointer = 1;
+		scratch.m_InUse = true;
 
-		RunScript(thread, program, args, returnValue, returnSize);
+		RunScript(scratch.Get(), program, args, returnValue, returnSize);
 
-		delete[] stack;
-		delete[] (uint8_t*)thread;
+		scratch.m_InUse = false;
 	}
 
-	void ScriptFunction::CallImpl(const std::vector<uint64_t>& args, void* returnValue, uint32_t returnSize)
+	void ScriptFunction::CallImpl(std::span<const std::uint64_t> args, void* returnValue, uint32_t returnSize)
 	{
 		auto pc      = GetPC();
 		auto thread  = Scripts::FindScriptThread(m_Hash);
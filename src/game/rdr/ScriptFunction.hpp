@@ -2,6 +2,9 @@
 #include "core/memory/Pattern.hpp"
 #include "util/Joaat.hpp"
 
+#include <array>
+#include <cstring>
+#include <span>
 #include <type_traits>
 
 namespace rage
@@ -16,62 +19,66 @@ namespace YimMenu
 	{
 	private:
 		joaat_t m_Hash;
-		SimplePattern m_Pattern;
+		std::uint32_t m_PatternId;
 		std::optional<std::int32_t> m_Pc;
 
 		std::optional<std::int32_t> GetPC();
 
-		void RunScript(rage::scrThread* thread, rage::scrProgram* program, const std::vector<uint64_t>& args, void* returnValue, uint32_t returnSize);
+		void RunScript(rage::scrThread* thread, rage::scrProgram* program, std::span<const std::uint64_t> args, void* returnValue, uint32_t returnSize);
 
-		void CallImpl(const std::vector<uint64_t>& args, void* returnValue = 0, uint32_t returnSize = 0);
+		void CallImpl(std::span<const std::uint64_t> args, void* returnValue = 0, uint32_t returnSize = 0);
 
-		void StaticCallImpl(const std::vector<uint64_t>& args, void* returnValue = 0, uint32_t returnSize = 0);
+		void StaticCallImpl(std::span<const std::uint64_t> args, void* returnValue = 0, uint32_t returnSize = 0);
 
-	public:
-		ScriptFunction(joaat_t hash, SimplePattern pattern);
-
-		template<typename Ret = void, typename... Args>
-		Ret StaticCall(Args... args)
+		// every script argument takes up one stack slot, anything smaller is zero extended
+		template<typename T>
+		static std::uint64_t ToArg(const T& arg)
 		{
-			std::vector<uint64_t> params;
-			(params.push_back(*reinterpret_cast<std::uint64_t*>(&args)), ...);
+			static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(std::uint64_t), "script arguments can't be larger than a stack slot");
+
+			std::uint64_t value = 0;
+			std::memcpy(&value, &arg, sizeof(T));
+			return value;
+		}
 
+		template<typename Ret, typename Impl>
+		Ret Invoke(Impl impl, std::span<const std::uint64_t> args)
+		{
 			if constexpr (!std::is_same_v<Ret, void>)
 			{
-				Ret returnValue;
-				StaticCallImpl(params, &returnValue, sizeof(returnValue));
+				Ret returnValue{};
+				(this->*impl)(args, &returnValue, sizeof(returnValue));
 				return returnValue;
 			}
 			else
 			{
-				StaticCallImpl(params);
+				(this->*impl)(args, nullptr, 0);
 			}
 		}
 
+	public:
+		ScriptFunction(joaat_t hash, SimplePattern pattern);
+
+		// runs the function on a scratch thread, the script doesn't need to be running
 		template<typename Ret = void, typename... Args>
-		Ret Call(Args... args)
+		Ret StaticCall(Args... args)
 		{
-			std::vector<uint64_t> params;
-			(params.push_back(*reinterpret_cast<std::uint64_t*>(&args)), ...);
+			const std::array<std::uint64_t, sizeof...(Args)> params{ToArg(args)...};
+			return Invoke<Ret>(&ScriptFunction::StaticCallImpl, params);
+		}
 
-			if constexpr (!std::is_same_v<Ret, void>)
-			{
-				Ret returnValue;
-				CallImpl(params, &returnValue, sizeof(returnValue));
-				return returnValue;
-			}
-			else
-			{
-				CallImpl(params);
-			}
+		// runs the function on the script's own thread
+		template<typename Ret = void, typename... Args>
+		Ret Call(Args... args)
+		{
+			const std::array<std::uint64_t, sizeof...(Args)> params{ToArg(args)...};
+			return Invoke<Ret>(&ScriptFunction::CallImpl, params);
 		}
 
 		template<typename... Args>
 		void operator()(Args... args)
 		{
-			std::vector<uint64_t> params;
-			(params.push_back(*reinterpret_cast<std::uint64_t*>(&args)), ...);
-			CallImpl(params);
+			Call(args...);
 		}
 	};
 
@@ -5,6 +5,7 @@
 #include <network/CNetworkPlayerMgr.hpp>
 #include <rage/tlsContext.hpp>
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/ScriptRegistry.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/Natives.hpp"
 #include "game/rdr/data/ScriptNames.hpp"
@@ -13,28 +14,12 @@ namespace YimMenu::Scripts
 {
 	rage::scrThread* FindScriptThread(joaat_t hash)
 	{
-		for (auto& thread : *Pointers.ScriptThreads)
-		{
-			if (thread && thread->m_Context.m_ThreadId && thread->m_Context.m_ScriptHash == hash)
-			{
-				return thread;
-			}
-		}
-
-		return nullptr;
+		return ScriptRegistry::GetThread(hash);
 	}
 
 	rage::scrProgram* FindScriptProgram(joaat_t hash)
 	{
-		for (int i = 0; i < 160; i++)
-		{
-			if (Pointers.ScriptPrograms[i] && Pointers.ScriptPrograms[i]->m_NameHash == hash)
-			{
-				return Pointers.ScriptPrograms[i];
-			}
-		}
-
-		return nullptr;
+		return ScriptRegistry::GetProgram(hash);
 	}
 
 	void RunAsScript(rage::scrThread* thread, std::function<void()> callback)
@@ -62,19 +47,13 @@ namespace YimMenu::Scripts
 	{
 		if (UsingMPScripts())
 		{
-			for (int i = 0; i < Data::g_MpScriptNames.size(); i++)
-			{
-				if (Data::g_MpScriptNames[i].first == hash)
-					return Data::g_MpScriptNames[i].second;
-			}
+			if (auto it = Data::g_MpScriptNames.find(hash); it != Data::g_MpScriptNames.end())
+				return it->second;
 		}
 		else
 		{
-			for (int i = 0; i < Data::g_SpScriptNames.size(); i++)
-			{
-				if (Data::g_SpScriptNames[i].first == hash)
-					return Data::g_SpScriptNames[i].second;
-			}
+			if (auto it = Data::g_SpScriptNames.find(hash); it != Data::g_SpScriptNames.end())
+				return it->second;
 		}
 
 		return "Unknown";
@@ -95,19 +74,4 @@ namespace YimMenu::Scripts
 	{
 		return ScriptIdentifier(thread ? thread->m_Context.m_ScriptHash : 0, UsingMPScripts());
 	}
-
-	bool RequestScript(joaat_t script)
-	{
-		if (!SCRIPTS::HAS_SCRIPT_WITH_NAME_HASH_LOADED(script))
-		{
-			SCRIPTS::REQUEST_SCRIPT_WITH_NAME_HASH(script);
-			for (int i = 0; i < 150 && !SCRIPTS::HAS_SCRIPT_WITH_NAME_HASH_LOADED(script); i++)
-				ScriptMgr::Yield(10ms);
-		}
-
-		if (SCRIPTS::HAS_SCRIPT_WITH_NAME_HASH_LOADED(script))
-			return true;
-		
-		return false;
-	}
 }
\ No newline at end of file
@@ -61,7 +61,6 @@ namespace YimMenu::Scripts
 	extern void SendScriptEvent(uint64_t* data, int count, int metadataIndex, int bits);
 	extern const char* GetScriptName(joaat_t hash);
 	extern void ForceScriptHost(rage::scrThread* thread);
-	extern bool RequestScript(joaat_t script);
 	extern bool UsingMPScripts();
 	extern ScriptIdentifier GetScriptIdentifier(rage::scrThread* thread);
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Vehicle.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/Streaming.hpp"
 #include "Natives.hpp"
 
 namespace YimMenu
@@ -15,18 +16,13 @@ namespace YimMenu
 			return nullptr;
 		}
 
-		for (int i = 0; !STREAMING::HAS_MODEL_LOADED(model); i++)
+		ModelRequest request(model);
+		if (!request.Wait())
 		{
-			STREAMING::REQUEST_MODEL(model, false);
-			ScriptMgr::Yield();
-
-			if (i > 30)
-			{
 #ifdef ENTITY_DEBUG
-				LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
+			LOGF(WARNING, "Model 0x{:X} failed to load after 30 ticks, bailing out", model);
 #endif
-				return nullptr;
-			}
+			return nullptr;
 		}
 
 		auto veh = Vehicle(VEHICLE::CREATE_VEHICLE(model, coords.x, coords.y, coords.z, heading, true, false, false, 0));
@@ -40,7 +36,6 @@ namespace YimMenu
 		}
 
 		VEHICLE::SET_VEHICLE_ON_GROUND_PROPERLY(veh.GetHandle(), 0);
-		STREAMING::SET_MODEL_AS_NO_LONGER_NEEDED(model);
 
 		return veh;
 	}
@@ -1,11 +1,23 @@
 #pragma once
+#include "core/misc/ConstFlatMap.hpp"
 
 namespace YimMenu::Data
 {
-	const inline std::unordered_map<int, std::string> g_MessageTypes = {
-	    {0x61, "JOIN_RESPONSE"},
-	    {0x70, "PACKED_EVENTS"},
-	    {0x71, "PACKED_EVENT_RELIABLES_MSGS"},
+	// sorted by message id, see ConstFlatMap
+	inline constexpr auto g_MessageTypes = MakeConstFlatMap<int, const char*>({
+	    {0x1A, "PEER_PHYSICAL_INDEX"},
+	    {0x1B, "REQUEST_PEER_PHYSICAL_INDEX"},
+	    {0x1C, "JOIN_RESPONSE2"},
+	    {0x1D, "REQUEST_RESET_POPULATION"},
+	    {0x1E, "RESET_POPULATION"},
+	    {0x1F, "READY_TO_RESET_POPULATION"},
+	    {0x20, "FINISHED_RESET_POPULATION"},
+	    {0x21, "CLOCK_INFO_REQUEST"},
+	    {0x22, "CLOCK_INFO"},
+	    {0x23, "RADIO_STATION_SYNC"},
+	    {0x24, "RADIO_STATION_SYNC_REQUEST"},
+	    {0x25, "PLAYER_CARD_SYNC"},
+	    {0x26, "PLAYER_CARD_REQUEST"},
 	    {0x27, "MERGE_SESSION_DISTRIBUTE_OBJECT_ID_REMAPPINGS"},
 	    {0x28, "MERGE_SESSION_DISTRIBUTE_OBJECT_ID_REMAPPINGS_ACK"},
 	    {0x29, "PLAYER_ID_REMAP_READY"},
@@ -14,17 +26,68 @@ namespace YimMenu::Data
 	    {0x2C, "OBJECT_ID_REMAP_READY_TO_RESTART"},
 	    {0x2D, "NOTIFY_USING_NEW_OBJECT_IDS"},
 	    {0x2E, "NOTIFY_USING_NEW_PLAYER_IDS"},
-	    {0x64, "REMOVE_GAMERS_FROM_SESSION_CMD"},
+	    {0x2F, "READY_FOR_GAME_SYNC"},
+	    {0x30, "READY_FOR_GAME_SYNC_ACK"},
+	    {0x31, "PLAYER_INITIALIZED"},
+	    {0x32, "SCRIPT_SHUTTING_DOWN_FOR_MERGE"},
+	    {0x35, "DEBUG_STALL"},
+	    {0x36, "SESSION_INFO"},
+	    {0x37, "SESSION_INFO_RESPONSE"},
+	    {0x38, "SESSION_JOIN_REQUEST"},
+	    {0x39, "SESSION_JOIN_REQUEST_RESPONSE"},
+	    {0x3A, "SESSION_ACCEPT_CHAT"},
+	    {0x3B, "VOICE_CHAT_STATUS"},
+	    {0x3C, "TEXT_MESSAGE"},
 	    {0x40, "TEXT_CHAT"},
 	    {0x41, "TEXT_CHAT_STATUS"},
-	    {0x21, "CLOCK_INFO_REQUEST"},
-	    {0x22, "CLOCK_INFO"},
-	    {0x75, "CLONE_SYNC"},
-	    {0x76, "PACKED_CLONE_SYNC_ACKS"},
-	    {0x77, "PACKED_RELIABLES"},
+	    {0x42, "CXN_RELAY_ADDR_CHANGES"},
+	    {0x43, "CXN_REQUEST_REMOTE_TIMEOUT"},
+	    {0x44, "NET_ROUTE_REQUEST"},
+	    {0x45, "NET_ROUTE_REPLY"},
+	    {0x46, "NET_ROUTE_ERROR"},
+	    {0x47, "NET_KEY_EXCHANGE_SESSION_OFFER"},
+	    {0x48, "NET_KEY_EXCHANGE_SESSION_ANSWER"},
+	    {0x49, "NET_LAG_PING"},
+	    {0x4A, "NET_COMPLAINT"},
+	    {0x4B, "NET_TIME_SYNC"},
+	    {0x4D, "NET_ICE_SESSION_OFFER"},
+	    {0x4E, "NET_ICE_SESSION_ANSWER"},
+	    {0x4F, "NET_ICE_SESSION_PING"},
+	    {0x50, "NET_ICE_SESSION_PONG"},
+	    {0x51, "NET_ICE_SESSION_PORT_OPENER"},
+	    {0x52, "NET_ICE_SESSION_DEBUG_INFO"},
+	    {0x55, "CONNECT_REQUEST"},
+	    {0x56, "CONNECT_RESPONSE"},
+	    {0x57, "PARTY_ENTER_GAME"},
+	    {0x58, "PARTY_LEAVE_GAME"},
+	    {0x59, "UNK_0x59"},
+	    {0x5B, "SEARCH_REQUEST"},
+	    {0x5C, "SEARCH_RESPONSE"},
+	    {0x5E, "CONFIG_REQUEST"},
+	    {0x61, "JOIN_RESPONSE"},
+	    {0x62, "ADD_GAMER_TO_SESSION_CMD"},
+	    {0x63, "HOST_LEFT_WHILST_JOINING_CMD"},
+	    {0x64, "REMOVE_GAMERS_FROM_SESSION_CMD"},
+	    {0x65, "MIGRATE_HOST_REQUEST"},
+	    {0x66, "MIGRATE_HOST_RESPONSE"},
+	    {0x67, "SESSION_MEMBERS"},
+	    {0x6B, "QOS_PROBE_REQUEST"},
+	    {0x6C, "QOS_PROBE_RESPONSE"},
 	    {0x6D, "NET_ARRAY_MGR_UPDATE"},
 	    {0x6E, "NET_ARRAY_MGR_UPDATE_ACK"},
 	    {0x6F, "NET_ARRAY_MGR_SPLIT_UPDATE_ACK"},
+	    {0x70, "PACKED_EVENTS"},
+	    {0x71, "PACKED_EVENT_RELIABLES_MSGS"},
+	    {0x72, "REQUEST_OBJECT_IDS"},
+	    {0x73, "INFORM_OBJECT_IDS"},
+	    {0x75, "CLONE_SYNC"},
+	    {0x76, "PACKED_CLONE_SYNC_ACKS"},
+	    {0x77, "PACKED_RELIABLES"},
+	    {0x78, "REASSIGN_NEGOTIATE"},
+	    {0x79, "REASSIGN_CONFIRM"},
+	    {0x7A, "REASSIGN_RESPONSE"},
+	    {0x7B, "PLAYER_DATA"},
+	    {0x7C, "ACTIVATE_NETWORK_BOT"},
 	    {0x7D, "SCRIPT_JOIN"},
 	    {0x7E, "SCRIPT_JOIN_ACK"},
 	    {0x7F, "SCRIPT_JOIN_HOST_ACK"},
@@ -45,70 +108,8 @@ namespace YimMenu::Data
 	    {0x8E, "SCRIPT_VERIFY_HOST_ACK"},
 	    {0x8F, "SCRIPT_QUERY_EXISTING_HOST"},
 	    {0x90, "SCRIPT_QUERY_EXISTING_HOST_ACK"},
-	    {0x32, "SCRIPT_SHUTTING_DOWN_FOR_MERGE"},
-	    {0x62, "ADD_GAMER_TO_SESSION_CMD"},
-	    {0x7A, "REASSIGN_RESPONSE"},
-	    {0x78, "REASSIGN_NEGOTIATE"},
-	    {0x79, "REASSIGN_CONFIRM"},
-	    {0x72, "REQUEST_OBJECT_IDS"},
-	    {0x73, "INFORM_OBJECT_IDS"},
-	    {0x4B, "NET_TIME_SYNC"},
-	    {0x3C, "TEXT_MESSAGE"},
-	    {0x3B, "VOICE_CHAT_STATUS"},
-	    {0x1D, "REQUEST_RESET_POPULATION"},
-	    {0x1E, "RESET_POPULATION"},
-	    {0x1F, "READY_TO_RESET_POPULATION"},
-	    {0x20, "FINISHED_RESET_POPULATION"},
-	    {0x2F, "READY_FOR_GAME_SYNC"},
-	    {0x30, "READY_FOR_GAME_SYNC_ACK"},
-	    {0x31, "PLAYER_INITIALIZED"},
-	    {0x55, "CONNECT_REQUEST"},
-	    {0x56, "CONNECT_RESPONSE"},
-	    {0x6B, "QOS_PROBE_REQUEST"},
-	    {0x6C, "QOS_PROBE_RESPONSE"},
-	    {0x4D, "NET_ICE_SESSION_OFFER"},
-	    {0x4E, "NET_ICE_SESSION_ANSWER"},
-	    {0x4F, "NET_ICE_SESSION_PING"},
-	    {0x50, "NET_ICE_SESSION_PONG"},
-	    {0x51, "NET_ICE_SESSION_PORT_OPENER"},
-	    {0x52, "NET_ICE_SESSION_DEBUG_INFO"},
-	    {0x96, "ICE_SESSION_RELAY_ROUTE_CHECK"},
-	    {0x1A, "PEER_PHYSICAL_INDEX"},
-	    {0x1B, "REQUEST_PEER_PHYSICAL_INDEX"},
-	    {0x1C, "JOIN_RESPONSE2"},
-	    {0x36, "SESSION_INFO"},
-	    {0x23, "RADIO_STATION_SYNC"},
-	    {0x24, "RADIO_STATION_SYNC_REQUEST"},
-	    {0x25, "PLAYER_CARD_SYNC"},
-	    {0x26, "PLAYER_CARD_REQUEST"},
-	    {0x35, "DEBUG_STALL"},
-	    {0x3A, "SESSION_ACCEPT_CHAT"},
-	    {0x37, "SESSION_INFO_RESPONSE"},
-	    {0x38, "SESSION_JOIN_REQUEST"},
-	    {0x39, "SESSION_JOIN_REQUEST_RESPONSE"},
-	    {0x49, "NET_LAG_PING"},
-	    {0x4A, "NET_COMPLAINT"},
-	    {0x43, "CXN_REQUEST_REMOTE_TIMEOUT"},
-	    {0x5B, "SEARCH_REQUEST"},
-	    {0x5C, "SEARCH_RESPONSE"},
-	    {0x5E, "CONFIG_REQUEST"},
-	    {0x5E, "CONFIG_RESPONSE"},
-	    {0x63, "HOST_LEFT_WHILST_JOINING_CMD"},
-	    {0x65, "MIGRATE_HOST_REQUEST"},
-	    {0x66, "MIGRATE_HOST_RESPONSE"},
-	    {0x67, "SESSION_MEMBERS"},
-	    {0x7B, "PLAYER_DATA"},
-	    {0x7C, "ACTIVATE_NETWORK_BOT"},
-	    {0x44, "NET_ROUTE_REQUEST"},
-	    {0x45, "NET_ROUTE_REPLY"},
-	    {0x46, "NET_ROUTE_ERROR"},
 	    {0x93, "NET_ROUTE_CHANGE_REQUEST"},
 	    {0x94, "NET_ROUTE_CHANGE_REPLY"},
-	    {0x57, "PARTY_ENTER_GAME"},
-	    {0x58, "PARTY_LEAVE_GAME"},
-	    {0x59, "UNK_0x59"},
-	    {0x42, "CXN_RELAY_ADDR_CHANGES"},
-	    {0x47, "NET_KEY_EXCHANGE_SESSION_OFFER"},
-	    {0x48, "NET_KEY_EXCHANGE_SESSION_ANSWER"},
-	};
-}
\ No newline at end of file
+	    {0x96, "ICE_SESSION_RELAY_ROUTE_CHECK"},
+	});
+}
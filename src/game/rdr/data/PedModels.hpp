@@ -1,1460 +1,1453 @@
 #pragma once
-#include <string>
+#include "core/misc/ConstFlatMap.hpp"
 #include "util/Joaat.hpp"
 
 namespace YimMenu::Data
 {
-	const std::unordered_map<std::uint32_t, const char*> g_PedModels = 
-	{
-	    {"A_C_Cougar_03"_J, "A_C_Cougar_03"},
-	    {"A_C_Horse_Gang_Lenny"_J, "A_C_Horse_Gang_Lenny"},
-	    {"A_C_Horse_Gang_Sadie_EndlessSummer"_J, "A_C_Horse_Gang_Sadie_EndlessSummer"},
-	    {"A_F_M_ARMCHOLERACORPSE_01"_J, "A_F_M_ARMCHOLERACORPSE_01"},
-	    {"A_F_M_ARMTOWNFOLK_01"_J, "A_F_M_ARMTOWNFOLK_01"},
-	    {"A_F_M_ArmTownfolk_02"_J, "A_F_M_ArmTownfolk_02"},
-	    {"A_F_M_AsbTownfolk_01"_J, "A_F_M_AsbTownfolk_01"},
-	    {"A_F_M_BiVFancyTravellers_01"_J, "A_F_M_BiVFancyTravellers_01"},
-	    {"A_F_M_BlWTownfolk_01"_J, "A_F_M_BlWTownfolk_01"},
-	    {"A_F_M_BlWTownfolk_02"_J, "A_F_M_BlWTownfolk_02"},
-	    {"A_F_M_BlWUpperClass_01"_J, "A_F_M_BlWUpperClass_01"},
-	    {"A_F_M_BtcHillbilly_01"_J, "A_F_M_BtcHillbilly_01"},
-	    {"A_F_M_BTCObeseWomen_01"_J, "A_F_M_BTCObeseWomen_01"},
-	    {"A_F_M_BynFancyTravellers_01"_J, "A_F_M_BynFancyTravellers_01"},
-	    {"A_F_M_FAMILYTRAVELERS_COOL_01"_J, "A_F_M_FAMILYTRAVELERS_COOL_01"},
+	// sorted by joaat, see ConstFlatMap
+	inline constexpr auto g_PedModels = MakeConstFlatMap<joaat_t, const char*>({
+	    {"A_C_FishRockBass_01_sm"_J, "A_C_FishRockBass_01_sm"},
+	    {"A_M_M_BTCObeseMen_01"_J, "A_M_M_BTCObeseMen_01"},
+	    {"CS_JAMIE"_J, "CS_JAMIE"},
+	    {"A_F_M_VhtTownfolk_01"_J, "A_F_M_VhtTownfolk_01"},
+	    {"A_M_M_RHDTOWNFOLK_01_LABORER"_J, "A_M_M_RHDTOWNFOLK_01_LABORER"},
+	    {"Player_Three"_J, "Player_Three"},
+	    {"MSP_INDUSTRY3_MALES_01"_J, "MSP_INDUSTRY3_MALES_01"},
+	    {"CS_miltonandrews"_J, "CS_miltonandrews"},
+	    {"CS_KarensJohn_01"_J, "CS_KarensJohn_01"},
+	    {"U_M_M_story_CANNIBAL_01"_J, "U_M_M_story_CANNIBAL_01"},
+	    {"MES_MARSTON6_FEMALES_01"_J, "MES_MARSTON6_FEMALES_01"},
+	    {"A_C_Horse_Shire_LightGrey"_J, "A_C_Horse_Shire_LightGrey"},
+	    {"CS_MP_GUS_MACMILLAN"_J, "CS_MP_GUS_MACMILLAN"},
+	    {"A_C_Sheep_01"_J, "A_C_Sheep_01"},
+	    {"A_C_FishSalmonSockeye_01_ms"_J, "A_C_FishSalmonSockeye_01_ms"},
+	    {"A_C_Horse_Mustang_TigerStripedBay"_J, "A_C_Horse_Mustang_TigerStripedBay"},
+	    {"CS_WELSHFIGHTER"_J, "CS_WELSHFIGHTER"},
 	    {"A_F_M_FAMILYTRAVELERS_WARM_01"_J, "A_F_M_FAMILYTRAVELERS_WARM_01"},
-	    {"A_F_M_GaMHighSociety_01"_J, "A_F_M_GaMHighSociety_01"},
-	    {"A_F_M_GriFancyTravellers_01"_J, "A_F_M_GriFancyTravellers_01"},
-	    {"A_F_M_GuaTownfolk_01"_J, "A_F_M_GuaTownfolk_01"},
-	    {"A_F_M_HtlFancyTravellers_01"_J, "A_F_M_HtlFancyTravellers_01"},
-	    {"A_F_M_LagTownfolk_01"_J, "A_F_M_LagTownfolk_01"},
-	    {"A_F_M_LowerSDTownfolk_01"_J, "A_F_M_LowerSDTownfolk_01"},
-	    {"A_F_M_LowerSDTownfolk_02"_J, "A_F_M_LowerSDTownfolk_02"},
-	    {"A_F_M_LowerSDTownfolk_03"_J, "A_F_M_LowerSDTownfolk_03"},
-	    {"A_F_M_LOWERTRAINPASSENGERS_01"_J, "A_F_M_LOWERTRAINPASSENGERS_01"},
-	    {"A_F_M_MiddleSDTownfolk_01"_J, "A_F_M_MiddleSDTownfolk_01"},
-	    {"A_F_M_MiddleSDTownfolk_02"_J, "A_F_M_MiddleSDTownfolk_02"},
-	    {"A_F_M_MiddleSDTownfolk_03"_J, "A_F_M_MiddleSDTownfolk_03"},
-	    {"A_F_M_MIDDLETRAINPASSENGERS_01"_J, "A_F_M_MIDDLETRAINPASSENGERS_01"},
-	    {"A_F_M_NbxSlums_01"_J, "A_F_M_NbxSlums_01"},
-	    {"A_F_M_NbxUpperClass_01"_J, "A_F_M_NbxUpperClass_01"},
+	    {"G_M_M_UniDuster_02"_J, "G_M_M_UniDuster_02"},
+	    {"CS_NILS"_J, "CS_NILS"},
+	    {"CS_WintonHolmes"_J, "CS_WintonHolmes"},
+	    {"A_C_Horse_AmericanStandardbred_PalominoDapple"_J, "A_C_Horse_AmericanStandardbred_PalominoDapple"},
+	    {"U_M_M_ValPokerPlayer_02"_J, "U_M_M_ValPokerPlayer_02"},
+	    {"CS_thomasdown"_J, "CS_thomasdown"},
+	    {"CS_obediahhinton"_J, "CS_obediahhinton"},
+	    {"A_C_HORSE_MUSTANG_REDDUNOVERO"_J, "A_C_HORSE_MUSTANG_REDDUNOVERO"},
+	    {"CS_MP_LEM"_J, "CS_MP_LEM"},
+	    {"CS_MP_THE_BOY"_J, "CS_MP_THE_BOY"},
+	    {"A_M_M_NbxUpperClass_01"_J, "A_M_M_NbxUpperClass_01"},
+	    {"A_C_Horse_Arabian_Grey"_J, "A_C_Horse_Arabian_Grey"},
+	    {"U_M_Y_CzPHomesteadSon_02"_J, "U_M_Y_CzPHomesteadSon_02"},
+	    {"A_C_Cougar_01"_J, "A_C_Cougar_01"},
+	    {"CS_AgnesDowd"_J, "CS_AgnesDowd"},
+	    {"CS_johnmarston"_J, "CS_johnmarston"},
+	    {"A_C_Horse_Morgan_Palomino"_J, "A_C_Horse_Morgan_Palomino"},
+	    {"A_C_Crow_01"_J, "A_C_Crow_01"},
+	    {"S_M_M_UNIBUTCHERS_01"_J, "S_M_M_UNIBUTCHERS_01"},
+	    {"A_C_Horse_Nokota_ReverseDappleRoan"_J, "A_C_Horse_Nokota_ReverseDappleRoan"},
+	    {"RE_LOSTFRIEND_MALES_01"_J, "RE_LOSTFRIEND_MALES_01"},
+	    {"A_C_Pigeon"_J, "A_C_Pigeon"},
+	    {"U_M_M_RhdPreacher_01"_J, "U_M_M_RhdPreacher_01"},
+	    {"A_C_SharkTiger"_J, "A_C_SharkTiger"},
+	    {"U_M_M_APFDeadMan_01"_J, "U_M_M_APFDeadMan_01"},
+	    {"CS_DOROETHEAWICKLOW"_J, "CS_DOROETHEAWICKLOW"},
+	    {"CS_CAVEHERMIT"_J, "CS_CAVEHERMIT"},
+	    {"A_C_FishLargeMouthBass_01_ms"_J, "A_C_FishLargeMouthBass_01_ms"},
+	    {"U_M_M_ValAuctionForman_01"_J, "U_M_M_ValAuctionForman_01"},
+	    {"G_M_M_UniGrays_02"_J, "G_M_M_UniGrays_02"},
+	    {"A_C_FishRainbowTrout_01_lg"_J, "A_C_FishRainbowTrout_01_lg"},
+	    {"RE_STREET_FIGHT_MALES_01"_J, "RE_STREET_FIGHT_MALES_01"},
+	    {"S_M_M_UniTrainGuards_01"_J, "S_M_M_UniTrainGuards_01"},
+	    {"RE_RALLY_MALES_01"_J, "RE_RALLY_MALES_01"},
+	    {"U_M_M_SKINNYOLDGUY_01"_J, "U_M_M_SKINNYOLDGUY_01"},
+	    {"U_M_M_CzPHomesteadFather_01"_J, "U_M_M_CzPHomesteadFather_01"},
+	    {"MES_SADIE5_MALES_01"_J, "MES_SADIE5_MALES_01"},
+	    {"RE_FLEEINGFAMILY_MALES_01"_J, "RE_FLEEINGFAMILY_MALES_01"},
+	    {"U_F_M_TljBartender_01"_J, "U_F_M_TljBartender_01"},
+	    {"SALOONBRAWLERS_03"_J, "SALOONBRAWLERS_03"},
+	    {"CS_brynntildon"_J, "CS_brynntildon"},
+	    {"A_M_M_AsbTownfolk_01"_J, "A_M_M_AsbTownfolk_01"},
+	    {"A_M_M_RHDDEPUTYRESIDENT_01"_J, "A_M_M_RHDDEPUTYRESIDENT_01"},
+	    {"U_M_M_AsbPrisoner_01"_J, "U_M_M_AsbPrisoner_01"},
+	    {"A_C_Bull_01"_J, "A_C_Bull_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_07"_J, "MP_U_M_M_SALOONBRAWLERS_07"},
+	    {"CS_HERBALIST"_J, "CS_HERBALIST"},
+	    {"A_F_M_TumTownfolk_01"_J, "A_F_M_TumTownfolk_01"},
+	    {"U_M_M_FATDUSTER_01"_J, "U_M_M_FATDUSTER_01"},
+	    {"U_M_M_story_SPECTRE_01"_J, "U_M_M_story_SPECTRE_01"},
+	    {"U_M_M_NbxBartender_02"_J, "U_M_M_NbxBartender_02"},
+	    {"RE_SAVAGEFIGHT_FEMALES_01"_J, "RE_SAVAGEFIGHT_FEMALES_01"},
+	    {"A_M_M_GuaTownfolk_01"_J, "A_M_M_GuaTownfolk_01"},
+	    {"CS_GermanSon"_J, "CS_GermanSon"},
+	    {"Player_Zero"_J, "Player_Zero"},
+	    {"A_M_M_BiVFancyTravellers_01"_J, "A_M_M_BiVFancyTravellers_01"},
+	    {"A_M_M_FOREMAN"_J, "A_M_M_FOREMAN"},
+	    {"CS_brendacrawley"_J, "CS_brendacrawley"},
+	    {"RE_DUELWINNER_MALES_01"_J, "RE_DUELWINNER_MALES_01"},
+	    {"CS_colfavours"_J, "CS_colfavours"},
+	    {"RE_DROWNMURDER_FEMALES_01"_J, "RE_DROWNMURDER_FEMALES_01"},
 	    {"A_F_M_NbxWhore_01"_J, "A_F_M_NbxWhore_01"},
-	    {"A_F_M_RhdProstitute_01"_J, "A_F_M_RhdProstitute_01"},
-	    {"A_F_M_RhdTownfolk_01"_J, "A_F_M_RhdTownfolk_01"},
-	    {"A_F_M_RhdTownfolk_02"_J, "A_F_M_RhdTownfolk_02"},
-	    {"A_F_M_RhdUpperClass_01"_J, "A_F_M_RhdUpperClass_01"},
-	    {"A_F_M_RkrFancyTravellers_01"_J, "A_F_M_RkrFancyTravellers_01"},
-	    {"A_F_M_ROUGHTRAVELLERS_01"_J, "A_F_M_ROUGHTRAVELLERS_01"},
-	    {"A_F_M_SclFancyTravellers_01"_J, "A_F_M_SclFancyTravellers_01"},
-	    {"A_F_M_SDChinatown_01"_J, "A_F_M_SDChinatown_01"},
-	    {"A_F_M_SDFancyWhore_01"_J, "A_F_M_SDFancyWhore_01"},
-	    {"A_F_M_SDObeseWomen_01"_J, "A_F_M_SDObeseWomen_01"},
-	    {"A_F_M_SDSERVERSFORMAL_01"_J, "A_F_M_SDSERVERSFORMAL_01"},
+	    {"U_M_M_GalaStringQuartet_01"_J, "U_M_M_GalaStringQuartet_01"},
+	    {"U_M_M_UNIDUSTERHENCHMAN_01"_J, "U_M_M_UNIDUSTERHENCHMAN_01"},
+	    {"A_C_Fox_01"_J, "A_C_Fox_01"},
+	    {"CS_rhodeskidnapvictim"_J, "CS_rhodeskidnapvictim"},
+	    {"CS_SDStreetKidThief"_J, "CS_SDStreetKidThief"},
+	    {"RE_TOWNROBBERY_MALES_01"_J, "RE_TOWNROBBERY_MALES_01"},
+	    {"A_C_FishChainPickerel_01_sm"_J, "A_C_FishChainPickerel_01_sm"},
+	    {"A_M_Y_NbxStreetKids_01"_J, "A_M_Y_NbxStreetKids_01"},
+	    {"G_M_M_UNIMICAHGOONS_01"_J, "G_M_M_UNIMICAHGOONS_01"},
+	    {"U_M_M_StrGenStoreOwner_01"_J, "U_M_M_StrGenStoreOwner_01"},
 	    {"A_F_M_SDSlums_02"_J, "A_F_M_SDSlums_02"},
-	    {"A_F_M_SKPPRISONONLINE_01"_J, "A_F_M_SKPPRISONONLINE_01"},
-	    {"A_F_M_StrTownfolk_01"_J, "A_F_M_StrTownfolk_01"},
-	    {"A_F_M_TumTownfolk_01"_J, "A_F_M_TumTownfolk_01"},
-	    {"A_F_M_TumTownfolk_02"_J, "A_F_M_TumTownfolk_02"},
-	    {"A_F_M_UniCorpse_01"_J, "A_F_M_UniCorpse_01"},
-	    {"A_F_M_UPPERTRAINPASSENGERS_01"_J, "A_F_M_UPPERTRAINPASSENGERS_01"},
-	    {"A_F_M_ValProstitute_01"_J, "A_F_M_ValProstitute_01"},
-	    {"A_F_M_ValTownfolk_01"_J, "A_F_M_ValTownfolk_01"},
-	    {"A_F_M_VhtProstitute_01"_J, "A_F_M_VhtProstitute_01"},
-	    {"A_F_M_VhtTownfolk_01"_J, "A_F_M_VhtTownfolk_01"},
-	    {"A_F_M_WapTownfolk_01"_J, "A_F_M_WapTownfolk_01"},
-	    {"A_F_O_BlWUpperClass_01"_J, "A_F_O_BlWUpperClass_01"},
-	    {"A_F_O_BtcHillbilly_01"_J, "A_F_O_BtcHillbilly_01"},
-	    {"A_F_O_GuaTownfolk_01"_J, "A_F_O_GuaTownfolk_01"},
+	    {"U_M_O_CaJHomestead_01"_J, "U_M_O_CaJHomestead_01"},
+	    {"S_M_Y_NewspaperBoy_01"_J, "S_M_Y_NewspaperBoy_01"},
+	    {"A_C_Horse_Gang_Uncle_EndlessSummer"_J, "A_C_Horse_Gang_Uncle_EndlessSummer"},
+	    {"U_M_M_StrFreightStationOwner_01"_J, "U_M_M_StrFreightStationOwner_01"},
+	    {"MSP_FEUD1_MALES_01"_J, "MSP_FEUD1_MALES_01"},
+	    {"RE_KIDNAPPEDVICTIM_FEMALES_01"_J, "RE_KIDNAPPEDVICTIM_FEMALES_01"},
+	    {"CS_exconfedsleader_01"_J, "CS_exconfedsleader_01"},
+	    {"U_M_M_SDBANKGUARD_01"_J, "U_M_M_SDBANKGUARD_01"},
+	    {"CS_cancan_04"_J, "CS_cancan_04"},
+	    {"MSP_UTOPIA1_MALES_01"_J, "MSP_UTOPIA1_MALES_01"},
+	    {"RCSP_HUNTING1_MALES_01"_J, "RCSP_HUNTING1_MALES_01"},
+	    {"CS_TownCrier"_J, "CS_TownCrier"},
+	    {"RE_TOWNBURIAL_MALES_01"_J, "RE_TOWNBURIAL_MALES_01"},
+	    {"A_C_Horse_Breton_Sorrel"_J, "A_C_Horse_Breton_Sorrel"},
+	    {"U_M_M_BULLETCATCHVOLUNTEER_01"_J, "U_M_M_BULLETCATCHVOLUNTEER_01"},
+	    {"MSP_GANG3_MALES_01"_J, "MSP_GANG3_MALES_01"},
+	    {"G_M_M_UniDuster_01"_J, "G_M_M_UniDuster_01"},
+	    {"CS_famousgunslinger_04"_J, "CS_famousgunslinger_04"},
+	    {"A_M_Y_ASBMINER_03"_J, "A_M_Y_ASBMINER_03"},
+	    {"A_M_O_GuaTownfolk_01"_J, "A_M_O_GuaTownfolk_01"},
+	    {"CS_mrsadler"_J, "CS_mrsadler"},
+	    {"A_F_M_BtcHillbilly_01"_J, "A_F_M_BtcHillbilly_01"},
+	    {"MP_ASN_CIVILWARFORT_MALES_01"_J, "MP_ASN_CIVILWARFORT_MALES_01"},
+	    {"RCSP_FORMYART_MALES_01"_J, "RCSP_FORMYART_MALES_01"},
+	    {"G_M_M_UniInbred_01"_J, "G_M_M_UniInbred_01"},
+	    {"A_C_Buffalo_Tatanka_01"_J, "A_C_Buffalo_Tatanka_01"},
+	    {"G_M_M_UniGrays_01"_J, "G_M_M_UniGrays_01"},
+	    {"U_M_M_ValPoopingMan_01"_J, "U_M_M_ValPoopingMan_01"},
+	    {"A_M_M_SkpPrisoner_01"_J, "A_M_M_SkpPrisoner_01"},
+	    {"U_M_M_NBXRIVERBOATTARGET_01"_J, "U_M_M_NBXRIVERBOATTARGET_01"},
+	    {"CS_dalemaroney"_J, "CS_dalemaroney"},
+	    {"A_C_Loon_01"_J, "A_C_Loon_01"},
+	    {"MSP_TRAINROBBERY2_MALES_01"_J, "MSP_TRAINROBBERY2_MALES_01"},
 	    {"A_F_O_LagTownfolk_01"_J, "A_F_O_LagTownfolk_01"},
-	    {"A_F_O_SDChinatown_01"_J, "A_F_O_SDChinatown_01"},
-	    {"A_F_O_SDUpperClass_01"_J, "A_F_O_SDUpperClass_01"},
-	    {"A_F_O_WAPTOWNFOLK_01"_J, "A_F_O_WAPTOWNFOLK_01"},
-	    {"A_M_M_ARMCHOLERACORPSE_01"_J, "A_M_M_ARMCHOLERACORPSE_01"},
-	    {"A_M_M_ARMDEPUTYRESIDENT_01"_J, "A_M_M_ARMDEPUTYRESIDENT_01"},
-	    {"A_M_M_ARMTOWNFOLK_01"_J, "A_M_M_ARMTOWNFOLK_01"},
-	    {"A_M_M_armTOWNFOLK_02"_J, "A_M_M_armTOWNFOLK_02"},
-	    {"A_M_M_ASBBOATCREW_01"_J, "A_M_M_ASBBOATCREW_01"},
-	    {"A_M_M_ASBDEPUTYRESIDENT_01"_J, "A_M_M_ASBDEPUTYRESIDENT_01"},
-	    {"A_M_M_AsbMiner_01"_J, "A_M_M_AsbMiner_01"},
-	    {"A_M_M_ASBMINER_02"_J, "A_M_M_ASBMINER_02"},
-	    {"A_M_M_ASBMINER_03"_J, "A_M_M_ASBMINER_03"},
-	    {"A_M_M_asbminer_04"_J, "A_M_M_asbminer_04"},
-	    {"A_M_M_AsbTownfolk_01"_J, "A_M_M_AsbTownfolk_01"},
-	    {"A_M_M_ASBTOWNFOLK_01_LABORER"_J, "A_M_M_ASBTOWNFOLK_01_LABORER"},
-	    {"A_M_M_BiVFancyDRIVERS_01"_J, "A_M_M_BiVFancyDRIVERS_01"},
-	    {"A_M_M_BiVFancyTravellers_01"_J, "A_M_M_BiVFancyTravellers_01"},
-	    {"A_M_M_BiVRoughTravellers_01"_J, "A_M_M_BiVRoughTravellers_01"},
-	    {"A_M_M_BiVWorker_01"_J, "A_M_M_BiVWorker_01"},
-	    {"A_M_M_BlWForeman_01"_J, "A_M_M_BlWForeman_01"},
-	    {"A_M_M_BlWLaborer_01"_J, "A_M_M_BlWLaborer_01"},
-	    {"A_M_M_BlWLaborer_02"_J, "A_M_M_BlWLaborer_02"},
-	    {"A_M_M_BLWObeseMen_01"_J, "A_M_M_BLWObeseMen_01"},
-	    {"A_M_M_BlWTownfolk_01"_J, "A_M_M_BlWTownfolk_01"},
-	    {"A_M_M_BlWUpperClass_01"_J, "A_M_M_BlWUpperClass_01"},
-	    {"A_M_M_BtcHillbilly_01"_J, "A_M_M_BtcHillbilly_01"},
-	    {"A_M_M_BTCObeseMen_01"_J, "A_M_M_BTCObeseMen_01"},
-	    {"A_M_M_BynFancyDRIVERS_01"_J, "A_M_M_BynFancyDRIVERS_01"},
-	    {"A_M_M_BynFancyTravellers_01"_J, "A_M_M_BynFancyTravellers_01"},
-	    {"A_M_M_BynRoughTravellers_01"_J, "A_M_M_BynRoughTravellers_01"},
-	    {"A_M_M_BynSurvivalist_01"_J, "A_M_M_BynSurvivalist_01"},
-	    {"A_M_M_CARDGAMEPLAYERS_01"_J, "A_M_M_CARDGAMEPLAYERS_01"},
-	    {"A_M_M_CHELONIAN_01"_J, "A_M_M_CHELONIAN_01"},
-	    {"A_M_M_DELIVERYTRAVELERS_COOL_01"_J, "A_M_M_DELIVERYTRAVELERS_COOL_01"},
-	    {"A_M_M_deliverytravelers_warm_01"_J, "A_M_M_deliverytravelers_warm_01"},
-	    {"A_M_M_DOMINOESPLAYERS_01"_J, "A_M_M_DOMINOESPLAYERS_01"},
-	    {"A_M_M_EmRFarmHand_01"_J, "A_M_M_EmRFarmHand_01"},
-	    {"A_M_M_FAMILYTRAVELERS_COOL_01"_J, "A_M_M_FAMILYTRAVELERS_COOL_01"},
-	    {"A_M_M_FAMILYTRAVELERS_WARM_01"_J, "A_M_M_FAMILYTRAVELERS_WARM_01"},
-	    {"A_M_M_FARMTRAVELERS_COOL_01"_J, "A_M_M_FARMTRAVELERS_COOL_01"},
-	    {"A_M_M_FARMTRAVELERS_WARM_01"_J, "A_M_M_FARMTRAVELERS_WARM_01"},
+	    {"CS_angryhusband"_J, "CS_angryhusband"},
+	    {"S_M_M_StrLumberjack_01"_J, "S_M_M_StrLumberjack_01"},
 	    {"A_M_M_FiveFingerFilletPlayers_01"_J, "A_M_M_FiveFingerFilletPlayers_01"},
-	    {"A_M_M_FOREMAN"_J, "A_M_M_FOREMAN"},
-	    {"A_M_M_GaMHighSociety_01"_J, "A_M_M_GaMHighSociety_01"},
-	    {"A_M_M_GRIFANCYDRIVERS_01"_J, "A_M_M_GRIFANCYDRIVERS_01"},
-	    {"A_M_M_GriFancyTravellers_01"_J, "A_M_M_GriFancyTravellers_01"},
-	    {"A_M_M_GriRoughTravellers_01"_J, "A_M_M_GriRoughTravellers_01"},
-	    {"A_M_M_GriSurvivalist_01"_J, "A_M_M_GriSurvivalist_01"},
-	    {"A_M_M_GuaTownfolk_01"_J, "A_M_M_GuaTownfolk_01"},
-	    {"A_M_M_HtlFancyDRIVERS_01"_J, "A_M_M_HtlFancyDRIVERS_01"},
-	    {"A_M_M_HtlFancyTravellers_01"_J, "A_M_M_HtlFancyTravellers_01"},
-	    {"A_M_M_HtlRoughTravellers_01"_J, "A_M_M_HtlRoughTravellers_01"},
-	    {"A_M_M_HtlSurvivalist_01"_J, "A_M_M_HtlSurvivalist_01"},
-	    {"A_M_M_huntertravelers_cool_01"_J, "A_M_M_huntertravelers_cool_01"},
-	    {"A_M_M_HUNTERTRAVELERS_WARM_01"_J, "A_M_M_HUNTERTRAVELERS_WARM_01"},
-	    {"A_M_M_JamesonGuard_01"_J, "A_M_M_JamesonGuard_01"},
-	    {"A_M_M_LagTownfolk_01"_J, "A_M_M_LagTownfolk_01"},
-	    {"A_M_M_LowerSDTownfolk_01"_J, "A_M_M_LowerSDTownfolk_01"},
-	    {"A_M_M_LowerSDTownfolk_02"_J, "A_M_M_LowerSDTownfolk_02"},
-	    {"A_M_M_LOWERTRAINPASSENGERS_01"_J, "A_M_M_LOWERTRAINPASSENGERS_01"},
-	    {"A_M_M_MiddleSDTownfolk_01"_J, "A_M_M_MiddleSDTownfolk_01"},
-	    {"A_M_M_MiddleSDTownfolk_02"_J, "A_M_M_MiddleSDTownfolk_02"},
-	    {"A_M_M_MiddleSDTownfolk_03"_J, "A_M_M_MiddleSDTownfolk_03"},
-	    {"A_M_M_MIDDLETRAINPASSENGERS_01"_J, "A_M_M_MIDDLETRAINPASSENGERS_01"},
-	    {"A_M_M_MOONSHINERS_01"_J, "A_M_M_MOONSHINERS_01"},
-	    {"A_M_M_NbxDockWorkers_01"_J, "A_M_M_NbxDockWorkers_01"},
-	    {"A_M_M_NbxLaborers_01"_J, "A_M_M_NbxLaborers_01"},
-	    {"A_M_M_NbxSlums_01"_J, "A_M_M_NbxSlums_01"},
-	    {"A_M_M_NbxUpperClass_01"_J, "A_M_M_NbxUpperClass_01"},
-	    {"A_M_M_NEAROUGHTRAVELLERS_01"_J, "A_M_M_NEAROUGHTRAVELLERS_01"},
-	    {"A_M_M_RANCHER_01"_J, "A_M_M_RANCHER_01"},
-	    {"A_M_M_RANCHERTRAVELERS_COOL_01"_J, "A_M_M_RANCHERTRAVELERS_COOL_01"},
-	    {"A_M_M_RANCHERTRAVELERS_WARM_01"_J, "A_M_M_RANCHERTRAVELERS_WARM_01"},
-	    {"A_M_M_RHDDEPUTYRESIDENT_01"_J, "A_M_M_RHDDEPUTYRESIDENT_01"},
-	    {"A_M_M_RhdForeman_01"_J, "A_M_M_RhdForeman_01"},
-	    {"A_M_M_RHDObeseMen_01"_J, "A_M_M_RHDObeseMen_01"},
-	    {"A_M_M_RhdTownfolk_01"_J, "A_M_M_RhdTownfolk_01"},
-	    {"A_M_M_RHDTOWNFOLK_01_LABORER"_J, "A_M_M_RHDTOWNFOLK_01_LABORER"},
-	    {"A_M_M_RhdTownfolk_02"_J, "A_M_M_RhdTownfolk_02"},
-	    {"A_M_M_RhdUpperClass_01"_J, "A_M_M_RhdUpperClass_01"},
-	    {"A_M_M_RkrFancyDRIVERS_01"_J, "A_M_M_RkrFancyDRIVERS_01"},
-	    {"A_M_M_RkrFancyTravellers_01"_J, "A_M_M_RkrFancyTravellers_01"},
-	    {"A_M_M_RkrRoughTravellers_01"_J, "A_M_M_RkrRoughTravellers_01"},
-	    {"A_M_M_RkrSurvivalist_01"_J, "A_M_M_RkrSurvivalist_01"},
-	    {"A_M_M_SclFancyDRIVERS_01"_J, "A_M_M_SclFancyDRIVERS_01"},
-	    {"A_M_M_SclFancyTravellers_01"_J, "A_M_M_SclFancyTravellers_01"},
-	    {"A_M_M_SclRoughTravellers_01"_J, "A_M_M_SclRoughTravellers_01"},
-	    {"A_M_M_SDChinatown_01"_J, "A_M_M_SDChinatown_01"},
-	    {"A_M_M_SDDockForeman_01"_J, "A_M_M_SDDockForeman_01"},
-	    {"A_M_M_SDDockWorkers_02"_J, "A_M_M_SDDockWorkers_02"},
-	    {"A_M_M_SDFANCYTRAVELLERS_01"_J, "A_M_M_SDFANCYTRAVELLERS_01"},
-	    {"A_M_M_SDLaborers_02"_J, "A_M_M_SDLaborers_02"},
-	    {"A_M_M_SDObesemen_01"_J, "A_M_M_SDObesemen_01"},
-	    {"A_M_M_SDROUGHTRAVELLERS_01"_J, "A_M_M_SDROUGHTRAVELLERS_01"},
-	    {"A_M_M_SDSERVERSFORMAL_01"_J, "A_M_M_SDSERVERSFORMAL_01"},
-	    {"A_M_M_SDSlums_02"_J, "A_M_M_SDSlums_02"},
-	    {"A_M_M_SkpPrisoner_01"_J, "A_M_M_SkpPrisoner_01"},
-	    {"A_M_M_SkpPrisonLine_01"_J, "A_M_M_SkpPrisonLine_01"},
-	    {"A_M_M_SmHThug_01"_J, "A_M_M_SmHThug_01"},
-	    {"A_M_M_STRDEPUTYRESIDENT_01"_J, "A_M_M_STRDEPUTYRESIDENT_01"},
-	    {"A_M_M_STRFANCYTOURIST_01"_J, "A_M_M_STRFANCYTOURIST_01"},
-	    {"A_M_M_StrLaborer_01"_J, "A_M_M_StrLaborer_01"},
-	    {"A_M_M_StrTownfolk_01"_J, "A_M_M_StrTownfolk_01"},
-	    {"A_M_M_TumTownfolk_01"_J, "A_M_M_TumTownfolk_01"},
-	    {"A_M_M_TumTownfolk_02"_J, "A_M_M_TumTownfolk_02"},
-	    {"A_M_M_UniBoatCrew_01"_J, "A_M_M_UniBoatCrew_01"},
-	    {"A_M_M_UniCoachGuards_01"_J, "A_M_M_UniCoachGuards_01"},
-	    {"A_M_M_UniCorpse_01"_J, "A_M_M_UniCorpse_01"},
-	    {"A_M_M_UniGunslinger_01"_J, "A_M_M_UniGunslinger_01"},
-	    {"A_M_M_UPPERTRAINPASSENGERS_01"_J, "A_M_M_UPPERTRAINPASSENGERS_01"},
-	    {"A_M_M_VALCRIMINALS_01"_J, "A_M_M_VALCRIMINALS_01"},
-	    {"A_M_M_VALDEPUTYRESIDENT_01"_J, "A_M_M_VALDEPUTYRESIDENT_01"},
-	    {"A_M_M_ValFarmer_01"_J, "A_M_M_ValFarmer_01"},
-	    {"A_M_M_ValLaborer_01"_J, "A_M_M_ValLaborer_01"},
-	    {"A_M_M_ValTownfolk_01"_J, "A_M_M_ValTownfolk_01"},
-	    {"A_M_M_ValTownfolk_02"_J, "A_M_M_ValTownfolk_02"},
-	    {"A_M_M_VHTBOATCREW_01"_J, "A_M_M_VHTBOATCREW_01"},
-	    {"A_M_M_VhtThug_01"_J, "A_M_M_VhtThug_01"},
-	    {"A_M_M_VhtTownfolk_01"_J, "A_M_M_VhtTownfolk_01"},
-	    {"A_M_M_WapWarriors_01"_J, "A_M_M_WapWarriors_01"},
-	    {"A_M_O_BlWUpperClass_01"_J, "A_M_O_BlWUpperClass_01"},
-	    {"A_M_O_BtcHillbilly_01"_J, "A_M_O_BtcHillbilly_01"},
-	    {"A_M_O_GuaTownfolk_01"_J, "A_M_O_GuaTownfolk_01"},
-	    {"A_M_O_LagTownfolk_01"_J, "A_M_O_LagTownfolk_01"},
-	    {"A_M_O_SDChinatown_01"_J, "A_M_O_SDChinatown_01"},
-	    {"A_M_O_SDUpperClass_01"_J, "A_M_O_SDUpperClass_01"},
-	    {"A_M_O_WAPTOWNFOLK_01"_J, "A_M_O_WAPTOWNFOLK_01"},
-	    {"A_M_Y_AsbMiner_01"_J, "A_M_Y_AsbMiner_01"},
-	    {"A_M_Y_AsbMiner_02"_J, "A_M_Y_AsbMiner_02"},
-	    {"A_M_Y_ASBMINER_03"_J, "A_M_Y_ASBMINER_03"},
-	    {"A_M_Y_ASBMINER_04"_J, "A_M_Y_ASBMINER_04"},
-	    {"A_M_Y_NbxStreetKids_01"_J, "A_M_Y_NbxStreetKids_01"},
-	    {"A_M_Y_NbxStreetKids_Slums_01"_J, "A_M_Y_NbxStreetKids_Slums_01"},
-	    {"A_M_Y_SDStreetKids_Slums_02"_J, "A_M_Y_SDStreetKids_Slums_02"},
-	    {"A_M_Y_UniCorpse_01"_J, "A_M_Y_UniCorpse_01"},
-	    {"CS_abe"_J, "CS_abe"},
-	    {"CS_AberdeenPigFarmer"_J, "CS_AberdeenPigFarmer"},
-	    {"CS_AberdeenSister"_J, "CS_AberdeenSister"},
-	    {"CS_abigailroberts"_J, "CS_abigailroberts"},
-	    {"CS_Acrobat"_J, "CS_Acrobat"},
-	    {"CS_adamgray"_J, "CS_adamgray"},
-	    {"CS_AgnesDowd"_J, "CS_AgnesDowd"},
-	    {"CS_albertcakeesquire"_J, "CS_albertcakeesquire"},
-	    {"CS_albertmason"_J, "CS_albertmason"},
+	    {"A_F_M_BTCObeseWomen_01"_J, "A_F_M_BTCObeseWomen_01"},
+	    {"MP_G_M_M_ARMYOFFEAR_01"_J, "MP_G_M_M_ARMYOFFEAR_01"},
+	    {"G_M_M_UniBanditos_01"_J, "G_M_M_UniBanditos_01"},
+	    {"CS_LillianPowell"_J, "CS_LillianPowell"},
+	    {"CS_SUNWORSHIPPER"_J, "CS_SUNWORSHIPPER"},
+	    {"G_M_M_BountyHunters_01"_J, "G_M_M_BountyHunters_01"},
+	    {"U_M_M_STORY_ARMADILLO_01"_J, "U_M_M_STORY_ARMADILLO_01"},
 	    {"CS_AndersHelgerson"_J, "CS_AndersHelgerson"},
-	    {"CS_ANGEL"_J, "CS_ANGEL"},
-	    {"CS_angryhusband"_J, "CS_angryhusband"},
-	    {"CS_angusgeddes"_J, "CS_angusgeddes"},
-	    {"CS_ansel_atherton"_J, "CS_ansel_atherton"},
-	    {"CS_ANTONYFOREMEN"_J, "CS_ANTONYFOREMEN"},
-	    {"CS_archerfordham"_J, "CS_archerfordham"},
-	    {"CS_archibaldjameson"_J, "CS_archibaldjameson"},
-	    {"CS_ArchieDown"_J, "CS_ArchieDown"},
-	    {"CS_ARTAPPRAISER"_J, "CS_ARTAPPRAISER"},
-	    {"CS_ASBDEPUTY_01"_J, "CS_ASBDEPUTY_01"},
-	    {"CS_ASHTON"_J, "CS_ASHTON"},
-	    {"CS_balloonoperator"_J, "CS_balloonoperator"},
-	    {"CS_bandbassist"_J, "CS_bandbassist"},
-	    {"CS_banddrummer"_J, "CS_banddrummer"},
-	    {"CS_bandpianist"_J, "CS_bandpianist"},
-	    {"CS_bandsinger"_J, "CS_bandsinger"},
-	    {"CS_baptiste"_J, "CS_baptiste"},
-	    {"CS_bartholomewbraithwaite"_J, "CS_bartholomewbraithwaite"},
-	    {"CS_BATHINGLADIES_01"_J, "CS_BATHINGLADIES_01"},
-	    {"CS_BeatenUpCaptain"_J, "CS_BeatenUpCaptain"},
-	    {"CS_beaugray"_J, "CS_beaugray"},
-	    {"CS_billwilliamson"_J, "CS_billwilliamson"},
-	    {"CS_BivCoachDriver"_J, "CS_BivCoachDriver"},
+	    {"A_M_M_asbminer_04"_J, "A_M_M_asbminer_04"},
+	    {"CS_POORJOE"_J, "CS_POORJOE"},
+	    {"MSP_SMUGGLER2_MALES_01"_J, "MSP_SMUGGLER2_MALES_01"},
+	    {"RE_LARAMIEGANGRUSTLING_MALES_01"_J, "RE_LARAMIEGANGRUSTLING_MALES_01"},
+	    {"A_C_Horse_TennesseeWalker_MahoganyBay"_J, "A_C_Horse_TennesseeWalker_MahoganyBay"},
 	    {"CS_BLWPHOTOGRAPHER"_J, "CS_BLWPHOTOGRAPHER"},
-	    {"CS_BLWWITNESS"_J, "CS_BLWWITNESS"},
-	    {"CS_braithwaitebutler"_J, "CS_braithwaitebutler"},
-	    {"CS_braithwaitemaid"_J, "CS_braithwaitemaid"},
+	    {"U_M_M_NBXShadyDealer_01"_J, "U_M_M_NBXShadyDealer_01"},
+	    {"A_C_GilaMonster_01"_J, "A_C_GilaMonster_01"},
+	    {"U_M_Y_CzPHomesteadSon_01"_J, "U_M_Y_CzPHomesteadSon_01"},
+	    {"CS_ASBDEPUTY_01"_J, "CS_ASBDEPUTY_01"},
+	    {"U_M_Y_CajHomeStead_01"_J, "U_M_Y_CajHomeStead_01"},
+	    {"RCSP_ODDFELLOWS_MALES_01"_J, "RCSP_ODDFELLOWS_MALES_01"},
+	    {"A_C_FishLargeMouthBass_01_lg"_J, "A_C_FishLargeMouthBass_01_lg"},
+	    {"U_M_M_UniExConfedsBounty_01"_J, "U_M_M_UniExConfedsBounty_01"},
 	    {"CS_braithwaiteservant"_J, "CS_braithwaiteservant"},
-	    {"CS_brendacrawley"_J, "CS_brendacrawley"},
-	    {"CS_bronte"_J, "CS_bronte"},
-	    {"CS_BrontesButler"_J, "CS_BrontesButler"},
+	    {"A_C_Horse_Mustang_GoldenDun"_J, "A_C_Horse_Mustang_GoldenDun"},
+	    {"A_M_M_TumTownfolk_01"_J, "A_M_M_TumTownfolk_01"},
+	    {"A_C_Coyote_01"_J, "A_C_Coyote_01"},
 	    {"CS_brotherdorkins"_J, "CS_brotherdorkins"},
-	    {"CS_brynntildon"_J, "CS_brynntildon"},
-	    {"CS_Bubba"_J, "CS_Bubba"},
-	    {"CS_CABARETMC"_J, "CS_CABARETMC"},
-	    {"CS_CAJUN"_J, "CS_CAJUN"},
-	    {"CS_cancan_01"_J, "CS_cancan_01"},
-	    {"CS_cancan_02"_J, "CS_cancan_02"},
-	    {"CS_cancan_03"_J, "CS_cancan_03"},
-	    {"CS_cancan_04"_J, "CS_cancan_04"},
+	    {"A_M_M_UniCoachGuards_01"_J, "A_M_M_UniCoachGuards_01"},
+	    {"U_M_O_AsbSheriff_01"_J, "U_M_O_AsbSheriff_01"},
+	    {"A_C_FishRainbowTrout_01_ms"_J, "A_C_FishRainbowTrout_01_ms"},
+	    {"U_M_M_AsbPrisoner_02"_J, "U_M_M_AsbPrisoner_02"},
+	    {"CS_MP_CRIPPS"_J, "CS_MP_CRIPPS"},
+	    {"MES_MARSTON6_TEENS_01"_J, "MES_MARSTON6_TEENS_01"},
+	    {"U_M_M_LNSOUTLAW_01"_J, "U_M_M_LNSOUTLAW_01"},
+	    {"MCCLELLAN_SADDLE_01"_J, "MCCLELLAN_SADDLE_01"},
+	    {"A_C_HORSE_MISSOURIFOXTROTTER_BLUEROAN"_J, "A_C_HORSE_MISSOURIFOXTROTTER_BLUEROAN"},
+	    {"A_C_Horse_Criollo_Sorrelovero"_J, "A_C_Horse_Criollo_Sorrelovero"},
+	    {"A_C_Woodpecker_01"_J, "A_C_Woodpecker_01"},
+	    {"U_M_M_HtlForeman_01"_J, "U_M_M_HtlForeman_01"},
+	    {"MSP_INDUSTRY1_FEMALES_01"_J, "MSP_INDUSTRY1_FEMALES_01"},
+	    {"A_C_FishRedfinPickerel_01_sm"_J, "A_C_FishRedfinPickerel_01_sm"},
+	    {"CS_albertmason"_J, "CS_albertmason"},
+	    {"U_M_M_NbxBartender_01"_J, "U_M_M_NbxBartender_01"},
+	    {"A_M_M_ValFarmer_01"_J, "A_M_M_ValFarmer_01"},
+	    {"RE_DISABLEDBEGGAR_MALES_01"_J, "RE_DISABLEDBEGGAR_MALES_01"},
+	    {"RE_PEEPINGTOM_FEMALES_01"_J, "RE_PEEPINGTOM_FEMALES_01"},
+	    {"A_F_M_RhdTownfolk_01"_J, "A_F_M_RhdTownfolk_01"},
+	    {"A_C_FishSalmonSockeye_01_lg"_J, "A_C_FishSalmonSockeye_01_lg"},
+	    {"A_C_Snake_01"_J, "A_C_Snake_01"},
+	    {"A_M_M_MiddleSDTownfolk_03"_J, "A_M_M_MiddleSDTownfolk_03"},
+	    {"A_C_Horse_Buell_WarVets"_J, "A_C_Horse_Buell_WarVets"},
+	    {"A_C_Ox_01"_J, "A_C_Ox_01"},
+	    {"U_M_M_RhdUndertaker_01"_J, "U_M_M_RhdUndertaker_01"},
+	    {"CS_TAXIDERMIST"_J, "CS_TAXIDERMIST"},
+	    {"RCSP_CALDERONSTAGE2_TEENS_01"_J, "RCSP_CALDERONSTAGE2_TEENS_01"},
+	    {"U_M_M_BHT_NATHANKIRK"_J, "U_M_M_BHT_NATHANKIRK"},
+	    {"RE_EXECUTIONS_MALES_01"_J, "RE_EXECUTIONS_MALES_01"},
+	    {"U_M_M_SDTRAPPER_01"_J, "U_M_M_SDTRAPPER_01"},
+	    {"CS_FamousGunslinger_05"_J, "CS_FamousGunslinger_05"},
+	    {"A_C_HorseMulePainted_01"_J, "A_C_HorseMulePainted_01"},
+	    {"S_M_M_MAGICLANTERN_01"_J, "S_M_M_MAGICLANTERN_01"},
+	    {"SALOONBRAWLERS_12"_J, "SALOONBRAWLERS_12"},
+	    {"U_M_M_RhdBartender_01"_J, "U_M_M_RhdBartender_01"},
+	    {"U_M_M_VALBUTCHER_01"_J, "U_M_M_VALBUTCHER_01"},
+	    {"A_C_Horse_Appaloosa_FewSpotted_PC"_J, "A_C_Horse_Appaloosa_FewSpotted_PC"},
+	    {"MP_A_C_OWL_01"_J, "MP_A_C_OWL_01"},
+	    {"RE_LOSTMAN_MALES_01"_J, "RE_LOSTMAN_MALES_01"},
+	    {"MSP_MARY1_FEMALES_01"_J, "MSP_MARY1_FEMALES_01"},
+	    {"CS_balloonoperator"_J, "CS_balloonoperator"},
+	    {"A_F_M_SDSERVERSFORMAL_01"_J, "A_F_M_SDSERVERSFORMAL_01"},
+	    {"A_C_DogBluetickCoonhound_01"_J, "A_C_DogBluetickCoonhound_01"},
+	    {"RE_WILDMAN_01"_J, "RE_WILDMAN_01"},
+	    {"A_M_M_SDChinatown_01"_J, "A_M_M_SDChinatown_01"},
+	    {"A_F_M_MiddleSDTownfolk_01"_J, "A_F_M_MiddleSDTownfolk_01"},
+	    {"U_M_M_NbxResident_04"_J, "U_M_M_NbxResident_04"},
+	    {"A_C_Bat_01"_J, "A_C_Bat_01"},
+	    {"MP_A_C_Alligator_01"_J, "MP_A_C_Alligator_01"},
+	    {"MSP_MARY1_MALES_01"_J, "MSP_MARY1_MALES_01"},
+	    {"MES_FINALE2_MALES_01"_J, "MES_FINALE2_MALES_01"},
+	    {"CS_MP_SHERIFFFREEMAN"_J, "CS_MP_SHERIFFFREEMAN"},
+	    {"CS_albertcakeesquire"_J, "CS_albertcakeesquire"},
+	    {"MSP_MOB0_MALES_01"_J, "MSP_MOB0_MALES_01"},
+	    {"U_M_M_FINALE2_AA_UPPERCLASS_01"_J, "U_M_M_FINALE2_AA_UPPERCLASS_01"},
+	    {"A_C_Horse_DutchWarmblood_ChocolateRoan"_J, "A_C_Horse_DutchWarmblood_ChocolateRoan"},
+	    {"MP_G_M_M_UNICRIMINALS_06"_J, "MP_G_M_M_UNICRIMINALS_06"},
+	    {"MSP_MUDTOWN5_MALES_01"_J, "MSP_MUDTOWN5_MALES_01"},
+	    {"A_C_FishNorthernPike_01_lg"_J, "A_C_FishNorthernPike_01_lg"},
+	    {"RE_NAKEDSWIMMER_MALES_01"_J, "RE_NAKEDSWIMMER_MALES_01"},
+	    {"A_C_HORSE_TURKOMAN_CHESTNUT"_J, "A_C_HORSE_TURKOMAN_CHESTNUT"},
+	    {"A_C_FishBullHeadCat_01_ms"_J, "A_C_FishBullHeadCat_01_ms"},
+	    {"A_C_HORSE_TURKOMAN_PERLINO"_J, "A_C_HORSE_TURKOMAN_PERLINO"},
+	    {"A_C_Horse_Andalusian_Perlino"_J, "A_C_Horse_Andalusian_Perlino"},
+	    {"A_M_M_STRFANCYTOURIST_01"_J, "A_M_M_STRFANCYTOURIST_01"},
+	    {"A_C_FishPerch_01_sm"_J, "A_C_FishPerch_01_sm"},
+	    {"U_M_M_RHDDOCTOR_01"_J, "U_M_M_RHDDOCTOR_01"},
+	    {"U_M_M_NbxGunsmith_01"_J, "U_M_M_NbxGunsmith_01"},
+	    {"CS_MrsFellows"_J, "CS_MrsFellows"},
+	    {"U_M_M_ARMTRAINSTATIONWORKER_01"_J, "U_M_M_ARMTRAINSTATIONWORKER_01"},
+	    {"U_M_M_BHT_SAINTDENISSALOON"_J, "U_M_M_BHT_SAINTDENISSALOON"},
+	    {"RE_PLAYERCAMPSTRANGERS_MALES_01"_J, "RE_PLAYERCAMPSTRANGERS_MALES_01"},
+	    {"S_M_M_Tailor_01"_J, "S_M_M_Tailor_01"},
+	    {"U_M_M_BHT_BENEDICTALLBRIGHT"_J, "U_M_M_BHT_BENEDICTALLBRIGHT"},
+	    {"S_M_M_Army_01"_J, "S_M_M_Army_01"},
+	    {"A_C_GooseCanada_01"_J, "A_C_GooseCanada_01"},
+	    {"CS_ValProstitute_02"_J, "CS_ValProstitute_02"},
+	    {"A_C_Woodpecker_02"_J, "A_C_Woodpecker_02"},
+	    {"RCSP_EDITHDOWNES2_MALES_01"_J, "RCSP_EDITHDOWNES2_MALES_01"},
+	    {"A_C_BearBlack_01"_J, "A_C_BearBlack_01"},
+	    {"G_M_M_UniBraithwaites_01"_J, "G_M_M_UniBraithwaites_01"},
+	    {"U_M_M_LNSOUTLAW_02"_J, "U_M_M_LNSOUTLAW_02"},
+	    {"S_M_M_PinLaw_01"_J, "S_M_M_PinLaw_01"},
+	    {"RE_POLICECHASE_MALES_01"_J, "RE_POLICECHASE_MALES_01"},
+	    {"A_C_SnakeFerDeLance_Pelt_01"_J, "A_C_SnakeFerDeLance_Pelt_01"},
+	    {"CS_evelynmiller"_J, "CS_evelynmiller"},
+	    {"MP_PREDATOR"_J, "MP_PREDATOR"},
+	    {"A_C_Horse_Andalusian_RoseGray"_J, "A_C_Horse_Andalusian_RoseGray"},
+	    {"S_M_M_HOFGuard_01"_J, "S_M_M_HOFGuard_01"},
+	    {"A_M_M_RANCHERTRAVELERS_COOL_01"_J, "A_M_M_RANCHERTRAVELERS_COOL_01"},
+	    {"CS_MP_GRACE_LANCING"_J, "CS_MP_GRACE_LANCING"},
 	    {"CS_CanCanMan_01"_J, "CS_CanCanMan_01"},
-	    {"CS_captainmonroe"_J, "CS_captainmonroe"},
+	    {"RE_PRISONWAGON_MALES_01"_J, "RE_PRISONWAGON_MALES_01"},
+	    {"A_C_Beaver_01"_J, "A_C_Beaver_01"},
+	    {"A_C_Horse_Criollo_Bayframeovero"_J, "A_C_Horse_Criollo_Bayframeovero"},
+	    {"SALOONBRAWLERS_13"_J, "SALOONBRAWLERS_13"},
+	    {"CS_PoisonWellShaman"_J, "CS_PoisonWellShaman"},
+	    {"RE_FUNDRAISER_FEMALES_01"_J, "RE_FUNDRAISER_FEMALES_01"},
+	    {"U_M_M_NbxBankerBounty_01"_J, "U_M_M_NbxBankerBounty_01"},
+	    {"U_M_M_story_COPPERHEAD_01"_J, "U_M_M_story_COPPERHEAD_01"},
+	    {"U_M_M_BHT_ODRISCOLLSLEEPING"_J, "U_M_M_BHT_ODRISCOLLSLEEPING"},
 	    {"CS_Cassidy"_J, "CS_Cassidy"},
-	    {"CS_catherinebraithwaite"_J, "CS_catherinebraithwaite"},
-	    {"CS_cattlerustler"_J, "CS_cattlerustler"},
-	    {"CS_CAVEHERMIT"_J, "CS_CAVEHERMIT"},
-	    {"CS_chainprisoner_01"_J, "CS_chainprisoner_01"},
-	    {"CS_chainprisoner_02"_J, "CS_chainprisoner_02"},
-	    {"CS_charlessmith"_J, "CS_charlessmith"},
-	    {"CS_ChelonianMaster"_J, "CS_ChelonianMaster"},
-	    {"CS_CIGCARDGUY"_J, "CS_CIGCARDGUY"},
-	    {"CS_clay"_J, "CS_clay"},
-	    {"CS_CLEET"_J, "CS_CLEET"},
-	    {"CS_clive"_J, "CS_clive"},
-	    {"CS_colfavours"_J, "CS_colfavours"},
-	    {"CS_ColmODriscoll"_J, "CS_ColmODriscoll"},
-	    {"CS_COOPER"_J, "CS_COOPER"},
-	    {"CS_CornwallTrainConductor"_J, "CS_CornwallTrainConductor"},
-	    {"CS_crackpotinventor"_J, "CS_crackpotinventor"},
-	    {"CS_crackpotRobot"_J, "CS_crackpotRobot"},
-	    {"CS_creepyoldlady"_J, "CS_creepyoldlady"},
-	    {"CS_creolecaptain"_J, "CS_creolecaptain"},
-	    {"CS_creoledoctor"_J, "CS_creoledoctor"},
-	    {"CS_creoleguy"_J, "CS_creoleguy"},
-	    {"CS_dalemaroney"_J, "CS_dalemaroney"},
-	    {"CS_DaveyCallender"_J, "CS_DaveyCallender"},
-	    {"CS_davidgeddes"_J, "CS_davidgeddes"},
-	    {"CS_DESMOND"_J, "CS_DESMOND"},
-	    {"CS_DIDSBURY"_J, "CS_DIDSBURY"},
-	    {"CS_DinoBonesLady"_J, "CS_DinoBonesLady"},
-	    {"CS_DisguisedDuster_01"_J, "CS_DisguisedDuster_01"},
-	    {"CS_DisguisedDuster_02"_J, "CS_DisguisedDuster_02"},
-	    {"CS_DisguisedDuster_03"_J, "CS_DisguisedDuster_03"},
-	    {"CS_DOROETHEAWICKLOW"_J, "CS_DOROETHEAWICKLOW"},
-	    {"CS_DrHiggins"_J, "CS_DrHiggins"},
-	    {"CS_DrMalcolmMacIntosh"_J, "CS_DrMalcolmMacIntosh"},
-	    {"CS_duncangeddes"_J, "CS_duncangeddes"},
-	    {"CS_DusterInformant_01"_J, "CS_DusterInformant_01"},
-	    {"CS_dutch"_J, "CS_dutch"},
-	    {"CS_EagleFlies"_J, "CS_EagleFlies"},
-	    {"CS_edgarross"_J, "CS_edgarross"},
-	    {"CS_EDITH_JOHN"_J, "CS_EDITH_JOHN"},
-	    {"CS_EdithDown"_J, "CS_EdithDown"},
-	    {"CS_edmundlowry"_J, "CS_edmundlowry"},
-	    {"CS_EscapeArtist"_J, "CS_EscapeArtist"},
-	    {"CS_EscapeArtistAssistant"_J, "CS_EscapeArtistAssistant"},
-	    {"CS_evelynmiller"_J, "CS_evelynmiller"},
-	    {"CS_EXCONFEDINFORMANT"_J, "CS_EXCONFEDINFORMANT"},
-	    {"CS_exconfedsleader_01"_J, "CS_exconfedsleader_01"},
-	    {"CS_EXOTICCOLLECTOR"_J, "CS_EXOTICCOLLECTOR"},
-	    {"CS_famousgunslinger_01"_J, "CS_famousgunslinger_01"},
-	    {"CS_famousgunslinger_02"_J, "CS_famousgunslinger_02"},
-	    {"CS_famousgunslinger_03"_J, "CS_famousgunslinger_03"},
-	    {"CS_famousgunslinger_04"_J, "CS_famousgunslinger_04"},
-	    {"CS_FamousGunslinger_05"_J, "CS_FamousGunslinger_05"},
-	    {"CS_FamousGunslinger_06"_J, "CS_FamousGunslinger_06"},
-	    {"CS_FEATHERSTONCHAMBERS"_J, "CS_FEATHERSTONCHAMBERS"},
-	    {"CS_FeatsOfStrength"_J, "CS_FeatsOfStrength"},
-	    {"CS_FIGHTREF"_J, "CS_FIGHTREF"},
-	    {"CS_Fire_Breather"_J, "CS_Fire_Breather"},
-	    {"CS_FISHCOLLECTOR"_J, "CS_FISHCOLLECTOR"},
-	    {"CS_forgivenhusband_01"_J, "CS_forgivenhusband_01"},
-	    {"CS_forgivenwife_01"_J, "CS_forgivenwife_01"},
-	    {"CS_FORMYARTBIGWOMAN"_J, "CS_FORMYARTBIGWOMAN"},
-	    {"CS_FRANCIS_SINCLAIR"_J, "CS_FRANCIS_SINCLAIR"},
-	    {"CS_frenchartist"_J, "CS_frenchartist"},
-	    {"CS_FRENCHMAN_01"_J, "CS_FRENCHMAN_01"},
-	    {"CS_fussar"_J, "CS_fussar"},
-	    {"CS_garethbraithwaite"_J, "CS_garethbraithwaite"},
-	    {"CS_GAVIN"_J, "CS_GAVIN"},
-	    {"CS_genstoryfemale"_J, "CS_genstoryfemale"},
-	    {"CS_genstorymale"_J, "CS_genstorymale"},
-	    {"CS_geraldbraithwaite"_J, "CS_geraldbraithwaite"},
-	    {"CS_GermanDaughter"_J, "CS_GermanDaughter"},
-	    {"CS_GermanFather"_J, "CS_GermanFather"},
-	    {"CS_GermanMother"_J, "CS_GermanMother"},
-	    {"CS_GermanSon"_J, "CS_GermanSon"},
-	    {"CS_GILBERTKNIGHTLY"_J, "CS_GILBERTKNIGHTLY"},
-	    {"CS_GLORIA"_J, "CS_GLORIA"},
-	    {"CS_GrizzledJon"_J, "CS_GrizzledJon"},
-	    {"CS_GuidoMartelli"_J, "CS_GuidoMartelli"},
-	    {"CS_HAMISH"_J, "CS_HAMISH"},
-	    {"CS_hectorfellowes"_J, "CS_hectorfellowes"},
+	    {"A_F_M_ArmTownfolk_02"_J, "A_F_M_ArmTownfolk_02"},
+	    {"CS_MP_JEREMIAH_SHAW"_J, "CS_MP_JEREMIAH_SHAW"},
+	    {"CS_cancan_02"_J, "CS_cancan_02"},
+	    {"A_M_M_FARMTRAVELERS_WARM_01"_J, "A_M_M_FARMTRAVELERS_WARM_01"},
+	    {"A_M_M_RkrSurvivalist_01"_J, "A_M_M_RkrSurvivalist_01"},
+	    {"A_C_Horse_Shire_RavenBlack"_J, "A_C_Horse_Shire_RavenBlack"},
 	    {"CS_henrilemiux"_J, "CS_henrilemiux"},
-	    {"CS_HERBALIST"_J, "CS_HERBALIST"},
-	    {"CS_hercule"_J, "CS_hercule"},
-	    {"CS_HestonJameson"_J, "CS_HestonJameson"},
-	    {"CS_hobartcrawley"_J, "CS_hobartcrawley"},
-	    {"CS_hoseamatthews"_J, "CS_hoseamatthews"},
-	    {"CS_IANGRAY"_J, "CS_IANGRAY"},
-	    {"CS_jackmarston"_J, "CS_jackmarston"},
-	    {"CS_jackmarston_teen"_J, "CS_jackmarston_teen"},
-	    {"CS_JAMIE"_J, "CS_JAMIE"},
-	    {"CS_JANSON"_J, "CS_JANSON"},
-	    {"CS_javierescuella"_J, "CS_javierescuella"},
-	    {"CS_Jeb"_J, "CS_Jeb"},
-	    {"CS_jimcalloway"_J, "CS_jimcalloway"},
-	    {"CS_jockgray"_J, "CS_jockgray"},
-	    {"CS_JOE"_J, "CS_JOE"},
-	    {"CS_JoeButler"_J, "CS_JoeButler"},
-	    {"CS_johnmarston"_J, "CS_johnmarston"},
-	    {"CS_JOHNTHEBAPTISINGMADMAN"_J, "CS_JOHNTHEBAPTISINGMADMAN"},
-	    {"CS_JohnWeathers"_J, "CS_JohnWeathers"},
-	    {"CS_josiahtrelawny"_J, "CS_josiahtrelawny"},
-	    {"CS_Jules"_J, "CS_Jules"},
-	    {"CS_karen"_J, "CS_karen"},
-	    {"CS_KarensJohn_01"_J, "CS_KarensJohn_01"},
-	    {"CS_kieran"_J, "CS_kieran"},
-	    {"CS_LARAMIE"_J, "CS_LARAMIE"},
-	    {"CS_leighgray"_J, "CS_leighgray"},
-	    {"CS_LemiuxAssistant"_J, "CS_LemiuxAssistant"},
-	    {"CS_lenny"_J, "CS_lenny"},
-	    {"CS_leon"_J, "CS_leon"},
-	    {"CS_leostrauss"_J, "CS_leostrauss"},
-	    {"CS_LeviSimon"_J, "CS_LeviSimon"},
-	    {"CS_leviticuscornwall"_J, "CS_leviticuscornwall"},
-	    {"CS_LillianPowell"_J, "CS_LillianPowell"},
-	    {"CS_lillymillet"_J, "CS_lillymillet"},
-	    {"CS_LondonderrySon"_J, "CS_LondonderrySon"},
-	    {"CS_LUCANAPOLI"_J, "CS_LUCANAPOLI"},
-	    {"CS_Magnifico"_J, "CS_Magnifico"},
-	    {"CS_MAMAWATSON"_J, "CS_MAMAWATSON"},
-	    {"CS_MARSHALL_THURWELL"_J, "CS_MARSHALL_THURWELL"},
-	    {"CS_marybeth"_J, "CS_marybeth"},
-	    {"CS_marylinton"_J, "CS_marylinton"},
-	    {"CS_MEDITATINGMONK"_J, "CS_MEDITATINGMONK"},
-	    {"CS_Meredith"_J, "CS_Meredith"},
-	    {"CS_MeredithsMother"_J, "CS_MeredithsMother"},
-	    {"CS_MicahBell"_J, "CS_MicahBell"},
-	    {"CS_MicahsNemesis"_J, "CS_MicahsNemesis"},
-	    {"CS_Mickey"_J, "CS_Mickey"},
-	    {"CS_miltonandrews"_J, "CS_miltonandrews"},
-	    {"CS_missMarjorie"_J, "CS_missMarjorie"},
-	    {"CS_MIXEDRACEKID"_J, "CS_MIXEDRACEKID"},
-	    {"CS_MOIRA"_J, "CS_MOIRA"},
-	    {"CS_mollyoshea"_J, "CS_mollyoshea"},
-	    {"CS_MP_AGENT_HIXON"_J, "CS_MP_AGENT_HIXON"},
-	    {"CS_MP_ALFREDO_MONTEZ"_J, "CS_MP_ALFREDO_MONTEZ"},
+	    {"A_C_Horse_MP_Mangy_Backup"_J, "A_C_Horse_MP_Mangy_Backup"},
+	    {"A_M_Y_ASBMINER_04"_J, "A_M_Y_ASBMINER_04"},
+	    {"RE_DARKALLEYBUM_MALES_01"_J, "RE_DARKALLEYBUM_MALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_02"_J, "MP_U_M_M_SALOONBRAWLERS_02"},
 	    {"CS_MP_AMOS_LANSING"_J, "CS_MP_AMOS_LANSING"},
+	    {"CS_MeredithsMother"_J, "CS_MeredithsMother"},
+	    {"U_M_M_GalaStringQuartet_03"_J, "U_M_M_GalaStringQuartet_03"},
+	    {"S_M_M_MARSHALLSRURAL_01"_J, "S_M_M_MARSHALLSRURAL_01"},
+	    {"A_M_M_WapWarriors_01"_J, "A_M_M_WapWarriors_01"},
+	    {"A_C_Egret_01"_J, "A_C_Egret_01"},
+	    {"CS_ANGEL"_J, "CS_ANGEL"},
+	    {"A_F_O_SDChinatown_01"_J, "A_F_O_SDChinatown_01"},
+	    {"CS_SD_STREETKID_01B"_J, "CS_SD_STREETKID_01B"},
+	    {"A_C_SnakeBlackTailRattle_01"_J, "A_C_SnakeBlackTailRattle_01"},
+	    {"U_M_M_CrDHomesteadTenant_01"_J, "U_M_M_CrDHomesteadTenant_01"},
+	    {"CS_archerfordham"_J, "CS_archerfordham"},
+	    {"CS_DisguisedDuster_01"_J, "CS_DisguisedDuster_01"},
+	    {"A_C_Horse_DutchWarmblood_SealBrown"_J, "A_C_Horse_DutchWarmblood_SealBrown"},
+	    {"RCSP_HEREKITTYKITTY_MALES_0"_J, "RCSP_HEREKITTYKITTY_MALES_0"},
+	    {"G_F_M_UNIDUSTER_01"_J, "G_F_M_UNIDUSTER_01"},
+	    {"RE_DEADBODIES_MALES_01"_J, "RE_DEADBODIES_MALES_01"},
+	    {"U_M_M_NBXGraverobber_05"_J, "U_M_M_NBXGraverobber_05"},
+	    {"A_M_O_SDChinatown_01"_J, "A_M_O_SDChinatown_01"},
+	    {"CS_ChelonianMaster"_J, "CS_ChelonianMaster"},
+	    {"A_C_Horse_Thoroughbred_ReverseDappleBlack"_J, "A_C_Horse_Thoroughbred_ReverseDappleBlack"},
+	    {"CS_twinbrother_01"_J, "CS_twinbrother_01"},
+	    {"CS_VHT_BATHGIRL"_J, "CS_VHT_BATHGIRL"},
+	    {"RE_BURNINGBODIES_MALES_01"_J, "RE_BURNINGBODIES_MALES_01"},
+	    {"A_C_Horse_MurfreeBrood_Mange_01"_J, "A_C_Horse_MurfreeBrood_Mange_01"},
+	    {"RCSP_POISONEDWELL_MALES_01"_J, "RCSP_POISONEDWELL_MALES_01"},
+	    {"A_M_M_VhtTownfolk_01"_J, "A_M_M_VhtTownfolk_01"},
+	    {"A_M_M_SDObesemen_01"_J, "A_M_M_SDObesemen_01"},
+	    {"A_F_M_MiddleSDTownfolk_02"_J, "A_F_M_MiddleSDTownfolk_02"},
+	    {"A_M_M_ASBBOATCREW_01"_J, "A_M_M_ASBBOATCREW_01"},
+	    {"A_C_Horse_Belgian_MealyChestnut"_J, "A_C_Horse_Belgian_MealyChestnut"},
+	    {"RE_INBREDKIDNAP_MALES_01"_J, "RE_INBREDKIDNAP_MALES_01"},
+	    {"RE_LOSTDOG_DOGS_01"_J, "RE_LOSTDOG_DOGS_01"},
+	    {"U_M_M_LNSOUTLAW_04"_J, "U_M_M_LNSOUTLAW_04"},
+	    {"MES_FINALE3_MALES_01"_J, "MES_FINALE3_MALES_01"},
+	    {"RE_SKIPPINGSTONES_TEENS_01"_J, "RE_SKIPPINGSTONES_TEENS_01"},
+	    {"MSP_MOB1_TEENS_01"_J, "MSP_MOB1_TEENS_01"},
+	    {"CS_MARSHALL_THURWELL"_J, "CS_MARSHALL_THURWELL"},
 	    {"cs_mp_bonnie"_J, "cs_mp_bonnie"},
-	    {"CS_MP_BOUNTYHUNTER"_J, "CS_MP_BOUNTYHUNTER"},
-	    {"CS_MP_CLIFF"_J, "CS_MP_CLIFF"},
-	    {"CS_MP_CRIPPS"_J, "CS_MP_CRIPPS"},
-	    {"CS_MP_DANNYLEE"_J, "CS_MP_DANNYLEE"},
-	    {"CS_MP_GRACE_LANCING"_J, "CS_MP_GRACE_LANCING"},
-	    {"CS_MP_GUS_MACMILLAN"_J, "CS_MP_GUS_MACMILLAN"},
-	    {"CS_MP_HANS"_J, "CS_MP_HANS"},
-	    {"CS_MP_HARRIET_DAVENPORT"_J, "CS_MP_HARRIET_DAVENPORT"},
-	    {"CS_MP_HORLEY"_J, "CS_MP_HORLEY"},
-	    {"CS_MP_JEREMIAH_SHAW"_J, "CS_MP_JEREMIAH_SHAW"},
-	    {"CS_MP_JESSICA"_J, "CS_MP_JESSICA"},
-	    {"CS_MP_JORGE_MONTEZ"_J, "CS_MP_JORGE_MONTEZ"},
-	    {"CS_MP_LANGSTON"_J, "CS_MP_LANGSTON"},
-	    {"CS_MP_LEE"_J, "CS_MP_LEE"},
-	    {"CS_MP_LEM"_J, "CS_MP_LEM"},
-	    {"CS_MP_LEM"_J, "CS_MP_LEM"},
-	    {"CS_MP_MABEL"_J, "CS_MP_MABEL"},
-	    {"CS_MP_MAGGIE"_J, "CS_MP_MAGGIE"},
-	    {"CS_MP_MARSHALL_DAVIES"_J, "CS_MP_MARSHALL_DAVIES"},
-	    {"CS_MP_MOONSHINER"_J, "CS_MP_MOONSHINER"},
-	    {"CS_MP_MRADLER"_J, "CS_MP_MRADLER"},
-	    {"CS_MP_OLDMAN_JONES"_J, "CS_MP_OLDMAN_JONES"},
-	    {"CS_MP_REVENGE_MARSHALL"_J, "CS_MP_REVENGE_MARSHALL"},
-	    {"CS_MP_SAMSON_FINCH"_J, "CS_MP_SAMSON_FINCH"},
-	    {"CS_MP_SETH"_J, "CS_MP_SETH"},
-	    {"CS_MP_SHAKY"_J, "CS_MP_SHAKY"},
-	    {"CS_MP_SHERIFFFREEMAN"_J, "CS_MP_SHERIFFFREEMAN"},
-	    {"CS_MP_TEDDYBROWN"_J, "CS_MP_TEDDYBROWN"},
-	    {"CS_MP_TERRANCE"_J, "CS_MP_TERRANCE"},
-	    {"CS_MP_THE_BOY"_J, "CS_MP_THE_BOY"},
-	    {"CS_MP_TRAVELLINGSALESWOMAN"_J, "CS_MP_TRAVELLINGSALESWOMAN"},
-	    {"CS_MP_WENT"_J, "CS_MP_WENT"},
-	    {"CS_mradler"_J, "CS_mradler"},
-	    {"CS_MRDEVON"_J, "CS_MRDEVON"},
-	    {"CS_MRLINTON"_J, "CS_MRLINTON"},
+	    {"S_M_M_VHTDEALER_01"_J, "S_M_M_VHTDEALER_01"},
+	    {"A_M_M_TumTownfolk_02"_J, "A_M_M_TumTownfolk_02"},
+	    {"RE_RALLYSETUP_MALES_01"_J, "RE_RALLYSETUP_MALES_01"},
+	    {"A_M_M_UniGunslinger_01"_J, "A_M_M_UniGunslinger_01"},
+	    {"CS_GermanDaughter"_J, "CS_GermanDaughter"},
+	    {"MSP_GRAYS1_MALES_01"_J, "MSP_GRAYS1_MALES_01"},
+	    {"MP_ASN_GAPTOOTHBREACH_MALES_01"_J, "MP_ASN_GAPTOOTHBREACH_MALES_01"},
+	    {"A_M_M_RhdTownfolk_01"_J, "A_M_M_RhdTownfolk_01"},
+	    {"A_C_Horse_Gang_Trelawney"_J, "A_C_Horse_Gang_Trelawney"},
+	    {"CS_ValProstitute_01"_J, "CS_ValProstitute_01"},
+	    {"U_M_M_RhdFiddlePlayer_01"_J, "U_M_M_RhdFiddlePlayer_01"},
 	    {"CS_mrpearson"_J, "CS_mrpearson"},
-	    {"CS_Mrs_Calhoun"_J, "CS_Mrs_Calhoun"},
-	    {"CS_MRS_SINCLAIR"_J, "CS_MRS_SINCLAIR"},
-	    {"CS_mrsadler"_J, "CS_mrsadler"},
-	    {"CS_MrsFellows"_J, "CS_MrsFellows"},
-	    {"CS_mrsgeddes"_J, "CS_mrsgeddes"},
-	    {"CS_MrsLondonderry"_J, "CS_MrsLondonderry"},
-	    {"CS_MrsWeathers"_J, "CS_MrsWeathers"},
-	    {"CS_MRSWEATHERS"_J, "CS_MRSWEATHERS"},
+	    {"CS_LemiuxAssistant"_J, "CS_LemiuxAssistant"},
+	    {"CS_TREASUREHUNTER"_J, "CS_TREASUREHUNTER"},
+	    {"A_C_Rat_01"_J, "A_C_Rat_01"},
+	    {"A_C_DogStreet_01"_J, "A_C_DogStreet_01"},
+	    {"CS_creoledoctor"_J, "CS_creoledoctor"},
+	    {"A_M_M_BynSurvivalist_01"_J, "A_M_M_BynSurvivalist_01"},
+	    {"MP_A_F_M_SALOONBAND_FEMALES_01"_J, "MP_A_F_M_SALOONBAND_FEMALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_10"_J, "MP_U_M_M_SALOONBRAWLERS_10"},
+	    {"U_M_M_RKFRANCHER_01"_J, "U_M_M_RKFRANCHER_01"},
+	    {"U_M_O_BLWPHOTOGRAPHER_01"_J, "U_M_O_BLWPHOTOGRAPHER_01"},
+	    {"CS_crackpotRobot"_J, "CS_crackpotRobot"},
+	    {"CS_josiahtrelawny"_J, "CS_josiahtrelawny"},
+	    {"A_C_Pig_01"_J, "A_C_Pig_01"},
+	    {"A_C_Horse_NorfolkRoadster_Black"_J, "A_C_Horse_NorfolkRoadster_Black"},
+	    {"U_F_M_STORY_NIGHTFOLK_01"_J, "U_F_M_STORY_NIGHTFOLK_01"},
+	    {"CS_bandbassist"_J, "CS_bandbassist"},
+	    {"U_M_M_UniDusterLeader_01"_J, "U_M_M_UniDusterLeader_01"},
+	    {"CS_genstoryfemale"_J, "CS_genstoryfemale"},
+	    {"A_M_M_BlWUpperClass_01"_J, "A_M_M_BlWUpperClass_01"},
+	    {"A_C_Horse_NorfolkRoadster_SpeckledGrey"_J, "A_C_Horse_NorfolkRoadster_SpeckledGrey"},
+	    {"MP_G_M_M_UNICRIMINALS_07"_J, "MP_G_M_M_UNICRIMINALS_07"},
+	    {"U_M_M_NBXGraverobber_04"_J, "U_M_M_NBXGraverobber_04"},
+	    {"CS_tilly"_J, "CS_tilly"},
+	    {"A_C_PantherLegendaryr_01"_J, "A_C_PantherLegendaryr_01"},
+	    {"U_F_M_VHTBARTENDER_01"_J, "U_F_M_VHTBARTENDER_01"},
+	    {"A_M_M_ASBMINER_02"_J, "A_M_M_ASBMINER_02"},
+	    {"MES_MARSTON5_2_MALES_01"_J, "MES_MARSTON5_2_MALES_01"},
+	    {"A_C_Horse_TennesseeWalker_GoldPalomino_PC"_J, "A_C_Horse_TennesseeWalker_GoldPalomino_PC"},
+	    {"CS_marylinton"_J, "CS_marylinton"},
+	    {"RE_PRISONWAGON_FEMALES_01"_J, "RE_PRISONWAGON_FEMALES_01"},
+	    {"MP_FM_BOUNTYTARGET_FEMALES_DLC008_01"_J, "MP_FM_BOUNTYTARGET_FEMALES_DLC008_01"},
+	    {"G_M_M_UniCriminals_01"_J, "G_M_M_UniCriminals_01"},
+	    {"U_M_M_RhdTrainStationWorker_01"_J, "U_M_M_RhdTrainStationWorker_01"},
+	    {"RE_TRAINHOLDUP_FEMALES_01"_J, "RE_TRAINHOLDUP_FEMALES_01"},
+	    {"A_C_Horse_Shire_DarkBay"_J, "A_C_Horse_Shire_DarkBay"},
+	    {"A_C_Horse_TennesseeWalker_BlackRabicano"_J, "A_C_Horse_TennesseeWalker_BlackRabicano"},
+	    {"U_M_M_SDWEALTHYTRAVELLER_01"_J, "U_M_M_SDWEALTHYTRAVELLER_01"},
+	    {"A_C_Horse_TennesseeWalker_Chestnut"_J, "A_C_Horse_TennesseeWalker_Chestnut"},
+	    {"U_M_M_SDCUSTOMVENDOR_01"_J, "U_M_M_SDCUSTOMVENDOR_01"},
+	    {"A_F_O_SDUpperClass_01"_J, "A_F_O_SDUpperClass_01"},
+	    {"S_M_M_BankClerk_01"_J, "S_M_M_BankClerk_01"},
+	    {"A_C_DogPoodle_01"_J, "A_C_DogPoodle_01"},
+	    {"A_C_DogCollie_01"_J, "A_C_DogCollie_01"},
+	    {"A_C_DogAmericanFoxhound_01"_J, "A_C_DogAmericanFoxhound_01"},
+	    {"CS_ValPrayingMan"_J, "CS_ValPrayingMan"},
+	    {"U_M_M_STRWELCOMECENTER_01"_J, "U_M_M_STRWELCOMECENTER_01"},
+	    {"A_C_Heron_01"_J, "A_C_Heron_01"},
+	    {"U_M_Y_DuelListBounty_01"_J, "U_M_Y_DuelListBounty_01"},
+	    {"A_M_M_BLWObeseMen_01"_J, "A_M_M_BLWObeseMen_01"},
 	    {"CS_MRWAYNE"_J, "CS_MRWAYNE"},
-	    {"CS_mud2bigguy"_J, "CS_mud2bigguy"},
-	    {"CS_MysteriousStranger"_J, "CS_MysteriousStranger"},
-	    {"CS_NbxDrunk"_J, "CS_NbxDrunk"},
-	    {"CS_NbxExecuted"_J, "CS_NbxExecuted"},
-	    {"CS_NbxPoliceChiefFormal"_J, "CS_NbxPoliceChiefFormal"},
-	    {"CS_nbxreceptionist_01"_J, "CS_nbxreceptionist_01"},
-	    {"CS_NIAL_WHELAN"_J, "CS_NIAL_WHELAN"},
+	    {"U_F_M_LagMother_01"_J, "U_F_M_LagMother_01"},
+	    {"A_C_Horse_GypsyCob_WhiteBlagdon"_J, "A_C_Horse_GypsyCob_WhiteBlagdon"},
+	    {"A_C_Vulture_01"_J, "A_C_Vulture_01"},
+	    {"A_F_M_FAMILYTRAVELERS_COOL_01"_J, "A_F_M_FAMILYTRAVELERS_COOL_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_01"_J, "MP_U_M_M_SALOONBRAWLERS_01"},
+	    {"A_C_Deer_01"_J, "A_C_Deer_01"},
+	    {"U_M_M_ODDFELLOWPARTICIPANT_01"_J, "U_M_M_ODDFELLOWPARTICIPANT_01"},
+	    {"U_M_M_NbxBronteAsc_01"_J, "U_M_M_NbxBronteAsc_01"},
+	    {"RE_LOSTDRUNK_FEMALES_01"_J, "RE_LOSTDRUNK_FEMALES_01"},
+	    {"U_M_M_WaLGENERALSTOREOWNER_01"_J, "U_M_M_WaLGENERALSTOREOWNER_01"},
+	    {"U_M_M_story_PRINCESS_01"_J, "U_M_M_story_PRINCESS_01"},
+	    {"S_M_M_ValCowpoke_01"_J, "S_M_M_ValCowpoke_01"},
+	    {"A_M_M_StrTownfolk_01"_J, "A_M_M_StrTownfolk_01"},
+	    {"RE_TOWNWIDOW_FEMALES_01"_J, "RE_TOWNWIDOW_FEMALES_01"},
+	    {"A_C_Horse_Turkoman_DarkBay"_J, "A_C_Horse_Turkoman_DarkBay"},
+	    {"A_C_Horse_Criollo_Dun"_J, "A_C_Horse_Criollo_Dun"},
+	    {"A_C_Horse_Gang_Kieran"_J, "A_C_Horse_Gang_Kieran"},
+	    {"RE_MURDERSUICIDE_MALES_01"_J, "RE_MURDERSUICIDE_MALES_01"},
+	    {"U_M_M_GalaStringQuartet_02"_J, "U_M_M_GalaStringQuartet_02"},
+	    {"CS_JOHNTHEBAPTISINGMADMAN"_J, "CS_JOHNTHEBAPTISINGMADMAN"},
+	    {"CS_Mrs_Calhoun"_J, "CS_Mrs_Calhoun"},
+	    {"RE_COACHROBBERY_MALES_01"_J, "RE_COACHROBBERY_MALES_01"},
+	    {"MP_G_M_M_UNICRIMINALS_04"_J, "MP_G_M_M_UNICRIMINALS_04"},
+	    {"A_M_M_SDDockForeman_01"_J, "A_M_M_SDDockForeman_01"},
+	    {"A_C_HORSE_MUSTANG_CHESTNUTTOVERO"_J, "A_C_HORSE_MUSTANG_CHESTNUTTOVERO"},
+	    {"CS_WATSON_03"_J, "CS_WATSON_03"},
+	    {"MES_MARSTON1_MALES_01"_J, "MES_MARSTON1_MALES_01"},
+	    {"MSP_MOB1_MALES_01"_J, "MSP_MOB1_MALES_01"},
+	    {"CS_MP_REVENGE_MARSHALL"_J, "CS_MP_REVENGE_MARSHALL"},
+	    {"S_M_M_SkpGuard_01"_J, "S_M_M_SkpGuard_01"},
+	    {"S_M_M_BLWCOWPOKE_01"_J, "S_M_M_BLWCOWPOKE_01"},
+	    {"A_M_M_SclFancyTravellers_01"_J, "A_M_M_SclFancyTravellers_01"},
+	    {"Immortality"_J, "Immortality"},
+	    {"U_M_M_story_MURFEE_01"_J, "U_M_M_story_MURFEE_01"},
+	    {"A_C_SnakeRedBoa_Pelt_01"_J, "A_C_SnakeRedBoa_Pelt_01"},
+	    {"A_C_CaliforniaCondor_01"_J, "A_C_CaliforniaCondor_01"},
+	    {"RE_ROWDYDRUNKS_MALES_01"_J, "RE_ROWDYDRUNKS_MALES_01"},
+	    {"RCSP_MRMAYOR_MALES_01"_J, "RCSP_MRMAYOR_MALES_01"},
+	    {"CS_hoseamatthews"_J, "CS_hoseamatthews"},
+	    {"RCSP_GUNSLINGERDUEL4_MALES_01"_J, "RCSP_GUNSLINGERDUEL4_MALES_01"},
+	    {"A_C_Horse_Morgan_BayRoan"_J, "A_C_Horse_Morgan_BayRoan"},
+	    {"CS_theodorelevin"_J, "CS_theodorelevin"},
 	    {"CS_NicholasTimmins"_J, "CS_NicholasTimmins"},
-	    {"CS_NILS"_J, "CS_NILS"},
-	    {"CS_NorrisForsythe"_J, "CS_NorrisForsythe"},
-	    {"CS_obediahhinton"_J, "CS_obediahhinton"},
-	    {"CS_oddfellowspinhead"_J, "CS_oddfellowspinhead"},
-	    {"CS_ODProstitute"_J, "CS_ODProstitute"},
-	    {"CS_OPERASINGER"_J, "CS_OPERASINGER"},
-	    {"CS_PAYTAH"_J, "CS_PAYTAH"},
-	    {"CS_penelopebraithwaite"_J, "CS_penelopebraithwaite"},
-	    {"CS_PinkertonGoon"_J, "CS_PinkertonGoon"},
-	    {"CS_PoisonWellShaman"_J, "CS_PoisonWellShaman"},
-	    {"CS_POORJOE"_J, "CS_POORJOE"},
-	    {"CS_PRIEST_WEDDING"_J, "CS_PRIEST_WEDDING"},
-	    {"CS_PrincessIsabeau"_J, "CS_PrincessIsabeau"},
-	    {"CS_professorbell"_J, "CS_professorbell"},
-	    {"CS_rainsfall"_J, "CS_rainsfall"},
-	    {"CS_RAMON_CORTEZ"_J, "CS_RAMON_CORTEZ"},
-	    {"CS_ReverendFortheringham"_J, "CS_ReverendFortheringham"},
-	    {"CS_revswanson"_J, "CS_revswanson"},
-	    {"CS_rhodeputy_01"_J, "CS_rhodeputy_01"},
-	    {"CS_RhoDeputy_02"_J, "CS_RhoDeputy_02"},
-	    {"CS_RhodesAssistant"_J, "CS_RhodesAssistant"},
-	    {"CS_rhodeskidnapvictim"_J, "CS_rhodeskidnapvictim"},
-	    {"CS_rhodessaloonbouncer"_J, "CS_rhodessaloonbouncer"},
-	    {"CS_ringmaster"_J, "CS_ringmaster"},
-	    {"CS_ROCKYSEVEN_WIDOW"_J, "CS_ROCKYSEVEN_WIDOW"},
-	    {"CS_samaritan"_J, "CS_samaritan"},
-	    {"CS_SCOTTGRAY"_J, "CS_SCOTTGRAY"},
-	    {"CS_SD_STREETKID_01"_J, "CS_SD_STREETKID_01"},
-	    {"CS_SD_STREETKID_01A"_J, "CS_SD_STREETKID_01A"},
-	    {"CS_SD_STREETKID_01B"_J, "CS_SD_STREETKID_01B"},
-	    {"CS_SD_STREETKID_02"_J, "CS_SD_STREETKID_02"},
-	    {"CS_SDDoctor_01"_J, "CS_SDDoctor_01"},
-	    {"CS_SDPRIEST"_J, "CS_SDPRIEST"},
-	    {"CS_SDSALOONDRUNK_01"_J, "CS_SDSALOONDRUNK_01"},
-	    {"CS_SDStreetKidThief"_J, "CS_SDStreetKidThief"},
-	    {"CS_SDStreetKidThief"_J, "CS_SDStreetKidThief"},
-	    {"CS_sean"_J, "CS_sean"},
-	    {"CS_SHERIFFFREEMAN"_J, "CS_SHERIFFFREEMAN"},
-	    {"CS_SheriffOwens"_J, "CS_SheriffOwens"},
-	    {"CS_sistercalderon"_J, "CS_sistercalderon"},
-	    {"CS_slavecatcher"_J, "CS_slavecatcher"},
-	    {"CS_SOOTHSAYER"_J, "CS_SOOTHSAYER"},
+	    {"CS_DisguisedDuster_03"_J, "CS_DisguisedDuster_03"},
+	    {"S_M_M_MaPWorker_01"_J, "S_M_M_MaPWorker_01"},
+	    {"RCSP_NATIVE_AMERICANFATHERS_MALES_01"_J, "RCSP_NATIVE_AMERICANFATHERS_MALES_01"},
+	    {"CS_DinoBonesLady"_J, "CS_DinoBonesLady"},
+	    {"A_M_M_BiVRoughTravellers_01"_J, "A_M_M_BiVRoughTravellers_01"},
+	    {"MP_ASN_SHADYBELLE_FEMALES_01"_J, "MP_ASN_SHADYBELLE_FEMALES_01"},
+	    {"CS_MAMAWATSON"_J, "CS_MAMAWATSON"},
+	    {"A_C_Pelican_01"_J, "A_C_Pelican_01"},
+	    {"CS_beaugray"_J, "CS_beaugray"},
 	    {"CS_strawberryoutlaw_01"_J, "CS_strawberryoutlaw_01"},
-	    {"CS_strawberryoutlaw_02"_J, "CS_strawberryoutlaw_02"},
-	    {"CS_strdeputy_01"_J, "CS_strdeputy_01"},
-	    {"CS_strdeputy_02"_J, "CS_strdeputy_02"},
-	    {"CS_strsheriff_01"_J, "CS_strsheriff_01"},
-	    {"CS_SUNWORSHIPPER"_J, "CS_SUNWORSHIPPER"},
-	    {"CS_susangrimshaw"_J, "CS_susangrimshaw"},
-	    {"CS_SwampFreak"_J, "CS_SwampFreak"},
-	    {"CS_SWAMPWEIRDOSONNY"_J, "CS_SWAMPWEIRDOSONNY"},
-	    {"CS_SwordDancer"_J, "CS_SwordDancer"},
+	    {"U_M_M_NbxResident_02"_J, "U_M_M_NbxResident_02"},
+	    {"CS_crackpotinventor"_J, "CS_crackpotinventor"},
+	    {"CS_MP_HORLEY"_J, "CS_MP_HORLEY"},
+	    {"CS_hercule"_J, "CS_hercule"},
+	    {"CS_MP_ALFREDO_MONTEZ"_J, "CS_MP_ALFREDO_MONTEZ"},
+	    {"CS_GAVIN"_J, "CS_GAVIN"},
+	    {"A_M_M_UniCorpse_01"_J, "A_M_M_UniCorpse_01"},
+	    {"U_M_M_CORNWALLDRIVER_01"_J, "U_M_M_CORNWALLDRIVER_01"},
+	    {"CS_LeviSimon"_J, "CS_LeviSimon"},
+	    {"CS_BLWWITNESS"_J, "CS_BLWWITNESS"},
+	    {"CS_LondonderrySon"_J, "CS_LondonderrySon"},
+	    {"RE_GOLDPANNER_MALES_01"_J, "RE_GOLDPANNER_MALES_01"},
+	    {"CS_captainmonroe"_J, "CS_captainmonroe"},
+	    {"U_M_M_ValAuctionForman_02"_J, "U_M_M_ValAuctionForman_02"},
+	    {"RCSP_POISONEDWELL_TEENS_01"_J, "RCSP_POISONEDWELL_TEENS_01"},
+	    {"U_M_M_ARMYTRN4_01"_J, "U_M_M_ARMYTRN4_01"},
+	    {"G_M_M_UNIDUSTER_05"_J, "G_M_M_UNIDUSTER_05"},
+	    {"U_M_M_story_CREEPER_01"_J, "U_M_M_story_CREEPER_01"},
+	    {"S_M_O_CKTWorker_01"_J, "S_M_O_CKTWorker_01"},
+	    {"A_C_Horse_NorfolkRoadster_SpottedTricolor"_J, "A_C_Horse_NorfolkRoadster_SpottedTricolor"},
+	    {"S_M_M_DispatchLeaderRural_01"_J, "S_M_M_DispatchLeaderRural_01"},
+	    {"CS_famousgunslinger_02"_J, "CS_famousgunslinger_02"},
+	    {"CS_MP_AGENT_HIXON"_J, "CS_MP_AGENT_HIXON"},
+	    {"A_M_M_ASBMINER_03"_J, "A_M_M_ASBMINER_03"},
+	    {"U_F_M_BHT_WIFE"_J, "U_F_M_BHT_WIFE"},
+	    {"CS_MrsLondonderry"_J, "CS_MrsLondonderry"},
+	    {"U_M_M_GAMDoorman_01"_J, "U_M_M_GAMDoorman_01"},
+	    {"SALOONBRAWLERS_11"_J, "SALOONBRAWLERS_11"},
+	    {"CS_SOOTHSAYER"_J, "CS_SOOTHSAYER"},
+	    {"CS_GermanFather"_J, "CS_GermanFather"},
+	    {"RE_CORPSECART_MALES_01"_J, "RE_CORPSECART_MALES_01"},
+	    {"CS_catherinebraithwaite"_J, "CS_catherinebraithwaite"},
+	    {"RCSP_CALDERON_MALES_01"_J, "RCSP_CALDERON_MALES_01"},
+	    {"A_C_Horse_MissouriFoxTrotter_Blacktovero"_J, "A_C_Horse_MissouriFoxTrotter_Blacktovero"},
+	    {"RE_PLAYERCAMPSTRANGERS_FEMALES_01"_J, "RE_PLAYERCAMPSTRANGERS_FEMALES_01"},
+	    {"CS_FIGHTREF"_J, "CS_FIGHTREF"},
+	    {"A_F_M_ARMCHOLERACORPSE_01"_J, "A_F_M_ARMCHOLERACORPSE_01"},
+	    {"S_M_M_MarketVendor_01"_J, "S_M_M_MarketVendor_01"},
+	    {"CS_charlessmith"_J, "CS_charlessmith"},
 	    {"CS_tavishgray"_J, "CS_tavishgray"},
-	    {"CS_TAXIDERMIST"_J, "CS_TAXIDERMIST"},
-	    {"CS_theodorelevin"_J, "CS_theodorelevin"},
-	    {"CS_thomasdown"_J, "CS_thomasdown"},
-	    {"CS_TigerHandler"_J, "CS_TigerHandler"},
-	    {"CS_tilly"_J, "CS_tilly"},
-	    {"CS_TimothyDonahue"_J, "CS_TimothyDonahue"},
-	    {"CS_TINYHERMIT"_J, "CS_TINYHERMIT"},
-	    {"CS_tomdickens"_J, "CS_tomdickens"},
-	    {"CS_TownCrier"_J, "CS_TownCrier"},
-	    {"CS_TREASUREHUNTER"_J, "CS_TREASUREHUNTER"},
-	    {"CS_twinbrother_01"_J, "CS_twinbrother_01"},
-	    {"CS_twinbrother_02"_J, "CS_twinbrother_02"},
-	    {"CS_twingroupie_01"_J, "CS_twingroupie_01"},
-	    {"CS_twingroupie_02"_J, "CS_twingroupie_02"},
-	    {"CS_uncle"_J, "CS_uncle"},
-	    {"CS_UNIDUSTERJAIL_01"_J, "CS_UNIDUSTERJAIL_01"},
-	    {"CS_valauctionboss_01"_J, "CS_valauctionboss_01"},
-	    {"CS_VALDEPUTY_01"_J, "CS_VALDEPUTY_01"},
-	    {"CS_ValPrayingMan"_J, "CS_ValPrayingMan"},
-	    {"CS_ValProstitute_01"_J, "CS_ValProstitute_01"},
-	    {"CS_ValProstitute_02"_J, "CS_ValProstitute_02"},
-	    {"CS_VALSHERIFF"_J, "CS_VALSHERIFF"},
-	    {"CS_Vampire"_J, "CS_Vampire"},
-	    {"CS_VHT_BATHGIRL"_J, "CS_VHT_BATHGIRL"},
-	    {"CS_WapitiBoy"_J, "CS_WapitiBoy"},
-	    {"CS_warvet"_J, "CS_warvet"},
-	    {"CS_WATSON_01"_J, "CS_WATSON_01"},
-	    {"CS_WATSON_02"_J, "CS_WATSON_02"},
-	    {"CS_WATSON_03"_J, "CS_WATSON_03"},
-	    {"CS_WELSHFIGHTER"_J, "CS_WELSHFIGHTER"},
-	    {"CS_WintonHolmes"_J, "CS_WintonHolmes"},
-	    {"CS_Wrobel"_J, "CS_Wrobel"},
-	    {"G_F_M_UNIDUSTER_01"_J, "G_F_M_UNIDUSTER_01"},
-	    {"G_M_M_BountyHunters_01"_J, "G_M_M_BountyHunters_01"},
-	    {"G_M_M_UniAfricanAmericanGang_01"_J, "G_M_M_UniAfricanAmericanGang_01"},
-	    {"G_M_M_UniBanditos_01"_J, "G_M_M_UniBanditos_01"},
-	    {"G_M_M_UniBraithwaites_01"_J, "G_M_M_UniBraithwaites_01"},
+	    {"CS_CABARETMC"_J, "CS_CABARETMC"},
+	    {"U_M_M_NbxGeneralStoreOwner_01"_J, "U_M_M_NbxGeneralStoreOwner_01"},
+	    {"A_M_M_GRIFANCYDRIVERS_01"_J, "A_M_M_GRIFANCYDRIVERS_01"},
+	    {"A_C_Pheasant_01"_J, "A_C_Pheasant_01"},
+	    {"RE_SKIPPINGSTONES_MALES_01"_J, "RE_SKIPPINGSTONES_MALES_01"},
+	    {"CS_JoeButler"_J, "CS_JoeButler"},
+	    {"U_M_M_story_TREASURE_01"_J, "U_M_M_story_TREASURE_01"},
+	    {"A_M_M_RANCHER_01"_J, "A_M_M_RANCHER_01"},
+	    {"CS_Jeb"_J, "CS_Jeb"},
+	    {"U_M_Y_EmRSon_01"_J, "U_M_Y_EmRSon_01"},
+	    {"CS_banddrummer"_J, "CS_banddrummer"},
+	    {"A_F_M_BlWUpperClass_01"_J, "A_F_M_BlWUpperClass_01"},
+	    {"CS_lillymillet"_J, "CS_lillymillet"},
+	    {"S_M_M_GENCONDUCTOR_01"_J, "S_M_M_GENCONDUCTOR_01"},
+	    {"MP_A_C_DEER"_J, "MP_A_C_DEER"},
+	    {"CS_ansel_atherton"_J, "CS_ansel_atherton"},
+	    {"U_M_M_story_VALENTINE_01"_J, "U_M_M_story_VALENTINE_01"},
+	    {"A_M_M_NbxSlums_01"_J, "A_M_M_NbxSlums_01"},
+	    {"A_C_Raccoon_01"_J, "A_C_Raccoon_01"},
+	    {"A_C_EAGLE_01"_J, "A_C_EAGLE_01"},
+	    {"A_M_M_FAMILYTRAVELERS_COOL_01"_J, "A_M_M_FAMILYTRAVELERS_COOL_01"},
+	    {"A_M_M_huntertravelers_cool_01"_J, "A_M_M_huntertravelers_cool_01"},
+	    {"A_C_Cat_01"_J, "A_C_Cat_01"},
+	    {"MP_G_M_M_UNICRIMINALS_05"_J, "MP_G_M_M_UNICRIMINALS_05"},
+	    {"A_C_SnakeFerDeLance_01"_J, "A_C_SnakeFerDeLance_01"},
+	    {"A_C_Squirrel_01"_J, "A_C_Squirrel_01"},
+	    {"A_M_O_BlWUpperClass_01"_J, "A_M_O_BlWUpperClass_01"},
+	    {"A_C_Horse_GypsyCob_SplashedPiebald"_J, "A_C_Horse_GypsyCob_SplashedPiebald"},
 	    {"G_M_M_UniBronteGoons_01"_J, "G_M_M_UniBronteGoons_01"},
-	    {"G_M_M_UniCornwallGoons_01"_J, "G_M_M_UniCornwallGoons_01"},
-	    {"G_M_M_UniCriminals_01"_J, "G_M_M_UniCriminals_01"},
-	    {"G_M_M_UniCriminals_02"_J, "G_M_M_UniCriminals_02"},
-	    {"G_M_M_UniDuster_01"_J, "G_M_M_UniDuster_01"},
-	    {"G_M_M_UniDuster_02"_J, "G_M_M_UniDuster_02"},
-	    {"G_M_M_UniDuster_03"_J, "G_M_M_UniDuster_03"},
-	    {"G_M_M_UniDuster_04"_J, "G_M_M_UniDuster_04"},
-	    {"G_M_M_UNIDUSTER_05"_J, "G_M_M_UNIDUSTER_05"},
-	    {"G_M_M_UniGrays_01"_J, "G_M_M_UniGrays_01"},
-	    {"G_M_M_UniGrays_02"_J, "G_M_M_UniGrays_02"},
-	    {"G_M_M_UniInbred_01"_J, "G_M_M_UniInbred_01"},
+	    {"CS_Acrobat"_J, "CS_Acrobat"},
+	    {"MP_U_M_M_LBT_Philipsvictim_01"_J, "MP_U_M_M_LBT_Philipsvictim_01"},
+	    {"CS_RhoDeputy_02"_J, "CS_RhoDeputy_02"},
+	    {"A_M_M_FARMTRAVELERS_COOL_01"_J, "A_M_M_FARMTRAVELERS_COOL_01"},
+	    {"MP_A_C_HORSECORPSE_01"_J, "MP_A_C_HORSECORPSE_01"},
+	    {"CS_edmundlowry"_J, "CS_edmundlowry"},
+	    {"CS_DisguisedDuster_02"_J, "CS_DisguisedDuster_02"},
+	    {"MP_U_M_M_ANIMALPOACHER_06"_J, "MP_U_M_M_ANIMALPOACHER_06"},
+	    {"RE_DRUNKDUELER_MALES_01"_J, "RE_DRUNKDUELER_MALES_01"},
+	    {"A_C_FishBullHeadCat_01_sm"_J, "A_C_FishBullHeadCat_01_sm"},
+	    {"A_C_Horse_Arabian_RedChestnut"_J, "A_C_Horse_Arabian_RedChestnut"},
+	    {"U_M_M_NbxResident_03"_J, "U_M_M_NbxResident_03"},
+	    {"A_C_Toad_01"_J, "A_C_Toad_01"},
+	    {"MSP_INDUSTRY3_FEMALES_01"_J, "MSP_INDUSTRY3_FEMALES_01"},
+	    {"CS_EXOTICCOLLECTOR"_J, "CS_EXOTICCOLLECTOR"},
+	    {"A_M_M_CHELONIAN_01"_J, "A_M_M_CHELONIAN_01"},
+	    {"CS_FISHCOLLECTOR"_J, "CS_FISHCOLLECTOR"},
+	    {"A_C_HORSE_TURKOMAN_GREY"_J, "A_C_HORSE_TURKOMAN_GREY"},
+	    {"MP_U_F_M_LEGENDARYBOUNTY_03"_J, "MP_U_F_M_LEGENDARYBOUNTY_03"},
+	    {"CS_OPERASINGER"_J, "CS_OPERASINGER"},
 	    {"G_M_M_UNILANGSTONBOYS_01"_J, "G_M_M_UNILANGSTONBOYS_01"},
-	    {"G_M_M_UNIMICAHGOONS_01"_J, "G_M_M_UNIMICAHGOONS_01"},
-	    {"G_M_M_UniMountainMen_01"_J, "G_M_M_UniMountainMen_01"},
-	    {"G_M_M_UniRanchers_01"_J, "G_M_M_UniRanchers_01"},
-	    {"G_M_M_UNISWAMP_01"_J, "G_M_M_UNISWAMP_01"},
-	    {"G_M_O_UniExConfeds_01"_J, "G_M_O_UniExConfeds_01"},
-	    {"G_M_Y_UniExConfeds_01"_J, "G_M_Y_UniExConfeds_01"},
-	    {"G_M_Y_UNIEXCONFEDS_02"_J, "G_M_Y_UNIEXCONFEDS_02"},
-	    {"Immortality"_J, "Immortality"},
-	    {"MBH_RHODESRANCHER_FEMALES_01"_J, "MBH_RHODESRANCHER_FEMALES_01"},
-	    {"MBH_RHODESRANCHER_TEENS_01"_J, "MBH_RHODESRANCHER_TEENS_01"},
-	    {"MBH_SKINNERSEARCH_MALES_01"_J, "MBH_SKINNERSEARCH_MALES_01"},
-	    {"MCCLELLAN_SADDLE_01"_J, "MCCLELLAN_SADDLE_01"},
-	    {"MES_ABIGAIL2_MALES_01"_J, "MES_ABIGAIL2_MALES_01"},
-	    {"MES_FINALE2_FEMALES_01"_J, "MES_FINALE2_FEMALES_01"},
-	    {"MES_FINALE2_MALES_01"_J, "MES_FINALE2_MALES_01"},
-	    {"MES_FINALE3_MALES_01"_J, "MES_FINALE3_MALES_01"},
-	    {"MES_MARSTON1_MALES_01"_J, "MES_MARSTON1_MALES_01"},
-	    {"MES_MARSTON2_MALES_01"_J, "MES_MARSTON2_MALES_01"},
-	    {"MES_MARSTON5_2_MALES_01"_J, "MES_MARSTON5_2_MALES_01"},
-	    {"MES_MARSTON6_FEMALES_01"_J, "MES_MARSTON6_FEMALES_01"},
-	    {"MES_MARSTON6_MALES_01"_J, "MES_MARSTON6_MALES_01"},
-	    {"MES_MARSTON6_TEENS_01"_J, "MES_MARSTON6_TEENS_01"},
-	    {"MES_SADIE4_MALES_01"_J, "MES_SADIE4_MALES_01"},
-	    {"MES_SADIE5_MALES_01"_J, "MES_SADIE5_MALES_01"},
-	    {"MOTHERHUBBARD_SADDLE_01"_J, "MOTHERHUBBARD_SADDLE_01"},
-	    {"MP_A_F_M_CARDGAMEPLAYERS_01"_J, "MP_A_F_M_CARDGAMEPLAYERS_01"},
-	    {"MP_A_F_M_SALOONBAND_FEMALES_01"_J, "MP_A_F_M_SALOONBAND_FEMALES_01"},
-	    {"MP_A_M_M_MOONSHINEMAKERS_01"_J, "MP_A_M_M_MOONSHINEMAKERS_01"},
-	    {"MP_ASN_BENEDICTPOINT_FEMALES_01"_J, "MP_ASN_BENEDICTPOINT_FEMALES_01"},
-	    {"MP_ASN_BENEDICTPOINT_MALES_01"_J, "MP_ASN_BENEDICTPOINT_MALES_01"},
-	    {"MP_ASN_BLACKWATER_MALES_01"_J, "MP_ASN_BLACKWATER_MALES_01"},
-	    {"MP_ASN_BRAITHWAITEMANOR_MALES_01"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_01"},
-	    {"MP_ASN_BRAITHWAITEMANOR_MALES_02"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_02"},
-	    {"MP_ASN_BRAITHWAITEMANOR_MALES_03"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_03"},
-	    {"MP_ASN_CIVILWARFORT_MALES_01"_J, "MP_ASN_CIVILWARFORT_MALES_01"},
-	    {"MP_ASN_GAPTOOTHBREACH_MALES_01"_J, "MP_ASN_GAPTOOTHBREACH_MALES_01"},
-	    {"MP_ASN_PikesBasin_Males_01"_J, "MP_ASN_PikesBasin_Males_01"},
-	    {"MP_ASN_SDPOLICESTATION_MALES_01"_J, "MP_ASN_SDPOLICESTATION_MALES_01"},
-	    {"MP_ASN_SDWEDDING_FEMALES_01"_J, "MP_ASN_SDWEDDING_FEMALES_01"},
-	    {"MP_ASN_SHADYBELLE_FEMALES_01"_J, "MP_ASN_SHADYBELLE_FEMALES_01"},
-	    {"MP_ASN_STILLWATER_MALES_01"_J, "MP_ASN_STILLWATER_MALES_01"},
-	    {"MP_ASNTRK_TALLTREES_MALES_01"_J, "MP_ASNTRK_TALLTREES_MALES_01"},
-	    {"MP_CAMPDEF_BLUEWATER_MALES_01"_J, "MP_CAMPDEF_BLUEWATER_MALES_01"},
-	    {"MP_CAMPDEF_CHOLLASPRINGS_MALES_01"_J, "MP_CAMPDEF_CHOLLASPRINGS_MALES_01"},
-	    {"MP_CAMPDEF_EASTNEWHANOVER_FEMALES_01"_J, "MP_CAMPDEF_EASTNEWHANOVER_FEMALES_01"},
-	    {"mp_female"_J, "mp_female"},
-	    {"MP_FM_BOUNTYTARGET_FEMALES_DLC008_01"_J, "MP_FM_BOUNTYTARGET_FEMALES_DLC008_01"},
-	    {"MP_FM_BOUNTYTARGET_MALES_DLC008_01"_J, "MP_FM_BOUNTYTARGET_MALES_DLC008_01"},
-	    {"MP_G_F_M_ARMYOFFEAR_01"_J, "MP_G_F_M_ARMYOFFEAR_01"},
-	    {"MP_G_F_M_CULTGUARDS_01"_J, "MP_G_F_M_CULTGUARDS_01"},
-	    {"MP_G_F_M_CULTMEMBERS_01"_J, "MP_G_F_M_CULTMEMBERS_01"},
-	    {"MP_G_M_M_ARMYOFFEAR_01"_J, "MP_G_M_M_ARMYOFFEAR_01"},
-	    {"MP_G_M_M_ArmyOfFear_01"_J, "MP_G_M_M_ArmyOfFear_01"},
-	    {"MP_G_M_M_CULTGUARDS_01"_J, "MP_G_M_M_CULTGUARDS_01"},
-	    {"MP_G_M_M_CULTMEMBERS_01"_J, "MP_G_M_M_CULTMEMBERS_01"},
-	    {"MP_G_M_M_UNICRIMINALS_03"_J, "MP_G_M_M_UNICRIMINALS_03"},
-	    {"MP_G_M_M_UNICRIMINALS_04"_J, "MP_G_M_M_UNICRIMINALS_04"},
-	    {"MP_G_M_M_UNICRIMINALS_05"_J, "MP_G_M_M_UNICRIMINALS_05"},
-	    {"MP_G_M_M_UNICRIMINALS_06"_J, "MP_G_M_M_UNICRIMINALS_06"},
-	    {"MP_G_M_M_UNICRIMINALS_07"_J, "MP_G_M_M_UNICRIMINALS_07"},
-	    {"MP_G_M_M_UNICRIMINALS_08"_J, "MP_G_M_M_UNICRIMINALS_08"},
-	    {"MP_G_M_M_UNICRIMINALS_09"_J, "MP_G_M_M_UNICRIMINALS_09"},
-	    {"mp_male"_J, "mp_male"},
-	    {"MP_PREDATOR"_J, "MP_PREDATOR"},
-	    {"MP_S_M_M_REVENUEAGENTS_01"_J, "MP_S_M_M_REVENUEAGENTS_01"},
-	    {"MP_U_F_M_CULTPRIEST_01"_J, "MP_U_F_M_CULTPRIEST_01"},
-	    {"MP_U_F_M_LEGENDARYBOUNTY_03"_J, "MP_U_F_M_LEGENDARYBOUNTY_03"},
-	    {"MP_U_M_M_ANIMALPOACHER_01"_J, "MP_U_M_M_ANIMALPOACHER_01"},
-	    {"MP_U_M_M_ANIMALPOACHER_02"_J, "MP_U_M_M_ANIMALPOACHER_02"},
-	    {"MP_U_M_M_ANIMALPOACHER_06"_J, "MP_U_M_M_ANIMALPOACHER_06"},
-	    {"MP_U_M_M_CULTPRIEST_01"_J, "MP_U_M_M_CULTPRIEST_01"},
-	    {"MP_U_M_M_LBT_Owlhootvictim_01"_J, "MP_U_M_M_LBT_Owlhootvictim_01"},
-	    {"MP_U_M_M_LBT_Philipsvictim_01"_J, "MP_U_M_M_LBT_Philipsvictim_01"},
-	    {"MP_U_M_M_LEGENDARYBOUNTY_08"_J, "MP_U_M_M_LEGENDARYBOUNTY_08"},
-	    {"MP_U_M_M_SALOONBRAWLERS_01"_J, "MP_U_M_M_SALOONBRAWLERS_01"},
-	    {"MP_U_M_M_SALOONBRAWLERS_02"_J, "MP_U_M_M_SALOONBRAWLERS_02"},
-	    {"MP_U_M_M_SALOONBRAWLERS_03"_J, "MP_U_M_M_SALOONBRAWLERS_03"},
-	    {"MP_U_M_M_SALOONBRAWLERS_04"_J, "MP_U_M_M_SALOONBRAWLERS_04"},
-	    {"MP_U_M_M_SALOONBRAWLERS_05"_J, "MP_U_M_M_SALOONBRAWLERS_05"},
-	    {"MP_U_M_M_SALOONBRAWLERS_06"_J, "MP_U_M_M_SALOONBRAWLERS_06"},
-	    {"MP_U_M_M_SALOONBRAWLERS_07"_J, "MP_U_M_M_SALOONBRAWLERS_07"},
-	    {"MP_U_M_M_SALOONBRAWLERS_08"_J, "MP_U_M_M_SALOONBRAWLERS_08"},
-	    {"MP_U_M_M_SALOONBRAWLERS_09"_J, "MP_U_M_M_SALOONBRAWLERS_09"},
-	    {"MP_U_M_M_SALOONBRAWLERS_10"_J, "MP_U_M_M_SALOONBRAWLERS_10"},
-	    {"MP_U_M_M_SALOONBRAWLERS_11"_J, "MP_U_M_M_SALOONBRAWLERS_11"},
-	    {"MP_U_M_M_SALOONBRAWLERS_12"_J, "MP_U_M_M_SALOONBRAWLERS_12"},
-	    {"MP_U_M_M_SALOONBRAWLERS_13"_J, "MP_U_M_M_SALOONBRAWLERS_13"},
-	    {"MP_U_M_M_SALOONBRAWLERS_14"_J, "MP_U_M_M_SALOONBRAWLERS_14"},
-	    {"MSP_BOUNTYHUNTER1_FEMALES_01"_J, "MSP_BOUNTYHUNTER1_FEMALES_01"},
-	    {"MSP_BRAITHWAITES1_MALES_01"_J, "MSP_BRAITHWAITES1_MALES_01"},
-	    {"MSP_FEUD1_MALES_01"_J, "MSP_FEUD1_MALES_01"},
-	    {"MSP_FUSSAR2_MALES_01"_J, "MSP_FUSSAR2_MALES_01"},
-	    {"MSP_GANG2_MALES_01"_J, "MSP_GANG2_MALES_01"},
-	    {"MSP_GANG3_MALES_01"_J, "MSP_GANG3_MALES_01"},
-	    {"MSP_GRAYS1_MALES_01"_J, "MSP_GRAYS1_MALES_01"},
-	    {"MSP_GRAYS2_MALES_01"_J, "MSP_GRAYS2_MALES_01"},
-	    {"MSP_GUARMA2_MALES_01"_J, "MSP_GUARMA2_MALES_01"},
-	    {"MSP_INDUSTRY1_FEMALES_01"_J, "MSP_INDUSTRY1_FEMALES_01"},
-	    {"MSP_INDUSTRY1_MALES_01"_J, "MSP_INDUSTRY1_MALES_01"},
-	    {"MSP_INDUSTRY3_FEMALES_01"_J, "MSP_INDUSTRY3_FEMALES_01"},
-	    {"MSP_INDUSTRY3_MALES_01"_J, "MSP_INDUSTRY3_MALES_01"},
-	    {"MSP_MARY1_FEMALES_01"_J, "MSP_MARY1_FEMALES_01"},
-	    {"MSP_MARY1_MALES_01"_J, "MSP_MARY1_MALES_01"},
-	    {"MSP_MARY3_MALES_01"_J, "MSP_MARY3_MALES_01"},
-	    {"MSP_MOB0_MALES_01"_J, "MSP_MOB0_MALES_01"},
-	    {"MSP_MOB1_FEMALES_01"_J, "MSP_MOB1_FEMALES_01"},
-	    {"MSP_MOB1_MALES_01"_J, "MSP_MOB1_MALES_01"},
-	    {"MSP_MOB1_TEENS_01"_J, "MSP_MOB1_TEENS_01"},
-	    {"msp_mob3_FEMALES_01"_J, "msp_mob3_FEMALES_01"},
-	    {"msp_mob3_MALES_01"_J, "msp_mob3_MALES_01"},
-	    {"MSP_MUDTOWN3_MALES_01"_J, "MSP_MUDTOWN3_MALES_01"},
-	    {"MSP_Mudtown3B_Females_01"_J, "MSP_Mudtown3B_Females_01"},
-	    {"MSP_Mudtown3B_Males_01"_J, "MSP_Mudtown3B_Males_01"},
-	    {"MSP_MUDTOWN5_MALES_01"_J, "MSP_MUDTOWN5_MALES_01"},
-	    {"MSP_NATIVE1_MALES_01"_J, "MSP_NATIVE1_MALES_01"},
-	    {"MSP_REVEREND1_MALES_01"_J, "MSP_REVEREND1_MALES_01"},
-	    {"MSP_SAINTDENIS1_FEMALES_01"_J, "MSP_SAINTDENIS1_FEMALES_01"},
-	    {"MSP_SAINTDENIS1_MALES_01"_J, "MSP_SAINTDENIS1_MALES_01"},
-	    {"MSP_SALOON1_FEMALES_01"_J, "MSP_SALOON1_FEMALES_01"},
-	    {"MSP_SALOON1_MALES_01"_J, "MSP_SALOON1_MALES_01"},
-	    {"MSP_SMUGGLER2_MALES_01"_J, "MSP_SMUGGLER2_MALES_01"},
-	    {"MSP_TRAINROBBERY2_MALES_01"_J, "MSP_TRAINROBBERY2_MALES_01"},
-	    {"MSP_TRELAWNY1_MALES_01"_J, "MSP_TRELAWNY1_MALES_01"},
-	    {"MSP_UTOPIA1_MALES_01"_J, "MSP_UTOPIA1_MALES_01"},
-	    {"MSP_WINTER4_MALES_01"_J, "MSP_WINTER4_MALES_01"},
-	    {"P_U_M_M_ANIMALPOACHER_03"_J, "P_U_M_M_ANIMALPOACHER_03"},
-	    {"Player_Three"_J, "Player_Three"},
-	    {"Player_Zero"_J, "Player_Zero"},
-	    {"Ps4"_J, "Ps4"},
+	    {"A_M_M_BlWForeman_01"_J, "A_M_M_BlWForeman_01"},
+	    {"A_C_FishChannelCatfish_01_lg"_J, "A_C_FishChannelCatfish_01_lg"},
+	    {"A_M_Y_AsbMiner_02"_J, "A_M_Y_AsbMiner_02"},
+	    {"A_C_Horse_Breton_Sealbrown"_J, "A_C_Horse_Breton_Sealbrown"},
 	    {"RCES_ABIGAIL3_FEMALES_01"_J, "RCES_ABIGAIL3_FEMALES_01"},
-	    {"RCES_ABIGAIL3_MALES_01"_J, "RCES_ABIGAIL3_MALES_01"},
-	    {"RCES_BEECHERS1_MALES_01"_J, "RCES_BEECHERS1_MALES_01"},
-	    {"RCES_EVELYNMILLER_MALES_01"_J, "RCES_EVELYNMILLER_MALES_01"},
-	    {"RCSP_BEAUANDPENELOPE_MALES_01"_J, "RCSP_BEAUANDPENELOPE_MALES_01"},
-	    {"RCSP_BEAUANDPENELOPE1_FEMALES_01"_J, "RCSP_BEAUANDPENELOPE1_FEMALES_01"},
-	    {"RCSP_CALDERON_MALES_01"_J, "RCSP_CALDERON_MALES_01"},
-	    {"RCSP_CALDERONSTAGE2_MALES_01"_J, "RCSP_CALDERONSTAGE2_MALES_01"},
-	    {"RCSP_CALDERONSTAGE2_TEENS_01"_J, "RCSP_CALDERONSTAGE2_TEENS_01"},
-	    {"RCSP_CALLOWAY_MALES_01"_J, "RCSP_CALLOWAY_MALES_01"},
-	    {"RCSP_COACHROBBERY_MALES_01"_J, "RCSP_COACHROBBERY_MALES_01"},
-	    {"RCSP_CRACKPOT_FEMALES_01"_J, "RCSP_CRACKPOT_FEMALES_01"},
-	    {"RCSP_CRACKPOT_MALES_01"_J, "RCSP_CRACKPOT_MALES_01"},
-	    {"RCSP_CREOLE_MALES_01"_J, "RCSP_CREOLE_MALES_01"},
-	    {"RCSP_DUTCH1_MALES_01"_J, "RCSP_DUTCH1_MALES_01"},
-	    {"RCSP_DUTCH3_MALES_01"_J, "RCSP_DUTCH3_MALES_01"},
-	    {"RCSP_EDITHDOWNES2_MALES_01"_J, "RCSP_EDITHDOWNES2_MALES_01"},
-	    {"RCSP_FORMYART_FEMALES_01"_J, "RCSP_FORMYART_FEMALES_01"},
-	    {"RCSP_FORMYART_MALES_01"_J, "RCSP_FORMYART_MALES_01"},
-	    {"RCSP_GUNSLINGERDUEL4_MALES_01"_J, "RCSP_GUNSLINGERDUEL4_MALES_01"},
-	    {"RCSP_HEREKITTYKITTY_MALES_0"_J, "RCSP_HEREKITTYKITTY_MALES_0"},
-	    {"RCSP_HUNTING1_MALES_01"_J, "RCSP_HUNTING1_MALES_01"},
-	    {"RCSP_MRMAYOR_MALES_01"_J, "RCSP_MRMAYOR_MALES_01"},
-	    {"RCSP_NATIVE_AMERICANFATHERS_MALES_01"_J, "RCSP_NATIVE_AMERICANFATHERS_MALES_01"},
-	    {"RCSP_NATIVE1S2_MALES_01"_J, "RCSP_NATIVE1S2_MALES_01"},
-	    {"RCSP_ODDFELLOWS_MALES_01"_J, "RCSP_ODDFELLOWS_MALES_01"},
-	    {"RCSP_ODRISCOLLS2_FEMALES_01"_J, "RCSP_ODRISCOLLS2_FEMALES_01"},
-	    {"RCSP_POISONEDWELL_FEMALES_01"_J, "RCSP_POISONEDWELL_FEMALES_01"},
-	    {"RCSP_POISONEDWELL_MALES_01"_J, "RCSP_POISONEDWELL_MALES_01"},
-	    {"RCSP_POISONEDWELL_TEENS_01"_J, "RCSP_POISONEDWELL_TEENS_01"},
-	    {"RCSP_RIDETHELIGHTNING_FEMALES_01"_J, "RCSP_RIDETHELIGHTNING_FEMALES_01"},
-	    {"RCSP_RIDETHELIGHTNING_MALES_01"_J, "RCSP_RIDETHELIGHTNING_MALES_01"},
-	    {"RCSP_SADIE1_MALES_01"_J, "RCSP_SADIE1_MALES_01"},
-	    {"RCSP_SLAVECATCHER_MALES_01"_J, "RCSP_SLAVECATCHER_MALES_01"},
-	    {"RE_ANIMALATTACK_FEMALES_01"_J, "RE_ANIMALATTACK_FEMALES_01"},
-	    {"RE_ANIMALATTACK_MALES_01"_J, "RE_ANIMALATTACK_MALES_01"},
-	    {"RE_ANIMALMAULING_MALES_01"_J, "RE_ANIMALMAULING_MALES_01"},
-	    {"RE_APPROACH_MALES_01"_J, "RE_APPROACH_MALES_01"},
+	    {"U_M_M_SDPoliceChief_01"_J, "U_M_M_SDPoliceChief_01"},
 	    {"RE_BEARTRAP_MALES_01"_J, "RE_BEARTRAP_MALES_01"},
-	    {"RE_BOATATTACK_MALES_01"_J, "RE_BOATATTACK_MALES_01"},
-	    {"RE_BURNINGBODIES_MALES_01"_J, "RE_BURNINGBODIES_MALES_01"},
-	    {"RE_CHECKPOINT_MALES_01"_J, "RE_CHECKPOINT_MALES_01"},
-	    {"RE_COACHROBBERY_FEMALES_01"_J, "RE_COACHROBBERY_FEMALES_01"},
-	    {"RE_COACHROBBERY_MALES_01"_J, "RE_COACHROBBERY_MALES_01"},
-	    {"RE_CONSEQUENCE_MALES_01"_J, "RE_CONSEQUENCE_MALES_01"},
-	    {"RE_CORPSECART_FEMALES_01"_J, "RE_CORPSECART_FEMALES_01"},
-	    {"RE_CORPSECART_MALES_01"_J, "RE_CORPSECART_MALES_01"},
-	    {"RE_CRASHEDWAGON_MALES_01"_J, "RE_CRASHEDWAGON_MALES_01"},
-	    {"RE_DARKALLEYAMBUSH_MALES_01"_J, "RE_DARKALLEYAMBUSH_MALES_01"},
-	    {"RE_DARKALLEYBUM_MALES_01"_J, "RE_DARKALLEYBUM_MALES_01"},
-	    {"RE_DARKALLEYSTABBING_MALES_01"_J, "RE_DARKALLEYSTABBING_MALES_01"},
-	    {"RE_DEADBODIES_MALES_01"_J, "RE_DEADBODIES_MALES_01"},
-	    {"RE_DEADJOHN_FEMALES_01"_J, "RE_DEADJOHN_FEMALES_01"},
-	    {"RE_DEADJOHN_MALES_01"_J, "RE_DEADJOHN_MALES_01"},
-	    {"RE_DISABLEDBEGGAR_MALES_01"_J, "RE_DISABLEDBEGGAR_MALES_01"},
-	    {"RE_DOMESTICDISPUTE_FEMALES_01"_J, "RE_DOMESTICDISPUTE_FEMALES_01"},
-	    {"RE_DOMESTICDISPUTE_MALES_01"_J, "RE_DOMESTICDISPUTE_MALES_01"},
-	    {"RE_DROWNMURDER_FEMALES_01"_J, "RE_DROWNMURDER_FEMALES_01"},
-	    {"RE_DROWNMURDER_MALES_01"_J, "RE_DROWNMURDER_MALES_01"},
-	    {"RE_DRUNKCAMP_MALES_01"_J, "RE_DRUNKCAMP_MALES_01"},
-	    {"RE_DRUNKDUELER_MALES_01"_J, "RE_DRUNKDUELER_MALES_01"},
-	    {"RE_DUELBOASTER_MALES_01"_J, "RE_DUELBOASTER_MALES_01"},
-	    {"RE_DUELWINNER_FEMALES_01"_J, "RE_DUELWINNER_FEMALES_01"},
-	    {"RE_DUELWINNER_MALES_01"_J, "RE_DUELWINNER_MALES_01"},
-	    {"RE_ESCORT_FEMALES_01"_J, "RE_ESCORT_FEMALES_01"},
-	    {"RE_EXECUTIONS_MALES_01"_J, "RE_EXECUTIONS_MALES_01"},
-	    {"RE_FLEEINGFAMILY_FEMALES_01"_J, "RE_FLEEINGFAMILY_FEMALES_01"},
-	    {"RE_FLEEINGFAMILY_MALES_01"_J, "RE_FLEEINGFAMILY_MALES_01"},
-	    {"RE_FOOTROBBERY_MALES_01"_J, "RE_FOOTROBBERY_MALES_01"},
-	    {"RE_FRIENDLYOUTDOORSMAN_MALES_01"_J, "RE_FRIENDLYOUTDOORSMAN_MALES_01"},
-	    {"RE_FROZENTODEATH_FEMALES_01"_J, "RE_FROZENTODEATH_FEMALES_01"},
-	    {"RE_FROZENTODEATH_MALES_01"_J, "RE_FROZENTODEATH_MALES_01"},
-	    {"RE_FUNDRAISER_FEMALES_01"_J, "RE_FUNDRAISER_FEMALES_01"},
-	    {"RE_FUSSARCHASE_MALES_01"_J, "RE_FUSSARCHASE_MALES_01"},
-	    {"RE_GOLDPANNER_MALES_01"_J, "RE_GOLDPANNER_MALES_01"},
-	    {"RE_HORSERACE_FEMALES_01"_J, "RE_HORSERACE_FEMALES_01"},
-	    {"RE_HORSERACE_MALES_01"_J, "RE_HORSERACE_MALES_01"},
+	    {"A_C_Buffalo_01"_J, "A_C_Buffalo_01"},
 	    {"RE_HOSTAGERESCUE_FEMALES_01"_J, "RE_HOSTAGERESCUE_FEMALES_01"},
+	    {"S_M_M_NBXRIVERBOATDEALERS_01"_J, "S_M_M_NBXRIVERBOATDEALERS_01"},
+	    {"A_C_Horse_Arabian_WarpedBrindle_PC"_J, "A_C_Horse_Arabian_WarpedBrindle_PC"},
+	    {"MP_G_M_M_UNICRIMINALS_09"_J, "MP_G_M_M_UNICRIMINALS_09"},
+	    {"U_M_M_UniPeepingTom_01"_J, "U_M_M_UniPeepingTom_01"},
+	    {"U_M_M_CHELONIANJUMPER_04"_J, "U_M_M_CHELONIANJUMPER_04"},
+	    {"A_C_BlueJay_01"_J, "A_C_BlueJay_01"},
+	    {"A_F_M_BlWTownfolk_02"_J, "A_F_M_BlWTownfolk_02"},
+	    {"U_M_M_WAPOFFICIAL_01"_J, "U_M_M_WAPOFFICIAL_01"},
+	    {"A_C_DogRufus_01"_J, "A_C_DogRufus_01"},
+	    {"A_C_Horse_DutchWarmblood_SootyBuckskin"_J, "A_C_Horse_DutchWarmblood_SootyBuckskin"},
+	    {"MBH_RHODESRANCHER_TEENS_01"_J, "MBH_RHODESRANCHER_TEENS_01"},
+	    {"CS_cattlerustler"_J, "CS_cattlerustler"},
+	    {"U_F_M_CIRCUSWAGON_01"_J, "U_F_M_CIRCUSWAGON_01"},
+	    {"CS_Magnifico"_J, "CS_Magnifico"},
+	    {"A_C_HORSE_MISSOURIFOXTROTTER_DAPPLEGREY"_J, "A_C_HORSE_MISSOURIFOXTROTTER_DAPPLEGREY"},
+	    {"CS_ARTAPPRAISER"_J, "CS_ARTAPPRAISER"},
+	    {"U_M_M_UNIONLEADER_01"_J, "U_M_M_UNIONLEADER_01"},
+	    {"A_M_M_RHDObeseMen_01"_J, "A_M_M_RHDObeseMen_01"},
+	    {"CS_revswanson"_J, "CS_revswanson"},
+	    {"U_M_M_BHT_MINEFOREMAN"_J, "U_M_M_BHT_MINEFOREMAN"},
+	    {"MP_ASNTRK_TALLTREES_MALES_01"_J, "MP_ASNTRK_TALLTREES_MALES_01"},
+	    {"A_M_M_BiVFancyDRIVERS_01"_J, "A_M_M_BiVFancyDRIVERS_01"},
+	    {"CS_forgivenhusband_01"_J, "CS_forgivenhusband_01"},
+	    {"A_C_HORSE_MUSTANG_BUCKSKIN"_J, "A_C_HORSE_MUSTANG_BUCKSKIN"},
+	    {"CS_ODProstitute"_J, "CS_ODProstitute"},
+	    {"U_M_M_BHT_OUTLAWMAULED"_J, "U_M_M_BHT_OUTLAWMAULED"},
+	    {"U_M_M_STORY_TUMBLEWEED_01"_J, "U_M_M_STORY_TUMBLEWEED_01"},
+	    {"A_C_Panther_01"_J, "A_C_Panther_01"},
+	    {"RE_COACHROBBERY_FEMALES_01"_J, "RE_COACHROBBERY_FEMALES_01"},
+	    {"U_M_M_SHACKSERIALKILLER_01"_J, "U_M_M_SHACKSERIALKILLER_01"},
+	    {"CS_MRS_SINCLAIR"_J, "CS_MRS_SINCLAIR"},
+	    {"RE_ANIMALATTACK_MALES_01"_J, "RE_ANIMALATTACK_MALES_01"},
+	    {"A_C_DogHusky_01"_J, "A_C_DogHusky_01"},
+	    {"RCSP_RIDETHELIGHTNING_MALES_01"_J, "RCSP_RIDETHELIGHTNING_MALES_01"},
+	    {"U_M_M_RIODONKEYRIDER_01"_J, "U_M_M_RIODONKEYRIDER_01"},
+	    {"A_M_M_VALDEPUTYRESIDENT_01"_J, "A_M_M_VALDEPUTYRESIDENT_01"},
+	    {"RE_SAVAGEWARNING_MALES_01"_J, "RE_SAVAGEWARNING_MALES_01"},
+	    {"CS_susangrimshaw"_J, "CS_susangrimshaw"},
+	    {"A_C_Horse_KentuckySaddle_SilverBay"_J, "A_C_Horse_KentuckySaddle_SilverBay"},
+	    {"CS_ReverendFortheringham"_J, "CS_ReverendFortheringham"},
+	    {"A_C_Horse_Turkoman_Gold"_J, "A_C_Horse_Turkoman_Gold"},
+	    {"A_C_FishSalmonSockeye_01_ml"_J, "A_C_FishSalmonSockeye_01_ml"},
+	    {"A_C_Horse_HungarianHalfbred_FlaxenChestnut"_J, "A_C_Horse_HungarianHalfbred_FlaxenChestnut"},
+	    {"CS_DaveyCallender"_J, "CS_DaveyCallender"},
+	    {"U_M_M_story_HUNTER_01"_J, "U_M_M_story_HUNTER_01"},
+	    {"CS_MP_MOONSHINER"_J, "CS_MP_MOONSHINER"},
 	    {"RE_HOSTAGERESCUE_MALES_01"_J, "RE_HOSTAGERESCUE_MALES_01"},
-	    {"RE_INBREDKIDNAP_FEMALES_01"_J, "RE_INBREDKIDNAP_FEMALES_01"},
-	    {"RE_INBREDKIDNAP_MALES_01"_J, "RE_INBREDKIDNAP_MALES_01"},
+	    {"S_M_M_STRDEALER_01"_J, "S_M_M_STRDEALER_01"},
+	    {"U_M_M_NbxMusician_01"_J, "U_M_M_NbxMusician_01"},
 	    {"RE_INJUREDRIDER_MALES_01"_J, "RE_INJUREDRIDER_MALES_01"},
-	    {"RE_KIDNAPPEDVICTIM_FEMALES_01"_J, "RE_KIDNAPPEDVICTIM_FEMALES_01"},
-	    {"RE_LARAMIEGANGRUSTLING_MALES_01"_J, "RE_LARAMIEGANGRUSTLING_MALES_01"},
-	    {"RE_LONEPRISONER_MALES_01"_J, "RE_LONEPRISONER_MALES_01"},
-	    {"RE_LOSTDOG_DOGS_01"_J, "RE_LOSTDOG_DOGS_01"},
-	    {"RE_LOSTDOG_TEENS_01"_J, "RE_LOSTDOG_TEENS_01"},
-	    {"RE_LOSTDRUNK_FEMALES_01"_J, "RE_LOSTDRUNK_FEMALES_01"},
-	    {"RE_LOSTDRUNK_MALES_01"_J, "RE_LOSTDRUNK_MALES_01"},
-	    {"RE_LOSTFRIEND_MALES_01"_J, "RE_LOSTFRIEND_MALES_01"},
-	    {"RE_LOSTMAN_MALES_01"_J, "RE_LOSTMAN_MALES_01"},
-	    {"RE_MOONSHINECAMP_MALES_01"_J, "RE_MOONSHINECAMP_MALES_01"},
-	    {"RE_MURDERCAMP_MALES_01"_J, "RE_MURDERCAMP_MALES_01"},
-	    {"RE_MURDERSUICIDE_FEMALES_01"_J, "RE_MURDERSUICIDE_FEMALES_01"},
-	    {"RE_MURDERSUICIDE_MALES_01"_J, "RE_MURDERSUICIDE_MALES_01"},
-	    {"RE_NAKEDSWIMMER_MALES_01"_J, "RE_NAKEDSWIMMER_MALES_01"},
-	    {"RE_ONTHERUN_MALES_01"_J, "RE_ONTHERUN_MALES_01"},
-	    {"RE_OUTLAWLOOTER_MALES_01"_J, "RE_OUTLAWLOOTER_MALES_01"},
-	    {"RE_PARLORAMBUSH_MALES_01"_J, "RE_PARLORAMBUSH_MALES_01"},
-	    {"RE_PEEPINGTOM_FEMALES_01"_J, "RE_PEEPINGTOM_FEMALES_01"},
-	    {"RE_PEEPINGTOM_MALES_01"_J, "RE_PEEPINGTOM_MALES_01"},
-	    {"RE_PICKPOCKET_MALES_01"_J, "RE_PICKPOCKET_MALES_01"},
-	    {"RE_PISSPOT_FEMALES_01"_J, "RE_PISSPOT_FEMALES_01"},
-	    {"RE_PISSPOT_MALES_01"_J, "RE_PISSPOT_MALES_01"},
-	    {"RE_PLAYERCAMPSTRANGERS_FEMALES_01"_J, "RE_PLAYERCAMPSTRANGERS_FEMALES_01"},
-	    {"RE_PLAYERCAMPSTRANGERS_MALES_01"_J, "RE_PLAYERCAMPSTRANGERS_MALES_01"},
-	    {"RE_POISONED_MALES_01"_J, "RE_POISONED_MALES_01"},
-	    {"RE_POLICECHASE_MALES_01"_J, "RE_POLICECHASE_MALES_01"},
-	    {"RE_PRISONWAGON_FEMALES_01"_J, "RE_PRISONWAGON_FEMALES_01"},
-	    {"RE_PRISONWAGON_MALES_01"_J, "RE_PRISONWAGON_MALES_01"},
-	    {"RE_PUBLICHANGING_FEMALES_01"_J, "RE_PUBLICHANGING_FEMALES_01"},
+	    {"CS_DESMOND"_J, "CS_DESMOND"},
+	    {"U_M_M_BHT_STRAWBERRYDUEL"_J, "U_M_M_BHT_STRAWBERRYDUEL"},
+	    {"RE_FOOTROBBERY_MALES_01"_J, "RE_FOOTROBBERY_MALES_01"},
+	    {"U_M_M_TUMTRAINSTATIONWORKER_01"_J, "U_M_M_TUMTRAINSTATIONWORKER_01"},
+	    {"U_M_M_CAJHOMESTEAD_01"_J, "U_M_M_CAJHOMESTEAD_01"},
+	    {"U_M_M_CircusWagon_01"_J, "U_M_M_CircusWagon_01"},
+	    {"U_M_M_GalaStringQuartet_04"_J, "U_M_M_GalaStringQuartet_04"},
+	    {"CS_SD_STREETKID_01A"_J, "CS_SD_STREETKID_01A"},
+	    {"U_M_O_BlWPoliceChief_01"_J, "U_M_O_BlWPoliceChief_01"},
+	    {"A_C_CarolinaParakeet_01"_J, "A_C_CarolinaParakeet_01"},
 	    {"RE_PUBLICHANGING_MALES_01"_J, "RE_PUBLICHANGING_MALES_01"},
-	    {"RE_PUBLICHANGING_TEENS_01"_J, "RE_PUBLICHANGING_TEENS_01"},
-	    {"RE_RALLY_MALES_01"_J, "RE_RALLY_MALES_01"},
-	    {"RE_RALLYDISPUTE_MALES_01"_J, "RE_RALLYDISPUTE_MALES_01"},
-	    {"RE_RALLYSETUP_MALES_01"_J, "RE_RALLYSETUP_MALES_01"},
-	    {"RE_RATINFESTATION_MALES_01"_J, "RE_RATINFESTATION_MALES_01"},
-	    {"RE_ROWDYDRUNKS_MALES_01"_J, "RE_ROWDYDRUNKS_MALES_01"},
-	    {"RE_SAVAGEAFTERMATH_FEMALES_01"_J, "RE_SAVAGEAFTERMATH_FEMALES_01"},
-	    {"RE_SAVAGEAFTERMATH_MALES_01"_J, "RE_SAVAGEAFTERMATH_MALES_01"},
-	    {"RE_SAVAGEFIGHT_FEMALES_01"_J, "RE_SAVAGEFIGHT_FEMALES_01"},
-	    {"RE_SAVAGEFIGHT_MALES_01"_J, "RE_SAVAGEFIGHT_MALES_01"},
-	    {"RE_SAVAGEWAGON_FEMALES_01"_J, "RE_SAVAGEWAGON_FEMALES_01"},
-	    {"RE_SAVAGEWAGON_MALES_01"_J, "RE_SAVAGEWAGON_MALES_01"},
-	    {"RE_SAVAGEWARNING_MALES_01"_J, "RE_SAVAGEWARNING_MALES_01"},
+	    {"A_M_M_RhdTownfolk_02"_J, "A_M_M_RhdTownfolk_02"},
+	    {"A_C_Javelina_01"_J, "A_C_Javelina_01"},
+	    {"A_M_M_AsbMiner_01"_J, "A_M_M_AsbMiner_01"},
+	    {"A_C_Pronghorn_01"_J, "A_C_Pronghorn_01"},
+	    {"A_F_M_BlWTownfolk_01"_J, "A_F_M_BlWTownfolk_01"},
+	    {"U_M_M_lnsoutlaw_03"_J, "U_M_M_lnsoutlaw_03"},
+	    {"A_C_Horse_Gang_Uncle"_J, "A_C_Horse_Gang_Uncle"},
+	    {"U_M_M_ValBearTrap_01"_J, "U_M_M_ValBearTrap_01"},
+	    {"U_M_M_CRDHOMESTEADTENANT_02"_J, "U_M_M_CRDHOMESTEADTENANT_02"},
+	    {"CS_WATSON_01"_J, "CS_WATSON_01"},
+	    {"U_M_O_BlWGeneralStoreOwner_01"_J, "U_M_O_BlWGeneralStoreOwner_01"},
 	    {"RE_SHARPSHOOTER_MALES_01"_J, "RE_SHARPSHOOTER_MALES_01"},
-	    {"RE_SHOWOFF_MALES_01"_J, "RE_SHOWOFF_MALES_01"},
-	    {"RE_SKIPPINGSTONES_MALES_01"_J, "RE_SKIPPINGSTONES_MALES_01"},
-	    {"RE_SKIPPINGSTONES_TEENS_01"_J, "RE_SKIPPINGSTONES_TEENS_01"},
-	    {"RE_SLUMAMBUSH_FEMALES_01"_J, "RE_SLUMAMBUSH_FEMALES_01"},
-	    {"RE_SNAKEBITE_MALES_01"_J, "RE_SNAKEBITE_MALES_01"},
-	    {"RE_STALKINGHUNTER_MALES_01"_J, "RE_STALKINGHUNTER_MALES_01"},
-	    {"RE_STRANDEDRIDER_MALES_01"_J, "RE_STRANDEDRIDER_MALES_01"},
-	    {"RE_STREET_FIGHT_MALES_01"_J, "RE_STREET_FIGHT_MALES_01"},
-	    {"RE_TAUNTING_01"_J, "RE_TAUNTING_01"},
+	    {"A_F_M_SclFancyTravellers_01"_J, "A_F_M_SclFancyTravellers_01"},
+	    {"A_C_Donkey_01"_J, "A_C_Donkey_01"},
+	    {"A_F_M_AsbTownfolk_01"_J, "A_F_M_AsbTownfolk_01"},
+	    {"RE_DOMESTICDISPUTE_MALES_01"_J, "RE_DOMESTICDISPUTE_MALES_01"},
+	    {"RCSP_CALDERONSTAGE2_MALES_01"_J, "RCSP_CALDERONSTAGE2_MALES_01"},
+	    {"S_M_M_ORPGUARD_01"_J, "S_M_M_ORPGUARD_01"},
+	    {"RE_VOICE_FEMALES_01"_J, "RE_VOICE_FEMALES_01"},
+	    {"A_C_Cardinal_01"_J, "A_C_Cardinal_01"},
+	    {"CS_adamgray"_J, "CS_adamgray"},
+	    {"A_C_Horse_AmericanPaint_SplashedWhite"_J, "A_C_Horse_AmericanPaint_SplashedWhite"},
+	    {"A_C_Horse_Gang_Charles_EndlessSummer"_J, "A_C_Horse_Gang_Charles_EndlessSummer"},
+	    {"CS_MP_JESSICA"_J, "CS_MP_JESSICA"},
 	    {"RE_TAUNTING_MALES_01"_J, "RE_TAUNTING_MALES_01"},
-	    {"RE_TORTURINGCAPTIVE_MALES_01"_J, "RE_TORTURINGCAPTIVE_MALES_01"},
-	    {"RE_TOWNBURIAL_MALES_01"_J, "RE_TOWNBURIAL_MALES_01"},
+	    {"RE_MURDERSUICIDE_FEMALES_01"_J, "RE_MURDERSUICIDE_FEMALES_01"},
+	    {"U_M_M_NbxResident_01"_J, "U_M_M_NbxResident_01"},
+	    {"CS_VALDEPUTY_01"_J, "CS_VALDEPUTY_01"},
+	    {"CS_jimcalloway"_J, "CS_jimcalloway"},
 	    {"RE_TOWNCONFRONTATION_FEMALES_01"_J, "RE_TOWNCONFRONTATION_FEMALES_01"},
-	    {"RE_TOWNCONFRONTATION_MALES_01"_J, "RE_TOWNCONFRONTATION_MALES_01"},
-	    {"RE_TOWNROBBERY_MALES_01"_J, "RE_TOWNROBBERY_MALES_01"},
-	    {"RE_TOWNWIDOW_FEMALES_01"_J, "RE_TOWNWIDOW_FEMALES_01"},
-	    {"RE_TRAINHOLDUP_FEMALES_01"_J, "RE_TRAINHOLDUP_FEMALES_01"},
-	    {"RE_TRAINHOLDUP_MALES_01"_J, "RE_TRAINHOLDUP_MALES_01"},
-	    {"RE_TRAPPEDWOMAN_FEMALES_01"_J, "RE_TRAPPEDWOMAN_FEMALES_01"},
-	    {"RE_TREASUREHUNTER_MALES_01"_J, "RE_TREASUREHUNTER_MALES_01"},
-	    {"RE_VOICE_FEMALES_01"_J, "RE_VOICE_FEMALES_01"},
-	    {"RE_WAGONTHREAT_FEMALES_01"_J, "RE_WAGONTHREAT_FEMALES_01"},
-	    {"RE_WAGONTHREAT_MALES_01"_J, "RE_WAGONTHREAT_MALES_01"},
-	    {"RE_WASHEDASHORE_MALES_01"_J, "RE_WASHEDASHORE_MALES_01"},
-	    {"RE_WEALTHYCOUPLE_FEMALES_01"_J, "RE_WEALTHYCOUPLE_FEMALES_01"},
-	    {"RE_WEALTHYCOUPLE_MALES_01"_J, "RE_WEALTHYCOUPLE_MALES_01"},
-	    {"RE_WILDMAN_01"_J, "RE_WILDMAN_01"},
-	    {"S_F_M_BwmWorker_01"_J, "S_F_M_BwmWorker_01"},
-	    {"S_F_M_CghWorker_01"_J, "S_F_M_CghWorker_01"},
-	    {"S_F_M_MaPWorker_01"_J, "S_F_M_MaPWorker_01"},
-	    {"S_M_M_AmbientBlWPolice_01"_J, "S_M_M_AmbientBlWPolice_01"},
+	    {"S_M_M_SDDEALER_01"_J, "S_M_M_SDDEALER_01"},
+	    {"A_F_M_SDFancyWhore_01"_J, "A_F_M_SDFancyWhore_01"},
+	    {"RE_HORSERACE_MALES_01"_J, "RE_HORSERACE_MALES_01"},
+	    {"S_M_M_RaCRailWorker_01"_J, "S_M_M_RaCRailWorker_01"},
+	    {"A_C_Horse_Criollo_Blueroanovero"_J, "A_C_Horse_Criollo_Blueroanovero"},
+	    {"U_M_M_MUD3PIMP_01"_J, "U_M_M_MUD3PIMP_01"},
+	    {"A_M_M_NEAROUGHTRAVELLERS_01"_J, "A_M_M_NEAROUGHTRAVELLERS_01"},
+	    {"CS_HAMISH"_J, "CS_HAMISH"},
+	    {"U_M_M_UNIONLEADER_02"_J, "U_M_M_UNIONLEADER_02"},
 	    {"S_M_M_AmbientLawRural_01"_J, "S_M_M_AmbientLawRural_01"},
-	    {"S_M_M_AmbientSDPolice_01"_J, "S_M_M_AmbientSDPolice_01"},
-	    {"S_M_M_Army_01"_J, "S_M_M_Army_01"},
-	    {"S_M_M_ASBCowpoke_01"_J, "S_M_M_ASBCowpoke_01"},
-	    {"S_M_M_ASBDEALER_01"_J, "S_M_M_ASBDEALER_01"},
-	    {"S_M_M_BankClerk_01"_J, "S_M_M_BankClerk_01"},
-	    {"S_M_M_Barber_01"_J, "S_M_M_Barber_01"},
-	    {"S_M_M_BLWCOWPOKE_01"_J, "S_M_M_BLWCOWPOKE_01"},
-	    {"S_M_M_BLWDEALER_01"_J, "S_M_M_BLWDEALER_01"},
-	    {"S_M_M_BwmWorker_01"_J, "S_M_M_BwmWorker_01"},
-	    {"S_M_M_CghWorker_01"_J, "S_M_M_CghWorker_01"},
-	    {"S_M_M_CKTWorker_01"_J, "S_M_M_CKTWorker_01"},
+	    {"A_M_M_SkpPrisonLine_01"_J, "A_M_M_SkpPrisonLine_01"},
+	    {"CS_hectorfellowes"_J, "CS_hectorfellowes"},
+	    {"CS_SDSALOONDRUNK_01"_J, "CS_SDSALOONDRUNK_01"},
+	    {"CS_javierescuella"_J, "CS_javierescuella"},
+	    {"U_M_M_RaCQuarterMaster_01"_J, "U_M_M_RaCQuarterMaster_01"},
+	    {"A_M_M_MiddleSDTownfolk_02"_J, "A_M_M_MiddleSDTownfolk_02"},
+	    {"RE_SNAKEBITE_MALES_01"_J, "RE_SNAKEBITE_MALES_01"},
+	    {"A_C_FishSmallMouthBass_01_ms"_J, "A_C_FishSmallMouthBass_01_ms"},
+	    {"A_C_Horse_Thoroughbred_DappleGrey"_J, "A_C_Horse_Thoroughbred_DappleGrey"},
+	    {"CS_SD_STREETKID_02"_J, "CS_SD_STREETKID_02"},
+	    {"A_C_FishBluegil_01_ms"_J, "A_C_FishBluegil_01_ms"},
+	    {"A_C_Horse_AmericanStandardbred_Lightbuckskin"_J, "A_C_Horse_AmericanStandardbred_Lightbuckskin"},
+	    {"RE_ANIMALMAULING_MALES_01"_J, "RE_ANIMALMAULING_MALES_01"},
+	    {"A_C_HORSE_MUSTANG_BLACKOVERO"_J, "A_C_HORSE_MUSTANG_BLACKOVERO"},
+	    {"A_M_M_BynFancyDRIVERS_01"_J, "A_M_M_BynFancyDRIVERS_01"},
+	    {"CS_valauctionboss_01"_J, "CS_valauctionboss_01"},
+	    {"A_F_M_RhdTownfolk_02"_J, "A_F_M_RhdTownfolk_02"},
+	    {"U_M_M_ValDoctor_01"_J, "U_M_M_ValDoctor_01"},
+	    {"RE_SLUMAMBUSH_FEMALES_01"_J, "RE_SLUMAMBUSH_FEMALES_01"},
+	    {"CS_jackmarston"_J, "CS_jackmarston"},
+	    {"U_M_M_BHT_SKINNERBROTHER"_J, "U_M_M_BHT_SKINNERBROTHER"},
+	    {"CS_COOPER"_J, "CS_COOPER"},
+	    {"CS_kieran"_J, "CS_kieran"},
+	    {"CS_dutch"_J, "CS_dutch"},
+	    {"MES_ABIGAIL2_MALES_01"_J, "MES_ABIGAIL2_MALES_01"},
+	    {"MP_Horse_Owlhootvictim_01"_J, "MP_Horse_Owlhootvictim_01"},
+	    {"MES_SADIE4_MALES_01"_J, "MES_SADIE4_MALES_01"},
+	    {"U_F_Y_BRAITHWAITESSECRET_01"_J, "U_F_Y_BRAITHWAITESSECRET_01"},
+	    {"A_M_M_UPPERTRAINPASSENGERS_01"_J, "A_M_M_UPPERTRAINPASSENGERS_01"},
+	    {"CS_NbxDrunk"_J, "CS_NbxDrunk"},
+	    {"A_M_Y_UniCorpse_01"_J, "A_M_Y_UniCorpse_01"},
+	    {"MP_ASN_SDPOLICESTATION_MALES_01"_J, "MP_ASN_SDPOLICESTATION_MALES_01"},
+	    {"CS_MP_LEE"_J, "CS_MP_LEE"},
+	    {"A_M_M_GriFancyTravellers_01"_J, "A_M_M_GriFancyTravellers_01"},
+	    {"CS_MP_SETH"_J, "CS_MP_SETH"},
+	    {"A_F_M_RhdProstitute_01"_J, "A_F_M_RhdProstitute_01"},
+	    {"ggrcez"_J, "ggrcez"},
+	    {"U_F_M_HTLWIFE_01"_J, "U_F_M_HTLWIFE_01"},
+	    {"A_M_M_RkrFancyTravellers_01"_J, "A_M_M_RkrFancyTravellers_01"},
+	    {"RE_WEALTHYCOUPLE_MALES_01"_J, "RE_WEALTHYCOUPLE_MALES_01"},
 	    {"S_M_M_COACHTAXIDRIVER_01"_J, "S_M_M_COACHTAXIDRIVER_01"},
-	    {"S_M_M_CornwallGuard_01"_J, "S_M_M_CornwallGuard_01"},
-	    {"S_M_M_DispatchLawRural_01"_J, "S_M_M_DispatchLawRural_01"},
+	    {"CS_GermanMother"_J, "CS_GermanMother"},
+	    {"CS_ringmaster"_J, "CS_ringmaster"},
+	    {"CS_LUCANAPOLI"_J, "CS_LUCANAPOLI"},
+	    {"CS_RhodesAssistant"_J, "CS_RhodesAssistant"},
+	    {"MSP_FUSSAR2_MALES_01"_J, "MSP_FUSSAR2_MALES_01"},
+	    {"A_F_M_LowerSDTownfolk_03"_J, "A_F_M_LowerSDTownfolk_03"},
+	    {"MSP_SAINTDENIS1_FEMALES_01"_J, "MSP_SAINTDENIS1_FEMALES_01"},
+	    {"U_M_M_StrSherriff_01"_J, "U_M_M_StrSherriff_01"},
+	    {"RE_TORTURINGCAPTIVE_MALES_01"_J, "RE_TORTURINGCAPTIVE_MALES_01"},
+	    {"A_C_Rooster_01"_J, "A_C_Rooster_01"},
+	    {"A_C_Horse_KentuckySaddle_Grey"_J, "A_C_Horse_KentuckySaddle_Grey"},
+	    {"A_C_Boar_01"_J, "A_C_Boar_01"},
+	    {"CS_AberdeenSister"_J, "CS_AberdeenSister"},
+	    {"A_C_Horse_Morgan_Bay"_J, "A_C_Horse_Morgan_Bay"},
+	    {"RE_MOONSHINECAMP_MALES_01"_J, "RE_MOONSHINECAMP_MALES_01"},
+	    {"CS_archibaldjameson"_J, "CS_archibaldjameson"},
+	    {"A_C_Horse_MissouriFoxTrotter_Buckskinbrindle"_J, "A_C_Horse_MissouriFoxTrotter_Buckskinbrindle"},
+	    {"A_F_M_GuaTownfolk_01"_J, "A_F_M_GuaTownfolk_01"},
+	    {"RCSP_CRACKPOT_MALES_01"_J, "RCSP_CRACKPOT_MALES_01"},
+	    {"RE_CRASHEDWAGON_MALES_01"_J, "RE_CRASHEDWAGON_MALES_01"},
+	    {"CS_NbxExecuted"_J, "CS_NbxExecuted"},
+	    {"CS_FamousGunslinger_06"_J, "CS_FamousGunslinger_06"},
+	    {"U_M_M_TumGunsmith_01"_J, "U_M_M_TumGunsmith_01"},
+	    {"U_M_M_SHACKTWIN_02"_J, "U_M_M_SHACKTWIN_02"},
+	    {"U_M_M_NBXLiveryWorker_01"_J, "U_M_M_NBXLiveryWorker_01"},
+	    {"U_M_M_UniBountyHunter_01"_J, "U_M_M_UniBountyHunter_01"},
+	    {"CS_billwilliamson"_J, "CS_billwilliamson"},
+	    {"RCES_ABIGAIL3_MALES_01"_J, "RCES_ABIGAIL3_MALES_01"},
+	    {"U_M_M_RhdBackupDeputy_02"_J, "U_M_M_RhdBackupDeputy_02"},
+	    {"RE_POISONED_MALES_01"_J, "RE_POISONED_MALES_01"},
+	    {"RCSP_BEAUANDPENELOPE_MALES_01"_J, "RCSP_BEAUANDPENELOPE_MALES_01"},
+	    {"MES_MARSTON6_MALES_01"_J, "MES_MARSTON6_MALES_01"},
+	    {"A_C_PrairieChicken_01"_J, "A_C_PrairieChicken_01"},
+	    {"MP_U_M_M_LBT_Owlhootvictim_01"_J, "MP_U_M_M_LBT_Owlhootvictim_01"},
+	    {"U_M_M_NBXGraverobber_02"_J, "U_M_M_NBXGraverobber_02"},
+	    {"U_F_M_ValTownfolk_02"_J, "U_F_M_ValTownfolk_02"},
+	    {"CS_RAMON_CORTEZ"_J, "CS_RAMON_CORTEZ"},
+	    {"CS_JohnWeathers"_J, "CS_JohnWeathers"},
+	    {"A_M_M_BynRoughTravellers_01"_J, "A_M_M_BynRoughTravellers_01"},
+	    {"U_M_M_SHACKTWIN_01"_J, "U_M_M_SHACKTWIN_01"},
+	    {"A_C_Quail_01"_J, "A_C_Quail_01"},
+	    {"SALOONBRAWLERS_09"_J, "SALOONBRAWLERS_09"},
 	    {"S_M_M_DispatchLeaderPolice_01"_J, "S_M_M_DispatchLeaderPolice_01"},
-	    {"S_M_M_DispatchLeaderRural_01"_J, "S_M_M_DispatchLeaderRural_01"},
-	    {"S_M_M_DispatchPolice_01"_J, "S_M_M_DispatchPolice_01"},
-	    {"S_M_M_FussarHenchman_01"_J, "S_M_M_FussarHenchman_01"},
-	    {"S_M_M_GENCONDUCTOR_01"_J, "S_M_M_GENCONDUCTOR_01"},
-	    {"S_M_M_HOFGuard_01"_J, "S_M_M_HOFGuard_01"},
-	    {"S_M_M_LiveryWorker_01"_J, "S_M_M_LiveryWorker_01"},
-	    {"S_M_M_MAGICLANTERN_01"_J, "S_M_M_MAGICLANTERN_01"},
-	    {"S_M_M_MaPWorker_01"_J, "S_M_M_MaPWorker_01"},
-	    {"S_M_M_MarketVendor_01"_J, "S_M_M_MarketVendor_01"},
-	    {"S_M_M_MARSHALLSRURAL_01"_J, "S_M_M_MARSHALLSRURAL_01"},
-	    {"S_M_M_MicGuard_01"_J, "S_M_M_MicGuard_01"},
-	    {"S_M_M_NBXRIVERBOATDEALERS_01"_J, "S_M_M_NBXRIVERBOATDEALERS_01"},
-	    {"S_M_M_NbxRiverBoatGuards_01"_J, "S_M_M_NbxRiverBoatGuards_01"},
-	    {"S_M_M_ORPGUARD_01"_J, "S_M_M_ORPGUARD_01"},
-	    {"S_M_M_PinLaw_01"_J, "S_M_M_PinLaw_01"},
-	    {"S_M_M_RACRAILGUARDS_01"_J, "S_M_M_RACRAILGUARDS_01"},
-	    {"S_M_M_RaCRailWorker_01"_J, "S_M_M_RaCRailWorker_01"},
-	    {"S_M_M_RHDCOWPOKE_01"_J, "S_M_M_RHDCOWPOKE_01"},
-	    {"S_M_M_RHDDEALER_01"_J, "S_M_M_RHDDEALER_01"},
-	    {"S_M_M_SDCOWPOKE_01"_J, "S_M_M_SDCOWPOKE_01"},
-	    {"S_M_M_SDDEALER_01"_J, "S_M_M_SDDEALER_01"},
-	    {"S_M_M_SDTICKETSELLER_01"_J, "S_M_M_SDTICKETSELLER_01"},
-	    {"S_M_M_SkpGuard_01"_J, "S_M_M_SkpGuard_01"},
-	    {"S_M_M_StGSailor_01"_J, "S_M_M_StGSailor_01"},
-	    {"S_M_M_STRCOWPOKE_01"_J, "S_M_M_STRCOWPOKE_01"},
-	    {"S_M_M_STRDEALER_01"_J, "S_M_M_STRDEALER_01"},
-	    {"S_M_M_StrLumberjack_01"_J, "S_M_M_StrLumberjack_01"},
-	    {"S_M_M_Tailor_01"_J, "S_M_M_Tailor_01"},
-	    {"S_M_M_TrainStationWorker_01"_J, "S_M_M_TrainStationWorker_01"},
-	    {"S_M_M_TumDeputies_01"_J, "S_M_M_TumDeputies_01"},
-	    {"S_M_M_UNIBUTCHERS_01"_J, "S_M_M_UNIBUTCHERS_01"},
-	    {"S_M_M_UniTrainEngineer_01"_J, "S_M_M_UniTrainEngineer_01"},
-	    {"S_M_M_UniTrainGuards_01"_J, "S_M_M_UniTrainGuards_01"},
-	    {"S_M_M_ValBankGuards_01"_J, "S_M_M_ValBankGuards_01"},
-	    {"S_M_M_ValCowpoke_01"_J, "S_M_M_ValCowpoke_01"},
-	    {"S_M_M_VALDEALER_01"_J, "S_M_M_VALDEALER_01"},
-	    {"S_M_M_VALDEPUTY_01"_J, "S_M_M_VALDEPUTY_01"},
-	    {"S_M_M_VHTDEALER_01"_J, "S_M_M_VHTDEALER_01"},
-	    {"S_M_O_CKTWorker_01"_J, "S_M_O_CKTWorker_01"},
+	    {"CS_professorbell"_J, "CS_professorbell"},
+	    {"A_C_Horse_Mustang_WildBay"_J, "A_C_Horse_Mustang_WildBay"},
+	    {"A_C_Horse_Thoroughbred_BlackChestnut"_J, "A_C_Horse_Thoroughbred_BlackChestnut"},
+	    {"U_M_M_STORY_EMERALDRANCH_01"_J, "U_M_M_STORY_EMERALDRANCH_01"},
+	    {"RE_WEALTHYCOUPLE_FEMALES_01"_J, "RE_WEALTHYCOUPLE_FEMALES_01"},
+	    {"A_F_M_RhdUpperClass_01"_J, "A_F_M_RhdUpperClass_01"},
+	    {"A_C_Horse_Appaloosa_Blanket"_J, "A_C_Horse_Appaloosa_Blanket"},
+	    {"A_M_M_MiddleSDTownfolk_01"_J, "A_M_M_MiddleSDTownfolk_01"},
+	    {"RCSP_CREOLE_MALES_01"_J, "RCSP_CREOLE_MALES_01"},
+	    {"CS_rhodessaloonbouncer"_J, "CS_rhodessaloonbouncer"},
+	    {"S_M_M_BwmWorker_01"_J, "S_M_M_BwmWorker_01"},
+	    {"U_M_M_CHELONIANJUMPER_03"_J, "U_M_M_CHELONIANJUMPER_03"},
+	    {"A_C_Horse_Nokota_BlueRoan"_J, "A_C_Horse_Nokota_BlueRoan"},
+	    {"A_C_Horse_Criollo_Marblesabino"_J, "A_C_Horse_Criollo_Marblesabino"},
+	    {"A_C_DogHound_01"_J, "A_C_DogHound_01"},
+	    {"A_C_Hawk_01"_J, "A_C_Hawk_01"},
 	    {"S_M_Y_Army_01"_J, "S_M_Y_Army_01"},
-	    {"S_M_Y_NewspaperBoy_01"_J, "S_M_Y_NewspaperBoy_01"},
-	    {"S_M_Y_RaCRailWorker_01"_J, "S_M_Y_RaCRailWorker_01"},
-	    {"SALOONBRAWLERS_02"_J, "SALOONBRAWLERS_02"},
-	    {"SALOONBRAWLERS_03"_J, "SALOONBRAWLERS_03"},
-	    {"SALOONBRAWLERS_04"_J, "SALOONBRAWLERS_04"},
-	    {"SALOONBRAWLERS_05"_J, "SALOONBRAWLERS_05"},
-	    {"SALOONBRAWLERS_06"_J, "SALOONBRAWLERS_06"},
-	    {"SALOONBRAWLERS_07"_J, "SALOONBRAWLERS_07"},
-	    {"SALOONBRAWLERS_08"_J, "SALOONBRAWLERS_08"},
-	    {"SALOONBRAWLERS_09"_J, "SALOONBRAWLERS_09"},
-	    {"SALOONBRAWLERS_10"_J, "SALOONBRAWLERS_10"},
-	    {"SALOONBRAWLERS_11"_J, "SALOONBRAWLERS_11"},
-	    {"SALOONBRAWLERS_12"_J, "SALOONBRAWLERS_12"},
-	    {"SALOONBRAWLERS_13"_J, "SALOONBRAWLERS_13"},
+	    {"MP_A_M_M_MOONSHINEMAKERS_01"_J, "MP_A_M_M_MOONSHINEMAKERS_01"},
 	    {"SALOONBRAWLERS_14"_J, "SALOONBRAWLERS_14"},
-	    {"U_F_M_BHT_WIFE"_J, "U_F_M_BHT_WIFE"},
-	    {"U_F_M_CIRCUSWAGON_01"_J, "U_F_M_CIRCUSWAGON_01"},
-	    {"U_F_M_EMRDAUGHTER_01"_J, "U_F_M_EMRDAUGHTER_01"},
-	    {"U_F_M_FUSSAR1LADY_01"_J, "U_F_M_FUSSAR1LADY_01"},
-	    {"U_F_M_HTLWIFE_01"_J, "U_F_M_HTLWIFE_01"},
-	    {"U_F_M_LagMother_01"_J, "U_F_M_LagMother_01"},
-	    {"U_F_M_NbxResident_01"_J, "U_F_M_NbxResident_01"},
-	    {"U_F_M_RhdNudeWoman_01"_J, "U_F_M_RhdNudeWoman_01"},
-	    {"U_F_M_RkSHomesteadTenant_01"_J, "U_F_M_RkSHomesteadTenant_01"},
-	    {"U_F_M_STORY_BLACKBELLE_01"_J, "U_F_M_STORY_BLACKBELLE_01"},
-	    {"U_F_M_STORY_NIGHTFOLK_01"_J, "U_F_M_STORY_NIGHTFOLK_01"},
-	    {"U_F_M_TljBartender_01"_J, "U_F_M_TljBartender_01"},
-	    {"U_F_M_TumGeneralStoreOwner_01"_J, "U_F_M_TumGeneralStoreOwner_01"},
-	    {"U_F_M_ValTownfolk_01"_J, "U_F_M_ValTownfolk_01"},
-	    {"U_F_M_ValTownfolk_02"_J, "U_F_M_ValTownfolk_02"},
-	    {"U_F_M_VHTBARTENDER_01"_J, "U_F_M_VHTBARTENDER_01"},
-	    {"U_F_O_Hermit_woman_01"_J, "U_F_O_Hermit_woman_01"},
-	    {"U_F_O_WtCTownfolk_01"_J, "U_F_O_WtCTownfolk_01"},
-	    {"U_F_Y_BRAITHWAITESSECRET_01"_J, "U_F_Y_BRAITHWAITESSECRET_01"},
-	    {"U_F_Y_CzPHomesteadDaughter_01"_J, "U_F_Y_CzPHomesteadDaughter_01"},
-	    {"U_M_M_ANNOUNCER_01"_J, "U_M_M_ANNOUNCER_01"},
-	    {"U_M_M_APFDeadMan_01"_J, "U_M_M_APFDeadMan_01"},
-	    {"U_M_M_ARMGENERALSTOREOWNER_01"_J, "U_M_M_ARMGENERALSTOREOWNER_01"},
-	    {"U_M_M_ARMTRAINSTATIONWORKER_01"_J, "U_M_M_ARMTRAINSTATIONWORKER_01"},
-	    {"U_M_M_ARMUNDERTAKER_01"_J, "U_M_M_ARMUNDERTAKER_01"},
-	    {"U_M_M_ARMYTRN4_01"_J, "U_M_M_ARMYTRN4_01"},
 	    {"U_M_M_AsbGunsmith_01"_J, "U_M_M_AsbGunsmith_01"},
-	    {"U_M_M_AsbPrisoner_01"_J, "U_M_M_AsbPrisoner_01"},
-	    {"U_M_M_AsbPrisoner_02"_J, "U_M_M_AsbPrisoner_02"},
-	    {"U_M_M_BHT_BANDITOMINE"_J, "U_M_M_BHT_BANDITOMINE"},
-	    {"U_M_M_BHT_BANDITOSHACK"_J, "U_M_M_BHT_BANDITOSHACK"},
-	    {"U_M_M_BHT_BENEDICTALLBRIGHT"_J, "U_M_M_BHT_BENEDICTALLBRIGHT"},
-	    {"U_M_M_BHT_BLACKWATERHUNT"_J, "U_M_M_BHT_BLACKWATERHUNT"},
-	    {"U_M_M_BHT_LOVER"_J, "U_M_M_BHT_LOVER"},
-	    {"U_M_M_BHT_MINEFOREMAN"_J, "U_M_M_BHT_MINEFOREMAN"},
-	    {"U_M_M_BHT_NATHANKIRK"_J, "U_M_M_BHT_NATHANKIRK"},
-	    {"U_M_M_BHT_ODRISCOLLDRUNK"_J, "U_M_M_BHT_ODRISCOLLDRUNK"},
-	    {"U_M_M_BHT_ODRISCOLLMAULED"_J, "U_M_M_BHT_ODRISCOLLMAULED"},
-	    {"U_M_M_BHT_ODRISCOLLSLEEPING"_J, "U_M_M_BHT_ODRISCOLLSLEEPING"},
-	    {"U_M_M_BHT_OLDMAN"_J, "U_M_M_BHT_OLDMAN"},
-	    {"U_M_M_BHT_OUTLAWMAULED"_J, "U_M_M_BHT_OUTLAWMAULED"},
-	    {"U_M_M_BHT_SAINTDENISSALOON"_J, "U_M_M_BHT_SAINTDENISSALOON"},
+	    {"RE_ESCORT_FEMALES_01"_J, "RE_ESCORT_FEMALES_01"},
+	    {"RE_FRIENDLYOUTDOORSMAN_MALES_01"_J, "RE_FRIENDLYOUTDOORSMAN_MALES_01"},
+	    {"CS_MP_DANNYLEE"_J, "CS_MP_DANNYLEE"},
+	    {"A_C_FishBluegil_01_sm"_J, "A_C_FishBluegil_01_sm"},
+	    {"U_M_M_story_REDHARLOW_01"_J, "U_M_M_story_REDHARLOW_01"},
+	    {"A_C_Spot_Gang_Charles"_J, "A_C_Spot_Gang_Charles"},
+	    {"A_M_M_LowerSDTownfolk_02"_J, "A_M_M_LowerSDTownfolk_02"},
+	    {"U_M_M_story_MANZANITA_01"_J, "U_M_M_story_MANZANITA_01"},
+	    {"A_F_O_WAPTOWNFOLK_01"_J, "A_F_O_WAPTOWNFOLK_01"},
+	    {"A_M_M_ValTownfolk_01"_J, "A_M_M_ValTownfolk_01"},
+	    {"CS_sistercalderon"_J, "CS_sistercalderon"},
+	    {"MP_G_F_M_CULTGUARDS_01"_J, "MP_G_F_M_CULTGUARDS_01"},
+	    {"MP_ASN_PikesBasin_Males_01"_J, "MP_ASN_PikesBasin_Males_01"},
+	    {"CS_strsheriff_01"_J, "CS_strsheriff_01"},
+	    {"MSP_TRELAWNY1_MALES_01"_J, "MSP_TRELAWNY1_MALES_01"},
+	    {"CS_mud2bigguy"_J, "CS_mud2bigguy"},
+	    {"CS_chainprisoner_01"_J, "CS_chainprisoner_01"},
+	    {"A_C_Cormorant_01"_J, "A_C_Cormorant_01"},
+	    {"S_M_Y_RaCRailWorker_01"_J, "S_M_Y_RaCRailWorker_01"},
+	    {"A_C_Horse_John_EndlessSummer"_J, "A_C_Horse_John_EndlessSummer"},
+	    {"A_C_Chicken_01"_J, "A_C_Chicken_01"},
+	    {"A_C_SnakeBlackTailRattle_Pelt_01"_J, "A_C_SnakeBlackTailRattle_Pelt_01"},
+	    {"CS_missMarjorie"_J, "CS_missMarjorie"},
+	    {"CS_rainsfall"_J, "CS_rainsfall"},
+	    {"CS_penelopebraithwaite"_J, "CS_penelopebraithwaite"},
 	    {"U_M_M_BHT_SHACKESCAPE"_J, "U_M_M_BHT_SHACKESCAPE"},
-	    {"U_M_M_BHT_SKINNERBROTHER"_J, "U_M_M_BHT_SKINNERBROTHER"},
+	    {"S_M_M_LiveryWorker_01"_J, "S_M_M_LiveryWorker_01"},
+	    {"A_C_Crab_01"_J, "A_C_Crab_01"},
+	    {"A_F_O_BtcHillbilly_01"_J, "A_F_O_BtcHillbilly_01"},
+	    {"MP_U_M_M_LEGENDARYBOUNTY_09"_J, "MP_U_M_M_LEGENDARYBOUNTY_09"},
+	    {"A_C_Horse_Ardennes_IronGreyRoan"_J, "A_C_Horse_Ardennes_IronGreyRoan"},
+	    {"RE_FROZENTODEATH_FEMALES_01"_J, "RE_FROZENTODEATH_FEMALES_01"},
+	    {"A_C_FishChannelCatfish_01_XL"_J, "A_C_FishChannelCatfish_01_XL"},
+	    {"A_C_Elk_01"_J, "A_C_Elk_01"},
+	    {"CS_SWAMPWEIRDOSONNY"_J, "CS_SWAMPWEIRDOSONNY"},
+	    {"CS_UNIDUSTERJAIL_01"_J, "CS_UNIDUSTERJAIL_01"},
+	    {"RCSP_DUTCH3_MALES_01"_J, "RCSP_DUTCH3_MALES_01"},
+	    {"CS_IANGRAY"_J, "CS_IANGRAY"},
+	    {"A_C_TurkeyWild_01"_J, "A_C_TurkeyWild_01"},
+	    {"CS_TINYHERMIT"_J, "CS_TINYHERMIT"},
+	    {"A_M_M_SDROUGHTRAVELLERS_01"_J, "A_M_M_SDROUGHTRAVELLERS_01"},
+	    {"CS_TimothyDonahue"_J, "CS_TimothyDonahue"},
+	    {"A_C_HORSE_TURKOMAN_BLACK"_J, "A_C_HORSE_TURKOMAN_BLACK"},
+	    {"CS_EscapeArtist"_J, "CS_EscapeArtist"},
+	    {"A_F_M_LowerSDTownfolk_02"_J, "A_F_M_LowerSDTownfolk_02"},
+	    {"A_C_Horse_Arabian_Black"_J, "A_C_Horse_Arabian_Black"},
+	    {"CS_MP_BOUNTYHUNTER"_J, "CS_MP_BOUNTYHUNTER"},
+	    {"U_M_M_RhdGenStoreOwner_02"_J, "U_M_M_RhdGenStoreOwner_02"},
+	    {"CS_MP_HANS"_J, "CS_MP_HANS"},
+	    {"G_M_M_UniCriminals_02"_J, "G_M_M_UniCriminals_02"},
+	    {"A_C_FishRockBass_01_ms"_J, "A_C_FishRockBass_01_ms"},
+	    {"CS_PrincessIsabeau"_J, "CS_PrincessIsabeau"},
+	    {"RE_RATINFESTATION_MALES_01"_J, "RE_RATINFESTATION_MALES_01"},
+	    {"CS_leviticuscornwall"_J, "CS_leviticuscornwall"},
+	    {"RE_LOSTDRUNK_MALES_01"_J, "RE_LOSTDRUNK_MALES_01"},
+	    {"CS_DIDSBURY"_J, "CS_DIDSBURY"},
+	    {"A_C_Buck_01"_J, "A_C_Buck_01"},
+	    {"A_C_Horse_AmericanPaint_Greyovero"_J, "A_C_Horse_AmericanPaint_Greyovero"},
+	    {"CS_MP_JORGE_MONTEZ"_J, "CS_MP_JORGE_MONTEZ"},
+	    {"CS_WATSON_02"_J, "CS_WATSON_02"},
+	    {"MP_U_F_M_CULTPRIEST_01"_J, "MP_U_F_M_CULTPRIEST_01"},
+	    {"A_M_O_SDUpperClass_01"_J, "A_M_O_SDUpperClass_01"},
+	    {"A_M_O_WAPTOWNFOLK_01"_J, "A_M_O_WAPTOWNFOLK_01"},
+	    {"U_M_M_ANNOUNCER_01"_J, "U_M_M_ANNOUNCER_01"},
+	    {"RE_STRANDEDRIDER_MALES_01"_J, "RE_STRANDEDRIDER_MALES_01"},
+	    {"CS_FEATHERSTONCHAMBERS"_J, "CS_FEATHERSTONCHAMBERS"},
+	    {"A_C_Horse_Thoroughbred_BloodBay"_J, "A_C_Horse_Thoroughbred_BloodBay"},
+	    {"CS_FeatsOfStrength"_J, "CS_FeatsOfStrength"},
+	    {"CS_fussar"_J, "CS_fussar"},
+	    {"A_M_M_GaMHighSociety_01"_J, "A_M_M_GaMHighSociety_01"},
+	    {"A_F_M_SDObeseWomen_01"_J, "A_F_M_SDObeseWomen_01"},
 	    {"U_M_M_BHT_SKINNERSEARCH"_J, "U_M_M_BHT_SKINNERSEARCH"},
-	    {"U_M_M_BHT_STRAWBERRYDUEL"_J, "U_M_M_BHT_STRAWBERRYDUEL"},
-	    {"U_M_M_BiVForeman_01"_J, "U_M_M_BiVForeman_01"},
-	    {"U_M_M_BlWTrainStationWorker_01"_J, "U_M_M_BlWTrainStationWorker_01"},
-	    {"U_M_M_BULLETCATCHVOLUNTEER_01"_J, "U_M_M_BULLETCATCHVOLUNTEER_01"},
-	    {"U_M_M_BwmStablehand_01"_J, "U_M_M_BwmStablehand_01"},
-	    {"U_M_M_CAJHOMESTEAD_01"_J, "U_M_M_CAJHOMESTEAD_01"},
-	    {"U_M_M_CHELONIANJUMPER_01"_J, "U_M_M_CHELONIANJUMPER_01"},
+	    {"A_C_SongBird_01"_J, "A_C_SongBird_01"},
+	    {"A_F_M_ValProstitute_01"_J, "A_F_M_ValProstitute_01"},
+	    {"U_M_M_ARMUNDERTAKER_01"_J, "U_M_M_ARMUNDERTAKER_01"},
+	    {"RE_ONTHERUN_MALES_01"_J, "RE_ONTHERUN_MALES_01"},
+	    {"U_M_M_RhdBackupDeputy_01"_J, "U_M_M_RhdBackupDeputy_01"},
+	    {"A_M_Y_AsbMiner_01"_J, "A_M_Y_AsbMiner_01"},
+	    {"U_M_O_BlWBartender_01"_J, "U_M_O_BlWBartender_01"},
+	    {"CS_bandpianist"_J, "CS_bandpianist"},
+	    {"A_C_Horse_HungarianHalfbred_LiverChestnut"_J, "A_C_Horse_HungarianHalfbred_LiverChestnut"},
+	    {"MSP_SALOON1_MALES_01"_J, "MSP_SALOON1_MALES_01"},
+	    {"MP_G_M_M_UNICRIMINALS_08"_J, "MP_G_M_M_UNICRIMINALS_08"},
+	    {"A_C_Alligator_01"_J, "A_C_Alligator_01"},
+	    {"MP_ASN_BENEDICTPOINT_MALES_01"_J, "MP_ASN_BENEDICTPOINT_MALES_01"},
+	    {"S_M_M_AmbientBlWPolice_01"_J, "S_M_M_AmbientBlWPolice_01"},
+	    {"U_F_M_ValTownfolk_01"_J, "U_F_M_ValTownfolk_01"},
+	    {"U_M_M_ISLBUM_01"_J, "U_M_M_ISLBUM_01"},
+	    {"A_C_FishSmallMouthBass_01_lg"_J, "A_C_FishSmallMouthBass_01_lg"},
+	    {"CS_VALSHERIFF"_J, "CS_VALSHERIFF"},
+	    {"U_M_M_NBXGraverobber_03"_J, "U_M_M_NBXGraverobber_03"},
+	    {"A_M_M_SDSERVERSFORMAL_01"_J, "A_M_M_SDSERVERSFORMAL_01"},
+	    {"A_C_Horse_Kladruber_Cremello"_J, "A_C_Horse_Kladruber_Cremello"},
+	    {"U_M_O_ValBartender_01"_J, "U_M_O_ValBartender_01"},
+	    {"msp_mob3_FEMALES_01"_J, "msp_mob3_FEMALES_01"},
+	    {"MSP_Mudtown3B_Males_01"_J, "MSP_Mudtown3B_Males_01"},
+	    {"CS_bronte"_J, "CS_bronte"},
 	    {"U_M_M_CHELONIANJUMPER_02"_J, "U_M_M_CHELONIANJUMPER_02"},
-	    {"U_M_M_CHELONIANJUMPER_03"_J, "U_M_M_CHELONIANJUMPER_03"},
-	    {"U_M_M_CHELONIANJUMPER_04"_J, "U_M_M_CHELONIANJUMPER_04"},
-	    {"U_M_M_CircusWagon_01"_J, "U_M_M_CircusWagon_01"},
-	    {"U_M_M_CKTManager_01"_J, "U_M_M_CKTManager_01"},
-	    {"U_M_M_CORNWALLDRIVER_01"_J, "U_M_M_CORNWALLDRIVER_01"},
-	    {"U_M_M_CrDHomesteadTenant_01"_J, "U_M_M_CrDHomesteadTenant_01"},
-	    {"U_M_M_CRDHOMESTEADTENANT_02"_J, "U_M_M_CRDHOMESTEADTENANT_02"},
-	    {"U_M_M_CRDWITNESS_01"_J, "U_M_M_CRDWITNESS_01"},
-	    {"U_M_M_CreoleCaptain_01"_J, "U_M_M_CreoleCaptain_01"},
-	    {"U_M_M_CzPHomesteadFather_01"_J, "U_M_M_CzPHomesteadFather_01"},
-	    {"U_M_M_DorHomesteadHusband_01"_J, "U_M_M_DorHomesteadHusband_01"},
-	    {"U_M_M_EmRFarmHand_03"_J, "U_M_M_EmRFarmHand_03"},
-	    {"U_M_M_EmRFather_01"_J, "U_M_M_EmRFather_01"},
+	    {"U_M_M_TumButcher_01"_J, "U_M_M_TumButcher_01"},
+	    {"A_C_Iguana_01"_J, "A_C_Iguana_01"},
+	    {"RE_PICKPOCKET_MALES_01"_J, "RE_PICKPOCKET_MALES_01"},
+	    {"MP_CAMPDEF_EASTNEWHANOVER_FEMALES_01"_J, "MP_CAMPDEF_EASTNEWHANOVER_FEMALES_01"},
+	    {"U_M_M_LnSWorker_04"_J, "U_M_M_LnSWorker_04"},
+	    {"A_C_Horse_Kladruber_Silver"_J, "A_C_Horse_Kladruber_Silver"},
+	    {"A_M_M_RkrFancyDRIVERS_01"_J, "A_M_M_RkrFancyDRIVERS_01"},
+	    {"A_M_M_JamesonGuard_01"_J, "A_M_M_JamesonGuard_01"},
+	    {"S_F_M_BwmWorker_01"_J, "S_F_M_BwmWorker_01"},
+	    {"CS_EscapeArtistAssistant"_J, "CS_EscapeArtistAssistant"},
+	    {"A_M_M_BiVWorker_01"_J, "A_M_M_BiVWorker_01"},
+	    {"G_M_M_UniCornwallGoons_01"_J, "G_M_M_UniCornwallGoons_01"},
+	    {"U_M_M_ValSheriff_01"_J, "U_M_M_ValSheriff_01"},
+	    {"A_C_Armadillo_01"_J, "A_C_Armadillo_01"},
+	    {"A_C_Parrot_01"_J, "A_C_Parrot_01"},
+	    {"A_M_M_RhdForeman_01"_J, "A_M_M_RhdForeman_01"},
+	    {"A_M_M_LOWERTRAINPASSENGERS_01"_J, "A_M_M_LOWERTRAINPASSENGERS_01"},
+	    {"A_C_SnakeRedBoa_01"_J, "A_C_SnakeRedBoa_01"},
+	    {"A_M_M_ValTownfolk_02"_J, "A_M_M_ValTownfolk_02"},
+	    {"RE_CHECKPOINT_MALES_01"_J, "RE_CHECKPOINT_MALES_01"},
+	    {"MSP_SALOON1_FEMALES_01"_J, "MSP_SALOON1_FEMALES_01"},
+	    {"CS_FRANCIS_SINCLAIR"_J, "CS_FRANCIS_SINCLAIR"},
+	    {"CS_SwordDancer"_J, "CS_SwordDancer"},
+	    {"CS_EagleFlies"_J, "CS_EagleFlies"},
+	    {"CS_garethbraithwaite"_J, "CS_garethbraithwaite"},
+	    {"S_M_M_ValBankGuards_01"_J, "S_M_M_ValBankGuards_01"},
+	    {"S_M_M_BLWDEALER_01"_J, "S_M_M_BLWDEALER_01"},
+	    {"CS_creoleguy"_J, "CS_creoleguy"},
+	    {"A_C_Crawfish_01"_J, "A_C_Crawfish_01"},
+	    {"A_C_Horse_Gang_Bill"_J, "A_C_Horse_Gang_Bill"},
+	    {"A_M_M_GriRoughTravellers_01"_J, "A_M_M_GriRoughTravellers_01"},
+	    {"MP_A_C_BUCK_01"_J, "MP_A_C_BUCK_01"},
+	    {"MSP_REVEREND1_MALES_01"_J, "MSP_REVEREND1_MALES_01"},
+	    {"A_C_SnakeRedBoa10ft_01"_J, "A_C_SnakeRedBoa10ft_01"},
+	    {"CS_leighgray"_J, "CS_leighgray"},
+	    {"A_F_M_ARMTOWNFOLK_01"_J, "A_F_M_ARMTOWNFOLK_01"},
+	    {"A_M_M_NbxLaborers_01"_J, "A_M_M_NbxLaborers_01"},
+	    {"A_F_M_LowerSDTownfolk_01"_J, "A_F_M_LowerSDTownfolk_01"},
+	    {"MES_MARSTON2_MALES_01"_J, "MES_MARSTON2_MALES_01"},
+	    {"U_F_M_RhdNudeWoman_01"_J, "U_F_M_RhdNudeWoman_01"},
 	    {"U_M_M_EXECUTIONER_01"_J, "U_M_M_EXECUTIONER_01"},
-	    {"U_M_M_FATDUSTER_01"_J, "U_M_M_FATDUSTER_01"},
-	    {"U_M_M_FINALE2_AA_UPPERCLASS_01"_J, "U_M_M_FINALE2_AA_UPPERCLASS_01"},
-	    {"U_M_M_GalaStringQuartet_01"_J, "U_M_M_GalaStringQuartet_01"},
-	    {"U_M_M_GalaStringQuartet_02"_J, "U_M_M_GalaStringQuartet_02"},
-	    {"U_M_M_GalaStringQuartet_03"_J, "U_M_M_GalaStringQuartet_03"},
-	    {"U_M_M_GalaStringQuartet_04"_J, "U_M_M_GalaStringQuartet_04"},
-	    {"U_M_M_GAMDoorman_01"_J, "U_M_M_GAMDoorman_01"},
-	    {"U_M_M_HHRRANCHER_01"_J, "U_M_M_HHRRANCHER_01"},
-	    {"U_M_M_HtlForeman_01"_J, "U_M_M_HtlForeman_01"},
-	    {"U_M_M_HTLHUSBAND_01"_J, "U_M_M_HTLHUSBAND_01"},
+	    {"A_C_Horse_Criollo_Baybrindle"_J, "A_C_Horse_Criollo_Baybrindle"},
+	    {"U_M_Y_CZPHOMESTEADSON_04"_J, "U_M_Y_CZPHOMESTEADSON_04"},
+	    {"A_C_Horse_Gang_Sean"_J, "A_C_Horse_Gang_Sean"},
+	    {"A_C_Horse_Breton_SteelGrey"_J, "A_C_Horse_Breton_SteelGrey"},
+	    {"CS_strawberryoutlaw_02"_J, "CS_strawberryoutlaw_02"},
+	    {"CS_MP_LANGSTON"_J, "CS_MP_LANGSTON"},
+	    {"MP_ASN_BLACKWATER_MALES_01"_J, "MP_ASN_BLACKWATER_MALES_01"},
+	    {"CS_MP_SHAKY"_J, "CS_MP_SHAKY"},
+	    {"CS_karen"_J, "CS_karen"},
+	    {"MP_A_C_SHEEP_01"_J, "MP_A_C_SHEEP_01"},
+	    {"MP_U_M_M_LEGENDARYBOUNTY_08"_J, "MP_U_M_M_LEGENDARYBOUNTY_08"},
 	    {"U_M_M_HtlRancherBounty_01"_J, "U_M_M_HtlRancherBounty_01"},
-	    {"U_M_M_ISLBUM_01"_J, "U_M_M_ISLBUM_01"},
-	    {"U_M_M_LNSOUTLAW_01"_J, "U_M_M_LNSOUTLAW_01"},
-	    {"U_M_M_LNSOUTLAW_02"_J, "U_M_M_LNSOUTLAW_02"},
-	    {"U_M_M_lnsoutlaw_03"_J, "U_M_M_lnsoutlaw_03"},
-	    {"U_M_M_LNSOUTLAW_04"_J, "U_M_M_LNSOUTLAW_04"},
-	    {"U_M_M_LnSWorker_01"_J, "U_M_M_LnSWorker_01"},
-	    {"U_M_M_LnSWorker_02"_J, "U_M_M_LnSWorker_02"},
-	    {"U_M_M_LnSWorker_03"_J, "U_M_M_LnSWorker_03"},
-	    {"U_M_M_LnSWorker_04"_J, "U_M_M_LnSWorker_04"},
-	    {"U_M_M_LrsHomesteadTenant_01"_J, "U_M_M_LrsHomesteadTenant_01"},
-	    {"U_M_M_MFRRANCHER_01"_J, "U_M_M_MFRRANCHER_01"},
-	    {"U_M_M_MUD3PIMP_01"_J, "U_M_M_MUD3PIMP_01"},
-	    {"U_M_M_NbxBankerBounty_01"_J, "U_M_M_NbxBankerBounty_01"},
-	    {"U_M_M_NbxBartender_01"_J, "U_M_M_NbxBartender_01"},
-	    {"U_M_M_NbxBartender_02"_J, "U_M_M_NbxBartender_02"},
-	    {"U_M_M_NbxBoatTicketSeller_01"_J, "U_M_M_NbxBoatTicketSeller_01"},
-	    {"U_M_M_NbxBronteAsc_01"_J, "U_M_M_NbxBronteAsc_01"},
-	    {"U_M_M_NbxBronteGoon_01"_J, "U_M_M_NbxBronteGoon_01"},
-	    {"U_M_M_NbxBronteSecForm_01"_J, "U_M_M_NbxBronteSecForm_01"},
-	    {"U_M_M_NbxGeneralStoreOwner_01"_J, "U_M_M_NbxGeneralStoreOwner_01"},
-	    {"U_M_M_NBXGraverobber_01"_J, "U_M_M_NBXGraverobber_01"},
-	    {"U_M_M_NBXGraverobber_02"_J, "U_M_M_NBXGraverobber_02"},
-	    {"U_M_M_NBXGraverobber_03"_J, "U_M_M_NBXGraverobber_03"},
-	    {"U_M_M_NBXGraverobber_04"_J, "U_M_M_NBXGraverobber_04"},
-	    {"U_M_M_NBXGraverobber_05"_J, "U_M_M_NBXGraverobber_05"},
-	    {"U_M_M_NbxGunsmith_01"_J, "U_M_M_NbxGunsmith_01"},
-	    {"U_M_M_NBXLiveryWorker_01"_J, "U_M_M_NBXLiveryWorker_01"},
-	    {"U_M_M_NbxMusician_01"_J, "U_M_M_NbxMusician_01"},
-	    {"U_M_M_NbxPriest_01"_J, "U_M_M_NbxPriest_01"},
-	    {"U_M_M_NbxResident_01"_J, "U_M_M_NbxResident_01"},
-	    {"U_M_M_NbxResident_02"_J, "U_M_M_NbxResident_02"},
-	    {"U_M_M_NbxResident_03"_J, "U_M_M_NbxResident_03"},
-	    {"U_M_M_NbxResident_04"_J, "U_M_M_NbxResident_04"},
-	    {"U_M_M_NBXRIVERBOATPITBOSS_01"_J, "U_M_M_NBXRIVERBOATPITBOSS_01"},
-	    {"U_M_M_NBXRIVERBOATTARGET_01"_J, "U_M_M_NBXRIVERBOATTARGET_01"},
-	    {"U_M_M_NBXShadyDealer_01"_J, "U_M_M_NBXShadyDealer_01"},
-	    {"U_M_M_NbxSkiffDriver_01"_J, "U_M_M_NbxSkiffDriver_01"},
-	    {"U_M_M_ODDFELLOWPARTICIPANT_01"_J, "U_M_M_ODDFELLOWPARTICIPANT_01"},
-	    {"U_M_M_ODriscollBrawler_01"_J, "U_M_M_ODriscollBrawler_01"},
-	    {"U_M_M_ORPGUARD_01"_J, "U_M_M_ORPGUARD_01"},
-	    {"U_M_M_RaCForeman_01"_J, "U_M_M_RaCForeman_01"},
-	    {"U_M_M_RaCQuarterMaster_01"_J, "U_M_M_RaCQuarterMaster_01"},
-	    {"U_M_M_RhdBackupDeputy_01"_J, "U_M_M_RhdBackupDeputy_01"},
-	    {"U_M_M_RhdBackupDeputy_02"_J, "U_M_M_RhdBackupDeputy_02"},
-	    {"U_M_M_RhdBartender_01"_J, "U_M_M_RhdBartender_01"},
-	    {"U_M_M_RHDDOCTOR_01"_J, "U_M_M_RHDDOCTOR_01"},
-	    {"U_M_M_RhdFiddlePlayer_01"_J, "U_M_M_RhdFiddlePlayer_01"},
-	    {"U_M_M_RhdGenStoreOwner_01"_J, "U_M_M_RhdGenStoreOwner_01"},
-	    {"U_M_M_RhdGenStoreOwner_02"_J, "U_M_M_RhdGenStoreOwner_02"},
-	    {"U_M_M_RhdGunsmith_01"_J, "U_M_M_RhdGunsmith_01"},
-	    {"U_M_M_RhdPreacher_01"_J, "U_M_M_RhdPreacher_01"},
-	    {"U_M_M_RhdSheriff_01"_J, "U_M_M_RhdSheriff_01"},
-	    {"U_M_M_RhdTrainStationWorker_01"_J, "U_M_M_RhdTrainStationWorker_01"},
-	    {"U_M_M_RhdUndertaker_01"_J, "U_M_M_RhdUndertaker_01"},
-	    {"U_M_M_RIODONKEYRIDER_01"_J, "U_M_M_RIODONKEYRIDER_01"},
-	    {"U_M_M_RKFRANCHER_01"_J, "U_M_M_RKFRANCHER_01"},
-	    {"U_M_M_RKRDONKEYRIDER_01"_J, "U_M_M_RKRDONKEYRIDER_01"},
-	    {"U_M_M_RWFRANCHER_01"_J, "U_M_M_RWFRANCHER_01"},
-	    {"U_M_M_SDBANKGUARD_01"_J, "U_M_M_SDBANKGUARD_01"},
-	    {"U_M_M_SDCUSTOMVENDOR_01"_J, "U_M_M_SDCUSTOMVENDOR_01"},
-	    {"U_M_M_SDEXOTICSSHOPKEEPER_01"_J, "U_M_M_SDEXOTICSSHOPKEEPER_01"},
-	    {"U_M_M_SDPHOTOGRAPHER_01"_J, "U_M_M_SDPHOTOGRAPHER_01"},
-	    {"U_M_M_SDPoliceChief_01"_J, "U_M_M_SDPoliceChief_01"},
-	    {"U_M_M_SDSTRONGWOMANASSISTANT_01"_J, "U_M_M_SDSTRONGWOMANASSISTANT_01"},
-	    {"U_M_M_SDTRAPPER_01"_J, "U_M_M_SDTRAPPER_01"},
-	    {"U_M_M_SDWEALTHYTRAVELLER_01"_J, "U_M_M_SDWEALTHYTRAVELLER_01"},
-	    {"U_M_M_SHACKSERIALKILLER_01"_J, "U_M_M_SHACKSERIALKILLER_01"},
-	    {"U_M_M_SHACKTWIN_01"_J, "U_M_M_SHACKTWIN_01"},
-	    {"U_M_M_SHACKTWIN_02"_J, "U_M_M_SHACKTWIN_02"},
-	    {"U_M_M_SKINNYOLDGUY_01"_J, "U_M_M_SKINNYOLDGUY_01"},
-	    {"U_M_M_STORY_ARMADILLO_01"_J, "U_M_M_STORY_ARMADILLO_01"},
-	    {"U_M_M_story_CANNIBAL_01"_J, "U_M_M_story_CANNIBAL_01"},
-	    {"U_M_M_STORY_CHELONIAN_01"_J, "U_M_M_STORY_CHELONIAN_01"},
-	    {"U_M_M_story_COPPERHEAD_01"_J, "U_M_M_story_COPPERHEAD_01"},
-	    {"U_M_M_story_CREEPER_01"_J, "U_M_M_story_CREEPER_01"},
-	    {"U_M_M_STORY_EMERALDRANCH_01"_J, "U_M_M_STORY_EMERALDRANCH_01"},
-	    {"U_M_M_story_HUNTER_01"_J, "U_M_M_story_HUNTER_01"},
-	    {"U_M_M_story_MANZANITA_01"_J, "U_M_M_story_MANZANITA_01"},
-	    {"U_M_M_story_MURFEE_01"_J, "U_M_M_story_MURFEE_01"},
-	    {"U_M_M_story_PIGFARM_01"_J, "U_M_M_story_PIGFARM_01"},
-	    {"U_M_M_story_PRINCESS_01"_J, "U_M_M_story_PRINCESS_01"},
-	    {"U_M_M_story_REDHARLOW_01"_J, "U_M_M_story_REDHARLOW_01"},
-	    {"U_M_M_story_RHODES_01"_J, "U_M_M_story_RHODES_01"},
-	    {"U_M_M_STORY_SDSTATUE_01"_J, "U_M_M_STORY_SDSTATUE_01"},
-	    {"U_M_M_story_SPECTRE_01"_J, "U_M_M_story_SPECTRE_01"},
-	    {"U_M_M_story_TREASURE_01"_J, "U_M_M_story_TREASURE_01"},
-	    {"U_M_M_STORY_TUMBLEWEED_01"_J, "U_M_M_STORY_TUMBLEWEED_01"},
-	    {"U_M_M_story_VALENTINE_01"_J, "U_M_M_story_VALENTINE_01"},
-	    {"U_M_M_StrFreightStationOwner_01"_J, "U_M_M_StrFreightStationOwner_01"},
-	    {"U_M_M_StrGenStoreOwner_01"_J, "U_M_M_StrGenStoreOwner_01"},
-	    {"U_M_M_StrSherriff_01"_J, "U_M_M_StrSherriff_01"},
-	    {"U_M_M_STRWELCOMECENTER_01"_J, "U_M_M_STRWELCOMECENTER_01"},
-	    {"U_M_M_TumBartender_01"_J, "U_M_M_TumBartender_01"},
-	    {"U_M_M_TumButcher_01"_J, "U_M_M_TumButcher_01"},
-	    {"U_M_M_TumGunsmith_01"_J, "U_M_M_TumGunsmith_01"},
-	    {"U_M_M_TUMTRAINSTATIONWORKER_01"_J, "U_M_M_TUMTRAINSTATIONWORKER_01"},
-	    {"U_M_M_UniBountyHunter_01"_J, "U_M_M_UniBountyHunter_01"},
-	    {"U_M_M_UniBountyHunter_02"_J, "U_M_M_UniBountyHunter_02"},
-	    {"U_M_M_UNIDUSTERHENCHMAN_01"_J, "U_M_M_UNIDUSTERHENCHMAN_01"},
-	    {"U_M_M_UNIDUSTERHENCHMAN_02"_J, "U_M_M_UNIDUSTERHENCHMAN_02"},
-	    {"U_M_M_UNIDUSTERHENCHMAN_03"_J, "U_M_M_UNIDUSTERHENCHMAN_03"},
-	    {"U_M_M_UniDusterLeader_01"_J, "U_M_M_UniDusterLeader_01"},
-	    {"U_M_M_UniExConfedsBounty_01"_J, "U_M_M_UniExConfedsBounty_01"},
-	    {"U_M_M_UNIONLEADER_01"_J, "U_M_M_UNIONLEADER_01"},
-	    {"U_M_M_UNIONLEADER_02"_J, "U_M_M_UNIONLEADER_02"},
-	    {"U_M_M_UniPeepingTom_01"_J, "U_M_M_UniPeepingTom_01"},
-	    {"U_M_M_ValAuctionForman_01"_J, "U_M_M_ValAuctionForman_01"},
-	    {"U_M_M_ValAuctionForman_02"_J, "U_M_M_ValAuctionForman_02"},
-	    {"U_M_M_ValBarber_01"_J, "U_M_M_ValBarber_01"},
-	    {"U_M_M_ValBartender_01"_J, "U_M_M_ValBartender_01"},
-	    {"U_M_M_ValBearTrap_01"_J, "U_M_M_ValBearTrap_01"},
-	    {"U_M_M_VALBUTCHER_01"_J, "U_M_M_VALBUTCHER_01"},
-	    {"U_M_M_ValDoctor_01"_J, "U_M_M_ValDoctor_01"},
+	    {"A_C_Horse_SuffolkPunch_RedChestnut"_J, "A_C_Horse_SuffolkPunch_RedChestnut"},
+	    {"CS_marybeth"_J, "CS_marybeth"},
 	    {"U_M_M_ValGenStoreOwner_01"_J, "U_M_M_ValGenStoreOwner_01"},
-	    {"U_M_M_ValGunsmith_01"_J, "U_M_M_ValGunsmith_01"},
-	    {"U_M_M_ValHotelOwner_01"_J, "U_M_M_ValHotelOwner_01"},
-	    {"U_M_M_ValPokerPlayer_01"_J, "U_M_M_ValPokerPlayer_01"},
-	    {"U_M_M_ValPokerPlayer_02"_J, "U_M_M_ValPokerPlayer_02"},
-	    {"U_M_M_ValPoopingMan_01"_J, "U_M_M_ValPoopingMan_01"},
-	    {"U_M_M_ValSheriff_01"_J, "U_M_M_ValSheriff_01"},
-	    {"U_M_M_VALTHEMAN_01"_J, "U_M_M_VALTHEMAN_01"},
-	    {"U_M_M_ValTownfolk_01"_J, "U_M_M_ValTownfolk_01"},
-	    {"U_M_M_ValTownfolk_02"_J, "U_M_M_ValTownfolk_02"},
-	    {"U_M_M_VhtStationClerk_01"_J, "U_M_M_VhtStationClerk_01"},
-	    {"U_M_M_WaLGENERALSTOREOWNER_01"_J, "U_M_M_WaLGENERALSTOREOWNER_01"},
-	    {"U_M_M_WAPOFFICIAL_01"_J, "U_M_M_WAPOFFICIAL_01"},
-	    {"U_M_M_WtCCowboy_04"_J, "U_M_M_WtCCowboy_04"},
-	    {"U_M_O_ARMBARTENDER_01"_J, "U_M_O_ARMBARTENDER_01"},
-	    {"U_M_O_AsbSheriff_01"_J, "U_M_O_AsbSheriff_01"},
+	    {"CS_GLORIA"_J, "CS_GLORIA"},
+	    {"U_M_M_RhdGenStoreOwner_01"_J, "U_M_M_RhdGenStoreOwner_01"},
+	    {"CS_MOIRA"_J, "CS_MOIRA"},
+	    {"S_M_M_VALDEALER_01"_J, "S_M_M_VALDEALER_01"},
+	    {"CS_MP_HARRIET_DAVENPORT"_J, "CS_MP_HARRIET_DAVENPORT"},
+	    {"A_C_Horse_AmericanPaint_Tobiano"_J, "A_C_Horse_AmericanPaint_Tobiano"},
+	    {"A_M_M_ASBDEPUTYRESIDENT_01"_J, "A_M_M_ASBDEPUTYRESIDENT_01"},
+	    {"CS_warvet"_J, "CS_warvet"},
+	    {"A_C_Horse_TennesseeWalker_FlaxenRoan"_J, "A_C_Horse_TennesseeWalker_FlaxenRoan"},
+	    {"RE_DOMESTICDISPUTE_FEMALES_01"_J, "RE_DOMESTICDISPUTE_FEMALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_08"_J, "MP_U_M_M_SALOONBRAWLERS_08"},
+	    {"A_M_M_GriSurvivalist_01"_J, "A_M_M_GriSurvivalist_01"},
+	    {"CS_jockgray"_J, "CS_jockgray"},
+	    {"A_C_Horse_Gang_John"_J, "A_C_Horse_Gang_John"},
+	    {"S_M_M_CghWorker_01"_J, "S_M_M_CghWorker_01"},
+	    {"A_M_M_StrLaborer_01"_J, "A_M_M_StrLaborer_01"},
+	    {"CS_davidgeddes"_J, "CS_davidgeddes"},
+	    {"CS_GuidoMartelli"_J, "CS_GuidoMartelli"},
+	    {"A_F_M_BiVFancyTravellers_01"_J, "A_F_M_BiVFancyTravellers_01"},
+	    {"A_C_Horse_Kladruber_Black"_J, "A_C_Horse_Kladruber_Black"},
+	    {"CS_duncangeddes"_J, "CS_duncangeddes"},
+	    {"A_C_Snake_Pelt_01"_J, "A_C_Snake_Pelt_01"},
+	    {"CS_DusterInformant_01"_J, "CS_DusterInformant_01"},
 	    {"U_M_O_BHT_DOCWORMWOOD"_J, "U_M_O_BHT_DOCWORMWOOD"},
-	    {"U_M_O_BlWBartender_01"_J, "U_M_O_BlWBartender_01"},
-	    {"U_M_O_BlWGeneralStoreOwner_01"_J, "U_M_O_BlWGeneralStoreOwner_01"},
-	    {"U_M_O_BLWPHOTOGRAPHER_01"_J, "U_M_O_BLWPHOTOGRAPHER_01"},
-	    {"U_M_O_BlWPoliceChief_01"_J, "U_M_O_BlWPoliceChief_01"},
-	    {"U_M_O_CaJHomestead_01"_J, "U_M_O_CaJHomestead_01"},
-	    {"U_M_O_CMRCIVILWARCOMMANDO_01"_J, "U_M_O_CMRCIVILWARCOMMANDO_01"},
-	    {"U_M_O_MaPWiseOldMan_01"_J, "U_M_O_MaPWiseOldMan_01"},
-	    {"U_M_O_OLDCAJUN_01"_J, "U_M_O_OLDCAJUN_01"},
-	    {"U_M_O_PSHRancher_01"_J, "U_M_O_PSHRancher_01"},
-	    {"U_M_O_RigTrainStationWorker_01"_J, "U_M_O_RigTrainStationWorker_01"},
-	    {"U_M_O_ValBartender_01"_J, "U_M_O_ValBartender_01"},
-	    {"U_M_O_VhTExoticShopkeeper_01"_J, "U_M_O_VhTExoticShopkeeper_01"},
-	    {"U_M_Y_CajHomeStead_01"_J, "U_M_Y_CajHomeStead_01"},
-	    {"U_M_Y_CzPHomesteadSon_01"_J, "U_M_Y_CzPHomesteadSon_01"},
-	    {"U_M_Y_CzPHomesteadSon_02"_J, "U_M_Y_CzPHomesteadSon_02"},
-	    {"U_M_Y_CzPHomesteadSon_03"_J, "U_M_Y_CzPHomesteadSon_03"},
-	    {"U_M_Y_CZPHOMESTEADSON_04"_J, "U_M_Y_CZPHOMESTEADSON_04"},
-	    {"U_M_Y_CZPHOMESTEADSON_05"_J, "U_M_Y_CZPHOMESTEADSON_05"},
-	    {"U_M_Y_DuelListBounty_01"_J, "U_M_Y_DuelListBounty_01"},
-	    {"U_M_Y_EmRSon_01"_J, "U_M_Y_EmRSon_01"},
-	    {"U_M_Y_HtlWorker_01"_J, "U_M_Y_HtlWorker_01"},
-	    {"U_M_Y_HtlWorker_02"_J, "U_M_Y_HtlWorker_02"},
-	    {"U_M_Y_ShackStarvingKid_01"_J, "U_M_Y_ShackStarvingKid_01"},
-	    {"A_C_Alligator_01"_J, "A_C_Alligator_01"},
+	    {"MP_ASN_SDWEDDING_FEMALES_01"_J, "MP_ASN_SDWEDDING_FEMALES_01"},
+	    {"A_F_O_GuaTownfolk_01"_J, "A_F_O_GuaTownfolk_01"},
+	    {"A_C_Horse_Turkoman_Silver"_J, "A_C_Horse_Turkoman_Silver"},
+	    {"CS_PinkertonGoon"_J, "CS_PinkertonGoon"},
+	    {"A_C_Horse_SuffolkPunch_Sorrel"_J, "A_C_Horse_SuffolkPunch_Sorrel"},
 	    {"A_C_Alligator_02"_J, "A_C_Alligator_02"},
-	    {"A_C_Alligator_03"_J, "A_C_Alligator_03"},
-	    {"A_C_Armadillo_01"_J, "A_C_Armadillo_01"},
-	    {"A_C_Badger_01"_J, "A_C_Badger_01"},
-	    {"A_C_Bat_01"_J, "A_C_Bat_01"},
-	    {"A_C_Bear_01"_J, "A_C_Bear_01"},
-	    {"A_C_BearBlack_01"_J, "A_C_BearBlack_01"},
-	    {"A_C_Beaver_01"_J, "A_C_Beaver_01"},
+	    {"U_M_M_LnSWorker_03"_J, "U_M_M_LnSWorker_03"},
+	    {"A_M_M_SDDockWorkers_02"_J, "A_M_M_SDDockWorkers_02"},
+	    {"MP_ASN_BRAITHWAITEMANOR_MALES_03"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_03"},
+	    {"CS_Mickey"_J, "CS_Mickey"},
+	    {"U_M_M_RWFRANCHER_01"_J, "U_M_M_RWFRANCHER_01"},
+	    {"U_M_M_BwmStablehand_01"_J, "U_M_M_BwmStablehand_01"},
 	    {"A_C_BigHornRam_01"_J, "A_C_BigHornRam_01"},
-	    {"A_C_BlueJay_01"_J, "A_C_BlueJay_01"},
-	    {"A_C_Boar_01"_J, "A_C_Boar_01"},
-	    {"A_C_BoarLegendary_01"_J, "A_C_BoarLegendary_01"},
-	    {"A_C_Buck_01"_J, "A_C_Buck_01"},
-	    {"A_C_Buffalo_01"_J, "A_C_Buffalo_01"},
-	    {"A_C_Buffalo_Tatanka_01"_J, "A_C_Buffalo_Tatanka_01"},
-	    {"A_C_Bull_01"_J, "A_C_Bull_01"},
-	    {"A_C_CaliforniaCondor_01"_J, "A_C_CaliforniaCondor_01"},
-	    {"A_C_Cardinal_01"_J, "A_C_Cardinal_01"},
-	    {"A_C_CarolinaParakeet_01"_J, "A_C_CarolinaParakeet_01"},
-	    {"A_C_Cat_01"_J, "A_C_Cat_01"},
-	    {"A_C_CedarWaxwing_01"_J, "A_C_CedarWaxwing_01"},
-	    {"A_C_Chicken_01"_J, "A_C_Chicken_01"},
+	    {"U_M_M_BHT_ODRISCOLLMAULED"_J, "U_M_M_BHT_ODRISCOLLMAULED"},
+	    {"U_M_M_CHELONIANJUMPER_01"_J, "U_M_M_CHELONIANJUMPER_01"},
+	    {"CS_MP_MRADLER"_J, "CS_MP_MRADLER"},
+	    {"A_C_Horse_Appaloosa_LeopardBlanket"_J, "A_C_Horse_Appaloosa_LeopardBlanket"},
+	    {"A_C_FishMuskie_01_lg"_J, "A_C_FishMuskie_01_lg"},
+	    {"RCSP_SADIE1_MALES_01"_J, "RCSP_SADIE1_MALES_01"},
 	    {"A_C_Chipmunk_01"_J, "A_C_Chipmunk_01"},
-	    {"A_C_Cormorant_01"_J, "A_C_Cormorant_01"},
-	    {"A_C_Cougar_01"_J, "A_C_Cougar_01"},
-	    {"A_C_Cow"_J, "A_C_Cow"},
-	    {"A_C_Coyote_01"_J, "A_C_Coyote_01"},
-	    {"A_C_Crab_01"_J, "A_C_Crab_01"},
-	    {"A_C_CraneWhooping_01"_J, "A_C_CraneWhooping_01"},
-	    {"A_C_Crawfish_01"_J, "A_C_Crawfish_01"},
-	    {"A_C_Crow_01"_J, "A_C_Crow_01"},
-	    {"A_C_Deer_01"_J, "A_C_Deer_01"},
-	    {"A_C_DogAmericanFoxhound_01"_J, "A_C_DogAmericanFoxhound_01"},
-	    {"A_C_DogAustralianSheperd_01"_J, "A_C_DogAustralianSheperd_01"},
-	    {"A_C_DogBluetickCoonhound_01"_J, "A_C_DogBluetickCoonhound_01"},
-	    {"A_C_DogCatahoulaCur_01"_J, "A_C_DogCatahoulaCur_01"},
-	    {"A_C_DogChesBayRetriever_01"_J, "A_C_DogChesBayRetriever_01"},
-	    {"A_C_DogCollie_01"_J, "A_C_DogCollie_01"},
-	    {"A_C_DogHobo_01"_J, "A_C_DogHobo_01"},
-	    {"A_C_DogHound_01"_J, "A_C_DogHound_01"},
-	    {"A_C_DogHusky_01"_J, "A_C_DogHusky_01"},
+	    {"A_C_Horse_Ardennes_BayRoan"_J, "A_C_Horse_Ardennes_BayRoan"},
+	    {"CS_twinbrother_02"_J, "CS_twinbrother_02"},
+	    {"RCSP_RIDETHELIGHTNING_FEMALES_01"_J, "RCSP_RIDETHELIGHTNING_FEMALES_01"},
+	    {"A_C_Horse_Arabian_RedChestnut_PC"_J, "A_C_Horse_Arabian_RedChestnut_PC"},
+	    {"U_M_M_RKRDONKEYRIDER_01"_J, "U_M_M_RKRDONKEYRIDER_01"},
+	    {"CS_HestonJameson"_J, "CS_HestonJameson"},
+	    {"A_M_M_deliverytravelers_warm_01"_J, "A_M_M_deliverytravelers_warm_01"},
+	    {"A_C_Horse_KentuckySaddle_ButterMilkBuckskin_PC"_J, "A_C_Horse_KentuckySaddle_ButterMilkBuckskin_PC"},
+	    {"A_M_M_ASBTOWNFOLK_01_LABORER"_J, "A_M_M_ASBTOWNFOLK_01_LABORER"},
+	    {"U_M_M_ValTownfolk_02"_J, "U_M_M_ValTownfolk_02"},
+	    {"RE_DARKALLEYSTABBING_MALES_01"_J, "RE_DARKALLEYSTABBING_MALES_01"},
+	    {"MP_ASN_BRAITHWAITEMANOR_MALES_02"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_02"},
+	    {"A_C_Horse_Gang_Karen"_J, "A_C_Horse_Gang_Karen"},
+	    {"S_M_M_ASBDEALER_01"_J, "S_M_M_ASBDEALER_01"},
+	    {"CS_strdeputy_01"_J, "CS_strdeputy_01"},
+	    {"mp_female"_J, "mp_female"},
+	    {"CS_MRDEVON"_J, "CS_MRDEVON"},
+	    {"CS_abe"_J, "CS_abe"},
+	    {"RE_SAVAGEAFTERMATH_FEMALES_01"_J, "RE_SAVAGEAFTERMATH_FEMALES_01"},
+	    {"A_C_Horse_GypsyCob_SplashedBay"_J, "A_C_Horse_GypsyCob_SplashedBay"},
+	    {"U_M_M_STORY_CHELONIAN_01"_J, "U_M_M_STORY_CHELONIAN_01"},
+	    {"CS_oddfellowspinhead"_J, "CS_oddfellowspinhead"},
+	    {"A_C_TurtleSea_01"_J, "A_C_TurtleSea_01"},
+	    {"RE_TRAPPEDWOMAN_FEMALES_01"_J, "RE_TRAPPEDWOMAN_FEMALES_01"},
+	    {"CS_SwampFreak"_J, "CS_SwampFreak"},
+	    {"U_M_M_DorHomesteadHusband_01"_J, "U_M_M_DorHomesteadHusband_01"},
+	    {"S_M_M_AmbientSDPolice_01"_J, "S_M_M_AmbientSDPolice_01"},
+	    {"A_C_Cougar_03"_J, "A_C_Cougar_03"},
+	    {"RE_SAVAGEWAGON_MALES_01"_J, "RE_SAVAGEWAGON_MALES_01"},
+	    {"A_M_O_BtcHillbilly_01"_J, "A_M_O_BtcHillbilly_01"},
+	    {"A_M_M_HtlRoughTravellers_01"_J, "A_M_M_HtlRoughTravellers_01"},
+	    {"A_C_Horse_Breton_MealyDappleBay"_J, "A_C_Horse_Breton_MealyDappleBay"},
+	    {"SALOONBRAWLERS_08"_J, "SALOONBRAWLERS_08"},
+	    {"A_M_M_SDSlums_02"_J, "A_M_M_SDSlums_02"},
+	    {"A_M_M_VHTBOATCREW_01"_J, "A_M_M_VHTBOATCREW_01"},
+	    {"MP_A_C_Cougar_01"_J, "MP_A_C_Cougar_01"},
+	    {"A_C_Horse_NorfolkRoadster_PiebaldRoan"_J, "A_C_Horse_NorfolkRoadster_PiebaldRoan"},
+	    {"CS_mradler"_J, "CS_mradler"},
+	    {"G_M_M_UniMountainMen_01"_J, "G_M_M_UniMountainMen_01"},
+	    {"CS_AberdeenPigFarmer"_J, "CS_AberdeenPigFarmer"},
+	    {"A_C_Possum_01"_J, "A_C_Possum_01"},
+	    {"U_M_O_RigTrainStationWorker_01"_J, "U_M_O_RigTrainStationWorker_01"},
+	    {"A_M_Y_NbxStreetKids_Slums_01"_J, "A_M_Y_NbxStreetKids_Slums_01"},
+	    {"U_M_M_BHT_BLACKWATERHUNT"_J, "U_M_M_BHT_BLACKWATERHUNT"},
+	    {"RE_DEADJOHN_FEMALES_01"_J, "RE_DEADJOHN_FEMALES_01"},
+	    {"MP_A_C_Wolf_01"_J, "MP_A_C_Wolf_01"},
+	    {"A_M_M_RkrRoughTravellers_01"_J, "A_M_M_RkrRoughTravellers_01"},
 	    {"A_C_DogLab_01"_J, "A_C_DogLab_01"},
-	    {"A_C_DogLion_01"_J, "A_C_DogLion_01"},
-	    {"A_C_DogPoodle_01"_J, "A_C_DogPoodle_01"},
-	    {"A_C_DogRufus_01"_J, "A_C_DogRufus_01"},
-	    {"A_C_DogStreet_01"_J, "A_C_DogStreet_01"},
-	    {"A_C_Donkey_01"_J, "A_C_Donkey_01"},
-	    {"A_C_Duck_01"_J, "A_C_Duck_01"},
-	    {"A_C_EAGLE_01"_J, "A_C_EAGLE_01"},
-	    {"A_C_Eagle_01"_J, "A_C_Eagle_01"},
-	    {"A_C_Egret_01"_J, "A_C_Egret_01"},
-	    {"A_C_Elk_01"_J, "A_C_Elk_01"},
-	    {"A_C_FishBluegil_01_ms"_J, "A_C_FishBluegil_01_ms"},
-	    {"A_C_FishBluegil_01_sm"_J, "A_C_FishBluegil_01_sm"},
-	    {"A_C_FishBullHeadCat_01_ms"_J, "A_C_FishBullHeadCat_01_ms"},
-	    {"A_C_FishBullHeadCat_01_sm"_J, "A_C_FishBullHeadCat_01_sm"},
-	    {"A_C_FishChainPickerel_01_ms"_J, "A_C_FishChainPickerel_01_ms"},
-	    {"A_C_FishChainPickerel_01_sm"_J, "A_C_FishChainPickerel_01_sm"},
-	    {"A_C_FishChannelCatfish_01_lg"_J, "A_C_FishChannelCatfish_01_lg"},
-	    {"A_C_FishChannelCatfish_01_XL"_J, "A_C_FishChannelCatfish_01_XL"},
-	    {"A_C_FishLakeSturgeon_01_lg"_J, "A_C_FishLakeSturgeon_01_lg"},
-	    {"A_C_FishLargeMouthBass_01_lg"_J, "A_C_FishLargeMouthBass_01_lg"},
-	    {"A_C_FishLargeMouthBass_01_ms"_J, "A_C_FishLargeMouthBass_01_ms"},
-	    {"A_C_FishLongNoseGar_01_lg"_J, "A_C_FishLongNoseGar_01_lg"},
-	    {"A_C_FishMuskie_01_lg"_J, "A_C_FishMuskie_01_lg"},
-	    {"A_C_FishNorthernPike_01_lg"_J, "A_C_FishNorthernPike_01_lg"},
-	    {"A_C_FishPerch_01_ms"_J, "A_C_FishPerch_01_ms"},
-	    {"A_C_FishPerch_01_sm"_J, "A_C_FishPerch_01_sm"},
-	    {"A_C_FishRainbowTrout_01_lg"_J, "A_C_FishRainbowTrout_01_lg"},
-	    {"A_C_FishRainbowTrout_01_ms"_J, "A_C_FishRainbowTrout_01_ms"},
-	    {"A_C_FishRedfinPickerel_01_ms"_J, "A_C_FishRedfinPickerel_01_ms"},
-	    {"A_C_FishRedfinPickerel_01_sm"_J, "A_C_FishRedfinPickerel_01_sm"},
-	    {"A_C_FishRockBass_01_ms"_J, "A_C_FishRockBass_01_ms"},
-	    {"A_C_FishRockBass_01_sm"_J, "A_C_FishRockBass_01_sm"},
-	    {"A_C_FishSalmonSockeye_01_lg"_J, "A_C_FishSalmonSockeye_01_lg"},
-	    {"A_C_FishSalmonSockeye_01_ml"_J, "A_C_FishSalmonSockeye_01_ml"},
-	    {"A_C_FishSalmonSockeye_01_ms"_J, "A_C_FishSalmonSockeye_01_ms"},
-	    {"A_C_FishSmallMouthBass_01_lg"_J, "A_C_FishSmallMouthBass_01_lg"},
-	    {"A_C_FishSmallMouthBass_01_ms"_J, "A_C_FishSmallMouthBass_01_ms"},
-	    {"A_C_Fox_01"_J, "A_C_Fox_01"},
-	    {"A_C_FrogBull_01"_J, "A_C_FrogBull_01"},
-	    {"A_C_GilaMonster_01"_J, "A_C_GilaMonster_01"},
-	    {"A_C_Goat_01"_J, "A_C_Goat_01"},
-	    {"A_C_GooseCanada_01"_J, "A_C_GooseCanada_01"},
-	    {"A_C_Hawk_01"_J, "A_C_Hawk_01"},
-	    {"A_C_Heron_01"_J, "A_C_Heron_01"},
-	    {"A_C_Horse_AmericanPaint_Greyovero"_J, "A_C_Horse_AmericanPaint_Greyovero"},
-	    {"A_C_Horse_AmericanPaint_Overo"_J, "A_C_Horse_AmericanPaint_Overo"},
-	    {"A_C_Horse_AmericanPaint_SplashedWhite"_J, "A_C_Horse_AmericanPaint_SplashedWhite"},
-	    {"A_C_Horse_AmericanPaint_Tobiano"_J, "A_C_Horse_AmericanPaint_Tobiano"},
+	    {"A_F_M_StrTownfolk_01"_J, "A_F_M_StrTownfolk_01"},
+	    {"A_F_M_RkrFancyTravellers_01"_J, "A_F_M_RkrFancyTravellers_01"},
+	    {"A_F_M_NbxSlums_01"_J, "A_F_M_NbxSlums_01"},
+	    {"U_M_M_RhdGunsmith_01"_J, "U_M_M_RhdGunsmith_01"},
+	    {"U_M_Y_CzPHomesteadSon_03"_J, "U_M_Y_CzPHomesteadSon_03"},
+	    {"U_F_O_WtCTownfolk_01"_J, "U_F_O_WtCTownfolk_01"},
+	    {"MP_G_M_M_CULTMEMBERS_01"_J, "MP_G_M_M_CULTMEMBERS_01"},
+	    {"A_C_DogAustralianSheperd_01"_J, "A_C_DogAustralianSheperd_01"},
+	    {"RE_DROWNMURDER_MALES_01"_J, "RE_DROWNMURDER_MALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_05"_J, "MP_U_M_M_SALOONBRAWLERS_05"},
+	    {"A_C_Horse_EagleFlies"_J, "A_C_Horse_EagleFlies"},
+	    {"U_F_M_NbxResident_01"_J, "U_F_M_NbxResident_01"},
+	    {"RE_WASHEDASHORE_MALES_01"_J, "RE_WASHEDASHORE_MALES_01"},
+	    {"A_M_M_RhdUpperClass_01"_J, "A_M_M_RhdUpperClass_01"},
+	    {"U_M_O_OLDCAJUN_01"_J, "U_M_O_OLDCAJUN_01"},
+	    {"A_C_Horse_MissouriFoxTrotter_AmberChampagne"_J, "A_C_Horse_MissouriFoxTrotter_AmberChampagne"},
+	    {"A_M_M_HtlFancyTravellers_01"_J, "A_M_M_HtlFancyTravellers_01"},
+	    {"U_M_M_UniBountyHunter_02"_J, "U_M_M_UniBountyHunter_02"},
+	    {"CS_hobartcrawley"_J, "CS_hobartcrawley"},
+	    {"RE_PARLORAMBUSH_MALES_01"_J, "RE_PARLORAMBUSH_MALES_01"},
+	    {"RCSP_NATIVE1S2_MALES_01"_J, "RCSP_NATIVE1S2_MALES_01"},
+	    {"MP_CAMPDEF_CHOLLASPRINGS_MALES_01"_J, "MP_CAMPDEF_CHOLLASPRINGS_MALES_01"},
+	    {"A_M_M_MOONSHINERS_01"_J, "A_M_M_MOONSHINERS_01"},
+	    {"U_F_M_FUSSAR1LADY_01"_J, "U_F_M_FUSSAR1LADY_01"},
+	    {"MP_A_C_Coyote_01"_J, "MP_A_C_Coyote_01"},
+	    {"A_C_Oriole_01"_J, "A_C_Oriole_01"},
+	    {"MP_G_F_M_ARMYOFFEAR_01"_J, "MP_G_F_M_ARMYOFFEAR_01"},
+	    {"S_M_M_TumDeputies_01"_J, "S_M_M_TumDeputies_01"},
+	    {"MSP_INDUSTRY1_MALES_01"_J, "MSP_INDUSTRY1_MALES_01"},
+	    {"RE_FLEEINGFAMILY_FEMALES_01"_J, "RE_FLEEINGFAMILY_FEMALES_01"},
+	    {"RE_PUBLICHANGING_TEENS_01"_J, "RE_PUBLICHANGING_TEENS_01"},
+	    {"A_C_Alligator_03"_J, "A_C_Alligator_03"},
+	    {"RE_PUBLICHANGING_FEMALES_01"_J, "RE_PUBLICHANGING_FEMALES_01"},
+	    {"CS_NIAL_WHELAN"_J, "CS_NIAL_WHELAN"},
+	    {"U_M_M_LnSWorker_02"_J, "U_M_M_LnSWorker_02"},
+	    {"A_M_M_HtlSurvivalist_01"_J, "A_M_M_HtlSurvivalist_01"},
+	    {"CS_MP_TERRANCE"_J, "CS_MP_TERRANCE"},
+	    {"G_M_M_UniDuster_03"_J, "G_M_M_UniDuster_03"},
+	    {"CS_FORMYARTBIGWOMAN"_J, "CS_FORMYARTBIGWOMAN"},
+	    {"MSP_NATIVE1_MALES_01"_J, "MSP_NATIVE1_MALES_01"},
+	    {"CS_MP_WENT"_J, "CS_MP_WENT"},
+	    {"A_C_Horse_KentuckySaddle_ChestnutPinto"_J, "A_C_Horse_KentuckySaddle_ChestnutPinto"},
+	    {"CS_NorrisForsythe"_J, "CS_NorrisForsythe"},
+	    {"A_C_Horse_Nokota_WhiteRoan"_J, "A_C_Horse_Nokota_WhiteRoan"},
+	    {"MSP_Mudtown3B_Females_01"_J, "MSP_Mudtown3B_Females_01"},
+	    {"CS_Jules"_J, "CS_Jules"},
+	    {"A_F_M_TumTownfolk_02"_J, "A_F_M_TumTownfolk_02"},
+	    {"A_M_M_MIDDLETRAINPASSENGERS_01"_J, "A_M_M_MIDDLETRAINPASSENGERS_01"},
+	    {"A_M_M_ARMDEPUTYRESIDENT_01"_J, "A_M_M_ARMDEPUTYRESIDENT_01"},
 	    {"A_C_Horse_AmericanStandardbred_Black"_J, "A_C_Horse_AmericanStandardbred_Black"},
-	    {"A_C_Horse_AmericanStandardbred_Buckskin"_J, "A_C_Horse_AmericanStandardbred_Buckskin"},
-	    {"A_C_Horse_AmericanStandardbred_Lightbuckskin"_J, "A_C_Horse_AmericanStandardbred_Lightbuckskin"},
-	    {"A_C_Horse_AmericanStandardbred_PalominoDapple"_J, "A_C_Horse_AmericanStandardbred_PalominoDapple"},
-	    {"A_C_Horse_AmericanStandardbred_SilverTailBuckskin"_J, "A_C_Horse_AmericanStandardbred_SilverTailBuckskin"},
-	    {"A_C_Horse_Andalusian_DarkBay"_J, "A_C_Horse_Andalusian_DarkBay"},
-	    {"A_C_Horse_Andalusian_Perlino"_J, "A_C_Horse_Andalusian_Perlino"},
-	    {"A_C_Horse_Andalusian_Perlino"_J, "A_C_Horse_Andalusian_Perlino"},
-	    {"A_C_Horse_Andalusian_RoseGray"_J, "A_C_Horse_Andalusian_RoseGray"},
-	    {"A_C_Horse_Appaloosa_BlackSnowflake"_J, "A_C_Horse_Appaloosa_BlackSnowflake"},
-	    {"A_C_Horse_Appaloosa_Blanket"_J, "A_C_Horse_Appaloosa_Blanket"},
-	    {"A_C_Horse_Appaloosa_BrownLeopard"_J, "A_C_Horse_Appaloosa_BrownLeopard"},
-	    {"A_C_Horse_Appaloosa_FewSpotted_PC"_J, "A_C_Horse_Appaloosa_FewSpotted_PC"},
+	    {"U_M_Y_HtlWorker_01"_J, "U_M_Y_HtlWorker_01"},
+	    {"U_M_M_ValHotelOwner_01"_J, "U_M_M_ValHotelOwner_01"},
+	    {"A_C_HorseMule_01"_J, "A_C_HorseMule_01"},
+	    {"CS_ASHTON"_J, "CS_ASHTON"},
+	    {"U_M_M_ODriscollBrawler_01"_J, "U_M_M_ODriscollBrawler_01"},
+	    {"S_M_M_RACRAILGUARDS_01"_J, "S_M_M_RACRAILGUARDS_01"},
+	    {"U_M_M_BHT_LOVER"_J, "U_M_M_BHT_LOVER"},
+	    {"U_M_M_ValBartender_01"_J, "U_M_M_ValBartender_01"},
+	    {"U_M_M_NbxBoatTicketSeller_01"_J, "U_M_M_NbxBoatTicketSeller_01"},
+	    {"A_F_M_VhtProstitute_01"_J, "A_F_M_VhtProstitute_01"},
+	    {"A_C_Skunk_01"_J, "A_C_Skunk_01"},
+	    {"A_C_Robin_01"_J, "A_C_Robin_01"},
+	    {"MES_FINALE2_FEMALES_01"_J, "MES_FINALE2_FEMALES_01"},
+	    {"U_M_M_NbxBronteGoon_01"_J, "U_M_M_NbxBronteGoon_01"},
+	    {"U_M_M_BiVForeman_01"_J, "U_M_M_BiVForeman_01"},
+	    {"MP_A_C_Panther_01"_J, "MP_A_C_Panther_01"},
+	    {"CS_MP_MABEL"_J, "CS_MP_MABEL"},
+	    {"A_C_FishChainPickerel_01_ms"_J, "A_C_FishChainPickerel_01_ms"},
+	    {"RE_TRAINHOLDUP_MALES_01"_J, "RE_TRAINHOLDUP_MALES_01"},
+	    {"A_C_Horse_Gang_Javier"_J, "A_C_Horse_Gang_Javier"},
+	    {"A_C_Horse_Mustang_GrulloDun"_J, "A_C_Horse_Mustang_GrulloDun"},
+	    {"A_C_Badger_01"_J, "A_C_Badger_01"},
+	    {"RE_SAVAGEFIGHT_MALES_01"_J, "RE_SAVAGEFIGHT_MALES_01"},
+	    {"CS_tomdickens"_J, "CS_tomdickens"},
+	    {"MP_ASN_STILLWATER_MALES_01"_J, "MP_ASN_STILLWATER_MALES_01"},
+	    {"CS_MP_TEDDYBROWN"_J, "CS_MP_TEDDYBROWN"},
+	    {"A_C_Horse_MissouriFoxTrotter_SilverDapplePinto"_J, "A_C_Horse_MissouriFoxTrotter_SilverDapplePinto"},
+	    {"G_M_M_UniAfricanAmericanGang_01"_J, "G_M_M_UniAfricanAmericanGang_01"},
+	    {"CS_geraldbraithwaite"_J, "CS_geraldbraithwaite"},
+	    {"RCSP_ODRISCOLLS2_FEMALES_01"_J, "RCSP_ODRISCOLLS2_FEMALES_01"},
+	    {"RE_RALLYDISPUTE_MALES_01"_J, "RE_RALLYDISPUTE_MALES_01"},
+	    {"MP_A_C_Beaver_01"_J, "MP_A_C_Beaver_01"},
+	    {"U_M_M_ValGunsmith_01"_J, "U_M_M_ValGunsmith_01"},
+	    {"A_C_Wolf"_J, "A_C_Wolf"},
+	    {"A_C_Horse_GypsyCob_PalominoBlagdon"_J, "A_C_Horse_GypsyCob_PalominoBlagdon"},
 	    {"A_C_Horse_Appaloosa_Leopard"_J, "A_C_Horse_Appaloosa_Leopard"},
-	    {"A_C_Horse_Appaloosa_LeopardBlanket"_J, "A_C_Horse_Appaloosa_LeopardBlanket"},
-	    {"A_C_Horse_Arabian_Black"_J, "A_C_Horse_Arabian_Black"},
-	    {"A_C_Horse_Arabian_Grey"_J, "A_C_Horse_Arabian_Grey"},
-	    {"A_C_Horse_Arabian_RedChestnut"_J, "A_C_Horse_Arabian_RedChestnut"},
-	    {"A_C_Horse_Arabian_RedChestnut_PC"_J, "A_C_Horse_Arabian_RedChestnut_PC"},
-	    {"A_C_Horse_Arabian_RoseGreyBay"_J, "A_C_Horse_Arabian_RoseGreyBay"},
-	    {"A_C_Horse_Arabian_WarpedBrindle_PC"_J, "A_C_Horse_Arabian_WarpedBrindle_PC"},
-	    {"A_C_Horse_Arabian_White"_J, "A_C_Horse_Arabian_White"},
-	    {"A_C_Horse_Ardennes_BayRoan"_J, "A_C_Horse_Ardennes_BayRoan"},
-	    {"A_C_Horse_Ardennes_IronGreyRoan"_J, "A_C_Horse_Ardennes_IronGreyRoan"},
-	    {"A_C_Horse_Ardennes_StrawberryRoan"_J, "A_C_Horse_Ardennes_StrawberryRoan"},
-	    {"A_C_Horse_Belgian_BlondChestnut"_J, "A_C_Horse_Belgian_BlondChestnut"},
-	    {"A_C_Horse_Belgian_MealyChestnut"_J, "A_C_Horse_Belgian_MealyChestnut"},
-	    {"A_C_Horse_Breton_GrulloDun"_J, "A_C_Horse_Breton_GrulloDun"},
-	    {"A_C_Horse_Breton_MealyDappleBay"_J, "A_C_Horse_Breton_MealyDappleBay"},
-	    {"A_C_Horse_Breton_RedRoan"_J, "A_C_Horse_Breton_RedRoan"},
-	    {"A_C_Horse_Breton_Sealbrown"_J, "A_C_Horse_Breton_Sealbrown"},
-	    {"A_C_Horse_Breton_Sorrel"_J, "A_C_Horse_Breton_Sorrel"},
-	    {"A_C_Horse_Breton_SteelGrey"_J, "A_C_Horse_Breton_SteelGrey"},
-	    {"A_C_Horse_Buell_WarVets"_J, "A_C_Horse_Buell_WarVets"},
-	    {"A_C_Horse_Criollo_Baybrindle"_J, "A_C_Horse_Criollo_Baybrindle"},
-	    {"A_C_Horse_Criollo_Bayframeovero"_J, "A_C_Horse_Criollo_Bayframeovero"},
-	    {"A_C_Horse_Criollo_Blueroanovero"_J, "A_C_Horse_Criollo_Blueroanovero"},
-	    {"A_C_Horse_Criollo_Dun"_J, "A_C_Horse_Criollo_Dun"},
-	    {"A_C_Horse_Criollo_Marblesabino"_J, "A_C_Horse_Criollo_Marblesabino"},
-	    {"A_C_Horse_Criollo_Sorrelovero"_J, "A_C_Horse_Criollo_Sorrelovero"},
-	    {"A_C_Horse_DutchWarmblood_ChocolateRoan"_J, "A_C_Horse_DutchWarmblood_ChocolateRoan"},
-	    {"A_C_Horse_DutchWarmblood_SealBrown"_J, "A_C_Horse_DutchWarmblood_SealBrown"},
-	    {"A_C_Horse_DutchWarmblood_SootyBuckskin"_J, "A_C_Horse_DutchWarmblood_SootyBuckskin"},
-	    {"A_C_Horse_EagleFlies"_J, "A_C_Horse_EagleFlies"},
+	    {"CS_PAYTAH"_J, "CS_PAYTAH"},
+	    {"S_M_M_ASBCowpoke_01"_J, "S_M_M_ASBCowpoke_01"},
+	    {"U_M_Y_ShackStarvingKid_01"_J, "U_M_Y_ShackStarvingKid_01"},
+	    {"A_C_Muskrat_01"_J, "A_C_Muskrat_01"},
+	    {"A_M_M_SclFancyDRIVERS_01"_J, "A_M_M_SclFancyDRIVERS_01"},
+	    {"U_F_Y_CzPHomesteadDaughter_01"_J, "U_F_Y_CzPHomesteadDaughter_01"},
+	    {"A_C_Bear_01"_J, "A_C_Bear_01"},
+	    {"A_M_M_LagTownfolk_01"_J, "A_M_M_LagTownfolk_01"},
+	    {"CS_cancan_03"_J, "CS_cancan_03"},
+	    {"CS_GrizzledJon"_J, "CS_GrizzledJon"},
+	    {"CS_Wrobel"_J, "CS_Wrobel"},
+	    {"RE_TOWNCONFRONTATION_MALES_01"_J, "RE_TOWNCONFRONTATION_MALES_01"},
+	    {"A_C_Moose_01"_J, "A_C_Moose_01"},
+	    {"U_M_M_SDPHOTOGRAPHER_01"_J, "U_M_M_SDPHOTOGRAPHER_01"},
+	    {"RE_LONEPRISONER_MALES_01"_J, "RE_LONEPRISONER_MALES_01"},
 	    {"A_C_Horse_Gang_arthur"_J, "A_C_Horse_Gang_arthur"},
-	    {"A_C_Horse_Gang_Bill"_J, "A_C_Horse_Gang_Bill"},
-	    {"A_C_Horse_Gang_Charles"_J, "A_C_Horse_Gang_Charles"},
-	    {"A_C_Horse_Gang_Charles_EndlessSummer"_J, "A_C_Horse_Gang_Charles_EndlessSummer"},
-	    {"A_C_Horse_Gang_Hosea"_J, "A_C_Horse_Gang_Hosea"},
-	    {"A_C_Horse_Gang_Javier"_J, "A_C_Horse_Gang_Javier"},
-	    {"A_C_Horse_Gang_John"_J, "A_C_Horse_Gang_John"},
-	    {"A_C_Horse_Gang_Karen"_J, "A_C_Horse_Gang_Karen"},
-	    {"A_C_Horse_Gang_Kieran"_J, "A_C_Horse_Gang_Kieran"},
-	    {"A_C_Horse_Gang_Micah"_J, "A_C_Horse_Gang_Micah"},
+	    {"G_M_M_UniRanchers_01"_J, "G_M_M_UniRanchers_01"},
+	    {"MP_U_M_M_CULTPRIEST_01"_J, "MP_U_M_M_CULTPRIEST_01"},
+	    {"S_M_M_CornwallGuard_01"_J, "S_M_M_CornwallGuard_01"},
+	    {"A_F_M_LOWERTRAINPASSENGERS_01"_J, "A_F_M_LOWERTRAINPASSENGERS_01"},
 	    {"A_C_Horse_Gang_Sadie"_J, "A_C_Horse_Gang_Sadie"},
-	    {"A_C_Horse_Gang_Sean"_J, "A_C_Horse_Gang_Sean"},
-	    {"A_C_Horse_Gang_Trelawney"_J, "A_C_Horse_Gang_Trelawney"},
-	    {"A_C_Horse_Gang_Uncle"_J, "A_C_Horse_Gang_Uncle"},
-	    {"A_C_Horse_Gang_Uncle_EndlessSummer"_J, "A_C_Horse_Gang_Uncle_EndlessSummer"},
-	    {"A_C_Horse_GypsyCob_PalominoBlagdon"_J, "A_C_Horse_GypsyCob_PalominoBlagdon"},
-	    {"A_C_Horse_GypsyCob_Piebald"_J, "A_C_Horse_GypsyCob_Piebald"},
-	    {"A_C_Horse_GypsyCob_Skewbald"_J, "A_C_Horse_GypsyCob_Skewbald"},
-	    {"A_C_Horse_GypsyCob_SplashedBay"_J, "A_C_Horse_GypsyCob_SplashedBay"},
-	    {"A_C_Horse_GypsyCob_SplashedPiebald"_J, "A_C_Horse_GypsyCob_SplashedPiebald"},
-	    {"A_C_Horse_GypsyCob_WhiteBlagdon"_J, "A_C_Horse_GypsyCob_WhiteBlagdon"},
-	    {"A_C_Horse_HungarianHalfbred_DarkDappleGrey"_J, "A_C_Horse_HungarianHalfbred_DarkDappleGrey"},
-	    {"A_C_Horse_HungarianHalfbred_FlaxenChestnut"_J, "A_C_Horse_HungarianHalfbred_FlaxenChestnut"},
-	    {"A_C_Horse_HungarianHalfbred_LiverChestnut"_J, "A_C_Horse_HungarianHalfbred_LiverChestnut"},
-	    {"A_C_Horse_HungarianHalfbred_PiebaldTobiano"_J, "A_C_Horse_HungarianHalfbred_PiebaldTobiano"},
-	    {"A_C_Horse_John_EndlessSummer"_J, "A_C_Horse_John_EndlessSummer"},
-	    {"A_C_Horse_KentuckySaddle_Black"_J, "A_C_Horse_KentuckySaddle_Black"},
-	    {"A_C_Horse_KentuckySaddle_ButterMilkBuckskin_PC"_J, "A_C_Horse_KentuckySaddle_ButterMilkBuckskin_PC"},
-	    {"A_C_Horse_KentuckySaddle_ChestnutPinto"_J, "A_C_Horse_KentuckySaddle_ChestnutPinto"},
-	    {"A_C_Horse_KentuckySaddle_Grey"_J, "A_C_Horse_KentuckySaddle_Grey"},
-	    {"A_C_Horse_KentuckySaddle_SilverBay"_J, "A_C_Horse_KentuckySaddle_SilverBay"},
-	    {"A_C_Horse_Kladruber_Black"_J, "A_C_Horse_Kladruber_Black"},
-	    {"A_C_Horse_Kladruber_Cremello"_J, "A_C_Horse_Kladruber_Cremello"},
-	    {"A_C_Horse_Kladruber_Dapplerosegrey"_J, "A_C_Horse_Kladruber_Dapplerosegrey"},
-	    {"A_C_Horse_Kladruber_Grey"_J, "A_C_Horse_Kladruber_Grey"},
-	    {"A_C_Horse_Kladruber_Silver"_J, "A_C_Horse_Kladruber_Silver"},
-	    {"A_C_Horse_Kladruber_White"_J, "A_C_Horse_Kladruber_White"},
-	    {"A_C_Horse_MissouriFoxTrotter_AmberChampagne"_J, "A_C_Horse_MissouriFoxTrotter_AmberChampagne"},
-	    {"A_C_Horse_MissouriFoxTrotter_Blacktovero"_J, "A_C_Horse_MissouriFoxTrotter_Blacktovero"},
-	    {"A_C_HORSE_MISSOURIFOXTROTTER_BLUEROAN"_J, "A_C_HORSE_MISSOURIFOXTROTTER_BLUEROAN"},
-	    {"A_C_Horse_MissouriFoxTrotter_Buckskinbrindle"_J, "A_C_Horse_MissouriFoxTrotter_Buckskinbrindle"},
-	    {"A_C_HORSE_MISSOURIFOXTROTTER_DAPPLEGREY"_J, "A_C_HORSE_MISSOURIFOXTROTTER_DAPPLEGREY"},
-	    {"A_C_Horse_MissouriFoxTrotter_SableChampagne"_J, "A_C_Horse_MissouriFoxTrotter_SableChampagne"},
-	    {"A_C_Horse_MissouriFoxTrotter_SilverDapplePinto"_J, "A_C_Horse_MissouriFoxTrotter_SilverDapplePinto"},
-	    {"A_C_Horse_Morgan_Bay"_J, "A_C_Horse_Morgan_Bay"},
-	    {"A_C_Horse_Morgan_BayRoan"_J, "A_C_Horse_Morgan_BayRoan"},
-	    {"A_C_Horse_Morgan_FlaxenChestnut"_J, "A_C_Horse_Morgan_FlaxenChestnut"},
+	    {"A_C_RoseateSpoonbill_01"_J, "A_C_RoseateSpoonbill_01"},
+	    {"CS_LARAMIE"_J, "CS_LARAMIE"},
+	    {"MP_A_C_DOGAMERICANFOXHOUND_01"_J, "MP_A_C_DOGAMERICANFOXHOUND_01"},
+	    {"RCSP_POISONEDWELL_FEMALES_01"_J, "RCSP_POISONEDWELL_FEMALES_01"},
+	    {"CS_Meredith"_J, "CS_Meredith"},
+	    {"CS_creepyoldlady"_J, "CS_creepyoldlady"},
 	    {"A_C_Horse_Morgan_LiverChestnut_PC"_J, "A_C_Horse_Morgan_LiverChestnut_PC"},
-	    {"A_C_Horse_Morgan_Palomino"_J, "A_C_Horse_Morgan_Palomino"},
-	    {"A_C_Horse_MP_Mangy_Backup"_J, "A_C_Horse_MP_Mangy_Backup"},
-	    {"A_C_Horse_MurfreeBrood_Mange_01"_J, "A_C_Horse_MurfreeBrood_Mange_01"},
-	    {"A_C_Horse_MurfreeBrood_Mange_02"_J, "A_C_Horse_MurfreeBrood_Mange_02"},
-	    {"A_C_Horse_MurfreeBrood_Mange_03"_J, "A_C_Horse_MurfreeBrood_Mange_03"},
-	    {"A_C_HORSE_MUSTANG_BLACKOVERO"_J, "A_C_HORSE_MUSTANG_BLACKOVERO"},
-	    {"A_C_HORSE_MUSTANG_BUCKSKIN"_J, "A_C_HORSE_MUSTANG_BUCKSKIN"},
-	    {"A_C_HORSE_MUSTANG_CHESTNUTTOVERO"_J, "A_C_HORSE_MUSTANG_CHESTNUTTOVERO"},
-	    {"A_C_Horse_Mustang_GoldenDun"_J, "A_C_Horse_Mustang_GoldenDun"},
-	    {"A_C_Horse_Mustang_GrulloDun"_J, "A_C_Horse_Mustang_GrulloDun"},
-	    {"A_C_HORSE_MUSTANG_REDDUNOVERO"_J, "A_C_HORSE_MUSTANG_REDDUNOVERO"},
-	    {"A_C_Horse_Mustang_TigerStripedBay"_J, "A_C_Horse_Mustang_TigerStripedBay"},
-	    {"A_C_Horse_Mustang_WildBay"_J, "A_C_Horse_Mustang_WildBay"},
-	    {"A_C_Horse_Nokota_BlueRoan"_J, "A_C_Horse_Nokota_BlueRoan"},
-	    {"A_C_Horse_Nokota_ReverseDappleRoan"_J, "A_C_Horse_Nokota_ReverseDappleRoan"},
-	    {"A_C_Horse_Nokota_WhiteRoan"_J, "A_C_Horse_Nokota_WhiteRoan"},
-	    {"A_C_Horse_NorfolkRoadster_Black"_J, "A_C_Horse_NorfolkRoadster_Black"},
-	    {"A_C_Horse_NorfolkRoadster_DappledBuckskin"_J, "A_C_Horse_NorfolkRoadster_DappledBuckskin"},
-	    {"A_C_Horse_NorfolkRoadster_PiebaldRoan"_J, "A_C_Horse_NorfolkRoadster_PiebaldRoan"},
-	    {"A_C_Horse_NorfolkRoadster_RoseGrey"_J, "A_C_Horse_NorfolkRoadster_RoseGrey"},
-	    {"A_C_Horse_NorfolkRoadster_SpeckledGrey"_J, "A_C_Horse_NorfolkRoadster_SpeckledGrey"},
-	    {"A_C_Horse_NorfolkRoadster_SpottedTricolor"_J, "A_C_Horse_NorfolkRoadster_SpottedTricolor"},
-	    {"A_C_Horse_Shire_DarkBay"_J, "A_C_Horse_Shire_DarkBay"},
-	    {"A_C_Horse_Shire_LightGrey"_J, "A_C_Horse_Shire_LightGrey"},
-	    {"A_C_Horse_Shire_RavenBlack"_J, "A_C_Horse_Shire_RavenBlack"},
-	    {"A_C_Horse_SuffolkPunch_RedChestnut"_J, "A_C_Horse_SuffolkPunch_RedChestnut"},
-	    {"A_C_Horse_SuffolkPunch_Sorrel"_J, "A_C_Horse_SuffolkPunch_Sorrel"},
-	    {"A_C_Horse_TennesseeWalker_BlackRabicano"_J, "A_C_Horse_TennesseeWalker_BlackRabicano"},
-	    {"A_C_Horse_TennesseeWalker_Chestnut"_J, "A_C_Horse_TennesseeWalker_Chestnut"},
-	    {"A_C_Horse_TennesseeWalker_DappleBay"_J, "A_C_Horse_TennesseeWalker_DappleBay"},
-	    {"A_C_Horse_TennesseeWalker_FlaxenRoan"_J, "A_C_Horse_TennesseeWalker_FlaxenRoan"},
-	    {"A_C_Horse_TennesseeWalker_GoldPalomino_PC"_J, "A_C_Horse_TennesseeWalker_GoldPalomino_PC"},
-	    {"A_C_Horse_TennesseeWalker_MahoganyBay"_J, "A_C_Horse_TennesseeWalker_MahoganyBay"},
-	    {"A_C_Horse_TennesseeWalker_RedRoan"_J, "A_C_Horse_TennesseeWalker_RedRoan"},
-	    {"A_C_Horse_Thoroughbred_BlackChestnut"_J, "A_C_Horse_Thoroughbred_BlackChestnut"},
-	    {"A_C_Horse_Thoroughbred_BloodBay"_J, "A_C_Horse_Thoroughbred_BloodBay"},
-	    {"A_C_Horse_Thoroughbred_Brindle"_J, "A_C_Horse_Thoroughbred_Brindle"},
-	    {"A_C_Horse_Thoroughbred_DappleGrey"_J, "A_C_Horse_Thoroughbred_DappleGrey"},
-	    {"A_C_Horse_Thoroughbred_ReverseDappleBlack"_J, "A_C_Horse_Thoroughbred_ReverseDappleBlack"},
-	    {"A_C_HORSE_TURKOMAN_BLACK"_J, "A_C_HORSE_TURKOMAN_BLACK"},
-	    {"A_C_HORSE_TURKOMAN_CHESTNUT"_J, "A_C_HORSE_TURKOMAN_CHESTNUT"},
-	    {"A_C_Horse_Turkoman_DarkBay"_J, "A_C_Horse_Turkoman_DarkBay"},
-	    {"A_C_Horse_Turkoman_Gold"_J, "A_C_Horse_Turkoman_Gold"},
-	    {"A_C_HORSE_TURKOMAN_GREY"_J, "A_C_HORSE_TURKOMAN_GREY"},
-	    {"A_C_HORSE_TURKOMAN_PERLINO"_J, "A_C_HORSE_TURKOMAN_PERLINO"},
-	    {"A_C_Horse_Turkoman_Silver"_J, "A_C_Horse_Turkoman_Silver"},
-	    {"A_C_Horse_Winter02_01"_J, "A_C_Horse_Winter02_01"},
-	    {"A_C_HorseMule_01"_J, "A_C_HorseMule_01"},
-	    {"A_C_HorseMulePainted_01"_J, "A_C_HorseMulePainted_01"},
-	    {"A_C_Iguana_01"_J, "A_C_Iguana_01"},
-	    {"A_C_IguanaDesert_01"_J, "A_C_IguanaDesert_01"},
-	    {"A_C_Javelina_01"_J, "A_C_Javelina_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_06"_J, "MP_U_M_M_SALOONBRAWLERS_06"},
+	    {"MSP_MARY3_MALES_01"_J, "MSP_MARY3_MALES_01"},
+	    {"A_C_Horse_Gang_Lenny"_J, "A_C_Horse_Gang_Lenny"},
+	    {"A_M_M_armTOWNFOLK_02"_J, "A_M_M_armTOWNFOLK_02"},
+	    {"A_F_M_UPPERTRAINPASSENGERS_01"_J, "A_F_M_UPPERTRAINPASSENGERS_01"},
+	    {"CS_nbxreceptionist_01"_J, "CS_nbxreceptionist_01"},
+	    {"CS_SHERIFFFREEMAN"_J, "CS_SHERIFFFREEMAN"},
+	    {"CS_NbxPoliceChiefFormal"_J, "CS_NbxPoliceChiefFormal"},
+	    {"A_F_M_NbxUpperClass_01"_J, "A_F_M_NbxUpperClass_01"},
+	    {"A_C_Horse_Morgan_FlaxenChestnut"_J, "A_C_Horse_Morgan_FlaxenChestnut"},
+	    {"MSP_MUDTOWN3_MALES_01"_J, "MSP_MUDTOWN3_MALES_01"},
+	    {"A_C_DogCatahoulaCur_01"_J, "A_C_DogCatahoulaCur_01"},
+	    {"A_F_M_MiddleSDTownfolk_03"_J, "A_F_M_MiddleSDTownfolk_03"},
+	    {"A_C_Horse_Appaloosa_BrownLeopard"_J, "A_C_Horse_Appaloosa_BrownLeopard"},
+	    {"A_C_Sparrow_01"_J, "A_C_Sparrow_01"},
+	    {"A_C_Horse_Appaloosa_BlackSnowflake"_J, "A_C_Horse_Appaloosa_BlackSnowflake"},
+	    {"SALOONBRAWLERS_06"_J, "SALOONBRAWLERS_06"},
+	    {"U_M_M_CKTManager_01"_J, "U_M_M_CKTManager_01"},
+	    {"U_M_M_BHT_BANDITOSHACK"_J, "U_M_M_BHT_BANDITOSHACK"},
+	    {"U_M_M_BHT_BANDITOMINE"_J, "U_M_M_BHT_BANDITOMINE"},
+	    {"U_M_M_ORPGUARD_01"_J, "U_M_M_ORPGUARD_01"},
+	    {"A_C_Duck_01"_J, "A_C_Duck_01"},
+	    {"CS_CornwallTrainConductor"_J, "CS_CornwallTrainConductor"},
+	    {"S_F_M_MaPWorker_01"_J, "S_F_M_MaPWorker_01"},
+	    {"MBH_RHODESRANCHER_FEMALES_01"_J, "MBH_RHODESRANCHER_FEMALES_01"},
+	    {"RCSP_FORMYART_FEMALES_01"_J, "RCSP_FORMYART_FEMALES_01"},
+	    {"U_M_M_ValTownfolk_01"_J, "U_M_M_ValTownfolk_01"},
+	    {"A_M_M_BlWLaborer_01"_J, "A_M_M_BlWLaborer_01"},
+	    {"A_F_M_HtlFancyTravellers_01"_J, "A_F_M_HtlFancyTravellers_01"},
+	    {"A_F_M_ROUGHTRAVELLERS_01"_J, "A_F_M_ROUGHTRAVELLERS_01"},
+	    {"S_M_M_StGSailor_01"_J, "S_M_M_StGSailor_01"},
+	    {"U_M_M_BHT_ODRISCOLLDRUNK"_J, "U_M_M_BHT_ODRISCOLLDRUNK"},
+	    {"A_C_DogHobo_01"_J, "A_C_DogHobo_01"},
+	    {"U_M_M_ARMGENERALSTOREOWNER_01"_J, "U_M_M_ARMGENERALSTOREOWNER_01"},
+	    {"U_M_M_VhtStationClerk_01"_J, "U_M_M_VhtStationClerk_01"},
+	    {"G_M_Y_UNIEXCONFEDS_02"_J, "G_M_Y_UNIEXCONFEDS_02"},
+	    {"CS_uncle"_J, "CS_uncle"},
 	    {"A_C_LionMangy_01"_J, "A_C_LionMangy_01"},
-	    {"A_C_Loon_01"_J, "A_C_Loon_01"},
-	    {"A_C_Moose_01"_J, "A_C_Moose_01"},
-	    {"A_C_Muskrat_01"_J, "A_C_Muskrat_01"},
-	    {"A_C_Oriole_01"_J, "A_C_Oriole_01"},
+	    {"A_M_M_VhtThug_01"_J, "A_M_M_VhtThug_01"},
+	    {"A_C_Horse_Kladruber_Grey"_J, "A_C_Horse_Kladruber_Grey"},
+	    {"U_F_M_STORY_BLACKBELLE_01"_J, "U_F_M_STORY_BLACKBELLE_01"},
+	    {"A_M_M_CARDGAMEPLAYERS_01"_J, "A_M_M_CARDGAMEPLAYERS_01"},
+	    {"U_M_M_RhdSheriff_01"_J, "U_M_M_RhdSheriff_01"},
+	    {"CS_rhodeputy_01"_J, "CS_rhodeputy_01"},
+	    {"A_C_Horse_Gang_Micah"_J, "A_C_Horse_Gang_Micah"},
+	    {"CS_DrMalcolmMacIntosh"_J, "CS_DrMalcolmMacIntosh"},
+	    {"U_M_M_BHT_OLDMAN"_J, "U_M_M_BHT_OLDMAN"},
+	    {"U_M_Y_HtlWorker_02"_J, "U_M_Y_HtlWorker_02"},
+	    {"MP_G_F_M_CULTMEMBERS_01"_J, "MP_G_F_M_CULTMEMBERS_01"},
+	    {"A_C_FrogBull_01"_J, "A_C_FrogBull_01"},
+	    {"S_M_M_SDCOWPOKE_01"_J, "S_M_M_SDCOWPOKE_01"},
+	    {"A_C_Horse_Arabian_White"_J, "A_C_Horse_Arabian_White"},
+	    {"CS_leon"_J, "CS_leon"},
+	    {"RE_DUELWINNER_FEMALES_01"_J, "RE_DUELWINNER_FEMALES_01"},
+	    {"MP_A_C_BUFFALO_01"_J, "MP_A_C_BUFFALO_01"},
+	    {"A_C_Horse_MurfreeBrood_Mange_02"_J, "A_C_Horse_MurfreeBrood_Mange_02"},
+	    {"RE_FROZENTODEATH_MALES_01"_J, "RE_FROZENTODEATH_MALES_01"},
+	    {"U_M_M_EmRFarmHand_03"_J, "U_M_M_EmRFarmHand_03"},
+	    {"RE_WAGONTHREAT_MALES_01"_J, "RE_WAGONTHREAT_MALES_01"},
+	    {"A_M_Y_SDStreetKids_Slums_02"_J, "A_M_Y_SDStreetKids_Slums_02"},
+	    {"RE_APPROACH_MALES_01"_J, "RE_APPROACH_MALES_01"},
+	    {"A_C_DogLion_01"_J, "A_C_DogLion_01"},
+	    {"RE_MURDERCAMP_MALES_01"_J, "RE_MURDERCAMP_MALES_01"},
+	    {"CS_ANTONYFOREMEN"_J, "CS_ANTONYFOREMEN"},
+	    {"RCSP_CALLOWAY_MALES_01"_J, "RCSP_CALLOWAY_MALES_01"},
+	    {"A_C_Wolf_Medium"_J, "A_C_Wolf_Medium"},
+	    {"CS_EDITH_JOHN"_J, "CS_EDITH_JOHN"},
+	    {"S_M_M_CKTWorker_01"_J, "S_M_M_CKTWorker_01"},
+	    {"U_M_M_LnSWorker_01"_J, "U_M_M_LnSWorker_01"},
 	    {"A_C_Owl_01"_J, "A_C_Owl_01"},
-	    {"A_C_Ox_01"_J, "A_C_Ox_01"},
-	    {"A_C_Panther_01"_J, "A_C_Panther_01"},
-	    {"A_C_PantherLegendaryr_01"_J, "A_C_PantherLegendaryr_01"},
-	    {"A_C_Parrot_01"_J, "A_C_Parrot_01"},
-	    {"A_C_Pelican_01"_J, "A_C_Pelican_01"},
-	    {"A_C_Pheasant_01"_J, "A_C_Pheasant_01"},
-	    {"A_C_Pig_01"_J, "A_C_Pig_01"},
-	    {"A_C_Pigeon"_J, "A_C_Pigeon"},
-	    {"A_C_Possum_01"_J, "A_C_Possum_01"},
-	    {"A_C_PrairieChicken_01"_J, "A_C_PrairieChicken_01"},
-	    {"A_C_Pronghorn_01"_J, "A_C_Pronghorn_01"},
-	    {"A_C_Quail_01"_J, "A_C_Quail_01"},
-	    {"A_C_Rabbit_01"_J, "A_C_Rabbit_01"},
-	    {"A_C_Raccoon_01"_J, "A_C_Raccoon_01"},
-	    {"A_C_Rat_01"_J, "A_C_Rat_01"},
+	    {"U_M_M_SDSTRONGWOMANASSISTANT_01"_J, "U_M_M_SDSTRONGWOMANASSISTANT_01"},
+	    {"A_C_SharkHammerhead_01"_J, "A_C_SharkHammerhead_01"},
+	    {"RE_DARKALLEYAMBUSH_MALES_01"_J, "RE_DARKALLEYAMBUSH_MALES_01"},
+	    {"U_M_O_VhTExoticShopkeeper_01"_J, "U_M_O_VhTExoticShopkeeper_01"},
+	    {"A_C_Wolf_Small"_J, "A_C_Wolf_Small"},
+	    {"CS_SheriffOwens"_J, "CS_SheriffOwens"},
+	    {"CS_ColmODriscoll"_J, "CS_ColmODriscoll"},
+	    {"CS_SDDoctor_01"_J, "CS_SDDoctor_01"},
+	    {"A_C_Horse_HungarianHalfbred_DarkDappleGrey"_J, "A_C_Horse_HungarianHalfbred_DarkDappleGrey"},
+	    {"CS_SCOTTGRAY"_J, "CS_SCOTTGRAY"},
+	    {"A_M_M_ARMTOWNFOLK_01"_J, "A_M_M_ARMTOWNFOLK_01"},
+	    {"U_M_M_STORY_SDSTATUE_01"_J, "U_M_M_STORY_SDSTATUE_01"},
+	    {"Ps4"_J, "Ps4"},
+	    {"CS_Bubba"_J, "CS_Bubba"},
+	    {"A_M_O_LagTownfolk_01"_J, "A_M_O_LagTownfolk_01"},
+	    {"A_M_M_ARMCHOLERACORPSE_01"_J, "A_M_M_ARMCHOLERACORPSE_01"},
+	    {"U_M_M_EmRFather_01"_J, "U_M_M_EmRFather_01"},
+	    {"A_F_O_BlWUpperClass_01"_J, "A_F_O_BlWUpperClass_01"},
+	    {"MP_S_M_M_REVENUEAGENTS_01"_J, "MP_S_M_M_REVENUEAGENTS_01"},
+	    {"CS_cancan_01"_J, "CS_cancan_01"},
+	    {"U_M_M_VALTHEMAN_01"_J, "U_M_M_VALTHEMAN_01"},
+	    {"MP_G_M_M_CULTGUARDS_01"_J, "MP_G_M_M_CULTGUARDS_01"},
+	    {"A_M_M_SDLaborers_02"_J, "A_M_M_SDLaborers_02"},
+	    {"A_M_M_BlWTownfolk_01"_J, "A_M_M_BlWTownfolk_01"},
+	    {"S_M_M_UniTrainEngineer_01"_J, "S_M_M_UniTrainEngineer_01"},
+	    {"CS_creolecaptain"_J, "CS_creolecaptain"},
+	    {"MP_A_C_ELK_01"_J, "MP_A_C_ELK_01"},
+	    {"CS_BrontesButler"_J, "CS_BrontesButler"},
+	    {"U_M_M_UNIDUSTERHENCHMAN_03"_J, "U_M_M_UNIDUSTERHENCHMAN_03"},
+	    {"U_M_M_HTLHUSBAND_01"_J, "U_M_M_HTLHUSBAND_01"},
+	    {"RE_INBREDKIDNAP_FEMALES_01"_J, "RE_INBREDKIDNAP_FEMALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_12"_J, "MP_U_M_M_SALOONBRAWLERS_12"},
+	    {"U_M_Y_CZPHOMESTEADSON_05"_J, "U_M_Y_CZPHOMESTEADSON_05"},
+	    {"MP_CAMPDEF_BLUEWATER_MALES_01"_J, "MP_CAMPDEF_BLUEWATER_MALES_01"},
+	    {"G_M_M_UniDuster_04"_J, "G_M_M_UniDuster_04"},
+	    {"CS_BATHINGLADIES_01"_J, "CS_BATHINGLADIES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_14"_J, "MP_U_M_M_SALOONBRAWLERS_14"},
+	    {"CS_JANSON"_J, "CS_JANSON"},
+	    {"S_M_M_Barber_01"_J, "S_M_M_Barber_01"},
+	    {"CS_CIGCARDGUY"_J, "CS_CIGCARDGUY"},
+	    {"A_C_Goat_01"_J, "A_C_Goat_01"},
+	    {"U_M_M_TumBartender_01"_J, "U_M_M_TumBartender_01"},
+	    {"SALOONBRAWLERS_07"_J, "SALOONBRAWLERS_07"},
+	    {"CS_forgivenwife_01"_J, "CS_forgivenwife_01"},
+	    {"U_M_M_ValBarber_01"_J, "U_M_M_ValBarber_01"},
+	    {"armadillo"_J, "armadillo"},
+	    {"U_M_M_BlWTrainStationWorker_01"_J, "U_M_M_BlWTrainStationWorker_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_04"_J, "MP_U_M_M_SALOONBRAWLERS_04"},
+	    {"U_M_M_NbxSkiffDriver_01"_J, "U_M_M_NbxSkiffDriver_01"},
+	    {"A_C_Horse_TennesseeWalker_RedRoan"_J, "A_C_Horse_TennesseeWalker_RedRoan"},
+	    {"RE_CORPSECART_FEMALES_01"_J, "RE_CORPSECART_FEMALES_01"},
+	    {"A_M_M_DOMINOESPLAYERS_01"_J, "A_M_M_DOMINOESPLAYERS_01"},
+	    {"A_C_FishLongNoseGar_01_lg"_J, "A_C_FishLongNoseGar_01_lg"},
+	    {"CS_TigerHandler"_J, "CS_TigerHandler"},
+	    {"U_M_M_ValPokerPlayer_01"_J, "U_M_M_ValPokerPlayer_01"},
+	    {"U_M_M_story_PIGFARM_01"_J, "U_M_M_story_PIGFARM_01"},
+	    {"RE_PISSPOT_MALES_01"_J, "RE_PISSPOT_MALES_01"},
+	    {"A_C_Horse_Breton_RedRoan"_J, "A_C_Horse_Breton_RedRoan"},
+	    {"U_M_M_CRDWITNESS_01"_J, "U_M_M_CRDWITNESS_01"},
+	    {"CS_frenchartist"_J, "CS_frenchartist"},
+	    {"S_M_M_RHDDEALER_01"_J, "S_M_M_RHDDEALER_01"},
+	    {"MSP_GANG2_MALES_01"_J, "MSP_GANG2_MALES_01"},
+	    {"A_M_M_HUNTERTRAVELERS_WARM_01"_J, "A_M_M_HUNTERTRAVELERS_WARM_01"},
+	    {"RCSP_SLAVECATCHER_MALES_01"_J, "RCSP_SLAVECATCHER_MALES_01"},
+	    {"A_M_M_SclRoughTravellers_01"_J, "A_M_M_SclRoughTravellers_01"},
+	    {"U_F_M_EMRDAUGHTER_01"_J, "U_F_M_EMRDAUGHTER_01"},
+	    {"S_M_M_MicGuard_01"_J, "S_M_M_MicGuard_01"},
+	    {"CS_Vampire"_J, "CS_Vampire"},
+	    {"A_C_Horse_Kladruber_Dapplerosegrey"_J, "A_C_Horse_Kladruber_Dapplerosegrey"},
+	    {"A_C_Horse_Gang_Hosea"_J, "A_C_Horse_Gang_Hosea"},
+	    {"CS_genstorymale"_J, "CS_genstorymale"},
+	    {"A_C_Horse_Ardennes_StrawberryRoan"_J, "A_C_Horse_Ardennes_StrawberryRoan"},
+	    {"CS_jackmarston_teen"_J, "CS_jackmarston_teen"},
+	    {"G_M_Y_UniExConfeds_01"_J, "G_M_Y_UniExConfeds_01"},
+	    {"U_M_M_CreoleCaptain_01"_J, "U_M_M_CreoleCaptain_01"},
+	    {"A_C_Horse_Breton_GrulloDun"_J, "A_C_Horse_Breton_GrulloDun"},
+	    {"A_M_M_DELIVERYTRAVELERS_COOL_01"_J, "A_M_M_DELIVERYTRAVELERS_COOL_01"},
+	    {"MSP_GUARMA2_MALES_01"_J, "MSP_GUARMA2_MALES_01"},
+	    {"A_M_M_BlWLaborer_02"_J, "A_M_M_BlWLaborer_02"},
+	    {"CS_clay"_J, "CS_clay"},
+	    {"A_C_Horse_MurfreeBrood_Mange_03"_J, "A_C_Horse_MurfreeBrood_Mange_03"},
+	    {"A_M_M_ValLaborer_01"_J, "A_M_M_ValLaborer_01"},
+	    {"A_F_M_GaMHighSociety_01"_J, "A_F_M_GaMHighSociety_01"},
+	    {"A_M_M_SmHThug_01"_J, "A_M_M_SmHThug_01"},
+	    {"A_C_IguanaDesert_01"_J, "A_C_IguanaDesert_01"},
+	    {"RE_LOSTDOG_TEENS_01"_J, "RE_LOSTDOG_TEENS_01"},
+	    {"S_F_M_CghWorker_01"_J, "S_F_M_CghWorker_01"},
+	    {"A_C_Horse_Belgian_BlondChestnut"_J, "A_C_Horse_Belgian_BlondChestnut"},
+	    {"U_M_O_PSHRancher_01"_J, "U_M_O_PSHRancher_01"},
+	    {"CS_PRIEST_WEDDING"_J, "CS_PRIEST_WEDDING"},
+	    {"U_M_O_ARMBARTENDER_01"_J, "U_M_O_ARMBARTENDER_01"},
+	    {"U_M_M_NbxPriest_01"_J, "U_M_M_NbxPriest_01"},
+	    {"A_C_Horse_Gang_Sadie_EndlessSummer"_J, "A_C_Horse_Gang_Sadie_EndlessSummer"},
 	    {"A_C_Raven_01"_J, "A_C_Raven_01"},
+	    {"CS_strdeputy_02"_J, "CS_strdeputy_02"},
+	    {"MSP_WINTER4_MALES_01"_J, "MSP_WINTER4_MALES_01"},
+	    {"CS_MicahBell"_J, "CS_MicahBell"},
+	    {"A_C_CraneWhooping_01"_J, "A_C_CraneWhooping_01"},
+	    {"U_M_O_MaPWiseOldMan_01"_J, "U_M_O_MaPWiseOldMan_01"},
+	    {"A_C_BoarLegendary_01"_J, "A_C_BoarLegendary_01"},
+	    {"CS_famousgunslinger_03"_J, "CS_famousgunslinger_03"},
+	    {"MP_A_C_FOX_01"_J, "MP_A_C_FOX_01"},
+	    {"MP_A_C_POSSUM_01"_J, "MP_A_C_POSSUM_01"},
+	    {"S_M_M_NbxRiverBoatGuards_01"_J, "S_M_M_NbxRiverBoatGuards_01"},
+	    {"CS_BivCoachDriver"_J, "CS_BivCoachDriver"},
+	    {"MBH_SKINNERSEARCH_MALES_01"_J, "MBH_SKINNERSEARCH_MALES_01"},
+	    {"A_C_Horse_Gang_Charles"_J, "A_C_Horse_Gang_Charles"},
+	    {"RE_PEEPINGTOM_MALES_01"_J, "RE_PEEPINGTOM_MALES_01"},
+	    {"U_M_M_WtCCowboy_04"_J, "U_M_M_WtCCowboy_04"},
+	    {"RCSP_CRACKPOT_FEMALES_01"_J, "RCSP_CRACKPOT_FEMALES_01"},
+	    {"A_C_Rabbit_01"_J, "A_C_Rabbit_01"},
+	    {"LegendaryPanther"_J, "LegendaryPanther"},
+	    {"CS_braithwaitebutler"_J, "CS_braithwaitebutler"},
+	    {"G_M_M_UNISWAMP_01"_J, "G_M_M_UNISWAMP_01"},
+	    {"S_M_M_SDTICKETSELLER_01"_J, "S_M_M_SDTICKETSELLER_01"},
+	    {"U_M_M_RaCForeman_01"_J, "U_M_M_RaCForeman_01"},
+	    {"SALOONBRAWLERS_04"_J, "SALOONBRAWLERS_04"},
+	    {"A_C_Horse_Thoroughbred_Brindle"_J, "A_C_Horse_Thoroughbred_Brindle"},
+	    {"CS_sean"_J, "CS_sean"},
+	    {"RCES_BEECHERS1_MALES_01"_J, "RCES_BEECHERS1_MALES_01"},
+	    {"RE_CONSEQUENCE_MALES_01"_J, "RE_CONSEQUENCE_MALES_01"},
+	    {"MP_A_C_BIGHORNRAM_01"_J, "MP_A_C_BIGHORNRAM_01"},
+	    {"CS_GILBERTKNIGHTLY"_J, "CS_GILBERTKNIGHTLY"},
+	    {"MP_U_M_M_ANIMALPOACHER_02"_J, "MP_U_M_M_ANIMALPOACHER_02"},
+	    {"CS_MP_TRAVELLINGSALESWOMAN"_J, "CS_MP_TRAVELLINGSALESWOMAN"},
+	    {"A_M_M_BtcHillbilly_01"_J, "A_M_M_BtcHillbilly_01"},
+	    {"CS_MP_MARSHALL_DAVIES"_J, "CS_MP_MARSHALL_DAVIES"},
+	    {"CS_MicahsNemesis"_J, "CS_MicahsNemesis"},
+	    {"U_M_M_UNIDUSTERHENCHMAN_02"_J, "U_M_M_UNIDUSTERHENCHMAN_02"},
+	    {"MP_ASN_BENEDICTPOINT_FEMALES_01"_J, "MP_ASN_BENEDICTPOINT_FEMALES_01"},
+	    {"A_M_M_LowerSDTownfolk_01"_J, "A_M_M_LowerSDTownfolk_01"},
 	    {"A_C_RedFootedBooby_01"_J, "A_C_RedFootedBooby_01"},
-	    {"A_C_Robin_01"_J, "A_C_Robin_01"},
-	    {"A_C_Rooster_01"_J, "A_C_Rooster_01"},
-	    {"A_C_RoseateSpoonbill_01"_J, "A_C_RoseateSpoonbill_01"},
-	    {"A_C_Seagull_01"_J, "A_C_Seagull_01"},
-	    {"A_C_SharkHammerhead_01"_J, "A_C_SharkHammerhead_01"},
-	    {"A_C_SharkTiger"_J, "A_C_SharkTiger"},
-	    {"A_C_Sheep_01"_J, "A_C_Sheep_01"},
-	    {"A_C_Skunk_01"_J, "A_C_Skunk_01"},
-	    {"A_C_Snake_01"_J, "A_C_Snake_01"},
-	    {"A_C_Snake_Pelt_01"_J, "A_C_Snake_Pelt_01"},
-	    {"A_C_SnakeBlackTailRattle_01"_J, "A_C_SnakeBlackTailRattle_01"},
-	    {"A_C_SnakeBlackTailRattle_Pelt_01"_J, "A_C_SnakeBlackTailRattle_Pelt_01"},
-	    {"A_C_SnakeFerDeLance_01"_J, "A_C_SnakeFerDeLance_01"},
-	    {"A_C_SnakeFerDeLance_Pelt_01"_J, "A_C_SnakeFerDeLance_Pelt_01"},
-	    {"A_C_SnakeRedBoa_01"_J, "A_C_SnakeRedBoa_01"},
-	    {"A_C_SnakeRedBoa_Pelt_01"_J, "A_C_SnakeRedBoa_Pelt_01"},
-	    {"A_C_SnakeRedBoa10ft_01"_J, "A_C_SnakeRedBoa10ft_01"},
-	    {"A_C_SnakeWater_01"_J, "A_C_SnakeWater_01"},
-	    {"A_C_SnakeWater_Pelt_01"_J, "A_C_SnakeWater_Pelt_01"},
-	    {"A_C_SongBird_01"_J, "A_C_SongBird_01"},
-	    {"A_C_Sparrow_01"_J, "A_C_Sparrow_01"},
-	    {"A_C_Spot_Gang_Charles"_J, "A_C_Spot_Gang_Charles"},
-	    {"A_C_Squirrel_01"_J, "A_C_Squirrel_01"},
-	    {"A_C_Toad_01"_J, "A_C_Toad_01"},
 	    {"A_C_Turkey_01"_J, "A_C_Turkey_01"},
-	    {"A_C_Turkey_02"_J, "A_C_Turkey_02"},
-	    {"A_C_TurkeyWild_01"_J, "A_C_TurkeyWild_01"},
-	    {"A_C_TurtleSea_01"_J, "A_C_TurtleSea_01"},
+	    {"CS_CLEET"_J, "CS_CLEET"},
+	    {"RE_FUSSARCHASE_MALES_01"_J, "RE_FUSSARCHASE_MALES_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_11"_J, "MP_U_M_M_SALOONBRAWLERS_11"},
+	    {"RE_SHOWOFF_MALES_01"_J, "RE_SHOWOFF_MALES_01"},
+	    {"RE_ANIMALATTACK_FEMALES_01"_J, "RE_ANIMALATTACK_FEMALES_01"},
+	    {"A_C_Horse_AmericanStandardbred_SilverTailBuckskin"_J, "A_C_Horse_AmericanStandardbred_SilverTailBuckskin"},
+	    {"CS_SDPRIEST"_J, "CS_SDPRIEST"},
+	    {"A_C_FishPerch_01_ms"_J, "A_C_FishPerch_01_ms"},
+	    {"CS_EdithDown"_J, "CS_EdithDown"},
+	    {"A_C_Horse_AmericanPaint_Overo"_J, "A_C_Horse_AmericanPaint_Overo"},
+	    {"A_F_M_UniCorpse_01"_J, "A_F_M_UniCorpse_01"},
+	    {"CS_JOE"_J, "CS_JOE"},
+	    {"MP_U_M_M_SALOONBRAWLERS_03"_J, "MP_U_M_M_SALOONBRAWLERS_03"},
+	    {"A_C_Horse_Andalusian_DarkBay"_J, "A_C_Horse_Andalusian_DarkBay"},
+	    {"RE_DRUNKCAMP_MALES_01"_J, "RE_DRUNKCAMP_MALES_01"},
+	    {"U_M_M_NBXRIVERBOATPITBOSS_01"_J, "U_M_M_NBXRIVERBOATPITBOSS_01"},
+	    {"A_M_M_EmRFarmHand_01"_J, "A_M_M_EmRFarmHand_01"},
+	    {"U_M_M_HHRRANCHER_01"_J, "U_M_M_HHRRANCHER_01"},
+	    {"A_F_M_BynFancyTravellers_01"_J, "A_F_M_BynFancyTravellers_01"},
+	    {"A_C_Horse_MissouriFoxTrotter_SableChampagne"_J, "A_C_Horse_MissouriFoxTrotter_SableChampagne"},
+	    {"A_C_Horse_GypsyCob_Skewbald"_J, "A_C_Horse_GypsyCob_Skewbald"},
+	    {"CS_MP_SAMSON_FINCH"_J, "CS_MP_SAMSON_FINCH"},
 	    {"A_C_TurtleSnapping_01"_J, "A_C_TurtleSnapping_01"},
-	    {"A_C_Vulture_01"_J, "A_C_Vulture_01"},
-	    {"A_C_Wolf"_J, "A_C_Wolf"},
-	    {"A_C_Wolf_Medium"_J, "A_C_Wolf_Medium"},
-	    {"A_C_Wolf_Small"_J, "A_C_Wolf_Small"},
-	    {"A_C_Woodpecker_01"_J, "A_C_Woodpecker_01"},
-	    {"A_C_Woodpecker_02"_J, "A_C_Woodpecker_02"},
-	    {"armadillo"_J, "armadillo"},
-	    {"ggrcez"_J, "ggrcez"},
-	    {"LegendaryPanther"_J, "LegendaryPanther"},
-	    {"MP_A_C_Alligator_01"_J, "MP_A_C_Alligator_01"},
-	    {"MP_A_C_Beaver_01"_J, "MP_A_C_Beaver_01"},
-	    {"MP_A_C_BIGHORNRAM_01"_J, "MP_A_C_BIGHORNRAM_01"},
+	    {"A_C_Horse_Arabian_RoseGreyBay"_J, "A_C_Horse_Arabian_RoseGreyBay"},
+	    {"MP_U_M_M_SALOONBRAWLERS_09"_J, "MP_U_M_M_SALOONBRAWLERS_09"},
+	    {"CS_MP_OLDMAN_JONES"_J, "CS_MP_OLDMAN_JONES"},
+	    {"U_M_M_NbxBronteSecForm_01"_J, "U_M_M_NbxBronteSecForm_01"},
+	    {"A_C_Horse_GypsyCob_Piebald"_J, "A_C_Horse_GypsyCob_Piebald"},
+	    {"A_C_DogChesBayRetriever_01"_J, "A_C_DogChesBayRetriever_01"},
 	    {"MP_A_C_Boar_01"_J, "MP_A_C_Boar_01"},
-	    {"MP_A_C_BUCK_01"_J, "MP_A_C_BUCK_01"},
-	    {"MP_A_C_BUFFALO_01"_J, "MP_A_C_BUFFALO_01"},
-	    {"MP_A_C_Cougar_01"_J, "MP_A_C_Cougar_01"},
-	    {"MP_A_C_Coyote_01"_J, "MP_A_C_Coyote_01"},
-	    {"MP_A_C_DEER"_J, "MP_A_C_DEER"},
-	    {"MP_A_C_DOGAMERICANFOXHOUND_01"_J, "MP_A_C_DOGAMERICANFOXHOUND_01"},
-	    {"MP_A_C_ELK_01"_J, "MP_A_C_ELK_01"},
-	    {"MP_A_C_FOX_01"_J, "MP_A_C_FOX_01"},
-	    {"MP_A_C_HORSECORPSE_01"_J, "MP_A_C_HORSECORPSE_01"},
-	    {"MP_A_C_MOOSE_01"_J, "MP_A_C_MOOSE_01"},
-	    {"MP_A_C_OWL_01"_J, "MP_A_C_OWL_01"},
-	    {"MP_A_C_Panther_01"_J, "MP_A_C_Panther_01"},
-	    {"MP_A_C_POSSUM_01"_J, "MP_A_C_POSSUM_01"},
-	    {"MP_A_C_PRONGHORN_01"_J, "MP_A_C_PRONGHORN_01"},
+	    {"SALOONBRAWLERS_10"_J, "SALOONBRAWLERS_10"},
+	    {"S_M_M_FussarHenchman_01"_J, "S_M_M_FussarHenchman_01"},
+	    {"S_M_M_TrainStationWorker_01"_J, "S_M_M_TrainStationWorker_01"},
+	    {"U_F_M_RkSHomesteadTenant_01"_J, "U_F_M_RkSHomesteadTenant_01"},
+	    {"CS_slavecatcher"_J, "CS_slavecatcher"},
+	    {"S_M_M_DispatchLawRural_01"_J, "S_M_M_DispatchLawRural_01"},
+	    {"MSP_GRAYS2_MALES_01"_J, "MSP_GRAYS2_MALES_01"},
+	    {"P_C_Horse_01"_J, "P_C_Horse_01"},
+	    {"G_M_O_UniExConfeds_01"_J, "G_M_O_UniExConfeds_01"},
+	    {"CS_Fire_Breather"_J, "CS_Fire_Breather"},
+	    {"CS_MP_CLIFF"_J, "CS_MP_CLIFF"},
+	    {"CS_braithwaitemaid"_J, "CS_braithwaitemaid"},
+	    {"CS_mollyoshea"_J, "CS_mollyoshea"},
+	    {"MOTHERHUBBARD_SADDLE_01"_J, "MOTHERHUBBARD_SADDLE_01"},
+	    {"CS_twingroupie_02"_J, "CS_twingroupie_02"},
+	    {"U_M_O_CMRCIVILWARCOMMANDO_01"_J, "U_M_O_CMRCIVILWARCOMMANDO_01"},
+	    {"A_M_M_BynFancyTravellers_01"_J, "A_M_M_BynFancyTravellers_01"},
+	    {"A_C_Horse_AmericanStandardbred_Buckskin"_J, "A_C_Horse_AmericanStandardbred_Buckskin"},
+	    {"P_U_M_M_ANIMALPOACHER_03"_J, "P_U_M_M_ANIMALPOACHER_03"},
+	    {"A_M_M_NbxDockWorkers_01"_J, "A_M_M_NbxDockWorkers_01"},
+	    {"U_F_O_Hermit_woman_01"_J, "U_F_O_Hermit_woman_01"},
+	    {"U_M_M_story_RHODES_01"_J, "U_M_M_story_RHODES_01"},
+	    {"S_M_M_RHDCOWPOKE_01"_J, "S_M_M_RHDCOWPOKE_01"},
+	    {"A_C_FishLakeSturgeon_01_lg"_J, "A_C_FishLakeSturgeon_01_lg"},
+	    {"MP_A_F_M_CARDGAMEPLAYERS_01"_J, "MP_A_F_M_CARDGAMEPLAYERS_01"},
+	    {"A_C_CedarWaxwing_01"_J, "A_C_CedarWaxwing_01"},
+	    {"RE_WAGONTHREAT_FEMALES_01"_J, "RE_WAGONTHREAT_FEMALES_01"},
+	    {"CS_SD_STREETKID_01"_J, "CS_SD_STREETKID_01"},
+	    {"CS_abigailroberts"_J, "CS_abigailroberts"},
+	    {"RE_OUTLAWLOOTER_MALES_01"_J, "RE_OUTLAWLOOTER_MALES_01"},
+	    {"A_M_M_HtlFancyDRIVERS_01"_J, "A_M_M_HtlFancyDRIVERS_01"},
+	    {"RE_DUELBOASTER_MALES_01"_J, "RE_DUELBOASTER_MALES_01"},
+	    {"A_M_M_FAMILYTRAVELERS_WARM_01"_J, "A_M_M_FAMILYTRAVELERS_WARM_01"},
+	    {"CS_MRLINTON"_J, "CS_MRLINTON"},
+	    {"CS_mrsgeddes"_J, "CS_mrsgeddes"},
+	    {"SALOONBRAWLERS_05"_J, "SALOONBRAWLERS_05"},
+	    {"RE_PISSPOT_FEMALES_01"_J, "RE_PISSPOT_FEMALES_01"},
+	    {"MP_U_M_M_ANIMALPOACHER_01"_J, "MP_U_M_M_ANIMALPOACHER_01"},
+	    {"CS_samaritan"_J, "CS_samaritan"},
+	    {"A_M_M_STRDEPUTYRESIDENT_01"_J, "A_M_M_STRDEPUTYRESIDENT_01"},
+	    {"CS_MEDITATINGMONK"_J, "CS_MEDITATINGMONK"},
+	    {"A_F_M_SKPPRISONONLINE_01"_J, "A_F_M_SKPPRISONONLINE_01"},
+	    {"CS_MP_MAGGIE"_J, "CS_MP_MAGGIE"},
+	    {"CS_EXCONFEDINFORMANT"_J, "CS_EXCONFEDINFORMANT"},
+	    {"U_M_M_SDEXOTICSSHOPKEEPER_01"_J, "U_M_M_SDEXOTICSSHOPKEEPER_01"},
+	    {"A_C_Horse_KentuckySaddle_Black"_J, "A_C_Horse_KentuckySaddle_Black"},
+	    {"MSP_MOB1_FEMALES_01"_J, "MSP_MOB1_FEMALES_01"},
+	    {"U_F_M_TumGeneralStoreOwner_01"_J, "U_F_M_TumGeneralStoreOwner_01"},
+	    {"msp_mob3_MALES_01"_J, "msp_mob3_MALES_01"},
+	    {"A_C_FishRedfinPickerel_01_ms"_J, "A_C_FishRedfinPickerel_01_ms"},
+	    {"RE_TREASUREHUNTER_MALES_01"_J, "RE_TREASUREHUNTER_MALES_01"},
+	    {"A_M_M_SDFANCYTRAVELLERS_01"_J, "A_M_M_SDFANCYTRAVELLERS_01"},
+	    {"MSP_SAINTDENIS1_MALES_01"_J, "MSP_SAINTDENIS1_MALES_01"},
+	    {"A_C_SnakeWater_01"_J, "A_C_SnakeWater_01"},
+	    {"CS_FRENCHMAN_01"_J, "CS_FRENCHMAN_01"},
+	    {"MP_G_M_M_UNICRIMINALS_03"_J, "MP_G_M_M_UNICRIMINALS_03"},
+	    {"A_C_Horse_NorfolkRoadster_RoseGrey"_J, "A_C_Horse_NorfolkRoadster_RoseGrey"},
+	    {"CS_bandsinger"_J, "CS_bandsinger"},
+	    {"A_C_Horse_Winter02_01"_J, "A_C_Horse_Winter02_01"},
+	    {"CS_CAJUN"_J, "CS_CAJUN"},
+	    {"CS_chainprisoner_02"_J, "CS_chainprisoner_02"},
+	    {"CS_baptiste"_J, "CS_baptiste"},
+	    {"RE_STALKINGHUNTER_MALES_01"_J, "RE_STALKINGHUNTER_MALES_01"},
+	    {"CS_DrHiggins"_J, "CS_DrHiggins"},
+	    {"S_M_M_VALDEPUTY_01"_J, "S_M_M_VALDEPUTY_01"},
+	    {"MSP_BRAITHWAITES1_MALES_01"_J, "MSP_BRAITHWAITES1_MALES_01"},
+	    {"A_F_M_GriFancyTravellers_01"_J, "A_F_M_GriFancyTravellers_01"},
 	    {"MP_A_C_RABBIT_01"_J, "MP_A_C_RABBIT_01"},
+	    {"RE_HORSERACE_FEMALES_01"_J, "RE_HORSERACE_FEMALES_01"},
+	    {"mp_male"_J, "mp_male"},
+	    {"CS_angusgeddes"_J, "CS_angusgeddes"},
+	    {"A_C_Turkey_02"_J, "A_C_Turkey_02"},
+	    {"MSP_BOUNTYHUNTER1_FEMALES_01"_J, "MSP_BOUNTYHUNTER1_FEMALES_01"},
+	    {"A_C_Seagull_01"_J, "A_C_Seagull_01"},
+	    {"RCES_EVELYNMILLER_MALES_01"_J, "RCES_EVELYNMILLER_MALES_01"},
+	    {"MP_FM_BOUNTYTARGET_MALES_DLC008_01"_J, "MP_FM_BOUNTYTARGET_MALES_DLC008_01"},
+	    {"CS_MysteriousStranger"_J, "CS_MysteriousStranger"},
+	    {"A_F_M_ValTownfolk_01"_J, "A_F_M_ValTownfolk_01"},
+	    {"MP_U_M_M_SALOONBRAWLERS_13"_J, "MP_U_M_M_SALOONBRAWLERS_13"},
+	    {"A_C_Horse_NorfolkRoadster_DappledBuckskin"_J, "A_C_Horse_NorfolkRoadster_DappledBuckskin"},
+	    {"A_M_M_RANCHERTRAVELERS_WARM_01"_J, "A_M_M_RANCHERTRAVELERS_WARM_01"},
+	    {"CS_ROCKYSEVEN_WIDOW"_J, "CS_ROCKYSEVEN_WIDOW"},
+	    {"RE_SAVAGEAFTERMATH_MALES_01"_J, "RE_SAVAGEAFTERMATH_MALES_01"},
+	    {"A_F_M_WapTownfolk_01"_J, "A_F_M_WapTownfolk_01"},
+	    {"A_C_Horse_Kladruber_White"_J, "A_C_Horse_Kladruber_White"},
+	    {"A_C_SnakeWater_Pelt_01"_J, "A_C_SnakeWater_Pelt_01"},
+	    {"CS_lenny"_J, "CS_lenny"},
+	    {"CS_ArchieDown"_J, "CS_ArchieDown"},
+	    {"MP_A_C_MOOSE_01"_J, "MP_A_C_MOOSE_01"},
+	    {"A_M_M_VALCRIMINALS_01"_J, "A_M_M_VALCRIMINALS_01"},
+	    {"U_M_M_MFRRANCHER_01"_J, "U_M_M_MFRRANCHER_01"},
+	    {"A_F_M_SDChinatown_01"_J, "A_F_M_SDChinatown_01"},
+	    {"RCSP_DUTCH1_MALES_01"_J, "RCSP_DUTCH1_MALES_01"},
+	    {"U_M_M_LrsHomesteadTenant_01"_J, "U_M_M_LrsHomesteadTenant_01"},
+	    {"RCSP_COACHROBBERY_MALES_01"_J, "RCSP_COACHROBBERY_MALES_01"},
+	    {"CS_leostrauss"_J, "CS_leostrauss"},
+	    {"CS_famousgunslinger_01"_J, "CS_famousgunslinger_01"},
 	    {"MP_A_C_RAM_01"_J, "MP_A_C_RAM_01"},
-	    {"MP_A_C_SHEEP_01"_J, "MP_A_C_SHEEP_01"},
-	    {"MP_A_C_Wolf_01"_J, "MP_A_C_Wolf_01"},
-	    {"MP_Horse_Owlhootvictim_01"_J, "MP_Horse_Owlhootvictim_01"},
-	    {"MP_U_M_M_LEGENDARYBOUNTY_09"_J, "MP_U_M_M_LEGENDARYBOUNTY_09"},
-	    {"P_C_Horse_01"_J, "P_C_Horse_01"},
-	    {"U_F_M_RhdNudeWoman_01"_J, "U_F_M_RhdNudeWoman_01"},
-	};
-}
\ No newline at end of file
+	    {"A_C_Horse_TennesseeWalker_DappleBay"_J, "A_C_Horse_TennesseeWalker_DappleBay"},
+	    {"CS_WapitiBoy"_J, "CS_WapitiBoy"},
+	    {"RCSP_BEAUANDPENELOPE1_FEMALES_01"_J, "RCSP_BEAUANDPENELOPE1_FEMALES_01"},
+	    {"RE_BOATATTACK_MALES_01"_J, "RE_BOATATTACK_MALES_01"},
+	    {"A_C_Horse_HungarianHalfbred_PiebaldTobiano"_J, "A_C_Horse_HungarianHalfbred_PiebaldTobiano"},
+	    {"CS_bartholomewbraithwaite"_J, "CS_bartholomewbraithwaite"},
+	    {"A_F_M_MIDDLETRAINPASSENGERS_01"_J, "A_F_M_MIDDLETRAINPASSENGERS_01"},
+	    {"CS_MIXEDRACEKID"_J, "CS_MIXEDRACEKID"},
+	    {"A_F_M_LagTownfolk_01"_J, "A_F_M_LagTownfolk_01"},
+	    {"U_M_M_NBXGraverobber_01"_J, "U_M_M_NBXGraverobber_01"},
+	    {"CS_BeatenUpCaptain"_J, "CS_BeatenUpCaptain"},
+	    {"SALOONBRAWLERS_02"_J, "SALOONBRAWLERS_02"},
+	    {"S_M_M_STRCOWPOKE_01"_J, "S_M_M_STRCOWPOKE_01"},
+	    {"A_C_Cow"_J, "A_C_Cow"},
+	    {"CS_edgarross"_J, "CS_edgarross"},
+	    {"CS_twingroupie_01"_J, "CS_twingroupie_01"},
+	    {"RE_DEADJOHN_MALES_01"_J, "RE_DEADJOHN_MALES_01"},
+	    {"MP_A_C_PRONGHORN_01"_J, "MP_A_C_PRONGHORN_01"},
+	    {"RE_TAUNTING_01"_J, "RE_TAUNTING_01"},
+	    {"A_M_M_UniBoatCrew_01"_J, "A_M_M_UniBoatCrew_01"},
+	    {"CS_MrsWeathers"_J, "CS_MrsWeathers"},
+	    {"CS_clive"_J, "CS_clive"},
+	    {"MP_ASN_BRAITHWAITEMANOR_MALES_01"_J, "MP_ASN_BRAITHWAITEMANOR_MALES_01"},
+	    {"RE_SAVAGEWAGON_FEMALES_01"_J, "RE_SAVAGEWAGON_FEMALES_01"},
+	    {"S_M_M_DispatchPolice_01"_J, "S_M_M_DispatchPolice_01"},
+	});
+}
@@ -1,2205 +1,2207 @@
 #pragma once
+#include "core/misc/ConstFlatMap.hpp"
 #include "util/Joaat.hpp"
 
 namespace YimMenu::Data
 {
-	const std::vector<std::pair<std::uint32_t, const char*>> g_SpScriptNames = {
-	    {"aberdeenpigfarm"_J, "aberdeenpigfarm"},
-	    {"abigail21_outro"_J, "abigail21_outro"},
-	    {"abigail2_1"_J, "abigail2_1"},
-	    {"abigail2_1_intro"_J, "abigail2_1_intro"},
+	// sorted by joaat, see ConstFlatMap
+	inline constexpr auto g_SpScriptNames = MakeConstFlatMap<joaat_t, const char*>({
+	    {"cv_cc_kar_03"_J, "cv_cc_kar_03"},
+	    {"beat_outlaw_transport"_J, "beat_outlaw_transport"},
+	    {"rcm_rains_fall1"_J, "rcm_rains_fall1"},
+	    {"rcm_edith_down21"_J, "rcm_edith_down21"},
+	    {"marston4"_J, "marston4"},
+	    {"beat_spooked_horse"_J, "beat_spooked_horse"},
+	    {"annesburg"_J, "annesburg"},
+	    {"metaped_editor"_J, "metaped_editor"},
+	    {"beat_diagnostics"_J, "beat_diagnostics"},
+	    {"cv_cc_dnj_06"_J, "cv_cc_dnj_06"},
+	    {"cv_cc_prs_01"_J, "cv_cc_prs_01"},
+	    {"poker_sp"_J, "poker_sp"},
+	    {"beat_drunk_dueler"_J, "beat_drunk_dueler"},
+	    {"pause_menu_replay_launcher"_J, "pause_menu_replay_launcher"},
+	    {"guama1"_J, "guama1"},
+	    {"pause_menu"_J, "pause_menu"},
+	    {"feud1"_J, "feud1"},
+	    {"ambush_odr_ride_out"_J, "ambush_odr_ride_out"},
+	    {"cv_wnt_dtc_downes01"_J, "cv_wnt_dtc_downes01"},
+	    {"coffee_drinking"_J, "coffee_drinking"},
+	    {"event_area_centralunion_stg2"_J, "event_area_centralunion_stg2"},
+	    {"hunting_zone_coyote"_J, "hunting_zone_coyote"},
+	    {"cv_cc_swn_15"_J, "cv_cc_swn_15"},
+	    {"rcm_abigail31"_J, "rcm_abigail31"},
+	    {"cv_cc_dnh_08"_J, "cv_cc_dnh_08"},
+	    {"law_guama"_J, "law_guama"},
+	    {"focus_ped_cam"_J, "focus_ped_cam"},
+	    {"medium_update"_J, "medium_update"},
+	    {"cv_cc_dtc_32"_J, "cv_cc_dtc_32"},
+	    {"av_bird_swarm"_J, "av_bird_swarm"},
+	    {"rcm_mary01"_J, "rcm_mary01"},
+	    {"cv_cc_bll_06"_J, "cv_cc_bll_06"},
+	    {"region_law_val_belltower_sniper"_J, "region_law_val_belltower_sniper"},
+	    {"def_comp_brain"_J, "def_comp_brain"},
+	    {"frozenexplorers"_J, "frozenexplorers"},
+	    {"junction_test_startup"_J, "junction_test_startup"},
+	    {"hunting_zone_boar"_J, "hunting_zone_boar"},
+	    {"mudtown1"_J, "mudtown1"},
+	    {"camp_tester"_J, "camp_tester"},
+	    {"cv_cc_sen_14"_J, "cv_cc_sen_14"},
+	    {"rcm_callaway3"_J, "rcm_callaway3"},
+	    {"grays3"_J, "grays3"},
+	    {"cv_cc_sen_12"_J, "cv_cc_sen_12"},
+	    {"spd_tinyhermit1"_J, "spd_tinyhermit1"},
+	    {"cv_cc_abi_17"_J, "cv_cc_abi_17"},
+	    {"deadsettler"_J, "deadsettler"},
+	    {"cv_cc_mrb_03"_J, "cv_cc_mrb_03"},
+	    {"rcm_bh_sd_saloon"_J, "rcm_bh_sd_saloon"},
+	    {"native_son2"_J, "native_son2"},
 	    {"act_bankrobbery01"_J, "act_bankrobbery01"},
-	    {"act_cajav_homerob1"_J, "act_cajav_homerob1"},
-	    {"act_calen_fff1"_J, "act_calen_fff1"},
-	    {"act_camp_dominoes_light"_J, "act_camp_dominoes_light"},
-	    {"act_camp_fff_light"_J, "act_camp_fff_light"},
-	    {"act_camp_poker_light"_J, "act_camp_poker_light"},
-	    {"act_caunc_rustling"_J, "act_caunc_rustling"},
-	    {"act_caunc_rustling_invite"_J, "act_caunc_rustling_invite"},
-	    {"act_fishing01"_J, "act_fishing01"},
-	    {"act_fishing03"_J, "act_fishing03"},
-	    {"act_fishing06"_J, "act_fishing06"},
-	    {"act_gen_dominoes"_J, "act_gen_dominoes"},
-	    {"act_gen_fff"_J, "act_gen_fff"},
-	    {"act_gen_fishing"_J, "act_gen_fishing"},
-	    {"act_gen_poker"_J, "act_gen_poker"},
-	    {"act_hunting_2"_J, "act_hunting_2"},
-	    {"adlerranch"_J, "adlerranch"},
-	    {"aguasdulces"_J, "aguasdulces"},
-	    {"ambient_fishing_scenario"_J, "ambient_fishing_scenario"},
-	    {"ambient_load"_J, "ambient_load"},
-	    {"ambient_vignette_manager_loader"_J, "ambient_vignette_manager_loader"},
-	    {"ambush_bnd_cliff1"_J, "ambush_bnd_cliff1"},
-	    {"ambush_bnd_ridge_ambush"_J, "ambush_bnd_ridge_ambush"},
-	    {"ambush_bnd_sniper_attack"_J, "ambush_bnd_sniper_attack"},
-	    {"ambush_exc_bridge_trap"_J, "ambush_exc_bridge_trap"},
-	    {"ambush_exc_hide_cover"_J, "ambush_exc_hide_cover"},
+	    {"sf_playground_script"_J, "sf_playground_script"},
+	    {"doc_player_journal"_J, "doc_player_journal"},
+	    {"player_horse"_J, "player_horse"},
+	    {"av_traveller_gallop_past"_J, "av_traveller_gallop_past"},
+	    {"beat_wealthy_couple"_J, "beat_wealthy_couple"},
+	    {"rcm_jack2"_J, "rcm_jack2"},
+	    {"cv_cc_len_06"_J, "cv_cc_len_06"},
+	    {"rcm_native2"_J, "rcm_native2"},
+	    {"campfire_gang"_J, "campfire_gang"},
+	    {"herb_queens_orchid"_J, "herb_queens_orchid"},
+	    {"beat_fussar_chase"_J, "beat_fussar_chase"},
+	    {"vig_playlist_fud1_post"_J, "vig_playlist_fud1_post"},
+	    {"paintedsky"_J, "paintedsky"},
+	    {"mob1_outro"_J, "mob1_outro"},
+	    {"abigail21_outro"_J, "abigail21_outro"},
+	    {"cv_cc_kar_par_03"_J, "cv_cc_kar_par_03"},
+	    {"herb_yarrow"_J, "herb_yarrow"},
+	    {"test_startup"_J, "test_startup"},
+	    {"hanging_carcass"_J, "hanging_carcass"},
+	    {"beat_bandito_execution"_J, "beat_bandito_execution"},
+	    {"cv_cc_jav_07"_J, "cv_cc_jav_07"},
+	    {"camp_lakay"_J, "camp_lakay"},
+	    {"av_rams_headbutt"_J, "av_rams_headbutt"},
+	    {"cv_end_abi_05"_J, "cv_end_abi_05"},
+	    {"braithwaites3"_J, "braithwaites3"},
+	    {"generic_document_inspection"_J, "generic_document_inspection"},
+	    {"debug_metapeditor"_J, "debug_metapeditor"},
+	    {"test_startup2"_J, "test_startup2"},
+	    {"rcm_callaway12"_J, "rcm_callaway12"},
+	    {"cv_cc_jck_03"_J, "cv_cc_jck_03"},
+	    {"region_law_guama_fussar"_J, "region_law_guama_fussar"},
+	    {"vanhorntradingpost"_J, "vanhorntradingpost"},
+	    {"cv_cc_mch_20"_J, "cv_cc_mch_20"},
+	    {"bjack_launch_sp"_J, "bjack_launch_sp"},
+	    {"event_area_appleseed_stg2"_J, "event_area_appleseed_stg2"},
+	    {"winter1_outro"_J, "winter1_outro"},
+	    {"herb_evergreen_huckleberry"_J, "herb_evergreen_huckleberry"},
+	    {"spd_gavin2"_J, "spd_gavin2"},
+	    {"dinolady"_J, "dinolady"},
+	    {"cv_cc_mrb_12"_J, "cv_cc_mrb_12"},
+	    {"beat_domestic_dispute"_J, "beat_domestic_dispute"},
+	    {"native2_outro"_J, "native2_outro"},
+	    {"spd_blindmancassidy1"_J, "spd_blindmancassidy1"},
+	    {"winter1"_J, "winter1"},
+	    {"utopia2"_J, "utopia2"},
+	    {"cv_cc_kar_02"_J, "cv_cc_kar_02"},
+	    {"av_bear_vs_wolves"_J, "av_bear_vs_wolves"},
+	    {"cv_cc_kar_13"_J, "cv_cc_kar_13"},
+	    {"hunting_zone_panther_legendary"_J, "hunting_zone_panther_legendary"},
+	    {"spd_bummicky1"_J, "spd_bummicky1"},
+	    {"beat_drunk_camp"_J, "beat_drunk_camp"},
 	    {"ambush_exc_lookout_attack"_J, "ambush_exc_lookout_attack"},
-	    {"ambush_exc_road_robbery"_J, "ambush_exc_road_robbery"},
-	    {"ambush_exc_scm_prec"_J, "ambush_exc_scm_prec"},
-	    {"ambush_exc_wagon_bomb"_J, "ambush_exc_wagon_bomb"},
-	    {"ambush_exc_wagon_turret"_J, "ambush_exc_wagon_turret"},
-	    {"ambush_gen_night_rob"_J, "ambush_gen_night_rob"},
-	    {"ambush_inb_bridge_ambush"_J, "ambush_inb_bridge_ambush"},
+	    {"shack_beechersc1"_J, "shack_beechersc1"},
+	    {"cv_cc_jav_02"_J, "cv_cc_jav_02"},
+	    {"train_robbery4_intro"_J, "train_robbery4_intro"},
+	    {"av_shopkeeper_restock"_J, "av_shopkeeper_restock"},
+	    {"discoverable_hermit_woman"_J, "discoverable_hermit_woman"},
+	    {"native3_intro"_J, "native3_intro"},
+	    {"beat_odriscoll_town_encounter"_J, "beat_odriscoll_town_encounter"},
+	    {"debug_metapeditor_custom_launch"_J, "debug_metapeditor_custom_launch"},
+	    {"industry1"_J, "industry1"},
+	    {"cv_cc_mll_04"_J, "cv_cc_mll_04"},
+	    {"cv_amb_dog_pet_sitting"_J, "cv_amb_dog_pet_sitting"},
+	    {"event_area_centralunion_stg3"_J, "event_area_centralunion_stg3"},
+	    {"init_global_block_softsave"_J, "init_global_block_softsave"},
+	    {"camp_horseshoeoverlook"_J, "camp_horseshoeoverlook"},
+	    {"cv_amb_dog_lick_table"_J, "cv_amb_dog_lick_table"},
+	    {"cv_cc_prs_16"_J, "cv_cc_prs_16"},
+	    {"spd_blindmancassidy_horse_buck"_J, "spd_blindmancassidy_horse_buck"},
+	    {"law_arrest"_J, "law_arrest"},
+	    {"beat_bandito_breakout"_J, "beat_bandito_breakout"},
+	    {"mudtown1_intro"_J, "mudtown1_intro"},
+	    {"cv_cc_dtc_33"_J, "cv_cc_dtc_33"},
+	    {"beat_animal_mauling"_J, "beat_animal_mauling"},
+	    {"grays2_outro"_J, "grays2_outro"},
+	    {"cv_cc_bll_05"_J, "cv_cc_bll_05"},
+	    {"cv_cc_swn_10"_J, "cv_cc_swn_10"},
+	    {"cv_cc_ssn_12"_J, "cv_cc_ssn_12"},
+	    {"av_light_smoke"_J, "av_light_smoke"},
+	    {"rcm_chain_gang7"_J, "rcm_chain_gang7"},
+	    {"av_wolf_flee_wolves"_J, "av_wolf_flee_wolves"},
+	    {"cv_cc_abi_16"_J, "cv_cc_abi_16"},
+	    {"cv_cc_mrb_02"_J, "cv_cc_mrb_02"},
+	    {"cv_cc_dnh_09"_J, "cv_cc_dnh_09"},
+	    {"rcm_here_kitty_kitty5"_J, "rcm_here_kitty_kitty5"},
+	    {"xml_menus"_J, "xml_menus"},
+	    {"macfarlanesranch"_J, "macfarlanesranch"},
+	    {"cv_end_jck_06"_J, "cv_end_jck_06"},
+	    {"odriscolls1_intro"_J, "odriscolls1_intro"},
+	    {"cv_sph_prs_low_food_01"_J, "cv_sph_prs_low_food_01"},
+	    {"ambush_exc_hide_cover"_J, "ambush_exc_hide_cover"},
+	    {"cv_cc_abi_21"_J, "cv_cc_abi_21"},
 	    {"ambush_inb_forest"_J, "ambush_inb_forest"},
-	    {"ambush_inb_forest_attack"_J, "ambush_inb_forest_attack"},
-	    {"ambush_inb_harass"_J, "ambush_inb_harass"},
-	    {"ambush_inb_road_attack"_J, "ambush_inb_road_attack"},
-	    {"ambush_odr_bridge_ambush"_J, "ambush_odr_bridge_ambush"},
-	    {"ambush_odr_bridge_prevent"_J, "ambush_odr_bridge_prevent"},
-	    {"ambush_odr_bridge_trap"_J, "ambush_odr_bridge_trap"},
-	    {"ambush_odr_hso"_J, "ambush_odr_hso"},
-	    {"ambush_odr_lookout_attack"_J, "ambush_odr_lookout_attack"},
-	    {"ambush_odr_ride_out"_J, "ambush_odr_ride_out"},
-	    {"ambush_odr_road_prec"_J, "ambush_odr_road_prec"},
-	    {"ambush_odr_road_robbery"_J, "ambush_odr_road_robbery"},
-	    {"ambush_pnk_type1"_J, "ambush_pnk_type1"},
+	    {"lagras"_J, "lagras"},
+	    {"mudtown4"_J, "mudtown4"},
+	    {"cv_cc_kar_par_02"_J, "cv_cc_kar_par_02"},
+	    {"vig_playlist_mud5_post"_J, "vig_playlist_mud5_post"},
+	    {"cv_cc_hsh_04"_J, "cv_cc_hsh_04"},
+	    {"hunting1_intro"_J, "hunting1_intro"},
+	    {"event_area_appleseed_stg1"_J, "event_area_appleseed_stg1"},
+	    {"cv_cc_kar_12"_J, "cv_cc_kar_12"},
+	    {"herb_rams_head"_J, "herb_rams_head"},
+	    {"native_son1"_J, "native_son1"},
+	    {"strawberry"_J, "strawberry"},
+	    {"cv_cc_trl_01"_J, "cv_cc_trl_01"},
+	    {"ambush_exc_bridge_trap"_J, "ambush_exc_bridge_trap"},
+	    {"scaleform_minigame_test"_J, "scaleform_minigame_test"},
+	    {"herb_creeping_thyme"_J, "herb_creeping_thyme"},
+	    {"show_nbx_strongwoman"_J, "show_nbx_strongwoman"},
+	    {"butchercreek"_J, "butchercreek"},
+	    {"sadie2"_J, "sadie2"},
+	    {"odriscolls4_intro"_J, "odriscolls4_intro"},
+	    {"beat_public_hanging"_J, "beat_public_hanging"},
+	    {"cv_end_chr_01"_J, "cv_end_chr_01"},
+	    {"hideout_twinrocks"_J, "hideout_twinrocks"},
+	    {"av_rider_gallop"_J, "av_rider_gallop"},
+	    {"happyfamily"_J, "happyfamily"},
 	    {"ambush_rnc_type1"_J, "ambush_rnc_type1"},
-	    {"ambush_sav_corner"_J, "ambush_sav_corner"},
+	    {"industry3_intro"_J, "industry3_intro"},
+	    {"region_law_town_mob"_J, "region_law_town_mob"},
+	    {"generic_item_writing_on_back"_J, "generic_item_writing_on_back"},
+	    {"valentine"_J, "valentine"},
+	    {"horseshoeoverlook"_J, "horseshoeoverlook"},
+	    {"mob4_intro"_J, "mob4_intro"},
+	    {"init_global_block_transition"_J, "init_global_block_transition"},
+	    {"rcm_poisoned_well4"_J, "rcm_poisoned_well4"},
+	    {"rcm_homerob01"_J, "rcm_homerob01"},
+	    {"coachrobberies_gang4_invite"_J, "coachrobberies_gang4_invite"},
+	    {"riobravo_population"_J, "riobravo_population"},
+	    {"cv_cc_dna_01"_J, "cv_cc_dna_01"},
 	    {"ambush_sav_forest_attack"_J, "ambush_sav_forest_attack"},
-	    {"ambush_sav_lookout_attack"_J, "ambush_sav_lookout_attack"},
+	    {"law_office_stw"_J, "law_office_stw"},
+	    {"cv_cc_mch_10"_J, "cv_cc_mch_10"},
+	    {"placement_editor_vehicles"_J, "placement_editor_vehicles"},
+	    {"fillet_sp"_J, "fillet_sp"},
+	    {"security_door_peek_scenario"_J, "security_door_peek_scenario"},
+	    {"orangeplantation"_J, "orangeplantation"},
+	    {"cv_wnt_shared"_J, "cv_wnt_shared"},
+	    {"hunting_zone_bullgator"_J, "hunting_zone_bullgator"},
+	    {"cv_end_cnj_01"_J, "cv_end_cnj_01"},
+	    {"ambush_bnd_ridge_ambush"_J, "ambush_bnd_ridge_ambush"},
+	    {"pre_sean1_law"_J, "pre_sean1_law"},
+	    {"heartland_population"_J, "heartland_population"},
+	    {"generic_cutscene"_J, "generic_cutscene"},
+	    {"utopia1"_J, "utopia1"},
+	    {"money_scenario"_J, "money_scenario"},
+	    {"cv_cc_tll_01"_J, "cv_cc_tll_01"},
 	    {"ambush_sav_river_ambush"_J, "ambush_sav_river_ambush"},
-	    {"ambush_sav_tree_line"_J, "ambush_sav_tree_line"},
-	    {"angryisolationist"_J, "angryisolationist"},
-	    {"annesburg"_J, "annesburg"},
-	    {"armadillo"_J, "armadillo"},
-	    {"armoire_corpse_scenario"_J, "armoire_corpse_scenario"},
-	    {"asset_viewer_main"_J, "asset_viewer_main"},
-	    {"audiotest"_J, "audiotest"},
-	    {"av_alligator_boar_leg"_J, "av_alligator_boar_leg"},
-	    {"av_alligator_boar_neck"_J, "av_alligator_boar_neck"},
-	    {"av_alligator_eat_dead_bird"_J, "av_alligator_eat_dead_bird"},
-	    {"av_amb_camp_robbery"_J, "av_amb_camp_robbery"},
-	    {"av_animal_attack"_J, "av_animal_attack"},
-	    {"av_animal_carry_ride"_J, "av_animal_carry_ride"},
-	    {"av_animal_scavenger"_J, "av_animal_scavenger"},
-	    {"av_barber_shaving"_J, "av_barber_shaving"},
-	    {"av_bearblack_intimidate_bearblack"_J, "av_bearblack_intimidate_bearblack"},
-	    {"av_bear_intimidate_wolf"_J, "av_bear_intimidate_wolf"},
-	    {"av_bear_run_catch_fish"_J, "av_bear_run_catch_fish"},
-	    {"av_bear_scratch_back"_J, "av_bear_scratch_back"},
-	    {"av_bear_vs_wolves"_J, "av_bear_vs_wolves"},
-	    {"av_beaver_swim_with_branch"_J, "av_beaver_swim_with_branch"},
-	    {"av_big_cat_ambush_deer"_J, "av_big_cat_ambush_deer"},
-	    {"av_big_cat_kill_raccoon"_J, "av_big_cat_kill_raccoon"},
-	    {"av_birds_in_tree"_J, "av_birds_in_tree"},
-	    {"av_bird_fence_swarm"_J, "av_bird_fence_swarm"},
-	    {"av_bird_flee_swarm"_J, "av_bird_flee_swarm"},
-	    {"av_bird_land"_J, "av_bird_land"},
-	    {"av_bird_land_swarm"_J, "av_bird_land_swarm"},
-	    {"av_bird_on_animal"_J, "av_bird_on_animal"},
-	    {"av_bird_swarm"_J, "av_bird_swarm"},
-	    {"av_boat_placement"_J, "av_boat_placement"},
-	    {"av_body_toss"_J, "av_body_toss"},
-	    {"av_bucks_fighting"_J, "av_bucks_fighting"},
-	    {"av_buck_and_doe"_J, "av_buck_and_doe"},
-	    {"av_buffalo_vs_buffalo"_J, "av_buffalo_vs_buffalo"},
-	    {"av_butcher_shared"_J, "av_butcher_shared"},
-	    {"av_cat_carry_rat"_J, "av_cat_carry_rat"},
-	    {"av_cat_catch_bird"_J, "av_cat_catch_bird"},
-	    {"av_chamberpot_toss"_J, "av_chamberpot_toss"},
-	    {"av_coyote_catch_squirrel"_J, "av_coyote_catch_squirrel"},
-	    {"av_cross_road"_J, "av_cross_road"},
-	    {"av_crows_and_eagles_eat_deer"_J, "av_crows_and_eagles_eat_deer"},
-	    {"av_crows_and_vultures_eat_deer"_J, "av_crows_and_vultures_eat_deer"},
-	    {"av_dead_animal"_J, "av_dead_animal"},
-	    {"av_dead_horse"_J, "av_dead_horse"},
-	    {"av_deer_antlers_stuck"_J, "av_deer_antlers_stuck"},
-	    {"av_deer_tree_rub"_J, "av_deer_tree_rub"},
-	    {"av_discoverable_parakeet"_J, "av_discoverable_parakeet"},
-	    {"av_dogs_playing"_J, "av_dogs_playing"},
-	    {"av_dog_chase_cat"_J, "av_dog_chase_cat"},
-	    {"av_dog_chase_tail"_J, "av_dog_chase_tail"},
-	    {"av_dog_in_wagon"_J, "av_dog_in_wagon"},
-	    {"av_drop_rabbit_table"_J, "av_drop_rabbit_table"},
-	    {"av_eagle_catch_fish"_J, "av_eagle_catch_fish"},
-	    {"av_eagle_catch_rabbit"_J, "av_eagle_catch_rabbit"},
+	    {"braithwaites2_outro"_J, "braithwaites2_outro"},
+	    {"debug_newspapers"_J, "debug_newspapers"},
+	    {"rcm_strauss32"_J, "rcm_strauss32"},
+	    {"marston5_3_intro"_J, "marston5_3_intro"},
+	    {"camp_pronghornranch"_J, "camp_pronghornranch"},
+	    {"saloon_conversations"_J, "saloon_conversations"},
+	    {"beat_coach_robbery"_J, "beat_coach_robbery"},
+	    {"herb_black_currant"_J, "herb_black_currant"},
+	    {"shoprobberies"_J, "shoprobberies"},
+	    {"beat_frozen_to_death"_J, "beat_frozen_to_death"},
+	    {"cv_cc_jck_01"_J, "cv_cc_jck_01"},
+	    {"respawn_layout_editor"_J, "respawn_layout_editor"},
 	    {"av_eagle_catch_seasnake"_J, "av_eagle_catch_seasnake"},
-	    {"av_eagle_dive_catch_fish"_J, "av_eagle_dive_catch_fish"},
-	    {"av_female_rider_male_walker"_J, "av_female_rider_male_walker"},
-	    {"av_fishing_river"_J, "av_fishing_river"},
-	    {"av_fox_catch_rodent"_J, "av_fox_catch_rodent"},
-	    {"av_fox_hunt_in_snow"_J, "av_fox_hunt_in_snow"},
+	    {"hideout_smugglerdocks"_J, "hideout_smugglerdocks"},
+	    {"shop_horse_shop"_J, "shop_horse_shop"},
+	    {"cv_cc_ssn_11"_J, "cv_cc_ssn_11"},
+	    {"rhodes_donkeys"_J, "rhodes_donkeys"},
+	    {"cornwall1_intro"_J, "cornwall1_intro"},
+	    {"vig_playlist_party_sdb"_J, "vig_playlist_party_sdb"},
+	    {"rcm_treasure_hunter"_J, "rcm_treasure_hunter"},
+	    {"av_dead_horse"_J, "av_dead_horse"},
+	    {"feud1_outro"_J, "feud1_outro"},
+	    {"cv_cc_dog_04"_J, "cv_cc_dog_04"},
+	    {"cv_wrk_hsh_02"_J, "cv_wrk_hsh_02"},
+	    {"cv_cc_prs_17"_J, "cv_cc_prs_17"},
+	    {"larnedsod"_J, "larnedsod"},
+	    {"native_son3_outro"_J, "native_son3_outro"},
+	    {"cv_cc_bll_09"_J, "cv_cc_bll_09"},
+	    {"rcm_gunslinger2_1"_J, "rcm_gunslinger2_1"},
 	    {"av_fox_sit"_J, "av_fox_sit"},
-	    {"av_get_directions"_J, "av_get_directions"},
-	    {"av_hawk_catch_snake"_J, "av_hawk_catch_snake"},
-	    {"av_hobo_train_hop"_J, "av_hobo_train_hop"},
-	    {"av_light_smoke"_J, "av_light_smoke"},
-	    {"av_lumber_pass"_J, "av_lumber_pass"},
-	    {"av_macfarlane_farmer"_J, "av_macfarlane_farmer"},
-	    {"av_mangy_dog_and_vultures"_J, "av_mangy_dog_and_vultures"},
-	    {"av_man_jump_fence"_J, "av_man_jump_fence"},
-	    {"av_man_sit_read"_J, "av_man_sit_read"},
-	    {"av_man_stand_at_wagon"_J, "av_man_stand_at_wagon"},
-	    {"av_man_with_lantern"_J, "av_man_with_lantern"},
-	    {"av_moose_slipping"_J, "av_moose_slipping"},
-	    {"av_owl_catch_rat"_J, "av_owl_catch_rat"},
-	    {"av_pelican_dive"_J, "av_pelican_dive"},
-	    {"av_pump_cart"_J, "av_pump_cart"},
-	    {"av_rams_headbutt"_J, "av_rams_headbutt"},
-	    {"av_rats_eating_group"_J, "av_rats_eating_group"},
-	    {"av_rats_eat_deer"_J, "av_rats_eat_deer"},
-	    {"av_rider_gallop"_J, "av_rider_gallop"},
-	    {"av_ridgeline_animal"_J, "av_ridgeline_animal"},
-	    {"av_ridgeline_native"_J, "av_ridgeline_native"},
-	    {"av_ridgeline_rider"_J, "av_ridgeline_rider"},
-	    {"av_roving_herd"_J, "av_roving_herd"},
-	    {"av_scavenger_on_animal"_J, "av_scavenger_on_animal"},
-	    {"av_seagull_catch_fish"_J, "av_seagull_catch_fish"},
-	    {"av_sheep_grazing"_J, "av_sheep_grazing"},
-	    {"av_shopkeeper_restock"_J, "av_shopkeeper_restock"},
-	    {"av_slow_rider"_J, "av_slow_rider"},
-	    {"av_squirrel_chase_squirrel"_J, "av_squirrel_chase_squirrel"},
-	    {"av_stage_coach"_J, "av_stage_coach"},
-	    {"av_starting_to_rain"_J, "av_starting_to_rain"},
-	    {"av_swimming_animal"_J, "av_swimming_animal"},
-	    {"av_swim_wolf_chase_moose"_J, "av_swim_wolf_chase_moose"},
-	    {"av_traveller_gallop_past"_J, "av_traveller_gallop_past"},
-	    {"av_vultures_eat_carcass"_J, "av_vultures_eat_carcass"},
-	    {"av_wagon_back_passenger"_J, "av_wagon_back_passenger"},
-	    {"av_wagon_barrel"_J, "av_wagon_barrel"},
-	    {"av_wagon_music"_J, "av_wagon_music"},
-	    {"av_wagon_sweeper"_J, "av_wagon_sweeper"},
-	    {"av_walk_horse_carry_deer"_J, "av_walk_horse_carry_deer"},
-	    {"av_walk_with_dog"_J, "av_walk_with_dog"},
-	    {"av_walk_with_horse"_J, "av_walk_with_horse"},
-	    {"av_wall_vomit"_J, "av_wall_vomit"},
-	    {"av_water_horse"_J, "av_water_horse"},
-	    {"av_whisper_sit"_J, "av_whisper_sit"},
-	    {"av_whore_give_money"_J, "av_whore_give_money"},
-	    {"av_wild_animal"_J, "av_wild_animal"},
-	    {"av_wolf_ambush_deer"_J, "av_wolf_ambush_deer"},
-	    {"av_wolf_flee_wolves"_J, "av_wolf_flee_wolves"},
-	    {"av_wolf_takedown_miss"_J, "av_wolf_takedown_miss"},
-	    {"av_wolves_alarmed"_J, "av_wolves_alarmed"},
-	    {"av_wolves_eat_deer"_J, "av_wolves_eat_deer"},
-	    {"av_wolves_howling"_J, "av_wolves_howling"},
-	    {"av_wolves_playing"_J, "av_wolves_playing"},
-	    {"bandana"_J, "bandana"},
-	    {"bankrob01_invite"_J, "bankrob01_invite"},
-	    {"bankrobberies_simple"_J, "bankrobberies_simple"},
-	    {"barcustomer_interaction"_J, "barcustomer_interaction"},
-	    {"bathing"_J, "bathing"},
-	    {"bayounwa_population"_J, "bayounwa_population"},
-	    {"beat_animal_attack"_J, "beat_animal_attack"},
-	    {"beat_animal_mauling"_J, "beat_animal_mauling"},
-	    {"beat_approach"_J, "beat_approach"},
-	    {"beat_arms_deal"_J, "beat_arms_deal"},
-	    {"beat_author"_J, "beat_author"},
-	    {"beat_bandito_breakout"_J, "beat_bandito_breakout"},
-	    {"beat_bandito_execution"_J, "beat_bandito_execution"},
-	    {"beat_bear_trap"_J, "beat_bear_trap"},
-	    {"beat_boat_attack"_J, "beat_boat_attack"},
-	    {"beat_booby_trap"_J, "beat_booby_trap"},
-	    {"beat_bounty_transport"_J, "beat_bounty_transport"},
+	    {"cv_cc_hsh_07"_J, "cv_cc_hsh_07"},
+	    {"vig_playlist_dtc1_post"_J, "vig_playlist_dtc1_post"},
+	    {"herb_milkweed_single"_J, "herb_milkweed_single"},
+	    {"cv_cc_kie_13"_J, "cv_cc_kie_13"},
+	    {"event_area_fortriggsholdingcamp"_J, "event_area_fortriggsholdingcamp"},
+	    {"rcm_mudtown3_2"_J, "rcm_mudtown3_2"},
+	    {"dominoes_sp"_J, "dominoes_sp"},
+	    {"beat_hunter"_J, "beat_hunter"},
+	    {"rcm_beau_and_penelope10"_J, "rcm_beau_and_penelope10"},
+	    {"beat_hostage_rescue"_J, "beat_hostage_rescue"},
+	    {"marston5_1_intro"_J, "marston5_1_intro"},
+	    {"bjack_sp"_J, "bjack_sp"},
+	    {"beat_town_burial"_J, "beat_town_burial"},
+	    {"rcm_chain_gang2"_J, "rcm_chain_gang2"},
+	    {"laramie1_intro"_J, "laramie1_intro"},
+	    {"herb_common_bulrush"_J, "herb_common_bulrush"},
+	    {"beat_people_in_need_snake_bite"_J, "beat_people_in_need_snake_bite"},
+	    {"discoverable_tree_trunk_boat"_J, "discoverable_tree_trunk_boat"},
 	    {"beat_brontes_town_encounter"_J, "beat_brontes_town_encounter"},
+	    {"shack_hungrybear1"_J, "shack_hungrybear1"},
+	    {"singing"_J, "singing"},
+	    {"rcm_for_my_art2"_J, "rcm_for_my_art2"},
+	    {"emeraldranch"_J, "emeraldranch"},
+	    {"physics_perf_test"_J, "physics_perf_test"},
+	    {"main"_J, "main"},
+	    {"spd_agnesdowd1"_J, "spd_agnesdowd1"},
+	    {"cv_cc_prs_05"_J, "cv_cc_prs_05"},
+	    {"cv_cc_chr_02"_J, "cv_cc_chr_02"},
+	    {"placement_editor_props"_J, "placement_editor_props"},
+	    {"av_beaver_swim_with_branch"_J, "av_beaver_swim_with_branch"},
+	    {"cv_cc_dtc_34"_J, "cv_cc_dtc_34"},
+	    {"cv_amb_jack_poke_fire"_J, "cv_amb_jack_poke_fire"},
+	    {"saint_denis1_intro"_J, "saint_denis1_intro"},
+	    {"taxidermy"_J, "taxidermy"},
+	    {"rcm_monroe11"_J, "rcm_monroe11"},
+	    {"mudtown3_intro"_J, "mudtown3_intro"},
+	    {"beat_locked_safe"_J, "beat_locked_safe"},
+	    {"cv_cc_hsh_11"_J, "cv_cc_hsh_11"},
+	    {"cv_itm_chr_02"_J, "cv_itm_chr_02"},
+	    {"rcm_dusters21"_J, "rcm_dusters21"},
+	    {"generic_wagon_fence_core"_J, "generic_wagon_fence_core"},
+	    {"dominoesintro_invite"_J, "dominoesintro_invite"},
+	    {"cv_cc_kar_01"_J, "cv_cc_kar_01"},
+	    {"rcm_dutch21"_J, "rcm_dutch21"},
+	    {"cv_cc_dtc_23"_J, "cv_cc_dtc_23"},
+	    {"av_moose_slipping"_J, "av_moose_slipping"},
+	    {"ransack_moneybag"_J, "ransack_moneybag"},
+	    {"cv_wrk_mch_01"_J, "cv_wrk_mch_01"},
+	    {"rcm_gunslinger1_2"_J, "rcm_gunslinger1_2"},
+	    {"av_deer_antlers_stuck"_J, "av_deer_antlers_stuck"},
+	    {"rcm_collect_exotics1"_J, "rcm_collect_exotics1"},
+	    {"act_gen_poker"_J, "act_gen_poker"},
+	    {"gang3"_J, "gang3"},
+	    {"saintdenis"_J, "saintdenis"},
+	    {"herb_ghost_orchid"_J, "herb_ghost_orchid"},
+	    {"colter"_J, "colter"},
+	    {"rcm_bh_skinner_search"_J, "rcm_bh_skinner_search"},
+	    {"av_buck_and_doe"_J, "av_buck_and_doe"},
+	    {"ambush_bnd_cliff1"_J, "ambush_bnd_cliff1"},
+	    {"scaleform_dynamic_items_creation_test"_J, "scaleform_dynamic_items_creation_test"},
+	    {"rcm_poisoned_well5"_J, "rcm_poisoned_well5"},
+	    {"grays3_intro"_J, "grays3_intro"},
+	    {"cv_cc_unc_04"_J, "cv_cc_unc_04"},
+	    {"luckyscabin"_J, "luckyscabin"},
+	    {"beechers2_2"_J, "beechers2_2"},
+	    {"beat_murder_campfire"_J, "beat_murder_campfire"},
+	    {"spd_grizzledjon1"_J, "spd_grizzledjon1"},
+	    {"camera_photomode"_J, "camera_photomode"},
+	    {"lonniesshack"_J, "lonniesshack"},
+	    {"cv_end_anu_01"_J, "cv_end_anu_01"},
+	    {"grays2_intro"_J, "grays2_intro"},
+	    {"cv_amb_sack_wagon"_J, "cv_amb_sack_wagon"},
+	    {"av_alligator_eat_dead_bird"_J, "av_alligator_eat_dead_bird"},
+	    {"herb_red_raspberry"_J, "herb_red_raspberry"},
+	    {"cv_cc_dnj_07"_J, "cv_cc_dnj_07"},
+	    {"cv_end_jck_04"_J, "cv_end_jck_04"},
+	    {"ambush_exc_wagon_bomb"_J, "ambush_exc_wagon_bomb"},
+	    {"rcm_strauss31"_J, "rcm_strauss31"},
+	    {"beat_parlor_ambush"_J, "beat_parlor_ambush"},
+	    {"init_global_block_profiler"_J, "init_global_block_profiler"},
+	    {"beat_lost_friend"_J, "beat_lost_friend"},
+	    {"cv_cc_swn_09"_J, "cv_cc_swn_09"},
+	    {"scaleform_pause_menu_demo"_J, "scaleform_pause_menu_demo"},
+	    {"cv_end_abi_07"_J, "cv_end_abi_07"},
+	    {"cv_cc_ssn_10"_J, "cv_cc_ssn_10"},
+	    {"rcm_collect_dinosaur_bones11"_J, "rcm_collect_dinosaur_bones11"},
+	    {"hideout_shadybelle"_J, "hideout_shadybelle"},
+	    {"rcm_fundraiser"_J, "rcm_fundraiser"},
+	    {"shepherdsrise"_J, "shepherdsrise"},
+	    {"rcm_serial_killer1"_J, "rcm_serial_killer1"},
+	    {"cv_cc_jhn_02"_J, "cv_cc_jhn_02"},
+	    {"vig_playlist_sad1_post"_J, "vig_playlist_sad1_post"},
+	    {"mob5_intro"_J, "mob5_intro"},
+	    {"discoverable_indian_burial"_J, "discoverable_indian_burial"},
+	    {"respawn_persistence"_J, "respawn_persistence"},
+	    {"gang1_outro"_J, "gang1_outro"},
+	    {"camp_beaverhollow"_J, "camp_beaverhollow"},
+	    {"init_global_block_mc_race"_J, "init_global_block_mc_race"},
+	    {"cv_cc_mll_02"_J, "cv_cc_mll_02"},
+	    {"av_mangy_dog_and_vultures"_J, "av_mangy_dog_and_vultures"},
+	    {"spd_giant_birds"_J, "spd_giant_birds"},
+	    {"rcm_bh_bandito_mine"_J, "rcm_bh_bandito_mine"},
+	    {"pronghornranch"_J, "pronghornranch"},
+	    {"region_law_patrol_creator"_J, "region_law_patrol_creator"},
+	    {"mob2_intro"_J, "mob2_intro"},
 	    {"beat_bronte_patrol"_J, "beat_bronte_patrol"},
-	    {"beat_burning_bodies"_J, "beat_burning_bodies"},
+	    {"coachrobberies_gang1"_J, "coachrobberies_gang1"},
+	    {"spd_endlessstrainer1"_J, "spd_endlessstrainer1"},
+	    {"train_annesburg"_J, "train_annesburg"},
+	    {"beat_laramie_gang_rustling"_J, "beat_laramie_gang_rustling"},
+	    {"finale1_intro"_J, "finale1_intro"},
+	    {"marston5_2"_J, "marston5_2"},
+	    {"spd_civilwarcommando"_J, "spd_civilwarcommando"},
 	    {"beat_campfire_ambush"_J, "beat_campfire_ambush"},
-	    {"beat_chain_gang"_J, "beat_chain_gang"},
-	    {"beat_checkpoint"_J, "beat_checkpoint"},
-	    {"beat_coach_robbery"_J, "beat_coach_robbery"},
-	    {"beat_consequence"_J, "beat_consequence"},
-	    {"beat_corpse_cart"_J, "beat_corpse_cart"},
-	    {"beat_crashed_wagon"_J, "beat_crashed_wagon"},
-	    {"beat_dark_alley_ambush"_J, "beat_dark_alley_ambush"},
-	    {"beat_dark_alley_bum"_J, "beat_dark_alley_bum"},
-	    {"beat_dark_alley_stabber"_J, "beat_dark_alley_stabber"},
-	    {"beat_dead_bodies"_J, "beat_dead_bodies"},
-	    {"beat_dead_john"_J, "beat_dead_john"},
-	    {"beat_del_lobo_posse"_J, "beat_del_lobo_posse"},
-	    {"beat_diagnostics"_J, "beat_diagnostics"},
-	    {"beat_disabled_beggar"_J, "beat_disabled_beggar"},
-	    {"beat_domestic_dispute"_J, "beat_domestic_dispute"},
-	    {"beat_drown_murder"_J, "beat_drown_murder"},
-	    {"beat_drunk_camp"_J, "beat_drunk_camp"},
-	    {"beat_drunk_dueler"_J, "beat_drunk_dueler"},
-	    {"beat_duel_boaster"_J, "beat_duel_boaster"},
-	    {"beat_duel_winner"_J, "beat_duel_winner"},
-	    {"beat_escort"_J, "beat_escort"},
-	    {"beat_executions"_J, "beat_executions"},
-	    {"beat_fleeing_family"_J, "beat_fleeing_family"},
-	    {"beat_fleeing_trespasser"_J, "beat_fleeing_trespasser"},
-	    {"beat_foot_robbery"_J, "beat_foot_robbery"},
-	    {"beat_friendly_outdoorsman"_J, "beat_friendly_outdoorsman"},
-	    {"beat_frozen_to_death"_J, "beat_frozen_to_death"},
-	    {"beat_fussar_chase"_J, "beat_fussar_chase"},
-	    {"beat_gang_camp_reminder"_J, "beat_gang_camp_reminder"},
-	    {"beat_gang_ped1_encounter"_J, "beat_gang_ped1_encounter"},
-	    {"beat_gold_panner"_J, "beat_gold_panner"},
-	    {"beat_herbalist_camp"_J, "beat_herbalist_camp"},
-	    {"beat_horse_race"_J, "beat_horse_race"},
-	    {"beat_hostage_rescue"_J, "beat_hostage_rescue"},
-	    {"beat_hunter"_J, "beat_hunter"},
-	    {"beat_inbred_kidnap"_J, "beat_inbred_kidnap"},
-	    {"beat_injured_rider"_J, "beat_injured_rider"},
-	    {"beat_intimidation_tactics"_J, "beat_intimidation_tactics"},
-	    {"beat_kidnap_victim"_J, "beat_kidnap_victim"},
-	    {"beat_laramie_gang_rustling"_J, "beat_laramie_gang_rustling"},
-	    {"beat_layout_editor"_J, "beat_layout_editor"},
-	    {"beat_lemoyne_town_encounter"_J, "beat_lemoyne_town_encounter"},
-	    {"beat_locked_safe"_J, "beat_locked_safe"},
-	    {"beat_lone_prisoner"_J, "beat_lone_prisoner"},
-	    {"beat_lost_dog"_J, "beat_lost_dog"},
-	    {"beat_lost_drunk"_J, "beat_lost_drunk"},
-	    {"beat_lost_friend"_J, "beat_lost_friend"},
-	    {"beat_lost_man"_J, "beat_lost_man"},
-	    {"beat_moonshine_camp"_J, "beat_moonshine_camp"},
-	    {"beat_murder_campfire"_J, "beat_murder_campfire"},
-	    {"beat_naked_swimmer"_J, "beat_naked_swimmer"},
-	    {"beat_odriscoll_town_encounter"_J, "beat_odriscoll_town_encounter"},
-	    {"beat_on_the_run"_J, "beat_on_the_run"},
-	    {"beat_outlaw_looter"_J, "beat_outlaw_looter"},
-	    {"beat_outlaw_transport"_J, "beat_outlaw_transport"},
-	    {"beat_parlor_ambush"_J, "beat_parlor_ambush"},
-	    {"beat_peeping_tom"_J, "beat_peeping_tom"},
-	    {"beat_people_in_need_snake_bite"_J, "beat_people_in_need_snake_bite"},
-	    {"beat_pickpocket"_J, "beat_pickpocket"},
-	    {"beat_piss_pot"_J, "beat_piss_pot"},
-	    {"beat_player_camp_attack"_J, "beat_player_camp_attack"},
-	    {"beat_player_camp_stranger"_J, "beat_player_camp_stranger"},
-	    {"beat_poisoned"_J, "beat_poisoned"},
-	    {"beat_police_chase"_J, "beat_police_chase"},
-	    {"beat_posse_breakout"_J, "beat_posse_breakout"},
-	    {"beat_prison_wagon"_J, "beat_prison_wagon"},
-	    {"beat_public_hanging"_J, "beat_public_hanging"},
-	    {"beat_rally"_J, "beat_rally"},
-	    {"beat_rally_dispute"_J, "beat_rally_dispute"},
-	    {"beat_rally_setup"_J, "beat_rally_setup"},
-	    {"beat_rat_infestation"_J, "beat_rat_infestation"},
-	    {"beat_rifle_practice"_J, "beat_rifle_practice"},
-	    {"beat_rowdy_drunks"_J, "beat_rowdy_drunks"},
-	    {"beat_savage_aftermath"_J, "beat_savage_aftermath"},
-	    {"beat_savage_fight"_J, "beat_savage_fight"},
-	    {"beat_savage_wagon"_J, "beat_savage_wagon"},
-	    {"beat_savage_warning"_J, "beat_savage_warning"},
-	    {"beat_sharp_shooter"_J, "beat_sharp_shooter"},
-	    {"beat_show_off"_J, "beat_show_off"},
-	    {"beat_skipping_stones"_J, "beat_skipping_stones"},
-	    {"beat_slum_ambush"_J, "beat_slum_ambush"},
-	    {"beat_spooked_horse"_J, "beat_spooked_horse"},
-	    {"beat_stalking_shadows"_J, "beat_stalking_shadows"},
-	    {"beat_stranded_rider"_J, "beat_stranded_rider"},
-	    {"beat_street_fight"_J, "beat_street_fight"},
-	    {"beat_taunting"_J, "beat_taunting"},
-	    {"beat_torch_procession"_J, "beat_torch_procession"},
-	    {"beat_torturing_captive"_J, "beat_torturing_captive"},
-	    {"beat_town_burial"_J, "beat_town_burial"},
-	    {"beat_town_confrontation"_J, "beat_town_confrontation"},
-	    {"beat_town_robbery"_J, "beat_town_robbery"},
-	    {"beat_town_trouble"_J, "beat_town_trouble"},
-	    {"beat_town_widow"_J, "beat_town_widow"},
-	    {"beat_traffic_attack"_J, "beat_traffic_attack"},
+	    {"swansonstation"_J, "swansonstation"},
+	    {"walk_and_talk_test_script_widget"_J, "walk_and_talk_test_script_widget"},
+	    {"cv_cc_jhn_01"_J, "cv_cc_jhn_01"},
+	    {"event_area_centralunion_stg1"_J, "event_area_centralunion_stg1"},
+	    {"cv_cc_jhn_10"_J, "cv_cc_jhn_10"},
+	    {"hunting_zone_buck"_J, "hunting_zone_buck"},
+	    {"cv_cc_chr_03"_J, "cv_cc_chr_03"},
 	    {"beat_train_holdup"_J, "beat_train_holdup"},
-	    {"beat_trapped_woman"_J, "beat_trapped_woman"},
-	    {"beat_treasure_hunter"_J, "beat_treasure_hunter"},
-	    {"beat_voice"_J, "beat_voice"},
-	    {"beat_wagon_threat"_J, "beat_wagon_threat"},
-	    {"beat_washed_ashore"_J, "beat_washed_ashore"},
-	    {"beat_wealthy_couple"_J, "beat_wealthy_couple"},
-	    {"beat_wilderness_hanging"_J, "beat_wilderness_hanging"},
-	    {"beat_wild_man"_J, "beat_wild_man"},
-	    {"beat_wild_man_cave"_J, "beat_wild_man_cave"},
-	    {"beaverhollow"_J, "beaverhollow"},
-	    {"beechers2_2"_J, "beechers2_2"},
-	    {"beechers2_2_intro"_J, "beechers2_2_intro"},
-	    {"beechers2_2_outro"_J, "beechers2_2_outro"},
+	    {"reverend1_outro"_J, "reverend1_outro"},
+	    {"beat_player_camp_attack"_J, "beat_player_camp_attack"},
+	    {"rcm_doctors_opinion1"_J, "rcm_doctors_opinion1"},
+	    {"native_son3_intro"_J, "native_son3_intro"},
+	    {"herb_wintergreen_berry"_J, "herb_wintergreen_berry"},
+	    {"herb_burdock_root_single"_J, "herb_burdock_root_single"},
+	    {"herb_night_scented_orchid"_J, "herb_night_scented_orchid"},
+	    {"placement_editor_prop_sets"_J, "placement_editor_prop_sets"},
+	    {"disco_letter"_J, "disco_letter"},
+	    {"cv_sph_dtc_bvh_01"_J, "cv_sph_dtc_bvh_01"},
+	    {"rcm_bh_camp_return"_J, "rcm_bh_camp_return"},
+	    {"cornwall1_outro"_J, "cornwall1_outro"},
+	    {"homerobjavier_invite"_J, "homerobjavier_invite"},
+	    {"cv_cc_jav_09"_J, "cv_cc_jav_09"},
+	    {"loanshark_miner1"_J, "loanshark_miner1"},
+	    {"cv_cc_dog_05"_J, "cv_cc_dog_05"},
 	    {"beechersc"_J, "beechersc"},
-	    {"beechershope"_J, "beechershope"},
-	    {"beechers_cow"_J, "beechers_cow"},
-	    {"benchmark"_J, "benchmark"},
-	    {"benedictpoint"_J, "benedictpoint"},
-	    {"bigvalleytrapper"_J, "bigvalleytrapper"},
-	    {"bigvalley_population"_J, "bigvalley_population"},
-	    {"binoculars"_J, "binoculars"},
-	    {"bjack_launch_sp"_J, "bjack_launch_sp"},
-	    {"bjack_sp"_J, "bjack_sp"},
+	    {"cv_cc_kie_14"_J, "cv_cc_kie_14"},
+	    {"cv_cc_kar_07"_J, "cv_cc_kar_07"},
+	    {"cv_cc_hsh_06"_J, "cv_cc_hsh_06"},
+	    {"cv_cc_dog_08"_J, "cv_cc_dog_08"},
+	    {"rcm_chain_gang1"_J, "rcm_chain_gang1"},
+	    {"discoverable_generic"_J, "discoverable_generic"},
+	    {"generic_activity_invite"_J, "generic_activity_invite"},
+	    {"act_fishing01"_J, "act_fishing01"},
+	    {"cv_cc_swn_12"_J, "cv_cc_swn_12"},
+	    {"cv_cc_prs_04"_J, "cv_cc_prs_04"},
+	    {"player_camp"_J, "player_camp"},
+	    {"show_nbx_escapeartist"_J, "show_nbx_escapeartist"},
+	    {"cv_cc_abi_14"_J, "cv_cc_abi_14"},
+	    {"cv_itm_chr_01"_J, "cv_itm_chr_01"},
+	    {"smoketest_second_screen"_J, "smoketest_second_screen"},
+	    {"cv_cc_mll_08"_J, "cv_cc_mll_08"},
+	    {"rcm_marybeth1"_J, "rcm_marybeth1"},
+	    {"hunting06_invite"_J, "hunting06_invite"},
+	    {"cv_end_abi_06"_J, "cv_end_abi_06"},
+	    {"cv_cc_kar_09"_J, "cv_cc_kar_09"},
 	    {"blackbalsamrise"_J, "blackbalsamrise"},
-	    {"blackwater"_J, "blackwater"},
-	    {"bluegillmarsh_population"_J, "bluegillmarsh_population"},
-	    {"bounty1"_J, "bounty1"},
-	    {"bounty1_intro"_J, "bounty1_intro"},
-	    {"bounty1_outro"_J, "bounty1_outro"},
-	    {"bounty_poster"_J, "bounty_poster"},
-	    {"braithwaitemanor"_J, "braithwaitemanor"},
-	    {"braithwaites1"_J, "braithwaites1"},
-	    {"braithwaites1_intro"_J, "braithwaites1_intro"},
-	    {"braithwaites1_outro"_J, "braithwaites1_outro"},
-	    {"braithwaites2"_J, "braithwaites2"},
-	    {"braithwaites2_intro"_J, "braithwaites2_intro"},
-	    {"braithwaites2_outro"_J, "braithwaites2_outro"},
-	    {"braithwaites3"_J, "braithwaites3"},
-	    {"braithwaites3_intro"_J, "braithwaites3_intro"},
-	    {"broom_scenario"_J, "broom_scenario"},
-	    {"butchercreek"_J, "butchercreek"},
-	    {"caligahall"_J, "caligahall"},
-	    {"camera_item"_J, "camera_item"},
-	    {"camera_photomode"_J, "camera_photomode"},
-	    {"campfire"_J, "campfire"},
-	    {"campfire_always"_J, "campfire_always"},
-	    {"campfire_gang"_J, "campfire_gang"},
-	    {"campfire_gang_es"_J, "campfire_gang_es"},
-	    {"campfire_gang_launch"_J, "campfire_gang_launch"},
-	    {"camp_beaverhollow"_J, "camp_beaverhollow"},
-	    {"camp_beechershope"_J, "camp_beechershope"},
-	    {"camp_clemenspoint"_J, "camp_clemenspoint"},
-	    {"camp_colter"_J, "camp_colter"},
-	    {"camp_fire_cooking"_J, "camp_fire_cooking"},
-	    {"camp_guarma"_J, "camp_guarma"},
-	    {"camp_horseshoeoverlook"_J, "camp_horseshoeoverlook"},
-	    {"camp_lakay"_J, "camp_lakay"},
-	    {"camp_pronghornranch"_J, "camp_pronghornranch"},
-	    {"camp_shadybelle"_J, "camp_shadybelle"},
-	    {"camp_tester"_J, "camp_tester"},
-	    {"caravan_absence_scene"_J, "caravan_absence_scene"},
-	    {"caravan_state_debug_ui"_J, "caravan_state_debug_ui"},
-	    {"carmodydell"_J, "carmodydell"},
-	    {"catfishjacksons"_J, "catfishjacksons"},
-	    {"cheat_ui"_J, "cheat_ui"},
-	    {"chezporter"_J, "chezporter"},
-	    {"chollasprings_population"_J, "chollasprings_population"},
-	    {"civilized_region_test"_J, "civilized_region_test"},
-	    {"civilwarbride"_J, "civilwarbride"},
-	    {"clemenscove"_J, "clemenscove"},
-	    {"clemenspoint"_J, "clemenspoint"},
-	    {"coachrobberies"_J, "coachrobberies"},
-	    {"coachrobberies_gang1"_J, "coachrobberies_gang1"},
-	    {"coachrobberies_gang1_invite"_J, "coachrobberies_gang1_invite"},
-	    {"coachrobberies_gang2"_J, "coachrobberies_gang2"},
-	    {"coachrobberies_gang2_invite"_J, "coachrobberies_gang2_invite"},
-	    {"coachrobberies_gang3"_J, "coachrobberies_gang3"},
-	    {"coachrobberies_gang3_invite"_J, "coachrobberies_gang3_invite"},
-	    {"coachrobberies_gang4"_J, "coachrobberies_gang4"},
-	    {"coachrobberies_gang4_invite"_J, "coachrobberies_gang4_invite"},
-	    {"coachrobberies_intro"_J, "coachrobberies_intro"},
-	    {"coachrobberies_note"_J, "coachrobberies_note"},
-	    {"coffee_drinking"_J, "coffee_drinking"},
-	    {"collectible_posters"_J, "collectible_posters"},
-	    {"colter"_J, "colter"},
-	    {"combat_test"_J, "combat_test"},
-	    {"cornwall1"_J, "cornwall1"},
-	    {"cornwall1_intro"_J, "cornwall1_intro"},
-	    {"cornwall1_outro"_J, "cornwall1_outro"},
-	    {"cornwallkerosene"_J, "cornwallkerosene"},
-	    {"crawdadwillies"_J, "crawdadwillies"},
-	    {"crayfish_search"_J, "crayfish_search"},
-	    {"cropfarm"_J, "cropfarm"},
-	    {"cumberlandforest_population"_J, "cumberlandforest_population"},
-	    {"cv_amb_butcher_bleed_deer"_J, "cv_amb_butcher_bleed_deer"},
+	    {"rcm_for_my_art3"_J, "rcm_for_my_art3"},
+	    {"hideout_hangingdogranch_es"_J, "hideout_hangingdogranch_es"},
+	    {"hunting_zone_buffalo_tatanka"_J, "hunting_zone_buffalo_tatanka"},
+	    {"ambush_odr_bridge_ambush"_J, "ambush_odr_bridge_ambush"},
+	    {"rcm_bounty_exconfed1"_J, "rcm_bounty_exconfed1"},
+	    {"herb_red_sage"_J, "herb_red_sage"},
+	    {"gunfight"_J, "gunfight"},
+	    {"rcm_exconfed11"_J, "rcm_exconfed11"},
+	    {"rcm_evelyn_miller3"_J, "rcm_evelyn_miller3"},
 	    {"cv_amb_butcher_feed_dog"_J, "cv_amb_butcher_feed_dog"},
-	    {"cv_amb_butcher_hang_carcass"_J, "cv_amb_butcher_hang_carcass"},
+	    {"av_big_cat_kill_raccoon"_J, "av_big_cat_kill_raccoon"},
+	    {"beat_savage_aftermath"_J, "beat_savage_aftermath"},
+	    {"beat_arms_deal"_J, "beat_arms_deal"},
+	    {"cv_cc_jck_par_01"_J, "cv_cc_jck_par_01"},
 	    {"cv_amb_comp_donate"_J, "cv_amb_comp_donate"},
-	    {"cv_amb_comp_donate_look"_J, "cv_amb_comp_donate_look"},
-	    {"cv_amb_dog_jump_and_lick"_J, "cv_amb_dog_jump_and_lick"},
-	    {"cv_amb_dog_jump_bed"_J, "cv_amb_dog_jump_bed"},
-	    {"cv_amb_dog_lick_table"_J, "cv_amb_dog_lick_table"},
-	    {"cv_amb_dog_pet_sitting"_J, "cv_amb_dog_pet_sitting"},
-	    {"cv_amb_drop_rabbit_table"_J, "cv_amb_drop_rabbit_table"},
-	    {"cv_amb_drunk_campfire"_J, "cv_amb_drunk_campfire"},
-	    {"cv_amb_fire_starter"_J, "cv_amb_fire_starter"},
-	    {"cv_amb_jack_look_pot"_J, "cv_amb_jack_look_pot"},
-	    {"cv_amb_jack_poke_fire"_J, "cv_amb_jack_poke_fire"},
-	    {"cv_amb_light_smoke"_J, "cv_amb_light_smoke"},
-	    {"cv_amb_sack_wagon"_J, "cv_amb_sack_wagon"},
-	    {"cv_amb_sore_joints"_J, "cv_amb_sore_joints"},
-	    {"cv_amb_start_phonograph"_J, "cv_amb_start_phonograph"},
-	    {"cv_amb_whisper_sit"_J, "cv_amb_whisper_sit"},
-	    {"cv_amb_whisper_stand"_J, "cv_amb_whisper_stand"},
-	    {"cv_cc_abi_01"_J, "cv_cc_abi_01"},
-	    {"cv_cc_abi_02"_J, "cv_cc_abi_02"},
-	    {"cv_cc_abi_03"_J, "cv_cc_abi_03"},
-	    {"cv_cc_abi_04"_J, "cv_cc_abi_04"},
-	    {"cv_cc_abi_05"_J, "cv_cc_abi_05"},
-	    {"cv_cc_abi_06"_J, "cv_cc_abi_06"},
-	    {"cv_cc_abi_07"_J, "cv_cc_abi_07"},
-	    {"cv_cc_abi_08"_J, "cv_cc_abi_08"},
-	    {"cv_cc_abi_09"_J, "cv_cc_abi_09"},
-	    {"cv_cc_abi_10"_J, "cv_cc_abi_10"},
-	    {"cv_cc_abi_11"_J, "cv_cc_abi_11"},
-	    {"cv_cc_abi_12"_J, "cv_cc_abi_12"},
-	    {"cv_cc_abi_13"_J, "cv_cc_abi_13"},
-	    {"cv_cc_abi_14"_J, "cv_cc_abi_14"},
-	    {"cv_cc_abi_15"_J, "cv_cc_abi_15"},
-	    {"cv_cc_abi_16"_J, "cv_cc_abi_16"},
-	    {"cv_cc_abi_17"_J, "cv_cc_abi_17"},
-	    {"cv_cc_abi_19"_J, "cv_cc_abi_19"},
-	    {"cv_cc_abi_20"_J, "cv_cc_abi_20"},
-	    {"cv_cc_abi_21"_J, "cv_cc_abi_21"},
-	    {"cv_cc_abi_23"_J, "cv_cc_abi_23"},
-	    {"cv_cc_am_cln_shared"_J, "cv_cc_am_cln_shared"},
-	    {"cv_cc_am_cnf_01"_J, "cv_cc_am_cnf_01"},
-	    {"cv_cc_am_cnf_02"_J, "cv_cc_am_cnf_02"},
-	    {"cv_cc_am_cnf_03"_J, "cv_cc_am_cnf_03"},
-	    {"cv_cc_am_cnf_04"_J, "cv_cc_am_cnf_04"},
-	    {"cv_cc_am_cnf_05"_J, "cv_cc_am_cnf_05"},
-	    {"cv_cc_bll_04"_J, "cv_cc_bll_04"},
-	    {"cv_cc_bll_05"_J, "cv_cc_bll_05"},
-	    {"cv_cc_bll_06"_J, "cv_cc_bll_06"},
-	    {"cv_cc_bll_08"_J, "cv_cc_bll_08"},
-	    {"cv_cc_bll_09"_J, "cv_cc_bll_09"},
-	    {"cv_cc_bll_10"_J, "cv_cc_bll_10"},
-	    {"cv_cc_bll_11"_J, "cv_cc_bll_11"},
-	    {"cv_cc_bll_13"_J, "cv_cc_bll_13"},
-	    {"cv_cc_bll_14"_J, "cv_cc_bll_14"},
-	    {"cv_cc_bll_15"_J, "cv_cc_bll_15"},
-	    {"cv_cc_chr_01"_J, "cv_cc_chr_01"},
-	    {"cv_cc_chr_02"_J, "cv_cc_chr_02"},
-	    {"cv_cc_chr_03"_J, "cv_cc_chr_03"},
-	    {"cv_cc_chr_05"_J, "cv_cc_chr_05"},
-	    {"cv_cc_dna_01"_J, "cv_cc_dna_01"},
-	    {"cv_cc_dnh_01"_J, "cv_cc_dnh_01"},
-	    {"cv_cc_dnh_02"_J, "cv_cc_dnh_02"},
-	    {"cv_cc_dnh_03"_J, "cv_cc_dnh_03"},
-	    {"cv_cc_dnh_04"_J, "cv_cc_dnh_04"},
-	    {"cv_cc_dnh_05"_J, "cv_cc_dnh_05"},
-	    {"cv_cc_dnh_06"_J, "cv_cc_dnh_06"},
-	    {"cv_cc_dnh_07"_J, "cv_cc_dnh_07"},
-	    {"cv_cc_dnh_08"_J, "cv_cc_dnh_08"},
-	    {"cv_cc_dnh_09"_J, "cv_cc_dnh_09"},
-	    {"cv_cc_dnh_10"_J, "cv_cc_dnh_10"},
-	    {"cv_cc_dnh_11"_J, "cv_cc_dnh_11"},
-	    {"cv_cc_dnh_12"_J, "cv_cc_dnh_12"},
-	    {"cv_cc_dnj_01"_J, "cv_cc_dnj_01"},
-	    {"cv_cc_dnj_02"_J, "cv_cc_dnj_02"},
-	    {"cv_cc_dnj_03"_J, "cv_cc_dnj_03"},
-	    {"cv_cc_dnj_04"_J, "cv_cc_dnj_04"},
-	    {"cv_cc_dnj_05"_J, "cv_cc_dnj_05"},
-	    {"cv_cc_dnj_06"_J, "cv_cc_dnj_06"},
-	    {"cv_cc_dnj_07"_J, "cv_cc_dnj_07"},
-	    {"cv_cc_dnk_01"_J, "cv_cc_dnk_01"},
-	    {"cv_cc_dnk_02"_J, "cv_cc_dnk_02"},
-	    {"cv_cc_dnk_03"_J, "cv_cc_dnk_03"},
-	    {"cv_cc_dnk_04"_J, "cv_cc_dnk_04"},
-	    {"cv_cc_dnl_01"_J, "cv_cc_dnl_01"},
-	    {"cv_cc_dnl_02"_J, "cv_cc_dnl_02"},
 	    {"cv_cc_dnm_01"_J, "cv_cc_dnm_01"},
-	    {"cv_cc_dnm_02"_J, "cv_cc_dnm_02"},
-	    {"cv_cc_dnm_03"_J, "cv_cc_dnm_03"},
-	    {"cv_cc_dnv_02"_J, "cv_cc_dnv_02"},
-	    {"cv_cc_dog_01"_J, "cv_cc_dog_01"},
-	    {"cv_cc_dog_04"_J, "cv_cc_dog_04"},
-	    {"cv_cc_dog_05"_J, "cv_cc_dog_05"},
-	    {"cv_cc_dog_06"_J, "cv_cc_dog_06"},
-	    {"cv_cc_dog_08"_J, "cv_cc_dog_08"},
+	    {"herb_golden_currant"_J, "herb_golden_currant"},
+	    {"cv_cc_abi_23"_J, "cv_cc_abi_23"},
+	    {"discoverable_tree_house"_J, "discoverable_tree_house"},
+	    {"rcm_beau_and_penelope20"_J, "rcm_beau_and_penelope20"},
+	    {"herb_english_mace"_J, "herb_english_mace"},
+	    {"train_robbery4_outro"_J, "train_robbery4_outro"},
+	    {"cv_cc_abi_12"_J, "cv_cc_abi_12"},
+	    {"train_robbery2_intro"_J, "train_robbery2_intro"},
+	    {"train_robbery1"_J, "train_robbery1"},
+	    {"mudtown5"_J, "mudtown5"},
+	    {"av_barber_shaving"_J, "av_barber_shaving"},
+	    {"prop_drop"_J, "prop_drop"},
+	    {"av_ridgeline_animal"_J, "av_ridgeline_animal"},
+	    {"rcm_gunslinger1_1"_J, "rcm_gunslinger1_1"},
+	    {"act_camp_fff_light"_J, "act_camp_fff_light"},
+	    {"startup_mp"_J, "startup_mp"},
+	    {"cv_cc_abi_09"_J, "cv_cc_abi_09"},
+	    {"rcm_collect_exotics2"_J, "rcm_collect_exotics2"},
+	    {"train_robbery1_intro"_J, "train_robbery1_intro"},
+	    {"blackwater"_J, "blackwater"},
+	    {"beat_dark_alley_stabber"_J, "beat_dark_alley_stabber"},
+	    {"shop_market"_J, "shop_market"},
+	    {"act_camp_poker_light"_J, "act_camp_poker_light"},
+	    {"item_bait_predator"_J, "item_bait_predator"},
+	    {"net_ambient_chest"_J, "net_ambient_chest"},
+	    {"metaped_clothing_tool_outfit_testing"_J, "metaped_clothing_tool_outfit_testing"},
+	    {"cv_end_chr_05"_J, "cv_end_chr_05"},
+	    {"cv_cc_mrb_01"_J, "cv_cc_mrb_01"},
+	    {"herbal_plants"_J, "herbal_plants"},
+	    {"herb_clamshell_orchid"_J, "herb_clamshell_orchid"},
+	    {"generic_weapon_item"_J, "generic_weapon_item"},
+	    {"herb_vanilla_flower"_J, "herb_vanilla_flower"},
+	    {"cv_cc_unc_05"_J, "cv_cc_unc_05"},
+	    {"saloon1_intro"_J, "saloon1_intro"},
+	    {"cv_cc_dtc_22"_J, "cv_cc_dtc_22"},
+	    {"odriscolls5"_J, "odriscolls5"},
+	    {"shack_civilwarbride1"_J, "shack_civilwarbride1"},
+	    {"cv_wrk_mch_02"_J, "cv_wrk_mch_02"},
+	    {"hideout_fortmercer"_J, "hideout_fortmercer"},
+	    {"cv_end_jck_05"_J, "cv_end_jck_05"},
+	    {"property_use_core"_J, "property_use_core"},
+	    {"av_crows_and_vultures_eat_deer"_J, "av_crows_and_vultures_eat_deer"},
+	    {"startup"_J, "startup"},
+	    {"shack_slavepen1"_J, "shack_slavepen1"},
+	    {"rcm_war_veteran2"_J, "rcm_war_veteran2"},
+	    {"marston5_3"_J, "marston5_3"},
 	    {"cv_cc_dtc_03"_J, "cv_cc_dtc_03"},
-	    {"cv_cc_dtc_04"_J, "cv_cc_dtc_04"},
-	    {"cv_cc_dtc_10"_J, "cv_cc_dtc_10"},
-	    {"cv_cc_dtc_14"_J, "cv_cc_dtc_14"},
-	    {"cv_cc_dtc_15"_J, "cv_cc_dtc_15"},
-	    {"cv_cc_dtc_17"_J, "cv_cc_dtc_17"},
-	    {"cv_cc_dtc_18"_J, "cv_cc_dtc_18"},
-	    {"cv_cc_dtc_19"_J, "cv_cc_dtc_19"},
+	    {"ambush_sav_tree_line"_J, "ambush_sav_tree_line"},
+	    {"prisoner_val_1"_J, "prisoner_val_1"},
+	    {"spd_sheriffoftumbleweed"_J, "spd_sheriffoftumbleweed"},
+	    {"poker_launch_sp"_J, "poker_launch_sp"},
+	    {"event_area_ea_launcher"_J, "event_area_ea_launcher"},
+	    {"placement_editor_volumes"_J, "placement_editor_volumes"},
+	    {"ambush_gen_night_rob"_J, "ambush_gen_night_rob"},
+	    {"shack_undergroundrailroad"_J, "shack_undergroundrailroad"},
+	    {"fivefingerfilletintro_invite"_J, "fivefingerfilletintro_invite"},
+	    {"hunting1"_J, "hunting1"},
+	    {"av_chamberpot_toss"_J, "av_chamberpot_toss"},
 	    {"cv_cc_dtc_21"_J, "cv_cc_dtc_21"},
-	    {"cv_cc_dtc_22"_J, "cv_cc_dtc_22"},
-	    {"cv_cc_dtc_23"_J, "cv_cc_dtc_23"},
-	    {"cv_cc_dtc_24"_J, "cv_cc_dtc_24"},
-	    {"cv_cc_dtc_25"_J, "cv_cc_dtc_25"},
-	    {"cv_cc_dtc_28"_J, "cv_cc_dtc_28"},
-	    {"cv_cc_dtc_29"_J, "cv_cc_dtc_29"},
-	    {"cv_cc_dtc_30"_J, "cv_cc_dtc_30"},
-	    {"cv_cc_dtc_31"_J, "cv_cc_dtc_31"},
-	    {"cv_cc_dtc_32"_J, "cv_cc_dtc_32"},
-	    {"cv_cc_dtc_33"_J, "cv_cc_dtc_33"},
-	    {"cv_cc_dtc_34"_J, "cv_cc_dtc_34"},
-	    {"cv_cc_dtc_shared"_J, "cv_cc_dtc_shared"},
-	    {"cv_cc_hsh_01"_J, "cv_cc_hsh_01"},
-	    {"cv_cc_hsh_03"_J, "cv_cc_hsh_03"},
-	    {"cv_cc_hsh_04"_J, "cv_cc_hsh_04"},
-	    {"cv_cc_hsh_06"_J, "cv_cc_hsh_06"},
-	    {"cv_cc_hsh_07"_J, "cv_cc_hsh_07"},
-	    {"cv_cc_hsh_08"_J, "cv_cc_hsh_08"},
-	    {"cv_cc_hsh_09"_J, "cv_cc_hsh_09"},
-	    {"cv_cc_hsh_11"_J, "cv_cc_hsh_11"},
-	    {"cv_cc_hsh_12"_J, "cv_cc_hsh_12"},
-	    {"cv_cc_hsh_13"_J, "cv_cc_hsh_13"},
-	    {"cv_cc_hsh_14"_J, "cv_cc_hsh_14"},
-	    {"cv_cc_hsh_15"_J, "cv_cc_hsh_15"},
-	    {"cv_cc_hsh_16"_J, "cv_cc_hsh_16"},
-	    {"cv_cc_hsh_17"_J, "cv_cc_hsh_17"},
-	    {"cv_cc_hsh_18"_J, "cv_cc_hsh_18"},
-	    {"cv_cc_hsh_19"_J, "cv_cc_hsh_19"},
-	    {"cv_cc_jav_01"_J, "cv_cc_jav_01"},
-	    {"cv_cc_jav_02"_J, "cv_cc_jav_02"},
-	    {"cv_cc_jav_03"_J, "cv_cc_jav_03"},
+	    {"shop_tailor"_J, "shop_tailor"},
 	    {"cv_cc_jav_04"_J, "cv_cc_jav_04"},
-	    {"cv_cc_jav_05"_J, "cv_cc_jav_05"},
-	    {"cv_cc_jav_07"_J, "cv_cc_jav_07"},
-	    {"cv_cc_jav_08"_J, "cv_cc_jav_08"},
-	    {"cv_cc_jav_09"_J, "cv_cc_jav_09"},
-	    {"cv_cc_jav_10"_J, "cv_cc_jav_10"},
-	    {"cv_cc_jav_11"_J, "cv_cc_jav_11"},
-	    {"cv_cc_jck_01"_J, "cv_cc_jck_01"},
-	    {"cv_cc_jck_02"_J, "cv_cc_jck_02"},
-	    {"cv_cc_jck_03"_J, "cv_cc_jck_03"},
-	    {"cv_cc_jck_04"_J, "cv_cc_jck_04"},
-	    {"cv_cc_jck_05"_J, "cv_cc_jck_05"},
-	    {"cv_cc_jck_par_01"_J, "cv_cc_jck_par_01"},
-	    {"cv_cc_jhn_01"_J, "cv_cc_jhn_01"},
-	    {"cv_cc_jhn_02"_J, "cv_cc_jhn_02"},
-	    {"cv_cc_jhn_03"_J, "cv_cc_jhn_03"},
-	    {"cv_cc_jhn_04"_J, "cv_cc_jhn_04"},
-	    {"cv_cc_jhn_05"_J, "cv_cc_jhn_05"},
-	    {"cv_cc_jhn_06"_J, "cv_cc_jhn_06"},
-	    {"cv_cc_jhn_07"_J, "cv_cc_jhn_07"},
-	    {"cv_cc_jhn_08"_J, "cv_cc_jhn_08"},
-	    {"cv_cc_jhn_09"_J, "cv_cc_jhn_09"},
-	    {"cv_cc_jhn_10"_J, "cv_cc_jhn_10"},
-	    {"cv_cc_kar_01"_J, "cv_cc_kar_01"},
-	    {"cv_cc_kar_02"_J, "cv_cc_kar_02"},
-	    {"cv_cc_kar_03"_J, "cv_cc_kar_03"},
-	    {"cv_cc_kar_04"_J, "cv_cc_kar_04"},
-	    {"cv_cc_kar_05"_J, "cv_cc_kar_05"},
+	    {"shop_horse_shop_sp"_J, "shop_horse_shop_sp"},
+	    {"rockyseven"_J, "rockyseven"},
+	    {"broom_scenario"_J, "broom_scenario"},
+	    {"cv_cc_swn_07"_J, "cv_cc_swn_07"},
 	    {"cv_cc_kar_06"_J, "cv_cc_kar_06"},
-	    {"cv_cc_kar_07"_J, "cv_cc_kar_07"},
+	    {"placement_editor_weapons"_J, "placement_editor_weapons"},
+	    {"beat_rally_setup"_J, "beat_rally_setup"},
+	    {"rcm_mason5"_J, "rcm_mason5"},
+	    {"cv_itm_bll_01"_J, "cv_itm_bll_01"},
+	    {"cv_cc_am_cnf_02"_J, "cv_cc_am_cnf_02"},
+	    {"act_caunc_rustling_invite"_J, "act_caunc_rustling_invite"},
+	    {"sadie5_outro"_J, "sadie5_outro"},
+	    {"event_area_castorspond"_J, "event_area_castorspond"},
+	    {"chollasprings_population"_J, "chollasprings_population"},
+	    {"av_ridgeline_rider"_J, "av_ridgeline_rider"},
+	    {"av_bucks_fighting"_J, "av_bucks_fighting"},
+	    {"cv_cc_mll_07"_J, "cv_cc_mll_07"},
+	    {"av_stage_coach"_J, "av_stage_coach"},
 	    {"cv_cc_kar_08"_J, "cv_cc_kar_08"},
-	    {"cv_cc_kar_09"_J, "cv_cc_kar_09"},
-	    {"cv_cc_kar_10"_J, "cv_cc_kar_10"},
-	    {"cv_cc_kar_11"_J, "cv_cc_kar_11"},
-	    {"cv_cc_kar_12"_J, "cv_cc_kar_12"},
-	    {"cv_cc_kar_13"_J, "cv_cc_kar_13"},
-	    {"cv_cc_kar_par_02"_J, "cv_cc_kar_par_02"},
-	    {"cv_cc_kar_par_03"_J, "cv_cc_kar_par_03"},
-	    {"cv_cc_kie_01"_J, "cv_cc_kie_01"},
-	    {"cv_cc_kie_04"_J, "cv_cc_kie_04"},
-	    {"cv_cc_kie_05"_J, "cv_cc_kie_05"},
-	    {"cv_cc_kie_07"_J, "cv_cc_kie_07"},
-	    {"cv_cc_kie_08"_J, "cv_cc_kie_08"},
-	    {"cv_cc_kie_09"_J, "cv_cc_kie_09"},
-	    {"cv_cc_kie_10"_J, "cv_cc_kie_10"},
-	    {"cv_cc_kie_11"_J, "cv_cc_kie_11"},
-	    {"cv_cc_kie_12"_J, "cv_cc_kie_12"},
-	    {"cv_cc_kie_13"_J, "cv_cc_kie_13"},
-	    {"cv_cc_kie_14"_J, "cv_cc_kie_14"},
-	    {"cv_cc_kie_15"_J, "cv_cc_kie_15"},
-	    {"cv_cc_len_01"_J, "cv_cc_len_01"},
-	    {"cv_cc_len_02"_J, "cv_cc_len_02"},
-	    {"cv_cc_len_03"_J, "cv_cc_len_03"},
-	    {"cv_cc_len_04"_J, "cv_cc_len_04"},
-	    {"cv_cc_len_05"_J, "cv_cc_len_05"},
-	    {"cv_cc_len_06"_J, "cv_cc_len_06"},
-	    {"cv_cc_len_07"_J, "cv_cc_len_07"},
-	    {"cv_cc_len_08"_J, "cv_cc_len_08"},
-	    {"cv_cc_lnsnm_01"_J, "cv_cc_lnsnm_01"},
-	    {"cv_cc_mch_02"_J, "cv_cc_mch_02"},
-	    {"cv_cc_mch_03"_J, "cv_cc_mch_03"},
-	    {"cv_cc_mch_05"_J, "cv_cc_mch_05"},
-	    {"cv_cc_mch_06"_J, "cv_cc_mch_06"},
-	    {"cv_cc_mch_07"_J, "cv_cc_mch_07"},
-	    {"cv_cc_mch_08"_J, "cv_cc_mch_08"},
-	    {"cv_cc_mch_10"_J, "cv_cc_mch_10"},
-	    {"cv_cc_mch_11"_J, "cv_cc_mch_11"},
-	    {"cv_cc_mch_12"_J, "cv_cc_mch_12"},
-	    {"cv_cc_mch_13"_J, "cv_cc_mch_13"},
-	    {"cv_cc_mch_15"_J, "cv_cc_mch_15"},
-	    {"cv_cc_mch_16"_J, "cv_cc_mch_16"},
-	    {"cv_cc_mch_17"_J, "cv_cc_mch_17"},
-	    {"cv_cc_mch_18"_J, "cv_cc_mch_18"},
-	    {"cv_cc_mch_19"_J, "cv_cc_mch_19"},
-	    {"cv_cc_mch_20"_J, "cv_cc_mch_20"},
-	    {"cv_cc_mch_21"_J, "cv_cc_mch_21"},
-	    {"cv_cc_mch_22"_J, "cv_cc_mch_22"},
-	    {"cv_cc_mch_24"_J, "cv_cc_mch_24"},
-	    {"cv_cc_mch_25"_J, "cv_cc_mch_25"},
-	    {"cv_cc_mch_26"_J, "cv_cc_mch_26"},
+	    {"av_amb_camp_robbery"_J, "av_amb_camp_robbery"},
+	    {"cv_cc_dtc_shared"_J, "cv_cc_dtc_shared"},
+	    {"cv_end_unc_06"_J, "cv_end_unc_06"},
+	    {"gang1"_J, "gang1"},
+	    {"marston8_intro"_J, "marston8_intro"},
+	    {"rcm_slave_catcher1"_J, "rcm_slave_catcher1"},
+	    {"train_robbery3_intro"_J, "train_robbery3_intro"},
+	    {"leadin_editor"_J, "leadin_editor"},
+	    {"av_bird_land_swarm"_J, "av_bird_land_swarm"},
+	    {"milking_cow"_J, "milking_cow"},
+	    {"gang_enc_band_shack_launch"_J, "gang_enc_band_shack_launch"},
+	    {"rcm_evelyn_miller2"_J, "rcm_evelyn_miller2"},
+	    {"rcm_beau_and_penelope21"_J, "rcm_beau_and_penelope21"},
 	    {"cv_cc_mch_27"_J, "cv_cc_mch_27"},
-	    {"cv_cc_mch_28"_J, "cv_cc_mch_28"},
-	    {"cv_cc_mch_29"_J, "cv_cc_mch_29"},
-	    {"cv_cc_mch_30"_J, "cv_cc_mch_30"},
-	    {"cv_cc_mch_31"_J, "cv_cc_mch_31"},
-	    {"cv_cc_mch_32"_J, "cv_cc_mch_32"},
-	    {"cv_cc_mch_33"_J, "cv_cc_mch_33"},
-	    {"cv_cc_mll_01"_J, "cv_cc_mll_01"},
-	    {"cv_cc_mll_02"_J, "cv_cc_mll_02"},
-	    {"cv_cc_mll_04"_J, "cv_cc_mll_04"},
-	    {"cv_cc_mll_05"_J, "cv_cc_mll_05"},
-	    {"cv_cc_mll_06"_J, "cv_cc_mll_06"},
-	    {"cv_cc_mll_07"_J, "cv_cc_mll_07"},
-	    {"cv_cc_mll_08"_J, "cv_cc_mll_08"},
-	    {"cv_cc_mll_09"_J, "cv_cc_mll_09"},
-	    {"cv_cc_mrb_01"_J, "cv_cc_mrb_01"},
-	    {"cv_cc_mrb_02"_J, "cv_cc_mrb_02"},
-	    {"cv_cc_mrb_03"_J, "cv_cc_mrb_03"},
-	    {"cv_cc_mrb_04"_J, "cv_cc_mrb_04"},
-	    {"cv_cc_mrb_05"_J, "cv_cc_mrb_05"},
-	    {"cv_cc_mrb_06"_J, "cv_cc_mrb_06"},
-	    {"cv_cc_mrb_07"_J, "cv_cc_mrb_07"},
-	    {"cv_cc_mrb_08"_J, "cv_cc_mrb_08"},
-	    {"cv_cc_mrb_09"_J, "cv_cc_mrb_09"},
-	    {"cv_cc_mrb_10"_J, "cv_cc_mrb_10"},
-	    {"cv_cc_mrb_11"_J, "cv_cc_mrb_11"},
-	    {"cv_cc_mrb_12"_J, "cv_cc_mrb_12"},
-	    {"cv_cc_prs_01"_J, "cv_cc_prs_01"},
-	    {"cv_cc_prs_02"_J, "cv_cc_prs_02"},
-	    {"cv_cc_prs_03"_J, "cv_cc_prs_03"},
-	    {"cv_cc_prs_04"_J, "cv_cc_prs_04"},
-	    {"cv_cc_prs_05"_J, "cv_cc_prs_05"},
-	    {"cv_cc_prs_13"_J, "cv_cc_prs_13"},
-	    {"cv_cc_prs_14"_J, "cv_cc_prs_14"},
-	    {"cv_cc_prs_15"_J, "cv_cc_prs_15"},
-	    {"cv_cc_prs_16"_J, "cv_cc_prs_16"},
-	    {"cv_cc_prs_17"_J, "cv_cc_prs_17"},
-	    {"cv_cc_prs_callover"_J, "cv_cc_prs_callover"},
-	    {"cv_cc_prs_par_01"_J, "cv_cc_prs_par_01"},
-	    {"cv_cc_sad_01"_J, "cv_cc_sad_01"},
-	    {"cv_cc_sad_02"_J, "cv_cc_sad_02"},
-	    {"cv_cc_sad_03"_J, "cv_cc_sad_03"},
-	    {"cv_cc_sen_01"_J, "cv_cc_sen_01"},
-	    {"cv_cc_sen_02"_J, "cv_cc_sen_02"},
-	    {"cv_cc_sen_03"_J, "cv_cc_sen_03"},
-	    {"cv_cc_sen_04"_J, "cv_cc_sen_04"},
-	    {"cv_cc_sen_05"_J, "cv_cc_sen_05"},
-	    {"cv_cc_sen_06"_J, "cv_cc_sen_06"},
-	    {"cv_cc_sen_07"_J, "cv_cc_sen_07"},
+	    {"cv_cc_unc_02"_J, "cv_cc_unc_02"},
+	    {"cv_cc_swn_11"_J, "cv_cc_swn_11"},
+	    {"cv_cc_abi_15"_J, "cv_cc_abi_15"},
+	    {"generic_smoking_item"_J, "generic_smoking_item"},
+	    {"shack_ontherun1"_J, "shack_ontherun1"},
+	    {"scenario_vig_launcher"_J, "scenario_vig_launcher"},
+	    {"bayounwa_population"_J, "bayounwa_population"},
+	    {"cv_cc_abi_08"_J, "cv_cc_abi_08"},
+	    {"herb_wild_mint"_J, "herb_wild_mint"},
+	    {"stage_coach"_J, "stage_coach"},
+	    {"rcm_collect_exotics3"_J, "rcm_collect_exotics3"},
+	    {"ambient_fishing_scenario"_J, "ambient_fishing_scenario"},
+	    {"susan1_intro"_J, "susan1_intro"},
+	    {"guama2_intro"_J, "guama2_intro"},
+	    {"spd_giant"_J, "spd_giant"},
+	    {"roanoketrapper"_J, "roanoketrapper"},
+	    {"rcm_callaway2"_J, "rcm_callaway2"},
+	    {"sisikapenitentiary"_J, "sisikapenitentiary"},
+	    {"hunting_zone_bison"_J, "hunting_zone_bison"},
+	    {"sadie5_intro"_J, "sadie5_intro"},
+	    {"barcustomer_interaction"_J, "barcustomer_interaction"},
+	    {"av_squirrel_chase_squirrel"_J, "av_squirrel_chase_squirrel"},
+	    {"bankrobberies_simple"_J, "bankrobberies_simple"},
+	    {"beat_lost_man"_J, "beat_lost_man"},
+	    {"reverend1_intro"_J, "reverend1_intro"},
+	    {"spd_swampweirdo1"_J, "spd_swampweirdo1"},
+	    {"guarma3_intro"_J, "guarma3_intro"},
+	    {"rcm_bh_bandito_shack"_J, "rcm_bh_bandito_shack"},
+	    {"train_summon"_J, "train_summon"},
+	    {"av_get_directions"_J, "av_get_directions"},
+	    {"av_scavenger_on_animal"_J, "av_scavenger_on_animal"},
+	    {"generic_alcohol_item"_J, "generic_alcohol_item"},
 	    {"cv_cc_sen_08"_J, "cv_cc_sen_08"},
-	    {"cv_cc_sen_09"_J, "cv_cc_sen_09"},
-	    {"cv_cc_sen_10"_J, "cv_cc_sen_10"},
-	    {"cv_cc_sen_11"_J, "cv_cc_sen_11"},
-	    {"cv_cc_sen_12"_J, "cv_cc_sen_12"},
-	    {"cv_cc_sen_13"_J, "cv_cc_sen_13"},
-	    {"cv_cc_sen_14"_J, "cv_cc_sen_14"},
-	    {"cv_cc_sen_15"_J, "cv_cc_sen_15"},
-	    {"cv_cc_sen_16"_J, "cv_cc_sen_16"},
-	    {"cv_cc_sen_17"_J, "cv_cc_sen_17"},
-	    {"cv_cc_snk_par_01"_J, "cv_cc_snk_par_01"},
-	    {"cv_cc_snk_par_02"_J, "cv_cc_snk_par_02"},
-	    {"cv_cc_snk_par_03"_J, "cv_cc_snk_par_03"},
-	    {"cv_cc_ssnunc_01"_J, "cv_cc_ssnunc_01"},
-	    {"cv_cc_ssn_01"_J, "cv_cc_ssn_01"},
-	    {"cv_cc_ssn_02"_J, "cv_cc_ssn_02"},
-	    {"cv_cc_ssn_03"_J, "cv_cc_ssn_03"},
-	    {"cv_cc_ssn_04"_J, "cv_cc_ssn_04"},
-	    {"cv_cc_ssn_05"_J, "cv_cc_ssn_05"},
-	    {"cv_cc_ssn_07"_J, "cv_cc_ssn_07"},
-	    {"cv_cc_ssn_08"_J, "cv_cc_ssn_08"},
-	    {"cv_cc_ssn_10"_J, "cv_cc_ssn_10"},
-	    {"cv_cc_ssn_11"_J, "cv_cc_ssn_11"},
-	    {"cv_cc_ssn_12"_J, "cv_cc_ssn_12"},
-	    {"cv_cc_ssn_13"_J, "cv_cc_ssn_13"},
-	    {"cv_cc_ssn_14"_J, "cv_cc_ssn_14"},
-	    {"cv_cc_ssn_16"_J, "cv_cc_ssn_16"},
-	    {"cv_cc_str_02"_J, "cv_cc_str_02"},
-	    {"cv_cc_str_03"_J, "cv_cc_str_03"},
-	    {"cv_cc_swn_06"_J, "cv_cc_swn_06"},
-	    {"cv_cc_swn_07"_J, "cv_cc_swn_07"},
+	    {"beat_horse_race"_J, "beat_horse_race"},
+	    {"shop_fence"_J, "shop_fence"},
+	    {"satchel_ui_event_handler"_J, "satchel_ui_event_handler"},
+	    {"rcm_war_veteran1"_J, "rcm_war_veteran1"},
+	    {"cv_cc_dog_06"_J, "cv_cc_dog_06"},
+	    {"cv_cc_dtc_04"_J, "cv_cc_dtc_04"},
+	    {"braithwaites3_intro"_J, "braithwaites3_intro"},
+	    {"rcm_collect_cigarette_cards1"_J, "rcm_collect_cigarette_cards1"},
+	    {"av_birds_in_tree"_J, "av_birds_in_tree"},
+	    {"cv_cc_jav_03"_J, "cv_cc_jav_03"},
+	    {"cv_cc_prs_callover"_J, "cv_cc_prs_callover"},
+	    {"shop_barber"_J, "shop_barber"},
+	    {"pausemenu_multiplayer"_J, "pausemenu_multiplayer"},
+	    {"ambush_inb_forest_attack"_J, "ambush_inb_forest_attack"},
+	    {"discoverable_generic_location"_J, "discoverable_generic_location"},
+	    {"cv_cc_dnv_02"_J, "cv_cc_dnv_02"},
+	    {"cv_end_abi_01"_J, "cv_end_abi_01"},
+	    {"ambush_sav_corner"_J, "ambush_sav_corner"},
+	    {"vig_playlist_party_hso"_J, "vig_playlist_party_hso"},
+	    {"cv_wnt_str_04"_J, "cv_wnt_str_04"},
+	    {"collectible_posters"_J, "collectible_posters"},
+	    {"cv_cc_dtc_25"_J, "cv_cc_dtc_25"},
+	    {"player_menu"_J, "player_menu"},
+	    {"debug_launcher"_J, "debug_launcher"},
+	    {"fast_travel_prototype"_J, "fast_travel_prototype"},
+	    {"camp_colter"_J, "camp_colter"},
+	    {"ambient_load"_J, "ambient_load"},
+	    {"rcm_down3"_J, "rcm_down3"},
+	    {"shack_beechersa1"_J, "shack_beechersa1"},
+	    {"cv_end_unc_07"_J, "cv_end_unc_07"},
+	    {"rcm_oh_brother2"_J, "rcm_oh_brother2"},
+	    {"shop_net_barber"_J, "shop_net_barber"},
+	    {"ilo_playground"_J, "ilo_playground"},
 	    {"cv_cc_swn_08"_J, "cv_cc_swn_08"},
-	    {"cv_cc_swn_09"_J, "cv_cc_swn_09"},
-	    {"cv_cc_swn_10"_J, "cv_cc_swn_10"},
-	    {"cv_cc_swn_11"_J, "cv_cc_swn_11"},
-	    {"cv_cc_swn_12"_J, "cv_cc_swn_12"},
-	    {"cv_cc_swn_13"_J, "cv_cc_swn_13"},
-	    {"cv_cc_swn_14"_J, "cv_cc_swn_14"},
-	    {"cv_cc_swn_15"_J, "cv_cc_swn_15"},
-	    {"cv_cc_swn_16"_J, "cv_cc_swn_16"},
-	    {"cv_cc_swn_17"_J, "cv_cc_swn_17"},
-	    {"cv_cc_swn_19"_J, "cv_cc_swn_19"},
-	    {"cv_cc_swn_21"_J, "cv_cc_swn_21"},
-	    {"cv_cc_swn_22"_J, "cv_cc_swn_22"},
-	    {"cv_cc_tll_01"_J, "cv_cc_tll_01"},
-	    {"cv_cc_tll_02"_J, "cv_cc_tll_02"},
-	    {"cv_cc_tll_03"_J, "cv_cc_tll_03"},
-	    {"cv_cc_tll_04"_J, "cv_cc_tll_04"},
+	    {"cropfarm"_J, "cropfarm"},
+	    {"av_coyote_catch_squirrel"_J, "av_coyote_catch_squirrel"},
+	    {"cv_cc_mch_07"_J, "cv_cc_mch_07"},
+	    {"av_cat_catch_bird"_J, "av_cat_catch_bird"},
+	    {"bankrob01_invite"_J, "bankrob01_invite"},
 	    {"cv_cc_tll_05"_J, "cv_cc_tll_05"},
-	    {"cv_cc_tll_06"_J, "cv_cc_tll_06"},
-	    {"cv_cc_trl_01"_J, "cv_cc_trl_01"},
-	    {"cv_cc_trl_03"_J, "cv_cc_trl_03"},
-	    {"cv_cc_unc_01"_J, "cv_cc_unc_01"},
-	    {"cv_cc_unc_02"_J, "cv_cc_unc_02"},
+	    {"av_bird_on_animal"_J, "av_bird_on_animal"},
+	    {"marston7"_J, "marston7"},
+	    {"spd_bummicky5"_J, "spd_bummicky5"},
+	    {"cv_end_jck_01"_J, "cv_end_jck_01"},
+	    {"rcm_mary31"_J, "rcm_mary31"},
+	    {"marston2_or_4_outro"_J, "marston2_or_4_outro"},
+	    {"ambush_exc_road_robbery"_J, "ambush_exc_road_robbery"},
+	    {"security_door_knock_scenario"_J, "security_door_knock_scenario"},
+	    {"spd_johnmadman"_J, "spd_johnmadman"},
+	    {"roanokeridge_population"_J, "roanokeridge_population"},
+	    {"beat_executions"_J, "beat_executions"},
+	    {"vig_playlist_lowkey_hso"_J, "vig_playlist_lowkey_hso"},
+	    {"winter2"_J, "winter2"},
+	    {"train_fast_travel_core"_J, "train_fast_travel_core"},
 	    {"cv_cc_unc_03"_J, "cv_cc_unc_03"},
-	    {"cv_cc_unc_04"_J, "cv_cc_unc_04"},
-	    {"cv_cc_unc_05"_J, "cv_cc_unc_05"},
-	    {"cv_cc_unc_06"_J, "cv_cc_unc_06"},
-	    {"cv_cc_unc_07"_J, "cv_cc_unc_07"},
-	    {"cv_cc_unc_08"_J, "cv_cc_unc_08"},
-	    {"cv_cf_am_01"_J, "cv_cf_am_01"},
-	    {"cv_cf_shared"_J, "cv_cf_shared"},
-	    {"cv_end_abi_01"_J, "cv_end_abi_01"},
-	    {"cv_end_abi_02"_J, "cv_end_abi_02"},
-	    {"cv_end_abi_04"_J, "cv_end_abi_04"},
-	    {"cv_end_abi_05"_J, "cv_end_abi_05"},
-	    {"cv_end_abi_06"_J, "cv_end_abi_06"},
-	    {"cv_end_abi_07"_J, "cv_end_abi_07"},
-	    {"cv_end_abi_slp_shared"_J, "cv_end_abi_slp_shared"},
+	    {"cv_cc_dtc_24"_J, "cv_cc_dtc_24"},
 	    {"cv_end_anc_01"_J, "cv_end_anc_01"},
-	    {"cv_end_anj_01"_J, "cv_end_anj_01"},
-	    {"cv_end_anj_02"_J, "cv_end_anj_02"},
-	    {"cv_end_anj_03"_J, "cv_end_anj_03"},
-	    {"cv_end_anj_04"_J, "cv_end_anj_04"},
-	    {"cv_end_anu_01"_J, "cv_end_anu_01"},
-	    {"cv_end_chr_01"_J, "cv_end_chr_01"},
-	    {"cv_end_chr_03"_J, "cv_end_chr_03"},
-	    {"cv_end_chr_05"_J, "cv_end_chr_05"},
-	    {"cv_end_cnj_01"_J, "cv_end_cnj_01"},
-	    {"cv_end_cnu_01"_J, "cv_end_cnu_01"},
-	    {"cv_end_cnu_02"_J, "cv_end_cnu_02"},
-	    {"cv_end_cnu_03"_J, "cv_end_cnu_03"},
-	    {"cv_end_cnu_04"_J, "cv_end_cnu_04"},
-	    {"cv_end_cnu_05"_J, "cv_end_cnu_05"},
-	    {"cv_end_jck_01"_J, "cv_end_jck_01"},
-	    {"cv_end_jck_03"_J, "cv_end_jck_03"},
-	    {"cv_end_jck_04"_J, "cv_end_jck_04"},
-	    {"cv_end_jck_05"_J, "cv_end_jck_05"},
-	    {"cv_end_jck_06"_J, "cv_end_jck_06"},
-	    {"cv_end_unc_01"_J, "cv_end_unc_01"},
-	    {"cv_end_unc_02"_J, "cv_end_unc_02"},
-	    {"cv_end_unc_04"_J, "cv_end_unc_04"},
-	    {"cv_end_unc_06"_J, "cv_end_unc_06"},
-	    {"cv_end_unc_07"_J, "cv_end_unc_07"},
-	    {"cv_end_unj_01"_J, "cv_end_unj_01"},
-	    {"cv_itm_abi_01"_J, "cv_itm_abi_01"},
-	    {"cv_itm_bll_01"_J, "cv_itm_bll_01"},
-	    {"cv_itm_chr_01"_J, "cv_itm_chr_01"},
-	    {"cv_itm_chr_02"_J, "cv_itm_chr_02"},
-	    {"cv_itm_chr_03"_J, "cv_itm_chr_03"},
-	    {"cv_itm_dtc_01"_J, "cv_itm_dtc_01"},
-	    {"cv_itm_hsh_01"_J, "cv_itm_hsh_01"},
-	    {"cv_itm_jav_01"_J, "cv_itm_jav_01"},
-	    {"cv_itm_kar_01"_J, "cv_itm_kar_01"},
-	    {"cv_itm_kie_01"_J, "cv_itm_kie_01"},
-	    {"cv_itm_mrb_02"_J, "cv_itm_mrb_02"},
-	    {"cv_itm_prs_01"_J, "cv_itm_prs_01"},
-	    {"cv_itm_sen_01"_J, "cv_itm_sen_01"},
+	    {"cv_cc_len_01"_J, "cv_cc_len_01"},
+	    {"coachrobberies_gang4"_J, "coachrobberies_gang4"},
 	    {"cv_mus_shared"_J, "cv_mus_shared"},
-	    {"cv_mus_swn_01"_J, "cv_mus_swn_01"},
-	    {"cv_sph_dtc_bvh_01"_J, "cv_sph_dtc_bvh_01"},
-	    {"cv_sph_dtc_clm_01"_J, "cv_sph_dtc_clm_01"},
-	    {"cv_sph_dtc_sdb_01"_J, "cv_sph_dtc_sdb_01"},
-	    {"cv_sph_prs_low_food_01"_J, "cv_sph_prs_low_food_01"},
-	    {"cv_sph_sen_hso_01"_J, "cv_sph_sen_hso_01"},
-	    {"cv_sph_ssn_low_food_01"_J, "cv_sph_ssn_low_food_01"},
-	    {"cv_wnt_dtc_downes01"_J, "cv_wnt_dtc_downes01"},
-	    {"cv_wnt_dtc_hso_01"_J, "cv_wnt_dtc_hso_01"},
-	    {"cv_wnt_shared"_J, "cv_wnt_shared"},
-	    {"cv_wnt_str_04"_J, "cv_wnt_str_04"},
-	    {"cv_wnt_swn_18"_J, "cv_wnt_swn_18"},
-	    {"cv_wrk_bll_01"_J, "cv_wrk_bll_01"},
-	    {"cv_wrk_bll_02"_J, "cv_wrk_bll_02"},
-	    {"cv_wrk_hsh_01"_J, "cv_wrk_hsh_01"},
-	    {"cv_wrk_hsh_02"_J, "cv_wrk_hsh_02"},
-	    {"cv_wrk_jav_01"_J, "cv_wrk_jav_01"},
-	    {"cv_wrk_mch_01"_J, "cv_wrk_mch_01"},
-	    {"cv_wrk_mch_02"_J, "cv_wrk_mch_02"},
-	    {"cv_wrk_swn_01"_J, "cv_wrk_swn_01"},
-	    {"dairyfarm"_J, "dairyfarm"},
-	    {"dakotarivertrapper"_J, "dakotarivertrapper"},
-	    {"deadrival"_J, "deadrival"},
-	    {"deadsettler"_J, "deadsettler"},
-	    {"debug_fast_travel"_J, "debug_fast_travel"},
-	    {"debug_generic_widgets"_J, "debug_generic_widgets"},
-	    {"debug_launcher"_J, "debug_launcher"},
-	    {"debug_metapeditor"_J, "debug_metapeditor"},
-	    {"debug_metapeditor_custom_launch"_J, "debug_metapeditor_custom_launch"},
-	    {"debug_newspapers"_J, "debug_newspapers"},
-	    {"debug_update"_J, "debug_update"},
-	    {"def_comp_brain"_J, "def_comp_brain"},
-	    {"def_intro_script"_J, "def_intro_script"},
-	    {"dinolady"_J, "dinolady"},
-	    {"dino_bones"_J, "dino_bones"},
-	    {"discoverable_alchemist_house"_J, "discoverable_alchemist_house"},
-	    {"discoverable_easel"_J, "discoverable_easel"},
-	    {"discoverable_generic"_J, "discoverable_generic"},
-	    {"discoverable_generic_carriable"_J, "discoverable_generic_carriable"},
-	    {"discoverable_generic_corpse"_J, "discoverable_generic_corpse"},
-	    {"discoverable_generic_location"_J, "discoverable_generic_location"},
-	    {"discoverable_generic_ped"_J, "discoverable_generic_ped"},
-	    {"discoverable_geyser"_J, "discoverable_geyser"},
-	    {"discoverable_ghost_train"_J, "discoverable_ghost_train"},
-	    {"discoverable_hermit_woman"_J, "discoverable_hermit_woman"},
-	    {"discoverable_indian_burial"_J, "discoverable_indian_burial"},
+	    {"rcm_bh_skinner_brother"_J, "rcm_bh_skinner_brother"},
+	    {"saloon1_outro"_J, "saloon1_outro"},
+	    {"herb_oregano"_J, "herb_oregano"},
+	    {"beat_corpse_cart"_J, "beat_corpse_cart"},
+	    {"cv_cc_mll_06"_J, "cv_cc_mll_06"},
+	    {"rcm_beechers21"_J, "rcm_beechers21"},
+	    {"show_nbx_sworddance_01"_J, "show_nbx_sworddance_01"},
+	    {"rcm_for_my_art1"_J, "rcm_for_my_art1"},
+	    {"cv_end_abi_slp_shared"_J, "cv_end_abi_slp_shared"},
+	    {"cv_cc_dnk_04"_J, "cv_cc_dnk_04"},
+	    {"rcm_evelyn_miller5"_J, "rcm_evelyn_miller5"},
+	    {"shack_starvingchildren"_J, "shack_starvingchildren"},
+	    {"herb_sparrows_egg_orchid"_J, "herb_sparrows_egg_orchid"},
+	    {"spd_dorotheawicklow1"_J, "spd_dorotheawicklow1"},
+	    {"cv_amb_drunk_campfire"_J, "cv_amb_drunk_campfire"},
+	    {"cv_cc_mch_26"_J, "cv_cc_mch_26"},
+	    {"cv_cc_abi_20"_J, "cv_cc_abi_20"},
+	    {"cv_cc_abi_10"_J, "cv_cc_abi_10"},
+	    {"saloon1"_J, "saloon1"},
+	    {"rcm_war_veteran4"_J, "rcm_war_veteran4"},
+	    {"act_hunting_2"_J, "act_hunting_2"},
+	    {"cv_cf_shared"_J, "cv_cf_shared"},
+	    {"cv_cc_abi_07"_J, "cv_cc_abi_07"},
+	    {"bounty_poster"_J, "bounty_poster"},
+	    {"cv_itm_kie_01"_J, "cv_itm_kie_01"},
+	    {"vig_debug_ui"_J, "vig_debug_ui"},
+	    {"av_animal_scavenger"_J, "av_animal_scavenger"},
+	    {"rcm_collect_dinosaur_bones12"_J, "rcm_collect_dinosaur_bones12"},
+	    {"respawn_dump_body"_J, "respawn_dump_body"},
+	    {"vanhornmansion"_J, "vanhornmansion"},
+	    {"cv_amb_whisper_sit"_J, "cv_amb_whisper_sit"},
+	    {"rcm_bh_laramie_sleeping"_J, "rcm_bh_laramie_sleeping"},
+	    {"event_area_appleseed_stg5"_J, "event_area_appleseed_stg5"},
+	    {"rcm_mudtown3_1"_J, "rcm_mudtown3_1"},
+	    {"herb_oleander_sage_single"_J, "herb_oleander_sage_single"},
+	    {"shop_general"_J, "shop_general"},
+	    {"cv_cc_sen_09"_J, "cv_cc_sen_09"},
 	    {"discoverable_lightning_trees"_J, "discoverable_lightning_trees"},
-	    {"discoverable_meteor_shower"_J, "discoverable_meteor_shower"},
-	    {"discoverable_tree_house"_J, "discoverable_tree_house"},
-	    {"discoverable_tree_trunk_boat"_J, "discoverable_tree_trunk_boat"},
-	    {"disco_letter"_J, "disco_letter"},
-	    {"doc_book"_J, "doc_book"},
-	    {"doc_coach_robbery_note"_J, "doc_coach_robbery_note"},
-	    {"doc_newspaper"_J, "doc_newspaper"},
-	    {"doc_player_journal"_J, "doc_player_journal"},
-	    {"dominoesintro_invite"_J, "dominoesintro_invite"},
-	    {"dominoes_launch_sp"_J, "dominoes_launch_sp"},
-	    {"dominoes_sp"_J, "dominoes_sp"},
-	    {"downsranch"_J, "downsranch"},
-	    {"dreamanim"_J, "dreamanim"},
 	    {"dynamic_craft_scenario"_J, "dynamic_craft_scenario"},
-	    {"eating_scenario"_J, "eating_scenario"},
-	    {"electric_lantern"_J, "electric_lantern"},
-	    {"emeraldranch"_J, "emeraldranch"},
-	    {"es_activity_building"_J, "es_activity_building"},
-	    {"es_clean_stalls"_J, "es_clean_stalls"},
-	    {"es_clean_stalls_launch"_J, "es_clean_stalls_launch"},
-	    {"event_area_appleseed_stg1"_J, "event_area_appleseed_stg1"},
-	    {"event_area_appleseed_stg2"_J, "event_area_appleseed_stg2"},
-	    {"event_area_appleseed_stg3"_J, "event_area_appleseed_stg3"},
-	    {"event_area_appleseed_stg4"_J, "event_area_appleseed_stg4"},
-	    {"event_area_appleseed_stg5"_J, "event_area_appleseed_stg5"},
-	    {"event_area_castorspond"_J, "event_area_castorspond"},
-	    {"event_area_centralunion_stg1"_J, "event_area_centralunion_stg1"},
-	    {"event_area_centralunion_stg2"_J, "event_area_centralunion_stg2"},
-	    {"event_area_centralunion_stg3"_J, "event_area_centralunion_stg3"},
-	    {"event_area_ea_launcher"_J, "event_area_ea_launcher"},
-	    {"event_area_fortriggsholdingcamp"_J, "event_area_fortriggsholdingcamp"},
-	    {"fast_travel_prototype"_J, "fast_travel_prototype"},
-	    {"feud1"_J, "feud1"},
-	    {"feud1_intro"_J, "feud1_intro"},
-	    {"feud1_outro"_J, "feud1_outro"},
-	    {"fillet_launch_sp"_J, "fillet_launch_sp"},
-	    {"fillet_sp"_J, "fillet_sp"},
-	    {"finale1"_J, "finale1"},
-	    {"finale1_intro"_J, "finale1_intro"},
-	    {"finale2"_J, "finale2"},
-	    {"finale2_intro"_J, "finale2_intro"},
-	    {"finale3"_J, "finale3"},
-	    {"finale3_outro"_J, "finale3_outro"},
-	    {"fishing01_invite"_J, "fishing01_invite"},
-	    {"fishing02_invite"_J, "fishing02_invite"},
-	    {"fishing03_invite"_J, "fishing03_invite"},
-	    {"fishing_core"_J, "fishing_core"},
-	    {"fivefingerfilletintro_invite"_J, "fivefingerfilletintro_invite"},
-	    {"fivefingerfillet_02_invite"_J, "fivefingerfillet_02_invite"},
-	    {"flow_controller"_J, "flow_controller"},
-	    {"focus_ped_cam"_J, "focus_ped_cam"},
-	    {"focus_ped_cycle"_J, "focus_ped_cycle"},
-	    {"focus_ped_walk"_J, "focus_ped_walk"},
-	    {"footlocker_scenario"_J, "footlocker_scenario"},
-	    {"frozenexplorers"_J, "frozenexplorers"},
-	    {"frozen_to_death_scenario"_J, "frozen_to_death_scenario"},
-	    {"fundraiser_inspect"_J, "fundraiser_inspect"},
-	    {"fussar1"_J, "fussar1"},
-	    {"fussar1_intro"_J, "fussar1_intro"},
-	    {"fussar1_outro"_J, "fussar1_outro"},
-	    {"fussar2"_J, "fussar2"},
-	    {"fussar2_intro"_J, "fussar2_intro"},
-	    {"fussar2_outro"_J, "fussar2_outro"},
-	    {"gang1"_J, "gang1"},
-	    {"gang1_intro"_J, "gang1_intro"},
-	    {"gang1_outro"_J, "gang1_outro"},
-	    {"gang2"_J, "gang2"},
-	    {"gang2_intro"_J, "gang2_intro"},
-	    {"gang3"_J, "gang3"},
-	    {"gang3_intro"_J, "gang3_intro"},
-	    {"gang_enc_bandito_shack"_J, "gang_enc_bandito_shack"},
-	    {"gang_enc_band_shack_launch"_J, "gang_enc_band_shack_launch"},
-	    {"gang_enc_lemoyne_church"_J, "gang_enc_lemoyne_church"},
-	    {"gaptoothridge_population"_J, "gaptoothridge_population"},
-	    {"gator_eggs"_J, "gator_eggs"},
-	    {"generic_activity_invite"_J, "generic_activity_invite"},
-	    {"generic_alcohol_item"_J, "generic_alcohol_item"},
-	    {"generic_companion_activity"_J, "generic_companion_activity"},
-	    {"generic_cutscene"_J, "generic_cutscene"},
-	    {"generic_document_inspection"_J, "generic_document_inspection"},
-	    {"generic_ghosttown"_J, "generic_ghosttown"},
-	    {"generic_item_writing_on_back"_J, "generic_item_writing_on_back"},
-	    {"generic_mission"_J, "generic_mission"},
-	    {"generic_multibite_item"_J, "generic_multibite_item"},
-	    {"generic_puking_item"_J, "generic_puking_item"},
+	    {"cv_cc_kie_07"_J, "cv_cc_kie_07"},
+	    {"herb_american_ginseng"_J, "herb_american_ginseng"},
+	    {"rcm_poisoned_well1"_J, "rcm_poisoned_well1"},
+	    {"wapiti"_J, "wapiti"},
+	    {"av_bird_fence_swarm"_J, "av_bird_fence_swarm"},
+	    {"beat_treasure_hunter"_J, "beat_treasure_hunter"},
+	    {"beat_gang_camp_reminder"_J, "beat_gang_camp_reminder"},
+	    {"cv_cc_kie_15"_J, "cv_cc_kie_15"},
+	    {"register_scenario"_J, "register_scenario"},
+	    {"cv_wrk_jav_01"_J, "cv_wrk_jav_01"},
+	    {"cv_cc_kar_05"_J, "cv_cc_kar_05"},
+	    {"rcm_ride_the_lightning6"_J, "rcm_ride_the_lightning6"},
+	    {"ui_sticky_feed_priority_test"_J, "ui_sticky_feed_priority_test"},
+	    {"beat_police_chase"_J, "beat_police_chase"},
+	    {"av_rats_eating_group"_J, "av_rats_eating_group"},
+	    {"long_update"_J, "long_update"},
+	    {"rcm_down2"_J, "rcm_down2"},
+	    {"itemdatabase_debug"_J, "itemdatabase_debug"},
+	    {"winter4"_J, "winter4"},
+	    {"cv_cc_am_cnf_03"_J, "cv_cc_am_cnf_03"},
+	    {"av_fox_hunt_in_snow"_J, "av_fox_hunt_in_snow"},
+	    {"beechers_cow"_J, "beechers_cow"},
+	    {"cv_cc_tll_04"_J, "cv_cc_tll_04"},
+	    {"coachrobberies_gang3"_J, "coachrobberies_gang3"},
+	    {"vig_playlist_music_pns"_J, "vig_playlist_music_pns"},
+	    {"rcm_chain_gang6"_J, "rcm_chain_gang6"},
+	    {"region_law_rho_law_swarm"_J, "region_law_rho_law_swarm"},
 	    {"generic_shop_ui_events"_J, "generic_shop_ui_events"},
-	    {"generic_show_mc"_J, "generic_show_mc"},
-	    {"generic_single_use_item"_J, "generic_single_use_item"},
-	    {"generic_smoking_item"_J, "generic_smoking_item"},
-	    {"generic_wagon_fence_core"_J, "generic_wagon_fence_core"},
-	    {"generic_weapon_item"_J, "generic_weapon_item"},
-	    {"give_all_items"_J, "give_all_items"},
-	    {"grangershoggery"_J, "grangershoggery"},
-	    {"grays1"_J, "grays1"},
-	    {"grays1_intro"_J, "grays1_intro"},
-	    {"grays1_outro"_J, "grays1_outro"},
-	    {"grays2"_J, "grays2"},
-	    {"grays2_intro"_J, "grays2_intro"},
-	    {"grays2_outro"_J, "grays2_outro"},
-	    {"grays3"_J, "grays3"},
-	    {"grays3_intro"_J, "grays3_intro"},
-	    {"greatplains_population"_J, "greatplains_population"},
-	    {"grizzlieseast_population"_J, "grizzlieseast_population"},
-	    {"grizzlieswest_population"_J, "grizzlieswest_population"},
-	    {"grizzlies_abandon"_J, "grizzlies_abandon"},
+	    {"av_bird_land"_J, "av_bird_land"},
+	    {"beat_escort"_J, "beat_escort"},
+	    {"cv_sph_sen_hso_01"_J, "cv_sph_sen_hso_01"},
+	    {"cv_itm_dtc_01"_J, "cv_itm_dtc_01"},
+	    {"serialkiller"_J, "serialkiller"},
 	    {"grizzlies_population"_J, "grizzlies_population"},
-	    {"guama1"_J, "guama1"},
-	    {"guama2"_J, "guama2"},
-	    {"guama2_intro"_J, "guama2_intro"},
-	    {"guama3"_J, "guama3"},
-	    {"guama_population"_J, "guama_population"},
-	    {"guarma3_intro"_J, "guarma3_intro"},
-	    {"gunfight"_J, "gunfight"},
-	    {"handcart_test"_J, "handcart_test"},
-	    {"hanging_carcass"_J, "hanging_carcass"},
-	    {"happyfamily"_J, "happyfamily"},
-	    {"heartland_population"_J, "heartland_population"},
-	    {"hennigansstead_population"_J, "hennigansstead_population"},
-	    {"herb"_J, "herb"},
-	    {"herbal_plants"_J, "herbal_plants"},
-	    {"herb_acunas_star_orchid"_J, "herb_acunas_star_orchid"},
-	    {"herb_alaskan_ginseng"_J, "herb_alaskan_ginseng"},
-	    {"herb_american_ginseng"_J, "herb_american_ginseng"},
-	    {"herb_bay_bolete"_J, "herb_bay_bolete"},
-	    {"herb_black_berry"_J, "herb_black_berry"},
-	    {"herb_black_currant"_J, "herb_black_currant"},
-	    {"herb_burdock_root"_J, "herb_burdock_root"},
-	    {"herb_burdock_root_single"_J, "herb_burdock_root_single"},
-	    {"herb_chanterelles"_J, "herb_chanterelles"},
-	    {"herb_cigar_orchid"_J, "herb_cigar_orchid"},
-	    {"herb_clamshell_orchid"_J, "herb_clamshell_orchid"},
-	    {"herb_common_bulrush"_J, "herb_common_bulrush"},
-	    {"herb_creeping_thyme"_J, "herb_creeping_thyme"},
-	    {"herb_desert_sage"_J, "herb_desert_sage"},
-	    {"herb_dragons_mouth_orchid"_J, "herb_dragons_mouth_orchid"},
-	    {"herb_english_mace"_J, "herb_english_mace"},
-	    {"herb_english_mace_single"_J, "herb_english_mace_single"},
-	    {"herb_evergreen_huckleberry"_J, "herb_evergreen_huckleberry"},
-	    {"herb_ghost_orchid"_J, "herb_ghost_orchid"},
-	    {"herb_golden_currant"_J, "herb_golden_currant"},
-	    {"herb_hummingbird_sage"_J, "herb_hummingbird_sage"},
-	    {"herb_indian_tobacco"_J, "herb_indian_tobacco"},
-	    {"herb_item"_J, "herb_item"},
-	    {"herb_lady_of_night_orchid"_J, "herb_lady_of_night_orchid"},
-	    {"herb_lady_slipper_orchid"_J, "herb_lady_slipper_orchid"},
-	    {"herb_milkweed"_J, "herb_milkweed"},
-	    {"herb_milkweed_single"_J, "herb_milkweed_single"},
-	    {"herb_moccasin_flower_orchid"_J, "herb_moccasin_flower_orchid"},
-	    {"herb_night_scented_orchid"_J, "herb_night_scented_orchid"},
-	    {"herb_oleander_sage"_J, "herb_oleander_sage"},
-	    {"herb_oleander_sage_single"_J, "herb_oleander_sage_single"},
-	    {"herb_oregano"_J, "herb_oregano"},
-	    {"herb_parasol_mushroom"_J, "herb_parasol_mushroom"},
-	    {"herb_prairie_poppy"_J, "herb_prairie_poppy"},
-	    {"herb_queens_orchid"_J, "herb_queens_orchid"},
-	    {"herb_rams_head"_J, "herb_rams_head"},
-	    {"herb_rat_tail_orchid"_J, "herb_rat_tail_orchid"},
-	    {"herb_red_raspberry"_J, "herb_red_raspberry"},
-	    {"herb_red_sage"_J, "herb_red_sage"},
-	    {"herb_sparrows_egg_orchid"_J, "herb_sparrows_egg_orchid"},
-	    {"herb_spider_orchid"_J, "herb_spider_orchid"},
-	    {"herb_vanilla_flower"_J, "herb_vanilla_flower"},
-	    {"herb_violet_snowdrop"_J, "herb_violet_snowdrop"},
-	    {"herb_wild_carrots"_J, "herb_wild_carrots"},
+	    {"industry3_outro"_J, "industry3_outro"},
+	    {"audiotest"_J, "audiotest"},
+	    {"spd_joebutler3"_J, "spd_joebutler3"},
+	    {"beat_stalking_shadows"_J, "beat_stalking_shadows"},
+	    {"finale3_outro"_J, "finale3_outro"},
+	    {"cv_cc_jav_11"_J, "cv_cc_jav_11"},
+	    {"beat_torch_procession"_J, "beat_torch_procession"},
+	    {"cv_cc_jhn_05"_J, "cv_cc_jhn_05"},
+	    {"mudtown3b"_J, "mudtown3b"},
+	    {"beat_injured_rider"_J, "beat_injured_rider"},
+	    {"treasure_hunter"_J, "treasure_hunter"},
+	    {"coachrobberies_note"_J, "coachrobberies_note"},
+	    {"native1_intro"_J, "native1_intro"},
+	    {"cv_cc_dtc_10"_J, "cv_cc_dtc_10"},
+	    {"dakotarivertrapper"_J, "dakotarivertrapper"},
+	    {"ambush_inb_harass"_J, "ambush_inb_harass"},
 	    {"herb_wild_feverfew"_J, "herb_wild_feverfew"},
-	    {"herb_wild_mint"_J, "herb_wild_mint"},
-	    {"herb_wintergreen_berry"_J, "herb_wintergreen_berry"},
-	    {"herb_yarrow"_J, "herb_yarrow"},
-	    {"herb_yarrow_single"_J, "herb_yarrow_single"},
-	    {"hideout_beaverhollow"_J, "hideout_beaverhollow"},
-	    {"hideout_fortmercer"_J, "hideout_fortmercer"},
-	    {"hideout_gaptoothbreach"_J, "hideout_gaptoothbreach"},
-	    {"hideout_hangingdogranch"_J, "hideout_hangingdogranch"},
-	    {"hideout_hangingdogranch_es"_J, "hideout_hangingdogranch_es"},
-	    {"hideout_shadybelle"_J, "hideout_shadybelle"},
-	    {"hideout_sixpointcabin"_J, "hideout_sixpointcabin"},
-	    {"hideout_smugglerdocks"_J, "hideout_smugglerdocks"},
-	    {"hideout_solomonsfolly"_J, "hideout_solomonsfolly"},
-	    {"hideout_thieveslanding"_J, "hideout_thieveslanding"},
-	    {"hideout_twinrocks"_J, "hideout_twinrocks"},
-	    {"homeinvasion"_J, "homeinvasion"},
-	    {"homerobjavier_invite"_J, "homerobjavier_invite"},
-	    {"horseshoeoverlook"_J, "horseshoeoverlook"},
-	    {"hunting02_invite"_J, "hunting02_invite"},
-	    {"hunting06_invite"_J, "hunting06_invite"},
-	    {"hunting1"_J, "hunting1"},
-	    {"hunting1_intro"_J, "hunting1_intro"},
-	    {"hunting_activity"_J, "hunting_activity"},
-	    {"hunting_zone_bear_legendary"_J, "hunting_zone_bear_legendary"},
-	    {"hunting_zone_beaver"_J, "hunting_zone_beaver"},
-	    {"hunting_zone_big_horn_ram"_J, "hunting_zone_big_horn_ram"},
-	    {"hunting_zone_bison"_J, "hunting_zone_bison"},
-	    {"hunting_zone_boar"_J, "hunting_zone_boar"},
-	    {"hunting_zone_buck"_J, "hunting_zone_buck"},
-	    {"hunting_zone_buffalo_tatanka"_J, "hunting_zone_buffalo_tatanka"},
-	    {"hunting_zone_bullgator"_J, "hunting_zone_bullgator"},
-	    {"hunting_zone_cougar"_J, "hunting_zone_cougar"},
-	    {"hunting_zone_coyote"_J, "hunting_zone_coyote"},
-	    {"hunting_zone_elk"_J, "hunting_zone_elk"},
-	    {"hunting_zone_fox"_J, "hunting_zone_fox"},
-	    {"hunting_zone_moose"_J, "hunting_zone_moose"},
-	    {"hunting_zone_panther_legendary"_J, "hunting_zone_panther_legendary"},
-	    {"hunting_zone_pronghorn"_J, "hunting_zone_pronghorn"},
+	    {"av_walk_horse_carry_deer"_J, "av_walk_horse_carry_deer"},
+	    {"show_nbx_cancan_02"_J, "show_nbx_cancan_02"},
+	    {"beat_layout_editor"_J, "beat_layout_editor"},
 	    {"hunting_zone_wolf"_J, "hunting_zone_wolf"},
-	    {"ilo_playground"_J, "ilo_playground"},
-	    {"industry1"_J, "industry1"},
-	    {"industry1_intro"_J, "industry1_intro"},
-	    {"industry3"_J, "industry3"},
-	    {"industry3_intro"_J, "industry3_intro"},
-	    {"industry3_outro"_J, "industry3_outro"},
-	    {"init_all_sp"_J, "init_all_sp"},
-	    {"init_global_block_mc"_J, "init_global_block_mc"},
-	    {"init_global_block_mc_deathmatch"_J, "init_global_block_mc_deathmatch"},
-	    {"init_global_block_mc_race"_J, "init_global_block_mc_race"},
-	    {"init_global_block_mp"_J, "init_global_block_mp"},
-	    {"init_global_block_profiler"_J, "init_global_block_profiler"},
-	    {"init_global_block_shared"_J, "init_global_block_shared"},
-	    {"init_global_block_softsave"_J, "init_global_block_softsave"},
-	    {"init_global_block_sp"_J, "init_global_block_sp"},
-	    {"init_global_block_transition"_J, "init_global_block_transition"},
-	    {"init_global_block_ugc"_J, "init_global_block_ugc"},
-	    {"interactive_campfire"_J, "interactive_campfire"},
-	    {"itemdatabase_debug"_J, "itemdatabase_debug"},
-	    {"item_bait_herbivore"_J, "item_bait_herbivore"},
-	    {"item_bait_predator"_J, "item_bait_predator"},
-	    {"junction_test"_J, "junction_test"},
-	    {"junction_test_startup"_J, "junction_test_startup"},
-	    {"lagras"_J, "lagras"},
-	    {"laramie1"_J, "laramie1"},
-	    {"laramie1_intro"_J, "laramie1_intro"},
-	    {"larnedsod"_J, "larnedsod"},
-	    {"law_arrest"_J, "law_arrest"},
-	    {"law_guama"_J, "law_guama"},
-	    {"law_office_asb"_J, "law_office_asb"},
-	    {"law_office_blw"_J, "law_office_blw"},
-	    {"law_office_rho"_J, "law_office_rho"},
-	    {"law_office_std"_J, "law_office_std"},
-	    {"law_office_stw"_J, "law_office_stw"},
-	    {"law_office_twd"_J, "law_office_twd"},
-	    {"law_office_val"_J, "law_office_val"},
-	    {"layout_editor"_J, "layout_editor"},
-	    {"leadin_editor"_J, "leadin_editor"},
-	    {"loanshark_catfish"_J, "loanshark_catfish"},
-	    {"loanshark_horsechase1"_J, "loanshark_horsechase1"},
-	    {"loanshark_hunter"_J, "loanshark_hunter"},
-	    {"loanshark_miner1"_J, "loanshark_miner1"},
-	    {"loanshark_miner2"_J, "loanshark_miner2"},
-	    {"loanshark_sellhorse1"_J, "loanshark_sellhorse1"},
-	    {"loanshark_soldier"_J, "loanshark_soldier"},
-	    {"loanshark_undertaker"_J, "loanshark_undertaker"},
-	    {"loanshark_womancry"_J, "loanshark_womancry"},
-	    {"long_update"_J, "long_update"},
-	    {"lonniesshack"_J, "lonniesshack"},
-	    {"loonycult"_J, "loonycult"},
-	    {"lovetriangle"_J, "lovetriangle"},
-	    {"luckyscabin"_J, "luckyscabin"},
-	    {"macfarlanesranch"_J, "macfarlanesranch"},
-	    {"macleanshouse"_J, "macleanshouse"},
-	    {"main"_J, "main"},
-	    {"manzanitapost"_J, "manzanitapost"},
-	    {"map_app_event_handler"_J, "map_app_event_handler"},
-	    {"marston1"_J, "marston1"},
-	    {"marston1_intro"_J, "marston1_intro"},
-	    {"marston2"_J, "marston2"},
-	    {"marston2_intro"_J, "marston2_intro"},
-	    {"marston2_or_4_outro"_J, "marston2_or_4_outro"},
-	    {"marston4"_J, "marston4"},
-	    {"marston4_intro"_J, "marston4_intro"},
-	    {"marston5x_outro"_J, "marston5x_outro"},
-	    {"marston5_1"_J, "marston5_1"},
-	    {"marston5_1_intro"_J, "marston5_1_intro"},
-	    {"marston5_2"_J, "marston5_2"},
 	    {"marston5_2_intro"_J, "marston5_2_intro"},
-	    {"marston5_3"_J, "marston5_3"},
-	    {"marston5_3_intro"_J, "marston5_3_intro"},
-	    {"marston6"_J, "marston6"},
-	    {"marston6_intro"_J, "marston6_intro"},
-	    {"marston7"_J, "marston7"},
-	    {"marston7_intro"_J, "marston7_intro"},
-	    {"marston8"_J, "marston8"},
-	    {"marston8_intro"_J, "marston8_intro"},
+	    {"smoketest_budget"_J, "smoketest_budget"},
+	    {"cv_cc_mll_05"_J, "cv_cc_mll_05"},
+	    {"act_cajav_homerob1"_J, "act_cajav_homerob1"},
+	    {"av_wolf_takedown_miss"_J, "av_wolf_takedown_miss"},
+	    {"cv_cc_mch_29"_J, "cv_cc_mch_29"},
+	    {"shop_butcher"_J, "shop_butcher"},
+	    {"cv_cc_dog_01"_J, "cv_cc_dog_01"},
 	    {"marston8_outro"_J, "marston8_outro"},
-	    {"mary1"_J, "mary1"},
-	    {"mary1_intro"_J, "mary1_intro"},
-	    {"mary3"_J, "mary3"},
-	    {"mary3_intro"_J, "mary3_intro"},
-	    {"medium_update"_J, "medium_update"},
+	    {"rcm_evelyn_miller4"_J, "rcm_evelyn_miller4"},
+	    {"cv_cc_ssn_01"_J, "cv_cc_ssn_01"},
+	    {"native_son1_intro"_J, "native_son1_intro"},
+	    {"beat_gold_panner"_J, "beat_gold_panner"},
+	    {"herb_burdock_root"_J, "herb_burdock_root"},
+	    {"spd_dorotheawicklow2"_J, "spd_dorotheawicklow2"},
 	    {"metaped_clothing_gender_swap"_J, "metaped_clothing_gender_swap"},
+	    {"cv_cc_abi_06"_J, "cv_cc_abi_06"},
+	    {"cv_cc_abi_13"_J, "cv_cc_abi_13"},
+	    {"beat_savage_wagon"_J, "beat_savage_wagon"},
+	    {"av_body_toss"_J, "av_body_toss"},
 	    {"metaped_clothing_tool"_J, "metaped_clothing_tool"},
-	    {"metaped_clothing_tool_outfit_testing"_J, "metaped_clothing_tool_outfit_testing"},
-	    {"metaped_clothing_tool_quick_menu"_J, "metaped_clothing_tool_quick_menu"},
-	    {"metaped_editor"_J, "metaped_editor"},
-	    {"milking_cow"_J, "milking_cow"},
-	    {"milking_cow_launch"_J, "milking_cow_launch"},
-	    {"millesaniclaim"_J, "millesaniclaim"},
-	    {"missinghusband"_J, "missinghusband"},
-	    {"mission_tester"_J, "mission_tester"},
-	    {"mob1"_J, "mob1"},
-	    {"mob1_intro"_J, "mob1_intro"},
-	    {"mob1_outro"_J, "mob1_outro"},
-	    {"mob2"_J, "mob2"},
-	    {"mob2_intro"_J, "mob2_intro"},
-	    {"mob3"_J, "mob3"},
-	    {"mob3_intro"_J, "mob3_intro"},
-	    {"mob3_outro"_J, "mob3_outro"},
-	    {"mob4"_J, "mob4"},
-	    {"mob4_intro"_J, "mob4_intro"},
-	    {"mob4_outro"_J, "mob4_outro"},
-	    {"mob5"_J, "mob5"},
-	    {"mob5_intro"_J, "mob5_intro"},
-	    {"money_pile"_J, "money_pile"},
-	    {"money_scenario"_J, "money_scenario"},
-	    {"mountainman"_J, "mountainman"},
-	    {"mudtown1"_J, "mudtown1"},
-	    {"mudtown1_intro"_J, "mudtown1_intro"},
-	    {"mudtown1_outro"_J, "mudtown1_outro"},
-	    {"mudtown2"_J, "mudtown2"},
-	    {"mudtown2_intro"_J, "mudtown2_intro"},
-	    {"mudtown3"_J, "mudtown3"},
-	    {"mudtown3b"_J, "mudtown3b"},
-	    {"mudtown3b_intro"_J, "mudtown3b_intro"},
-	    {"mudtown3_intro"_J, "mudtown3_intro"},
-	    {"mudtown3_outro"_J, "mudtown3_outro"},
-	    {"mudtown4"_J, "mudtown4"},
-	    {"mudtown4_intro"_J, "mudtown4_intro"},
-	    {"mudtown5"_J, "mudtown5"},
-	    {"mudtown5_intro"_J, "mudtown5_intro"},
-	    {"music_timing_editor"_J, "music_timing_editor"},
-	    {"native1"_J, "native1"},
-	    {"native1_intro"_J, "native1_intro"},
-	    {"native1_outro"_J, "native1_outro"},
-	    {"native2"_J, "native2"},
-	    {"native2_intro"_J, "native2_intro"},
-	    {"native2_outro"_J, "native2_outro"},
-	    {"native3"_J, "native3"},
-	    {"native3_intro"_J, "native3_intro"},
+	    {"thieveslanding"_J, "thieveslanding"},
+	    {"cv_end_unc_02"_J, "cv_end_unc_02"},
+	    {"shoprobberies_dynamic"_J, "shoprobberies_dynamic"},
+	    {"sadie3_intro"_J, "sadie3_intro"},
+	    {"prisoner_str_1"_J, "prisoner_str_1"},
+	    {"respond_parcel"_J, "respond_parcel"},
+	    {"rcm_war_veteran3"_J, "rcm_war_veteran3"},
+	    {"cv_cc_dnk_03"_J, "cv_cc_dnk_03"},
+	    {"trelawny1_intro"_J, "trelawny1_intro"},
+	    {"loanshark_miner2"_J, "loanshark_miner2"},
+	    {"cv_cc_kar_04"_J, "cv_cc_kar_04"},
+	    {"cv_cc_mch_19"_J, "cv_cc_mch_19"},
+	    {"av_wagon_back_passenger"_J, "av_wagon_back_passenger"},
+	    {"av_dogs_playing"_J, "av_dogs_playing"},
+	    {"cv_cc_unc_08"_J, "cv_cc_unc_08"},
+	    {"homeinvasion"_J, "homeinvasion"},
+	    {"cv_cc_dnk_02"_J, "cv_cc_dnk_02"},
+	    {"rcm_collect_rare_fish1"_J, "rcm_collect_rare_fish1"},
+	    {"show_lighting_adjustment"_J, "show_lighting_adjustment"},
+	    {"beat_rally"_J, "beat_rally"},
+	    {"herb_lady_slipper_orchid"_J, "herb_lady_slipper_orchid"},
+	    {"shop_train_station"_J, "shop_train_station"},
+	    {"train_robbery3"_J, "train_robbery3"},
+	    {"shack_deadsettler"_J, "shack_deadsettler"},
+	    {"beat_kidnap_victim"_J, "beat_kidnap_victim"},
+	    {"rcm_ride_the_lightning7"_J, "rcm_ride_the_lightning7"},
 	    {"native3_outro"_J, "native3_outro"},
-	    {"native_son1"_J, "native_son1"},
-	    {"native_son1_intro"_J, "native_son1_intro"},
-	    {"native_son2"_J, "native_son2"},
-	    {"native_son2_intro"_J, "native_son2_intro"},
-	    {"native_son3"_J, "native_son3"},
-	    {"native_son3_intro"_J, "native_son3_intro"},
-	    {"native_son3_outro"_J, "native_son3_outro"},
-	    {"net_ambient_chest"_J, "net_ambient_chest"},
-	    {"nm_test"_J, "nm_test"},
+	    {"sadie4"_J, "sadie4"},
+	    {"manzanitapost"_J, "manzanitapost"},
+	    {"beat_on_the_run"_J, "beat_on_the_run"},
+	    {"ambush_odr_road_robbery"_J, "ambush_odr_road_robbery"},
+	    {"av_discoverable_parakeet"_J, "av_discoverable_parakeet"},
+	    {"weapon_locker"_J, "weapon_locker"},
+	    {"av_hawk_catch_snake"_J, "av_hawk_catch_snake"},
+	    {"show_nbx_firebreath_01"_J, "show_nbx_firebreath_01"},
+	    {"bigvalleytrapper"_J, "bigvalleytrapper"},
+	    {"fussar2_outro"_J, "fussar2_outro"},
+	    {"handcart_test"_J, "handcart_test"},
+	    {"cv_cc_am_cln_shared"_J, "cv_cc_am_cln_shared"},
+	    {"spd_chelonianmaster1"_J, "spd_chelonianmaster1"},
+	    {"cv_cc_sen_06"_J, "cv_cc_sen_06"},
+	    {"utopia2_intro"_J, "utopia2_intro"},
+	    {"cv_cc_kie_08"_J, "cv_cc_kie_08"},
+	    {"beat_prison_wagon"_J, "beat_prison_wagon"},
+	    {"cv_amb_jack_look_pot"_J, "cv_amb_jack_look_pot"},
+	    {"es_clean_stalls"_J, "es_clean_stalls"},
+	    {"layout_editor"_J, "layout_editor"},
+	    {"cv_amb_whisper_stand"_J, "cv_amb_whisper_stand"},
+	    {"beat_animal_attack"_J, "beat_animal_attack"},
+	    {"spd_joebutler4"_J, "spd_joebutler4"},
+	    {"rcm_bh_wife_and_lover"_J, "rcm_bh_wife_and_lover"},
+	    {"eating_scenario"_J, "eating_scenario"},
+	    {"beat_bounty_transport"_J, "beat_bounty_transport"},
+	    {"virtualization_unit_test_support"_J, "virtualization_unit_test_support"},
+	    {"cv_cc_trl_03"_J, "cv_cc_trl_03"},
+	    {"discoverable_generic_ped"_J, "discoverable_generic_ped"},
+	    {"herb_oleander_sage"_J, "herb_oleander_sage"},
+	    {"gang2"_J, "gang2"},
+	    {"beat_dead_john"_J, "beat_dead_john"},
+	    {"av_man_jump_fence"_J, "av_man_jump_fence"},
+	    {"cv_end_anj_01"_J, "cv_end_anj_01"},
+	    {"init_global_block_mc_deathmatch"_J, "init_global_block_mc_deathmatch"},
+	    {"footlocker_scenario"_J, "footlocker_scenario"},
+	    {"doc_newspaper"_J, "doc_newspaper"},
+	    {"rcm_coach_robbery1"_J, "rcm_coach_robbery1"},
+	    {"mary3"_J, "mary3"},
+	    {"av_wild_animal"_J, "av_wild_animal"},
 	    {"odriscolls1"_J, "odriscolls1"},
-	    {"odriscolls1_intro"_J, "odriscolls1_intro"},
-	    {"odriscolls1_outro"_J, "odriscolls1_outro"},
-	    {"odriscolls3"_J, "odriscolls3"},
-	    {"odriscolls3_intro"_J, "odriscolls3_intro"},
-	    {"odriscolls3_outro"_J, "odriscolls3_outro"},
-	    {"odriscolls4"_J, "odriscolls4"},
-	    {"odriscolls4_intro"_J, "odriscolls4_intro"},
-	    {"odriscolls5"_J, "odriscolls5"},
-	    {"odriscolls5_intro"_J, "odriscolls5_intro"},
-	    {"oldfortwallace"_J, "oldfortwallace"},
-	    {"orangeplantation"_J, "orangeplantation"},
-	    {"outfit_swapping"_J, "outfit_swapping"},
-	    {"paintedsky"_J, "paintedsky"},
-	    {"pausemenu_multiplayer"_J, "pausemenu_multiplayer"},
-	    {"pause_menu"_J, "pause_menu"},
-	    {"pause_menu_replay_launcher"_J, "pause_menu_replay_launcher"},
-	    {"ped_led_wnt_test"_J, "ped_led_wnt_test"},
-	    {"physics_perf_test"_J, "physics_perf_test"},
-	    {"placement_editor"_J, "placement_editor"},
-	    {"placement_editor_doors"_J, "placement_editor_doors"},
-	    {"placement_editor_gang_camps"_J, "placement_editor_gang_camps"},
-	    {"placement_editor_peds"_J, "placement_editor_peds"},
-	    {"placement_editor_pickups"_J, "placement_editor_pickups"},
-	    {"placement_editor_points"_J, "placement_editor_points"},
-	    {"placement_editor_props"_J, "placement_editor_props"},
-	    {"placement_editor_prop_sets"_J, "placement_editor_prop_sets"},
-	    {"placement_editor_vehicles"_J, "placement_editor_vehicles"},
-	    {"placement_editor_volumes"_J, "placement_editor_volumes"},
-	    {"placement_editor_weapons"_J, "placement_editor_weapons"},
-	    {"player_camp"_J, "player_camp"},
-	    {"player_horse"_J, "player_horse"},
-	    {"player_menu"_J, "player_menu"},
-	    {"player_scenario_camera"_J, "player_scenario_camera"},
-	    {"poker_launch_sp"_J, "poker_launch_sp"},
-	    {"poker_sp"_J, "poker_sp"},
-	    {"pre_sean1_law"_J, "pre_sean1_law"},
-	    {"prisoner"_J, "prisoner"},
-	    {"prisoner_blw_1"_J, "prisoner_blw_1"},
-	    {"prisoner_rhd_1"_J, "prisoner_rhd_1"},
-	    {"prisoner_std_1"_J, "prisoner_std_1"},
-	    {"prisoner_str_1"_J, "prisoner_str_1"},
-	    {"prisoner_twd_1"_J, "prisoner_twd_1"},
-	    {"prisoner_val_1"_J, "prisoner_val_1"},
-	    {"pronghornranch"_J, "pronghornranch"},
-	    {"property_use_core"_J, "property_use_core"},
-	    {"prop_drop"_J, "prop_drop"},
-	    {"ransack_looting"_J, "ransack_looting"},
-	    {"ransack_moneybag"_J, "ransack_moneybag"},
-	    {"rare_fish"_J, "rare_fish"},
+	    {"av_big_cat_ambush_deer"_J, "av_big_cat_ambush_deer"},
+	    {"item_bait_herbivore"_J, "item_bait_herbivore"},
+	    {"spd_lillianpowell4"_J, "spd_lillianpowell4"},
 	    {"rathskellerfork"_J, "rathskellerfork"},
-	    {"rcm_abigail11"_J, "rcm_abigail11"},
-	    {"rcm_abigail22"_J, "rcm_abigail22"},
-	    {"rcm_abigail31"_J, "rcm_abigail31"},
-	    {"rcm_beau_and_penelope10"_J, "rcm_beau_and_penelope10"},
-	    {"rcm_beau_and_penelope11"_J, "rcm_beau_and_penelope11"},
-	    {"rcm_beau_and_penelope12"_J, "rcm_beau_and_penelope12"},
-	    {"rcm_beau_and_penelope20"_J, "rcm_beau_and_penelope20"},
-	    {"rcm_beau_and_penelope21"_J, "rcm_beau_and_penelope21"},
-	    {"rcm_beechers11"_J, "rcm_beechers11"},
-	    {"rcm_beechers12"_J, "rcm_beechers12"},
-	    {"rcm_beechers21"_J, "rcm_beechers21"},
-	    {"rcm_bh_bandito_mine"_J, "rcm_bh_bandito_mine"},
-	    {"rcm_bh_bandito_shack"_J, "rcm_bh_bandito_shack"},
-	    {"rcm_bh_blackwater_hunt"_J, "rcm_bh_blackwater_hunt"},
-	    {"rcm_bh_camp_return"_J, "rcm_bh_camp_return"},
-	    {"rcm_bh_laramie_sleeping"_J, "rcm_bh_laramie_sleeping"},
-	    {"rcm_bh_sd_saloon"_J, "rcm_bh_sd_saloon"},
-	    {"rcm_bh_shack_escape"_J, "rcm_bh_shack_escape"},
-	    {"rcm_bh_skinner_brother"_J, "rcm_bh_skinner_brother"},
-	    {"rcm_bh_skinner_search"_J, "rcm_bh_skinner_search"},
-	    {"rcm_bh_wife_and_lover"_J, "rcm_bh_wife_and_lover"},
-	    {"rcm_bounty_duel1"_J, "rcm_bounty_duel1"},
-	    {"rcm_bounty_exconfed1"_J, "rcm_bounty_exconfed1"},
-	    {"rcm_bounty_rancher1"_J, "rcm_bounty_rancher1"},
-	    {"rcm_braithwaites01"_J, "rcm_braithwaites01"},
-	    {"rcm_calderon1"_J, "rcm_calderon1"},
-	    {"rcm_calderon2"_J, "rcm_calderon2"},
-	    {"rcm_calderon21"_J, "rcm_calderon21"},
-	    {"rcm_calderon22"_J, "rcm_calderon22"},
+	    {"rcm_collect_rock_faces2"_J, "rcm_collect_rock_faces2"},
+	    {"beat_torturing_captive"_J, "beat_torturing_captive"},
+	    {"beat_fleeing_trespasser"_J, "beat_fleeing_trespasser"},
+	    {"rhodes"_J, "rhodes"},
+	    {"herb_english_mace_single"_J, "herb_english_mace_single"},
+	    {"av_hobo_train_hop"_J, "av_hobo_train_hop"},
+	    {"train_vfx_test"_J, "train_vfx_test"},
+	    {"herb_acunas_star_orchid"_J, "herb_acunas_star_orchid"},
+	    {"cv_cc_tll_03"_J, "cv_cc_tll_03"},
+	    {"beat_skipping_stones"_J, "beat_skipping_stones"},
+	    {"av_water_horse"_J, "av_water_horse"},
+	    {"cv_cc_ssn_02"_J, "cv_cc_ssn_02"},
+	    {"beat_savage_warning"_J, "beat_savage_warning"},
+	    {"cv_cc_mrb_10"_J, "cv_cc_mrb_10"},
 	    {"rcm_callaway1"_J, "rcm_callaway1"},
-	    {"rcm_callaway12"_J, "rcm_callaway12"},
-	    {"rcm_callaway2"_J, "rcm_callaway2"},
-	    {"rcm_callaway3"_J, "rcm_callaway3"},
-	    {"rcm_chain_gang1"_J, "rcm_chain_gang1"},
-	    {"rcm_chain_gang2"_J, "rcm_chain_gang2"},
-	    {"rcm_chain_gang3"_J, "rcm_chain_gang3"},
-	    {"rcm_chain_gang4"_J, "rcm_chain_gang4"},
+	    {"coachrobberies_gang1_invite"_J, "coachrobberies_gang1_invite"},
+	    {"marston2_intro"_J, "marston2_intro"},
+	    {"cv_cc_jav_05"_J, "cv_cc_jav_05"},
+	    {"native_son3"_J, "native_son3"},
+	    {"rcm_gang02"_J, "rcm_gang02"},
+	    {"rock_carvings"_J, "rock_carvings"},
+	    {"gator_eggs"_J, "gator_eggs"},
+	    {"wilderness_chest"_J, "wilderness_chest"},
+	    {"crawdadwillies"_J, "crawdadwillies"},
+	    {"prisoner"_J, "prisoner"},
+	    {"cv_cc_kie_10"_J, "cv_cc_kie_10"},
+	    {"missinghusband"_J, "missinghusband"},
+	    {"cv_cc_len_08"_J, "cv_cc_len_08"},
+	    {"beat_wagon_threat"_J, "beat_wagon_threat"},
+	    {"money_pile"_J, "money_pile"},
+	    {"av_eagle_catch_fish"_J, "av_eagle_catch_fish"},
+	    {"register_core"_J, "register_core"},
+	    {"cv_end_jck_03"_J, "cv_end_jck_03"},
+	    {"laramie1"_J, "laramie1"},
+	    {"av_bearblack_intimidate_bearblack"_J, "av_bearblack_intimidate_bearblack"},
+	    {"cv_cc_kie_09"_J, "cv_cc_kie_09"},
+	    {"cv_cc_kie_05"_J, "cv_cc_kie_05"},
 	    {"rcm_chain_gang5"_J, "rcm_chain_gang5"},
-	    {"rcm_chain_gang6"_J, "rcm_chain_gang6"},
-	    {"rcm_chain_gang7"_J, "rcm_chain_gang7"},
-	    {"rcm_coach_robbery1"_J, "rcm_coach_robbery1"},
-	    {"rcm_collect_cigarette_cards1"_J, "rcm_collect_cigarette_cards1"},
-	    {"rcm_collect_dinosaur_bones11"_J, "rcm_collect_dinosaur_bones11"},
-	    {"rcm_collect_dinosaur_bones12"_J, "rcm_collect_dinosaur_bones12"},
-	    {"rcm_collect_exotics1"_J, "rcm_collect_exotics1"},
-	    {"rcm_collect_exotics2"_J, "rcm_collect_exotics2"},
-	    {"rcm_collect_exotics3"_J, "rcm_collect_exotics3"},
-	    {"rcm_collect_exotics4"_J, "rcm_collect_exotics4"},
-	    {"rcm_collect_exotics5"_J, "rcm_collect_exotics5"},
-	    {"rcm_collect_exotics6"_J, "rcm_collect_exotics6"},
-	    {"rcm_collect_rare_fish1"_J, "rcm_collect_rare_fish1"},
-	    {"rcm_collect_rare_fish2"_J, "rcm_collect_rare_fish2"},
-	    {"rcm_collect_rock_faces1"_J, "rcm_collect_rock_faces1"},
-	    {"rcm_collect_rock_faces2"_J, "rcm_collect_rock_faces2"},
-	    {"rcm_collect_taxidermy1"_J, "rcm_collect_taxidermy1"},
-	    {"rcm_collect_taxidermy2"_J, "rcm_collect_taxidermy2"},
-	    {"rcm_crackpot1"_J, "rcm_crackpot1"},
-	    {"rcm_crackpot2"_J, "rcm_crackpot2"},
-	    {"rcm_crackpot3"_J, "rcm_crackpot3"},
-	    {"rcm_crawley1"_J, "rcm_crawley1"},
-	    {"rcm_creole1"_J, "rcm_creole1"},
-	    {"rcm_doctors_opinion1"_J, "rcm_doctors_opinion1"},
-	    {"rcm_down1"_J, "rcm_down1"},
-	    {"rcm_down1_2"_J, "rcm_down1_2"},
-	    {"rcm_down2"_J, "rcm_down2"},
-	    {"rcm_down3"_J, "rcm_down3"},
-	    {"rcm_dusters21"_J, "rcm_dusters21"},
-	    {"rcm_dusters61"_J, "rcm_dusters61"},
-	    {"rcm_dusters62"_J, "rcm_dusters62"},
+	    {"cv_cc_dnj_05"_J, "cv_cc_dnj_05"},
+	    {"gang1_intro"_J, "gang1_intro"},
+	    {"herb_dragons_mouth_orchid"_J, "herb_dragons_mouth_orchid"},
+	    {"law_office_val"_J, "law_office_val"},
+	    {"cv_itm_kar_01"_J, "cv_itm_kar_01"},
+	    {"beat_town_trouble"_J, "beat_town_trouble"},
 	    {"rcm_dutch11"_J, "rcm_dutch11"},
-	    {"rcm_dutch21"_J, "rcm_dutch21"},
-	    {"rcm_dutch31"_J, "rcm_dutch31"},
-	    {"rcm_edith_down21"_J, "rcm_edith_down21"},
+	    {"av_dog_chase_tail"_J, "av_dog_chase_tail"},
+	    {"av_alligator_boar_neck"_J, "av_alligator_boar_neck"},
+	    {"greatplains_population"_J, "greatplains_population"},
+	    {"fussar2"_J, "fussar2"},
+	    {"spd_blandpreacher"_J, "spd_blandpreacher"},
+	    {"av_eagle_dive_catch_fish"_J, "av_eagle_dive_catch_fish"},
+	    {"rcm_strauss33"_J, "rcm_strauss33"},
+	    {"focus_ped_walk"_J, "focus_ped_walk"},
+	    {"cv_cc_mch_28"_J, "cv_cc_mch_28"},
+	    {"init_global_block_sp"_J, "init_global_block_sp"},
+	    {"town_secrets_strawberry"_J, "town_secrets_strawberry"},
+	    {"rcm_gunslinger5_1"_J, "rcm_gunslinger5_1"},
+	    {"cv_end_abi_02"_J, "cv_end_abi_02"},
+	    {"beat_dark_alley_bum"_J, "beat_dark_alley_bum"},
+	    {"coachrobberies_intro"_J, "coachrobberies_intro"},
+	    {"cv_cc_abi_04"_J, "cv_cc_abi_04"},
+	    {"music_timing_editor"_J, "music_timing_editor"},
+	    {"cv_cc_snk_par_01"_J, "cv_cc_snk_par_01"},
+	    {"train_robbery4"_J, "train_robbery4"},
+	    {"cv_cc_swn_22"_J, "cv_cc_swn_22"},
+	    {"show_nbx_firedance_01"_J, "show_nbx_firedance_01"},
+	    {"cv_cc_hsh_14"_J, "cv_cc_hsh_14"},
+	    {"reverend1"_J, "reverend1"},
+	    {"init_global_block_ugc"_J, "init_global_block_ugc"},
+	    {"cv_cc_mch_08"_J, "cv_cc_mch_08"},
+	    {"av_wall_vomit"_J, "av_wall_vomit"},
+	    {"sadie5"_J, "sadie5"},
+	    {"cv_cc_dnl_02"_J, "cv_cc_dnl_02"},
+	    {"scaleform_lobby_menu_demo"_J, "scaleform_lobby_menu_demo"},
+	    {"ambush_pnk_type1"_J, "ambush_pnk_type1"},
+	    {"spd_armadillotowncrier"_J, "spd_armadillotowncrier"},
+	    {"av_bird_flee_swarm"_J, "av_bird_flee_swarm"},
+	    {"downsranch"_J, "downsranch"},
+	    {"av_fox_catch_rodent"_J, "av_fox_catch_rodent"},
+	    {"beat_burning_bodies"_J, "beat_burning_bodies"},
+	    {"rcm_for_my_art4"_J, "rcm_for_my_art4"},
+	    {"rcm_oh_brother3"_J, "rcm_oh_brother3"},
+	    {"camp_clemenspoint"_J, "camp_clemenspoint"},
+	    {"camp_guarma"_J, "camp_guarma"},
+	    {"beat_peeping_tom"_J, "beat_peeping_tom"},
+	    {"talltrees_population"_J, "talltrees_population"},
+	    {"cv_cc_sen_07"_J, "cv_cc_sen_07"},
+	    {"vig_playlist_music_snknj"_J, "vig_playlist_music_snknj"},
+	    {"rcm_ride_the_lightning4"_J, "rcm_ride_the_lightning4"},
+	    {"grangershoggery"_J, "grangershoggery"},
+	    {"player_scenario_camera"_J, "player_scenario_camera"},
+	    {"shack_mountainman1"_J, "shack_mountainman1"},
+	    {"cv_cc_dnm_02"_J, "cv_cc_dnm_02"},
+	    {"beat_crashed_wagon"_J, "beat_crashed_wagon"},
+	    {"cheat_ui"_J, "cheat_ui"},
+	    {"beat_author"_J, "beat_author"},
+	    {"beat_lemoyne_town_encounter"_J, "beat_lemoyne_town_encounter"},
+	    {"beat_trapped_woman"_J, "beat_trapped_woman"},
+	    {"marston4_intro"_J, "marston4_intro"},
+	    {"rcm_mr_mayor2"_J, "rcm_mr_mayor2"},
+	    {"cumberlandforest_population"_J, "cumberlandforest_population"},
+	    {"hideout_thieveslanding"_J, "hideout_thieveslanding"},
+	    {"prisoner_blw_1"_J, "prisoner_blw_1"},
+	    {"cv_cc_tll_02"_J, "cv_cc_tll_02"},
+	    {"beat_street_fight"_J, "beat_street_fight"},
+	    {"smoketest_wait"_J, "smoketest_wait"},
+	    {"cv_cc_hsh_19"_J, "cv_cc_hsh_19"},
+	    {"cv_cc_kie_11"_J, "cv_cc_kie_11"},
+	    {"spd_lillianpowell3"_J, "spd_lillianpowell3"},
+	    {"cv_amb_start_phonograph"_J, "cv_amb_start_phonograph"},
+	    {"cv_cc_bll_11"_J, "cv_cc_bll_11"},
+	    {"act_camp_dominoes_light"_J, "act_camp_dominoes_light"},
+	    {"cv_cc_unc_06"_J, "cv_cc_unc_06"},
+	    {"cv_cc_jhn_04"_J, "cv_cc_jhn_04"},
+	    {"rcm_collect_rock_faces1"_J, "rcm_collect_rock_faces1"},
+	    {"debug_update"_J, "debug_update"},
+	    {"av_wolves_eat_deer"_J, "av_wolves_eat_deer"},
+	    {"cv_cc_mrb_11"_J, "cv_cc_mrb_11"},
+	    {"law_office_twd"_J, "law_office_twd"},
+	    {"rcm_down1_2"_J, "rcm_down1_2"},
+	    {"show_nbx_cancan"_J, "show_nbx_cancan"},
+	    {"rcm_beau_and_penelope11"_J, "rcm_beau_and_penelope11"},
+	    {"cv_amb_drop_rabbit_table"_J, "cv_amb_drop_rabbit_table"},
+	    {"herb_item"_J, "herb_item"},
+	    {"av_whore_give_money"_J, "av_whore_give_money"},
+	    {"native3"_J, "native3"},
+	    {"herb_indian_tobacco"_J, "herb_indian_tobacco"},
+	    {"beat_rally_dispute"_J, "beat_rally_dispute"},
+	    {"av_pump_cart"_J, "av_pump_cart"},
+	    {"spd_bummicky2"_J, "spd_bummicky2"},
+	    {"loonycult"_J, "loonycult"},
+	    {"fussar1"_J, "fussar1"},
+	    {"shadybelle"_J, "shadybelle"},
+	    {"beat_pickpocket"_J, "beat_pickpocket"},
+	    {"cv_cc_ssn_03"_J, "cv_cc_ssn_03"},
+	    {"braithwaites1_outro"_J, "braithwaites1_outro"},
+	    {"shop_dynamic"_J, "shop_dynamic"},
+	    {"debug_generic_widgets"_J, "debug_generic_widgets"},
+	    {"shop_pearson"_J, "shop_pearson"},
+	    {"show_nbx_oddfellows"_J, "show_nbx_oddfellows"},
+	    {"cv_cc_abi_11"_J, "cv_cc_abi_11"},
+	    {"beat_lost_dog"_J, "beat_lost_dog"},
+	    {"av_wolves_alarmed"_J, "av_wolves_alarmed"},
+	    {"placement_editor"_J, "placement_editor"},
+	    {"cv_cc_chr_01"_J, "cv_cc_chr_01"},
+	    {"cv_cc_jck_04"_J, "cv_cc_jck_04"},
+	    {"beat_taunting"_J, "beat_taunting"},
+	    {"watsonscabin"_J, "watsonscabin"},
+	    {"industry1_intro"_J, "industry1_intro"},
+	    {"loanshark_hunter"_J, "loanshark_hunter"},
+	    {"cv_end_anj_03"_J, "cv_end_anj_03"},
+	    {"rcm_collect_rare_fish2"_J, "rcm_collect_rare_fish2"},
+	    {"cv_cc_mch_17"_J, "cv_cc_mch_17"},
+	    {"mob1"_J, "mob1"},
+	    {"scaleform_ui_test"_J, "scaleform_ui_test"},
+	    {"shocking_beats"_J, "shocking_beats"},
+	    {"cv_cc_len_05"_J, "cv_cc_len_05"},
+	    {"rcm_braithwaites01"_J, "rcm_braithwaites01"},
+	    {"generic_companion_activity"_J, "generic_companion_activity"},
+	    {"herb_milkweed"_J, "herb_milkweed"},
+	    {"rcm_collect_exotics5"_J, "rcm_collect_exotics5"},
+	    {"mary1"_J, "mary1"},
+	    {"finale3"_J, "finale3"},
+	    {"cv_cc_dnm_03"_J, "cv_cc_dnm_03"},
+	    {"av_pelican_dive"_J, "av_pelican_dive"},
+	    {"beat_booby_trap"_J, "beat_booby_trap"},
+	    {"beat_wild_man_cave"_J, "beat_wild_man_cave"},
+	    {"cv_cc_dnj_04"_J, "cv_cc_dnj_04"},
+	    {"av_whisper_sit"_J, "av_whisper_sit"},
+	    {"cv_cc_am_cnf_01"_J, "cv_cc_am_cnf_01"},
+	    {"rcm_ride_the_lightning5"_J, "rcm_ride_the_lightning5"},
+	    {"cv_cc_swn_21"_J, "cv_cc_swn_21"},
+	    {"show_movie_magic_lantern"_J, "show_movie_magic_lantern"},
+	    {"cv_itm_abi_01"_J, "cv_itm_abi_01"},
+	    {"av_vultures_eat_carcass"_J, "av_vultures_eat_carcass"},
+	    {"placement_editor_pickups"_J, "placement_editor_pickups"},
+	    {"cv_amb_dog_jump_and_lick"_J, "cv_amb_dog_jump_and_lick"},
+	    {"beat_wilderness_hanging"_J, "beat_wilderness_hanging"},
+	    {"show_nbx_firedance_02"_J, "show_nbx_firedance_02"},
+	    {"give_all_items"_J, "give_all_items"},
+	    {"bigvalley_population"_J, "bigvalley_population"},
+	    {"rcm_native1"_J, "rcm_native1"},
+	    {"init_global_block_mc"_J, "init_global_block_mc"},
+	    {"cv_cc_swn_17"_J, "cv_cc_swn_17"},
+	    {"loanshark_soldier"_J, "loanshark_soldier"},
+	    {"beat_disabled_beggar"_J, "beat_disabled_beggar"},
+	    {"serendipity"_J, "serendipity"},
+	    {"dreamanim"_J, "dreamanim"},
+	    {"stew_eating"_J, "stew_eating"},
+	    {"av_walk_with_horse"_J, "av_walk_with_horse"},
+	    {"herb_spider_orchid"_J, "herb_spider_orchid"},
+	    {"herb_prairie_poppy"_J, "herb_prairie_poppy"},
+	    {"av_wolves_howling"_J, "av_wolves_howling"},
+	    {"cv_cc_dnh_10"_J, "cv_cc_dnh_10"},
+	    {"prisoner_rhd_1"_J, "prisoner_rhd_1"},
+	    {"herb_wild_carrots"_J, "herb_wild_carrots"},
+	    {"cv_cc_hsh_16"_J, "cv_cc_hsh_16"},
+	    {"rcm_bh_shack_escape"_J, "rcm_bh_shack_escape"},
+	    {"lovetriangle"_J, "lovetriangle"},
+	    {"town_secrets_val_moira"_J, "town_secrets_val_moira"},
+	    {"spd_soothsayer1"_J, "spd_soothsayer1"},
+	    {"generic_single_use_item"_J, "generic_single_use_item"},
+	    {"beat_voice"_J, "beat_voice"},
+	    {"beat_dark_alley_ambush"_J, "beat_dark_alley_ambush"},
+	    {"beechershope"_J, "beechershope"},
+	    {"rcm_oh_brother1"_J, "rcm_oh_brother1"},
+	    {"scaleform_font_test"_J, "scaleform_font_test"},
+	    {"odriscolls1_outro"_J, "odriscolls1_outro"},
+	    {"cv_cc_hsh_01"_J, "cv_cc_hsh_01"},
+	    {"hideout_sixpointcabin"_J, "hideout_sixpointcabin"},
+	    {"rcm_mary02"_J, "rcm_mary02"},
+	    {"metaped_clothing_tool_quick_menu"_J, "metaped_clothing_tool_quick_menu"},
+	    {"cv_cc_sen_04"_J, "cv_cc_sen_04"},
+	    {"beat_gang_ped1_encounter"_J, "beat_gang_ped1_encounter"},
+	    {"milking_cow_launch"_J, "milking_cow_launch"},
+	    {"rcm_mr_mayor3"_J, "rcm_mr_mayor3"},
+	    {"cv_cc_kie_12"_J, "cv_cc_kie_12"},
+	    {"bluegillmarsh_population"_J, "bluegillmarsh_population"},
+	    {"cv_cc_sen_11"_J, "cv_cc_sen_11"},
+	    {"marston1_intro"_J, "marston1_intro"},
+	    {"mob3_intro"_J, "mob3_intro"},
+	    {"beat_outlaw_looter"_J, "beat_outlaw_looter"},
+	    {"herb_rat_tail_orchid"_J, "herb_rat_tail_orchid"},
+	    {"cv_end_anj_02"_J, "cv_end_anj_02"},
+	    {"flow_controller"_J, "flow_controller"},
+	    {"guama_population"_J, "guama_population"},
+	    {"scaleform_graphic_test"_J, "scaleform_graphic_test"},
+	    {"cv_cc_mch_31"_J, "cv_cc_mch_31"},
+	    {"grizzlies_abandon"_J, "grizzlies_abandon"},
+	    {"cv_cc_unc_07"_J, "cv_cc_unc_07"},
+	    {"caligahall"_J, "caligahall"},
+	    {"mission_tester"_J, "mission_tester"},
+	    {"bounty1_outro"_J, "bounty1_outro"},
+	    {"smoketest"_J, "smoketest"},
+	    {"av_dog_chase_cat"_J, "av_dog_chase_cat"},
+	    {"dairyfarm"_J, "dairyfarm"},
+	    {"beechers2_2_intro"_J, "beechers2_2_intro"},
+	    {"cv_cc_ssn_04"_J, "cv_cc_ssn_04"},
+	    {"cv_cf_am_01"_J, "cv_cf_am_01"},
+	    {"saint_denis1"_J, "saint_denis1"},
+	    {"av_roving_herd"_J, "av_roving_herd"},
+	    {"av_dog_in_wagon"_J, "av_dog_in_wagon"},
+	    {"cv_cc_dnh_01"_J, "cv_cc_dnh_01"},
+	    {"cv_cc_snk_par_03"_J, "cv_cc_snk_par_03"},
+	    {"train_robbery2"_J, "train_robbery2"},
+	    {"rcm_mob01"_J, "rcm_mob01"},
+	    {"cv_cc_sad_02"_J, "cv_cc_sad_02"},
+	    {"act_gen_fishing"_J, "act_gen_fishing"},
+	    {"rcm_calderon2"_J, "rcm_calderon2"},
+	    {"av_deer_tree_rub"_J, "av_deer_tree_rub"},
+	    {"cv_cc_mch_22"_J, "cv_cc_mch_22"},
+	    {"cv_cc_mch_18"_J, "cv_cc_mch_18"},
+	    {"short_update"_J, "short_update"},
+	    {"bounty1"_J, "bounty1"},
+	    {"industry3"_J, "industry3"},
+	    {"cv_cc_prs_02"_J, "cv_cc_prs_02"},
+	    {"beat_traffic_attack"_J, "beat_traffic_attack"},
+	    {"cv_cc_jhn_03"_J, "cv_cc_jhn_03"},
+	    {"bounty1_intro"_J, "bounty1_intro"},
+	    {"ambush_sav_lookout_attack"_J, "ambush_sav_lookout_attack"},
+	    {"region_law_w_eliz_pinks"_J, "region_law_w_eliz_pinks"},
+	    {"vig_playlist_gang3_post"_J, "vig_playlist_gang3_post"},
+	    {"rcm_mason3"_J, "rcm_mason3"},
+	    {"vig_playlist_mud1_post"_J, "vig_playlist_mud1_post"},
+	    {"rcm_evelyn_miller1"_J, "rcm_evelyn_miller1"},
+	    {"cornwall1"_J, "cornwall1"},
+	    {"cv_cc_mch_30"_J, "cv_cc_mch_30"},
+	    {"shop_newspaper_boy"_J, "shop_newspaper_boy"},
+	    {"generic_multibite_item"_J, "generic_multibite_item"},
+	    {"sean1_intro"_J, "sean1_intro"},
+	    {"rcm_crawley1"_J, "rcm_crawley1"},
+	    {"fivefingerfillet_02_invite"_J, "fivefingerfillet_02_invite"},
+	    {"cornwallkerosene"_J, "cornwallkerosene"},
+	    {"marston6"_J, "marston6"},
+	    {"cv_cc_mch_03"_J, "cv_cc_mch_03"},
+	    {"placement_editor_points"_J, "placement_editor_points"},
+	    {"mudtown3b_intro"_J, "mudtown3b_intro"},
+	    {"cv_cc_jhn_09"_J, "cv_cc_jhn_09"},
+	    {"mob2"_J, "mob2"},
+	    {"beat_posse_breakout"_J, "beat_posse_breakout"},
+	    {"beat_friendly_outdoorsman"_J, "beat_friendly_outdoorsman"},
+	    {"cv_cc_dtc_28"_J, "cv_cc_dtc_28"},
+	    {"tumbleweed"_J, "tumbleweed"},
+	    {"discoverable_ghost_train"_J, "discoverable_ghost_train"},
+	    {"cv_cc_len_04"_J, "cv_cc_len_04"},
+	    {"cv_end_abi_04"_J, "cv_end_abi_04"},
+	    {"herb_desert_sage"_J, "herb_desert_sage"},
+	    {"cv_cc_abi_02"_J, "cv_cc_abi_02"},
+	    {"save_menu_ui_event_handler"_J, "save_menu_ui_event_handler"},
+	    {"map_app_event_handler"_J, "map_app_event_handler"},
+	    {"guama3"_J, "guama3"},
+	    {"interactive_campfire"_J, "interactive_campfire"},
+	    {"cv_cc_jck_05"_J, "cv_cc_jck_05"},
+	    {"bathing"_J, "bathing"},
+	    {"rcm_mr_mayor1"_J, "rcm_mr_mayor1"},
+	    {"talltreestrapper"_J, "talltreestrapper"},
+	    {"cv_amb_comp_donate_look"_J, "cv_amb_comp_donate_look"},
+	    {"odriscolls4"_J, "odriscolls4"},
+	    {"rcm_dusters62"_J, "rcm_dusters62"},
+	    {"rcm_collect_exotics4"_J, "rcm_collect_exotics4"},
+	    {"herb_black_berry"_J, "herb_black_berry"},
+	    {"av_man_with_lantern"_J, "av_man_with_lantern"},
+	    {"oldfortwallace"_J, "oldfortwallace"},
+	    {"wanted_poster"_J, "wanted_poster"},
+	    {"cv_cc_mch_15"_J, "cv_cc_mch_15"},
+	    {"beat_rowdy_drunks"_J, "beat_rowdy_drunks"},
+	    {"angryisolationist"_J, "angryisolationist"},
+	    {"cv_cc_mch_06"_J, "cv_cc_mch_06"},
+	    {"rcm_tilly1"_J, "rcm_tilly1"},
+	    {"beat_inbred_kidnap"_J, "beat_inbred_kidnap"},
+	    {"rcm_dusters61"_J, "rcm_dusters61"},
+	    {"rcm_beechers12"_J, "rcm_beechers12"},
+	    {"hideout_solomonsfolly"_J, "hideout_solomonsfolly"},
+	    {"cv_wnt_dtc_hso_01"_J, "cv_wnt_dtc_hso_01"},
+	    {"generic_puking_item"_J, "generic_puking_item"},
+	    {"rcm_pearson1_outro"_J, "rcm_pearson1_outro"},
+	    {"loanshark_horsechase1"_J, "loanshark_horsechase1"},
+	    {"spd_bummicky4"_J, "spd_bummicky4"},
+	    {"prisoner_twd_1"_J, "prisoner_twd_1"},
+	    {"cv_cc_sen_10"_J, "cv_cc_sen_10"},
+	    {"av_wagon_sweeper"_J, "av_wagon_sweeper"},
+	    {"rcm_ride_the_lightning2"_J, "rcm_ride_the_lightning2"},
+	    {"winter4_intro"_J, "winter4_intro"},
+	    {"braithwaites1_intro"_J, "braithwaites1_intro"},
+	    {"beat_player_camp_stranger"_J, "beat_player_camp_stranger"},
+	    {"rcm_gunslinger3_1"_J, "rcm_gunslinger3_1"},
+	    {"asset_viewer_main"_J, "asset_viewer_main"},
+	    {"rcm_here_kitty_kitty4"_J, "rcm_here_kitty_kitty4"},
+	    {"cv_amb_sore_joints"_J, "cv_amb_sore_joints"},
+	    {"carmodydell"_J, "carmodydell"},
+	    {"winter4_outro"_J, "winter4_outro"},
+	    {"spd_madscientist"_J, "spd_madscientist"},
+	    {"cv_cc_sen_01"_J, "cv_cc_sen_01"},
+	    {"cv_cc_hsh_17"_J, "cv_cc_hsh_17"},
+	    {"millesaniclaim"_J, "millesaniclaim"},
+	    {"cv_cc_sen_05"_J, "cv_cc_sen_05"},
+	    {"camp_fire_cooking"_J, "camp_fire_cooking"},
+	    {"civilwarbride"_J, "civilwarbride"},
+	    {"beat_wild_man"_J, "beat_wild_man"},
+	    {"caravan_state_debug_ui"_J, "caravan_state_debug_ui"},
+	    {"generic_mission"_J, "generic_mission"},
+	    {"rcm_gang01"_J, "rcm_gang01"},
+	    {"beat_slum_ambush"_J, "beat_slum_ambush"},
+	    {"discoverable_easel"_J, "discoverable_easel"},
+	    {"show_nbx_bulletcatch"_J, "show_nbx_bulletcatch"},
+	    {"beaverhollow"_J, "beaverhollow"},
+	    {"native2"_J, "native2"},
+	    {"cv_cc_mch_33"_J, "cv_cc_mch_33"},
+	    {"beechers2_2_outro"_J, "beechers2_2_outro"},
+	    {"cv_cc_mll_09"_J, "cv_cc_mll_09"},
+	    {"cv_cc_dnj_01"_J, "cv_cc_dnj_01"},
+	    {"smoketest_stability"_J, "smoketest_stability"},
+	    {"cv_cc_dnh_02"_J, "cv_cc_dnh_02"},
+	    {"cv_cc_snk_par_02"_J, "cv_cc_snk_par_02"},
+	    {"beat_checkpoint"_J, "beat_checkpoint"},
+	    {"rcm_slave_catcher2"_J, "rcm_slave_catcher2"},
+	    {"cv_cc_mrb_09"_J, "cv_cc_mrb_09"},
+	    {"discoverable_meteor_shower"_J, "discoverable_meteor_shower"},
+	    {"beat_sharp_shooter"_J, "beat_sharp_shooter"},
+	    {"gang_enc_bandito_shack"_J, "gang_enc_bandito_shack"},
+	    {"rob_register"_J, "rob_register"},
+	    {"nm_test"_J, "nm_test"},
+	    {"startup_sp"_J, "startup_sp"},
+	    {"cv_cc_lnsnm_01"_J, "cv_cc_lnsnm_01"},
+	    {"mudtown2"_J, "mudtown2"},
+	    {"act_gen_fff"_J, "act_gen_fff"},
+	    {"cv_cc_abi_05"_J, "cv_cc_abi_05"},
+	    {"av_walk_with_dog"_J, "av_walk_with_dog"},
+	    {"rcm_bounty_rancher1"_J, "rcm_bounty_rancher1"},
+	    {"rileyscharge"_J, "rileyscharge"},
+	    {"cv_sph_dtc_sdb_01"_J, "cv_sph_dtc_sdb_01"},
+	    {"mob3"_J, "mob3"},
+	    {"spd_bummicky7"_J, "spd_bummicky7"},
+	    {"rcm_herbalist_camp"_J, "rcm_herbalist_camp"},
+	    {"beat_naked_swimmer"_J, "beat_naked_swimmer"},
+	    {"trainrobbery_ambient"_J, "trainrobbery_ambient"},
+	    {"cv_cc_dnk_01"_J, "cv_cc_dnk_01"},
+	    {"starvingchildren"_J, "starvingchildren"},
+	    {"marston5_1"_J, "marston5_1"},
+	    {"def_intro_script"_J, "def_intro_script"},
+	    {"shop_bait"_J, "shop_bait"},
+	    {"rcm_the_odd_fellows2"_J, "rcm_the_odd_fellows2"},
+	    {"shack_loonycult1"_J, "shack_loonycult1"},
+	    {"cv_itm_sen_01"_J, "cv_itm_sen_01"},
+	    {"outfit_swapping"_J, "outfit_swapping"},
+	    {"cv_cc_mch_25"_J, "cv_cc_mch_25"},
+	    {"grays1_intro"_J, "grays1_intro"},
+	    {"scarletthorseshop"_J, "scarletthorseshop"},
+	    {"aberdeenpigfarm"_J, "aberdeenpigfarm"},
+	    {"cv_cc_hsh_03"_J, "cv_cc_hsh_03"},
+	    {"smuggler2_intro"_J, "smuggler2_intro"},
+	    {"beat_boat_attack"_J, "beat_boat_attack"},
+	    {"beat_washed_ashore"_J, "beat_washed_ashore"},
+	    {"campfire_gang_es"_J, "campfire_gang_es"},
+	    {"sadie4_outro"_J, "sadie4_outro"},
+	    {"utopia1_intro"_J, "utopia1_intro"},
+	    {"coachrobberies_gang2"_J, "coachrobberies_gang2"},
+	    {"marston5x_outro"_J, "marston5x_outro"},
+	    {"herb_cigar_orchid"_J, "herb_cigar_orchid"},
+	    {"mary3_intro"_J, "mary3_intro"},
+	    {"init_global_block_mp"_J, "init_global_block_mp"},
+	    {"cv_cc_bll_10"_J, "cv_cc_bll_10"},
+	    {"rcm_ride_the_lightning3"_J, "rcm_ride_the_lightning3"},
+	    {"ambush_exc_scm_prec"_J, "ambush_exc_scm_prec"},
+	    {"bandana"_J, "bandana"},
+	    {"av_female_rider_male_walker"_J, "av_female_rider_male_walker"},
+	    {"beat_del_lobo_posse"_J, "beat_del_lobo_posse"},
+	    {"spd_eugenicsproponent"_J, "spd_eugenicsproponent"},
+	    {"cv_sph_dtc_clm_01"_J, "cv_sph_dtc_clm_01"},
+	    {"av_drop_rabbit_table"_J, "av_drop_rabbit_table"},
+	    {"cv_sph_ssn_low_food_01"_J, "cv_sph_ssn_low_food_01"},
+	    {"cv_cc_jhn_08"_J, "cv_cc_jhn_08"},
+	    {"cv_end_anj_04"_J, "cv_end_anj_04"},
+	    {"mob4"_J, "mob4"},
+	    {"rcm_collect_taxidermy1"_J, "rcm_collect_taxidermy1"},
+	    {"rcm_beau_and_penelope12"_J, "rcm_beau_and_penelope12"},
+	    {"av_wagon_music"_J, "av_wagon_music"},
+	    {"av_animal_attack"_J, "av_animal_attack"},
+	    {"beat_moonshine_camp"_J, "beat_moonshine_camp"},
+	    {"cv_cc_dtc_19"_J, "cv_cc_dtc_19"},
+	    {"cv_cc_swn_19"_J, "cv_cc_swn_19"},
+	    {"cv_cc_jav_10"_J, "cv_cc_jav_10"},
+	    {"rcm_strauss21"_J, "rcm_strauss21"},
+	    {"fillet_launch_sp"_J, "fillet_launch_sp"},
+	    {"beat_stranded_rider"_J, "beat_stranded_rider"},
+	    {"av_rats_eat_deer"_J, "av_rats_eat_deer"},
+	    {"cv_wrk_hsh_01"_J, "cv_wrk_hsh_01"},
+	    {"law_office_std"_J, "law_office_std"},
+	    {"cv_cc_prs_14"_J, "cv_cc_prs_14"},
+	    {"cv_cc_kie_04"_J, "cv_cc_kie_04"},
+	    {"odriscolls3_intro"_J, "odriscolls3_intro"},
+	    {"cv_cc_dnh_12"_J, "cv_cc_dnh_12"},
+	    {"av_wolves_playing"_J, "av_wolves_playing"},
+	    {"cv_itm_hsh_01"_J, "cv_itm_hsh_01"},
+	    {"generic_show_mc"_J, "generic_show_mc"},
+	    {"cv_cc_prs_par_01"_J, "cv_cc_prs_par_01"},
+	    {"av_bear_scratch_back"_J, "av_bear_scratch_back"},
+	    {"av_sheep_grazing"_J, "av_sheep_grazing"},
+	    {"cv_cc_dtc_29"_J, "cv_cc_dtc_29"},
+	    {"rcm_crackpot2"_J, "rcm_crackpot2"},
+	    {"herb_yarrow_single"_J, "herb_yarrow_single"},
+	    {"cv_cc_mrb_08"_J, "cv_cc_mrb_08"},
+	    {"grizzlieseast_population"_J, "grizzlieseast_population"},
+	    {"cv_end_cnu_04"_J, "cv_end_cnu_04"},
+	    {"cv_cc_mch_05"_J, "cv_cc_mch_05"},
+	    {"cv_cc_sen_02"_J, "cv_cc_sen_02"},
+	    {"ambush_odr_bridge_prevent"_J, "ambush_odr_bridge_prevent"},
+	    {"ambush_inb_bridge_ambush"_J, "ambush_inb_bridge_ambush"},
+	    {"act_fishing03"_J, "act_fishing03"},
+	    {"vig_playlist_strauss31_post"_J, "vig_playlist_strauss31_post"},
+	    {"spd_bummicky3"_J, "spd_bummicky3"},
+	    {"av_butcher_shared"_J, "av_butcher_shared"},
+	    {"placement_editor_doors"_J, "placement_editor_doors"},
+	    {"cv_itm_jav_01"_J, "cv_itm_jav_01"},
+	    {"gang_enc_lemoyne_church"_J, "gang_enc_lemoyne_church"},
+	    {"cv_cc_len_03"_J, "cv_cc_len_03"},
+	    {"beat_dead_bodies"_J, "beat_dead_bodies"},
+	    {"cv_cc_hsh_09"_J, "cv_cc_hsh_09"},
+	    {"av_animal_carry_ride"_J, "av_animal_carry_ride"},
+	    {"herb_hummingbird_sage"_J, "herb_hummingbird_sage"},
+	    {"mob4_outro"_J, "mob4_outro"},
+	    {"hideout_gaptoothbreach"_J, "hideout_gaptoothbreach"},
+	    {"rcm_calderon22"_J, "rcm_calderon22"},
+	    {"beat_bear_trap"_J, "beat_bear_trap"},
+	    {"finale2_intro"_J, "finale2_intro"},
+	    {"native1"_J, "native1"},
+	    {"catfishjacksons"_J, "catfishjacksons"},
+	    {"scarlettmeadows_population"_J, "scarlettmeadows_population"},
+	    {"law_office_asb"_J, "law_office_asb"},
+	    {"av_swim_wolf_chase_moose"_J, "av_swim_wolf_chase_moose"},
+	    {"cv_cc_mch_16"_J, "cv_cc_mch_16"},
+	    {"cv_cc_dtc_14"_J, "cv_cc_dtc_14"},
+	    {"susan1"_J, "susan1"},
+	    {"rcm_homerob00"_J, "rcm_homerob00"},
+	    {"placement_editor_peds"_J, "placement_editor_peds"},
+	    {"herb_parasol_mushroom"_J, "herb_parasol_mushroom"},
+	    {"cv_cc_mch_24"_J, "cv_cc_mch_24"},
+	    {"cv_cc_dnj_02"_J, "cv_cc_dnj_02"},
+	    {"cv_cc_bll_14"_J, "cv_cc_bll_14"},
+	    {"rcm_collect_exotics6"_J, "rcm_collect_exotics6"},
+	    {"braithwaites2_intro"_J, "braithwaites2_intro"},
+	    {"rcm_mason2"_J, "rcm_mason2"},
+	    {"av_man_stand_at_wagon"_J, "av_man_stand_at_wagon"},
+	    {"cv_cc_hsh_13"_J, "cv_cc_hsh_13"},
+	    {"cv_cc_mch_32"_J, "cv_cc_mch_32"},
+	    {"beat_piss_pot"_J, "beat_piss_pot"},
+	    {"aguasdulces"_J, "aguasdulces"},
+	    {"cv_cc_unc_01"_J, "cv_cc_unc_01"},
+	    {"cv_cc_ssn_08"_J, "cv_cc_ssn_08"},
+	    {"cv_cc_tll_06"_J, "cv_cc_tll_06"},
+	    {"cv_end_unc_01"_J, "cv_end_unc_01"},
+	    {"cv_amb_fire_starter"_J, "cv_amb_fire_starter"},
+	    {"init_all_sp"_J, "init_all_sp"},
+	    {"run_aa_tool"_J, "run_aa_tool"},
+	    {"ambush_odr_lookout_attack"_J, "ambush_odr_lookout_attack"},
+	    {"beat_town_confrontation"_J, "beat_town_confrontation"},
+	    {"cv_cc_kie_01"_J, "cv_cc_kie_01"},
+	    {"cv_cc_mch_13"_J, "cv_cc_mch_13"},
+	    {"spd_mayorofstrawberry1"_J, "spd_mayorofstrawberry1"},
+	    {"herb_alaskan_ginseng"_J, "herb_alaskan_ginseng"},
+	    {"act_calen_fff1"_J, "act_calen_fff1"},
+	    {"shack_missinghusband1_wagon"_J, "shack_missinghusband1_wagon"},
+	    {"cv_cc_jhn_07"_J, "cv_cc_jhn_07"},
+	    {"fishing03_invite"_J, "fishing03_invite"},
+	    {"ambush_exc_wagon_turret"_J, "ambush_exc_wagon_turret"},
+	    {"rcm_the_odd_fellows1"_J, "rcm_the_odd_fellows1"},
+	    {"av_fishing_river"_J, "av_fishing_river"},
+	    {"prisoner_std_1"_J, "prisoner_std_1"},
+	    {"spd_bummicky6"_J, "spd_bummicky6"},
+	    {"av_cat_carry_rat"_J, "av_cat_carry_rat"},
+	    {"feud1_intro"_J, "feud1_intro"},
+	    {"rcm_crackpot1"_J, "rcm_crackpot1"},
+	    {"marston8"_J, "marston8"},
+	    {"spd_poorjoe1"_J, "spd_poorjoe1"},
+	    {"region_law_bloodhound"_J, "region_law_bloodhound"},
+	    {"cv_amb_dog_jump_bed"_J, "cv_amb_dog_jump_bed"},
+	    {"beat_foot_robbery"_J, "beat_foot_robbery"},
+	    {"town_secrets_er_daughter"_J, "town_secrets_er_daughter"},
+	    {"hunting02_invite"_J, "hunting02_invite"},
+	    {"beat_rifle_practice"_J, "beat_rifle_practice"},
+	    {"shack_deadrival"_J, "shack_deadrival"},
+	    {"coachrobberies"_J, "coachrobberies"},
+	    {"loanshark_undertaker"_J, "loanshark_undertaker"},
+	    {"cv_wrk_bll_01"_J, "cv_wrk_bll_01"},
+	    {"spd_joebutler1"_J, "spd_joebutler1"},
+	    {"hunting_zone_fox"_J, "hunting_zone_fox"},
+	    {"campfire_always"_J, "campfire_always"},
+	    {"cv_cc_dnh_11"_J, "cv_cc_dnh_11"},
+	    {"mob5"_J, "mob5"},
+	    {"beat_poisoned"_J, "beat_poisoned"},
+	    {"beat_fleeing_family"_J, "beat_fleeing_family"},
+	    {"cv_cc_swn_14"_J, "cv_cc_swn_14"},
+	    {"law_office_blw"_J, "law_office_blw"},
+	    {"rcm_collect_taxidermy2"_J, "rcm_collect_taxidermy2"},
+	    {"act_gen_dominoes"_J, "act_gen_dominoes"},
+	    {"grizzlieswest_population"_J, "grizzlieswest_population"},
+	    {"cv_amb_butcher_bleed_deer"_J, "cv_amb_butcher_bleed_deer"},
+	    {"rcm_here_kitty_kitty1"_J, "rcm_here_kitty_kitty1"},
+	    {"focus_ped_cycle"_J, "focus_ped_cycle"},
+	    {"cv_end_cnu_05"_J, "cv_end_cnu_05"},
+	    {"cv_cc_dnh_03"_J, "cv_cc_dnh_03"},
+	    {"chezporter"_J, "chezporter"},
+	    {"av_starting_to_rain"_J, "av_starting_to_rain"},
+	    {"frozen_to_death_scenario"_J, "frozen_to_death_scenario"},
+	    {"rcm_chain_gang3"_J, "rcm_chain_gang3"},
+	    {"av_man_sit_read"_J, "av_man_sit_read"},
+	    {"es_clean_stalls_launch"_J, "es_clean_stalls_launch"},
+	    {"cv_cc_ssn_16"_J, "cv_cc_ssn_16"},
+	    {"cv_cc_dtc_18"_J, "cv_cc_dtc_18"},
+	    {"rcm_poisoned_well3"_J, "rcm_poisoned_well3"},
+	    {"cv_cc_mrb_07"_J, "cv_cc_mrb_07"},
+	    {"theatre_ticket_taker"_J, "theatre_ticket_taker"},
+	    {"cv_cc_dnl_01"_J, "cv_cc_dnl_01"},
+	    {"cv_cc_sad_03"_J, "cv_cc_sad_03"},
+	    {"scaleform_option_stepper_test"_J, "scaleform_option_stepper_test"},
+	    {"herb_lady_of_night_orchid"_J, "herb_lady_of_night_orchid"},
+	    {"deadrival"_J, "deadrival"},
+	    {"guama2"_J, "guama2"},
+	    {"grays1_outro"_J, "grays1_outro"},
+	    {"cv_cc_prs_15"_J, "cv_cc_prs_15"},
+	    {"rcm_calderon21"_J, "rcm_calderon21"},
+	    {"clemenscove"_J, "clemenscove"},
+	    {"sean1"_J, "sean1"},
+	    {"cv_cc_am_cnf_05"_J, "cv_cc_am_cnf_05"},
+	    {"cv_itm_mrb_02"_J, "cv_itm_mrb_02"},
+	    {"odriscolls3_outro"_J, "odriscolls3_outro"},
+	    {"camp_beechershope"_J, "camp_beechershope"},
+	    {"loanshark_womancry"_J, "loanshark_womancry"},
+	    {"camp_shadybelle"_J, "camp_shadybelle"},
+	    {"av_ridgeline_native"_J, "av_ridgeline_native"},
+	    {"ambush_odr_hso"_J, "ambush_odr_hso"},
+	    {"cv_cc_sen_03"_J, "cv_cc_sen_03"},
+	    {"beat_lost_drunk"_J, "beat_lost_drunk"},
+	    {"cv_cc_sen_17"_J, "cv_cc_sen_17"},
+	    {"cv_cc_len_02"_J, "cv_cc_len_02"},
+	    {"cv_end_cnu_03"_J, "cv_end_cnu_03"},
+	    {"es_activity_building"_J, "es_activity_building"},
+	    {"av_eagle_catch_rabbit"_J, "av_eagle_catch_rabbit"},
+	    {"cv_cc_hsh_08"_J, "cv_cc_hsh_08"},
+	    {"spd_lillianpowell2"_J, "spd_lillianpowell2"},
+	    {"odriscolls5_intro"_J, "odriscolls5_intro"},
+	    {"armadillo"_J, "armadillo"},
+	    {"cv_cc_prs_03"_J, "cv_cc_prs_03"},
+	    {"cv_itm_prs_01"_J, "cv_itm_prs_01"},
+	    {"vig_playlist_dtc3_post"_J, "vig_playlist_dtc3_post"},
+	    {"shop_photo_studio"_J, "shop_photo_studio"},
+	    {"beat_consequence"_J, "beat_consequence"},
+	    {"rcm_mason4"_J, "rcm_mason4"},
+	    {"cv_cc_bll_15"_J, "cv_cc_bll_15"},
+	    {"gang2_intro"_J, "gang2_intro"},
+	    {"hunting_activity"_J, "hunting_activity"},
+	    {"trelawny1"_J, "trelawny1"},
+	    {"odriscolls3"_J, "odriscolls3"},
+	    {"civilized_region_test"_J, "civilized_region_test"},
+	    {"shack_missinghusband1"_J, "shack_missinghusband1"},
+	    {"show_nbx_flexfight"_J, "show_nbx_flexfight"},
+	    {"beat_drown_murder"_J, "beat_drown_murder"},
+	    {"ped_led_wnt_test"_J, "ped_led_wnt_test"},
+	    {"cv_cc_str_03"_J, "cv_cc_str_03"},
+	    {"doc_coach_robbery_note"_J, "doc_coach_robbery_note"},
+	    {"mudtown3_outro"_J, "mudtown3_outro"},
+	    {"riggsstation"_J, "riggsstation"},
+	    {"cv_wrk_swn_01"_J, "cv_wrk_swn_01"},
+	    {"rcm_mob02"_J, "rcm_mob02"},
+	    {"cv_wrk_bll_02"_J, "cv_wrk_bll_02"},
+	    {"rcm_calderon1"_J, "rcm_calderon1"},
+	    {"cv_cc_ssn_05"_J, "cv_cc_ssn_05"},
+	    {"cv_cc_dtc_15"_J, "cv_cc_dtc_15"},
+	    {"cv_cc_abi_03"_J, "cv_cc_abi_03"},
+	    {"native_son2_intro"_J, "native_son2_intro"},
+	    {"native2_intro"_J, "native2_intro"},
+	    {"native1_outro"_J, "native1_outro"},
+	    {"cv_cc_dtc_17"_J, "cv_cc_dtc_17"},
+	    {"cv_itm_chr_03"_J, "cv_itm_chr_03"},
+	    {"cv_cc_chr_05"_J, "cv_cc_chr_05"},
+	    {"cv_cc_bll_04"_J, "cv_cc_bll_04"},
+	    {"dominoes_launch_sp"_J, "dominoes_launch_sp"},
+	    {"spd_vampire"_J, "spd_vampire"},
+	    {"spd_joebutler2"_J, "spd_joebutler2"},
+	    {"region_law_roadblock_creator"_J, "region_law_roadblock_creator"},
+	    {"act_fishing06"_J, "act_fishing06"},
+	    {"show_nbx_escapenoose"_J, "show_nbx_escapenoose"},
+	    {"combat_test"_J, "combat_test"},
+	    {"av_lumber_pass"_J, "av_lumber_pass"},
+	    {"fishing01_invite"_J, "fishing01_invite"},
+	    {"cv_cc_jhn_06"_J, "cv_cc_jhn_06"},
+	    {"taxidermy_marital"_J, "taxidermy_marital"},
+	    {"mudtown3"_J, "mudtown3"},
+	    {"cv_end_unc_04"_J, "cv_end_unc_04"},
+	    {"av_slow_rider"_J, "av_slow_rider"},
+	    {"herb_chanterelles"_J, "herb_chanterelles"},
+	    {"ambush_odr_bridge_trap"_J, "ambush_odr_bridge_trap"},
+	    {"shop_doctor"_J, "shop_doctor"},
+	    {"cv_cc_mrb_06"_J, "cv_cc_mrb_06"},
+	    {"simple_crafting"_J, "simple_crafting"},
+	    {"ambient_vignette_manager_loader"_J, "ambient_vignette_manager_loader"},
+	    {"cv_cc_dnh_04"_J, "cv_cc_dnh_04"},
+	    {"spd_gavin1"_J, "spd_gavin1"},
+	    {"ui_unit_tests"_J, "ui_unit_tests"},
+	    {"rcm_ride_the_lightning1"_J, "rcm_ride_the_lightning1"},
+	    {"av_seagull_catch_fish"_J, "av_seagull_catch_fish"},
+	    {"spd_andershelgerson"_J, "spd_andershelgerson"},
+	    {"utopia2_outro"_J, "utopia2_outro"},
+	    {"junction_test"_J, "junction_test"},
+	    {"rcm_strauss11"_J, "rcm_strauss11"},
+	    {"spd_philosopher1"_J, "spd_philosopher1"},
+	    {"spd_lillianpowell1"_J, "spd_lillianpowell1"},
+	    {"slavepen"_J, "slavepen"},
+	    {"rcm_pearson1"_J, "rcm_pearson1"},
+	    {"ambush_bnd_sniper_attack"_J, "ambush_bnd_sniper_attack"},
+	    {"cv_cc_swn_13"_J, "cv_cc_swn_13"},
+	    {"scenario_point_finder"_J, "scenario_point_finder"},
+	    {"av_crows_and_eagles_eat_deer"_J, "av_crows_and_eagles_eat_deer"},
+	    {"abigail2_1"_J, "abigail2_1"},
+	    {"fundraiser_inspect"_J, "fundraiser_inspect"},
+	    {"finale1"_J, "finale1"},
+	    {"loanshark_catfish"_J, "loanshark_catfish"},
+	    {"rcm_abigail22"_J, "rcm_abigail22"},
+	    {"placement_editor_gang_camps"_J, "placement_editor_gang_camps"},
+	    {"benedictpoint"_J, "benedictpoint"},
+	    {"shack_gunfight1"_J, "shack_gunfight1"},
+	    {"cv_cc_hsh_12"_J, "cv_cc_hsh_12"},
+	    {"fussar1_intro"_J, "fussar1_intro"},
+	    {"marston7_intro"_J, "marston7_intro"},
+	    {"smuggler2_outro"_J, "smuggler2_outro"},
+	    {"rcm_dutch31"_J, "rcm_dutch31"},
+	    {"braithwaites2"_J, "braithwaites2"},
+	    {"cv_cc_sen_16"_J, "cv_cc_sen_16"},
+	    {"grays1"_J, "grays1"},
+	    {"event_area_appleseed_stg4"_J, "event_area_appleseed_stg4"},
+	    {"fishing_core"_J, "fishing_core"},
+	    {"show_nbx_bigband"_J, "show_nbx_bigband"},
+	    {"cv_cc_am_cnf_04"_J, "cv_cc_am_cnf_04"},
+	    {"beat_town_robbery"_J, "beat_town_robbery"},
+	    {"rcm_here_kitty_kitty3"_J, "rcm_here_kitty_kitty3"},
+	    {"marston2"_J, "marston2"},
+	    {"cv_cc_abi_19"_J, "cv_cc_abi_19"},
+	    {"window_peek_scenario"_J, "window_peek_scenario"},
+	    {"av_boat_placement"_J, "av_boat_placement"},
+	    {"av_wagon_barrel"_J, "av_wagon_barrel"},
+	    {"cv_cc_dnj_03"_J, "cv_cc_dnj_03"},
+	    {"av_wolf_ambush_deer"_J, "av_wolf_ambush_deer"},
+	    {"electric_lantern"_J, "electric_lantern"},
+	    {"cv_end_cnu_02"_J, "cv_end_cnu_02"},
+	    {"loanshark_sellhorse1"_J, "loanshark_sellhorse1"},
+	    {"rcm_creole1"_J, "rcm_creole1"},
+	    {"clemenspoint"_J, "clemenspoint"},
+	    {"av_dead_animal"_J, "av_dead_animal"},
+	    {"benchmark"_J, "benchmark"},
+	    {"hideout_beaverhollow"_J, "hideout_beaverhollow"},
+	    {"caravan_absence_scene"_J, "caravan_absence_scene"},
+	    {"cv_amb_butcher_hang_carcass"_J, "cv_amb_butcher_hang_carcass"},
+	    {"dino_bones"_J, "dino_bones"},
+	    {"shack_beechersb1"_J, "shack_beechersb1"},
+	    {"winter2_outro"_J, "winter2_outro"},
+	    {"spd_sunworshipper1"_J, "spd_sunworshipper1"},
+	    {"herb"_J, "herb"},
+	    {"fishing02_invite"_J, "fishing02_invite"},
+	    {"coachrobberies_gang3_invite"_J, "coachrobberies_gang3_invite"},
+	    {"wallacestation"_J, "wallacestation"},
+	    {"beat_duel_winner"_J, "beat_duel_winner"},
+	    {"show_nbx_snakedance_01"_J, "show_nbx_snakedance_01"},
+	    {"cv_cc_dnh_05"_J, "cv_cc_dnh_05"},
+	    {"mudtown4_intro"_J, "mudtown4_intro"},
+	    {"beat_chain_gang"_J, "beat_chain_gang"},
+	    {"cv_cc_dtc_30"_J, "cv_cc_dtc_30"},
+	    {"cv_cc_str_02"_J, "cv_cc_str_02"},
+	    {"shack_frozenexplorers1"_J, "shack_frozenexplorers1"},
+	    {"av_swimming_animal"_J, "av_swimming_animal"},
+	    {"doc_book"_J, "doc_book"},
+	    {"show_nbx_bigband_02"_J, "show_nbx_bigband_02"},
+	    {"cv_cc_ssn_14"_J, "cv_cc_ssn_14"},
+	    {"finale2"_J, "finale2"},
+	    {"hideout_hangingdogranch"_J, "hideout_hangingdogranch"},
+	    {"shack_lovetriangle1"_J, "shack_lovetriangle1"},
+	    {"abigail2_1_intro"_J, "abigail2_1_intro"},
+	    {"beat_savage_fight"_J, "beat_savage_fight"},
+	    {"cv_cc_bll_08"_J, "cv_cc_bll_08"},
+	    {"cv_cc_mrb_05"_J, "cv_cc_mrb_05"},
+	    {"cv_mus_swn_01"_J, "cv_mus_swn_01"},
+	    {"shop_hotel"_J, "shop_hotel"},
+	    {"cv_cc_dnh_07"_J, "cv_cc_dnh_07"},
+	    {"shack_happyfamily1"_J, "shack_happyfamily1"},
+	    {"cv_cc_mch_11"_J, "cv_cc_mch_11"},
+	    {"cv_cc_sad_01"_J, "cv_cc_sad_01"},
+	    {"cv_cc_kar_11"_J, "cv_cc_kar_11"},
+	    {"hunting_zone_bear_legendary"_J, "hunting_zone_bear_legendary"},
+	    {"cv_cc_ssnunc_01"_J, "cv_cc_ssnunc_01"},
+	    {"cv_cc_abi_01"_J, "cv_cc_abi_01"},
+	    {"ambush_odr_road_prec"_J, "ambush_odr_road_prec"},
+	    {"region_town_lockdown_generic"_J, "region_town_lockdown_generic"},
+	    {"sadie3"_J, "sadie3"},
+	    {"re_murder_camp_note"_J, "re_murder_camp_note"},
+	    {"rcm_abigail11"_J, "rcm_abigail11"},
+	    {"beat_show_off"_J, "beat_show_off"},
+	    {"init_global_block_shared"_J, "init_global_block_shared"},
+	    {"vig_playlist_colter"_J, "vig_playlist_colter"},
+	    {"mudtown5_intro"_J, "mudtown5_intro"},
+	    {"binoculars"_J, "binoculars"},
+	    {"rcm_beechers11"_J, "rcm_beechers11"},
 	    {"rcm_edith_down22"_J, "rcm_edith_down22"},
-	    {"rcm_evelyn_miller1"_J, "rcm_evelyn_miller1"},
-	    {"rcm_evelyn_miller2"_J, "rcm_evelyn_miller2"},
-	    {"rcm_evelyn_miller3"_J, "rcm_evelyn_miller3"},
-	    {"rcm_evelyn_miller4"_J, "rcm_evelyn_miller4"},
-	    {"rcm_evelyn_miller5"_J, "rcm_evelyn_miller5"},
-	    {"rcm_exconfed11"_J, "rcm_exconfed11"},
-	    {"rcm_for_my_art1"_J, "rcm_for_my_art1"},
-	    {"rcm_for_my_art2"_J, "rcm_for_my_art2"},
-	    {"rcm_for_my_art3"_J, "rcm_for_my_art3"},
-	    {"rcm_for_my_art4"_J, "rcm_for_my_art4"},
-	    {"rcm_fundraiser"_J, "rcm_fundraiser"},
-	    {"rcm_gang01"_J, "rcm_gang01"},
-	    {"rcm_gang02"_J, "rcm_gang02"},
-	    {"rcm_gunslinger1_1"_J, "rcm_gunslinger1_1"},
-	    {"rcm_gunslinger1_2"_J, "rcm_gunslinger1_2"},
-	    {"rcm_gunslinger2_1"_J, "rcm_gunslinger2_1"},
-	    {"rcm_gunslinger3_1"_J, "rcm_gunslinger3_1"},
-	    {"rcm_gunslinger5_1"_J, "rcm_gunslinger5_1"},
-	    {"rcm_herbalist_camp"_J, "rcm_herbalist_camp"},
-	    {"rcm_here_kitty_kitty1"_J, "rcm_here_kitty_kitty1"},
+	    {"winter2_intro"_J, "winter2_intro"},
+	    {"ambush_inb_road_attack"_J, "ambush_inb_road_attack"},
+	    {"sadie2_intro"_J, "sadie2_intro"},
+	    {"braithwaites1"_J, "braithwaites1"},
+	    {"vig_playlist_hosea_focus"_J, "vig_playlist_hosea_focus"},
+	    {"av_alligator_boar_leg"_J, "av_alligator_boar_leg"},
+	    {"smuggler2"_J, "smuggler2"},
+	    {"spd_timothydonahue2"_J, "spd_timothydonahue2"},
+	    {"sadie4_intro"_J, "sadie4_intro"},
+	    {"fussar1_outro"_J, "fussar1_outro"},
+	    {"herb_violet_snowdrop"_J, "herb_violet_snowdrop"},
+	    {"saloon_dining"_J, "saloon_dining"},
+	    {"cv_wnt_swn_18"_J, "cv_wnt_swn_18"},
+	    {"hunting_zone_pronghorn"_J, "hunting_zone_pronghorn"},
 	    {"rcm_here_kitty_kitty2"_J, "rcm_here_kitty_kitty2"},
-	    {"rcm_here_kitty_kitty3"_J, "rcm_here_kitty_kitty3"},
-	    {"rcm_here_kitty_kitty4"_J, "rcm_here_kitty_kitty4"},
-	    {"rcm_here_kitty_kitty5"_J, "rcm_here_kitty_kitty5"},
-	    {"rcm_homerob00"_J, "rcm_homerob00"},
-	    {"rcm_homerob01"_J, "rcm_homerob01"},
-	    {"rcm_jack2"_J, "rcm_jack2"},
-	    {"rcm_mary01"_J, "rcm_mary01"},
-	    {"rcm_mary02"_J, "rcm_mary02"},
-	    {"rcm_mary31"_J, "rcm_mary31"},
-	    {"rcm_marybeth1"_J, "rcm_marybeth1"},
-	    {"rcm_mason1"_J, "rcm_mason1"},
-	    {"rcm_mason2"_J, "rcm_mason2"},
-	    {"rcm_mason3"_J, "rcm_mason3"},
-	    {"rcm_mason4"_J, "rcm_mason4"},
-	    {"rcm_mason5"_J, "rcm_mason5"},
-	    {"rcm_mob01"_J, "rcm_mob01"},
-	    {"rcm_mob02"_J, "rcm_mob02"},
-	    {"rcm_monroe11"_J, "rcm_monroe11"},
-	    {"rcm_mr_mayor1"_J, "rcm_mr_mayor1"},
-	    {"rcm_mr_mayor2"_J, "rcm_mr_mayor2"},
-	    {"rcm_mr_mayor3"_J, "rcm_mr_mayor3"},
-	    {"rcm_mudtown3_1"_J, "rcm_mudtown3_1"},
-	    {"rcm_mudtown3_2"_J, "rcm_mudtown3_2"},
+	    {"cv_cc_swn_16"_J, "cv_cc_swn_16"},
+	    {"cv_cc_jav_01"_J, "cv_cc_jav_01"},
+	    {"marston1"_J, "marston1"},
+	    {"act_caunc_rustling"_J, "act_caunc_rustling"},
+	    {"shop_trapper"_J, "shop_trapper"},
+	    {"gaptoothridge_population"_J, "gaptoothridge_population"},
+	    {"hunting_zone_moose"_J, "hunting_zone_moose"},
+	    {"mountainman"_J, "mountainman"},
+	    {"mudtown1_outro"_J, "mudtown1_outro"},
+	    {"mob1_intro"_J, "mob1_intro"},
+	    {"cv_cc_mch_02"_J, "cv_cc_mch_02"},
+	    {"cv_cc_hsh_15"_J, "cv_cc_hsh_15"},
+	    {"beat_rat_infestation"_J, "beat_rat_infestation"},
+	    {"marston6_intro"_J, "marston6_intro"},
+	    {"grays2"_J, "grays2"},
+	    {"cv_cc_bll_13"_J, "cv_cc_bll_13"},
+	    {"event_area_appleseed_stg3"_J, "event_area_appleseed_stg3"},
+	    {"macleanshouse"_J, "macleanshouse"},
+	    {"campfire"_J, "campfire"},
 	    {"rcm_mudtown3_3"_J, "rcm_mudtown3_3"},
-	    {"rcm_native1"_J, "rcm_native1"},
-	    {"rcm_native2"_J, "rcm_native2"},
-	    {"rcm_oh_brother1"_J, "rcm_oh_brother1"},
-	    {"rcm_oh_brother2"_J, "rcm_oh_brother2"},
-	    {"rcm_oh_brother3"_J, "rcm_oh_brother3"},
-	    {"rcm_pearson1"_J, "rcm_pearson1"},
-	    {"rcm_pearson1_outro"_J, "rcm_pearson1_outro"},
-	    {"rcm_poisoned_well1"_J, "rcm_poisoned_well1"},
-	    {"rcm_poisoned_well2"_J, "rcm_poisoned_well2"},
-	    {"rcm_poisoned_well3"_J, "rcm_poisoned_well3"},
-	    {"rcm_poisoned_well4"_J, "rcm_poisoned_well4"},
-	    {"rcm_poisoned_well5"_J, "rcm_poisoned_well5"},
-	    {"rcm_rains_fall1"_J, "rcm_rains_fall1"},
-	    {"rcm_ride_the_lightning1"_J, "rcm_ride_the_lightning1"},
-	    {"rcm_ride_the_lightning2"_J, "rcm_ride_the_lightning2"},
-	    {"rcm_ride_the_lightning3"_J, "rcm_ride_the_lightning3"},
-	    {"rcm_ride_the_lightning4"_J, "rcm_ride_the_lightning4"},
-	    {"rcm_ride_the_lightning5"_J, "rcm_ride_the_lightning5"},
-	    {"rcm_ride_the_lightning6"_J, "rcm_ride_the_lightning6"},
-	    {"rcm_ride_the_lightning7"_J, "rcm_ride_the_lightning7"},
+	    {"sleeping_scenario"_J, "sleeping_scenario"},
+	    {"campfire_gang_launch"_J, "campfire_gang_launch"},
+	    {"beat_approach"_J, "beat_approach"},
+	    {"rcm_bh_blackwater_hunt"_J, "rcm_bh_blackwater_hunt"},
+	    {"armoire_corpse_scenario"_J, "armoire_corpse_scenario"},
+	    {"tithe_scenario"_J, "tithe_scenario"},
+	    {"rcm_crackpot3"_J, "rcm_crackpot3"},
+	    {"cv_cc_hsh_18"_J, "cv_cc_hsh_18"},
+	    {"beat_intimidation_tactics"_J, "beat_intimidation_tactics"},
+	    {"spd_thomasdowne1"_J, "spd_thomasdowne1"},
+	    {"discoverable_generic_corpse"_J, "discoverable_generic_corpse"},
+	    {"cv_end_unj_01"_J, "cv_end_unj_01"},
+	    {"cv_end_cnu_01"_J, "cv_end_cnu_01"},
+	    {"debug_fast_travel"_J, "debug_fast_travel"},
+	    {"shop_gunsmith"_J, "shop_gunsmith"},
+	    {"braithwaitemanor"_J, "braithwaitemanor"},
+	    {"cv_end_chr_03"_J, "cv_end_chr_03"},
+	    {"av_macfarlane_farmer"_J, "av_macfarlane_farmer"},
+	    {"discoverable_generic_carriable"_J, "discoverable_generic_carriable"},
+	    {"town_secrets_sd_trelawny"_J, "town_secrets_sd_trelawny"},
+	    {"cv_amb_light_smoke"_J, "cv_amb_light_smoke"},
+	    {"shooting_range"_J, "shooting_range"},
+	    {"cv_cc_len_07"_J, "cv_cc_len_07"},
+	    {"av_bear_run_catch_fish"_J, "av_bear_run_catch_fish"},
+	    {"rcm_bounty_duel1"_J, "rcm_bounty_duel1"},
+	    {"discoverable_geyser"_J, "discoverable_geyser"},
+	    {"adlerranch"_J, "adlerranch"},
+	    {"generic_ghosttown"_J, "generic_ghosttown"},
+	    {"herb_moccasin_flower_orchid"_J, "herb_moccasin_flower_orchid"},
+	    {"cv_cc_jck_02"_J, "cv_cc_jck_02"},
+	    {"beat_herbalist_camp"_J, "beat_herbalist_camp"},
+	    {"hunting_zone_beaver"_J, "hunting_zone_beaver"},
+	    {"herb_bay_bolete"_J, "herb_bay_bolete"},
+	    {"spd_timothydonahue1"_J, "spd_timothydonahue1"},
+	    {"hunting_zone_big_horn_ram"_J, "hunting_zone_big_horn_ram"},
+	    {"cv_cc_ssn_13"_J, "cv_cc_ssn_13"},
+	    {"hennigansstead_population"_J, "hennigansstead_population"},
+	    {"cv_cc_sen_13"_J, "cv_cc_sen_13"},
+	    {"mary1_intro"_J, "mary1_intro"},
+	    {"cv_cc_sen_15"_J, "cv_cc_sen_15"},
+	    {"cv_cc_mrb_04"_J, "cv_cc_mrb_04"},
+	    {"coachrobberies_gang2_invite"_J, "coachrobberies_gang2_invite"},
+	    {"hunting_zone_elk"_J, "hunting_zone_elk"},
+	    {"rcm_down1"_J, "rcm_down1"},
+	    {"cv_cc_ssn_07"_J, "cv_cc_ssn_07"},
+	    {"cv_cc_mch_12"_J, "cv_cc_mch_12"},
+	    {"fussar2_intro"_J, "fussar2_intro"},
+	    {"camera_item"_J, "camera_item"},
+	    {"show_nbx_snakedance_02"_J, "show_nbx_snakedance_02"},
+	    {"crayfish_search"_J, "crayfish_search"},
+	    {"discoverable_alchemist_house"_J, "discoverable_alchemist_house"},
+	    {"cv_cc_dnh_06"_J, "cv_cc_dnh_06"},
+	    {"mudtown2_intro"_J, "mudtown2_intro"},
+	    {"hunting_zone_cougar"_J, "hunting_zone_cougar"},
+	    {"law_office_rho"_J, "law_office_rho"},
+	    {"spd_crackpotrobot"_J, "spd_crackpotrobot"},
 	    {"rcm_sadie11"_J, "rcm_sadie11"},
-	    {"rcm_serial_killer1"_J, "rcm_serial_killer1"},
-	    {"rcm_slave_catcher1"_J, "rcm_slave_catcher1"},
-	    {"rcm_slave_catcher2"_J, "rcm_slave_catcher2"},
-	    {"rcm_strauss11"_J, "rcm_strauss11"},
-	    {"rcm_strauss21"_J, "rcm_strauss21"},
-	    {"rcm_strauss31"_J, "rcm_strauss31"},
-	    {"rcm_strauss32"_J, "rcm_strauss32"},
-	    {"rcm_strauss33"_J, "rcm_strauss33"},
-	    {"rcm_the_odd_fellows1"_J, "rcm_the_odd_fellows1"},
-	    {"rcm_the_odd_fellows2"_J, "rcm_the_odd_fellows2"},
-	    {"rcm_tilly1"_J, "rcm_tilly1"},
-	    {"rcm_treasure_hunter"_J, "rcm_treasure_hunter"},
-	    {"rcm_war_veteran1"_J, "rcm_war_veteran1"},
-	    {"rcm_war_veteran2"_J, "rcm_war_veteran2"},
-	    {"rcm_war_veteran3"_J, "rcm_war_veteran3"},
-	    {"rcm_war_veteran4"_J, "rcm_war_veteran4"},
-	    {"region_law_bloodhound"_J, "region_law_bloodhound"},
-	    {"region_law_guama_fussar"_J, "region_law_guama_fussar"},
-	    {"region_law_patrol_creator"_J, "region_law_patrol_creator"},
-	    {"region_law_rho_law_swarm"_J, "region_law_rho_law_swarm"},
-	    {"region_law_roadblock_creator"_J, "region_law_roadblock_creator"},
-	    {"region_law_town_mob"_J, "region_law_town_mob"},
-	    {"region_law_val_belltower_sniper"_J, "region_law_val_belltower_sniper"},
-	    {"region_law_w_eliz_pinks"_J, "region_law_w_eliz_pinks"},
-	    {"region_town_lockdown_generic"_J, "region_town_lockdown_generic"},
-	    {"register_core"_J, "register_core"},
-	    {"register_scenario"_J, "register_scenario"},
-	    {"respawn_dump_body"_J, "respawn_dump_body"},
-	    {"respawn_layout_editor"_J, "respawn_layout_editor"},
-	    {"respawn_persistence"_J, "respawn_persistence"},
-	    {"respond_parcel"_J, "respond_parcel"},
-	    {"reverend1"_J, "reverend1"},
-	    {"reverend1_intro"_J, "reverend1_intro"},
-	    {"reverend1_outro"_J, "reverend1_outro"},
-	    {"re_murder_camp_note"_J, "re_murder_camp_note"},
-	    {"rhodes"_J, "rhodes"},
-	    {"rhodes_donkeys"_J, "rhodes_donkeys"},
+	    {"shop_post_office"_J, "shop_post_office"},
+	    {"rcm_chain_gang4"_J, "rcm_chain_gang4"},
+	    {"cv_cc_swn_06"_J, "cv_cc_swn_06"},
+	    {"rcm_poisoned_well2"_J, "rcm_poisoned_well2"},
+	    {"cv_cc_prs_13"_J, "cv_cc_prs_13"},
+	    {"undertaker"_J, "undertaker"},
+	    {"av_cross_road"_J, "av_cross_road"},
+	    {"rare_fish"_J, "rare_fish"},
+	    {"beat_duel_boaster"_J, "beat_duel_boaster"},
+	    {"cv_cc_jav_08"_J, "cv_cc_jav_08"},
+	    {"gang3_intro"_J, "gang3_intro"},
+	    {"beat_town_widow"_J, "beat_town_widow"},
+	    {"av_bear_intimidate_wolf"_J, "av_bear_intimidate_wolf"},
+	    {"av_buffalo_vs_buffalo"_J, "av_buffalo_vs_buffalo"},
+	    {"beat_lone_prisoner"_J, "beat_lone_prisoner"},
 	    {"ridgewoodfarm"_J, "ridgewoodfarm"},
-	    {"riggsstation"_J, "riggsstation"},
-	    {"rileyscharge"_J, "rileyscharge"},
+	    {"cv_cc_kar_10"_J, "cv_cc_kar_10"},
+	    {"av_owl_catch_rat"_J, "av_owl_catch_rat"},
+	    {"cv_cc_mch_21"_J, "cv_cc_mch_21"},
+	    {"shack_item_loot_scenario"_J, "shack_item_loot_scenario"},
+	    {"rcm_mason1"_J, "rcm_mason1"},
+	    {"cv_cc_dtc_31"_J, "cv_cc_dtc_31"},
+	    {"cv_cc_mll_01"_J, "cv_cc_mll_01"},
+	    {"ransack_looting"_J, "ransack_looting"},
+	    {"mob3_outro"_J, "mob3_outro"},
+	    {"satchel"_J, "satchel"},
+	    {"startup_clip"_J, "startup_clip"},
+	});
+
+	inline constexpr auto g_MpScriptNames = MakeConstFlatMap<joaat_t, const char*>({
+	    {"herb_wild_flower_chocolate_daisy"_J, "herb_wild_flower_chocolate_daisy"},
+	    {"annesburg"_J, "annesburg"},
+	    {"metaped_editor"_J, "metaped_editor"},
+	    {"shop_theater"_J, "shop_theater"},
+	    {"show_mp_nbx_oddfellows"_J, "show_mp_nbx_oddfellows"},
+	    {"pause_menu"_J, "pause_menu"},
+	    {"fme_archery"_J, "fme_archery"},
+	    {"coffee_drinking"_J, "coffee_drinking"},
+	    {"show_mp_nbx_bigband_01"_J, "show_mp_nbx_bigband_01"},
+	    {"bigvalleyomj"_J, "bigvalleyomj"},
+	    {"medium_update"_J, "medium_update"},
+	    {"region_law_val_belltower_sniper"_J, "region_law_val_belltower_sniper"},
+	    {"frozenexplorers"_J, "frozenexplorers"},
+	    {"junction_test_startup"_J, "junction_test_startup"},
+	    {"hub_offers"_J, "hub_offers"},
+	    {"deadsettler"_J, "deadsettler"},
+	    {"sf_playground_script"_J, "sf_playground_script"},
+	    {"player_horse"_J, "player_horse"},
+	    {"init_global_block_mm_grid"_J, "init_global_block_mm_grid"},
+	    {"fme_archery_offline"_J, "fme_archery_offline"},
+	    {"herb_queens_orchid"_J, "herb_queens_orchid"},
+	    {"shop_camp_butchertable"_J, "shop_camp_butchertable"},
+	    {"paintedsky"_J, "paintedsky"},
+	    {"herb_yarrow"_J, "herb_yarrow"},
+	    {"test_startup"_J, "test_startup"},
+	    {"hanging_carcass"_J, "hanging_carcass"},
+	    {"bigvalleytravelsales"_J, "bigvalleytravelsales"},
+	    {"generic_document_inspection"_J, "generic_document_inspection"},
+	    {"debug_metapeditor"_J, "debug_metapeditor"},
+	    {"test_startup2"_J, "test_startup2"},
+	    {"vanhorntradingpost"_J, "vanhorntradingpost"},
+	    {"herb_wild_flower_texas_blue_bonnet"_J, "herb_wild_flower_texas_blue_bonnet"},
+	    {"herb_evergreen_huckleberry"_J, "herb_evergreen_huckleberry"},
+	    {"net_camp"_J, "net_camp"},
+	    {"net_arrowheads"_J, "net_arrowheads"},
+	    {"dinolady"_J, "dinolady"},
+	    {"debug_metapeditor_custom_launch"_J, "debug_metapeditor_custom_launch"},
+	    {"herb_wild_flower_rhubarb"_J, "herb_wild_flower_rhubarb"},
+	    {"init_global_block_softsave"_J, "init_global_block_softsave"},
+	    {"herb_wild_flower_wisteria"_J, "herb_wild_flower_wisteria"},
+	    {"show_mp_nbx_bulletcatcher"_J, "show_mp_nbx_bulletcatcher"},
+	    {"nb_stalking_hunter"_J, "nb_stalking_hunter"},
+	    {"berylsdream"_J, "berylsdream"},
+	    {"xml_menus"_J, "xml_menus"},
+	    {"macfarlanesranch"_J, "macfarlanesranch"},
+	    {"net_rolling_playlist"_J, "net_rolling_playlist"},
+	    {"net_entity_brain"_J, "net_entity_brain"},
+	    {"lagras"_J, "lagras"},
+	    {"la_bear"_J, "la_bear"},
+	    {"herb_rams_head"_J, "herb_rams_head"},
+	    {"strawberry"_J, "strawberry"},
+	    {"scaleform_minigame_test"_J, "scaleform_minigame_test"},
+	    {"herb_creeping_thyme"_J, "herb_creeping_thyme"},
+	    {"butchercreek"_J, "butchercreek"},
+	    {"gfh_campworks"_J, "gfh_campworks"},
+	    {"happyfamily"_J, "happyfamily"},
+	    {"region_law_town_mob"_J, "region_law_town_mob"},
+	    {"generic_item_writing_on_back"_J, "generic_item_writing_on_back"},
+	    {"valentine"_J, "valentine"},
+	    {"horseshoeoverlook"_J, "horseshoeoverlook"},
+	    {"init_global_block_transition"_J, "init_global_block_transition"},
 	    {"riobravo_population"_J, "riobravo_population"},
-	    {"roanokeridge_population"_J, "roanokeridge_population"},
-	    {"roanoketrapper"_J, "roanoketrapper"},
-	    {"rob_register"_J, "rob_register"},
-	    {"rockyseven"_J, "rockyseven"},
-	    {"rock_carvings"_J, "rock_carvings"},
-	    {"run_aa_tool"_J, "run_aa_tool"},
-	    {"sadie2"_J, "sadie2"},
-	    {"sadie2_intro"_J, "sadie2_intro"},
-	    {"sadie3"_J, "sadie3"},
-	    {"sadie3_intro"_J, "sadie3_intro"},
-	    {"sadie4"_J, "sadie4"},
-	    {"sadie4_intro"_J, "sadie4_intro"},
-	    {"sadie4_outro"_J, "sadie4_outro"},
-	    {"sadie5"_J, "sadie5"},
-	    {"sadie5_intro"_J, "sadie5_intro"},
-	    {"sadie5_outro"_J, "sadie5_outro"},
-	    {"saintdenis"_J, "saintdenis"},
-	    {"saint_denis1"_J, "saint_denis1"},
-	    {"saint_denis1_intro"_J, "saint_denis1_intro"},
-	    {"saloon1"_J, "saloon1"},
-	    {"saloon1_intro"_J, "saloon1_intro"},
-	    {"saloon1_outro"_J, "saloon1_outro"},
+	    {"net_msm_networked"_J, "net_msm_networked"},
+	    {"generic_show_mp_manager"_J, "generic_show_mp_manager"},
+	    {"init_global_block_mc_subsys"_J, "init_global_block_mc_subsys"},
+	    {"placement_editor_vehicles"_J, "placement_editor_vehicles"},
+	    {"fme_hot_property_offline"_J, "fme_hot_property_offline"},
+	    {"security_door_peek_scenario"_J, "security_door_peek_scenario"},
+	    {"orangeplantation"_J, "orangeplantation"},
+	    {"nb_suspension_trap"_J, "nb_suspension_trap"},
+	    {"heartland_population"_J, "heartland_population"},
+	    {"money_scenario"_J, "money_scenario"},
+	    {"herb_wild_flower_agarita"_J, "herb_wild_flower_agarita"},
+	    {"net_stable_mount"_J, "net_stable_mount"},
 	    {"saloon_conversations"_J, "saloon_conversations"},
-	    {"saloon_dining"_J, "saloon_dining"},
-	    {"satchel"_J, "satchel"},
-	    {"satchel_ui_event_handler"_J, "satchel_ui_event_handler"},
-	    {"save_menu_ui_event_handler"_J, "save_menu_ui_event_handler"},
+	    {"herb_black_currant"_J, "herb_black_currant"},
+	    {"la_panther"_J, "la_panther"},
+	    {"net_bird_egg_eagle"_J, "net_bird_egg_eagle"},
+	    {"net_train"_J, "net_train"},
+	    {"net_ace_thread_manager"_J, "net_ace_thread_manager"},
+	    {"fme_protect_legendary_animal"_J, "fme_protect_legendary_animal"},
+	    {"shop_horse_shop"_J, "shop_horse_shop"},
+	    {"rhodes_donkeys"_J, "rhodes_donkeys"},
+	    {"larnedsod"_J, "larnedsod"},
+	    {"la_coyote"_J, "la_coyote"},
+	    {"fme_king_of_the_rails"_J, "fme_king_of_the_rails"},
+	    {"fme_king_of_the_castle_offline"_J, "fme_king_of_the_castle_offline"},
+	    {"herb_milkweed_single"_J, "herb_milkweed_single"},
+	    {"generic_weight_control_item"_J, "generic_weight_control_item"},
+	    {"init_global_block_ugc_transition"_J, "init_global_block_ugc_transition"},
+	    {"herb_common_bulrush"_J, "herb_common_bulrush"},
+	    {"fme_wildlife_photographer"_J, "fme_wildlife_photographer"},
+	    {"net_bird_egg_egret"_J, "net_bird_egg_egret"},
+	    {"emeraldranch"_J, "emeraldranch"},
+	    {"physics_perf_test"_J, "physics_perf_test"},
+	    {"placement_editor_props"_J, "placement_editor_props"},
+	    {"la_alligator"_J, "la_alligator"},
+	    {"herb_wild_flower_blood_flower"_J, "herb_wild_flower_blood_flower"},
+	    {"generic_show_mc_mp"_J, "generic_show_mc_mp"},
+	    {"field_guide"_J, "field_guide"},
+	    {"mystery_item_location"_J, "mystery_item_location"},
+	    {"ransack_moneybag"_J, "ransack_moneybag"},
+	    {"saintdenis"_J, "saintdenis"},
+	    {"herb_ghost_orchid"_J, "herb_ghost_orchid"},
+	    {"colter"_J, "colter"},
+	    {"net_pickup_collectibles_jewelry"_J, "net_pickup_collectibles_jewelry"},
 	    {"scaleform_dynamic_items_creation_test"_J, "scaleform_dynamic_items_creation_test"},
-	    {"scaleform_font_test"_J, "scaleform_font_test"},
-	    {"scaleform_graphic_test"_J, "scaleform_graphic_test"},
-	    {"scaleform_lobby_menu_demo"_J, "scaleform_lobby_menu_demo"},
-	    {"scaleform_minigame_test"_J, "scaleform_minigame_test"},
-	    {"scaleform_option_stepper_test"_J, "scaleform_option_stepper_test"},
+	    {"luckyscabin"_J, "luckyscabin"},
+	    {"lonniesshack"_J, "lonniesshack"},
+	    {"herb_red_raspberry"_J, "herb_red_raspberry"},
+	    {"init_global_block_profiler"_J, "init_global_block_profiler"},
+	    {"net_mc_vs_mission_intro"_J, "net_mc_vs_mission_intro"},
 	    {"scaleform_pause_menu_demo"_J, "scaleform_pause_menu_demo"},
-	    {"scaleform_ui_test"_J, "scaleform_ui_test"},
-	    {"scarletthorseshop"_J, "scarletthorseshop"},
-	    {"scarlettmeadows_population"_J, "scarlettmeadows_population"},
-	    {"scenario_point_finder"_J, "scenario_point_finder"},
-	    {"scenario_vig_launcher"_J, "scenario_vig_launcher"},
-	    {"sean1"_J, "sean1"},
-	    {"sean1_intro"_J, "sean1_intro"},
-	    {"security_door_knock_scenario"_J, "security_door_knock_scenario"},
-	    {"security_door_peek_scenario"_J, "security_door_peek_scenario"},
-	    {"serendipity"_J, "serendipity"},
-	    {"serialkiller"_J, "serialkiller"},
-	    {"sf_playground_script"_J, "sf_playground_script"},
-	    {"shack_beechersa1"_J, "shack_beechersa1"},
-	    {"shack_beechersb1"_J, "shack_beechersb1"},
-	    {"shack_beechersc1"_J, "shack_beechersc1"},
-	    {"shack_civilwarbride1"_J, "shack_civilwarbride1"},
-	    {"shack_deadrival"_J, "shack_deadrival"},
-	    {"shack_deadsettler"_J, "shack_deadsettler"},
-	    {"shack_frozenexplorers1"_J, "shack_frozenexplorers1"},
-	    {"shack_gunfight1"_J, "shack_gunfight1"},
-	    {"shack_happyfamily1"_J, "shack_happyfamily1"},
-	    {"shack_hungrybear1"_J, "shack_hungrybear1"},
-	    {"shack_item_loot_scenario"_J, "shack_item_loot_scenario"},
-	    {"shack_loonycult1"_J, "shack_loonycult1"},
-	    {"shack_lovetriangle1"_J, "shack_lovetriangle1"},
-	    {"shack_missinghusband1"_J, "shack_missinghusband1"},
-	    {"shack_missinghusband1_wagon"_J, "shack_missinghusband1_wagon"},
-	    {"shack_mountainman1"_J, "shack_mountainman1"},
-	    {"shack_ontherun1"_J, "shack_ontherun1"},
-	    {"shack_slavepen1"_J, "shack_slavepen1"},
-	    {"shack_starvingchildren"_J, "shack_starvingchildren"},
-	    {"shack_undergroundrailroad"_J, "shack_undergroundrailroad"},
-	    {"shadybelle"_J, "shadybelle"},
 	    {"shepherdsrise"_J, "shepherdsrise"},
-	    {"shocking_beats"_J, "shocking_beats"},
-	    {"shooting_range"_J, "shooting_range"},
-	    {"shoprobberies"_J, "shoprobberies"},
-	    {"shoprobberies_dynamic"_J, "shoprobberies_dynamic"},
-	    {"shop_bait"_J, "shop_bait"},
-	    {"shop_barber"_J, "shop_barber"},
-	    {"shop_butcher"_J, "shop_butcher"},
-	    {"shop_doctor"_J, "shop_doctor"},
-	    {"shop_dynamic"_J, "shop_dynamic"},
+	    {"gfh_door_tool"_J, "gfh_door_tool"},
+	    {"init_global_block_mc_race"_J, "init_global_block_mc_race"},
+	    {"pronghornranch"_J, "pronghornranch"},
+	    {"show_mp_nbx_sworddancer"_J, "show_mp_nbx_sworddancer"},
+	    {"region_law_patrol_creator"_J, "region_law_patrol_creator"},
+	    {"net_main_tlg_online"_J, "net_main_tlg_online"},
+	    {"shop_travelling_salesman"_J, "shop_travelling_salesman"},
+	    {"net_advanced_camera"_J, "net_advanced_camera"},
+	    {"mp_intro"_J, "mp_intro"},
+	    {"net_session_split"_J, "net_session_split"},
+	    {"swansonstation"_J, "swansonstation"},
+	    {"net_gun_for_hire_online"_J, "net_gun_for_hire_online"},
+	    {"la_elk"_J, "la_elk"},
+	    {"nb_beggar"_J, "nb_beggar"},
+	    {"herb_wild_flower_bitterweed"_J, "herb_wild_flower_bitterweed"},
+	    {"herb_wintergreen_berry"_J, "herb_wintergreen_berry"},
+	    {"herb_burdock_root_single"_J, "herb_burdock_root_single"},
+	    {"herb_night_scented_orchid"_J, "herb_night_scented_orchid"},
+	    {"placement_editor_prop_sets"_J, "placement_editor_prop_sets"},
+	    {"beechersc"_J, "beechersc"},
+	    {"player_camp"_J, "player_camp"},
+	    {"smoketest_second_screen"_J, "smoketest_second_screen"},
+	    {"blackbalsamrise"_J, "blackbalsamrise"},
+	    {"legendary_animal_map"_J, "legendary_animal_map"},
+	    {"herb_red_sage"_J, "herb_red_sage"},
+	    {"gunfight"_J, "gunfight"},
+	    {"net_background"_J, "net_background"},
+	    {"init_global_block_creator"_J, "init_global_block_creator"},
+	    {"herb_golden_currant"_J, "herb_golden_currant"},
+	    {"herb_english_mace"_J, "herb_english_mace"},
+	    {"shop_moonshine_still"_J, "shop_moonshine_still"},
+	    {"prop_drop"_J, "prop_drop"},
+	    {"net_train_manager"_J, "net_train_manager"},
+	    {"startup_mp"_J, "startup_mp"},
+	    {"blackwater"_J, "blackwater"},
+	    {"collectors_bag"_J, "collectors_bag"},
+	    {"item_bait_predator"_J, "item_bait_predator"},
+	    {"metaped_clothing_tool_outfit_testing"_J, "metaped_clothing_tool_outfit_testing"},
+	    {"error_listener_gc"_J, "error_listener_gc"},
+	    {"net_crew_manager"_J, "net_crew_manager"},
+	    {"herbal_plants"_J, "herbal_plants"},
+	    {"herb_clamshell_orchid"_J, "herb_clamshell_orchid"},
+	    {"generic_weapon_item"_J, "generic_weapon_item"},
+	    {"herb_vanilla_flower"_J, "herb_vanilla_flower"},
+	    {"fme_escaped_convicts"_J, "fme_escaped_convicts"},
+	    {"net_pickup_collectibles_heirlooms"_J, "net_pickup_collectibles_heirlooms"},
+	    {"startup"_J, "startup"},
+	    {"net_fake_tg_p"_J, "net_fake_tg_p"},
+	    {"shop_camp_lockbox"_J, "shop_camp_lockbox"},
+	    {"net_bird_egg_heron"_J, "net_bird_egg_heron"},
+	    {"placement_editor_volumes"_J, "placement_editor_volumes"},
+	    {"shop_tailor"_J, "shop_tailor"},
+	    {"rockyseven"_J, "rockyseven"},
+	    {"broom_scenario"_J, "broom_scenario"},
+	    {"placement_editor_weapons"_J, "placement_editor_weapons"},
+	    {"fme_animal_tagging_offline"_J, "fme_animal_tagging_offline"},
+	    {"chollasprings_population"_J, "chollasprings_population"},
+	    {"net_scan_manager"_J, "net_scan_manager"},
+	    {"generic_smoking_item"_J, "generic_smoking_item"},
+	    {"bayounwa_population"_J, "bayounwa_population"},
+	    {"herb_wild_mint"_J, "herb_wild_mint"},
+	    {"ambient_fishing_scenario"_J, "ambient_fishing_scenario"},
+	    {"roanoketrapper"_J, "roanoketrapper"},
+	    {"fme_dead_drop_offline"_J, "fme_dead_drop_offline"},
+	    {"net_ugc_global_loader"_J, "net_ugc_global_loader"},
+	    {"sisikapenitentiary"_J, "sisikapenitentiary"},
+	    {"net_fetch_analytics"_J, "net_fetch_analytics"},
+	    {"net_camp_stress_test"_J, "net_camp_stress_test"},
+	    {"barcustomer_interaction"_J, "barcustomer_interaction"},
+	    {"generic_alcohol_item"_J, "generic_alcohol_item"},
 	    {"shop_fence"_J, "shop_fence"},
-	    {"shop_general"_J, "shop_general"},
-	    {"shop_gunsmith"_J, "shop_gunsmith"},
-	    {"shop_horse_shop"_J, "shop_horse_shop"},
-	    {"shop_horse_shop_sp"_J, "shop_horse_shop_sp"},
-	    {"shop_hotel"_J, "shop_hotel"},
-	    {"shop_market"_J, "shop_market"},
+	    {"satchel_ui_event_handler"_J, "satchel_ui_event_handler"},
+	    {"persona_photos"_J, "persona_photos"},
+	    {"thread_monitor"_J, "thread_monitor"},
+	    {"pausemenu_multiplayer"_J, "pausemenu_multiplayer"},
+	    {"player_menu"_J, "player_menu"},
+	    {"fme_challenges"_J, "fme_challenges"},
+	    {"debug_launcher"_J, "debug_launcher"},
+	    {"fast_travel_prototype"_J, "fast_travel_prototype"},
 	    {"shop_net_barber"_J, "shop_net_barber"},
-	    {"shop_newspaper_boy"_J, "shop_newspaper_boy"},
-	    {"shop_pearson"_J, "shop_pearson"},
-	    {"shop_photo_studio"_J, "shop_photo_studio"},
-	    {"shop_post_office"_J, "shop_post_office"},
-	    {"shop_tailor"_J, "shop_tailor"},
+	    {"cropfarm"_J, "cropfarm"},
+	    {"net_player_camp_manager"_J, "net_player_camp_manager"},
+	    {"fm_mission_debug_output"_J, "fm_mission_debug_output"},
+	    {"security_door_knock_scenario"_J, "security_door_knock_scenario"},
+	    {"roanokeridge_population"_J, "roanokeridge_population"},
+	    {"fme_condor_egg"_J, "fme_condor_egg"},
+	    {"fme_hot_property"_J, "fme_hot_property"},
+	    {"herb_harrietum_officinalis"_J, "herb_harrietum_officinalis"},
+	    {"net_fast_travel_barker"_J, "net_fast_travel_barker"},
+	    {"net_bird_egg_condor"_J, "net_bird_egg_condor"},
+	    {"la_wolf"_J, "la_wolf"},
+	    {"net_bird_egg_loon"_J, "net_bird_egg_loon"},
+	    {"grizzliestravelsales"_J, "grizzliestravelsales"},
+	    {"la_bison"_J, "la_bison"},
+	    {"init_global_block_ugc_common"_J, "init_global_block_ugc_common"},
+	    {"herb_oregano"_J, "herb_oregano"},
+	    {"fme_golden_hat"_J, "fme_golden_hat"},
+	    {"herb_sparrows_egg_orchid"_J, "herb_sparrows_egg_orchid"},
+	    {"nb_duel"_J, "nb_duel"},
+	    {"fm_creator_top_menu"_J, "fm_creator_top_menu"},
+	    {"vanhornmansion"_J, "vanhornmansion"},
+	    {"pv_hunt_the_posse"_J, "pv_hunt_the_posse"},
+	    {"herb_oleander_sage_single"_J, "herb_oleander_sage_single"},
+	    {"shop_general"_J, "shop_general"},
+	    {"dynamic_craft_scenario"_J, "dynamic_craft_scenario"},
+	    {"herb_american_ginseng"_J, "herb_american_ginseng"},
+	    {"wapiti"_J, "wapiti"},
+	    {"shop_honor_mp"_J, "shop_honor_mp"},
+	    {"ui_sticky_feed_priority_test"_J, "ui_sticky_feed_priority_test"},
+	    {"fme_wreckage_offline"_J, "fme_wreckage_offline"},
+	    {"long_update"_J, "long_update"},
+	    {"itemdatabase_debug"_J, "itemdatabase_debug"},
+	    {"region_law_rho_law_swarm"_J, "region_law_rho_law_swarm"},
+	    {"generic_shop_ui_events"_J, "generic_shop_ui_events"},
+	    {"serialkiller"_J, "serialkiller"},
+	    {"grizzlies_population"_J, "grizzlies_population"},
+	    {"fme_challenges_offline"_J, "fme_challenges_offline"},
+	    {"audiotest"_J, "audiotest"},
+	    {"nb_arrowhead_injury"_J, "nb_arrowhead_injury"},
+	    {"scarletttravelsales"_J, "scarletttravelsales"},
+	    {"la_buck"_J, "la_buck"},
+	    {"dakotarivertrapper"_J, "dakotarivertrapper"},
+	    {"herb_wild_feverfew"_J, "herb_wild_feverfew"},
+	    {"smoketest_budget"_J, "smoketest_budget"},
+	    {"net_bird_egg_duck"_J, "net_bird_egg_duck"},
+	    {"mp_freemode_tutorial"_J, "mp_freemode_tutorial"},
+	    {"fm_mission_controller"_J, "fm_mission_controller"},
+	    {"shop_butcher"_J, "shop_butcher"},
+	    {"herb_burdock_root"_J, "herb_burdock_root"},
+	    {"metaped_clothing_gender_swap"_J, "metaped_clothing_gender_swap"},
+	    {"metaped_clothing_tool"_J, "metaped_clothing_tool"},
+	    {"thieveslanding"_J, "thieveslanding"},
+	    {"riobravotravelsales"_J, "riobravotravelsales"},
+	    {"respond_parcel"_J, "respond_parcel"},
+	    {"nb_crashed_wagon"_J, "nb_crashed_wagon"},
+	    {"nb_animal_attack"_J, "nb_animal_attack"},
+	    {"hub"_J, "hub"},
+	    {"wash_face_barrel_scenario"_J, "wash_face_barrel_scenario"},
+	    {"nb_wildman"_J, "nb_wildman"},
+	    {"herb_lady_slipper_orchid"_J, "herb_lady_slipper_orchid"},
+	    {"shop_handheld"_J, "shop_handheld"},
 	    {"shop_train_station"_J, "shop_train_station"},
-	    {"shop_trapper"_J, "shop_trapper"},
-	    {"short_update"_J, "short_update"},
-	    {"show_lighting_adjustment"_J, "show_lighting_adjustment"},
-	    {"show_movie_magic_lantern"_J, "show_movie_magic_lantern"},
-	    {"show_nbx_bigband"_J, "show_nbx_bigband"},
-	    {"show_nbx_bigband_02"_J, "show_nbx_bigband_02"},
-	    {"show_nbx_bulletcatch"_J, "show_nbx_bulletcatch"},
-	    {"show_nbx_cancan"_J, "show_nbx_cancan"},
-	    {"show_nbx_cancan_02"_J, "show_nbx_cancan_02"},
-	    {"show_nbx_escapeartist"_J, "show_nbx_escapeartist"},
-	    {"show_nbx_escapenoose"_J, "show_nbx_escapenoose"},
-	    {"show_nbx_firebreath_01"_J, "show_nbx_firebreath_01"},
-	    {"show_nbx_firedance_01"_J, "show_nbx_firedance_01"},
-	    {"show_nbx_firedance_02"_J, "show_nbx_firedance_02"},
-	    {"show_nbx_flexfight"_J, "show_nbx_flexfight"},
-	    {"show_nbx_oddfellows"_J, "show_nbx_oddfellows"},
-	    {"show_nbx_snakedance_01"_J, "show_nbx_snakedance_01"},
-	    {"show_nbx_snakedance_02"_J, "show_nbx_snakedance_02"},
-	    {"show_nbx_strongwoman"_J, "show_nbx_strongwoman"},
-	    {"show_nbx_sworddance_01"_J, "show_nbx_sworddance_01"},
-	    {"simple_crafting"_J, "simple_crafting"},
-	    {"singing"_J, "singing"},
-	    {"sisikapenitentiary"_J, "sisikapenitentiary"},
-	    {"slavepen"_J, "slavepen"},
-	    {"sleeping_scenario"_J, "sleeping_scenario"},
+	    {"net_hunting_wagon"_J, "net_hunting_wagon"},
+	    {"creator_template"_J, "creator_template"},
+	    {"manzanitapost"_J, "manzanitapost"},
+	    {"net_camp_manager"_J, "net_camp_manager"},
+	    {"weapon_locker"_J, "weapon_locker"},
+	    {"net_bird_egg_goose"_J, "net_bird_egg_goose"},
+	    {"bigvalleytrapper"_J, "bigvalleytrapper"},
+	    {"handcart_test"_J, "handcart_test"},
+	    {"eating_scenario"_J, "eating_scenario"},
+	    {"virtualization_unit_test_support"_J, "virtualization_unit_test_support"},
+	    {"herb_oleander_sage"_J, "herb_oleander_sage"},
+	    {"init_global_block_mc_deathmatch"_J, "init_global_block_mc_deathmatch"},
+	    {"footlocker_scenario"_J, "footlocker_scenario"},
+	    {"fme_treasure_hunt"_J, "fme_treasure_hunt"},
+	    {"fme_condor_egg_offline"_J, "fme_condor_egg_offline"},
+	    {"item_bait_herbivore"_J, "item_bait_herbivore"},
+	    {"net_ugc_intro_flow"_J, "net_ugc_intro_flow"},
+	    {"rathskellerfork"_J, "rathskellerfork"},
+	    {"net_coins"_J, "net_coins"},
+	    {"rhodes"_J, "rhodes"},
+	    {"herb_english_mace_single"_J, "herb_english_mace_single"},
+	    {"herb_acunas_star_orchid"_J, "herb_acunas_star_orchid"},
+	    {"item_legendary_animal_pheromone"_J, "item_legendary_animal_pheromone"},
+	    {"error_listener"_J, "error_listener"},
+	    {"crawdadwillies"_J, "crawdadwillies"},
+	    {"missinghusband"_J, "missinghusband"},
+	    {"money_pile"_J, "money_pile"},
+	    {"register_core"_J, "register_core"},
+	    {"metaped_animal_testing_tool"_J, "metaped_animal_testing_tool"},
+	    {"herb_dragons_mouth_orchid"_J, "herb_dragons_mouth_orchid"},
+	    {"net_ugc_end_flow"_J, "net_ugc_end_flow"},
+	    {"nb_kidnapped"_J, "nb_kidnapped"},
+	    {"greatplains_population"_J, "greatplains_population"},
+	    {"fme_treasure_hunt_offline"_J, "fme_treasure_hunt_offline"},
+	    {"init_global_block_sp"_J, "init_global_block_sp"},
+	    {"net_turn_in"_J, "net_turn_in"},
+	    {"init_global_block_ugc"_J, "init_global_block_ugc"},
+	    {"scaleform_lobby_menu_demo"_J, "scaleform_lobby_menu_demo"},
+	    {"downsranch"_J, "downsranch"},
+	    {"fm_deathmatch_creator_new"_J, "fm_deathmatch_creator_new"},
+	    {"talltrees_population"_J, "talltrees_population"},
+	    {"grangershoggery"_J, "grangershoggery"},
+	    {"player_scenario_camera"_J, "player_scenario_camera"},
+	    {"net_bird_egg_spoonbill"_J, "net_bird_egg_spoonbill"},
+	    {"fme_golden_hat_offline"_J, "fme_golden_hat_offline"},
+	    {"hennigantravelsales"_J, "hennigantravelsales"},
+	    {"cumberlandforest_population"_J, "cumberlandforest_population"},
+	    {"net_assassination"_J, "net_assassination"},
+	    {"smoketest_wait"_J, "smoketest_wait"},
+	    {"herb_wild_flower_creek_plum"_J, "herb_wild_flower_creek_plum"},
+	    {"debug_update"_J, "debug_update"},
+	    {"herb_item"_J, "herb_item"},
+	    {"fme_protect_legendary_animal_offline"_J, "fme_protect_legendary_animal_offline"},
+	    {"herb_indian_tobacco"_J, "herb_indian_tobacco"},
+	    {"fm_fetch_creator"_J, "fm_fetch_creator"},
+	    {"net_tg_lobby"_J, "net_tg_lobby"},
+	    {"nb_slumped_hunter"_J, "nb_slumped_hunter"},
+	    {"loonycult"_J, "loonycult"},
+	    {"shadybelle"_J, "shadybelle"},
+	    {"la_beaver"_J, "la_beaver"},
+	    {"shop_dynamic"_J, "shop_dynamic"},
+	    {"debug_generic_widgets"_J, "debug_generic_widgets"},
+	    {"placement_editor"_J, "placement_editor"},
+	    {"watsonscabin"_J, "watsonscabin"},
+	    {"scaleform_ui_test"_J, "scaleform_ui_test"},
+	    {"herb_milkweed"_J, "herb_milkweed"},
+	    {"animal_transformation_location"_J, "animal_transformation_location"},
+	    {"fme_supply_train"_J, "fme_supply_train"},
+	    {"placement_editor_pickups"_J, "placement_editor_pickups"},
+	    {"give_all_items"_J, "give_all_items"},
+	    {"fme_animal_tagging"_J, "fme_animal_tagging"},
+	    {"bigvalley_population"_J, "bigvalley_population"},
+	    {"init_global_block_mc"_J, "init_global_block_mc"},
+	    {"net_in_world_deathmatch"_J, "net_in_world_deathmatch"},
+	    {"serendipity"_J, "serendipity"},
+	    {"stew_eating"_J, "stew_eating"},
+	    {"herb_spider_orchid"_J, "herb_spider_orchid"},
+	    {"herb_prairie_poppy"_J, "herb_prairie_poppy"},
+	    {"herb_wild_carrots"_J, "herb_wild_carrots"},
+	    {"lovetriangle"_J, "lovetriangle"},
+	    {"generic_single_use_item"_J, "generic_single_use_item"},
+	    {"net_main_offline"_J, "net_main_offline"},
+	    {"beechershope"_J, "beechershope"},
+	    {"scaleform_font_test"_J, "scaleform_font_test"},
+	    {"net_main_online"_J, "net_main_online"},
+	    {"metaped_clothing_tool_quick_menu"_J, "metaped_clothing_tool_quick_menu"},
+	    {"net_moonshine_entrance"_J, "net_moonshine_entrance"},
+	    {"bluegillmarsh_population"_J, "bluegillmarsh_population"},
+	    {"herb_rat_tail_orchid"_J, "herb_rat_tail_orchid"},
+	    {"flow_controller"_J, "flow_controller"},
+	    {"guama_population"_J, "guama_population"},
+	    {"roanokeomj"_J, "roanokeomj"},
+	    {"scaleform_graphic_test"_J, "scaleform_graphic_test"},
+	    {"fm_creator_script_manager"_J, "fm_creator_script_manager"},
+	    {"net_collectible_fossils"_J, "net_collectible_fossils"},
+	    {"caligahall"_J, "caligahall"},
+	    {"gfh_entity_reservation_tool"_J, "gfh_entity_reservation_tool"},
 	    {"smoketest"_J, "smoketest"},
-	    {"smoketest_budget"_J, "smoketest_budget"},
-	    {"smoketest_second_screen"_J, "smoketest_second_screen"},
+	    {"dairyfarm"_J, "dairyfarm"},
+	    {"nb_treasure_hunter"_J, "nb_treasure_hunter"},
+	    {"net_bird_egg_hawk"_J, "net_bird_egg_hawk"},
+	    {"net_gangfeud_manager"_J, "net_gangfeud_manager"},
+	    {"net_fetch_hideout_leader"_J, "net_fetch_hideout_leader"},
+	    {"short_update"_J, "short_update"},
+	    {"henniganharriet"_J, "henniganharriet"},
+	    {"region_law_w_eliz_pinks"_J, "region_law_w_eliz_pinks"},
+	    {"net_cutscene"_J, "net_cutscene"},
+	    {"net_coach_holdup"_J, "net_coach_holdup"},
+	    {"show_mp_nbx_snakedance_02"_J, "show_mp_nbx_snakedance_02"},
+	    {"generic_multibite_item"_J, "generic_multibite_item"},
+	    {"cornwallkerosene"_J, "cornwallkerosene"},
+	    {"fme_supply_train_offline"_J, "fme_supply_train_offline"},
+	    {"placement_editor_points"_J, "placement_editor_points"},
+	    {"tumbleweed"_J, "tumbleweed"},
+	    {"net_main_tlg_offline"_J, "net_main_tlg_offline"},
+	    {"herb_desert_sage"_J, "herb_desert_sage"},
+	    {"save_menu_ui_event_handler"_J, "save_menu_ui_event_handler"},
+	    {"nb_photography"_J, "nb_photography"},
+	    {"map_app_event_handler"_J, "map_app_event_handler"},
+	    {"net_collectible_random_dig_site"_J, "net_collectible_random_dig_site"},
+	    {"interactive_campfire"_J, "interactive_campfire"},
+	    {"talltreestrapper"_J, "talltreestrapper"},
+	    {"nb_hobo_dog"_J, "nb_hobo_dog"},
+	    {"herb_black_berry"_J, "herb_black_berry"},
+	    {"net_ugc_end_flow_transition_online"_J, "net_ugc_end_flow_transition_online"},
+	    {"oldfortwallace"_J, "oldfortwallace"},
+	    {"wanted_poster"_J, "wanted_poster"},
+	    {"angryisolationist"_J, "angryisolationist"},
+	    {"net_char_creator"_J, "net_char_creator"},
+	    {"generic_puking_item"_J, "generic_puking_item"},
+	    {"net_ugc_end_flow_transition_handler"_J, "net_ugc_end_flow_transition_handler"},
+	    {"tg_p"_J, "tg_p"},
+	    {"fme_round_up_offline"_J, "fme_round_up_offline"},
+	    {"asset_viewer_main"_J, "asset_viewer_main"},
+	    {"carmodydell"_J, "carmodydell"},
+	    {"millesaniclaim"_J, "millesaniclaim"},
+	    {"camp_fire_cooking"_J, "camp_fire_cooking"},
+	    {"civilwarbride"_J, "civilwarbride"},
+	    {"net_jail"_J, "net_jail"},
+	    {"net_lost_jewelry_chest"_J, "net_lost_jewelry_chest"},
+	    {"la_cougar"_J, "la_cougar"},
+	    {"beaverhollow"_J, "beaverhollow"},
 	    {"smoketest_stability"_J, "smoketest_stability"},
-	    {"smoketest_wait"_J, "smoketest_wait"},
-	    {"smuggler2"_J, "smuggler2"},
-	    {"smuggler2_intro"_J, "smuggler2_intro"},
-	    {"smuggler2_outro"_J, "smuggler2_outro"},
-	    {"spd_agnesdowd1"_J, "spd_agnesdowd1"},
-	    {"spd_andershelgerson"_J, "spd_andershelgerson"},
-	    {"spd_armadillotowncrier"_J, "spd_armadillotowncrier"},
-	    {"spd_blandpreacher"_J, "spd_blandpreacher"},
-	    {"spd_blindmancassidy1"_J, "spd_blindmancassidy1"},
-	    {"spd_blindmancassidy_horse_buck"_J, "spd_blindmancassidy_horse_buck"},
-	    {"spd_bummicky1"_J, "spd_bummicky1"},
-	    {"spd_bummicky2"_J, "spd_bummicky2"},
-	    {"spd_bummicky3"_J, "spd_bummicky3"},
-	    {"spd_bummicky4"_J, "spd_bummicky4"},
-	    {"spd_bummicky5"_J, "spd_bummicky5"},
-	    {"spd_bummicky6"_J, "spd_bummicky6"},
-	    {"spd_bummicky7"_J, "spd_bummicky7"},
-	    {"spd_chelonianmaster1"_J, "spd_chelonianmaster1"},
-	    {"spd_civilwarcommando"_J, "spd_civilwarcommando"},
-	    {"spd_crackpotrobot"_J, "spd_crackpotrobot"},
-	    {"spd_dorotheawicklow1"_J, "spd_dorotheawicklow1"},
-	    {"spd_dorotheawicklow2"_J, "spd_dorotheawicklow2"},
-	    {"spd_endlessstrainer1"_J, "spd_endlessstrainer1"},
-	    {"spd_eugenicsproponent"_J, "spd_eugenicsproponent"},
-	    {"spd_gavin1"_J, "spd_gavin1"},
-	    {"spd_gavin2"_J, "spd_gavin2"},
-	    {"spd_giant"_J, "spd_giant"},
-	    {"spd_giant_birds"_J, "spd_giant_birds"},
-	    {"spd_grizzledjon1"_J, "spd_grizzledjon1"},
-	    {"spd_joebutler1"_J, "spd_joebutler1"},
-	    {"spd_joebutler2"_J, "spd_joebutler2"},
-	    {"spd_joebutler3"_J, "spd_joebutler3"},
-	    {"spd_joebutler4"_J, "spd_joebutler4"},
-	    {"spd_johnmadman"_J, "spd_johnmadman"},
-	    {"spd_lillianpowell1"_J, "spd_lillianpowell1"},
-	    {"spd_lillianpowell2"_J, "spd_lillianpowell2"},
-	    {"spd_lillianpowell3"_J, "spd_lillianpowell3"},
-	    {"spd_lillianpowell4"_J, "spd_lillianpowell4"},
-	    {"spd_madscientist"_J, "spd_madscientist"},
-	    {"spd_mayorofstrawberry1"_J, "spd_mayorofstrawberry1"},
-	    {"spd_philosopher1"_J, "spd_philosopher1"},
-	    {"spd_poorjoe1"_J, "spd_poorjoe1"},
-	    {"spd_sheriffoftumbleweed"_J, "spd_sheriffoftumbleweed"},
-	    {"spd_soothsayer1"_J, "spd_soothsayer1"},
-	    {"spd_sunworshipper1"_J, "spd_sunworshipper1"},
-	    {"spd_swampweirdo1"_J, "spd_swampweirdo1"},
-	    {"spd_thomasdowne1"_J, "spd_thomasdowne1"},
-	    {"spd_timothydonahue1"_J, "spd_timothydonahue1"},
-	    {"spd_timothydonahue2"_J, "spd_timothydonahue2"},
-	    {"spd_tinyhermit1"_J, "spd_tinyhermit1"},
-	    {"spd_vampire"_J, "spd_vampire"},
-	    {"stage_coach"_J, "stage_coach"},
-	    {"startup"_J, "startup"},
-	    {"startup_clip"_J, "startup_clip"},
-	    {"startup_mp"_J, "startup_mp"},
+	    {"fm_mission_creator_new"_J, "fm_mission_creator_new"},
+	    {"net_pickup_collectibles_bottles"_J, "net_pickup_collectibles_bottles"},
+	    {"nm_test"_J, "nm_test"},
+	    {"net_moonshine_property"_J, "net_moonshine_property"},
+	    {"show_mp_nbx_escapenoose"_J, "show_mp_nbx_escapenoose"},
 	    {"startup_sp"_J, "startup_sp"},
+	    {"rileyscharge"_J, "rileyscharge"},
+	    {"net_bounty_wagon"_J, "net_bounty_wagon"},
 	    {"starvingchildren"_J, "starvingchildren"},
-	    {"stew_eating"_J, "stew_eating"},
-	    {"strawberry"_J, "strawberry"},
-	    {"susan1"_J, "susan1"},
-	    {"susan1_intro"_J, "susan1_intro"},
-	    {"swansonstation"_J, "swansonstation"},
-	    {"talltreestrapper"_J, "talltreestrapper"},
-	    {"talltrees_population"_J, "talltrees_population"},
-	    {"taxidermy"_J, "taxidermy"},
-	    {"taxidermy_marital"_J, "taxidermy_marital"},
-	    {"test_startup"_J, "test_startup"},
-	    {"test_startup2"_J, "test_startup2"},
+	    {"shop_bait"_J, "shop_bait"},
+	    {"startup_tlg"_J, "startup_tlg"},
+	    {"scarletthorseshop"_J, "scarletthorseshop"},
+	    {"aberdeenpigfarm"_J, "aberdeenpigfarm"},
+	    {"nb_tied_up_ped"_J, "nb_tied_up_ped"},
+	    {"la_ram"_J, "la_ram"},
+	    {"moonshine_coffee_drinking"_J, "moonshine_coffee_drinking"},
+	    {"herb_cigar_orchid"_J, "herb_cigar_orchid"},
+	    {"net_pickup_collectibles_tarot_cards"_J, "net_pickup_collectibles_tarot_cards"},
+	    {"init_global_block_mp"_J, "init_global_block_mp"},
+	    {"bandana"_J, "bandana"},
+	    {"net_player_wheel_item_use"_J, "net_player_wheel_item_use"},
+	    {"bluewatertravelsales"_J, "bluewatertravelsales"},
+	    {"init_global_block_ugc_cutscene"_J, "init_global_block_ugc_cutscene"},
+	    {"role_progression"_J, "role_progression"},
+	    {"net_deathmatch_ambient_manager"_J, "net_deathmatch_ambient_manager"},
+	    {"herb_yarrow_single"_J, "herb_yarrow_single"},
+	    {"grizzlieseast_population"_J, "grizzlieseast_population"},
+	    {"fme_wreckage"_J, "fme_wreckage"},
+	    {"shop_wilderness_supplies"_J, "shop_wilderness_supplies"},
+	    {"placement_editor_doors"_J, "placement_editor_doors"},
+	    {"nb_tree_map"_J, "nb_tree_map"},
+	    {"herb_hummingbird_sage"_J, "herb_hummingbird_sage"},
+	    {"show_mp_nbx_firedance_02"_J, "show_mp_nbx_firedance_02"},
+	    {"catfishjacksons"_J, "catfishjacksons"},
+	    {"fme_round_up"_J, "fme_round_up"},
+	    {"chollatrapper"_J, "chollatrapper"},
+	    {"scarlettmeadows_population"_J, "scarlettmeadows_population"},
+	    {"net_impromptu_race_online"_J, "net_impromptu_race_online"},
+	    {"placement_editor_peds"_J, "placement_editor_peds"},
+	    {"herb_parasol_mushroom"_J, "herb_parasol_mushroom"},
+	    {"aguasdulces"_J, "aguasdulces"},
+	    {"fm_race_creator_new"_J, "fm_race_creator_new"},
+	    {"show_mp_nbx_cancan_02"_J, "show_mp_nbx_cancan_02"},
+	    {"run_aa_tool"_J, "run_aa_tool"},
+	    {"herb_alaskan_ginseng"_J, "herb_alaskan_ginseng"},
+	    {"net_beat_manager"_J, "net_beat_manager"},
+	    {"region_law_bloodhound"_J, "region_law_bloodhound"},
+	    {"grizzlieswest_population"_J, "grizzlieswest_population"},
+	    {"chezporter"_J, "chezporter"},
+	    {"shop_moonshine_shop"_J, "shop_moonshine_shop"},
 	    {"theatre_ticket_taker"_J, "theatre_ticket_taker"},
-	    {"thieveslanding"_J, "thieveslanding"},
-	    {"tithe_scenario"_J, "tithe_scenario"},
-	    {"town_secrets_er_daughter"_J, "town_secrets_er_daughter"},
-	    {"town_secrets_sd_trelawny"_J, "town_secrets_sd_trelawny"},
-	    {"town_secrets_strawberry"_J, "town_secrets_strawberry"},
-	    {"town_secrets_val_moira"_J, "town_secrets_val_moira"},
-	    {"trainrobbery_ambient"_J, "trainrobbery_ambient"},
-	    {"train_annesburg"_J, "train_annesburg"},
-	    {"train_fast_travel_core"_J, "train_fast_travel_core"},
-	    {"train_robbery1"_J, "train_robbery1"},
-	    {"train_robbery1_intro"_J, "train_robbery1_intro"},
-	    {"train_robbery2"_J, "train_robbery2"},
-	    {"train_robbery2_intro"_J, "train_robbery2_intro"},
-	    {"train_robbery3"_J, "train_robbery3"},
-	    {"train_robbery3_intro"_J, "train_robbery3_intro"},
-	    {"train_robbery4"_J, "train_robbery4"},
-	    {"train_robbery4_intro"_J, "train_robbery4_intro"},
-	    {"train_robbery4_outro"_J, "train_robbery4_outro"},
-	    {"train_summon"_J, "train_summon"},
-	    {"train_vfx_test"_J, "train_vfx_test"},
-	    {"treasure_hunter"_J, "treasure_hunter"},
-	    {"trelawny1"_J, "trelawny1"},
-	    {"trelawny1_intro"_J, "trelawny1_intro"},
-	    {"tumbleweed"_J, "tumbleweed"},
-	    {"ui_sticky_feed_priority_test"_J, "ui_sticky_feed_priority_test"},
+	    {"scaleform_option_stepper_test"_J, "scaleform_option_stepper_test"},
+	    {"herb_lady_of_night_orchid"_J, "herb_lady_of_night_orchid"},
+	    {"deadrival"_J, "deadrival"},
+	    {"fm_race_controller"_J, "fm_race_controller"},
+	    {"net_stable_manager"_J, "net_stable_manager"},
+	    {"clemenscove"_J, "clemenscove"},
+	    {"fme_king_of_the_rails_offline"_J, "fme_king_of_the_rails_offline"},
+	    {"moonshine_drink_item"_J, "moonshine_drink_item"},
+	    {"net_moonshine_manager"_J, "net_moonshine_manager"},
+	    {"armadillo"_J, "armadillo"},
+	    {"shop_photo_studio"_J, "shop_photo_studio"},
+	    {"show_mp_nbx_escapeartist"_J, "show_mp_nbx_escapeartist"},
+	    {"nb_moonshine_camp"_J, "nb_moonshine_camp"},
+	    {"civilized_region_test"_J, "civilized_region_test"},
+	    {"la_fox"_J, "la_fox"},
+	    {"riggsstation"_J, "riggsstation"},
+	    {"fm_deathmatch_controller"_J, "fm_deathmatch_controller"},
+	    {"metal_detector"_J, "metal_detector"},
+	    {"fme_escaped_convicts_offline"_J, "fme_escaped_convicts_offline"},
+	    {"show_mp_nbx_strongwoman"_J, "show_mp_nbx_strongwoman"},
+	    {"chollatravelsales"_J, "chollatravelsales"},
+	    {"region_law_roadblock_creator"_J, "region_law_roadblock_creator"},
+	    {"combat_test"_J, "combat_test"},
+	    {"herb_chanterelles"_J, "herb_chanterelles"},
+	    {"shop_doctor"_J, "shop_doctor"},
+	    {"simple_crafting"_J, "simple_crafting"},
 	    {"ui_unit_tests"_J, "ui_unit_tests"},
-	    {"undertaker"_J, "undertaker"},
-	    {"utopia1"_J, "utopia1"},
-	    {"utopia1_intro"_J, "utopia1_intro"},
-	    {"utopia2"_J, "utopia2"},
-	    {"utopia2_intro"_J, "utopia2_intro"},
-	    {"utopia2_outro"_J, "utopia2_outro"},
-	    {"valentine"_J, "valentine"},
-	    {"vanhornmansion"_J, "vanhornmansion"},
-	    {"vanhorntradingpost"_J, "vanhorntradingpost"},
-	    {"vig_debug_ui"_J, "vig_debug_ui"},
-	    {"vig_playlist_colter"_J, "vig_playlist_colter"},
-	    {"vig_playlist_dtc1_post"_J, "vig_playlist_dtc1_post"},
-	    {"vig_playlist_dtc3_post"_J, "vig_playlist_dtc3_post"},
-	    {"vig_playlist_fud1_post"_J, "vig_playlist_fud1_post"},
-	    {"vig_playlist_gang3_post"_J, "vig_playlist_gang3_post"},
-	    {"vig_playlist_hosea_focus"_J, "vig_playlist_hosea_focus"},
-	    {"vig_playlist_lowkey_hso"_J, "vig_playlist_lowkey_hso"},
-	    {"vig_playlist_mud1_post"_J, "vig_playlist_mud1_post"},
-	    {"vig_playlist_mud5_post"_J, "vig_playlist_mud5_post"},
-	    {"vig_playlist_music_pns"_J, "vig_playlist_music_pns"},
-	    {"vig_playlist_music_snknj"_J, "vig_playlist_music_snknj"},
-	    {"vig_playlist_party_hso"_J, "vig_playlist_party_hso"},
-	    {"vig_playlist_party_sdb"_J, "vig_playlist_party_sdb"},
-	    {"vig_playlist_sad1_post"_J, "vig_playlist_sad1_post"},
-	    {"vig_playlist_strauss31_post"_J, "vig_playlist_strauss31_post"},
-	    {"virtualization_unit_test_support"_J, "virtualization_unit_test_support"},
-	    {"walk_and_talk_test_script_widget"_J, "walk_and_talk_test_script_widget"},
-	    {"wallacestation"_J, "wallacestation"},
-	    {"wanted_poster"_J, "wanted_poster"},
-	    {"wapiti"_J, "wapiti"},
-	    {"watsonscabin"_J, "watsonscabin"},
-	    {"weapon_locker"_J, "weapon_locker"},
-	    {"wilderness_chest"_J, "wilderness_chest"},
+	    {"net_player_vehicle"_J, "net_player_vehicle"},
+	    {"animal_transformation_mission"_J, "animal_transformation_mission"},
+	    {"junction_test"_J, "junction_test"},
+	    {"net_ability_card_ui_handler"_J, "net_ability_card_ui_handler"},
+	    {"slavepen"_J, "slavepen"},
+	    {"scenario_point_finder"_J, "scenario_point_finder"},
+	    {"net_fetch_manager"_J, "net_fetch_manager"},
+	    {"placement_editor_gang_camps"_J, "placement_editor_gang_camps"},
+	    {"benedictpoint"_J, "benedictpoint"},
+	    {"la_boar"_J, "la_boar"},
+	    {"shop_harriet"_J, "shop_harriet"},
+	    {"herb_wild_flower_cardinal_flower"_J, "herb_wild_flower_cardinal_flower"},
+	    {"fishing_core"_J, "fishing_core"},
+	    {"la_moose"_J, "la_moose"},
+	    {"shop_handheld_event_handler"_J, "shop_handheld_event_handler"},
 	    {"window_peek_scenario"_J, "window_peek_scenario"},
-	    {"winter1"_J, "winter1"},
-	    {"winter1_outro"_J, "winter1_outro"},
-	    {"winter2"_J, "winter2"},
-	    {"winter2_intro"_J, "winter2_intro"},
-	    {"winter2_outro"_J, "winter2_outro"},
-	    {"winter4"_J, "winter4"},
-	    {"winter4_intro"_J, "winter4_intro"},
-	    {"winter4_outro"_J, "winter4_outro"},
-	    {"xml_menus"_J, "xml_menus"},
-	};
-
-	const std::vector<std::pair<std::uint32_t, const char*>> g_MpScriptNames = {
-	    { "aberdeenpigfarm"_J, "aberdeenpigfarm" },
-		{ "adlerranch"_J, "adlerranch" },
-		{ "aguasdulces"_J, "aguasdulces" },
-		{ "ambient_fishing_scenario"_J, "ambient_fishing_scenario" },
-		{ "angryisolationist"_J, "angryisolationist" },
-		{ "animal_transformation_location"_J, "animal_transformation_location" },
-		{ "animal_transformation_mission"_J, "animal_transformation_mission" },
-		{ "annesburg"_J, "annesburg" },
-		{ "armadillo"_J, "armadillo" },
-		{ "armoire_corpse_scenario"_J, "armoire_corpse_scenario" },
-		{ "asset_viewer_main"_J, "asset_viewer_main" },
-		{ "audiotest"_J, "audiotest" },
-		{ "bandana"_J, "bandana" },
-		{ "barcustomer_interaction"_J, "barcustomer_interaction" },
-		{ "bayounwa_population"_J, "bayounwa_population" },
-		{ "beaverhollow"_J, "beaverhollow" },
-		{ "beechersc"_J, "beechersc" },
-		{ "beechershope"_J, "beechershope" },
-		{ "benedictpoint"_J, "benedictpoint" },
-		{ "berylsdream"_J, "berylsdream" },
-		{ "bigvalleyomj"_J, "bigvalleyomj" },
-		{ "bigvalleytrapper"_J, "bigvalleytrapper" },
-		{ "bigvalleytravelsales"_J, "bigvalleytravelsales" },
-		{ "bigvalley_population"_J, "bigvalley_population" },
-		{ "binoculars"_J, "binoculars" },
-		{ "blackbalsamrise"_J, "blackbalsamrise" },
-		{ "blackwater"_J, "blackwater" },
-		{ "bluegillmarsh_population"_J, "bluegillmarsh_population" },
-		{ "bluewatertravelsales"_J, "bluewatertravelsales" },
-		{ "braithwaitemanor"_J, "braithwaitemanor" },
-		{ "broom_scenario"_J, "broom_scenario" },
-		{ "butchercreek"_J, "butchercreek" },
-		{ "caligahall"_J, "caligahall" },
-		{ "camera_item"_J, "camera_item" },
-		{ "camp_fire_cooking"_J, "camp_fire_cooking" },
-		{ "carmodydell"_J, "carmodydell" },
-		{ "catfishjacksons"_J, "catfishjacksons" },
-		{ "chezporter"_J, "chezporter" },
-		{ "chollasprings_population"_J, "chollasprings_population" },
-		{ "chollatrapper"_J, "chollatrapper" },
-		{ "chollatravelsales"_J, "chollatravelsales" },
-		{ "civilized_region_test"_J, "civilized_region_test" },
-		{ "civilwarbride"_J, "civilwarbride" },
-		{ "clemenscove"_J, "clemenscove" },
-		{ "clemenspoint"_J, "clemenspoint" },
-		{ "coffee_drinking"_J, "coffee_drinking" },
-		{ "collectors_bag"_J, "collectors_bag" },
-		{ "colter"_J, "colter" },
-		{ "combat_test"_J, "combat_test" },
-		{ "cornwallkerosene"_J, "cornwallkerosene" },
-		{ "crawdadwillies"_J, "crawdadwillies" },
-		{ "creator_template"_J, "creator_template" },
-		{ "cropfarm"_J, "cropfarm" },
-		{ "cumberlandforest_population"_J, "cumberlandforest_population" },
-		{ "dairyfarm"_J, "dairyfarm" },
-		{ "dakotarivertrapper"_J, "dakotarivertrapper" },
-		{ "deadrival"_J, "deadrival" },
-		{ "deadsettler"_J, "deadsettler" },
-		{ "debug_fast_travel"_J, "debug_fast_travel" },
-		{ "debug_generic_widgets"_J, "debug_generic_widgets" },
-		{ "debug_launcher"_J, "debug_launcher" },
-		{ "debug_metapeditor"_J, "debug_metapeditor" },
-		{ "debug_metapeditor_custom_launch"_J, "debug_metapeditor_custom_launch" },
-		{ "debug_update"_J, "debug_update" },
-		{ "dinolady"_J, "dinolady" },
-		{ "discoverable_geyser"_J, "discoverable_geyser" },
-		{ "doc_book"_J, "doc_book" },
-		{ "downsranch"_J, "downsranch" },
-		{ "dynamic_craft_scenario"_J, "dynamic_craft_scenario" },
-		{ "eating_scenario"_J, "eating_scenario" },
-		{ "electric_lantern"_J, "electric_lantern" },
-		{ "emeraldranch"_J, "emeraldranch" },
-		{ "error_listener"_J, "error_listener" },
-		{ "error_listener_gc"_J, "error_listener_gc" },
-		{ "fast_travel_prototype"_J, "fast_travel_prototype" },
-		{ "field_guide"_J, "field_guide" },
-		{ "fishing_core"_J, "fishing_core" },
-		{ "flow_controller"_J, "flow_controller" },
-		{ "fme_animal_tagging"_J, "fme_animal_tagging" },
-		{ "fme_animal_tagging_offline"_J, "fme_animal_tagging_offline" },
-		{ "fme_archery"_J, "fme_archery" },
-		{ "fme_archery_offline"_J, "fme_archery_offline" },
-		{ "fme_challenges"_J, "fme_challenges" },
-		{ "fme_challenges_offline"_J, "fme_challenges_offline" },
-		{ "fme_condor_egg"_J, "fme_condor_egg" },
-		{ "fme_condor_egg_offline"_J, "fme_condor_egg_offline" },
-		{ "fme_dead_drop"_J, "fme_dead_drop" },
-		{ "fme_dead_drop_offline"_J, "fme_dead_drop_offline" },
-		{ "fme_escaped_convicts"_J, "fme_escaped_convicts" },
-		{ "fme_escaped_convicts_offline"_J, "fme_escaped_convicts_offline" },
-		{ "fme_golden_hat"_J, "fme_golden_hat" },
-		{ "fme_golden_hat_offline"_J, "fme_golden_hat_offline" },
-		{ "fme_hot_property"_J, "fme_hot_property" },
-		{ "fme_hot_property_offline"_J, "fme_hot_property_offline" },
-		{ "fme_king_of_the_castle"_J, "fme_king_of_the_castle" },
-		{ "fme_king_of_the_castle_offline"_J, "fme_king_of_the_castle_offline" },
-		{ "fme_king_of_the_rails"_J, "fme_king_of_the_rails" },
-		{ "fme_king_of_the_rails_offline"_J, "fme_king_of_the_rails_offline" },
-		{ "fme_protect_legendary_animal"_J, "fme_protect_legendary_animal" },
-		{ "fme_protect_legendary_animal_offline"_J, "fme_protect_legendary_animal_offline" },
-		{ "fme_round_up"_J, "fme_round_up" },
-		{ "fme_round_up_offline"_J, "fme_round_up_offline" },
-		{ "fme_supply_train"_J, "fme_supply_train" },
-		{ "fme_supply_train_offline"_J, "fme_supply_train_offline" },
-		{ "fme_treasure_hunt"_J, "fme_treasure_hunt" },
-		{ "fme_treasure_hunt_offline"_J, "fme_treasure_hunt_offline" },
-		{ "fme_wildlife_photographer"_J, "fme_wildlife_photographer" },
-		{ "fme_wildlife_photographer_offline"_J, "fme_wildlife_photographer_offline" },
-		{ "fme_wreckage"_J, "fme_wreckage" },
-		{ "fme_wreckage_offline"_J, "fme_wreckage_offline" },
-		{ "fm_creator_script_manager"_J, "fm_creator_script_manager" },
-		{ "fm_creator_top_menu"_J, "fm_creator_top_menu" },
-		{ "fm_deathmatch_controller"_J, "fm_deathmatch_controller" },
-		{ "fm_deathmatch_creator_new"_J, "fm_deathmatch_creator_new" },
-		{ "fm_fetch_creator"_J, "fm_fetch_creator" },
-		{ "fm_mission_controller"_J, "fm_mission_controller" },
-		{ "fm_mission_creator_new"_J, "fm_mission_creator_new" },
-		{ "fm_mission_debug_output"_J, "fm_mission_debug_output" },
-		{ "fm_race_controller"_J, "fm_race_controller" },
-		{ "fm_race_creator_new"_J, "fm_race_creator_new" },
-		{ "footlocker_scenario"_J, "footlocker_scenario" },
-		{ "frozenexplorers"_J, "frozenexplorers" },
-		{ "gaptoothridge_population"_J, "gaptoothridge_population" },
-		{ "generic_alcohol_item"_J, "generic_alcohol_item" },
-		{ "generic_document_inspection"_J, "generic_document_inspection" },
-		{ "generic_ghosttown"_J, "generic_ghosttown" },
-		{ "generic_item_writing_on_back"_J, "generic_item_writing_on_back" },
-		{ "generic_multibite_item"_J, "generic_multibite_item" },
-		{ "generic_puking_item"_J, "generic_puking_item" },
-		{ "generic_shop_ui_events"_J, "generic_shop_ui_events" },
-		{ "generic_show_mc_mp"_J, "generic_show_mc_mp" },
-		{ "generic_show_mp_manager"_J, "generic_show_mp_manager" },
-		{ "generic_single_use_item"_J, "generic_single_use_item" },
-		{ "generic_smoking_item"_J, "generic_smoking_item" },
-		{ "generic_weapon_item"_J, "generic_weapon_item" },
-		{ "generic_weight_control_item"_J, "generic_weight_control_item" },
-		{ "gfh_authoring_tool"_J, "gfh_authoring_tool" },
-		{ "gfh_campworks"_J, "gfh_campworks" },
-		{ "gfh_door_tool"_J, "gfh_door_tool" },
-		{ "gfh_entity_reservation_tool"_J, "gfh_entity_reservation_tool" },
-		{ "give_all_items"_J, "give_all_items" },
-		{ "grangershoggery"_J, "grangershoggery" },
-		{ "greatplains_population"_J, "greatplains_population" },
-		{ "grizzlieseast_population"_J, "grizzlieseast_population" },
-		{ "grizzliestravelsales"_J, "grizzliestravelsales" },
-		{ "grizzlieswest_population"_J, "grizzlieswest_population" },
-		{ "grizzlies_population"_J, "grizzlies_population" },
-		{ "guama_population"_J, "guama_population" },
-		{ "gunfight"_J, "gunfight" },
-		{ "handcart_test"_J, "handcart_test" },
-		{ "hanging_carcass"_J, "hanging_carcass" },
-		{ "happyfamily"_J, "happyfamily" },
-		{ "heartland_population"_J, "heartland_population" },
-		{ "henniganharriet"_J, "henniganharriet" },
-		{ "hennigansstead_population"_J, "hennigansstead_population" },
-		{ "hennigantravelsales"_J, "hennigantravelsales" },
-		{ "herb"_J, "herb" },
-		{ "herbal_plants"_J, "herbal_plants" },
-		{ "herb_acunas_star_orchid"_J, "herb_acunas_star_orchid" },
-		{ "herb_alaskan_ginseng"_J, "herb_alaskan_ginseng" },
-		{ "herb_american_ginseng"_J, "herb_american_ginseng" },
-		{ "herb_bay_bolete"_J, "herb_bay_bolete" },
-		{ "herb_black_berry"_J, "herb_black_berry" },
-		{ "herb_black_currant"_J, "herb_black_currant" },
-		{ "herb_burdock_root"_J, "herb_burdock_root" },
-		{ "herb_burdock_root_single"_J, "herb_burdock_root_single" },
-		{ "herb_chanterelles"_J, "herb_chanterelles" },
-		{ "herb_cigar_orchid"_J, "herb_cigar_orchid" },
-		{ "herb_clamshell_orchid"_J, "herb_clamshell_orchid" },
-		{ "herb_common_bulrush"_J, "herb_common_bulrush" },
-		{ "herb_creeping_thyme"_J, "herb_creeping_thyme" },
-		{ "herb_desert_sage"_J, "herb_desert_sage" },
-		{ "herb_dragons_mouth_orchid"_J, "herb_dragons_mouth_orchid" },
-		{ "herb_english_mace"_J, "herb_english_mace" },
-		{ "herb_english_mace_single"_J, "herb_english_mace_single" },
-		{ "herb_evergreen_huckleberry"_J, "herb_evergreen_huckleberry" },
-		{ "herb_ghost_orchid"_J, "herb_ghost_orchid" },
-		{ "herb_golden_currant"_J, "herb_golden_currant" },
-		{ "herb_harrietum_officinalis"_J, "herb_harrietum_officinalis" },
-		{ "herb_hummingbird_sage"_J, "herb_hummingbird_sage" },
-		{ "herb_indian_tobacco"_J, "herb_indian_tobacco" },
-		{ "herb_item"_J, "herb_item" },
-		{ "herb_lady_of_night_orchid"_J, "herb_lady_of_night_orchid" },
-		{ "herb_lady_slipper_orchid"_J, "herb_lady_slipper_orchid" },
-		{ "herb_milkweed"_J, "herb_milkweed" },
-		{ "herb_milkweed_single"_J, "herb_milkweed_single" },
-		{ "herb_moccasin_flower_orchid"_J, "herb_moccasin_flower_orchid" },
-		{ "herb_night_scented_orchid"_J, "herb_night_scented_orchid" },
-		{ "herb_oleander_sage"_J, "herb_oleander_sage" },
-		{ "herb_oleander_sage_single"_J, "herb_oleander_sage_single" },
-		{ "herb_oregano"_J, "herb_oregano" },
-		{ "herb_parasol_mushroom"_J, "herb_parasol_mushroom" },
-		{ "herb_prairie_poppy"_J, "herb_prairie_poppy" },
-		{ "herb_queens_orchid"_J, "herb_queens_orchid" },
-		{ "herb_rams_head"_J, "herb_rams_head" },
-		{ "herb_rat_tail_orchid"_J, "herb_rat_tail_orchid" },
-		{ "herb_red_raspberry"_J, "herb_red_raspberry" },
-		{ "herb_red_sage"_J, "herb_red_sage" },
-		{ "herb_sparrows_egg_orchid"_J, "herb_sparrows_egg_orchid" },
-		{ "herb_spider_orchid"_J, "herb_spider_orchid" },
-		{ "herb_vanilla_flower"_J, "herb_vanilla_flower" },
-		{ "herb_violet_snowdrop"_J, "herb_violet_snowdrop" },
-		{ "herb_wild_carrots"_J, "herb_wild_carrots" },
-		{ "herb_wild_feverfew"_J, "herb_wild_feverfew" },
-		{ "herb_wild_flower_agarita"_J, "herb_wild_flower_agarita" },
-		{ "herb_wild_flower_bitterweed"_J, "herb_wild_flower_bitterweed" },
-		{ "herb_wild_flower_blood_flower"_J, "herb_wild_flower_blood_flower" },
-		{ "herb_wild_flower_cardinal_flower"_J, "herb_wild_flower_cardinal_flower" },
-		{ "herb_wild_flower_chocolate_daisy"_J, "herb_wild_flower_chocolate_daisy" },
-		{ "herb_wild_flower_creek_plum"_J, "herb_wild_flower_creek_plum" },
-		{ "herb_wild_flower_rhubarb"_J, "herb_wild_flower_rhubarb" },
-		{ "herb_wild_flower_texas_blue_bonnet"_J, "herb_wild_flower_texas_blue_bonnet" },
-		{ "herb_wild_flower_wisteria"_J, "herb_wild_flower_wisteria" },
-		{ "herb_wild_mint"_J, "herb_wild_mint" },
-		{ "herb_wintergreen_berry"_J, "herb_wintergreen_berry" },
-		{ "herb_yarrow"_J, "herb_yarrow" },
-		{ "herb_yarrow_single"_J, "herb_yarrow_single" },
-		{ "horseshoeoverlook"_J, "horseshoeoverlook" },
-		{ "hub"_J, "hub" },
-		{ "hub_offers"_J, "hub_offers" },
-		{ "init_global_block_creator"_J, "init_global_block_creator" },
-		{ "init_global_block_mc"_J, "init_global_block_mc" },
-		{ "init_global_block_mc_deathmatch"_J, "init_global_block_mc_deathmatch" },
-		{ "init_global_block_mc_race"_J, "init_global_block_mc_race" },
-		{ "init_global_block_mc_subsys"_J, "init_global_block_mc_subsys" },
-		{ "init_global_block_mm_grid"_J, "init_global_block_mm_grid" },
-		{ "init_global_block_mp"_J, "init_global_block_mp" },
-		{ "init_global_block_profiler"_J, "init_global_block_profiler" },
-		{ "init_global_block_shared"_J, "init_global_block_shared" },
-		{ "init_global_block_softsave"_J, "init_global_block_softsave" },
-		{ "init_global_block_sp"_J, "init_global_block_sp" },
-		{ "init_global_block_transition"_J, "init_global_block_transition" },
-		{ "init_global_block_ugc"_J, "init_global_block_ugc" },
-		{ "init_global_block_ugc_common"_J, "init_global_block_ugc_common" },
-		{ "init_global_block_ugc_cutscene"_J, "init_global_block_ugc_cutscene" },
-		{ "init_global_block_ugc_transition"_J, "init_global_block_ugc_transition" },
-		{ "interactive_campfire"_J, "interactive_campfire" },
-		{ "itemdatabase_debug"_J, "itemdatabase_debug" },
-		{ "item_bait_herbivore"_J, "item_bait_herbivore" },
-		{ "item_bait_predator"_J, "item_bait_predator" },
-		{ "item_legendary_animal_pheromone"_J, "item_legendary_animal_pheromone" },
-		{ "junction_test"_J, "junction_test" },
-		{ "junction_test_startup"_J, "junction_test_startup" },
-		{ "lagras"_J, "lagras" },
-		{ "larnedsod"_J, "larnedsod" },
-		{ "la_alligator"_J, "la_alligator" },
-		{ "la_bear"_J, "la_bear" },
-		{ "la_beaver"_J, "la_beaver" },
-		{ "la_bison"_J, "la_bison" },
-		{ "la_boar"_J, "la_boar" },
-		{ "la_buck"_J, "la_buck" },
-		{ "la_cougar"_J, "la_cougar" },
-		{ "la_coyote"_J, "la_coyote" },
-		{ "la_elk"_J, "la_elk" },
-		{ "la_fox"_J, "la_fox" },
-		{ "la_moose"_J, "la_moose" },
-		{ "la_panther"_J, "la_panther" },
-		{ "la_ram"_J, "la_ram" },
-		{ "la_wolf"_J, "la_wolf" },
-		{ "legendary_animal_map"_J, "legendary_animal_map" },
-		{ "long_update"_J, "long_update" },
-		{ "lonniesshack"_J, "lonniesshack" },
-		{ "loonycult"_J, "loonycult" },
-		{ "lovetriangle"_J, "lovetriangle" },
-		{ "luckyscabin"_J, "luckyscabin" },
-		{ "macfarlanesranch"_J, "macfarlanesranch" },
-		{ "macleanshouse"_J, "macleanshouse" },
-		{ "manzanitapost"_J, "manzanitapost" },
-		{ "map_app_event_handler"_J, "map_app_event_handler" },
-		{ "medium_update"_J, "medium_update" },
-		{ "metal_detector"_J, "metal_detector" },
-		{ "metaped_animal_testing_tool"_J, "metaped_animal_testing_tool" },
-		{ "metaped_clothing_gender_swap"_J, "metaped_clothing_gender_swap" },
-		{ "metaped_clothing_tool"_J, "metaped_clothing_tool" },
-		{ "metaped_clothing_tool_outfit_testing"_J, "metaped_clothing_tool_outfit_testing" },
-		{ "metaped_clothing_tool_quick_menu"_J, "metaped_clothing_tool_quick_menu" },
-		{ "metaped_editor"_J, "metaped_editor" },
-		{ "millesaniclaim"_J, "millesaniclaim" },
-		{ "missinghusband"_J, "missinghusband" },
-		{ "money_pile"_J, "money_pile" },
-		{ "money_scenario"_J, "money_scenario" },
-		{ "moonshine_coffee_drinking"_J, "moonshine_coffee_drinking" },
-		{ "moonshine_drink_item"_J, "moonshine_drink_item" },
-		{ "mountainman"_J, "mountainman" },
-		{ "mp_freemode_tutorial"_J, "mp_freemode_tutorial" },
-		{ "mp_intro"_J, "mp_intro" },
-		{ "mystery_item_location"_J, "mystery_item_location" },
-		{ "nb_animal_attack"_J, "nb_animal_attack" },
-		{ "nb_arrowhead_injury"_J, "nb_arrowhead_injury" },
-		{ "nb_beggar"_J, "nb_beggar" },
-		{ "nb_crashed_wagon"_J, "nb_crashed_wagon" },
-		{ "nb_duel"_J, "nb_duel" },
-		{ "nb_egg_protector"_J, "nb_egg_protector" },
-		{ "nb_graverobber"_J, "nb_graverobber" },
-		{ "nb_hobo_dog"_J, "nb_hobo_dog" },
-		{ "nb_kidnapped"_J, "nb_kidnapped" },
-		{ "nb_moonshine_camp"_J, "nb_moonshine_camp" },
-		{ "nb_photography"_J, "nb_photography" },
-		{ "nb_rival_collector"_J, "nb_rival_collector" },
-		{ "nb_runaway_wagon"_J, "nb_runaway_wagon" },
-		{ "nb_slumped_hunter"_J, "nb_slumped_hunter" },
-		{ "nb_stalking_hunter"_J, "nb_stalking_hunter" },
-		{ "nb_suspension_trap"_J, "nb_suspension_trap" },
-		{ "nb_tied_up_ped"_J, "nb_tied_up_ped" },
-		{ "nb_treasure_hunter"_J, "nb_treasure_hunter" },
-		{ "nb_tree_map"_J, "nb_tree_map" },
-		{ "nb_wildman"_J, "nb_wildman" },
-		{ "net_ability_card_ui_handler"_J, "net_ability_card_ui_handler" },
-		{ "net_ace_thread_manager"_J, "net_ace_thread_manager" },
-		{ "net_advanced_camera"_J, "net_advanced_camera" },
-		{ "net_ambient_content_evaluator"_J, "net_ambient_content_evaluator" },
-		{ "net_arrowheads"_J, "net_arrowheads" },
-		{ "net_assassination"_J, "net_assassination" },
-		{ "net_background"_J, "net_background" },
-		{ "net_beat_manager"_J, "net_beat_manager" },
-		{ "net_bird_egg_condor"_J, "net_bird_egg_condor" },
-		{ "net_bird_egg_duck"_J, "net_bird_egg_duck" },
-		{ "net_bird_egg_eagle"_J, "net_bird_egg_eagle" },
-		{ "net_bird_egg_egret"_J, "net_bird_egg_egret" },
-		{ "net_bird_egg_goose"_J, "net_bird_egg_goose" },
-		{ "net_bird_egg_hawk"_J, "net_bird_egg_hawk" },
-		{ "net_bird_egg_heron"_J, "net_bird_egg_heron" },
-		{ "net_bird_egg_loon"_J, "net_bird_egg_loon" },
-		{ "net_bird_egg_spoonbill"_J, "net_bird_egg_spoonbill" },
-		{ "net_bird_egg_vulture"_J, "net_bird_egg_vulture" },
-		{ "net_bounty_wagon"_J, "net_bounty_wagon" },
-		{ "net_buried_lost_jewelry"_J, "net_buried_lost_jewelry" },
-		{ "net_camp"_J, "net_camp" },
-		{ "net_camp_dog"_J, "net_camp_dog" },
-		{ "net_camp_dog_manager"_J, "net_camp_dog_manager" },
-		{ "net_camp_manager"_J, "net_camp_manager" },
-		{ "net_camp_stress_test"_J, "net_camp_stress_test" },
-		{ "net_char_creator"_J, "net_char_creator" },
-		{ "net_coach_holdup"_J, "net_coach_holdup" },
-		{ "net_coins"_J, "net_coins" },
-		{ "net_collectible_fossils"_J, "net_collectible_fossils" },
-		{ "net_collectible_random_dig_site"_J, "net_collectible_random_dig_site" },
-		{ "net_crew_manager"_J, "net_crew_manager" },
-		{ "net_cutscene"_J, "net_cutscene" },
-		{ "net_deathmatch_ambient_manager"_J, "net_deathmatch_ambient_manager" },
-		{ "net_entity_brain"_J, "net_entity_brain" },
-		{ "net_fake_mg_temp"_J, "net_fake_mg_temp" },
-		{ "net_fake_tg_p"_J, "net_fake_tg_p" },
-		{ "net_fast_travel_barker"_J, "net_fast_travel_barker" },
-		{ "net_fetch"_J, "net_fetch" },
-		{ "net_fetch_analytics"_J, "net_fetch_analytics" },
-		{ "net_fetch_hideout_leader"_J, "net_fetch_hideout_leader" },
-		{ "net_fetch_manager"_J, "net_fetch_manager" },
-		{ "net_flow_camp_manager"_J, "net_flow_camp_manager" },
-		{ "net_fme_manager"_J, "net_fme_manager" },
-		{ "net_gangfeud_manager"_J, "net_gangfeud_manager" },
-		{ "net_gun_for_hire_offline"_J, "net_gun_for_hire_offline" },
-		{ "net_gun_for_hire_online"_J, "net_gun_for_hire_online" },
-		{ "net_heirlooms"_J, "net_heirlooms" },
-		{ "net_hunting_wagon"_J, "net_hunting_wagon" },
-		{ "net_impromptu_race_online"_J, "net_impromptu_race_online" },
-		{ "net_in_world_deathmatch"_J, "net_in_world_deathmatch" },
-		{ "net_jail"_J, "net_jail" },
-		{ "net_lost_jewelry_chest"_J, "net_lost_jewelry_chest" },
-		{ "net_main_offline"_J, "net_main_offline" },
-		{ "net_main_online"_J, "net_main_online" },
-		{ "net_main_tlg_offline"_J, "net_main_tlg_offline" },
-		{ "net_main_tlg_online"_J, "net_main_tlg_online" },
-		{ "net_mc_vs_mission_intro"_J, "net_mc_vs_mission_intro" },
-		{ "net_mission_intro_story_gvo"_J, "net_mission_intro_story_gvo" },
-		{ "net_moonshine_entrance"_J, "net_moonshine_entrance" },
-		{ "net_moonshine_manager"_J, "net_moonshine_manager" },
-		{ "net_moonshine_property"_J, "net_moonshine_property" },
-		{ "net_msm_local"_J, "net_msm_local" },
-		{ "net_msm_networked"_J, "net_msm_networked" },
-		{ "net_pickup_collectibles_bottles"_J, "net_pickup_collectibles_bottles" },
-		{ "net_pickup_collectibles_heirlooms"_J, "net_pickup_collectibles_heirlooms" },
-		{ "net_pickup_collectibles_jewelry"_J, "net_pickup_collectibles_jewelry" },
-		{ "net_pickup_collectibles_tarot_cards"_J, "net_pickup_collectibles_tarot_cards" },
-		{ "net_player_camp_manager"_J, "net_player_camp_manager" },
-		{ "net_player_vehicle"_J, "net_player_vehicle" },
-		{ "net_player_wheel_item_use"_J, "net_player_wheel_item_use" },
-		{ "net_rolling_playlist"_J, "net_rolling_playlist" },
-		{ "net_scan_manager"_J, "net_scan_manager" },
-		{ "net_session_split"_J, "net_session_split" },
-		{ "net_stable_manager"_J, "net_stable_manager" },
-		{ "net_stable_mount"_J, "net_stable_mount" },
-		{ "net_tg_lobby"_J, "net_tg_lobby" },
-		{ "net_train"_J, "net_train" },
-		{ "net_train_manager"_J, "net_train_manager" },
-		{ "net_turn_in"_J, "net_turn_in" },
-		{ "net_ugc_end_flow"_J, "net_ugc_end_flow" },
-		{ "net_ugc_end_flow_transition_handler"_J, "net_ugc_end_flow_transition_handler" },
-		{ "net_ugc_end_flow_transition_online"_J, "net_ugc_end_flow_transition_online" },
-		{ "net_ugc_global_loader"_J, "net_ugc_global_loader" },
-		{ "net_ugc_intro_flow"_J, "net_ugc_intro_flow" },
-		{ "nm_test"_J, "nm_test" },
-		{ "oldfortwallace"_J, "oldfortwallace" },
-		{ "orangeplantation"_J, "orangeplantation" },
-		{ "paintedsky"_J, "paintedsky" },
-		{ "pausemenu_multiplayer"_J, "pausemenu_multiplayer" },
-		{ "pause_menu"_J, "pause_menu" },
-		{ "persona_photos"_J, "persona_photos" },
-		{ "physics_perf_test"_J, "physics_perf_test" },
-		{ "placement_editor"_J, "placement_editor" },
-		{ "placement_editor_doors"_J, "placement_editor_doors" },
-		{ "placement_editor_gang_camps"_J, "placement_editor_gang_camps" },
-		{ "placement_editor_peds"_J, "placement_editor_peds" },
-		{ "placement_editor_pickups"_J, "placement_editor_pickups" },
-		{ "placement_editor_points"_J, "placement_editor_points" },
-		{ "placement_editor_props"_J, "placement_editor_props" },
-		{ "placement_editor_prop_sets"_J, "placement_editor_prop_sets" },
-		{ "placement_editor_vehicles"_J, "placement_editor_vehicles" },
-		{ "placement_editor_volumes"_J, "placement_editor_volumes" },
-		{ "placement_editor_weapons"_J, "placement_editor_weapons" },
-		{ "player_camp"_J, "player_camp" },
-		{ "player_horse"_J, "player_horse" },
-		{ "player_menu"_J, "player_menu" },
-		{ "player_scenario_camera"_J, "player_scenario_camera" },
-		{ "pronghornranch"_J, "pronghornranch" },
-		{ "prop_drop"_J, "prop_drop" },
-		{ "pv_hunt_the_posse"_J, "pv_hunt_the_posse" },
-		{ "ransack_looting"_J, "ransack_looting" },
-		{ "ransack_moneybag"_J, "ransack_moneybag" },
-		{ "rathskellerfork"_J, "rathskellerfork" },
-		{ "region_law_bloodhound"_J, "region_law_bloodhound" },
-		{ "region_law_patrol_creator"_J, "region_law_patrol_creator" },
-		{ "region_law_rho_law_swarm"_J, "region_law_rho_law_swarm" },
-		{ "region_law_roadblock_creator"_J, "region_law_roadblock_creator" },
-		{ "region_law_town_mob"_J, "region_law_town_mob" },
-		{ "region_law_val_belltower_sniper"_J, "region_law_val_belltower_sniper" },
-		{ "region_law_w_eliz_pinks"_J, "region_law_w_eliz_pinks" },
-		{ "register_core"_J, "register_core" },
-		{ "respond_parcel"_J, "respond_parcel" },
-		{ "re_murder_camp_note"_J, "re_murder_camp_note" },
-		{ "rhodes"_J, "rhodes" },
-		{ "rhodes_donkeys"_J, "rhodes_donkeys" },
-		{ "ridgewoodfarm"_J, "ridgewoodfarm" },
-		{ "riggsstation"_J, "riggsstation" },
-		{ "rileyscharge"_J, "rileyscharge" },
-		{ "riobravotravelsales"_J, "riobravotravelsales" },
-		{ "riobravo_population"_J, "riobravo_population" },
-		{ "roanokeomj"_J, "roanokeomj" },
-		{ "roanokeridge_population"_J, "roanokeridge_population" },
-		{ "roanoketrapper"_J, "roanoketrapper" },
-		{ "rockyseven"_J, "rockyseven" },
-		{ "role_progression"_J, "role_progression" },
-		{ "run_aa_tool"_J, "run_aa_tool" },
-		{ "saintdenis"_J, "saintdenis" },
-		{ "saloon_conversations"_J, "saloon_conversations" },
-		{ "saloon_dining"_J, "saloon_dining" },
-		{ "satchel"_J, "satchel" },
-		{ "satchel_ui_event_handler"_J, "satchel_ui_event_handler" },
-		{ "save_menu_ui_event_handler"_J, "save_menu_ui_event_handler" },
-		{ "scaleform_dynamic_items_creation_test"_J, "scaleform_dynamic_items_creation_test" },
-		{ "scaleform_font_test"_J, "scaleform_font_test" },
-		{ "scaleform_graphic_test"_J, "scaleform_graphic_test" },
-		{ "scaleform_lobby_menu_demo"_J, "scaleform_lobby_menu_demo" },
-		{ "scaleform_minigame_test"_J, "scaleform_minigame_test" },
-		{ "scaleform_option_stepper_test"_J, "scaleform_option_stepper_test" },
-		{ "scaleform_pause_menu_demo"_J, "scaleform_pause_menu_demo" },
-		{ "scaleform_ui_test"_J, "scaleform_ui_test" },
-		{ "scarletthorseshop"_J, "scarletthorseshop" },
-		{ "scarlettmeadows_population"_J, "scarlettmeadows_population" },
-		{ "scarletttravelsales"_J, "scarletttravelsales" },
-		{ "scenario_point_finder"_J, "scenario_point_finder" },
-		{ "season_rewards"_J, "season_rewards" },
-		{ "security_door_knock_scenario"_J, "security_door_knock_scenario" },
-		{ "security_door_peek_scenario"_J, "security_door_peek_scenario" },
-		{ "serendipity"_J, "serendipity" },
-		{ "serialkiller"_J, "serialkiller" },
-		{ "sf_playground_script"_J, "sf_playground_script" },
-		{ "shack_item_loot_scenario"_J, "shack_item_loot_scenario" },
-		{ "shadybelle"_J, "shadybelle" },
-		{ "shepherdsrise"_J, "shepherdsrise" },
-		{ "shooting_range"_J, "shooting_range" },
-		{ "shop_bait"_J, "shop_bait" },
-		{ "shop_butcher"_J, "shop_butcher" },
-		{ "shop_camp_butchertable"_J, "shop_camp_butchertable" },
-		{ "shop_camp_lockbox"_J, "shop_camp_lockbox" },
-		{ "shop_doctor"_J, "shop_doctor" },
-		{ "shop_dynamic"_J, "shop_dynamic" },
-		{ "shop_fence"_J, "shop_fence" },
-		{ "shop_general"_J, "shop_general" },
-		{ "shop_gunsmith"_J, "shop_gunsmith" },
-		{ "shop_handheld"_J, "shop_handheld" },
-		{ "shop_handheld_event_handler"_J, "shop_handheld_event_handler" },
-		{ "shop_harriet"_J, "shop_harriet" },
-		{ "shop_honor_mp"_J, "shop_honor_mp" },
-		{ "shop_horse_shop"_J, "shop_horse_shop" },
-		{ "shop_moonshine_shop"_J, "shop_moonshine_shop" },
-		{ "shop_moonshine_still"_J, "shop_moonshine_still" },
-		{ "shop_net_barber"_J, "shop_net_barber" },
-		{ "shop_photo_shoot"_J, "shop_photo_shoot" },
-		{ "shop_photo_studio"_J, "shop_photo_studio" },
-		{ "shop_post_office"_J, "shop_post_office" },
-		{ "shop_tailor"_J, "shop_tailor" },
-		{ "shop_theater"_J, "shop_theater" },
-		{ "shop_train_station"_J, "shop_train_station" },
-		{ "shop_trapper"_J, "shop_trapper" },
-		{ "shop_travelling_salesman"_J, "shop_travelling_salesman" },
-		{ "shop_wilderness_supplies"_J, "shop_wilderness_supplies" },
-		{ "short_update"_J, "short_update" },
-		{ "show_mp_nbx_bigband_01"_J, "show_mp_nbx_bigband_01" },
-		{ "show_mp_nbx_bigband_02"_J, "show_mp_nbx_bigband_02" },
-		{ "show_mp_nbx_bulletcatcher"_J, "show_mp_nbx_bulletcatcher" },
-		{ "show_mp_nbx_cancan_01"_J, "show_mp_nbx_cancan_01" },
-		{ "show_mp_nbx_cancan_02"_J, "show_mp_nbx_cancan_02" },
-		{ "show_mp_nbx_escapeartist"_J, "show_mp_nbx_escapeartist" },
-		{ "show_mp_nbx_escapenoose"_J, "show_mp_nbx_escapenoose" },
-		{ "show_mp_nbx_firebreath"_J, "show_mp_nbx_firebreath" },
-		{ "show_mp_nbx_firedance_01"_J, "show_mp_nbx_firedance_01" },
-		{ "show_mp_nbx_firedance_02"_J, "show_mp_nbx_firedance_02" },
-		{ "show_mp_nbx_flexfight"_J, "show_mp_nbx_flexfight" },
-		{ "show_mp_nbx_oddfellows"_J, "show_mp_nbx_oddfellows" },
-		{ "show_mp_nbx_snakedance_01"_J, "show_mp_nbx_snakedance_01" },
-		{ "show_mp_nbx_snakedance_02"_J, "show_mp_nbx_snakedance_02" },
-		{ "show_mp_nbx_strongwoman"_J, "show_mp_nbx_strongwoman" },
-		{ "show_mp_nbx_sworddancer"_J, "show_mp_nbx_sworddancer" },
-		{ "show_mp_sdn_movie_01"_J, "show_mp_sdn_movie_01" },
-		{ "simple_crafting"_J, "simple_crafting" },
-		{ "sisikapenitentiary"_J, "sisikapenitentiary" },
-		{ "slavepen"_J, "slavepen" },
-		{ "sleeping_scenario"_J, "sleeping_scenario" },
-		{ "smoketest"_J, "smoketest" },
-		{ "smoketest_budget"_J, "smoketest_budget" },
-		{ "smoketest_second_screen"_J, "smoketest_second_screen" },
-		{ "smoketest_stability"_J, "smoketest_stability" },
-		{ "smoketest_wait"_J, "smoketest_wait" },
-		{ "startup"_J, "startup" },
-		{ "startup_clip"_J, "startup_clip" },
-		{ "startup_mp"_J, "startup_mp" },
-		{ "startup_sp"_J, "startup_sp" },
-		{ "startup_tlg"_J, "startup_tlg" },
-		{ "starvingchildren"_J, "starvingchildren" },
-		{ "stew_eating"_J, "stew_eating" },
-		{ "strawberry"_J, "strawberry" },
-		{ "swansonstation"_J, "swansonstation" },
-		{ "talltreestrapper"_J, "talltreestrapper" },
-		{ "talltrees_population"_J, "talltrees_population" },
-		{ "test_startup"_J, "test_startup" },
-		{ "test_startup2"_J, "test_startup2" },
-		{ "tg_p"_J, "tg_p" },
-		{ "theatre_ticket_taker"_J, "theatre_ticket_taker" },
-		{ "thieveslanding"_J, "thieveslanding" },
-		{ "thread_monitor"_J, "thread_monitor" },
-		{ "tumbleweed"_J, "tumbleweed" },
-		{ "ui_sticky_feed_priority_test"_J, "ui_sticky_feed_priority_test" },
-		{ "ui_unit_tests"_J, "ui_unit_tests" },
-		{ "valentine"_J, "valentine" },
-		{ "vanhornmansion"_J, "vanhornmansion" },
-		{ "vanhorntradingpost"_J, "vanhorntradingpost" },
-		{ "virtualization_unit_test_support"_J, "virtualization_unit_test_support" },
-		{ "wallacestation"_J, "wallacestation" },
-		{ "wanted_poster"_J, "wanted_poster" },
-		{ "wapiti"_J, "wapiti" },
-		{ "wash_face_barrel_scenario"_J, "wash_face_barrel_scenario" },
-		{ "watsonscabin"_J, "watsonscabin" },
-		{ "weapon_locker"_J, "weapon_locker" },
-		{ "window_peek_scenario"_J, "window_peek_scenario" },
-		{ "xml_menus"_J, "xml_menus" },
-	};
-};
\ No newline at end of file
+	    {"fme_wildlife_photographer_offline"_J, "fme_wildlife_photographer_offline"},
+	    {"electric_lantern"_J, "electric_lantern"},
+	    {"clemenspoint"_J, "clemenspoint"},
+	    {"show_mp_nbx_flexfight"_J, "show_mp_nbx_flexfight"},
+	    {"herb"_J, "herb"},
+	    {"show_mp_sdn_movie_01"_J, "show_mp_sdn_movie_01"},
+	    {"wallacestation"_J, "wallacestation"},
+	    {"nb_rival_collector"_J, "nb_rival_collector"},
+	    {"season_rewards"_J, "season_rewards"},
+	    {"doc_book"_J, "doc_book"},
+	    {"nb_graverobber"_J, "nb_graverobber"},
+	    {"net_flow_camp_manager"_J, "net_flow_camp_manager"},
+	    {"re_murder_camp_note"_J, "re_murder_camp_note"},
+	    {"init_global_block_shared"_J, "init_global_block_shared"},
+	    {"net_fme_manager"_J, "net_fme_manager"},
+	    {"binoculars"_J, "binoculars"},
+	    {"net_heirlooms"_J, "net_heirlooms"},
+	    {"net_ambient_content_evaluator"_J, "net_ambient_content_evaluator"},
+	    {"net_camp_dog_manager"_J, "net_camp_dog_manager"},
+	    {"herb_violet_snowdrop"_J, "herb_violet_snowdrop"},
+	    {"saloon_dining"_J, "saloon_dining"},
+	    {"show_mp_nbx_firedance_01"_J, "show_mp_nbx_firedance_01"},
+	    {"fme_king_of_the_castle"_J, "fme_king_of_the_castle"},
+	    {"shop_trapper"_J, "shop_trapper"},
+	    {"gaptoothridge_population"_J, "gaptoothridge_population"},
+	    {"mountainman"_J, "mountainman"},
+	    {"net_fetch"_J, "net_fetch"},
+	    {"net_buried_lost_jewelry"_J, "net_buried_lost_jewelry"},
+	    {"nb_egg_protector"_J, "nb_egg_protector"},
+	    {"macleanshouse"_J, "macleanshouse"},
+	    {"gfh_authoring_tool"_J, "gfh_authoring_tool"},
+	    {"net_mission_intro_story_gvo"_J, "net_mission_intro_story_gvo"},
+	    {"net_gun_for_hire_offline"_J, "net_gun_for_hire_offline"},
+	    {"sleeping_scenario"_J, "sleeping_scenario"},
+	    {"net_msm_local"_J, "net_msm_local"},
+	    {"show_mp_nbx_bigband_02"_J, "show_mp_nbx_bigband_02"},
+	    {"armoire_corpse_scenario"_J, "armoire_corpse_scenario"},
+	    {"debug_fast_travel"_J, "debug_fast_travel"},
+	    {"shop_gunsmith"_J, "shop_gunsmith"},
+	    {"braithwaitemanor"_J, "braithwaitemanor"},
+	    {"shop_photo_shoot"_J, "shop_photo_shoot"},
+	    {"shooting_range"_J, "shooting_range"},
+	    {"show_mp_nbx_snakedance_01"_J, "show_mp_nbx_snakedance_01"},
+	    {"discoverable_geyser"_J, "discoverable_geyser"},
+	    {"adlerranch"_J, "adlerranch"},
+	    {"generic_ghosttown"_J, "generic_ghosttown"},
+	    {"herb_moccasin_flower_orchid"_J, "herb_moccasin_flower_orchid"},
+	    {"herb_bay_bolete"_J, "herb_bay_bolete"},
+	    {"hennigansstead_population"_J, "hennigansstead_population"},
+	    {"net_fake_mg_temp"_J, "net_fake_mg_temp"},
+	    {"show_mp_nbx_cancan_01"_J, "show_mp_nbx_cancan_01"},
+	    {"camera_item"_J, "camera_item"},
+	    {"fme_dead_drop"_J, "fme_dead_drop"},
+	    {"shop_post_office"_J, "shop_post_office"},
+	    {"net_camp_dog"_J, "net_camp_dog"},
+	    {"show_mp_nbx_firebreath"_J, "show_mp_nbx_firebreath"},
+	    {"ridgewoodfarm"_J, "ridgewoodfarm"},
+	    {"shack_item_loot_scenario"_J, "shack_item_loot_scenario"},
+	    {"net_bird_egg_vulture"_J, "net_bird_egg_vulture"},
+	    {"nb_runaway_wagon"_J, "nb_runaway_wagon"},
+	    {"ransack_looting"_J, "ransack_looting"},
+	    {"satchel"_J, "satchel"},
+	    {"startup_clip"_J, "startup_clip"},
+	});
+}
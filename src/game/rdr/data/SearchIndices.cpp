@@ -0,0 +1,32 @@
+#include "SearchIndices.hpp"
+
+#include "PedModels.hpp"
+#include "VehicleModels.hpp"
+
+namespace YimMenu::Data
+{
+	const SearchIndex& GetPedModelIndex()
+	{
+		static const SearchIndex index = [] {
+			std::vector<std::string_view> names;
+			names.reserve(g_PedModels.size());
+			for (const auto& [hash, model] : g_PedModels)
+				names.push_back(model);
+			return SearchIndex(std::move(names));
+		}();
+
+		return index;
+	}
+
+	const SearchIndex& GetVehicleModelIndex()
+	{
+		static const SearchIndex index = [] {
+			std::vector<std::string_view> names;
+			for (const auto& vehicle : g_VehicleModels)
+				names.push_back(vehicle.model);
+			return SearchIndex(std::move(names));
+		}();
+
+		return index;
+	}
+}
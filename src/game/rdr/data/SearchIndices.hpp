@@ -0,0 +1,10 @@
+#pragma once
+#include "util/SearchIndex.hpp"
+
+namespace YimMenu::Data
+{
+	// search indices over the model catalogues, built the first time they are used. the indices follow the order the
+	// catalogue is iterated in
+	const SearchIndex& GetPedModelIndex();
+	const SearchIndex& GetVehicleModelIndex();
+}
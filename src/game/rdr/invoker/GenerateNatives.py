@@ -60,6 +60,10 @@ class NativeFunc:
 
         return f"{var_template}FORCEINLINE constexpr {self.return_type} {self.name}({param_decl}) {{ return YimMenu::NativeInvoker::Invoke<{self.native_index}, {self.return_type}, {self.fix_vectors}>({param_pass}); }}"
     
+    def get_signature_str(self) -> str:
+        arg_types = ", ".join([arg.type for arg in self.args])
+        return f"template<> struct NativeSignature<NativeIndex::{self.name}> {{ using Ret = {self.return_type}; using Args = std::tuple<{arg_types}>; static constexpr bool FIX_VECTORS = {self.fix_vectors}; }};"
+
 def load_natives_data():
     global natives
 
@@ -82,6 +86,7 @@ namespace YimMenu
 def write_natives_header():
     natives_buf = ""
     natives_index_buf = ""
+    signatures_buf = ""
 
     for ns, nvs in natives.items():
         natives_buf += f"namespace {ns}\n{{\n"
@@ -91,6 +96,8 @@ def write_natives_header():
 
             natives_buf += f"\t{nat_data.get_native_def_str()}\n"
             natives_index_buf += f"\t{nat_data.name} = {nat_data.native_index},\n"
+            if not nat_data.variadic:
+                signatures_buf += f"{nat_data.get_signature_str()}\n"
         natives_buf += "}\n\n"
     
     natives_buf = natives_buf[:-2]
@@ -98,13 +105,20 @@ def write_natives_header():
     open("../Natives.hpp", "w+").write(f"""#pragma once
 #include "invoker/invoker.hpp"
 
+#include <tuple>
+
 // clang-format off
 enum class NativeIndex
 {{
 {natives_index_buf}}};
 
 {natives_buf}
-// clang-format on
+
+// the return and argument types of every native that isn't variadic, for calls that are queued instead of made
+template<NativeIndex index>
+struct NativeSignature;
+
+{signatures_buf}// clang-format on
 """)
     
 if __name__ == "__main__":
@@ -23,4 +23,21 @@ namespace YimMenu
 
 		m_AreHandlersCached = true;
 	}
+
+	void NativeInvoker::InvokeRaw(NativeIndex index, std::span<const std::uint64_t> args, bool fix_vectors, void* result, std::size_t size)
+	{
+		NativeInvoker invoker{};
+
+		invoker.BeginCall();
+		for (auto arg : args)
+			invoker.PushArg(arg);
+
+		ScriptProfiler::CountNative();
+		GetNativeHandler(index)(&invoker.m_CallContext);
+		if (fix_vectors)
+			Pointers.FixVectors(&invoker.m_CallContext);
+
+		if (result && size)
+			std::memcpy(result, &invoker.GetReturnValue<std::uint64_t>(), size);
+	}
 }
\ No newline at end of file
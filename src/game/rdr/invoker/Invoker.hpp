@@ -1,9 +1,11 @@
 #pragma once
 #include "Crossmap.hpp"
+#include "game/backend/ScriptProfiler.hpp"
 #include "game/pointers/Pointers.hpp"
 
 #include <script/scrNativeHandler.hpp>
 #include <script/types.hpp>
+#include <span>
 
 enum class NativeIndex;
 namespace YimMenu
@@ -43,6 +45,7 @@ namespace YimMenu
 		template<int index, bool fix_vectors>
 		constexpr void EndCall()
 		{
+			ScriptProfiler::CountNative();
 			m_Handlers[index](&m_CallContext);
 			if constexpr (fix_vectors)
 				Pointers.FixVectors(&m_CallContext);
@@ -78,6 +81,10 @@ namespace YimMenu
 			}
 		}
 
+		// for calls whose native is only known at runtime. every argument takes up one slot, and size bytes of the return
+		// value are copied to result
+		static void InvokeRaw(NativeIndex index, std::span<const std::uint64_t> args, bool fix_vectors, void* result, std::size_t size);
+
 		static constexpr rage::scrNativeHandler GetNativeHandler(NativeIndex index)
 		{
 			if (!m_AreHandlersCached) [[unlikely]]
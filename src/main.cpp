@@ -9,10 +9,16 @@
 #include "core/settings/Settings.hpp"
 #include "game/backend/FiberPool.hpp"
 #include "game/backend/MapEditor/MapEditor.hpp"
+#include "game/backend/NetEventLog.hpp"
 #include "game/backend/ScriptMgr.hpp"
 #include "game/backend/NativeHooks.hpp"
+#include "game/backend/NativeQueue.hpp"
 #include "game/backend/SavedLocations.hpp"
+#include "game/backend/ScriptPatterns.hpp"
+#include "game/backend/Streaming.hpp"
+#include "game/backend/VariableWatch.hpp"
 #include "game/features/Features.hpp"
+#include "game/frontend/ESP.hpp"
 #include "game/frontend/GUI.hpp"
 #include "game/pointers/Pointers.hpp"
 
@@ -58,6 +64,10 @@ namespace YimMenu
 		ScriptMgr::AddScript(std::make_unique<Script>(&BlockControlsForUI));
 		ScriptMgr::AddScript(std::make_unique<Script>(&ContextMenuTick));
 		ScriptMgr::AddScript(std::make_unique<Script>(&MapEditor::Update));
+		ScriptMgr::AddScript(std::make_unique<Script>(&ESP::Update));
+		ScriptMgr::AddScript(std::make_unique<Script>(&VariableWatch::Update));
+		ScriptMgr::AddScript(std::make_unique<Script>(&NativeQueue::Update));
+		ScriptMgr::AddScript(std::make_unique<Script>(&Streaming::Update));
 
 		Notifications::Show("Terminus", "Loaded succesfully", NotificationType::Success);
 
@@ -68,6 +78,8 @@ namespace YimMenu
 		while (g_Running)
 		{
 			Settings::Tick(); // TODO: move this somewhere else
+			NetEventLog::Flush();
+			ScriptPatterns::Flush();
 		}
 
 		LOG(INFO) << "Unloading";
@@ -28,13 +28,7 @@ namespace YimMenu
 		msg.GetBuffer().Write<uint64_t>(self.GetGamerInfo()->m_HostToken, 64);
 		msg.GetBuffer().Write<bool>(false, 1);
 
-		for (auto& player : Players::GetPlayers())
-		{
-			if (player.second.IsValid())
-			{
-				msg.Send(player.second.GetMessageId(), 7);
-			}
-		}
+		msg.SendToAll(7, true);
 
 		RenderChatMessage(message, self.GetName(), ImGui::Colors::Green);
 	}
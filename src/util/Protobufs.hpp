@@ -1,6 +1,344 @@
 #pragma once
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string_view>
 
 namespace YimMenu
 {
+#pragma pack(push, 1)
+	struct pb_element
+	{
+		std::uint32_t field_idx; // 0
+		std::uint8_t field_type; // 4
+		std::uint8_t unk_0;      // 5
+		char pad[0x12];          // 6
+		pb_element* sub_structure;
+		const char* debug_name;
+		void* unk_1;
+		void* unk_2;
+		void* unk_3;
+	};
+	static_assert(sizeof(pb_element) == 0x40);
+#pragma pack(pop)
+
+	enum class FieldType
+	{
+		BOOL               = 0,
+		VARINT             = 1,
+		UVARINT            = 2,
+		SVARINT            = 3,
+		FIXED32            = 4,
+		FIXED64            = 5,
+		BYTES              = 6,
+		STRING             = 7,
+		SUBMESSAGE         = 8,
+		SUBMESSAGE_W_CB    = 9,
+		EXTENSION          = 10,
+		FIXED_LENGTH_BYTES = 11,
+		INVALID            = -1
+	};
+
+	enum class TagType
+	{
+		VARINT = 0,
+		I64 = 1,
+		LEN = 2,
+		SGROUP = 3,
+		EGROUP = 4,
+		I32 = 5
+	};
+
+	// Zero copy reader. Every read is checked against the remaining length, a read that doesn't fit marks the stream
+	// as errored, moves it to the end and returns 0
+	class ProtobufStream
+	{
+		const std::uint8_t* m_Data;
+		std::size_t m_Size;
+		std::size_t m_Position;
+		bool m_Error;
+
+		void SetError()
+		{
+			m_Error    = true;
+			m_Position = m_Size;
+		}
+
+	public:
+		ProtobufStream(const void* data, std::size_t size) :
+		    m_Data(reinterpret_cast<const std::uint8_t*>(data)),
+		    m_Size(data ? size : 0),
+		    m_Position(0),
+		    m_Error(false)
+		{
+		}
+
+		bool IsEof() const
+		{
+			return m_Position >= m_Size;
+		}
+
+		bool HasError() const
+		{
+			return m_Error;
+		}
+
+		std::size_t GetRemaining() const
+		{
+			return m_Size - m_Position;
+		}
+
+		std::uint64_t ReadVarInt()
+		{
+			auto data = m_Data + m_Position;
+
+			// a varint is at most 10 bytes, so when that many are left the loop doesn't need to check the length
+			if (GetRemaining() >= 10)
+			{
+				if (data[0] < 0x80)
+				{
+					m_Position += 1;
+					return data[0];
+				}
+
+				std::uint64_t result = data[0] & 0x7F;
+				for (int i = 1; i < 10; i++)
+				{
+					result |= static_cast<std::uint64_t>(data[i] & 0x7F) << (7 * i);
+					if (data[i] < 0x80)
+					{
+						m_Position += i + 1;
+						return result;
+					}
+				}
+
+				SetError();
+				return 0;
+			}
+
+			std::uint64_t result = 0;
+			for (std::size_t i = 0; i < 10 && i < GetRemaining(); i++)
+			{
+				result |= static_cast<std::uint64_t>(data[i] & 0x7F) << (7 * i);
+				if (data[i] < 0x80)
+				{
+					m_Position += i + 1;
+					return result;
+				}
+			}
+
+			SetError();
+			return 0;
+		}
+
+		std::uint64_t ReadUInt64()
+		{
+			if (GetRemaining() < sizeof(std::uint64_t))
+			{
+				SetError();
+				return 0;
+			}
+
+			std::uint64_t res;
+			std::memcpy(&res, &m_Data[m_Position], sizeof(res));
+			m_Position += sizeof(res);
+			return res;
+		}
+
+		std::uint64_t ReadUInt32()
+		{
+			if (GetRemaining() < sizeof(std::uint32_t))
+			{
+				SetError();
+				return 0;
+			}
+
+			std::uint32_t res;
+			std::memcpy(&res, &m_Data[m_Position], sizeof(res));
+			m_Position += sizeof(res);
+			return res;
+		}
+
+		// the returned view points into the message
+		std::string_view ReadBytes(std::uint64_t len)
+		{
+			if (GetRemaining() < len)
+			{
+				SetError();
+				return {};
+			}
+
+			std::string_view bytes(reinterpret_cast<const char*>(&m_Data[m_Position]), static_cast<std::size_t>(len));
+			m_Position += static_cast<std::size_t>(len);
+			return bytes;
+		}
+
+		void Seek(std::uint64_t len)
+		{
+			ReadBytes(len);
+		}
+	};
+
+	// Field lookup into one of the game's pb_element tables. Fields are almost always serialized in table order, so the
+	// entry after the previous match is tried before falling back to a scan of the table
+	class ProtobufSchema
+	{
+		const pb_element* m_Fields;
+		const pb_element* m_Hint;
+
+	public:
+		ProtobufSchema(const pb_element* fields) :
+		    m_Fields(fields),
+		    m_Hint(fields)
+		{
+		}
+
+		const pb_element* GetField(std::uint32_t idx)
+		{
+			if (m_Fields == nullptr)
+				return nullptr;
+
+			if (m_Hint->field_idx == idx)
+				return m_Hint;
+
+			if (m_Hint->field_idx != 0 && (m_Hint + 1)->field_idx == idx)
+				return ++m_Hint;
+
+			for (auto cur = m_Fields; cur->field_idx != 0; cur++)
+			{
+				if (cur->field_idx == idx)
+					return m_Hint = cur;
+			}
+
+			return nullptr;
+		}
+	};
+
+	struct ProtobufField
+	{
+		int m_Number;
+		TagType m_TagType;
+		const pb_element* m_Element; // nullptr if the schema has no entry for the field
+		std::uint64_t m_Value;       // VARINT, I64 and I32 fields
+		std::string_view m_Data;     // LEN fields, points into the message
+
+		FieldType GetType() const
+		{
+			return m_Element ? FieldType(m_Element->field_type & 0x0F) : FieldType::INVALID;
+		}
+
+		bool IsSubMessage() const
+		{
+			auto type = GetType();
+			return m_TagType == TagType::LEN && (type == FieldType::SUBMESSAGE || type == FieldType::SUBMESSAGE_W_CB);
+		}
+	};
+
+	enum class ProtobufVisit
+	{
+		CONTINUE,
+		RECURSE, // descend into this field, only meaningful for submessages
+		STOP
+	};
+
+	namespace ProtobufDetail
+	{
+		enum class Result
+		{
+			DONE,
+			STOPPED,
+			MALFORMED
+		};
+
+		template<typename Visitor>
+		Result Visit(ProtobufStream stream, const pb_element* fields, Visitor& visitor, int depth)
+		{
+			// nested messages in the wild are shallow, anything deeper is garbage or an attack
+			if (depth > 32)
+				return Result::MALFORMED;
+
+			ProtobufSchema schema(fields);
+			while (!stream.IsEof())
+			{
+				// field numbers start at 1 and are at most 29 bits
+				auto tag = stream.ReadVarInt();
+				if ((tag >> 3) == 0 || (tag >> 3) > 0x1FFFFFFF || stream.HasError())
+					return Result::MALFORMED;
+
+				ProtobufField field;
+				field.m_Number  = static_cast<int>(tag >> 3);
+				field.m_TagType = TagType(tag & 0b111);
+				field.m_Element = schema.GetField(field.m_Number);
+				field.m_Value   = 0;
+
+				switch (field.m_TagType)
+				{
+				case TagType::VARINT: field.m_Value = stream.ReadVarInt(); break;
+				case TagType::I64: field.m_Value = stream.ReadUInt64(); break;
+				case TagType::I32: field.m_Value = stream.ReadUInt32(); break;
+				case TagType::LEN: field.m_Data = stream.ReadBytes(stream.ReadVarInt()); break;
+				default: return Result::MALFORMED; // groups are deprecated and never used by the game
+				}
+
+				if (stream.HasError())
+					return Result::MALFORMED;
+
+				auto action = visitor(static_cast<const ProtobufField&>(field), depth);
+				if (action == ProtobufVisit::STOP)
+					return Result::STOPPED;
+
+				if (action == ProtobufVisit::RECURSE && field.IsSubMessage())
+				{
+					if (auto result = Visit(ProtobufStream(field.m_Data.data(), field.m_Data.size()), field.m_Element->sub_structure, visitor, depth + 1); result != Result::DONE)
+						return result;
+				}
+			}
+
+			return Result::DONE;
+		}
+	}
+
+	// Calls visitor(const ProtobufField&, int depth) -> ProtobufVisit for every field in the message, without copying
+	// any of it. Returns false if the message is malformed
+	template<typename Visitor>
+	bool VisitProtoBuffer(const void* buffer, std::size_t size, const void* def, Visitor&& visitor)
+	{
+		return ProtobufDetail::Visit(ProtobufStream(buffer, size), reinterpret_cast<const pb_element*>(def), visitor, 0) != ProtobufDetail::Result::MALFORMED;
+	}
+
+	// Finds a field by its path of field numbers, e.g. {2, 1} is field 1 of the submessage in field 2. Only the
+	// submessages on the path are descended into, and the walk stops at the first match
+	inline std::optional<ProtobufField> FindProtoField(const void* buffer, std::size_t size, const void* def, std::span<const int> path)
+	{
+		std::optional<ProtobufField> result;
+		if (path.empty())
+			return result;
+
+		VisitProtoBuffer(buffer, size, def, [&](const ProtobufField& field, int depth) {
+			if (field.m_Number != path[depth])
+				return ProtobufVisit::CONTINUE;
+
+			if (depth + 1 == static_cast<int>(path.size()))
+			{
+				result = field;
+				return ProtobufVisit::STOP;
+			}
+
+			return ProtobufVisit::RECURSE;
+		});
+
+		return result;
+	}
+
+	inline std::optional<ProtobufField> FindProtoField(const void* buffer, std::size_t size, const void* def, std::initializer_list<int> path)
+	{
+		return FindProtoField(buffer, size, def, std::span<const int>(path.begin(), path.size()));
+	}
+
 	void PrintProtoBuffer(void* buffer, int size, void* def);
-}
\ No newline at end of file
+
+	// prints a single field, and everything in it if it's a submessage
+	void PrintProtoField(const ProtobufField& field);
+}
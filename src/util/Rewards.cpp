@@ -1,4 +1,5 @@
 #include "Rewards.hpp"
+#include "game/backend/ScriptMgr.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/ScriptFunction.hpp"
 #include "game/rdr/Scripts.hpp"
@@ -16,13 +17,15 @@ namespace YimMenu::Rewards
 
 	void GiveScriptReward(const RewardInfo& info, bool loottable)
 	{
-		if (!Scripts::RequestScript("interactive_campfire"_J))
-			return;
+		ScriptMgr::AddTask([](joaat_t reward, bool loottable) -> ScriptTask {
+			if (!co_await ScriptLoaded("interactive_campfire"_J))
+				co_return;
 
-		if (loottable)
-			ScriptFunctions::GiveLootTableAward.StaticCall(info.reward_hash, 0);
-		else
-			ScriptFunctions::GiveItemDatabaseAward.StaticCall(info.reward_hash, false, 255, 0, false);
+			if (loottable)
+				ScriptFunctions::GiveLootTableAward.StaticCall(reward, 0);
+			else
+				ScriptFunctions::GiveItemDatabaseAward.StaticCall(reward, false, 255, 0, false);
+		}(info.reward_hash, loottable));
 	}
 
 	void GiveRequestedRewards(std::vector<eRewardType> rewards)
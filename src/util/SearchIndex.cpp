@@ -0,0 +1,151 @@
+#include "SearchIndex.hpp"
+
+#include <algorithm>
+
+namespace YimMenu
+{
+	static std::uint32_t MakeGram(const char* s)
+	{
+		return static_cast<std::uint8_t>(s[0]) << 16 | static_cast<std::uint8_t>(s[1]) << 8 | static_cast<std::uint8_t>(s[2]);
+	}
+
+	static std::string ToLowerString(std::string_view str)
+	{
+		std::string lower(str);
+		for (auto& c : lower)
+			c = ToLower(c);
+		return lower;
+	}
+
+	SearchIndex::SearchIndex(std::vector<std::string_view> names) :
+	    m_Names(std::move(names))
+	{
+		auto count = static_cast<std::uint32_t>(m_Names.size());
+
+		m_Offsets.reserve(count + 1);
+		m_Hashes.reserve(count);
+		for (std::uint32_t i = 0; i < count; i++)
+		{
+			m_Offsets.push_back(static_cast<std::uint32_t>(m_LowerText.size()));
+			m_LowerText += ToLowerString(m_Names[i]);
+			m_Hashes.emplace_back(Joaat(m_Names[i]), i);
+		}
+		m_Offsets.push_back(static_cast<std::uint32_t>(m_LowerText.size()));
+		std::sort(m_Hashes.begin(), m_Hashes.end());
+
+		// every (trigram, name) pair once, sorted by trigram and then by name
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> pairs;
+		for (std::uint32_t i = 0; i < count; i++)
+		{
+			auto name = GetLowerName(i);
+			for (std::size_t j = 0; j + 3 <= name.size(); j++)
+				pairs.emplace_back(MakeGram(&name[j]), i);
+		}
+		std::sort(pairs.begin(), pairs.end());
+		pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+		m_Postings.reserve(pairs.size());
+		for (auto& [gram, index] : pairs)
+		{
+			if (m_GramKeys.empty() || m_GramKeys.back() != gram)
+			{
+				m_GramKeys.push_back(gram);
+				m_GramStart.push_back(static_cast<std::uint32_t>(m_Postings.size()));
+			}
+			m_Postings.push_back(index);
+		}
+		m_GramStart.push_back(static_cast<std::uint32_t>(m_Postings.size()));
+	}
+
+	std::span<const std::uint32_t> SearchIndex::GetPostings(std::uint32_t gram) const
+	{
+		auto it = std::lower_bound(m_GramKeys.begin(), m_GramKeys.end(), gram);
+		if (it == m_GramKeys.end() || *it != gram)
+			return {};
+
+		auto g = it - m_GramKeys.begin();
+		return std::span(m_Postings).subspan(m_GramStart[g], m_GramStart[g + 1] - m_GramStart[g]);
+	}
+
+	std::optional<std::uint32_t> SearchIndex::Find(joaat_t hash) const
+	{
+		auto it = std::lower_bound(m_Hashes.begin(), m_Hashes.end(), std::pair<joaat_t, std::uint32_t>(hash, 0));
+		if (it == m_Hashes.end() || it->first != hash)
+			return std::nullopt;
+
+		return it->second;
+	}
+
+	void SearchIndex::Search(std::string_view query, std::vector<std::uint32_t>& out) const
+	{
+		out.clear();
+
+		auto lower = ToLowerString(query);
+		auto count = static_cast<std::uint32_t>(m_Names.size());
+
+		// too short to have a trigram, check every name
+		if (lower.size() < 3)
+		{
+			for (std::uint32_t i = 0; i < count; i++)
+				if (GetLowerName(i).find(lower) != std::string_view::npos)
+					out.push_back(i);
+			return;
+		}
+
+		std::vector<std::span<const std::uint32_t>> lists;
+		for (std::size_t j = 0; j + 3 <= lower.size(); j++)
+		{
+			auto postings = GetPostings(MakeGram(&lower[j]));
+			if (postings.empty())
+				return;
+			lists.push_back(postings);
+		}
+
+		// intersect starting from the shortest list, every step can only shrink the candidates
+		std::sort(lists.begin(), lists.end(), [](auto& a, auto& b) {
+			return a.size() < b.size();
+		});
+
+		out.assign(lists[0].begin(), lists[0].end());
+		std::vector<std::uint32_t> scratch;
+		for (std::size_t l = 1; l < lists.size() && !out.empty(); l++)
+		{
+			scratch.clear();
+			std::set_intersection(out.begin(), out.end(), lists[l].begin(), lists[l].end(), std::back_inserter(scratch));
+			out.swap(scratch);
+		}
+
+		// having all the trigrams doesn't mean they're next to each other
+		if (lists.size() > 1)
+			std::erase_if(out, [&](std::uint32_t i) {
+				return GetLowerName(i).find(lower) == std::string_view::npos;
+			});
+	}
+
+	const std::vector<std::uint32_t>& SearchQuery::Update(std::string_view query)
+	{
+		if (m_Valid && query.size() == m_Query.size()
+		    && std::equal(query.begin(), query.end(), m_Query.begin(), [](char a, char b) {
+			       return ToLower(a) == b;
+		       }))
+			return m_Results;
+
+		auto lower = ToLowerString(query);
+
+		// anything that contains the new query also contains the old one
+		if (m_Valid && !m_Query.empty() && lower.find(m_Query) != std::string::npos)
+		{
+			std::erase_if(m_Results, [&](std::uint32_t i) {
+				return m_Index.GetLowerName(i).find(lower) == std::string_view::npos;
+			});
+		}
+		else
+		{
+			m_Index.Search(lower, m_Results);
+		}
+
+		m_Query = std::move(lower);
+		m_Valid = true;
+		return m_Results;
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "Joaat.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace YimMenu
+{
+	// Case insensitive substring search over a fixed catalogue of names, built once. The lowercased names sit in one
+	// buffer, and every trigram maps to the sorted list of names that contain it. A query intersects the postings of its
+	// trigrams and only compares the strings that survive, so the cost depends on the number of candidates and not on the
+	// size of the catalogue. The names must outlive the index
+	class SearchIndex
+	{
+		std::vector<std::string_view> m_Names;
+		std::string m_LowerText;              // every name lowercased, back to back
+		std::vector<std::uint32_t> m_Offsets; // m_Offsets[i] .. m_Offsets[i + 1] is name i in m_LowerText
+
+		// trigram -> names, as one flat array of postings with a sorted key table in front of it
+		std::vector<std::uint32_t> m_GramKeys;
+		std::vector<std::uint32_t> m_GramStart; // m_GramStart[g] .. m_GramStart[g + 1] are the postings of m_GramKeys[g]
+		std::vector<std::uint32_t> m_Postings;
+
+		// joaat of every name, sorted, with the name's index
+		std::vector<std::pair<joaat_t, std::uint32_t>> m_Hashes;
+
+		std::span<const std::uint32_t> GetPostings(std::uint32_t gram) const;
+
+	public:
+		SearchIndex() = default;
+		explicit SearchIndex(std::vector<std::string_view> names);
+
+		std::size_t GetSize() const
+		{
+			return m_Names.size();
+		}
+
+		std::string_view GetName(std::uint32_t index) const
+		{
+			return m_Names[index];
+		}
+
+		std::string_view GetLowerName(std::uint32_t index) const
+		{
+			return std::string_view(m_LowerText).substr(m_Offsets[index], m_Offsets[index + 1] - m_Offsets[index]);
+		}
+
+		// the index of the name with this joaat
+		std::optional<std::uint32_t> Find(joaat_t hash) const;
+
+		// indices of every name that contains query, ignoring case, in catalogue order
+		void Search(std::string_view query, std::vector<std::uint32_t>& out) const;
+	};
+
+	// The results of a search box over a SearchIndex. Typing usually extends the previous query, and the matches of a
+	// longer query are a subset of the previous ones, so only those are checked again
+	class SearchQuery
+	{
+		const SearchIndex& m_Index;
+		std::string m_Query; // lowercase
+		std::vector<std::uint32_t> m_Results;
+		bool m_Valid = false;
+
+	public:
+		explicit SearchQuery(const SearchIndex& index) :
+		    m_Index(index)
+		{
+		}
+
+		// cheap when the query hasn't changed since the last call
+		const std::vector<std::uint32_t>& Update(std::string_view query);
+
+		// the next update searches from scratch, for when the index was rebuilt
+		void Reset()
+		{
+			m_Valid = false;
+		}
+
+		const SearchIndex& GetIndex() const
+		{
+			return m_Index;
+		}
+	};
+}
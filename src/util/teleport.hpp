@@ -3,6 +3,7 @@
 #include "common.hpp"
 #include "core/frontend/Notifications.hpp"
 #include "game/backend/ScriptMgr.hpp"
+#include "game/backend/Streaming.hpp"
 #include "game/pointers/Pointers.hpp"
 #include "game/rdr/Entity.hpp"
 #include "game/rdr/Vehicle.hpp"
@@ -14,6 +15,7 @@
 #include <network/CNetObjectMgr.hpp>
 #include <network/netObject.hpp>
 #include <cmath>
+#include <unordered_set>
 #include "game/rdr/Network.hpp"
 
 
@@ -24,49 +26,26 @@
 
 namespace YimMenu::Teleport
 {
+	// entities with a teleport waiting on the ground to load, game thread only
+	inline std::unordered_set<int> g_GroundTeleports;
+
+	// blocks the fiber until the ground below the location has loaded and moves the location onto it
 	inline bool LoadGroundAtCoords(rage::fvector3& location)
 	{
-		constexpr float max_ground_check = 1000.f;
-		constexpr int max_attempts       = 300;
-		float ground_z                   = location.z;
-		int current_attempts             = 0;
-		bool found_ground;
-		float height;
-
-		do
-		{
-			found_ground = MISC::GET_GROUND_Z_FOR_3D_COORD(location.x, location.y, max_ground_check, &ground_z, FALSE);
-			STREAMING::REQUEST_COLLISION_AT_COORD(location.x, location.y, location.z);
-
-			if (current_attempts % 10 == 0)
-			{
-				location.z += 25.f;
-			}
-
-			++current_attempts;
-
+		GroundZ ground(location);
+		while (!ground.Poll())
 			ScriptMgr::Yield();
-		} while (!found_ground && current_attempts < max_attempts);
 
-		if (!found_ground)
-		{
+		auto z = ground.await_resume();
+		if (!z)
 			return false;
-		}
-
-		if (WATER::GET_WATER_HEIGHT(location.x, location.y, location.z, &height))
-		{
-			location.z = height;
-		}
-		else
-		{
-			location.z = ground_z + 1.f;
-		}
 
+		location.z = *z;
 		return true;
 	}
 
-	// Entity typdef is being ambiguous with Entity class
-	inline bool TeleportEntity(int ent, rage::fvector3 coords, bool loadGround = false)
+	// the mount or vehicle if the ped is on one
+	inline int GetTeleportEntity(int ent)
 	{
 		if (ENTITY::IS_ENTITY_A_PED(ent))
 		{
@@ -76,21 +55,46 @@ namespace YimMenu::Teleport
 				ent = PED::GET_VEHICLE_PED_IS_USING(ent);
 		}
 
+		return ent;
+	}
+
+	inline bool IsTeleportPending(int ent)
+	{
+		return g_GroundTeleports.contains(GetTeleportEntity(ent));
+	}
+
+	// Entity typdef is being ambiguous with Entity class
+	inline bool TeleportEntity(int ent, rage::fvector3 coords, bool loadGround = false)
+	{
+		ent = GetTeleportEntity(ent);
+
 		// TODO: request control of entity
-		if (loadGround)
-		{
-			if (LoadGroundAtCoords(coords))
-			{
-				Entity(ent).SetPosition(coords);
-				Notifications::Show("Teleport", "Teleported entity to coords", NotificationType::Success);
-			}
-		}
-		else
-		{
+		if (loadGround && !LoadGroundAtCoords(coords))
+			return false;
+
+		Entity(ent).SetPosition(coords);
+		Notifications::Show("Teleport", "Teleported entity to coords", NotificationType::Success);
+		return true;
+	}
+
+	// like TeleportEntity with loadGround, but waits for the ground in a task instead of the caller's fiber. false if
+	// the entity already has a teleport waiting
+	inline bool TeleportEntityAsync(int ent, rage::fvector3 coords)
+	{
+		ent = GetTeleportEntity(ent);
+		if (!g_GroundTeleports.insert(ent).second)
+			return false;
+
+		ScriptMgr::AddTask([](int ent, rage::fvector3 coords) -> ScriptTask {
+			auto ground = co_await GroundZ(coords);
+			g_GroundTeleports.erase(ent);
+			if (!ground)
+				co_return;
+
+			coords.z = *ground;
 			Entity(ent).SetPosition(coords);
 			Notifications::Show("Teleport", "Teleported entity to coords", NotificationType::Success);
-		}
-
+		}(ent, coords));
 		return true;
 	}
 
@@ -0,0 +1,198 @@
+// How fast fields are written and read through datBitBuffer, through BitReader and BitWriter one field at a time, and
+// through their batched ReadFields and WriteFields. The fields are laid out like a message header followed by a few
+// event fields, repeated to fill a packet. All of them have to produce the same bytes and read back the same values
+//   BitStreamBench
+#include "game/rdr/BitStream.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace YimMenu;
+
+static constexpr int WIDTHS[]              = {14, 1, 8, 13, 3, 32, 5, 64, 7, 1};
+static constexpr std::size_t FIELD_COUNT   = std::size(WIDTHS);
+static constexpr std::size_t RECORD_COUNT  = 700;
+static constexpr std::uint32_t BUFFER_SIZE = 16384;
+
+struct Record
+{
+	std::uint64_t m_Fields[FIELD_COUNT];
+};
+
+static std::vector<Record> MakeRecords(std::mt19937_64& rng)
+{
+	std::vector<Record> records(RECORD_COUNT);
+	for (auto& record : records)
+		for (std::size_t i = 0; i < FIELD_COUNT; i++)
+			record.m_Fields[i] = WIDTHS[i] == 64 ? rng() : rng() & ((1ull << WIDTHS[i]) - 1);
+	return records;
+}
+
+// stands in for whatever uses the values, so the reads aren't optimised out
+static volatile std::uint64_t g_Sink;
+
+// the best of a few runs, in ns per record
+template<typename F>
+static double Measure(F&& run)
+{
+	using clock = std::chrono::steady_clock;
+	auto best   = std::numeric_limits<double>::max();
+	for (int i = 0; i < 5; i++)
+	{
+		std::size_t rounds = 0;
+		std::uint64_t sum  = 0;
+		auto start         = clock::now();
+		while (clock::now() - start < std::chrono::milliseconds(50))
+		{
+			sum += run();
+			rounds++;
+		}
+		auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+		g_Sink = sum;
+		best   = std::min(best, ns / (rounds * RECORD_COUNT));
+	}
+	return best;
+}
+
+static std::uint64_t WriteBuffer(std::vector<std::uint8_t>& data, const std::vector<Record>& records)
+{
+	rage::datBitBuffer buffer(data.data(), BUFFER_SIZE);
+	for (auto& record : records)
+		for (std::size_t i = 0; i < FIELD_COUNT; i++)
+			buffer.Write<std::uint64_t>(record.m_Fields[i], WIDTHS[i]);
+	return buffer.m_CurBit;
+}
+
+static std::uint64_t WriteOneByOne(std::vector<std::uint8_t>& data, const std::vector<Record>& records)
+{
+	rage::datBitBuffer buffer(data.data(), BUFFER_SIZE);
+	BitWriter writer(buffer);
+	for (auto& record : records)
+		for (std::size_t i = 0; i < FIELD_COUNT; i++)
+			writer.Write(record.m_Fields[i], WIDTHS[i]);
+	return buffer.m_CurBit;
+}
+
+static std::uint64_t WriteBatched(std::vector<std::uint8_t>& data, const std::vector<Record>& records)
+{
+	rage::datBitBuffer buffer(data.data(), BUFFER_SIZE);
+	BitWriter writer(buffer);
+	for (auto& record : records)
+	{
+		auto& f = record.m_Fields;
+		writer.WriteFields<14, 1, 8, 13, 3, 32, 5, 64, 7, 1>(f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8], f[9]);
+	}
+	return buffer.m_CurBit;
+}
+
+static rage::datBitBuffer MakeReadBuffer(std::vector<std::uint8_t>& data)
+{
+	rage::datBitBuffer buffer(data.data(), BUFFER_SIZE);
+	buffer.m_FlagBits |= 1;
+	return buffer;
+}
+
+static std::uint64_t ReadBuffer(std::vector<std::uint8_t>& data, std::vector<Record>& out)
+{
+	auto buffer       = MakeReadBuffer(data);
+	std::uint64_t sum = 0;
+	for (auto& record : out)
+		for (std::size_t i = 0; i < FIELD_COUNT; i++)
+			sum += record.m_Fields[i] = buffer.Read<std::uint64_t>(WIDTHS[i]);
+	return sum;
+}
+
+static std::uint64_t ReadOneByOne(std::vector<std::uint8_t>& data, std::vector<Record>& out)
+{
+	auto buffer = MakeReadBuffer(data);
+	BitReader reader(buffer);
+	std::uint64_t sum = 0;
+	for (auto& record : out)
+		for (std::size_t i = 0; i < FIELD_COUNT; i++)
+			sum += record.m_Fields[i] = reader.Read<std::uint64_t>(WIDTHS[i]);
+	return sum;
+}
+
+static std::uint64_t ReadBatched(std::vector<std::uint8_t>& data, std::vector<Record>& out)
+{
+	auto buffer = MakeReadBuffer(data);
+	BitReader reader(buffer);
+	std::uint64_t sum = 0;
+	for (auto& record : out)
+	{
+		auto fields = reader.ReadFields<14, 1, 8, 13, 3, 32, 5, 64, 7, 1>();
+		std::copy(fields.begin(), fields.end(), record.m_Fields);
+		sum += fields[0] + fields[7];
+	}
+	return sum;
+}
+
+static bool SameRecords(const std::vector<Record>& a, const std::vector<Record>& b)
+{
+	return std::equal(a.begin(), a.end(), b.begin(), [](const Record& x, const Record& y) {
+		return std::equal(std::begin(x.m_Fields), std::end(x.m_Fields), std::begin(y.m_Fields));
+	});
+}
+
+int main()
+{
+	std::mt19937_64 rng(0xB175);
+	auto records = MakeRecords(rng);
+
+	std::vector<std::uint8_t> reference(BUFFER_SIZE), data(BUFFER_SIZE);
+	WriteBuffer(reference, records);
+
+	int failures = 0;
+	for (auto write : {&WriteOneByOne, &WriteBatched})
+	{
+		std::fill(data.begin(), data.end(), 0);
+		write(data, records);
+		if (data != reference)
+			failures++;
+	}
+
+	std::vector<Record> read(RECORD_COUNT);
+	for (auto readAll : {&ReadBuffer, &ReadOneByOne, &ReadBatched})
+	{
+		read.assign(RECORD_COUNT, {});
+		readAll(reference, read);
+		if (!SameRecords(read, records))
+			failures++;
+	}
+
+	if (failures)
+	{
+		std::printf("%d ways of writing or reading didn't match datBitBuffer\n", failures);
+		return 1;
+	}
+
+	auto slow = Measure([&] {
+		return WriteBuffer(data, records);
+	});
+	auto one = Measure([&] {
+		return WriteOneByOne(data, records);
+	});
+	auto batched = Measure([&] {
+		return WriteBatched(data, records);
+	});
+	std::printf("write %8.1f ns datBitBuffer %8.1f ns one by one %5.2fx %8.1f ns batched %5.2fx\n", slow, one, slow / one, batched, slow / batched);
+
+	slow = Measure([&] {
+		return ReadBuffer(reference, read);
+	});
+	one = Measure([&] {
+		return ReadOneByOne(reference, read);
+	});
+	batched = Measure([&] {
+		return ReadBatched(reference, read);
+	});
+	std::printf("read  %8.1f ns datBitBuffer %8.1f ns one by one %5.2fx %8.1f ns batched %5.2fx\n", slow, one, slow / one, batched, slow / batched);
+
+	std::printf("per record of %zu fields\n", FIELD_COUNT);
+	return 0;
+}
@@ -0,0 +1,241 @@
+// BitReader and BitWriter against a bit at a time implementation of datBitBuffer's layout
+#include "game/rdr/BitStream.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace YimMenu;
+
+static int g_Failures = 0;
+
+#define CHECK(...) \
+	do \
+	{ \
+		if (!(__VA_ARGS__)) \
+		{ \
+			std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #__VA_ARGS__); \
+			g_Failures++; \
+		} \
+	} while (0)
+
+namespace Reference
+{
+	static void WriteBits(std::vector<std::uint8_t>& data, std::uint32_t& position, std::uint32_t value, int bits)
+	{
+		for (int i = 0; i < bits; i++, position++)
+		{
+			auto bit  = (value >> (bits - 1 - i)) & 1;
+			auto mask = static_cast<std::uint8_t>(0x80 >> (position & 7));
+			data[position >> 3] = bit ? (data[position >> 3] | mask) : (data[position >> 3] & ~mask);
+		}
+	}
+
+	static std::uint32_t ReadBits(const std::vector<std::uint8_t>& data, std::uint32_t& position, int bits)
+	{
+		std::uint32_t value = 0;
+		for (int i = 0; i < bits; i++, position++)
+			value = (value << 1) | ((data[position >> 3] >> (7 - (position & 7))) & 1);
+		return value;
+	}
+
+	// fields wider than 32 bits are the low dword followed by the high bits
+	static void Write(std::vector<std::uint8_t>& data, std::uint32_t& position, std::uint64_t value, int bits)
+	{
+		if (bits <= 32)
+		{
+			WriteBits(data, position, static_cast<std::uint32_t>(value), bits);
+			return;
+		}
+
+		WriteBits(data, position, static_cast<std::uint32_t>(value), 32);
+		WriteBits(data, position, static_cast<std::uint32_t>(value >> 32), bits - 32);
+	}
+
+	static std::uint64_t Read(const std::vector<std::uint8_t>& data, std::uint32_t& position, int bits)
+	{
+		if (bits <= 32)
+			return ReadBits(data, position, bits);
+
+		std::uint64_t low = ReadBits(data, position, 32);
+		return low | (static_cast<std::uint64_t>(ReadBits(data, position, bits - 32)) << 32);
+	}
+}
+
+static std::uint64_t Mask(std::uint64_t value, int bits)
+{
+	return bits >= 64 ? value : value & ((1ull << bits) - 1);
+}
+
+static std::vector<std::uint8_t> RandomBytes(std::mt19937_64& rng, std::size_t size)
+{
+	std::vector<std::uint8_t> data(size);
+	for (auto& byte : data)
+		byte = static_cast<std::uint8_t>(rng());
+	return data;
+}
+
+// writes the batch at every start offset over random bytes, the surrounding bits have to survive
+template<int... Widths>
+static void CheckBatch(std::mt19937_64& rng)
+{
+	constexpr int count = sizeof...(Widths);
+	constexpr int widths[] = {Widths...};
+	constexpr std::uint32_t total = (0u + ... + Widths);
+
+	for (std::uint32_t start = 0; start < 72; start++)
+	{
+		std::uint64_t values[] = {(static_cast<void>(Widths), rng())...};
+
+		auto size     = (start + total + 7) / 8 + 9;
+		auto expected = RandomBytes(rng, size);
+		auto actual   = expected;
+
+		auto position = start;
+		for (int i = 0; i < count; i++)
+			Reference::Write(expected, position, values[i], widths[i]);
+
+		rage::datBitBuffer buffer(actual.data(), size);
+		buffer.m_CurBit = start;
+		BitWriter writer(buffer);
+		auto written = [&]<std::size_t... I>(std::index_sequence<I...>) {
+			return writer.WriteFields<Widths...>(values[I]...);
+		}(std::make_index_sequence<count>());
+
+		CHECK(written);
+		CHECK(!writer.IsOverflowed());
+		CHECK(buffer.m_CurBit == start + total);
+		CHECK(actual == expected);
+
+		// reading it back, batched and one field at a time
+		BitReader batched(actual.data(), size);
+		batched.Skip(start);
+		auto fields = batched.ReadFields<Widths...>();
+		BitReader single(actual.data(), size);
+		single.Skip(start);
+		for (int i = 0; i < count; i++)
+		{
+			CHECK(fields[i] == Mask(values[i], widths[i]));
+			CHECK(single.Read<std::uint64_t>(widths[i]) == Mask(values[i], widths[i]));
+		}
+		CHECK(!batched.IsOverflowed());
+		CHECK(batched.GetRemaining() == size * 8 - start - total);
+	}
+}
+
+// random widths through the runtime Read and Write, up to the last bit of the buffer so the short tail load is hit
+static void CheckRandom(std::mt19937_64& rng)
+{
+	for (int round = 0; round < 2000; round++)
+	{
+		auto size     = 1 + rng() % 24;
+		auto expected = RandomBytes(rng, size);
+		auto actual   = expected;
+
+		std::vector<std::pair<std::uint64_t, int>> fields;
+		std::uint32_t position = rng() % 8;
+		auto start             = position;
+		while (true)
+		{
+			int bits = rng() % 65;
+			if (position + bits > size * 8)
+				break;
+
+			auto value = rng();
+			fields.emplace_back(value, bits);
+			Reference::Write(expected, position, value, bits);
+		}
+
+		rage::datBitBuffer buffer(actual.data(), static_cast<std::uint32_t>(size));
+		buffer.m_CurBit = start;
+		BitWriter writer(buffer);
+		for (auto& [value, bits] : fields)
+			CHECK(writer.Write(value, bits));
+		CHECK(actual == expected);
+
+		BitReader reader(actual.data(), static_cast<std::uint32_t>(size));
+		reader.Skip(start);
+		auto check = start;
+		for (auto& [value, bits] : fields)
+		{
+			CHECK(reader.Read<std::uint64_t>(bits) == Reference::Read(expected, check, bits));
+			CHECK(Reference::Read(expected, start, bits) == Mask(value, bits));
+		}
+		CHECK(!reader.IsOverflowed());
+	}
+}
+
+static void CheckBounds()
+{
+	std::uint8_t data[4] = {0xAB, 0xCD, 0xEF, 0x12};
+
+	// a batch that doesn't fit reads nothing, gives zeros and leaves the reader at the end
+	BitReader reader(data, sizeof(data));
+	reader.Skip(4);
+	auto fields = reader.ReadFields<16, 13>();
+	CHECK(reader.IsOverflowed());
+	CHECK(fields[0] == 0 && fields[1] == 0);
+	CHECK(reader.GetRemaining() == 0);
+	CHECK(reader.Read<std::uint32_t>(1) == 0);
+
+	// exactly to the end is fine
+	BitReader exact(data, sizeof(data));
+	auto all = exact.ReadFields<4, 28>();
+	CHECK(!exact.IsOverflowed());
+	CHECK(all[0] == 0xA && all[1] == 0xBCDEF12);
+
+	BitReader wide(data, sizeof(data));
+	CHECK(wide.Read<std::uint64_t>(65) == 0);
+	CHECK(wide.IsOverflowed());
+
+	BitReader skip(data, sizeof(data));
+	skip.Skip(33);
+	CHECK(skip.IsOverflowed());
+
+	// a batch that doesn't fit writes nothing at all, not even the fields that would
+	std::uint8_t out[4] = {0x11, 0x22, 0x33, 0x44};
+	rage::datBitBuffer buffer(out, sizeof(out));
+	buffer.m_CurBit = 8;
+	BitWriter writer(buffer);
+	CHECK(!writer.WriteFields<8, 8, 9>(0xFF, 0xFF, 0x1FF));
+	CHECK(writer.IsOverflowed());
+	CHECK(out[0] == 0x11 && out[1] == 0x22 && out[2] == 0x33 && out[3] == 0x44);
+	CHECK(buffer.m_CurBit == 8);
+	CHECK(!writer.Write<std::uint64_t>(0, 65));
+	CHECK(writer.WriteFields<8, 16>(0xFF, 0xBEEF));
+	CHECK(out[1] == 0xFF && out[2] == 0xBE && out[3] == 0xEF);
+	CHECK(!writer.Write(1, 1));
+
+	// reading a datBitBuffer starts where the game left off and ends at what was written
+	std::uint8_t message[8] = {0xDE, 0xAD, 0xBE, 0xEF, 0xCA, 0xFE, 0xBA, 0xBE};
+	rage::datBitBuffer written(message, sizeof(message));
+	written.m_CurBit   = 40;
+	written.m_BitsRead = 8;
+	BitReader view(written);
+	CHECK(view.GetRemaining() == 32);
+	CHECK(view.Read<std::uint32_t>(32) == 0xADBEEFCA);
+	view.Sync(written);
+	CHECK(written.m_BitsRead == 40);
+}
+
+int main()
+{
+	std::mt19937_64 rng(0x5EED);
+
+	CheckBatch<1, 7, 8, 16, 32, 64>(rng);
+	CheckBatch<3, 29, 33, 63, 5>(rng);
+	CheckBatch<14, 1, 8>(rng);
+	CheckBatch<64, 64, 1>(rng);
+	CheckBatch<31, 0, 33>(rng);
+	CheckRandom(rng);
+	CheckBounds();
+
+	if (g_Failures)
+	{
+		std::printf("%d checks failed\n", g_Failures);
+		return 1;
+	}
+
+	std::printf("all checks passed\n");
+	return 0;
+}
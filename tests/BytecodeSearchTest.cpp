@@ -0,0 +1,227 @@
+// BytecodeSearch::FindAll against trying every position of every pattern, on code split over pages that aren't next to
+// each other in memory like the VM's. Covers matches across page seams, patterns made of wildcards only, patterns longer
+// than the code and anchors that stop being scanned for once all of their patterns were found
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Pattern.hpp and Pattern.cpp lean on the menu's precompiled header, so they're built as part of this file
+using DWORD64 = std::uint64_t;
+#include "core/memory/Pattern.cpp"
+#include "game/rdr/BytecodeSearch.cpp"
+
+#include <cstdio>
+#include <random>
+
+using namespace YimMenu;
+
+static int g_Failures = 0;
+
+#define CHECK(...) \
+	do \
+	{ \
+		if (!(__VA_ARGS__)) \
+		{ \
+			std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #__VA_ARGS__); \
+			g_Failures++; \
+		} \
+	} while (0)
+
+struct Code
+{
+	std::vector<std::vector<std::uint8_t>> m_Pages;
+	std::vector<const std::uint8_t*> m_Pointers;
+	std::uint32_t m_Size;
+
+	Code(std::uint32_t size, std::mt19937_64& rng) :
+	    m_Size(size)
+	{
+		// a handful of common opcodes, like real bytecode, so the anchors have to be picked by how rare they are
+		for (std::uint32_t start = 0; start < size; start += BytecodeView::PAGE_SIZE)
+		{
+			auto& page = m_Pages.emplace_back(std::min(size - start, BytecodeView::PAGE_SIZE));
+			for (auto& byte : page)
+				byte = static_cast<std::uint8_t>(rng() % 4 ? rng() % 8 : rng());
+			m_Pointers.push_back(page.data());
+		}
+	}
+
+	BytecodeView GetView() const
+	{
+		return BytecodeView(m_Pointers.data(), m_Size);
+	}
+
+	std::uint8_t operator[](std::uint32_t pc) const
+	{
+		return m_Pages[pc / BytecodeView::PAGE_SIZE][pc % BytecodeView::PAGE_SIZE];
+	}
+};
+
+static std::optional<std::int32_t> FindNaive(const Code& code, const SimplePattern& pattern)
+{
+	auto size = static_cast<std::uint32_t>(pattern.m_Bytes.size());
+	if (size == 0 || size > code.m_Size)
+		return std::nullopt;
+
+	for (std::uint32_t start = 0; start + size <= code.m_Size; start++)
+	{
+		std::uint32_t i = 0;
+		while (i < size && (!pattern.m_Bytes[i] || *pattern.m_Bytes[i] == code[start + i]))
+			i++;
+		if (i == size)
+			return static_cast<std::int32_t>(start);
+	}
+
+	return std::nullopt;
+}
+
+// the bytes of the code at start, as a pattern with roughly one in wildcards bytes left out
+static SimplePattern MakePattern(const Code& code, std::uint32_t start, std::uint32_t size, int wildcards, std::mt19937_64& rng)
+{
+	std::string text;
+	for (std::uint32_t i = 0; i < size; i++)
+	{
+		char byte[4];
+		std::snprintf(byte, sizeof(byte), "%02X ", code[start + i]);
+		text += wildcards && i && rng() % wildcards == 0 ? "? " : byte;
+	}
+	return SimplePattern(text);
+}
+
+static std::string Repeat(const char* byte, int count)
+{
+	std::string text;
+	for (int i = 0; i < count; i++)
+		text += byte;
+	return text;
+}
+
+static void CheckAll(const Code& code, const std::vector<SimplePattern>& patterns)
+{
+	std::vector<const SimplePattern*> pointers;
+	for (auto& pattern : patterns)
+		pointers.push_back(&pattern);
+
+	std::vector<std::optional<std::int32_t>> results(patterns.size(), 12345);
+	BytecodeSearch::FindAll(code.GetView(), pointers, results);
+
+	for (std::size_t i = 0; i < patterns.size(); i++)
+	{
+		auto expected = FindNaive(code, patterns[i]);
+		if (results[i] != expected)
+		{
+			std::printf("pattern %zu of %zu bytes: found %d, expected %d\n", i, patterns[i].m_Bytes.size(), results[i].value_or(-1), expected.value_or(-1));
+			g_Failures++;
+		}
+	}
+}
+
+static void CheckRandom(std::mt19937_64& rng)
+{
+	for (int round = 0; round < 20; round++)
+	{
+		Code code(static_cast<std::uint32_t>(rng() % (BytecodeView::PAGE_SIZE * 4)) + 1, rng);
+
+		std::vector<SimplePattern> patterns;
+		for (int i = 0; i < 40; i++)
+		{
+			auto size  = static_cast<std::uint32_t>(std::min<std::uint64_t>(rng() % 24 + 1, code.m_Size));
+			auto start = static_cast<std::uint32_t>(rng() % (code.m_Size - size + 1));
+			patterns.push_back(MakePattern(code, start, size, i % 3 ? 4 : 0, rng));
+		}
+
+		// ones that are very unlikely to be in there
+		patterns.push_back(SimplePattern("FF FE FD FC FB FA F9 F8 "));
+		patterns.push_back(SimplePattern("07 ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? F3 "));
+
+		CheckAll(code, patterns);
+	}
+}
+
+static void CheckPageSeams(std::mt19937_64& rng)
+{
+	Code code(BytecodeView::PAGE_SIZE * 3 + 100, rng);
+
+	// every split of a 16 byte pattern over the first and the second seam, with and without wildcards
+	std::vector<SimplePattern> patterns;
+	for (std::uint32_t seam : {BytecodeView::PAGE_SIZE, BytecodeView::PAGE_SIZE * 2})
+		for (std::uint32_t before = 1; before < 16; before++)
+			patterns.push_back(MakePattern(code, seam - before, 16, before % 2 ? 3 : 0, rng));
+
+	// right up to the end of the last, short page
+	patterns.push_back(MakePattern(code, code.m_Size - 10, 10, 0, rng));
+
+	CheckAll(code, patterns);
+}
+
+static void CheckEdgeCases(std::mt19937_64& rng)
+{
+	Code code(64, rng);
+
+	std::vector<SimplePattern> patterns;
+	patterns.push_back(SimplePattern("? ? ? "));           // only wildcards, matches at 0
+	patterns.push_back(MakePattern(code, 0, 64, 0, rng)); // exactly the code
+	patterns.push_back(SimplePattern(Repeat("01 ", 65))); // longer than the code
+	patterns.push_back(SimplePattern(Repeat("? ", 65)));  // only wildcards, and still longer than the code
+	CheckAll(code, patterns);
+
+	std::vector<std::optional<std::int32_t>> results(patterns.size());
+	std::vector<const SimplePattern*> pointers;
+	for (auto& pattern : patterns)
+		pointers.push_back(&pattern);
+	BytecodeSearch::FindAll(code.GetView(), pointers, results);
+	CHECK(results[0] == 0);
+	CHECK(results[1] == 0);
+	CHECK(!results[2]);
+	CHECK(!results[3]);
+
+	// no code at all
+	BytecodeSearch::FindAll(BytecodeView(nullptr, 0), pointers, results);
+	CHECK(std::none_of(results.begin(), results.end(), [](auto& result) {
+		return result.has_value();
+	}));
+}
+
+static void CheckAnchorRemoval(std::mt19937_64& rng)
+{
+	Code code(BytecodeView::PAGE_SIZE * 2, rng);
+
+	// a byte that shows up a few times only, early and late, as the anchor of patterns found at different times. once
+	// the early ones are found the byte stays an anchor for the later ones, and once all are found the others still
+	// have to be found
+	std::vector<std::uint32_t> places = {100, 5000, 20000, 30000};
+	for (auto pc : places)
+		code.m_Pages[pc / BytecodeView::PAGE_SIZE][pc % BytecodeView::PAGE_SIZE] = 0xEE;
+
+	std::vector<SimplePattern> patterns;
+	for (auto pc : places)
+		patterns.push_back(MakePattern(code, pc - 3, 8, 0, rng));
+	patterns.push_back(MakePattern(code, 100, 4, 0, rng));    // the same anchor at its first byte, found with the first
+	patterns.push_back(MakePattern(code, 31000, 12, 0, rng)); // anchored elsewhere, after all of them
+
+	CheckAll(code, patterns);
+}
+
+int main()
+{
+	std::mt19937_64 rng(0xB17E);
+
+	CheckRandom(rng);
+	CheckPageSeams(rng);
+	CheckEdgeCases(rng);
+	CheckAnchorRemoval(rng);
+
+	if (g_Failures)
+	{
+		std::printf("%d checks failed\n", g_Failures);
+		return 1;
+	}
+
+	std::printf("all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,118 @@
+// How fast the occupied slots of a 2048 slot pool are found, one flag at a time as PoolIterator used to and skipping
+// free groups of 16 as it does now, at a few fill levels. Slots are either spread over the pool at random or packed at
+// the front, as a pool that hasn't been full yet has them. Both walks have to find the same slots, and a slot freed
+// while the pool is walked must not be returned
+//   PoolBench
+#include "game/rdr/PoolSlots.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace YimMenu;
+
+static constexpr std::uint32_t POOL_SIZE = 2048;
+
+static std::vector<std::uint8_t> MakeFlags(int percent, bool packed, std::mt19937_64& rng)
+{
+	std::vector<std::uint8_t> flags(POOL_SIZE);
+	for (std::uint32_t i = 0; i < POOL_SIZE; i++)
+	{
+		auto occupied = packed ? i < POOL_SIZE * percent / 100 && rng() % 10 : rng() % 100 < static_cast<std::uint64_t>(percent);
+		flags[i]      = static_cast<std::uint8_t>(occupied ? rng() % 0x80 : 0x80 | rng());
+	}
+	return flags;
+}
+
+// stands in for the loop body, so neither walk is vectorised across slots the way it can't be in the menu
+static volatile std::uint32_t g_Visited;
+
+// what PoolIterator::operator++ used to do
+static std::uint32_t NextSlotOneByOne(const std::uint8_t* flags, std::uint32_t size, std::uint32_t index)
+{
+	for (index++; index < size; index++)
+	{
+		if (IsPoolSlotValid(flags, index))
+			return index;
+	}
+
+	return size;
+}
+
+template<auto Next>
+static std::size_t Walk(const std::vector<std::uint8_t>& flags)
+{
+	std::size_t sum = 0;
+	for (auto i = Next(flags.data(), POOL_SIZE, ~0u); i < POOL_SIZE; i = Next(flags.data(), POOL_SIZE, i))
+	{
+		g_Visited = i;
+		sum += i;
+	}
+	return sum;
+}
+
+// the best of a few runs, the machine this runs on is rarely quiet
+template<typename F>
+static double Measure(const std::vector<std::uint8_t>& flags, F&& walk)
+{
+	using clock = std::chrono::steady_clock;
+	auto best   = std::numeric_limits<double>::max();
+	for (int run = 0; run < 5; run++)
+	{
+		std::size_t rounds = 0, sum = 0;
+		auto start = clock::now();
+		while (clock::now() - start < std::chrono::milliseconds(50))
+		{
+			sum += walk(flags);
+			rounds++;
+		}
+		auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+		g_Visited = static_cast<std::uint32_t>(sum);
+		best      = std::min(best, ns / rounds);
+	}
+	return best;
+}
+
+// frees every other occupied slot ahead of the one being visited, as KillAll or DeleteAllPeds can
+static bool CheckFreed(std::vector<std::uint8_t> flags)
+{
+	for (auto i = NextPoolSlot(flags.data(), POOL_SIZE, ~0u); i < POOL_SIZE; i = NextPoolSlot(flags.data(), POOL_SIZE, i))
+	{
+		if (!IsPoolSlotValid(flags.data(), i))
+			return false;
+
+		for (auto j = i + 1; j < POOL_SIZE && j < i + 8; j += 2)
+			flags[j] |= 0x80;
+	}
+	return true;
+}
+
+int main()
+{
+	std::mt19937_64 rng(0x9001);
+	int failures = 0;
+
+	for (bool packed : {false, true})
+	{
+		for (int percent : {0, 10, 50, 90, 100})
+		{
+			auto flags = MakeFlags(percent, packed, rng);
+			if (Walk<NextSlotOneByOne>(flags) != Walk<NextPoolSlot>(flags) || !CheckFreed(flags))
+			{
+				std::printf("%3d%% full: the walks don't find the same slots\n", percent);
+				failures++;
+				continue;
+			}
+
+			auto slow = Measure(flags, Walk<NextSlotOneByOne>);
+			auto fast = Measure(flags, Walk<NextPoolSlot>);
+			std::printf("%3d%% full %-7s %8.1f ns one by one %8.1f ns grouped %5.2fx\n", percent, packed ? "packed" : "spread", slow, fast, slow / fast);
+		}
+	}
+
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,98 @@
+// How fast a million points are projected to the screen, one Project call at a time and in one ProjectPoints pass, for
+// a camera looking over points scattered around it. Both have to give the same positions and flags
+//   ProjectionBench
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+
+// ImVec2 comes from the menu's precompiled header, Projection.cpp only needs the two floats
+struct ImVec2
+{
+	float x, y;
+	ImVec2() :
+	    x(0.0f),
+	    y(0.0f)
+	{
+	}
+	ImVec2(float x, float y) :
+	    x(x),
+	    y(y)
+	{
+	}
+};
+#include "game/rdr/Projection.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace YimMenu;
+
+static constexpr std::size_t POINT_COUNT = 1'000'000;
+
+// the best of a few runs, in ns per point
+template<typename F>
+static double Measure(F&& run)
+{
+	using clock = std::chrono::steady_clock;
+	auto best   = std::numeric_limits<double>::max();
+	for (int i = 0; i < 5; i++)
+	{
+		auto start = clock::now();
+		run();
+		best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - start).count() / POINT_COUNT);
+	}
+	return best;
+}
+
+int main()
+{
+	std::mt19937_64 rng(0x9807);
+	std::uniform_real_distribution<float> around(-500.0f, 500.0f);
+
+	rage::fvector3 eye(100.0f, -200.0f, 50.0f);
+	auto projection = Projection::FromCamera(eye, rage::fvector3(-10.0f, 0.0f, 45.0f), 50.0f, 1920.0f, 1080.0f);
+
+	// behind, in front and off to the sides of the camera, a few right at the near plane
+	std::vector<rage::fvector3> points(POINT_COUNT);
+	for (std::size_t i = 0; i < POINT_COUNT; i++)
+		points[i] = i % 1000 ? rage::fvector3(eye.x + around(rng), eye.y + around(rng), eye.z + around(rng) / 5) : eye;
+
+	std::vector<ImVec2> one(POINT_COUNT), batched(POINT_COUNT);
+	std::vector<std::uint8_t> oneFlags(POINT_COUNT), batchedFlags(POINT_COUNT);
+
+	auto projectOne = [&] {
+		for (std::size_t i = 0; i < POINT_COUNT; i++)
+			oneFlags[i] = projection.Project(points[i], one[i]);
+	};
+	auto projectBatched = [&] {
+		projection.ProjectPoints(points, batched, batchedFlags);
+	};
+
+	projectOne();
+	projectBatched();
+
+	std::size_t mismatches = 0, onScreen = 0;
+	for (std::size_t i = 0; i < POINT_COUNT; i++)
+	{
+		if (oneFlags[i] != batchedFlags[i] || std::memcmp(&one[i], &batched[i], sizeof(ImVec2)) != 0)
+			mismatches++;
+		if (oneFlags[i] & Projection::ON_SCREEN)
+			onScreen++;
+	}
+
+	if (mismatches)
+	{
+		std::printf("%zu points projected differently\n", mismatches);
+		return 1;
+	}
+
+	auto slow = Measure(projectOne), fast = Measure(projectBatched);
+	std::printf("%zu points, %zu on screen\n", POINT_COUNT, onScreen);
+	std::printf("%6.2f ns one by one %6.2f ns batched %5.2fx\n", slow, fast, slow / fast);
+	return 0;
+}
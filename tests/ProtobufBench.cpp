@@ -0,0 +1,65 @@
+// How fast a whole message is walked, and how fast a single field is found in it
+//   ProtobufBench [captured messages folder]
+#include "ProtobufCorpus.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace YimMenu;
+
+template<typename F>
+static void Measure(const char* name, const std::vector<ProtobufCorpus::Message>& corpus, F&& decode)
+{
+	std::size_t bytes = 0;
+	for (auto& message : corpus)
+		bytes += message.size();
+
+	using clock = std::chrono::steady_clock;
+	std::size_t rounds = 0, fields = 0;
+	auto start = clock::now();
+	while (clock::now() - start < std::chrono::seconds(1))
+	{
+		for (auto& message : corpus)
+			fields += decode(message);
+		rounds++;
+	}
+	auto ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+	std::printf("%-12s %8.1f ns/message %8.1f MB/s (%zu fields)\n", name, ns / (rounds * corpus.size()), bytes * rounds / (ns / 1e9) / 1e6, fields / rounds);
+}
+
+int main(int argc, char** argv)
+{
+	auto corpus = argc > 1 ? ProtobufCorpus::Load(argv[1]) : ProtobufCorpus::Build();
+	if (corpus.empty())
+	{
+		std::printf("no messages\n");
+		return 1;
+	}
+
+	auto schema = ProtobufCorpus::GetSchema();
+
+	Measure("visit all", corpus, [&](const ProtobufCorpus::Message& message) {
+		std::size_t fields = 0;
+		VisitProtoBuffer(message.data(), message.size(), schema, [&](const ProtobufField&, int) {
+			fields++;
+			return ProtobufVisit::RECURSE;
+		});
+		return fields;
+	});
+
+	Measure("top level", corpus, [&](const ProtobufCorpus::Message& message) {
+		std::size_t fields = 0;
+		VisitProtoBuffer(message.data(), message.size(), schema, [&](const ProtobufField&, int) {
+			fields++;
+			return ProtobufVisit::CONTINUE;
+		});
+		return fields;
+	});
+
+	Measure("find 1.3.4", corpus, [&](const ProtobufCorpus::Message& message) {
+		return static_cast<std::size_t>(FindProtoField(message.data(), message.size(), schema, {1, 3, 4}).has_value());
+	});
+
+	return 0;
+}
@@ -0,0 +1,154 @@
+#pragma once
+// Messages for the protobuf fuzz test and benchmark: a few built here, plus the ones the menu captured with
+// "Capture Server Messages" when a folder of them is passed on the command line
+#include "util/Protobufs.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ProtobufCorpus
+{
+	using Message = std::vector<std::uint8_t>;
+
+	class Encoder
+	{
+		Message m_Data;
+
+	public:
+		Encoder& VarInt(std::uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				m_Data.push_back(static_cast<std::uint8_t>(value | 0x80));
+				value >>= 7;
+			}
+			m_Data.push_back(static_cast<std::uint8_t>(value));
+			return *this;
+		}
+
+		Encoder& Tag(int number, YimMenu::TagType type)
+		{
+			return VarInt((static_cast<std::uint64_t>(number) << 3) | static_cast<std::uint64_t>(type));
+		}
+
+		Encoder& Int(int number, std::uint64_t value)
+		{
+			return Tag(number, YimMenu::TagType::VARINT).VarInt(value);
+		}
+
+		Encoder& Fixed32(int number, std::uint32_t value)
+		{
+			Tag(number, YimMenu::TagType::I32);
+			for (int i = 0; i < 4; i++)
+				m_Data.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+			return *this;
+		}
+
+		Encoder& Fixed64(int number, std::uint64_t value)
+		{
+			Tag(number, YimMenu::TagType::I64);
+			for (int i = 0; i < 8; i++)
+				m_Data.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+			return *this;
+		}
+
+		Encoder& Bytes(int number, const Message& bytes)
+		{
+			Tag(number, YimMenu::TagType::LEN).VarInt(bytes.size());
+			m_Data.insert(m_Data.end(), bytes.begin(), bytes.end());
+			return *this;
+		}
+
+		Encoder& String(int number, const std::string& text)
+		{
+			return Bytes(number, Message(text.begin(), text.end()));
+		}
+
+		const Message& Get() const
+		{
+			return m_Data;
+		}
+	};
+
+	// A schema where every field refers back to the same table, so any LEN field with an odd number is decoded as a
+	// submessage all the way down. Even numbers are strings
+	inline const YimMenu::pb_element* GetSchema()
+	{
+		static std::vector<YimMenu::pb_element> fields = [] {
+			std::vector<YimMenu::pb_element> fields(16);
+			for (int i = 0; i < 15; i++)
+			{
+				fields[i]            = {};
+				fields[i].field_idx  = i + 1;
+				fields[i].field_type = static_cast<std::uint8_t>((i + 1) % 2 ? YimMenu::FieldType::SUBMESSAGE : YimMenu::FieldType::STRING);
+			}
+			fields[15] = {};
+			return fields;
+		}();
+
+		[[maybe_unused]] static bool linked = [] {
+			for (auto& field : fields)
+				field.sub_structure = fields.data();
+			return true;
+		}();
+		return fields.data();
+	}
+
+	inline std::vector<Message> Build()
+	{
+		std::vector<Message> corpus;
+
+		Encoder inner;
+		inner.Int(2, 300).String(4, "Terminus").Fixed32(6, 0x3F800000);
+
+		Encoder nested;
+		nested.Bytes(1, inner.Get()).Int(2, 1).Bytes(3, inner.Get());
+
+		Encoder message;
+		message.Int(2, 150)
+		    .Int(4, ~0ull)
+		    .Fixed64(6, 0x0123456789ABCDEF)
+		    .String(8, "item_horse_brush")
+		    .Bytes(1, nested.Get())
+		    .Bytes(3, inner.Get())
+		    .Int(10, 0);
+		corpus.push_back(message.Get());
+		corpus.push_back(nested.Get());
+		corpus.push_back(inner.Get());
+
+		// a long flat message, like an inventory update
+		Encoder inventory;
+		for (int i = 0; i < 256; i++)
+			inventory.Bytes(1, Encoder().Int(2, i * 7919).Int(4, i).String(6, "consumable_" + std::to_string(i)).Get());
+		corpus.push_back(inventory.Get());
+
+		// nested deeper than the decoder allows
+		Encoder deep;
+		deep.Int(2, 1);
+		for (int i = 0; i < 40; i++)
+		{
+			Encoder outer;
+			outer.Bytes(1, deep.Get());
+			deep = outer;
+		}
+		corpus.push_back(deep.Get());
+
+		return corpus;
+	}
+
+	inline std::vector<Message> Load(const std::filesystem::path& folder)
+	{
+		std::vector<Message> corpus;
+		for (auto& entry : std::filesystem::directory_iterator(folder))
+		{
+			if (!entry.is_regular_file())
+				continue;
+
+			std::ifstream file(entry.path(), std::ios::binary);
+			corpus.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		}
+		return corpus;
+	}
+}
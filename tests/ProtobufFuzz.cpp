@@ -0,0 +1,166 @@
+// Decodes the corpus and mutated copies of it. Every field the decoder hands out has to lie inside the message, and
+// the corpus messages have to decode to what was encoded. Build with -DSANITIZE=ON to run it under ASan and UBSan
+//   ProtobufFuzz [captured messages folder] [iterations]
+#include "ProtobufCorpus.hpp"
+
+#include <cstdio>
+#include <random>
+
+using namespace YimMenu;
+
+static int g_Failures = 0;
+
+#define CHECK(...) \
+	do \
+	{ \
+		if (!(__VA_ARGS__)) \
+		{ \
+			std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #__VA_ARGS__); \
+			g_Failures++; \
+		} \
+	} while (0)
+
+static bool Inside(std::string_view view, const ProtobufCorpus::Message& message)
+{
+	auto begin = reinterpret_cast<const char*>(message.data());
+	return view.data() >= begin && view.data() + view.size() <= begin + message.size();
+}
+
+static void Decode(const ProtobufCorpus::Message& message, const pb_element* schema)
+{
+	VisitProtoBuffer(message.data(), message.size(), schema, [&](const ProtobufField& field, int depth) {
+		CHECK(depth <= 32);
+		CHECK(field.m_Number > 0);
+		if (field.m_TagType == TagType::LEN)
+			CHECK(Inside(field.m_Data, message));
+		return ProtobufVisit::RECURSE;
+	});
+
+	static const int paths[][3] = {{1, 1, 2}, {1, 3, 4}, {3, 6, 0}, {2, 0, 0}};
+	for (auto& path : paths)
+	{
+		auto length = path[2] ? 3 : path[1] ? 2 : 1;
+		if (auto field = FindProtoField(message.data(), message.size(), schema, std::span<const int>(path, length)); field && field->m_TagType == TagType::LEN)
+			CHECK(Inside(field->m_Data, message));
+	}
+}
+
+static ProtobufCorpus::Message Mutate(ProtobufCorpus::Message message, std::mt19937_64& rng)
+{
+	for (int i = 0, count = 1 + rng() % 4; i < count; i++)
+	{
+		switch (rng() % 5)
+		{
+		case 0:
+			if (!message.empty())
+				message[rng() % message.size()] ^= static_cast<std::uint8_t>(1 << (rng() % 8));
+			break;
+		case 1: // lengths and varints that run past the end
+			if (!message.empty())
+				message[rng() % message.size()] = static_cast<std::uint8_t>(0x80 | rng());
+			break;
+		case 2:
+			message.resize(message.empty() ? 0 : rng() % message.size());
+			break;
+		case 3:
+			message.insert(message.begin() + (message.empty() ? 0 : rng() % message.size()), static_cast<std::uint8_t>(rng()));
+			break;
+		case 4:
+			if (!message.empty())
+				message[rng() % message.size()] = 0xFF;
+			break;
+		}
+	}
+
+	return message;
+}
+
+static void CheckKnownFields()
+{
+	auto corpus = ProtobufCorpus::Build();
+	auto schema = ProtobufCorpus::GetSchema();
+	auto& message = corpus[0];
+
+	int fields = 0;
+	CHECK(VisitProtoBuffer(message.data(), message.size(), schema, [&](const ProtobufField&, int depth) {
+		if (depth == 0)
+			fields++;
+		return ProtobufVisit::CONTINUE;
+	}));
+	CHECK(fields == 7);
+
+	auto number = FindProtoField(message.data(), message.size(), schema, {2});
+	CHECK(number && number->m_Value == 150);
+
+	auto max = FindProtoField(message.data(), message.size(), schema, {4});
+	CHECK(max && max->m_Value == ~0ull);
+
+	auto fixed = FindProtoField(message.data(), message.size(), schema, {6});
+	CHECK(fixed && fixed->m_TagType == TagType::I64 && fixed->m_Value == 0x0123456789ABCDEF);
+
+	auto name = FindProtoField(message.data(), message.size(), schema, {8});
+	CHECK(name && name->m_Data == "item_horse_brush" && name->GetType() == FieldType::STRING);
+
+	auto nested = FindProtoField(message.data(), message.size(), schema, {1, 3, 4});
+	CHECK(nested && nested->m_Data == "Terminus");
+
+	auto value = FindProtoField(message.data(), message.size(), schema, {1, 1, 2});
+	CHECK(value && value->m_Value == 300);
+
+	auto real = FindProtoField(message.data(), message.size(), schema, {3, 6});
+	CHECK(real && real->m_TagType == TagType::I32 && real->m_Value == 0x3F800000);
+
+	CHECK(!FindProtoField(message.data(), message.size(), schema, {1, 5}));
+	CHECK(!FindProtoField(message.data(), message.size(), schema, {12}));
+
+	// too deep is malformed, the truncated message too
+	auto& deep = corpus.back();
+	CHECK(!VisitProtoBuffer(deep.data(), deep.size(), schema, [](const ProtobufField&, int) {
+		return ProtobufVisit::RECURSE;
+	}));
+
+	// cuts into the string before the last field
+	auto truncated = message;
+	truncated.resize(truncated.size() - 3);
+	CHECK(!VisitProtoBuffer(truncated.data(), truncated.size(), schema, [](const ProtobufField&, int) {
+		return ProtobufVisit::RECURSE;
+	}));
+}
+
+int main(int argc, char** argv)
+{
+	auto corpus = ProtobufCorpus::Build();
+	if (argc > 1)
+	{
+		auto captured = ProtobufCorpus::Load(argv[1]);
+		std::printf("%zu captured messages\n", captured.size());
+		corpus.insert(corpus.end(), captured.begin(), captured.end());
+	}
+	auto iterations = argc > 2 ? std::stoi(argv[2]) : 2000;
+
+	CheckKnownFields();
+
+	// captured messages have no schema outside the game, so they're decoded flat and against the recursive test schema
+	std::mt19937_64 rng(0xF022);
+	for (auto& message : corpus)
+	{
+		Decode(message, nullptr);
+		Decode(message, ProtobufCorpus::GetSchema());
+
+		for (int i = 0; i < iterations; i++)
+		{
+			auto mutated = Mutate(message, rng);
+			Decode(mutated, nullptr);
+			Decode(mutated, ProtobufCorpus::GetSchema());
+		}
+	}
+
+	if (g_Failures)
+	{
+		std::printf("%d checks failed\n", g_Failures);
+		return 1;
+	}
+
+	std::printf("%zu messages, %d mutations each, all checks passed\n", corpus.size(), iterations);
+	return 0;
+}
@@ -0,0 +1,174 @@
+// SpatialGrid against checking every item, on 10k items spread over a map sized area with clusters like towns have.
+// Every query has to give what the linear scan gives
+//   SpatialGridBench
+#include "core/misc/SpatialGrid.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+using namespace YimMenu;
+
+static constexpr std::size_t ITEM_COUNT = 10000;
+static constexpr float MAP_SIZE         = 8000.0f;
+
+static std::vector<rage::fvector3> MakePositions(std::mt19937_64& rng)
+{
+	std::uniform_real_distribution<float> map(-MAP_SIZE / 2, MAP_SIZE / 2);
+	std::normal_distribution<float> town(0.0f, 60.0f);
+	std::uniform_real_distribution<float> height(0.0f, 300.0f);
+
+	std::vector<rage::fvector3> towns(20);
+	for (auto& center : towns)
+		center = {map(rng), map(rng), height(rng)};
+
+	// half of them around towns, the rest anywhere
+	std::vector<rage::fvector3> positions(ITEM_COUNT);
+	for (std::size_t i = 0; i < ITEM_COUNT; i++)
+	{
+		if (i % 2)
+		{
+			auto& center = towns[rng() % towns.size()];
+			positions[i] = {center.x + town(rng), center.y + town(rng), center.z + town(rng) / 10};
+		}
+		else
+		{
+			positions[i] = {map(rng), map(rng), height(rng)};
+		}
+	}
+	return positions;
+}
+
+static float DistanceSquared(const rage::fvector3& a, const rage::fvector3& b)
+{
+	auto dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+	return dx * dx + dy * dy + dz * dz;
+}
+
+// the best of a few runs of calling query for each center, in ns per query
+template<typename F>
+static double Measure(const std::vector<rage::fvector3>& centers, F&& query)
+{
+	using clock = std::chrono::steady_clock;
+	auto best   = std::numeric_limits<double>::max();
+	for (int run = 0; run < 5; run++)
+	{
+		auto start = clock::now();
+		for (auto& center : centers)
+			query(center);
+		best = std::min(best, std::chrono::duration<double, std::nano>(clock::now() - start).count() / centers.size());
+	}
+	return best;
+}
+
+int main()
+{
+	std::mt19937_64 rng(0x6A1D);
+	auto positions = MakePositions(rng);
+
+	// query from where the items are, like the player usually is
+	std::vector<rage::fvector3> centers(1000);
+	for (auto& center : centers)
+		center = positions[rng() % positions.size()];
+
+	SpatialGrid grid;
+	auto build = Measure({rage::fvector3{}}, [&](const rage::fvector3&) {
+		grid.Build(positions);
+	});
+
+	int failures = 0;
+	std::vector<std::uint32_t> found, expected;
+	std::vector<std::pair<float, std::uint32_t>> nearest;
+
+	auto gridRadius = [&](const rage::fvector3& center) {
+		found.clear();
+		grid.ForEachInRadius(center, 150.0f, [&](std::uint32_t item, float) {
+			found.push_back(item);
+		});
+	};
+	auto linearRadius = [&](const rage::fvector3& center) {
+		expected.clear();
+		for (std::uint32_t i = 0; i < positions.size(); i++)
+			if (DistanceSquared(positions[i], center) <= 150.0f * 150.0f)
+				expected.push_back(i);
+	};
+
+	auto gridNearest = [&](const rage::fvector3& center) {
+		grid.FindNearest(center, 16, [](std::uint32_t) {
+			return true;
+		}, nearest);
+	};
+	auto linearNearest = [&](const rage::fvector3& center) {
+		thread_local std::vector<std::pair<float, std::uint32_t>> all;
+		all.clear();
+		for (std::uint32_t i = 0; i < positions.size(); i++)
+			all.emplace_back(DistanceSquared(positions[i], center), i);
+		std::partial_sort(all.begin(), all.begin() + 16, all.end());
+		expected.clear();
+		for (std::size_t i = 0; i < 16; i++)
+			expected.push_back(all[i].second);
+	};
+
+	// the context menu's pick, 300 along the view with a radius of 10
+	auto direction = rage::fvector3{0.6f, 0.8f, 0.0f};
+	auto gridRay   = [&](const rage::fvector3& origin) {
+		found.clear();
+		grid.ForEachNearRay(origin, direction, 300.0f, 10.0f, [&](std::uint32_t item, float) {
+			found.push_back(item);
+		});
+	};
+	auto linearRay = [&](const rage::fvector3& origin) {
+		expected.clear();
+		for (std::uint32_t i = 0; i < positions.size(); i++)
+		{
+			auto& pos = positions[i];
+			auto t    = std::clamp((pos.x - origin.x) * direction.x + (pos.y - origin.y) * direction.y + (pos.z - origin.z) * direction.z, 0.0f, 300.0f);
+			if (DistanceSquared(pos, {origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t}) <= 10.0f * 10.0f)
+				expected.push_back(i);
+		}
+	};
+
+	for (auto& center : centers)
+	{
+		gridRay(center);
+		linearRay(center);
+		std::sort(found.begin(), found.end());
+		if (found != expected)
+			failures++;
+
+		gridRadius(center);
+		linearRadius(center);
+		std::sort(found.begin(), found.end());
+		if (found != expected)
+			failures++;
+
+		gridNearest(center);
+		linearNearest(center);
+		found.clear();
+		for (auto& [distSq, item] : nearest)
+			found.push_back(item);
+		if (found != expected)
+			failures++;
+	}
+
+	if (failures)
+	{
+		std::printf("%d queries didn't match the linear scan\n", failures);
+		return 1;
+	}
+
+	std::printf("build            %10.1f us\n", build / 1000);
+
+	auto slow = Measure(centers, linearRadius), fast = Measure(centers, gridRadius);
+	std::printf("radius 150       %10.1f ns linear %10.1f ns grid %6.1fx\n", slow, fast, slow / fast);
+
+	slow = Measure(centers, linearRay), fast = Measure(centers, gridRay);
+	std::printf("ray 300          %10.1f ns linear %10.1f ns grid %6.1fx\n", slow, fast, slow / fast);
+
+	slow = Measure(centers, linearNearest), fast = Measure(centers, gridNearest);
+	std::printf("16 nearest       %10.1f ns linear %10.1f ns grid %6.1fx\n", slow, fast, slow / fast);
+
+	return 0;
+}